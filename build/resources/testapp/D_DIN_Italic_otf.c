@@ -0,0 +1,6 @@
+namespace resources 
+{
+const unsigned char D_DIN_Italic_otf[] = {0x4f,0x54,0x54,0x4f,0x00,0x0d,0x00,0x80,0x00,0x03,0x00,0x50,0x43,0x46,0x46,0x20,0xec,0xaf,0x13,0x9f,0x00,0x00,0x3b,0x1c,0x00,0x00,0xb2,0x1a,0x46,0x46,0x54,0x4d,0x75,0xb6,0xcf,0x02,0x00,0x00,0xfb,0x68,0x00,0x00,0x00,0x1c,0x47,0x44,0x45,0x46,0x08,0x6f,0x07,0x79,0x00,0x00,0xed,0x38,0x00,0x00,0x00,0x5a,0x47,0x50,0x4f,0x53,0x3e,0xe1,0x65,0x15,0x00,0x00,0xef,0x5c,0x00,0x00,0x0c,0x0c,0x47,0x53,0x55,0x42,0xc8,0x95,0xd1,0x4e,0x00,0x00,0xed,0x94,0x00,0x00,0x01,0xc6,0x4f,0x53,0x2f,0x32,0x66,0x2a,0x3b,0xcd,0x00,0x00,0x01,0x40,0x00,0x00,0x00,0x60,0x63,0x6d,0x61,0x70,0x72,0x92,0x45,0xd4,0x00,0x00,0x38,0xf8,0x00,0x00,0x02,0x02,0x68,0x65,0x61,0x64,0x0f,0x60,0xc8,0x87,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0x36,0x68,0x68,0x65,0x61,0x07,0xaa,0x04,0xb2,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0x24,0x68,0x6d,0x74,0x78,0xcd,0x5a,0x2d,0x5e,0x00,0x00,0xfb,0x84,0x00,0x00,0x03,0xec,0x6d,0x61,0x78,0x70,0x00,0xfb,0x50,0x00,0x00,0x00,0x01,0x38,0x00,0x00,0x00,0x06,0x6e,0x61,0x6d,0x65,0x24,0xac,0x0a,0x8a,0x00,0x00,0x01,0xa0,0x00,0x00,0x37,0x56,0x70,0x6f,0x73,0x74,0xff,0x7a,0x00,0x32,0x00,0x00,0x3a,0xfc,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x21,0x85,0x4d,0x97,0x5f,0x0f,0x3c,0xf5,0x00,0x0b,0x03,0xe8,0x00,0x00,0x00,0x00,0xd6,0x21,0x42,0x68,0x00,0x00,0x00,0x00,0xd6,0x21,0x42,0x68,0xff,0x4d,0xff,0x58,0x04,0xb0,0x03,0x7a,0x00,0x02,0x00,0x08,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x3f,0xff,0x57,0x00,0x56,0x04,0xde,0xff,0x4d,0xff,0x1e,0x04,0xb0,0x00,0x64,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0x00,0x00,0x50,0x00,0x00,0xfb,0x00,0x00,0x00,0x03,0x01,0xed,0x01,0x90,0x00,0x05,0x00,0x04,0x02,0x8a,0x02,0x58,0xff,0xf0,0x00,0x4b,0x02,0x8a,0x02,0x58,0x00,0x4a,0x01,0x5e,0x00,0x32,0x01,0x30,0x00,0x00,0x02,0x0b,0x05,0x04,0x03,0x02,0x02,0x0a,0x02,0x04,0x80,0x00,0x00,0x6f,0x40,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x4f,0x4e,0x4f,0x00,0x01,0x00,0x0d,0xfb,0x02,0x03,0x3f,0xff,0x57,0x00,0x56,0x03,0x86,0x00,0xb8,0x20,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x01,0xfb,0x02,0xb2,0x00,0x20,0x00,0x20,0x00,0x03,0x00,0x00,0x00,0x1a,0x01,0x3e,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x5a,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x00,0x93,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0a,0x00,0xaf,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x16,0x00,0xe8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0c,0x01,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x01,0x40,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x01,0x67,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x23,0x01,0xbc,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0a,0x01,0xf6,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x0b,0x02,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x15,0x02,0x51,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x11,0x1f,0x24,0xa7,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x1a,0x35,0xfd,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x01,0x00,0x0a,0x00,0x87,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x02,0x00,0x14,0x00,0x99,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x03,0x00,0x2c,0x00,0xba,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x04,0x00,0x18,0x00,0xff,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x05,0x00,0x18,0x01,0x26,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x06,0x00,0x18,0x01,0x4d,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x07,0x00,0x46,0x01,0x74,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x08,0x00,0x14,0x01,0xe0,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x09,0x00,0x16,0x02,0x01,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0b,0x00,0x2a,0x02,0x25,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0d,0x22,0x3e,0x02,0x67,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0e,0x00,0x34,0x35,0xc7,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0xa9,0x00,0x20,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x20,0x00,0x41,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x2e,0x00,0x00,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0xa9,0x20,0x44,0x61,0x74,0x74,0x6f,0x2c,0x20,0x49,0x6e,0x63,0x2e,0x20,0x41,0x6c,0x6c,0x20,0x72,0x69,0x67,0x68,0x74,0x73,0x20,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x2e,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x00,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x2d,0x00,0x49,0x00,0x74,0x00,0x61,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x00,0x44,0x49,0x4e,0x2d,0x49,0x74,0x61,0x6c,0x69,0x63,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x49,0x00,0x74,0x00,0x61,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x20,0x00,0x42,0x00,0x75,0x00,0x69,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x31,0x00,0x30,0x00,0x30,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x20,0x49,0x74,0x61,0x6c,0x69,0x63,0x20,0x42,0x75,0x69,0x6c,0x64,0x20,0x31,0x30,0x30,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x49,0x00,0x74,0x00,0x61,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x20,0x49,0x74,0x61,0x6c,0x69,0x63,0x00,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x31,0x00,0x2e,0x00,0x30,0x00,0x30,0x00,0x00,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x30,0x30,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x2d,0x00,0x49,0x00,0x74,0x00,0x61,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x2d,0x49,0x74,0x61,0x6c,0x69,0x63,0x00,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x74,0x00,0x72,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x6b,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x00,0x44,0x61,0x74,0x74,0x6f,0x20,0x69,0x73,0x20,0x61,0x20,0x74,0x72,0x61,0x64,0x65,0x6d,0x61,0x72,0x6b,0x20,0x6f,0x66,0x20,0x44,0x61,0x74,0x74,0x6f,0x2c,0x20,0x49,0x6e,0x63,0x2e,0x00,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x00,0x44,0x61,0x74,0x74,0x6f,0x20,0x49,0x6e,0x63,0x2e,0x00,0x00,0x43,0x00,0x68,0x00,0x61,0x00,0x72,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x4e,0x00,0x69,0x00,0x78,0x00,0x00,0x43,0x68,0x61,0x72,0x6c,0x65,0x73,0x20,0x4e,0x69,0x78,0x00,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x73,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x2e,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2e,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x00,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x64,0x61,0x74,0x74,0x6f,0x2e,0x63,0x6f,0x6d,0x00,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x28,0x00,0x63,0x00,0x29,0x00,0x20,0x00,0x32,0x00,0x30,0x00,0x31,0x00,0x37,0x00,0x2c,0x00,0x20,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x20,0x00,0x28,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x40,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2e,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x29,0x00,0x2c,0x00,0x0a,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x52,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x20,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x53,0x00,0x49,0x00,0x4c,0x00,0x20,0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x31,0x00,0x2e,0x00,0x31,0x00,0x2e,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x6c,0x00,0x6f,0x00,0x77,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x6c,0x00,0x73,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x76,0x00,0x61,0x00,0x69,0x00,0x6c,0x00,0x61,0x00,0x62,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x46,0x00,0x41,0x00,0x51,0x00,0x20,0x00,0x61,0x00,0x74,0x00,0x3a,0x00,0x0a,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x73,0x00,0x63,0x00,0x72,0x00,0x69,0x00,0x70,0x00,0x74,0x00,0x73,0x00,0x2e,0x00,0x73,0x00,0x69,0x00,0x6c,0x00,0x2e,0x00,0x6f,0x00,0x72,0x00,0x67,0x00,0x2f,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x0a,0x00,0x53,0x00,0x49,0x00,0x4c,0x00,0x20,0x00,0x4f,0x00,0x50,0x00,0x45,0x00,0x4e,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x43,0x00,0x45,0x00,0x4e,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x31,0x00,0x2e,0x00,0x31,0x00,0x20,0x00,0x2d,0x00,0x20,0x00,0x32,0x00,0x36,0x00,0x20,0x00,0x46,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x75,0x00,0x61,0x00,0x72,0x00,0x79,0x00,0x20,0x00,0x32,0x00,0x30,0x00,0x30,0x00,0x37,0x00,0x0a,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x0a,0x00,0x0a,0x00,0x50,0x00,0x52,0x00,0x45,0x00,0x41,0x00,0x4d,0x00,0x42,0x00,0x4c,0x00,0x45,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x67,0x00,0x6f,0x00,0x61,0x00,0x6c,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x28,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x29,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x69,0x00,0x6d,0x00,0x75,0x00,0x6c,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6c,0x00,0x64,0x00,0x77,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x0a,0x00,0x64,0x00,0x65,0x00,0x76,0x00,0x65,0x00,0x6c,0x00,0x6f,0x00,0x70,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6c,0x00,0x6c,0x00,0x61,0x00,0x62,0x00,0x6f,0x00,0x72,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x6a,0x00,0x65,0x00,0x63,0x00,0x74,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x70,0x00,0x70,0x00,0x6f,0x00,0x72,0x00,0x74,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x63,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x0a,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x61,0x00,0x63,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x6d,0x00,0x69,0x00,0x63,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x75,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x69,0x00,0x63,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x6d,0x00,0x75,0x00,0x6e,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x0a,0x00,0x6f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6b,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x69,0x00,0x63,0x00,0x68,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x68,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x6d,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x61,0x00,0x72,0x00,0x74,0x00,0x6e,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x68,0x00,0x69,0x00,0x70,0x00,0x0a,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x20,0x00,0x61,0x00,0x6c,0x00,0x6c,0x00,0x6f,0x00,0x77,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x75,0x00,0x64,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x6f,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x6d,0x00,0x73,0x00,0x65,0x00,0x6c,0x00,0x76,0x00,0x65,0x00,0x73,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x63,0x00,0x6c,0x00,0x75,0x00,0x64,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6b,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x6c,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6d,0x00,0x62,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x2f,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x61,0x00,0x74,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x0a,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6b,0x00,0x73,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x0a,0x00,0x68,0x00,0x6f,0x00,0x77,0x00,0x65,0x00,0x76,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x6c,0x00,0x65,0x00,0x61,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x79,0x00,0x70,0x00,0x65,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x71,0x00,0x75,0x00,0x69,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x6c,0x00,0x79,0x00,0x0a,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x63,0x00,0x75,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x63,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x69,0x00,0x72,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x73,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x49,0x00,0x4e,0x00,0x49,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x53,0x00,0x0a,0x00,0x22,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x65,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x6c,0x00,0x65,0x00,0x61,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x0a,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x63,0x00,0x6c,0x00,0x65,0x00,0x61,0x00,0x72,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x6b,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x63,0x00,0x68,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x63,0x00,0x6c,0x00,0x75,0x00,0x64,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x75,0x00,0x72,0x00,0x63,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x62,0x00,0x75,0x00,0x69,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x73,0x00,0x63,0x00,0x72,0x00,0x69,0x00,0x70,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x63,0x00,0x75,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x52,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x70,0x00,0x65,0x00,0x63,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x63,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x66,0x00,0x74,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6c,0x00,0x6c,0x00,0x65,0x00,0x63,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x0a,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x64,0x00,0x64,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x2c,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x6c,0x00,0x65,0x00,0x74,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x2c,0x00,0x0a,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x62,0x00,0x73,0x00,0x74,0x00,0x69,0x00,0x74,0x00,0x75,0x00,0x74,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x2d,0x00,0x2d,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x61,0x00,0x72,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x6f,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x2d,0x00,0x2d,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2c,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x63,0x00,0x68,0x00,0x61,0x00,0x6e,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x6d,0x00,0x61,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x70,0x00,0x6f,0x00,0x72,0x00,0x74,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x0a,0x00,0x6e,0x00,0x65,0x00,0x77,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x76,0x00,0x69,0x00,0x72,0x00,0x6f,0x00,0x6e,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x41,0x00,0x75,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x72,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x73,0x00,0x69,0x00,0x67,0x00,0x6e,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x65,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x67,0x00,0x72,0x00,0x61,0x00,0x6d,0x00,0x6d,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x65,0x00,0x63,0x00,0x68,0x00,0x6e,0x00,0x69,0x00,0x63,0x00,0x61,0x00,0x6c,0x00,0x0a,0x00,0x77,0x00,0x72,0x00,0x69,0x00,0x74,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x6f,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x50,0x00,0x45,0x00,0x52,0x00,0x4d,0x00,0x49,0x00,0x53,0x00,0x53,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x20,0x00,0x26,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x4e,0x00,0x44,0x00,0x49,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x53,0x00,0x0a,0x00,0x50,0x00,0x65,0x00,0x72,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x65,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x67,0x00,0x72,0x00,0x61,0x00,0x6e,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x63,0x00,0x68,0x00,0x61,0x00,0x72,0x00,0x67,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x62,0x00,0x74,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x0a,0x00,0x61,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x75,0x00,0x64,0x00,0x79,0x00,0x2c,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x65,0x00,0x72,0x00,0x67,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6d,0x00,0x62,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x79,0x00,0x2c,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x73,0x00,0x65,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x69,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x0a,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x62,0x00,0x6a,0x00,0x65,0x00,0x63,0x00,0x74,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6c,0x00,0x6c,0x00,0x6f,0x00,0x77,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x3a,0x00,0x0a,0x00,0x0a,0x00,0x31,0x00,0x29,0x00,0x20,0x00,0x4e,0x00,0x65,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x69,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x75,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x2c,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x69,0x00,0x74,0x00,0x73,0x00,0x65,0x00,0x6c,0x00,0x66,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x32,0x00,0x29,0x00,0x20,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x6c,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x2f,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x61,0x00,0x74,0x00,0x20,0x00,0x65,0x00,0x61,0x00,0x63,0x00,0x68,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x0a,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x62,0x00,0x6f,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x63,0x00,0x6c,0x00,0x75,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x65,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x2d,0x00,0x61,0x00,0x6c,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x65,0x00,0x78,0x00,0x74,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x68,0x00,0x75,0x00,0x6d,0x00,0x61,0x00,0x6e,0x00,0x2d,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x64,0x00,0x61,0x00,0x62,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x68,0x00,0x65,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x70,0x00,0x72,0x00,0x69,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x63,0x00,0x68,0x00,0x69,0x00,0x6e,0x00,0x65,0x00,0x2d,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x64,0x00,0x61,0x00,0x62,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x65,0x00,0x74,0x00,0x61,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x61,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x6c,0x00,0x64,0x00,0x73,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x74,0x00,0x65,0x00,0x78,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x0a,0x00,0x62,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x72,0x00,0x79,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x6f,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x6c,0x00,0x64,0x00,0x73,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x65,0x00,0x61,0x00,0x73,0x00,0x69,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x76,0x00,0x69,0x00,0x65,0x00,0x77,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x33,0x00,0x29,0x00,0x20,0x00,0x4e,0x00,0x6f,0x00,0x20,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x52,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x0a,0x00,0x4e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x73,0x00,0x20,0x00,0x65,0x00,0x78,0x00,0x70,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x69,0x00,0x74,0x00,0x20,0x00,0x77,0x00,0x72,0x00,0x69,0x00,0x74,0x00,0x74,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x67,0x00,0x72,0x00,0x61,0x00,0x6e,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x72,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x0a,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x63,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x6e,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x6c,0x00,0x69,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x69,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x79,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x0a,0x00,0x70,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x34,0x00,0x29,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x41,0x00,0x75,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x0a,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x68,0x00,0x61,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x6d,0x00,0x6f,0x00,0x74,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x64,0x00,0x6f,0x00,0x72,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x64,0x00,0x76,0x00,0x65,0x00,0x72,0x00,0x74,0x00,0x69,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x0a,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x78,0x00,0x63,0x00,0x65,0x00,0x70,0x00,0x74,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x63,0x00,0x6b,0x00,0x6e,0x00,0x6f,0x00,0x77,0x00,0x6c,0x00,0x65,0x00,0x64,0x00,0x67,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x41,0x00,0x75,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x69,0x00,0x72,0x00,0x20,0x00,0x65,0x00,0x78,0x00,0x70,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x69,0x00,0x74,0x00,0x20,0x00,0x77,0x00,0x72,0x00,0x69,0x00,0x74,0x00,0x74,0x00,0x65,0x00,0x6e,0x00,0x0a,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x35,0x00,0x29,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x61,0x00,0x72,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x6f,0x00,0x6c,0x00,0x65,0x00,0x2c,0x00,0x0a,0x00,0x6d,0x00,0x75,0x00,0x73,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x69,0x00,0x72,0x00,0x65,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x6d,0x00,0x75,0x00,0x73,0x00,0x74,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x0a,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x71,0x00,0x75,0x00,0x69,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x63,0x00,0x75,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x63,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x0a,0x00,0x75,0x00,0x73,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x54,0x00,0x45,0x00,0x52,0x00,0x4d,0x00,0x49,0x00,0x4e,0x00,0x41,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6e,0x00,0x75,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x76,0x00,0x6f,0x00,0x69,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x66,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x62,0x00,0x6f,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x0a,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x6d,0x00,0x65,0x00,0x74,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x44,0x00,0x49,0x00,0x53,0x00,0x43,0x00,0x4c,0x00,0x41,0x00,0x49,0x00,0x4d,0x00,0x45,0x00,0x52,0x00,0x0a,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x4f,0x00,0x46,0x00,0x54,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x45,0x00,0x20,0x00,0x49,0x00,0x53,0x00,0x20,0x00,0x50,0x00,0x52,0x00,0x4f,0x00,0x56,0x00,0x49,0x00,0x44,0x00,0x45,0x00,0x44,0x00,0x20,0x00,0x22,0x00,0x41,0x00,0x53,0x00,0x20,0x00,0x49,0x00,0x53,0x00,0x22,0x00,0x2c,0x00,0x20,0x00,0x57,0x00,0x49,0x00,0x54,0x00,0x48,0x00,0x4f,0x00,0x55,0x00,0x54,0x00,0x20,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x52,0x00,0x41,0x00,0x4e,0x00,0x54,0x00,0x59,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x4b,0x00,0x49,0x00,0x4e,0x00,0x44,0x00,0x2c,0x00,0x0a,0x00,0x45,0x00,0x58,0x00,0x50,0x00,0x52,0x00,0x45,0x00,0x53,0x00,0x53,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x49,0x00,0x4d,0x00,0x50,0x00,0x4c,0x00,0x49,0x00,0x45,0x00,0x44,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x43,0x00,0x4c,0x00,0x55,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x20,0x00,0x42,0x00,0x55,0x00,0x54,0x00,0x20,0x00,0x4e,0x00,0x4f,0x00,0x54,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x4d,0x00,0x49,0x00,0x54,0x00,0x45,0x00,0x44,0x00,0x20,0x00,0x54,0x00,0x4f,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x52,0x00,0x41,0x00,0x4e,0x00,0x54,0x00,0x49,0x00,0x45,0x00,0x53,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x0a,0x00,0x4d,0x00,0x45,0x00,0x52,0x00,0x43,0x00,0x48,0x00,0x41,0x00,0x4e,0x00,0x54,0x00,0x41,0x00,0x42,0x00,0x49,0x00,0x4c,0x00,0x49,0x00,0x54,0x00,0x59,0x00,0x2c,0x00,0x20,0x00,0x46,0x00,0x49,0x00,0x54,0x00,0x4e,0x00,0x45,0x00,0x53,0x00,0x53,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x41,0x00,0x20,0x00,0x50,0x00,0x41,0x00,0x52,0x00,0x54,0x00,0x49,0x00,0x43,0x00,0x55,0x00,0x4c,0x00,0x41,0x00,0x52,0x00,0x20,0x00,0x50,0x00,0x55,0x00,0x52,0x00,0x50,0x00,0x4f,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x44,0x00,0x20,0x00,0x4e,0x00,0x4f,0x00,0x4e,0x00,0x49,0x00,0x4e,0x00,0x46,0x00,0x52,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x45,0x00,0x4d,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x0a,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x50,0x00,0x59,0x00,0x52,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x50,0x00,0x41,0x00,0x54,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x54,0x00,0x52,0x00,0x41,0x00,0x44,0x00,0x45,0x00,0x4d,0x00,0x41,0x00,0x52,0x00,0x4b,0x00,0x2c,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x52,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x54,0x00,0x2e,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x4e,0x00,0x4f,0x00,0x20,0x00,0x45,0x00,0x56,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x48,0x00,0x41,0x00,0x4c,0x00,0x4c,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x0a,0x00,0x43,0x00,0x4f,0x00,0x50,0x00,0x59,0x00,0x52,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x54,0x00,0x20,0x00,0x48,0x00,0x4f,0x00,0x4c,0x00,0x44,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x42,0x00,0x45,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x41,0x00,0x42,0x00,0x4c,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x43,0x00,0x4c,0x00,0x41,0x00,0x49,0x00,0x4d,0x00,0x2c,0x00,0x20,0x00,0x44,0x00,0x41,0x00,0x4d,0x00,0x41,0x00,0x47,0x00,0x45,0x00,0x53,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x41,0x00,0x42,0x00,0x49,0x00,0x4c,0x00,0x49,0x00,0x54,0x00,0x59,0x00,0x2c,0x00,0x0a,0x00,0x49,0x00,0x4e,0x00,0x43,0x00,0x4c,0x00,0x55,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x47,0x00,0x45,0x00,0x4e,0x00,0x45,0x00,0x52,0x00,0x41,0x00,0x4c,0x00,0x2c,0x00,0x20,0x00,0x53,0x00,0x50,0x00,0x45,0x00,0x43,0x00,0x49,0x00,0x41,0x00,0x4c,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x44,0x00,0x49,0x00,0x52,0x00,0x45,0x00,0x43,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x43,0x00,0x49,0x00,0x44,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x41,0x00,0x4c,0x00,0x2c,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x4e,0x00,0x53,0x00,0x45,0x00,0x51,0x00,0x55,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x49,0x00,0x41,0x00,0x4c,0x00,0x0a,0x00,0x44,0x00,0x41,0x00,0x4d,0x00,0x41,0x00,0x47,0x00,0x45,0x00,0x53,0x00,0x2c,0x00,0x20,0x00,0x57,0x00,0x48,0x00,0x45,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x20,0x00,0x41,0x00,0x43,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x52,0x00,0x41,0x00,0x43,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x54,0x00,0x4f,0x00,0x52,0x00,0x54,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x57,0x00,0x49,0x00,0x53,0x00,0x45,0x00,0x2c,0x00,0x20,0x00,0x41,0x00,0x52,0x00,0x49,0x00,0x53,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x0a,0x00,0x46,0x00,0x52,0x00,0x4f,0x00,0x4d,0x00,0x2c,0x00,0x20,0x00,0x4f,0x00,0x55,0x00,0x54,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x55,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x41,0x00,0x42,0x00,0x49,0x00,0x4c,0x00,0x49,0x00,0x54,0x00,0x59,0x00,0x20,0x00,0x54,0x00,0x4f,0x00,0x20,0x00,0x55,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x4f,0x00,0x46,0x00,0x54,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x45,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x46,0x00,0x52,0x00,0x4f,0x00,0x4d,0x00,0x0a,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x44,0x00,0x45,0x00,0x41,0x00,0x4c,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x53,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x4f,0x00,0x46,0x00,0x54,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x45,0x00,0x2e,0x00,0x00,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x31,0x37,0x2c,0x20,0x44,0x61,0x74,0x74,0x6f,0x6e,0x20,0x49,0x6e,0x63,0x20,0x28,0x66,0x6f,0x6e,0x74,0x73,0x40,0x64,0x61,0x74,0x74,0x6f,0x2e,0x63,0x6f,0x6d,0x29,0x2c,0x0a,0x77,0x69,0x74,0x68,0x20,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4e,0x61,0x6d,0x65,0x20,0x44,0x2d,0x44,0x49,0x4e,0x2e,0x0a,0x0a,0x54,0x68,0x69,0x73,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x49,0x4c,0x20,0x4f,0x70,0x65,0x6e,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x31,0x2e,0x0a,0x54,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x69,0x73,0x20,0x63,0x6f,0x70,0x69,0x65,0x64,0x20,0x62,0x65,0x6c,0x6f,0x77,0x2c,0x20,0x61,0x6e,0x64,0x20,0x69,0x73,0x20,0x61,0x6c,0x73,0x6f,0x20,0x61,0x76,0x61,0x69,0x6c,0x61,0x62,0x6c,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x46,0x41,0x51,0x20,0x61,0x74,0x3a,0x0a,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x73,0x2e,0x73,0x69,0x6c,0x2e,0x6f,0x72,0x67,0x2f,0x4f,0x46,0x4c,0x0a,0x0a,0x0a,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x0a,0x53,0x49,0x4c,0x20,0x4f,0x50,0x45,0x4e,0x20,0x46,0x4f,0x4e,0x54,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x31,0x20,0x2d,0x20,0x32,0x36,0x20,0x46,0x65,0x62,0x72,0x75,0x61,0x72,0x79,0x20,0x32,0x30,0x30,0x37,0x0a,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x0a,0x0a,0x50,0x52,0x45,0x41,0x4d,0x42,0x4c,0x45,0x0a,0x54,0x68,0x65,0x20,0x67,0x6f,0x61,0x6c,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x4f,0x70,0x65,0x6e,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x28,0x4f,0x46,0x4c,0x29,0x20,0x61,0x72,0x65,0x20,0x74,0x6f,0x20,0x73,0x74,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x20,0x77,0x6f,0x72,0x6c,0x64,0x77,0x69,0x64,0x65,0x0a,0x64,0x65,0x76,0x65,0x6c,0x6f,0x70,0x6d,0x65,0x6e,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6c,0x6c,0x61,0x62,0x6f,0x72,0x61,0x74,0x69,0x76,0x65,0x20,0x66,0x6f,0x6e,0x74,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2c,0x20,0x74,0x6f,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x65,0x66,0x66,0x6f,0x72,0x74,0x73,0x20,0x6f,0x66,0x20,0x61,0x63,0x61,0x64,0x65,0x6d,0x69,0x63,0x20,0x61,0x6e,0x64,0x20,0x6c,0x69,0x6e,0x67,0x75,0x69,0x73,0x74,0x69,0x63,0x20,0x63,0x6f,0x6d,0x6d,0x75,0x6e,0x69,0x74,0x69,0x65,0x73,0x2c,0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x20,0x61,0x20,0x66,0x72,0x65,0x65,0x20,0x61,0x6e,0x64,0x0a,0x6f,0x70,0x65,0x6e,0x20,0x66,0x72,0x61,0x6d,0x65,0x77,0x6f,0x72,0x6b,0x20,0x69,0x6e,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x73,0x68,0x61,0x72,0x65,0x64,0x20,0x61,0x6e,0x64,0x20,0x69,0x6d,0x70,0x72,0x6f,0x76,0x65,0x64,0x20,0x69,0x6e,0x20,0x70,0x61,0x72,0x74,0x6e,0x65,0x72,0x73,0x68,0x69,0x70,0x0a,0x77,0x69,0x74,0x68,0x20,0x6f,0x74,0x68,0x65,0x72,0x73,0x2e,0x0a,0x0a,0x54,0x68,0x65,0x20,0x4f,0x46,0x4c,0x20,0x61,0x6c,0x6c,0x6f,0x77,0x73,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x64,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x74,0x6f,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x2c,0x20,0x73,0x74,0x75,0x64,0x69,0x65,0x64,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x61,0x6e,0x64,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x66,0x72,0x65,0x65,0x6c,0x79,0x20,0x61,0x73,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x79,0x20,0x61,0x72,0x65,0x20,0x6e,0x6f,0x74,0x20,0x73,0x6f,0x6c,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x6d,0x73,0x65,0x6c,0x76,0x65,0x73,0x2e,0x20,0x54,0x68,0x65,0x0a,0x66,0x6f,0x6e,0x74,0x73,0x2c,0x20,0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x61,0x6e,0x79,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x20,0x77,0x6f,0x72,0x6b,0x73,0x2c,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x62,0x75,0x6e,0x64,0x6c,0x65,0x64,0x2c,0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x2c,0x20,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x6f,0x6c,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x6e,0x79,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x61,0x6e,0x79,0x20,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x0a,0x6e,0x61,0x6d,0x65,0x73,0x20,0x61,0x72,0x65,0x20,0x6e,0x6f,0x74,0x20,0x75,0x73,0x65,0x64,0x20,0x62,0x79,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x20,0x77,0x6f,0x72,0x6b,0x73,0x2e,0x20,0x54,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x61,0x6e,0x64,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x73,0x2c,0x0a,0x68,0x6f,0x77,0x65,0x76,0x65,0x72,0x2c,0x20,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x62,0x65,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x61,0x6e,0x79,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2e,0x20,0x54,0x68,0x65,0x0a,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x6d,0x65,0x6e,0x74,0x20,0x66,0x6f,0x72,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x74,0x6f,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x70,0x70,0x6c,0x79,0x0a,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x64,0x20,0x75,0x73,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x6f,0x72,0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x73,0x2e,0x0a,0x0a,0x44,0x45,0x46,0x49,0x4e,0x49,0x54,0x49,0x4f,0x4e,0x53,0x0a,0x22,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x74,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x73,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x0a,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x61,0x6e,0x64,0x20,0x63,0x6c,0x65,0x61,0x72,0x6c,0x79,0x20,0x6d,0x61,0x72,0x6b,0x65,0x64,0x20,0x61,0x73,0x20,0x73,0x75,0x63,0x68,0x2e,0x20,0x54,0x68,0x69,0x73,0x20,0x6d,0x61,0x79,0x0a,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x69,0x6c,0x65,0x73,0x2c,0x20,0x62,0x75,0x69,0x6c,0x64,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x73,0x20,0x61,0x6e,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x0a,0x22,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4e,0x61,0x6d,0x65,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x61,0x73,0x20,0x73,0x75,0x63,0x68,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x74,0x68,0x65,0x0a,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x73,0x29,0x2e,0x0a,0x0a,0x22,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x20,0x61,0x73,0x0a,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x2e,0x0a,0x0a,0x22,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x20,0x6d,0x61,0x64,0x65,0x20,0x62,0x79,0x20,0x61,0x64,0x64,0x69,0x6e,0x67,0x20,0x74,0x6f,0x2c,0x20,0x64,0x65,0x6c,0x65,0x74,0x69,0x6e,0x67,0x2c,0x0a,0x6f,0x72,0x20,0x73,0x75,0x62,0x73,0x74,0x69,0x74,0x75,0x74,0x69,0x6e,0x67,0x20,0x2d,0x2d,0x20,0x69,0x6e,0x20,0x70,0x61,0x72,0x74,0x20,0x6f,0x72,0x20,0x69,0x6e,0x20,0x77,0x68,0x6f,0x6c,0x65,0x20,0x2d,0x2d,0x20,0x61,0x6e,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x0a,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2c,0x20,0x62,0x79,0x20,0x63,0x68,0x61,0x6e,0x67,0x69,0x6e,0x67,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x73,0x20,0x6f,0x72,0x20,0x62,0x79,0x20,0x70,0x6f,0x72,0x74,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x74,0x6f,0x20,0x61,0x0a,0x6e,0x65,0x77,0x20,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x2e,0x0a,0x0a,0x22,0x41,0x75,0x74,0x68,0x6f,0x72,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x65,0x73,0x69,0x67,0x6e,0x65,0x72,0x2c,0x20,0x65,0x6e,0x67,0x69,0x6e,0x65,0x65,0x72,0x2c,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x6d,0x65,0x72,0x2c,0x20,0x74,0x65,0x63,0x68,0x6e,0x69,0x63,0x61,0x6c,0x0a,0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x20,0x77,0x68,0x6f,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x0a,0x50,0x45,0x52,0x4d,0x49,0x53,0x53,0x49,0x4f,0x4e,0x20,0x26,0x20,0x43,0x4f,0x4e,0x44,0x49,0x54,0x49,0x4f,0x4e,0x53,0x0a,0x50,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,0x6e,0x67,0x0a,0x61,0x20,0x63,0x6f,0x70,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x73,0x74,0x75,0x64,0x79,0x2c,0x20,0x63,0x6f,0x70,0x79,0x2c,0x20,0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x65,0x6d,0x62,0x65,0x64,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x2c,0x20,0x61,0x6e,0x64,0x20,0x73,0x65,0x6c,0x6c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x61,0x6e,0x64,0x20,0x75,0x6e,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x0a,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x3a,0x0a,0x0a,0x31,0x29,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x6e,0x6f,0x72,0x20,0x61,0x6e,0x79,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x20,0x69,0x6e,0x64,0x69,0x76,0x69,0x64,0x75,0x61,0x6c,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x2c,0x0a,0x69,0x6e,0x20,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x6f,0x72,0x20,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x73,0x6f,0x6c,0x64,0x20,0x62,0x79,0x20,0x69,0x74,0x73,0x65,0x6c,0x66,0x2e,0x0a,0x0a,0x32,0x29,0x20,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x6f,0x72,0x20,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x62,0x75,0x6e,0x64,0x6c,0x65,0x64,0x2c,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x6f,0x6c,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x6e,0x79,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x65,0x61,0x63,0x68,0x20,0x63,0x6f,0x70,0x79,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2e,0x20,0x54,0x68,0x65,0x73,0x65,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x0a,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x20,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x61,0x73,0x20,0x73,0x74,0x61,0x6e,0x64,0x2d,0x61,0x6c,0x6f,0x6e,0x65,0x20,0x74,0x65,0x78,0x74,0x20,0x66,0x69,0x6c,0x65,0x73,0x2c,0x20,0x68,0x75,0x6d,0x61,0x6e,0x2d,0x72,0x65,0x61,0x64,0x61,0x62,0x6c,0x65,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x20,0x6f,0x72,0x0a,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x70,0x70,0x72,0x6f,0x70,0x72,0x69,0x61,0x74,0x65,0x20,0x6d,0x61,0x63,0x68,0x69,0x6e,0x65,0x2d,0x72,0x65,0x61,0x64,0x61,0x62,0x6c,0x65,0x20,0x6d,0x65,0x74,0x61,0x64,0x61,0x74,0x61,0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x20,0x77,0x69,0x74,0x68,0x69,0x6e,0x20,0x74,0x65,0x78,0x74,0x20,0x6f,0x72,0x0a,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x69,0x6c,0x65,0x73,0x20,0x61,0x73,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x73,0x20,0x74,0x68,0x6f,0x73,0x65,0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x65,0x61,0x73,0x69,0x6c,0x79,0x20,0x76,0x69,0x65,0x77,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x75,0x73,0x65,0x72,0x2e,0x0a,0x0a,0x33,0x29,0x20,0x4e,0x6f,0x20,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x6d,0x61,0x79,0x20,0x75,0x73,0x65,0x20,0x74,0x68,0x65,0x20,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x20,0x46,0x6f,0x6e,0x74,0x0a,0x4e,0x61,0x6d,0x65,0x28,0x73,0x29,0x20,0x75,0x6e,0x6c,0x65,0x73,0x73,0x20,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x72,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x69,0x6e,0x67,0x0a,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x2e,0x20,0x54,0x68,0x69,0x73,0x20,0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x61,0x70,0x70,0x6c,0x69,0x65,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6e,0x61,0x6d,0x65,0x20,0x61,0x73,0x0a,0x70,0x72,0x65,0x73,0x65,0x6e,0x74,0x65,0x64,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x75,0x73,0x65,0x72,0x73,0x2e,0x0a,0x0a,0x34,0x29,0x20,0x54,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x28,0x73,0x29,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x20,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x41,0x75,0x74,0x68,0x6f,0x72,0x28,0x73,0x29,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x0a,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x73,0x68,0x61,0x6c,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x2c,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x61,0x64,0x76,0x65,0x72,0x74,0x69,0x73,0x65,0x20,0x61,0x6e,0x79,0x0a,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2c,0x20,0x65,0x78,0x63,0x65,0x70,0x74,0x20,0x74,0x6f,0x20,0x61,0x63,0x6b,0x6e,0x6f,0x77,0x6c,0x65,0x64,0x67,0x65,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x28,0x73,0x29,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x0a,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x41,0x75,0x74,0x68,0x6f,0x72,0x28,0x73,0x29,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x0a,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x0a,0x35,0x29,0x20,0x54,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x6f,0x72,0x20,0x75,0x6e,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x2c,0x20,0x69,0x6e,0x20,0x70,0x61,0x72,0x74,0x20,0x6f,0x72,0x20,0x69,0x6e,0x20,0x77,0x68,0x6f,0x6c,0x65,0x2c,0x0a,0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x65,0x6e,0x74,0x69,0x72,0x65,0x6c,0x79,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,0x20,0x61,0x6e,0x64,0x20,0x6d,0x75,0x73,0x74,0x20,0x6e,0x6f,0x74,0x20,0x62,0x65,0x0a,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x61,0x6e,0x79,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2e,0x20,0x54,0x68,0x65,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x6d,0x65,0x6e,0x74,0x20,0x66,0x6f,0x72,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x74,0x6f,0x0a,0x72,0x65,0x6d,0x61,0x69,0x6e,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x70,0x70,0x6c,0x79,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x64,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x0a,0x54,0x45,0x52,0x4d,0x49,0x4e,0x41,0x54,0x49,0x4f,0x4e,0x0a,0x54,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x62,0x65,0x63,0x6f,0x6d,0x65,0x73,0x20,0x6e,0x75,0x6c,0x6c,0x20,0x61,0x6e,0x64,0x20,0x76,0x6f,0x69,0x64,0x20,0x69,0x66,0x20,0x61,0x6e,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x0a,0x6e,0x6f,0x74,0x20,0x6d,0x65,0x74,0x2e,0x0a,0x0a,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x52,0x0a,0x54,0x48,0x45,0x20,0x46,0x4f,0x4e,0x54,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,0x2c,0x0a,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x0a,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,0x54,0x0a,0x4f,0x46,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x2c,0x20,0x50,0x41,0x54,0x45,0x4e,0x54,0x2c,0x20,0x54,0x52,0x41,0x44,0x45,0x4d,0x41,0x52,0x4b,0x2c,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x52,0x49,0x47,0x48,0x54,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x41,0x4e,0x59,0x20,0x47,0x45,0x4e,0x45,0x52,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x0a,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x0a,0x46,0x52,0x4f,0x4d,0x2c,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x52,0x20,0x49,0x4e,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x54,0x4f,0x20,0x55,0x53,0x45,0x20,0x54,0x48,0x45,0x20,0x46,0x4f,0x4e,0x54,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x4f,0x52,0x20,0x46,0x52,0x4f,0x4d,0x0a,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x20,0x46,0x4f,0x4e,0x54,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x00,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x73,0x00,0x63,0x00,0x72,0x00,0x69,0x00,0x70,0x00,0x74,0x00,0x73,0x00,0x2e,0x00,0x73,0x00,0x69,0x00,0x6c,0x00,0x2e,0x00,0x6f,0x00,0x72,0x00,0x67,0x00,0x2f,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x00,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x73,0x2e,0x73,0x69,0x6c,0x2e,0x6f,0x72,0x67,0x2f,0x4f,0x46,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x04,0x00,0xe0,0x00,0x00,0x00,0x34,0x00,0x20,0x00,0x04,0x00,0x14,0x00,0x0d,0x00,0x7e,0x00,0xff,0x01,0x31,0x01,0x53,0x01,0x61,0x01,0x78,0x01,0x7e,0x01,0x92,0x02,0xc7,0x02,0xda,0x02,0xdc,0x03,0x03,0x03,0x08,0x03,0x0a,0x20,0x14,0x20,0x1a,0x20,0x1e,0x20,0x22,0x20,0x26,0x20,0x30,0x20,0x3a,0x20,0xac,0x21,0x22,0xfb,0x02,0xff,0xff,0x00,0x00,0x00,0x0d,0x00,0x20,0x00,0xa0,0x01,0x31,0x01,0x52,0x01,0x60,0x01,0x78,0x01,0x7d,0x01,0x92,0x02,0xc6,0x02,0xd9,0x02,0xdc,0x03,0x00,0x03,0x08,0x03,0x0a,0x20,0x13,0x20,0x18,0x20,0x1c,0x20,0x20,0x20,0x26,0x20,0x30,0x20,0x39,0x20,0xac,0x21,0x22,0xfb,0x01,0xff,0xff,0xff,0xf4,0xff,0xe2,0xff,0xc1,0xff,0x90,0xff,0x70,0xff,0x64,0xff,0x4e,0xff,0x4a,0xff,0x37,0xfe,0x04,0xfd,0xf3,0xfd,0xf2,0xfd,0xcf,0xfd,0xcb,0xfd,0xca,0xe0,0xc2,0xe0,0xbf,0xe0,0xbe,0xe0,0xbd,0xe0,0xba,0xe0,0xb1,0xe0,0xa9,0xe0,0x38,0xdf,0xc3,0x05,0xe5,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x00,0x85,0x86,0x88,0x8a,0x92,0x97,0x9d,0xa2,0xa1,0xa3,0xa5,0xa4,0xa6,0xa8,0xaa,0xa9,0xab,0xac,0xae,0xad,0xaf,0xb0,0xb2,0xb4,0xb3,0xb5,0xb7,0xb6,0xbb,0xba,0xbc,0xbd,0xdd,0x71,0x63,0x64,0x68,0xdf,0x77,0xa0,0x6f,0x6a,0xe5,0x75,0x69,0x00,0x87,0x99,0x00,0x72,0x00,0x00,0x66,0x76,0x00,0x00,0x00,0x00,0x00,0x6b,0x7b,0x00,0xa7,0xb9,0x80,0x62,0x6d,0x00,0xc9,0x00,0x00,0x6c,0x7c,0xe0,0x61,0x81,0x84,0x96,0xc2,0xc3,0xd5,0xd6,0xda,0xdb,0xd7,0xd8,0xb8,0x00,0xc0,0xc6,0x00,0xe4,0xe2,0xe3,0xe6,0xe7,0xde,0x78,0xd9,0xdc,0xe1,0x83,0x8b,0x82,0x8c,0x89,0x8e,0x8f,0x90,0x8d,0x94,0x95,0x00,0x93,0x9b,0x9c,0x9a,0xc1,0xca,0xce,0x70,0x00,0xcc,0xcd,0x79,0x00,0x00,0xcb,0x00,0x00,0x00,0x03,0x00,0x00,0xff,0xf4,0x00,0x00,0xff,0x83,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x04,0x00,0x01,0x01,0x01,0x0d,0x44,0x2d,0x44,0x49,0x4e,0x2d,0x49,0x74,0x61,0x6c,0x69,0x63,0x00,0x01,0x02,0x00,0x01,0x00,0x3a,0xf8,0x3c,0x00,0xf8,0x3d,0x01,0xf8,0x3e,0x02,0xf8,0x3f,0x03,0xf8,0x15,0x04,0x7f,0x0c,0x02,0xfb,0x47,0xfb,0x3c,0x1c,0x04,0xb0,0xfa,0x0e,0x05,0x1d,0x00,0x00,0x01,0xef,0x0f,0x1d,0x00,0x00,0x00,0x00,0x10,0x1d,0x00,0x00,0x03,0xe4,0x11,0x1d,0x00,0x00,0x00,0x1a,0x1d,0x00,0x00,0x98,0x9f,0x12,0x00,0x25,0x02,0x00,0x01,0x00,0x11,0x00,0x18,0x00,0x1f,0x00,0x26,0x00,0x2d,0x00,0x34,0x00,0x3b,0x00,0x44,0x00,0x4d,0x00,0x54,0x00,0x5d,0x00,0x64,0x00,0x6b,0x00,0x6f,0x00,0x74,0x00,0x78,0x00,0x7b,0x00,0x84,0x00,0x8c,0x00,0x94,0x00,0x9e,0x00,0xa7,0x00,0xb0,0x00,0xb8,0x00,0xc0,0x00,0xca,0x00,0xd3,0x00,0xdc,0x00,0xe4,0x00,0xec,0x00,0xf6,0x00,0xff,0x01,0x07,0x01,0x0b,0x01,0x39,0x01,0x45,0x01,0x4a,0x6e,0x6f,0x6e,0x6d,0x61,0x72,0x6b,0x69,0x6e,0x67,0x72,0x65,0x74,0x75,0x72,0x6e,0x75,0x6e,0x69,0x30,0x30,0x41,0x30,0x75,0x6e,0x69,0x30,0x30,0x41,0x44,0x75,0x6e,0x69,0x30,0x30,0x42,0x32,0x75,0x6e,0x69,0x30,0x30,0x42,0x33,0x75,0x6e,0x69,0x30,0x30,0x42,0x35,0x75,0x6e,0x69,0x30,0x30,0x42,0x39,0x67,0x72,0x61,0x76,0x65,0x63,0x6f,0x6d,0x62,0x61,0x63,0x75,0x74,0x65,0x63,0x6f,0x6d,0x62,0x75,0x6e,0x69,0x30,0x33,0x30,0x32,0x74,0x69,0x6c,0x64,0x65,0x63,0x6f,0x6d,0x62,0x75,0x6e,0x69,0x30,0x33,0x30,0x38,0x75,0x6e,0x69,0x30,0x33,0x30,0x41,0x45,0x75,0x72,0x6f,0x2e,0x6e,0x75,0x6c,0x6c,0x4e,0x55,0x4c,0x4c,0x74,0x5f,0x74,0x7a,0x65,0x72,0x6f,0x2e,0x64,0x6e,0x6f,0x6d,0x6f,0x6e,0x65,0x2e,0x64,0x6e,0x6f,0x6d,0x74,0x77,0x6f,0x2e,0x64,0x6e,0x6f,0x6d,0x74,0x68,0x72,0x65,0x65,0x2e,0x64,0x6e,0x6f,0x6d,0x66,0x6f,0x75,0x72,0x2e,0x64,0x6e,0x6f,0x6d,0x7a,0x65,0x72,0x6f,0x2e,0x6e,0x75,0x6d,0x72,0x6f,0x6e,0x65,0x2e,0x6e,0x75,0x6d,0x72,0x74,0x77,0x6f,0x2e,0x6e,0x75,0x6d,0x72,0x74,0x68,0x72,0x65,0x65,0x2e,0x6e,0x75,0x6d,0x72,0x66,0x6f,0x75,0x72,0x2e,0x6e,0x75,0x6d,0x72,0x7a,0x65,0x72,0x6f,0x2e,0x73,0x75,0x70,0x73,0x6f,0x6e,0x65,0x2e,0x73,0x75,0x70,0x73,0x74,0x77,0x6f,0x2e,0x73,0x75,0x70,0x73,0x74,0x68,0x72,0x65,0x65,0x2e,0x73,0x75,0x70,0x73,0x66,0x6f,0x75,0x72,0x2e,0x73,0x75,0x70,0x73,0x67,0x6c,0x79,0x70,0x68,0x32,0x34,0x39,0x31,0x2e,0x30,0x30,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x44,0x61,0x74,0x74,0x6f,0x2c,0x20,0x49,0x6e,0x63,0x2e,0x20,0x41,0x6c,0x6c,0x20,0x72,0x69,0x67,0x68,0x74,0x73,0x20,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x2e,0x44,0x2d,0x44,0x49,0x4e,0x20,0x49,0x74,0x61,0x6c,0x69,0x63,0x44,0x2d,0x44,0x49,0x4e,0x00,0x00,0x00,0x01,0x87,0x00,0x01,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,0x00,0x07,0x00,0x68,0x00,0x09,0x00,0x0a,0x00,0x0b,0x00,0x0c,0x00,0x0d,0x00,0x0e,0x00,0x0f,0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x1a,0x00,0x1b,0x00,0x1c,0x00,0x1d,0x00,0x1e,0x00,0x1f,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2a,0x00,0x2b,0x00,0x2c,0x00,0x2d,0x00,0x2e,0x00,0x2f,0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x3d,0x00,0x3e,0x00,0x3f,0x00,0x40,0x00,0x7c,0x00,0x42,0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4a,0x00,0x4b,0x00,0x4c,0x00,0x4d,0x00,0x4e,0x00,0x4f,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5a,0x00,0x5b,0x00,0x5c,0x00,0x5d,0x00,0x5e,0x00,0x5f,0x01,0x88,0x00,0x60,0x00,0x61,0x00,0x62,0x00,0x67,0x00,0x64,0x00,0xa0,0x00,0x66,0x00,0x83,0x00,0xaa,0x00,0x8b,0x00,0x6a,0x00,0x97,0x01,0x89,0x00,0xa5,0x00,0x80,0x00,0xa1,0x00,0x9c,0x01,0x8a,0x01,0x8b,0x00,0x7d,0x01,0x8c,0x00,0x73,0x00,0x72,0x00,0x85,0x01,0x8d,0x00,0x8f,0x00,0x78,0x00,0x9e,0x00,0x9b,0x00,0xa3,0x00,0x7b,0x00,0xae,0x00,0xab,0x00,0xac,0x00,0xb0,0x00,0xad,0x00,0xaf,0x00,0x8a,0x00,0xb1,0x00,0xb5,0x00,0xb2,0x00,0xb3,0x00,0xb4,0x00,0xb9,0x00,0xb6,0x00,0xb7,0x00,0xb8,0x00,0x9a,0x00,0xba,0x00,0xbe,0x00,0xbb,0x00,0xbc,0x00,0xbf,0x00,0xbd,0x00,0xa8,0x00,0x8d,0x00,0xc4,0x00,0xc1,0x00,0xc2,0x00,0xc3,0x00,0xc5,0x00,0x9d,0x00,0x95,0x00,0xcb,0x00,0xc8,0x00,0xc9,0x00,0xcd,0x00,0xca,0x00,0xcc,0x00,0x90,0x00,0xce,0x00,0xd2,0x00,0xcf,0x00,0xd0,0x00,0xd1,0x00,0xd6,0x00,0xd3,0x00,0xd4,0x00,0xd5,0x00,0xa7,0x00,0xd7,0x00,0xdb,0x00,0xd8,0x00,0xd9,0x00,0xdc,0x00,0xda,0x00,0x9f,0x00,0x93,0x00,0xe1,0x00,0xde,0x00,0xdf,0x00,0xe0,0x00,0xe2,0x00,0xa2,0x00,0xe3,0x00,0x91,0x00,0x8e,0x00,0x94,0x00,0xc0,0x00,0xdd,0x00,0xc6,0x00,0xc7,0x00,0xe4,0x00,0x65,0x00,0x7e,0x00,0x88,0x00,0x82,0x00,0x84,0x00,0x7f,0x01,0x8e,0x01,0x8f,0x01,0x90,0x01,0x91,0x01,0x92,0x01,0x93,0x00,0x6f,0x00,0x89,0x00,0x41,0x00,0x08,0x00,0x75,0x00,0x69,0x00,0x77,0x00,0x76,0x00,0x70,0x00,0x71,0x00,0x74,0x00,0x79,0x00,0x7a,0x00,0x6b,0x00,0x6c,0x01,0x94,0x00,0x99,0x00,0x6d,0x00,0x6e,0x01,0x95,0x01,0x96,0x01,0x97,0x01,0x98,0x01,0x99,0x01,0x9a,0x01,0x9b,0x01,0x9c,0x01,0x9d,0x01,0x9e,0x01,0x9f,0x01,0xa0,0x01,0xa1,0x01,0xa2,0x01,0xa3,0x01,0xa4,0x01,0xa5,0x01,0xa6,0x01,0xa7,0x00,0xfb,0x02,0x00,0x01,0x00,0x1a,0x00,0x1c,0x00,0x1f,0x00,0x38,0x00,0x54,0x00,0xab,0x03,0x5c,0x03,0x80,0x06,0xc7,0x06,0xd8,0x07,0x7c,0x08,0x25,0x08,0x51,0x08,0x6a,0x08,0x72,0x08,0x81,0x08,0x89,0x08,0x9c,0x0a,0x62,0x0a,0x7c,0x0b,0x90,0x0e,0x16,0x0e,0x44,0x0f,0xbd,0x12,0x1b,0x12,0x35,0x15,0xff,0x18,0x3b,0x18,0x49,0x18,0x57,0x18,0x71,0x18,0x85,0x18,0x9d,0x1a,0x30,0x1e,0x26,0x1e,0x35,0x1f,0xdc,0x21,0xc7,0x22,0xb5,0x22,0xbe,0x22,0xdf,0x24,0x98,0x24,0xbe,0x24,0xc8,0x25,0x3c,0x25,0x66,0x25,0x7e,0x25,0xad,0x25,0xb7,0x25,0xcd,0x26,0xc2,0x28,0x57,0x29,0x0a,0x29,0x11,0x29,0x2d,0x29,0x38,0x29,0x51,0x29,0x7c,0x29,0xa8,0x29,0xb1,0x29,0xba,0x29,0xd6,0x29,0xe7,0x2a,0x02,0x2a,0x1d,0x2a,0x2a,0x2a,0x33,0x2a,0x44,0x2b,0xbc,0x2d,0x6f,0x2e,0xe3,0x2e,0xf8,0x2f,0x02,0x31,0x0b,0x31,0xf5,0x32,0x05,0x32,0x72,0x32,0x9b,0x33,0x42,0x35,0x04,0x35,0x0d,0x35,0x21,0x36,0xae,0x38,0x21,0x38,0xca,0x38,0xd5,0x39,0x60,0x39,0x6b,0x39,0x84,0x39,0xb0,0x39,0xd9,0x39,0xe2,0x39,0xeb,0x3b,0x97,0x3b,0xa4,0x3d,0x3b,0x3e,0xa2,0x3e,0xa5,0x3e,0xc3,0x40,0x69,0x41,0xe1,0x43,0xc9,0x44,0x0d,0x44,0x24,0x47,0xe9,0x47,0xf6,0x4b,0xd4,0x4d,0x75,0x4d,0x83,0x4d,0x92,0x4d,0xa1,0x4f,0xf6,0x50,0x05,0x51,0x6d,0x51,0x91,0x51,0x9b,0x51,0xa8,0x51,0xb1,0x52,0x54,0x52,0xf9,0x53,0x07,0x53,0x16,0x53,0x20,0x54,0xa8,0x54,0xb6,0x54,0xcd,0x55,0xf0,0x56,0x0c,0x57,0x8b,0x57,0xa0,0x57,0xb5,0x57,0xca,0x59,0x41,0x59,0x5a,0x5a,0xbc,0x5a,0xfb,0x5c,0xf1,0x5d,0x01,0x5d,0x11,0x5d,0x21,0x5d,0x34,0x5d,0x45,0x5d,0x55,0x5d,0x65,0x5d,0x7a,0x5e,0x81,0x5f,0xf4,0x60,0x10,0x60,0x2c,0x60,0x48,0x61,0xc7,0x61,0xe7,0x62,0x12,0x63,0xa6,0x63,0xbb,0x63,0xd0,0x63,0xe5,0x63,0xfe,0x64,0x0e,0x65,0x0e,0x67,0x4a,0x67,0x65,0x67,0x80,0x67,0x9b,0x69,0x1c,0x69,0x3b,0x69,0xf7,0x6d,0x3b,0x6f,0x0e,0x6f,0x2a,0x6f,0x45,0x6f,0x60,0x6f,0x80,0x6f,0x91,0x6f,0xa1,0x6f,0xb1,0x6f,0xc6,0x71,0x61,0x72,0xd2,0x72,0xf3,0x73,0x14,0x73,0x35,0x74,0xbc,0x74,0xe1,0x76,0x99,0x78,0x73,0x78,0x88,0x78,0x9d,0x78,0xb2,0x78,0xcb,0x78,0xdb,0x7a,0x82,0x7a,0x95,0x7a,0x9f,0x7b,0x3f,0x7d,0xb3,0x7d,0xc1,0x7d,0xd6,0x7d,0xe9,0x7d,0xf9,0x7e,0x08,0x7e,0xe3,0x7e,0xec,0x7e,0xf5,0x7e,0xfe,0x7f,0xaf,0x81,0x1a,0x81,0x23,0x81,0x2d,0x81,0x36,0x82,0xa1,0x82,0xae,0x83,0xfc,0x84,0x0b,0x84,0x1a,0x84,0x28,0x84,0x32,0x84,0x3a,0x84,0x4d,0x84,0x5b,0x84,0x69,0x84,0x90,0x84,0xcc,0x85,0x7c,0x85,0x8e,0x87,0x2d,0x87,0x36,0x87,0x3f,0x88,0xf0,0x89,0x2e,0x89,0x42,0x89,0xf1,0x89,0xf4,0x89,0xf6,0x8a,0xe3,0x8c,0x62,0x8c,0x6c,0x8d,0x80,0x8f,0xba,0x8f,0xc3,0x8f,0xd2,0x8f,0xdc,0x90,0xf5,0x91,0x01,0x91,0x0b,0x92,0x8c,0x92,0x96,0x92,0xa0,0x92,0xad,0x92,0xb7,0x92,0xc1,0xd1,0xf7,0x0d,0xf9,0x46,0x15,0xfd,0x46,0xf8,0x21,0xf9,0x46,0x07,0x69,0xfd,0x24,0x15,0xfb,0xdd,0xf9,0x02,0xf7,0xdd,0x06,0x0e,0xd1,0x0e,0xfb,0xcd,0x0e,0xfb,0xb7,0xf7,0x3f,0xf9,0x46,0x15,0x30,0xfc,0x82,0xc2,0x8b,0xf7,0x0c,0xf8,0x82,0x05,0xfb,0x6a,0xfc,0xe9,0x15,0x20,0x0a,0x0e,0xfb,0x72,0xf7,0x25,0xf9,0x46,0x15,0x5a,0xfb,0x7a,0xcd,0x8b,0xbc,0xf7,0x7a,0x05,0xd1,0x16,0x5a,0xfb,0x7a,0xce,0x8b,0xbb,0xf7,0x7a,0x05,0x0e,0xf8,0x42,0xf8,0x42,0x15,0xe9,0x8b,0x97,0xc2,0x34,0x8b,0xd1,0xf7,0x61,0x50,0x8b,0x44,0xfb,0x61,0xfb,0x1d,0x8b,0xd1,0xf7,0x61,0x4f,0x8b,0x45,0xfb,0x61,0x2d,0x8b,0x80,0x54,0xe1,0x8b,0x56,0xfb,0x2d,0x31,0x8b,0x05,0x7f,0x53,0xde,0x8b,0x3f,0xfb,0x71,0xc7,0x8b,0xd7,0xf7,0x71,0xf7,0x1d,0x8b,0x3f,0xfb,0x71,0xc7,0x8b,0xd7,0xf7,0x71,0xec,0x8b,0x97,0xc3,0x31,0x8b,0x05,0x84,0xf7,0x2d,0x15,0x57,0xfb,0x2d,0xfb,0x1e,0x8b,0xc0,0xf7,0x2d,0x05,0x0e,0x42,0xf8,0x13,0xf8,0x7b,0x15,0xd0,0x06,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x08,0xaa,0xaa,0xff,0x00,0x00,0xaa,0xaa,0x97,0x8b,0xff,0x00,0x0f,0x55,0x56,0x8b,0xff,0x00,0x27,0x55,0x0c,0x81,0xff,0x00,0x1e,0xd5,0x54,0x77,0xff,0x00,0x16,0x55,0xa0,0x77,0xff,0x00,0x16,0x55,0x54,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xac,0xff,0xff,0xdd,0x55,0x56,0x91,0x08,0x9d,0xde,0x51,0x8b,0x7a,0x3a,0x05,0xff,0xff,0xcf,0x55,0x55,0xff,0xff,0xfc,0xaa,0xac,0x62,0xff,0xff,0xef,0x2a,0xa8,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xd6,0xd5,0x54,0x7f,0x57,0xff,0xff,0xfc,0xaa,0xaa,0x7d,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0x8b,0xff,0xff,0xef,0x55,0x56,0x8b,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x09,0x80,0x00,0xff,0xff,0xe6,0x55,0x54,0x9e,0xff,0xff,0xed,0x55,0x56,0x9e,0xff,0xff,0xed,0x55,0x56,0xff,0x00,0x1b,0xd5,0x55,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x24,0xaa,0xab,0x83,0x08,0x97,0x89,0x5a,0xfb,0x7a,0x05,0xff,0xff,0xcf,0x55,0x58,0x95,0xff,0xff,0xe7,0xaa,0xab,0xff,0x00,0x1e,0x55,0x55,0xff,0xff,0xff,0xff,0xfd,0xff,0x00,0x32,0xaa,0xab,0x8b,0xff,0x00,0x04,0xaa,0xab,0xff,0x00,0x00,0xaa,0xaa,0x94,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0d,0x55,0x55,0x08,0x46,0x06,0x89,0xff,0xff,0xf1,0x55,0x55,0x8a,0x7d,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xd7,0x55,0x57,0xff,0x00,0x0b,0x55,0x55,0x6b,0xff,0x00,0x16,0xaa,0xab,0xff,0xff,0xe8,0xaa,0xa9,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xab,0xab,0x7d,0xff,0x00,0x29,0x55,0x56,0xff,0xff,0xfb,0x55,0x55,0x08,0x78,0x33,0xc5,0x8b,0x9e,0xe2,0x05,0xbd,0xff,0x00,0x04,0xaa,0xab,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x11,0xaa,0xab,0xff,0x00,0x20,0xaa,0xaa,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x20,0xaa,0x7c,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x29,0xaa,0xab,0xff,0x00,0x0c,0xaa,0xda,0xff,0x00,0x34,0xaa,0xab,0xff,0x00,0x03,0x55,0x56,0x99,0xff,0x00,0x01,0xaa,0xaa,0x9b,0x8b,0x9d,0x8b,0xcd,0xff,0xff,0xda,0xaa,0xaa,0xff,0x00,0x28,0x55,0x56,0xff,0xff,0xb5,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0x08,0x80,0x8d,0xb9,0xf7,0x6f,0x05,0xff,0x00,0x25,0x55,0x56,0x81,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x54,0x8b,0xff,0xff,0xd4,0xaa,0xac,0x8b,0x85,0xff,0xff,0xff,0x55,0x56,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xaa,0x08,0xfb,0x30,0x29,0x15,0x5f,0x95,0x75,0xa3,0x8b,0xb1,0x8b,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x01,0x55,0x55,0x95,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x1d,0x55,0x54,0x97,0xa3,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x12,0xaa,0xac,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x12,0xaa,0xac,0xff,0x00,0x17,0x55,0x55,0xff,0x00,0x0b,0x55,0x54,0xa7,0x8f,0x08,0xba,0xff,0xfe,0xc5,0x80,0x00,0x15,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf4,0x55,0x56,0xff,0x00,0x05,0x55,0x56,0xff,0xff,0xf0,0x2a,0xaa,0x8b,0x77,0x8b,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0x83,0x6b,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xe6,0xd5,0x55,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xab,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xab,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xe2,0xaa,0xab,0xff,0xff,0xfb,0x55,0x56,0x08,0xb9,0xf7,0x6d,0x05,0xff,0x00,0x16,0xaa,0x86,0xff,0xff,0xfa,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x0a,0xaa,0xd0,0xff,0xff,0xf4,0x55,0x56,0x08,0xfb,0x1c,0xff,0x01,0x96,0x80,0x00,0x15,0x0e,0xf7,0xfc,0xde,0xf7,0xfa,0x15,0x21,0x0a,0xf8,0xf7,0xf7,0xe0,0x15,0x22,0x0a,0xfc,0x98,0xfb,0xec,0x15,0x23,0x0a,0xf7,0xd3,0xfb,0x99,0x15,0x24,0x0a,0xf7,0x31,0x7f,0x15,0x25,0x0a,0x0e,0xd1,0xf8,0x5c,0xd3,0x15,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x08,0xaa,0xac,0x08,0x75,0xb8,0xf7,0x00,0xf7,0x06,0x64,0xb4,0x2b,0x28,0x35,0xf7,0x46,0x05,0xff,0x00,0x3c,0xaa,0xaa,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x2a,0x55,0x56,0xff,0x00,0x24,0xd5,0x54,0xa3,0xff,0x00,0x1e,0x55,0x56,0xa3,0xff,0x00,0x1e,0x55,0x56,0x97,0xff,0x00,0x21,0xd5,0x56,0x8b,0xff,0x00,0x25,0x55,0x54,0x8b,0xaf,0xff,0xff,0xf4,0x2a,0xaa,0xff,0x00,0x1c,0x80,0x00,0xff,0xff,0xe8,0x55,0x56,0xa0,0xff,0xff,0xe8,0x55,0x56,0xa0,0xff,0xff,0xe0,0x80,0x00,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xd8,0xaa,0xaa,0x8b,0xff,0xff,0xe1,0x55,0x56,0x8b,0x6f,0xff,0xff,0xf8,0xd5,0x54,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xf1,0xaa,0xac,0xff,0xff,0xe6,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xac,0x77,0xff,0xff,0xec,0x2a,0xa8,0xff,0xff,0xf1,0x55,0x55,0xff,0xff,0xe6,0xaa,0xac,0x08,0xff,0xff,0xf1,0x55,0x55,0xff,0xff,0xe6,0xaa,0xac,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xe3,0xaa,0xa8,0x8b,0xff,0xff,0xe0,0xaa,0xac,0x8b,0xff,0xff,0xed,0x55,0x94,0xff,0x00,0x03,0xd5,0x55,0xff,0xff,0xeb,0xaa,0xaa,0xff,0x00,0x07,0xaa,0xab,0xff,0xff,0xe9,0xff,0xc2,0xff,0x00,0x07,0xaa,0xab,0x75,0xff,0x00,0x0c,0xd5,0x55,0xff,0xff,0xe2,0x55,0x56,0x9d,0xff,0xff,0xda,0xaa,0xaa,0xff,0xff,0xbd,0x55,0x56,0x5b,0xff,0xff,0xd0,0xd5,0x54,0xff,0xff,0xd4,0xd5,0x56,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xd9,0xaa,0xaa,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xd9,0xaa,0xab,0xff,0xff,0xf2,0x2a,0xaa,0xff,0xff,0xd6,0x80,0x00,0x8b,0xff,0xff,0xd3,0x55,0x55,0x8b,0xff,0xff,0xd5,0x55,0x57,0x97,0x69,0xa3,0xff,0xff,0xe6,0xaa,0xa9,0x08,0xff,0x00,0x17,0xff,0xfe,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x21,0xaa,0xab,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x2b,0x55,0x57,0x8b,0xff,0x00,0x21,0x55,0x55,0x8b,0xab,0xff,0x00,0x07,0x55,0x55,0xff,0x00,0x1e,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x0e,0xaa,0xab,0xab,0xa3,0xff,0x00,0x21,0x55,0x56,0xff,0x00,0x21,0x55,0x55,0x08,0x9e,0x64,0x05,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xab,0x94,0xff,0xff,0xf4,0x2a,0xab,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xf9,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xf9,0xaa,0xab,0xff,0x00,0x0d,0x55,0x54,0xff,0xff,0xfc,0xd5,0x55,0xff,0x00,0x11,0x55,0x56,0x8b,0x08,0xad,0x8b,0x99,0xcc,0x74,0x8b,0x05,0x83,0x8b,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x02,0x55,0x56,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0x08,0xff,0xff,0x42,0x80,0x00,0xf8,0xb1,0x15,0x9c,0x9d,0xff,0x00,0x15,0x80,0x00,0x94,0xa5,0x8b,0xff,0x00,0x14,0xaa,0xaa,0x8b,0xff,0x00,0x10,0x80,0x00,0xff,0xff,0xfa,0x2a,0xac,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xf4,0x55,0x54,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xf4,0x55,0xec,0xff,0x00,0x06,0x2a,0xaa,0xff,0xff,0xf0,0xd5,0x54,0x8b,0xff,0xff,0xed,0x54,0xc0,0x8b,0xff,0xff,0xed,0x55,0x54,0xff,0xff,0xfc,0x55,0x56,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0xff,0xff,0xf1,0xaa,0xac,0xff,0xff,0xf8,0xaa,0xaa,0xff,0xff,0xf1,0xaa,0xac,0x7f,0xff,0xff,0xf1,0x2a,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf0,0xaa,0xe4,0xff,0xff,0xe7,0x55,0x54,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe8,0xaa,0x72,0x08,0x7d,0xff,0x00,0x1f,0x55,0x56,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x18,0x55,0x54,0xff,0xff,0xfa,0xaa,0xab,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xfa,0xaa,0xab,0xff,0x00,0x11,0x54,0xd4,0xff,0xff,0xfd,0x55,0x55,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0d,0x55,0xd8,0x8b,0xa7,0xff,0x00,0x08,0x80,0x00,0xa2,0x9c,0x9d,0x08,0xff,0xff,0xf8,0x80,0x00,0xff,0xfd,0xe4,0x80,0x00,0x15,0x75,0x7e,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xf9,0x80,0x00,0xff,0xff,0xe8,0xaa,0xab,0x8b,0x71,0x8b,0xff,0xff,0xeb,0xaa,0xab,0xff,0x00,0x07,0xaa,0xab,0xff,0xff,0xf1,0x55,0x55,0xff,0x00,0x0f,0x55,0x55,0xff,0xff,0xf1,0x55,0x56,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0x8b,0xa5,0x8b,0xff,0x00,0x21,0x55,0x50,0xff,0x00,0x0a,0x80,0x00,0xff,0x00,0x1e,0xd5,0x55,0xa0,0xff,0x00,0x1c,0x55,0x5b,0xa0,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x23,0xd5,0x55,0xff,0x00,0x20,0xd5,0x54,0xff,0x00,0x32,0xaa,0xab,0xff,0x00,0x25,0x55,0x56,0x08,0xe8,0xfb,0x52,0x05,0x6b,0xff,0xff,0xe0,0xaa,0xaa,0x70,0xff,0xff,0xe9,0xd5,0x56,0x75,0x7e,0x08,0x0e,0xfb,0xfb,0xf7,0x25,0xf9,0x46,0x15,0x5a,0xfb,0x7a,0xcd,0x8b,0xbc,0xf7,0x7a,0x05,0x0e,0xfb,0x85,0xc5,0xf7,0x3d,0x15,0x8b,0xff,0xff,0xa9,0x55,0x56,0x9b,0xff,0xff,0xab,0xaa,0xaa,0xab,0x39,0x08,0xbf,0x06,0x75,0xd3,0x80,0xff,0x00,0x4c,0x55,0x56,0x8b,0xff,0x00,0x50,0xaa,0xaa,0x8b,0xff,0x00,0x3f,0x55,0x4e,0xff,0x00,0x06,0x55,0x55,0xc8,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x3a,0xaa,0xb2,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x45,0x55,0x56,0xff,0x00,0x17,0x55,0x55,0xff,0x00,0x45,0xaa,0xaa,0xab,0xd1,0xab,0xd1,0xff,0x00,0x27,0xaa,0xaa,0xff,0x00,0x43,0xaa,0xac,0xff,0x00,0x2f,0x55,0x56,0xff,0x00,0x41,0x55,0x54,0x08,0x57,0x06,0xff,0xff,0x94,0xaa,0xa9,0xff,0xff,0x7d,0x55,0x54,0xff,0xff,0xbb,0x55,0x55,0xff,0xff,0x76,0xaa,0xaa,0xff,0xff,0xe2,0x00,0x02,0xff,0xff,0x70,0x00,0x02,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xc9,0x55,0x56,0xff,0xff,0xfa,0x55,0x55,0xff,0xff,0xca,0xff,0xff,0x8b,0xff,0xff,0xcc,0xaa,0xab,0x08,0x0e,0xfb,0x85,0xf6,0xf7,0x0b,0x15,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xb9,0x55,0x56,0x63,0xff,0xff,0xbc,0x55,0x54,0xff,0xff,0xd0,0xaa,0xab,0xff,0xff,0xbf,0x55,0x56,0x08,0xbf,0x06,0xff,0x00,0x6c,0xaa,0xa8,0xf7,0x18,0xd0,0xff,0x00,0x89,0x55,0x55,0xff,0x00,0x1d,0x55,0x58,0xff,0x00,0x8e,0xaa,0xab,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x05,0xaa,0xaa,0xff,0x00,0x34,0xaa,0xaa,0x8b,0xbd,0x8b,0xff,0x00,0x59,0x55,0x54,0xff,0xff,0xef,0xaa,0xab,0xff,0x00,0x54,0xaa,0xac,0xff,0xff,0xdf,0x55,0x55,0xdb,0x08,0x57,0x06,0xff,0x00,0x16,0xaa,0xab,0x41,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xb2,0xaa,0xac,0x8b,0xff,0xff,0xaf,0x55,0x54,0x8b,0x51,0xff,0xff,0xf9,0xaa,0xab,0x4f,0xff,0xff,0xf3,0x55,0x55,0x4d,0x7d,0xff,0xff,0xbb,0x55,0x56,0xff,0xff,0xe8,0xaa,0xab,0xff,0xff,0xba,0x55,0x54,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xb9,0x55,0x56,0x08,0x0e,0xfb,0x2c,0xf7,0x72,0xf8,0x9a,0x15,0x75,0x24,0xb9,0x8b,0xa1,0xf2,0xd7,0x5a,0xa7,0xaf,0x3e,0xbe,0xed,0xbd,0x7e,0xaf,0x2b,0x5a,0xa0,0xec,0x5d,0x8b,0x76,0x29,0x3f,0xbd,0x6f,0x67,0xd8,0x59,0x05,0x28,0x58,0x99,0x67,0x05,0x0e,0xf7,0x78,0xf7,0x87,0x15,0xfb,0x3a,0xcd,0xf7,0x3a,0xf7,0x3a,0xcd,0xfb,0x3a,0xf7,0x3a,0x49,0xfb,0x3a,0xfb,0x3a,0x49,0x07,0x0e,0xfb,0xf8,0x9f,0xe8,0x15,0x26,0x0a,0x0e,0xfb,0x1c,0xe1,0xf8,0x10,0x15,0x7e,0x49,0xf7,0xa7,0x8b,0x98,0xcd,0x05,0x0e,0xfb,0xb7,0xb4,0xe7,0x15,0x27,0x0a,0x0e,0xfb,0x1e,0xf8,0x02,0xf9,0x46,0x15,0xfb,0xff,0xfd,0x50,0xc7,0x8b,0xf7,0xff,0xf9,0x50,0x05,0x0e,0x65,0xe2,0xa6,0x15,0xa5,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x25,0x55,0x55,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x30,0xaa,0xab,0x8b,0xff,0x00,0x3b,0x55,0x56,0xff,0x00,0x00,0x00,0x01,0xff,0x00,0x2f,0x2a,0xaa,0xff,0x00,0x12,0x2a,0xaa,0xae,0xff,0x00,0x24,0x55,0x55,0xae,0xff,0x00,0x24,0x55,0x54,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x9b,0xff,0x00,0x4a,0xaa,0xac,0x08,0xc5,0xf7,0xa4,0x05,0x91,0xff,0x00,0x1b,0x55,0x56,0x8e,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa1,0x8b,0xff,0x00,0x2f,0x55,0x54,0xff,0xff,0xf3,0x2a,0xaa,0xff,0x00,0x23,0xaa,0xac,0xff,0xff,0xe6,0x55,0x56,0xa3,0xff,0xff,0xe6,0x55,0x56,0xa3,0xff,0xff,0xda,0x80,0x00,0x97,0xff,0xff,0xce,0xaa,0xaa,0x8b,0xff,0xff,0xc4,0xaa,0xb2,0x8b,0xff,0xff,0xd0,0xd5,0x55,0xff,0xff,0xee,0x2a,0xac,0xff,0xff,0xdc,0xff,0xf9,0xff,0xff,0xdc,0x55,0x54,0x68,0xff,0xff,0xdc,0x55,0x54,0xff,0xff,0xe6,0x80,0x00,0xff,0xff,0xc9,0x80,0x00,0x7b,0xff,0xff,0xb6,0xaa,0xac,0x08,0x51,0xfb,0xa4,0x05,0x85,0x6f,0x88,0x72,0x8b,0x75,0x8b,0x5b,0x98,0xff,0xff,0xdb,0xaa,0xaa,0xa5,0xff,0xff,0xe7,0x55,0x56,0x08,0xff,0x00,0xd1,0x80,0x00,0xff,0x00,0x43,0x80,0x00,0x15,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xe2,0x80,0x00,0xff,0xff,0xf3,0x2a,0xaa,0xff,0xff,0xd9,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xea,0x55,0x55,0xff,0x00,0x07,0x2a,0xab,0x7d,0xff,0x00,0x0e,0x55,0x55,0x7d,0xff,0x00,0x0e,0x55,0x56,0x84,0xff,0x00,0x17,0x2a,0xaa,0x8b,0xab,0x8b,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x03,0x55,0x56,0xa5,0xff,0x00,0x06,0xaa,0xaa,0xff,0x00,0x1d,0x55,0x55,0x08,0xbe,0xf7,0x84,0x05,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x3d,0x55,0x54,0xff,0x00,0x11,0x2a,0xab,0xff,0x00,0x2b,0x80,0x00,0xa0,0xff,0x00,0x19,0xaa,0xac,0xa0,0xff,0x00,0x19,0xaa,0xac,0xff,0x00,0x1d,0x80,0x00,0xff,0x00,0x0c,0xd5,0x54,0xb1,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x15,0x80,0x00,0x84,0xff,0x00,0x0d,0xaa,0xaa,0x7d,0xff,0x00,0x0d,0xaa,0xaa,0x7d,0xff,0x00,0x06,0xd5,0x56,0xff,0xff,0xe9,0x55,0x54,0x8b,0xff,0xff,0xe0,0xaa,0xac,0x8b,0xff,0xff,0xe9,0x55,0x54,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0x08,0x58,0xfb,0x84,0x05,0xff,0xff,0xf2,0xaa,0xd4,0xff,0xff,0xc2,0xaa,0xab,0xff,0xff,0xef,0x2a,0xaa,0xff,0xff,0xd4,0x7f,0xff,0xff,0xff,0xeb,0xaa,0x82,0xff,0xff,0xe6,0x55,0x56,0x08,0x0e,0xfb,0x5d,0xf7,0x88,0xf8,0xf2,0x15,0xfb,0x15,0xfc,0xf2,0xd3,0x8b,0xf7,0x27,0xf9,0x46,0x42,0x8b,0xfb,0x1e,0x30,0x7a,0x39,0x05,0x0e,0x4e,0x9d,0xc6,0x15,0x7f,0x50,0xf7,0xf2,0x8b,0x99,0xcc,0xfb,0x97,0x8b,0xf7,0x99,0xf7,0xb4,0x05,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x1d,0x55,0x56,0xff,0x00,0x14,0xd5,0x56,0xff,0x00,0x1a,0xd5,0x54,0x9a,0xff,0x00,0x18,0x55,0x56,0x9a,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x0a,0x2a,0xaa,0xff,0x00,0x1a,0x2a,0xaa,0xff,0x00,0x05,0x55,0x56,0xa7,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xac,0xff,0x00,0x02,0x55,0x56,0x9d,0x8b,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x27,0x55,0x54,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x20,0x2a,0xac,0x70,0xa4,0x70,0xa4,0xff,0xff,0xdb,0x80,0x00,0xff,0x00,0x0c,0x80,0x00,0x5d,0x8b,0xff,0xff,0xca,0xaa,0xb2,0x8b,0xff,0xff,0xd2,0xd5,0x55,0xff,0xff,0xf0,0x55,0x54,0xff,0xff,0xda,0xff,0xf9,0xff,0xff,0xe0,0xaa,0xac,0x08,0x66,0xff,0xff,0xe0,0xaa,0xac,0xff,0xff,0xe8,0xd5,0x56,0x61,0xff,0xff,0xf6,0xaa,0xaa,0xff,0xff,0xcb,0x55,0x54,0x08,0x87,0x75,0xd4,0x8b,0x8f,0x9d,0x05,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x24,0xaa,0xac,0xff,0x00,0x0e,0xd5,0x55,0xff,0x00,0x1b,0xd5,0x54,0xa0,0x9e,0xa0,0x9e,0xff,0x00,0x1a,0x2a,0xaa,0xff,0x00,0x09,0x80,0x00,0xff,0x00,0x1f,0x55,0x56,0x8b,0xa5,0x8b,0xff,0x00,0x14,0x80,0x00,0x84,0x9a,0x7d,0x9a,0x7d,0xff,0x00,0x07,0x80,0x00,0xff,0xff,0xec,0xaa,0xac,0x8b,0xff,0xff,0xe7,0x55,0x54,0x8b,0xff,0xff,0xf9,0x55,0x54,0x89,0x7c,0x87,0xff,0xff,0xe8,0xaa,0xac,0x85,0x67,0xff,0xff,0xe8,0xaa,0xaa,0x63,0xff,0xff,0xd7,0x55,0x56,0x5f,0x08,0x0e,0x68,0xff,0x00,0x4f,0x80,0x00,0xff,0x00,0x18,0x80,0x00,0x15,0xa6,0x74,0xff,0x00,0x26,0x80,0x00,0xff,0xff,0xf4,0x80,0x00,0xbd,0x8b,0xff,0x00,0x37,0x55,0x55,0x8b,0xff,0x00,0x2f,0x2a,0xab,0xff,0x00,0x10,0xd5,0x55,0xb2,0xff,0x00,0x21,0xaa,0xab,0xb2,0xff,0x00,0x21,0xaa,0xab,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x2d,0xd5,0x55,0x97,0xc5,0xff,0x00,0x06,0xaa,0xaa,0xff,0x00,0x20,0xaa,0xab,0xff,0x00,0x03,0x55,0x56,0xa3,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8b,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xfa,0x2a,0xaa,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xf4,0x55,0x56,0x9f,0xff,0xff,0xf4,0x55,0x56,0x9f,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xe8,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xaa,0x08,0xff,0x00,0x1d,0x55,0x56,0xff,0x00,0x0c,0xaa,0xaa,0xff,0x00,0x19,0x2a,0xaa,0xff,0x00,0x12,0x55,0x56,0xa0,0xa3,0xa0,0xa3,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x1c,0xaa,0xaa,0x93,0xff,0x00,0x21,0x55,0x56,0xff,0x00,0x06,0xaa,0xaa,0xff,0x00,0x1d,0x55,0x34,0xff,0x00,0x03,0x55,0x56,0xff,0x00,0x15,0x55,0x54,0x8b,0xff,0x00,0x0d,0x55,0x78,0x8b,0xff,0x00,0x28,0xaa,0xac,0xff,0xff,0xf2,0x55,0x56,0xab,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x17,0x55,0x54,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x17,0x55,0x54,0xff,0xff,0xdb,0x55,0x56,0xff,0x00,0x0b,0xaa,0xac,0x5d,0x8b,0xff,0xff,0x8f,0x55,0x56,0x8b,0xff,0xff,0xbb,0x55,0x55,0xff,0xff,0xc2,0xaa,0xac,0xff,0xff,0xe7,0x55,0x55,0xff,0xff,0x85,0x55,0x54,0x08,0xd1,0x06,0xff,0x00,0x0f,0xff,0xf9,0xff,0x00,0x4f,0x55,0x54,0xff,0x00,0x29,0x55,0x55,0xff,0x00,0x27,0xaa,0xac,0xff,0x00,0x42,0xaa,0xb2,0x8b,0xff,0x00,0x1a,0xaa,0x7e,0x8b,0xff,0x00,0x15,0x2a,0xaa,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0f,0xaa,0xd8,0xff,0xff,0xf1,0x55,0x54,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xf1,0x55,0x54,0xff,0x00,0x07,0xd5,0x56,0x77,0x8b,0xff,0xff,0xe6,0xaa,0xac,0x8b,0xff,0xff,0xf9,0x55,0x54,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xac,0xff,0xff,0xfb,0x55,0x56,0x71,0x85,0x69,0xff,0xff,0xf0,0xd5,0x56,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0xe7,0xaa,0xaa,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xe7,0xaa,0xbe,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xe3,0x2a,0xaa,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xde,0xaa,0x98,0x8b,0x08,0x68,0x8b,0x7c,0x49,0xb2,0x8b,0x05,0xff,0x00,0x1e,0xaa,0x86,0x8b,0xff,0x00,0x17,0x2a,0xaa,0xff,0xff,0xf8,0x2a,0xaa,0xff,0x00,0x0f,0xaa,0xd0,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x07,0xd5,0x56,0xff,0xff,0xea,0x2a,0xaa,0x8b,0x6f,0x8b,0x7f,0x88,0xff,0xff,0xeb,0x55,0x55,0x85,0xff,0xff,0xe2,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xaa,0xff,0xff,0xdb,0x55,0x59,0xff,0xff,0xf0,0x55,0x56,0x6e,0x73,0xff,0xff,0xea,0xaa,0xa7,0x73,0xff,0xff,0xea,0xaa,0xac,0xff,0xff,0xe2,0xaa,0xab,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xdd,0x55,0x55,0xff,0xff,0xff,0xff,0xfe,0x6d,0x8b,0xff,0xff,0xe9,0x2a,0xab,0xff,0x00,0x06,0xd5,0x55,0xff,0xff,0xf0,0x55,0x55,0xff,0x00,0x0d,0xaa,0xab,0x08,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x0d,0xaa,0xaa,0xff,0xff,0xf8,0x2a,0xaa,0xff,0x00,0x14,0x80,0x00,0x8b,0xff,0x00,0x1b,0x55,0x56,0x8b,0xff,0x00,0x06,0xaa,0xab,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x02,0xaa,0xaa,0x9b,0x08,0x42,0x06,0xff,0xff,0xfc,0xaa,0xab,0x7d,0xff,0xff,0xfe,0x55,0x55,0x7b,0x8b,0x79,0x8b,0xff,0xff,0xd5,0x55,0x55,0xff,0x00,0x0d,0x80,0x00,0xff,0xff,0xdf,0x2a,0xab,0xa6,0x74,0x08,0x0e,0x6c,0xf8,0x40,0xf7,0x1b,0x15,0x99,0xcd,0x40,0x8b,0xb3,0xf7,0x50,0x42,0x8b,0x63,0xfb,0x50,0xfb,0x48,0x8b,0xf7,0xcb,0xf8,0x7d,0x3c,0x8b,0xfb,0xca,0xfc,0x7d,0x7c,0x49,0xf7,0x97,0x8b,0x6e,0xfb,0x1b,0xd4,0x8b,0xa8,0xf7,0x1b,0x05,0x0e,0x5c,0xdb,0xff,0x00,0x15,0x80,0x00,0x15,0xa5,0x76,0xb0,0xff,0xff,0xf5,0x80,0x00,0xbb,0x8b,0xff,0x00,0x37,0x55,0x55,0x8b,0xff,0x00,0x2d,0xaa,0xab,0xff,0x00,0x10,0x2a,0xab,0xaf,0xff,0x00,0x20,0x55,0x55,0xaf,0xff,0x00,0x20,0x55,0x55,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x2e,0x80,0x00,0xff,0x00,0x0c,0xaa,0xaa,0xff,0x00,0x3c,0xaa,0xab,0x08,0x9b,0xd7,0x05,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x14,0x55,0x56,0x8b,0x9f,0x8b,0xff,0x00,0x2a,0xaa,0xaa,0xff,0xff,0xf4,0x2a,0xaa,0xff,0x00,0x20,0xd5,0x56,0xff,0xff,0xe8,0x55,0x56,0xa2,0xff,0xff,0xe8,0x55,0x56,0xa2,0xff,0xff,0xdd,0x2a,0xaa,0xff,0x00,0x0b,0x80,0x00,0x5d,0x8b,0xff,0xff,0xe9,0x55,0x56,0x8b,0xff,0xff,0xea,0xd5,0x55,0xff,0xff,0xfb,0xd5,0x56,0xff,0xff,0xec,0x55,0x55,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xec,0x55,0x55,0xff,0xff,0xf7,0xab,0x14,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0x42,0x08,0xba,0xf7,0x70,0xf7,0x9b,0x8b,0x99,0xce,0xfb,0xde,0x8b,0x3b,0xfc,0x0e,0xcb,0x8b,0x05,0xff,0x00,0x0a,0xaa,0xab,0xa1,0xff,0x00,0x0f,0x2a,0xaa,0xff,0x00,0x11,0x2a,0xaa,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x16,0x2a,0xaa,0xff,0x00,0x06,0x2a,0xaa,0xff,0x00,0x18,0xaa,0xab,0x8b,0xc3,0x8b,0xa7,0xff,0xff,0xe4,0x55,0x56,0x8b,0xff,0xff,0xc8,0xaa,0xaa,0x8b,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xfe,0x55,0x56,0x7b,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x08,0x7e,0x4a,0x05,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xa9,0x55,0x56,0xff,0xff,0xd4,0xaa,0xaa,0xff,0xff,0xd4,0xaa,0xaa,0x45,0x8b,0x51,0x8b,0x6e,0xa6,0x8b,0xc1,0x8b,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x00,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x01,0x55,0x56,0x97,0x08,0x47,0x06,0x87,0x79,0x89,0xff,0xff,0xef,0x55,0x55,0x8b,0xff,0xff,0xf0,0xaa,0xab,0x8b,0x63,0x98,0xff,0xff,0xe1,0x80,0x00,0xa5,0x76,0x08,0x0e,0x67,0xdd,0xa7,0x15,0xff,0x00,0x1b,0xff,0xfe,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x26,0xaa,0xab,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x31,0x55,0x57,0x8b,0xff,0x00,0x36,0xaa,0xab,0x8b,0xff,0x00,0x2f,0x55,0x55,0xff,0x00,0x11,0x2a,0xab,0xb3,0xff,0x00,0x22,0x55,0x55,0xb3,0xff,0x00,0x22,0x55,0x55,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x2f,0x80,0x00,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x3c,0xaa,0xab,0x8f,0x9d,0xff,0x00,0x03,0x2a,0xaa,0xff,0x00,0x0f,0xd5,0x55,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x0d,0xaa,0xab,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x0d,0xaa,0xab,0xff,0x00,0x01,0x2a,0xaa,0xff,0x00,0x0c,0x7f,0xff,0x8b,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x2b,0x55,0x56,0xff,0xff,0xf3,0x55,0x56,0xad,0xff,0xff,0xe6,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xaa,0x08,0xff,0xff,0xe6,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xde,0x55,0x56,0xff,0x00,0x0c,0x55,0x56,0x61,0x8b,0xff,0xff,0xf0,0xaa,0xaa,0x8b,0xff,0xff,0xf1,0x80,0x00,0x89,0xff,0xff,0xf2,0x55,0x56,0x87,0xff,0xff,0xf2,0x55,0x64,0x87,0xff,0xff,0xf4,0xd5,0x55,0x86,0xff,0xff,0xf7,0x55,0x47,0x85,0x08,0xf7,0x69,0xf7,0xc3,0x3c,0x8b,0xfb,0x7a,0xfb,0xd9,0x05,0x67,0xff,0xff,0xcc,0xaa,0xaa,0x74,0xff,0xff,0xcf,0x55,0x56,0x81,0x5d,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe8,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xfe,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xfe,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xff,0x55,0x55,0x80,0x8b,0xff,0xff,0xf5,0x55,0x55,0x8b,0xff,0xff,0xd2,0xaa,0xab,0x99,0xff,0xff,0xdc,0xaa,0xab,0xa7,0xff,0xff,0xe6,0xaa,0xaa,0x08,0xff,0x00,0xd7,0x80,0x00,0xff,0x00,0x3c,0x80,0x00,0x15,0xff,0xff,0xe7,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xe2,0x2a,0xab,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xe2,0xaa,0xab,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xe9,0x2a,0xaa,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xef,0xaa,0xab,0xff,0x00,0x10,0xaa,0xac,0xff,0xff,0xef,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xf7,0xd5,0x56,0xa2,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x00,0xaa,0xaa,0x94,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0d,0xaa,0xab,0x8f,0x9d,0x93,0xff,0x00,0x26,0xaa,0xab,0xff,0x00,0x10,0x55,0x55,0xff,0x00,0x1e,0x7f,0xff,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0x08,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1d,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x17,0x2a,0xaa,0xff,0xff,0xf7,0xd5,0x56,0x9c,0xff,0xff,0xef,0xaa,0xaa,0x9c,0xff,0xff,0xef,0xaa,0xaa,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xe9,0x80,0x00,0x8b,0xff,0xff,0xe3,0x55,0x56,0x8b,0xff,0xff,0xf6,0xaa,0xab,0x89,0xff,0xff,0xf2,0xaa,0xaa,0x87,0xff,0xff,0xee,0xaa,0xab,0xff,0xff,0xfe,0xaa,0xaa,0x83,0x89,0xff,0xff,0xf6,0x55,0x55,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0x83,0xff,0xff,0xd8,0xaa,0xab,0xff,0xff,0xef,0xd5,0x56,0xff,0xff,0xe1,0x2a,0xab,0xff,0xff,0xe7,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0x08,0x0e,0x28,0xf8,0x78,0xf9,0x46,0x15,0xfb,0xf3,0x8b,0x7d,0x49,0xf7,0xac,0x8b,0xfb,0xfc,0xfd,0x04,0xd4,0x8b,0xf7,0xfa,0xf9,0x04,0x05,0x0e,0xff,0x00,0x5a,0x80,0x00,0xff,0x00,0x1d,0x80,0x00,0x15,0xa8,0xff,0xff,0xe5,0xaa,0xab,0xff,0x00,0x26,0xd5,0x55,0xff,0xff,0xf2,0xd5,0x55,0xff,0x00,0x30,0xaa,0xab,0x8b,0xff,0x00,0x37,0x55,0x56,0x8b,0xff,0x00,0x2f,0xaa,0xaa,0x9c,0xb3,0xad,0xb3,0xad,0xff,0x00,0x1a,0xaa,0xaa,0xb9,0xff,0x00,0x0d,0x55,0x56,0xc5,0xff,0x00,0x03,0x55,0x56,0x99,0xff,0x00,0x02,0x80,0x00,0xff,0x00,0x0c,0x2a,0xab,0xff,0x00,0x01,0xaa,0xaa,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x01,0xaa,0xaa,0xff,0x00,0x0a,0x55,0x39,0xff,0x00,0x00,0xd5,0x56,0xff,0x00,0x09,0xd5,0x55,0x8b,0xff,0x00,0x09,0x55,0x72,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xfa,0x80,0x00,0xff,0x00,0x17,0x80,0x00,0x80,0xff,0x00,0x14,0x55,0x56,0x08,0x80,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xef,0x2a,0xaa,0xff,0x00,0x0f,0xd5,0x54,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x0b,0x55,0x56,0xa7,0x97,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x12,0x80,0x00,0xff,0x00,0x14,0xaa,0xaa,0xa4,0xff,0x00,0x14,0xaa,0xaa,0xa4,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x1d,0x2a,0xaa,0x91,0xff,0x00,0x21,0x55,0x56,0x08,0x8f,0xa0,0x05,0x8d,0x97,0x8c,0xff,0x00,0x0b,0xaa,0xac,0x8b,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x29,0x55,0x08,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x21,0x55,0x54,0xff,0xff,0xe5,0x55,0x56,0xff,0x00,0x19,0x55,0xa4,0xff,0xff,0xe5,0x55,0x56,0xff,0x00,0x19,0x55,0x54,0xff,0xff,0xdb,0x55,0x54,0xff,0x00,0x0c,0xaa,0xac,0xff,0xff,0xd1,0x55,0x56,0x8b,0xff,0xff,0xcb,0x55,0x56,0x8b,0xff,0xff,0xd2,0xff,0xff,0xff,0xff,0xef,0xd5,0x54,0xff,0xff,0xda,0xaa,0xab,0xff,0xff,0xdf,0xaa,0xac,0xff,0xff,0xda,0xaa,0xab,0xff,0xff,0xdf,0xaa,0xac,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xd6,0xd5,0x54,0xff,0xff,0xf6,0xaa,0xab,0x59,0xff,0xff,0xfe,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xac,0xff,0xff,0xfe,0x55,0x55,0xff,0xff,0xf7,0xaa,0xa8,0x89,0xff,0xff,0xf6,0xaa,0xac,0x08,0x89,0xff,0xff,0xf6,0xaa,0xaa,0x8a,0x80,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0x59,0xff,0x00,0x12,0xaa,0xab,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x25,0x55,0x55,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xde,0xaa,0xab,0x7d,0xff,0xff,0xe3,0xaa,0xab,0xff,0xff,0xea,0xd5,0x56,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xaa,0x7c,0xff,0xff,0xdf,0xd5,0x55,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xdc,0x00,0x01,0x85,0x6b,0x88,0xff,0xff,0xe9,0x55,0x55,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xd3,0x55,0x54,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xdc,0x80,0x00,0xa8,0xff,0xff,0xe5,0xaa,0xac,0x08,0xff,0x01,0x17,0x80,0x00,0xff,0x01,0x8c,0x80,0x00,0x15,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xaa,0x6b,0x8b,0x71,0x8b,0xff,0xff,0xeb,0x55,0x55,0xff,0x00,0x07,0x80,0x00,0xff,0xff,0xf0,0xaa,0xab,0x9a,0xff,0xff,0xf0,0xaa,0xab,0x9a,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x14,0x2a,0xaa,0x8b,0xff,0x00,0x19,0x55,0x56,0x8b,0xff,0x00,0x06,0xaa,0xaa,0xff,0x00,0x02,0x55,0x55,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x04,0xaa,0xab,0xa5,0xff,0x00,0x05,0x55,0x48,0xff,0x00,0x1f,0x55,0x10,0xff,0x00,0x0e,0x55,0x55,0xff,0x00,0x19,0xd5,0x54,0xff,0x00,0x17,0x55,0x63,0xff,0x00,0x14,0x55,0x9c,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x14,0x55,0x54,0xa6,0xff,0x00,0x0a,0x2a,0xac,0xff,0x00,0x1e,0xaa,0xaa,0x8b,0x08,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xa0,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf1,0x55,0x54,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf1,0x55,0xe8,0xff,0x00,0x07,0xaa,0xaa,0xff,0xff,0xec,0x55,0x54,0x8b,0xff,0xff,0xe7,0x54,0xc4,0x8b,0x83,0x8a,0xff,0xff,0xf7,0x55,0x54,0x89,0xff,0xff,0xf6,0xaa,0xac,0x08,0x87,0x75,0x05,0x85,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x54,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0x08,0xff,0xff,0xc0,0x80,0x00,0xfb,0xe5,0x15,0x72,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xe1,0xd5,0x55,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xab,0x8b,0x6d,0x8b,0xff,0xff,0xe8,0x80,0x00,0xff,0x00,0x08,0xaa,0xaa,0x7a,0xff,0x00,0x11,0x55,0x56,0x7a,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x17,0x55,0x54,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x09,0x55,0x4b,0x8e,0xff,0x00,0x12,0x55,0x55,0x91,0xff,0x00,0x1b,0x55,0x60,0x93,0xff,0x00,0x25,0x55,0x54,0xff,0x00,0x10,0xd5,0x55,0xa9,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x16,0xaa,0xac,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x1e,0x80,0x00,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x23,0x55,0x55,0x8b,0x08,0xff,0x00,0x1e,0xaa,0xaa,0x8b,0xff,0x00,0x17,0x80,0x00,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x10,0x55,0x56,0x7a,0xff,0x00,0x10,0x55,0x56,0x7a,0xff,0x00,0x08,0x2a,0xaa,0xff,0xff,0xe9,0x2a,0xaa,0x8b,0xff,0xff,0xe3,0x55,0x56,0x8b,0x83,0xff,0xff,0xff,0x55,0x56,0xff,0xff,0xf8,0x2a,0xab,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xf8,0x55,0x55,0xff,0xff,0xfe,0xac,0x14,0xff,0xff,0xf8,0x55,0x55,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xf5,0x2a,0xab,0xff,0xff,0xfc,0xa9,0x42,0x7d,0xff,0xff,0xf7,0x55,0x56,0x65,0xff,0xff,0xef,0x2a,0xaa,0xff,0xff,0xe1,0xaa,0xaa,0x72,0xff,0xff,0xe9,0x55,0x56,0x08,0x0e,0x67,0xf7,0xd0,0xf7,0xc3,0x15,0xfb,0x69,0xfb,0xc3,0xdb,0x8b,0xf7,0x79,0xf7,0xd9,0x05,0xff,0x00,0x12,0xaa,0xaa,0xff,0x00,0x1a,0xaa,0x94,0x9a,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x16,0xaa,0xc2,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x16,0xaa,0x90,0x93,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xc6,0x8f,0xff,0x00,0x15,0x55,0x56,0x8e,0xff,0x00,0x11,0x2a,0xaa,0x8d,0x98,0x8d,0x98,0x8c,0xff,0x00,0x0a,0xd5,0x54,0x8b,0xff,0x00,0x08,0xaa,0xac,0x8b,0xff,0x00,0x2d,0x55,0x54,0xff,0xff,0xf1,0x80,0x00,0xff,0x00,0x23,0xaa,0xac,0x6e,0xa5,0x6e,0xa5,0xff,0xff,0xd8,0xd5,0x56,0x98,0xff,0xff,0xce,0xaa,0xaa,0x8b,0x08,0xff,0xff,0xc9,0x55,0x56,0x8b,0xff,0xff,0xd0,0xd5,0x55,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xd8,0x55,0x55,0xff,0xff,0xde,0xaa,0xac,0xff,0xff,0xd8,0x55,0x55,0xff,0xff,0xde,0xaa,0xac,0xff,0xff,0xe6,0x2a,0xab,0x5c,0x7f,0xff,0xff,0xc3,0x55,0x54,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xfa,0xab,0x28,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf8,0x2a,0xaa,0x89,0xff,0xff,0xf5,0xaa,0x2e,0x89,0xff,0xff,0xf5,0xab,0x20,0xff,0xff,0xfe,0x2a,0xaa,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf5,0xaa,0x36,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xff,0x2a,0xaa,0xff,0xff,0xf5,0x80,0x00,0x8b,0xff,0xff,0xf5,0x55,0x56,0x8b,0x5f,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xdd,0x80,0x00,0xff,0x00,0x18,0x55,0x56,0x72,0x08,0xff,0x00,0x18,0x55,0x55,0x72,0xff,0x00,0x21,0x80,0x00,0xff,0xff,0xf3,0x80,0x00,0xff,0x00,0x2a,0xaa,0xab,0x8b,0xff,0x00,0x0e,0xaa,0xab,0x8b,0xff,0x00,0x0e,0x7f,0xff,0x8d,0xff,0x00,0x0e,0x55,0x56,0x8f,0xff,0x00,0x0e,0x55,0x56,0x8f,0xff,0x00,0x0b,0xd5,0x54,0x90,0xff,0x00,0x09,0x55,0x56,0x91,0x08,0xb6,0xff,0x00,0x4e,0x80,0x00,0x15,0xff,0xff,0xe6,0xaa,0xbe,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe1,0xaa,0xaa,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xdc,0xaa,0x98,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xe9,0x2a,0xaa,0x93,0xff,0xff,0xef,0xaa,0xab,0x9b,0xff,0xff,0xef,0xaa,0xab,0x9b,0xff,0xff,0xf7,0xd5,0x55,0xff,0x00,0x16,0x55,0x56,0x8b,0xff,0x00,0x1c,0xaa,0xaa,0x8b,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x03,0xaa,0xab,0xa2,0xff,0x00,0x07,0x55,0x55,0xff,0x00,0x22,0xaa,0xaa,0x93,0xff,0x00,0x27,0x55,0x54,0xff,0x00,0x10,0x80,0x00,0xaa,0xa4,0xff,0x00,0x16,0xaa,0xac,0xa4,0xff,0x00,0x16,0xaa,0xac,0xff,0x00,0x1d,0xd5,0x56,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x22,0xaa,0xaa,0x8b,0x08,0xff,0x00,0x1d,0x55,0x56,0x8b,0xa2,0xff,0xff,0xf7,0xd5,0x54,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xac,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xac,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xe9,0x80,0x00,0x8b,0xff,0xff,0xe3,0x55,0x54,0x8b,0xff,0xff,0xf5,0x55,0x54,0xff,0xff,0xfc,0x55,0x56,0xff,0xff,0xe8,0x55,0x56,0xff,0xff,0xf8,0xaa,0xaa,0xff,0xff,0xdb,0x55,0x56,0xff,0xff,0xf8,0xaa,0xdc,0x65,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xe1,0xd5,0x56,0xff,0xff,0xe6,0xaa,0x7a,0xff,0xff,0xe9,0xaa,0xaa,0x08,0x0e,0xfb,0xe4,0x9d,0xe7,0x15,0x27,0x0a,0x7a,0xf7,0xe6,0x15,0x27,0x0a,0x0e,0xfb,0xe3,0xb4,0xe8,0x15,0x26,0x0a,0x7a,0xf7,0xe5,0x15,0x27,0x0a,0x0e,0xb7,0xf7,0x8b,0x15,0xf8,0x22,0xfb,0x37,0x8b,0xd2,0xfb,0xc5,0xf7,0x0d,0xf7,0xc5,0xf7,0x0d,0x8b,0xd2,0xfc,0x22,0xfb,0x36,0x05,0x0e,0xc8,0xf8,0x29,0x15,0x48,0xf8,0x22,0xce,0x07,0xfc,0x22,0xfb,0x54,0x15,0x49,0xf8,0x22,0xcd,0x07,0x0e,0xda,0xf7,0x2f,0x15,0x8b,0x44,0xf8,0x22,0xf7,0x37,0x8b,0xc6,0xfc,0x22,0xf7,0x36,0x8b,0x44,0xf7,0xc5,0xfb,0x0d,0x05,0x0e,0x27,0xf7,0x3d,0xf7,0x81,0x15,0x7e,0x50,0xd4,0x8b,0x98,0xc5,0x05,0x8f,0xff,0x00,0x11,0x55,0x55,0x90,0xff,0x00,0x0e,0x55,0x55,0x91,0xff,0x00,0x0b,0x55,0x56,0x91,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x0d,0x55,0x54,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x56,0x08,0xd5,0xdb,0x05,0xa3,0xff,0x00,0x19,0x55,0x56,0xff,0x00,0x12,0x2a,0xaa,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x56,0x9f,0xff,0x00,0x0c,0x55,0x56,0x9f,0xff,0x00,0x08,0x80,0x00,0xa1,0xff,0x00,0x04,0xaa,0xaa,0xa3,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0c,0xaa,0xac,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0d,0xaa,0xa8,0x8b,0xff,0x00,0x0e,0xaa,0xac,0x8b,0xff,0x00,0x26,0xaa,0xac,0xff,0xff,0xf3,0xd5,0x56,0xff,0x00,0x1e,0xaa,0xa8,0xff,0xff,0xe7,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xac,0xff,0xff,0xe7,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xac,0xff,0xff,0xdd,0x80,0x00,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xd3,0x55,0x56,0x8b,0xff,0xff,0xc8,0xaa,0xab,0x8b,0xff,0xff,0xd2,0x55,0x55,0x7c,0x67,0x6d,0x08,0x67,0x6d,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xd4,0xaa,0xac,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xc7,0x55,0x54,0x08,0xd4,0x06,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x48,0xaa,0xac,0xff,0x00,0x28,0xaa,0xab,0xff,0x00,0x24,0x55,0x54,0xff,0x00,0x40,0xaa,0xaa,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xf9,0xaa,0xac,0x99,0xff,0xff,0xf3,0x55,0x54,0x99,0xff,0xff,0xf3,0x55,0x54,0x92,0x79,0x8b,0xff,0xff,0xe8,0xaa,0xac,0x8b,0xff,0xff,0xf7,0x55,0x54,0x8a,0xff,0xff,0xf6,0xaa,0xac,0x89,0x81,0x87,0xff,0xff,0xed,0x55,0x94,0xff,0xff,0xf9,0x2a,0xaa,0x7a,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xf0,0xaa,0x6c,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xef,0x80,0x00,0x77,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x56,0x08,0x46,0x42,0x05,0x77,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xf2,0x2a,0xab,0x79,0xff,0xff,0xf8,0x55,0x55,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xf8,0x55,0x55,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xf9,0x80,0x00,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xab,0x73,0x08,0x64,0xfb,0x24,0x15,0x20,0x0a,0x0e,0xf7,0xea,0xf7,0x5b,0xff,0xff,0xa3,0x80,0x00,0x15,0xbb,0xff,0xff,0xe8,0x55,0x56,0xff,0x00,0x37,0xaa,0xaa,0xff,0xff,0xf4,0x2a,0xaa,0xff,0x00,0x3f,0x55,0x56,0x8b,0xbb,0x8b,0xff,0x00,0x2b,0xd5,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x27,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x27,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x28,0x2a,0xa8,0x9a,0xff,0x00,0x28,0xaa,0xac,0xff,0x00,0x14,0xaa,0xaa,0x08,0x78,0xc4,0x05,0xff,0xff,0xdb,0x55,0x54,0xff,0xff,0xee,0xaa,0xab,0x67,0xff,0xff,0xf3,0x2a,0xaa,0xff,0xff,0xdc,0xaa,0xac,0xff,0xff,0xf7,0xaa,0xab,0xff,0xff,0xdc,0xaa,0xaa,0xff,0xff,0xf7,0xaa,0xab,0xff,0xff,0xd8,0x55,0x56,0xff,0xff,0xfb,0xd5,0x55,0x5f,0x8b,0xff,0xff,0xb0,0xaa,0xaa,0x8b,0xff,0xff,0xc2,0x2a,0xab,0xff,0x00,0x14,0xd5,0x55,0xff,0xff,0xd3,0xaa,0xab,0xff,0x00,0x29,0xaa,0xab,0xff,0xff,0xd3,0xaa,0xab,0xff,0x00,0x29,0xaa,0xab,0xff,0xff,0xe9,0xd5,0x55,0xff,0x00,0x38,0x2a,0xab,0x8b,0xff,0x00,0x46,0xaa,0xaa,0x8b,0xff,0x00,0x19,0x55,0x55,0x8e,0xff,0x00,0x1a,0xaa,0xab,0x91,0xa7,0x08,0x9a,0xd2,0x05,0x9f,0xeb,0xff,0x00,0x29,0x2a,0xab,0xff,0x00,0x4b,0x2a,0xaa,0xff,0x00,0x3e,0x55,0x55,0xff,0x00,0x36,0x55,0x56,0xff,0x00,0x3e,0x55,0x56,0xff,0x00,0x36,0x55,0x54,0xff,0x00,0x51,0x80,0x00,0xff,0x00,0x1b,0x2a,0xac,0xff,0x00,0x64,0xaa,0xaa,0x8b,0xdb,0x8b,0xff,0x00,0x3e,0x2a,0xac,0xff,0xff,0xeb,0xaa,0xac,0xff,0x00,0x2c,0x55,0x54,0xff,0xff,0xd7,0x55,0x54,0xff,0x00,0x2c,0x55,0x54,0xff,0xff,0xd7,0x55,0x74,0xff,0x00,0x16,0x2a,0xac,0x53,0x8b,0xff,0xff,0xb8,0xaa,0x8c,0x8b,0xff,0xff,0xe7,0x55,0x56,0x88,0xff,0xff,0xe5,0xaa,0xaa,0x85,0x6f,0x08,0x7c,0x48,0x05,0xff,0xff,0xf4,0xaa,0xac,0xff,0xff,0xce,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xa8,0xff,0xff,0xdc,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xea,0xaa,0xab,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xea,0xaa,0xa8,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xe6,0xaa,0xac,0x8b,0xff,0xff,0xef,0x55,0x54,0x8b,0xff,0xff,0xf2,0xaa,0xac,0xff,0x00,0x04,0xd5,0x56,0x81,0xff,0x00,0x09,0xaa,0xaa,0x81,0xff,0x00,0x09,0xaa,0xab,0x86,0xff,0x00,0x0e,0x80,0x00,0x8b,0xff,0x00,0x13,0x55,0x55,0x8b,0xff,0x00,0x08,0xaa,0xab,0x8c,0xff,0x00,0x09,0xaa,0xaa,0x8d,0xff,0x00,0x0a,0xaa,0xab,0x08,0xc9,0xf7,0xb5,0x49,0x8b,0x82,0x5e,0x05,0x83,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf3,0x55,0x54,0xff,0x00,0x0d,0x80,0x00,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x56,0xff,0xff,0xe6,0xaa,0xaa,0x8b,0xff,0xff,0x9f,0x55,0x56,0x8b,0xff,0xff,0xc2,0xaa,0xaa,0xff,0xff,0xc3,0x55,0x56,0x71,0xff,0xff,0x86,0xaa,0xaa,0x08,0x7a,0x3b,0x05,0x87,0x77,0x89,0xff,0xff,0xed,0x55,0x55,0x8b,0xff,0xff,0xee,0xaa,0xab,0x8b,0xff,0xff,0xd8,0xaa,0xab,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xe1,0x55,0x55,0xa0,0x75,0xa0,0x75,0xff,0x00,0x1f,0x2a,0xaa,0x80,0xff,0x00,0x29,0x55,0x56,0x8b,0xff,0x00,0x3b,0x55,0x56,0x8b,0xb8,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x2f,0x55,0x56,0xff,0x00,0x05,0x54,0x4c,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x11,0x56,0x60,0xff,0xff,0xf3,0xaa,0xaa,0xff,0x00,0x11,0x54,0xc4,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x16,0x55,0x54,0xff,0xff,0xf9,0xd5,0x55,0xff,0x00,0x1b,0x55,0xe8,0x8b,0x08,0xff,0x00,0x2c,0xaa,0xac,0x8b,0xff,0x00,0x27,0xaa,0xa8,0xff,0x00,0x10,0x55,0x55,0xff,0x00,0x22,0xaa,0xac,0xff,0x00,0x20,0xaa,0xab,0xff,0x00,0x22,0xaa,0xac,0xff,0x00,0x20,0xaa,0xab,0xff,0x00,0x18,0x55,0x54,0xff,0x00,0x30,0xff,0xff,0x99,0xff,0x00,0x41,0x55,0x56,0x08,0x99,0xce,0x05,0x91,0xa7,0x8e,0xa6,0x8b,0xa5,0x8b,0xff,0x00,0x39,0x55,0x56,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x32,0xaa,0xaa,0x70,0xb7,0x70,0xb7,0xff,0xff,0xda,0x2a,0xac,0xad,0xff,0xff,0xcf,0x55,0x54,0xa3,0xff,0xff,0xcf,0x55,0x54,0xa3,0xff,0xff,0xc7,0xaa,0xac,0x97,0x4b,0x8b,0xff,0xff,0xb2,0xaa,0xaa,0x8b,0x46,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xc3,0x55,0x56,0x6c,0xff,0xff,0xc3,0x55,0x55,0x6c,0xff,0xff,0xce,0x2a,0xab,0xff,0xff,0xd4,0x80,0x00,0x64,0x53,0x08,0x64,0x53,0xff,0xff,0xe4,0x2a,0xaa,0xff,0xff,0xbe,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xb5,0x55,0x56,0x08,0x7c,0x47,0x05,0xff,0xff,0xf9,0x55,0x55,0xff,0xff,0xe2,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xab,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0x51,0xff,0x00,0x0d,0x2a,0xaa,0xff,0xff,0xcd,0x2a,0xab,0xff,0x00,0x1a,0x55,0x56,0xff,0xff,0xd4,0x55,0x55,0xff,0x00,0x1a,0x55,0x56,0xff,0xff,0xd4,0x55,0x55,0xff,0x00,0x25,0x2a,0xaa,0xff,0xff,0xde,0x55,0x55,0xbb,0xff,0xff,0xe8,0x55,0x56,0x08,0xf7,0xd7,0xff,0x01,0x49,0x80,0x00,0x15,0x79,0x39,0xff,0xff,0xd8,0x55,0x56,0x62,0xff,0xff,0xc2,0xaa,0xaa,0x8b,0xff,0xff,0xce,0xaa,0xaa,0xff,0xff,0xff,0xff,0xfc,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x19,0xaa,0xab,0x8b,0xff,0x00,0x33,0x55,0x59,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8d,0x9c,0x8f,0xff,0x00,0x12,0xaa,0xab,0x08,0x9b,0xd5,0x05,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x53,0x55,0x56,0xff,0x00,0x28,0x55,0x54,0xff,0x00,0x29,0xaa,0xaa,0xff,0x00,0x3f,0x55,0x56,0x8b,0xff,0x00,0x30,0xaa,0xac,0x8b,0xff,0x00,0x18,0x55,0x54,0xff,0xff,0xe6,0x55,0x56,0x8b,0xff,0xff,0xcc,0xaa,0xaa,0x8b,0x7b,0xff,0xff,0xfe,0x55,0x54,0x7c,0xff,0xff,0xfc,0xaa,0xac,0x7d,0x08,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0x28,0x0a,0xf7,0xb1,0xc9,0x15,0x29,0x0a,0x0e,0xe2,0xff,0x02,0x05,0x80,0x00,0xff,0x01,0x33,0x80,0x00,0x15,0x7c,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xea,0x2a,0xaa,0xff,0x00,0x0f,0xd5,0x54,0xff,0xff,0xe3,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x0c,0xaa,0x7c,0xff,0x00,0x22,0xff,0xfe,0xff,0x00,0x18,0x2a,0xaa,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x23,0xaa,0xda,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x23,0xaa,0xaa,0xff,0x00,0x0d,0x55,0x54,0xff,0x00,0x27,0xd5,0x56,0x8b,0xb7,0x8b,0xff,0x00,0x2d,0x55,0x54,0xff,0xff,0xf0,0xd5,0x54,0xff,0x00,0x23,0x2a,0xac,0xff,0xff,0xe1,0xaa,0xac,0xa4,0xff,0xff,0xe1,0xaa,0xac,0xa4,0xff,0xff,0xd4,0x7f,0xfe,0xff,0x00,0x0c,0x80,0x00,0xff,0xff,0xc7,0x55,0x56,0x8b,0x08,0xfb,0x8c,0x8b,0xfb,0x27,0xfd,0x46,0xf7,0x97,0x8b,0x05,0xff,0x00,0x30,0xaa,0xa0,0x8b,0xff,0x00,0x2b,0xaa,0xaa,0xff,0x00,0x09,0x2a,0xab,0xff,0x00,0x26,0xaa,0xb6,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x26,0xaa,0xaa,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x1e,0x55,0x56,0xff,0x00,0x1a,0x55,0x55,0xa1,0xff,0x00,0x22,0x55,0x56,0xa1,0xff,0x00,0x22,0x55,0x55,0x96,0xff,0x00,0x28,0x80,0x00,0x8b,0xff,0x00,0x2e,0xaa,0xab,0x8b,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x1a,0x80,0x00,0x7c,0xff,0x00,0x16,0x55,0x56,0x08,0xff,0xfe,0xe2,0x80,0x00,0xff,0x01,0x3d,0x80,0x00,0x15,0xf7,0x43,0x06,0xff,0x00,0x4c,0xaa,0xaa,0xff,0x00,0x26,0x55,0x56,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xc3,0x55,0x54,0x1f,0x8b,0xff,0xff,0xd1,0x55,0x56,0x7a,0xff,0xff,0xdb,0x80,0x00,0x69,0xff,0xff,0xe5,0xaa,0xaa,0x69,0xff,0xff,0xe5,0xaa,0xaa,0x60,0xff,0xff,0xf2,0xd5,0x56,0x57,0x8b,0x08,0xfb,0x35,0x06,0xf7,0x80,0xff,0xfe,0xea,0x80,0x00,0x15,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xd4,0x55,0x54,0xff,0xff,0xf1,0xd5,0x56,0xff,0xff,0xc9,0x55,0x56,0x8b,0x08,0xfb,0x41,0x8b,0xc1,0xf7,0x93,0xf7,0x49,0x8b,0x05,0xff,0x00,0x26,0xaa,0xaa,0x8b,0xff,0x00,0x1d,0x55,0x56,0xff,0xff,0xf7,0xd5,0x56,0x9f,0xff,0xff,0xef,0xaa,0xaa,0x9f,0xff,0xff,0xef,0xaa,0xaa,0x95,0xff,0xff,0xe7,0xd5,0x55,0x8b,0xff,0xff,0xe0,0x00,0x01,0x8b,0xff,0xff,0xcf,0x55,0x55,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xd9,0x80,0x00,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe3,0xaa,0xab,0x08,0x0e,0xdb,0xff,0x00,0x71,0x80,0x00,0xff,0x00,0x24,0x80,0x00,0x15,0xb0,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x31,0x80,0x00,0xff,0xff,0xf1,0x2a,0xab,0xc9,0x8b,0xd1,0x8b,0xff,0x00,0x3a,0x2a,0xaa,0xff,0x00,0x12,0xd5,0x55,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x25,0xaa,0xab,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x25,0xaa,0xab,0xff,0x00,0x1f,0x7f,0xfe,0xff,0x00,0x33,0x7f,0xff,0xff,0x00,0x10,0xaa,0xac,0xff,0x00,0x41,0x55,0x56,0x08,0x8c,0x8f,0x44,0x8b,0x8a,0x87,0x05,0xff,0xff,0xf4,0xaa,0xe2,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xe0,0xaa,0x74,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xe0,0xaa,0xc0,0xff,0xff,0xe6,0xaa,0xac,0xff,0xff,0xd7,0xaa,0xaa,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xce,0xaa,0x96,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd2,0xaa,0xab,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xe6,0xaa,0xab,0xa0,0xff,0xff,0xe6,0xaa,0xab,0xa0,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x20,0x80,0x00,0x8b,0xb7,0x8b,0xff,0x00,0x11,0x55,0x48,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x19,0x55,0x63,0x08,0xb2,0xf7,0x48,0x05,0xff,0x00,0x0f,0x55,0x4f,0xff,0x00,0x47,0x55,0x56,0xff,0x00,0x18,0xd5,0x55,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x22,0x55,0x5c,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x22,0x55,0x56,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2c,0x80,0x00,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x36,0xaa,0xaa,0x8b,0xff,0x00,0x2c,0xaa,0xaa,0x8b,0xff,0x00,0x21,0xd5,0x56,0xff,0xff,0xf5,0x55,0x54,0xa2,0xff,0xff,0xea,0xaa,0xac,0xa2,0xff,0xff,0xea,0xaa,0xac,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xe1,0xaa,0xa8,0x8b,0xff,0xff,0xd8,0xaa,0xac,0x8b,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xff,0x55,0x54,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xfe,0xaa,0xac,0x85,0x08,0xd4,0x06,0x8d,0xff,0x00,0x0b,0x55,0x56,0x8c,0x96,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x38,0xaa,0xac,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x2c,0x55,0x54,0xff,0xff,0xdd,0x55,0x54,0xab,0xff,0xff,0xdd,0x55,0x56,0xab,0xff,0xff,0xce,0x55,0x54,0x9b,0xff,0xff,0xbf,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xb4,0x8b,0xff,0xff,0xc2,0x2a,0xaa,0xff,0xff,0xeb,0x2a,0xac,0xff,0xff,0xcd,0xaa,0xa2,0xff,0xff,0xd6,0x55,0x54,0xff,0xff,0xcd,0xaa,0xab,0xff,0xff,0xd6,0x55,0x78,0xff,0xff,0xdd,0x2a,0xab,0xff,0xff,0xbc,0xd5,0x54,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xa3,0x55,0x34,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0x70,0x8b,0x73,0x8b,0xff,0xff,0xc1,0x55,0x55,0xff,0x00,0x12,0x80,0x00,0xff,0xff,0xd1,0xd5,0x55,0xb0,0xff,0xff,0xe2,0x55,0x56,0x08,0x0e,0xe5,0xf7,0x41,0xf9,0x46,0x15,0xfb,0x27,0xfd,0x46,0xf7,0x80,0x8b,0x05,0xff,0x00,0x48,0xaa,0xaa,0x8b,0xff,0x00,0x3e,0x55,0x56,0xa0,0xbf,0xb5,0xff,0x00,0x33,0xff,0xfe,0xb5,0xff,0x00,0x23,0xaa,0xaa,0xff,0x00,0x42,0xaa,0xaa,0xff,0x00,0x13,0x55,0x58,0xff,0x00,0x5b,0x55,0x56,0x08,0xae,0xf7,0x38,0x05,0xff,0x00,0x06,0xaa,0xac,0xff,0x00,0x1e,0xaa,0x70,0xff,0x00,0x03,0x55,0x54,0xff,0x00,0x1c,0xaa,0xaa,0x8b,0xff,0x00,0x1a,0xaa,0xe6,0x8b,0xff,0x00,0x3d,0x55,0x0c,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x2c,0xd5,0x54,0xff,0xff,0xdd,0x55,0x54,0xff,0x00,0x1c,0x55,0xa0,0xff,0xff,0xdd,0x55,0x74,0xff,0x00,0x1c,0x55,0x54,0xff,0xff,0xd0,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xac,0xff,0xff,0xc3,0xff,0xe2,0x8b,0x08,0xfb,0x17,0xfd,0x04,0x15,0xfb,0x36,0x8b,0xf7,0x0a,0xf8,0xc2,0xf7,0x3a,0x8b,0x05,0xb5,0x8b,0xab,0xff,0xff,0xf6,0x55,0x54,0xa1,0xff,0xff,0xec,0xaa,0xac,0xa1,0xff,0xff,0xec,0xaa,0xac,0x96,0xff,0xff,0xe1,0x55,0x54,0x8b,0x61,0x8b,0xff,0xff,0xec,0xaa,0xe6,0xff,0xff,0xfc,0xaa,0xac,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0xff,0xde,0xaa,0x70,0x08,0x68,0xfb,0x39,0x05,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0x7f,0x55,0x55,0xff,0xff,0xbb,0x55,0x56,0xff,0xff,0xbf,0xaa,0xab,0xfb,0x02,0x8b,0x08,0x0e,0xa5,0xf7,0x7c,0xf9,0x04,0x15,0x2a,0x0a,0x0e,0x94,0xf7,0x7c,0xf9,0x04,0x15,0xf7,0xee,0x8b,0x99,0xcd,0xfc,0x37,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xce,0xf7,0xd0,0xf7,0xbc,0x8b,0x99,0xcd,0xfb,0xbc,0x8b,0x05,0x0e,0xdb,0xff,0x00,0x71,0x80,0x00,0xff,0x00,0x24,0x80,0x00,0x15,0xb0,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x31,0xd5,0x55,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x3e,0xaa,0xab,0x8b,0xff,0x00,0x96,0xaa,0xac,0x8b,0xff,0x00,0x5c,0xff,0xfe,0xff,0x00,0x54,0x55,0x55,0xff,0x00,0x23,0x55,0x56,0xff,0x00,0xa8,0xaa,0xab,0x08,0xa2,0xf7,0x02,0xfb,0x81,0x8b,0x7d,0x4c,0xf7,0x39,0x8b,0x7e,0x4f,0x05,0xff,0xff,0xf3,0x55,0x56,0x4f,0xff,0xff,0xe9,0x55,0x54,0xff,0xff,0xd4,0x2a,0xab,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe4,0x55,0x55,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe4,0x55,0x56,0x60,0xff,0xff,0xf2,0x2a,0xaa,0xff,0xff,0xca,0xaa,0xaa,0x8b,0x2f,0x8b,0x5d,0xff,0x00,0x29,0xaa,0xaa,0x8b,0xff,0x00,0x53,0x55,0x56,0x8b,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x1a,0xaa,0xab,0x08,0xb2,0xf7,0x48,0x05,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x46,0xaa,0xaa,0xa4,0xff,0x00,0x33,0x2a,0xaa,0xff,0x00,0x22,0xaa,0xab,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x22,0xaa,0xaa,0xff,0x00,0x1f,0xaa,0xac,0xb8,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x37,0x55,0x56,0x8b,0xff,0x00,0x2c,0xaa,0x8e,0x8b,0xff,0x00,0x21,0x2a,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0x00,0x15,0xaa,0xc8,0xff,0xff,0xeb,0x55,0x54,0xff,0x00,0x15,0xaa,0xaa,0xff,0xff,0xeb,0x55,0x9c,0xff,0x00,0x0a,0xd5,0x56,0xff,0xff,0xe2,0x55,0x54,0x8b,0xff,0xff,0xd9,0x55,0x10,0x08,0x8a,0x70,0xd4,0x8b,0x05,0x8b,0x93,0xff,0x00,0x00,0x55,0x54,0xff,0x00,0x06,0xd5,0x56,0xff,0x00,0x00,0xaa,0xac,0xff,0x00,0x05,0xaa,0xaa,0xff,0x00,0x00,0xaa,0xac,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x00,0x55,0x54,0xff,0x00,0x04,0x80,0x00,0x8b,0xff,0x00,0x03,0x55,0x54,0x8b,0xff,0x00,0x37,0x55,0x54,0xff,0xff,0xee,0xd5,0x54,0xff,0x00,0x2b,0xaa,0xac,0xff,0xff,0xdd,0xaa,0xac,0xab,0xff,0xff,0xdd,0xaa,0xaa,0xab,0xff,0xff,0xce,0x80,0x00,0x9b,0xff,0xff,0xbf,0x55,0x56,0x8b,0xff,0xff,0xb7,0x55,0x56,0x8b,0xff,0xff,0xc2,0x80,0x00,0x76,0xff,0xff,0xcd,0xaa,0xaa,0x61,0xff,0xff,0xcd,0xaa,0xab,0x61,0xff,0xff,0xdd,0x2a,0xab,0x48,0xff,0xff,0xec,0xaa,0xaa,0x2f,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0xff,0xff,0xe5,0x55,0x55,0x8b,0xff,0xff,0xe8,0xaa,0xab,0x8b,0xff,0xff,0xc0,0xaa,0xab,0xff,0x00,0x12,0x80,0x00,0xff,0xff,0xd1,0x7f,0xff,0xb0,0xff,0xff,0xe2,0x55,0x56,0x08,0x0e,0xee,0xf9,0x16,0xf9,0x46,0x15,0x42,0x8b,0x4a,0xfb,0xc4,0xfb,0xd7,0x8b,0xcc,0xf7,0xc4,0x42,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xcf,0xf7,0xd4,0xf7,0xd7,0x8b,0x47,0xfb,0xd4,0xd4,0x8b,0x05,0x0e,0xfb,0xad,0xf7,0x49,0xf9,0x46,0x15,0x2b,0x0a,0x0e,0xfb,0x6c,0x84,0xcd,0x15,0x7c,0x49,0xcf,0x8b,0x05,0xff,0x00,0x29,0x55,0x55,0x8b,0xff,0x00,0x21,0xd5,0x55,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x1a,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x1a,0x55,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x11,0x80,0x00,0xac,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x2b,0x55,0x56,0x08,0xf7,0x0a,0xf8,0xc1,0x42,0x8b,0xfb,0x08,0xfc,0xb8,0x05,0xff,0xff,0xfa,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x56,0x82,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xf3,0x55,0x56,0x7f,0xff,0xff,0xf3,0x55,0x56,0x7f,0xff,0xff,0xee,0x55,0x54,0x85,0xff,0xff,0xe9,0x55,0x56,0x8b,0x08,0x0e,0xc9,0xf8,0x08,0xf8,0x35,0x15,0xf7,0xac,0xf7,0xa5,0x32,0x8b,0xfc,0x25,0xfc,0x1d,0xdf,0xf8,0x1d,0x42,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xb4,0xf7,0x52,0xf7,0x45,0xf7,0x42,0xf7,0x1b,0xfc,0x00,0xd9,0x8b,0x05,0x0e,0x8b,0xf7,0x41,0xf9,0x46,0x15,0xfb,0x26,0xfd,0x46,0xf8,0x35,0x8b,0x99,0xcd,0xfb,0xec,0x8b,0xf7,0x18,0xf9,0x04,0x05,0x0e,0xf7,0x72,0xf9,0x91,0xf9,0x46,0x15,0x42,0x8b,0xfb,0xd5,0xfc,0x65,0xfb,0x11,0xf8,0x65,0x42,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xf7,0x06,0xf8,0xad,0xf7,0x04,0xfc,0x23,0xc4,0x8b,0xf7,0xa9,0xf8,0x21,0xfb,0x06,0xfc,0xab,0xd4,0x8b,0x05,0x0e,0xf7,0x19,0xf9,0x38,0xf9,0x46,0x15,0x2c,0x0a,0x0e,0xda,0xf7,0x05,0xff,0x00,0x24,0x80,0x00,0x15,0x2d,0x0a,0xf7,0xb2,0xff,0x00,0x44,0x80,0x00,0x15,0x2e,0x0a,0x0e,0xbc,0xff,0x02,0x27,0x80,0x00,0xff,0x02,0x83,0x80,0x00,0x15,0xff,0xff,0xe0,0x55,0x54,0xff,0x00,0x1b,0xaa,0xac,0xff,0xff,0xd3,0xd5,0x56,0xff,0x00,0x0d,0xd5,0x54,0xff,0xff,0xc7,0x55,0x56,0x8b,0x08,0xfb,0x8b,0x8b,0xfb,0x26,0xfd,0x41,0xd4,0x8b,0xc7,0xf7,0xac,0xf7,0x41,0x8b,0x05,0xbf,0x8b,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x28,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0x00,0x28,0xaa,0xa8,0xff,0x00,0x14,0xaa,0xaa,0xff,0x00,0x1f,0x80,0x00,0xff,0x00,0x1c,0xd5,0x56,0xff,0x00,0x16,0x55,0x58,0xb0,0xff,0x00,0x16,0x55,0x54,0xb0,0xff,0x00,0x0b,0x2a,0xac,0xff,0x00,0x2a,0xd5,0x56,0x8b,0xff,0x00,0x30,0xaa,0xaa,0x8b,0xff,0x00,0x32,0xaa,0xac,0xff,0xff,0xf0,0x2a,0xac,0xff,0x00,0x27,0x2a,0xa8,0xff,0xff,0xe0,0x55,0x54,0xff,0x00,0x1b,0xaa,0xac,0x08,0x3e,0xff,0xff,0x01,0x80,0x00,0x15,0xff,0xff,0xde,0x55,0x56,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xd2,0xd5,0x54,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xc7,0x55,0x56,0x8b,0x08,0xfb,0x3a,0x8b,0xc5,0xf7,0xa6,0xf7,0x3d,0x8b,0x05,0xff,0x00,0x53,0x55,0x56,0xff,0x00,0x29,0xaa,0xaa,0xff,0xff,0xdd,0xaa,0xac,0xff,0xff,0xbb,0x55,0x54,0x1f,0x8b,0xff,0xff,0xc8,0xaa,0xc6,0xff,0xff,0xef,0x2a,0xaa,0xff,0xff,0xd5,0xaa,0xaa,0xff,0xff,0xde,0x55,0x56,0xff,0xff,0xe2,0xaa,0x90,0x08,0x0e,0xda,0xf8,0xac,0xff,0x02,0x8e,0x80,0x00,0x15,0xff,0xff,0xdb,0x55,0x56,0xff,0x00,0x1d,0xaa,0xac,0x5a,0xff,0x00,0x0e,0xd5,0x54,0xff,0xff,0xc2,0xaa,0xaa,0x8b,0xfb,0x2c,0x8b,0xff,0xff,0xa1,0x55,0x55,0x33,0xff,0xff,0xda,0xaa,0xab,0xfb,0x44,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0x70,0x8b,0x73,0x8b,0xff,0xff,0xc1,0x55,0x55,0xff,0x00,0x12,0x55,0x55,0xff,0xff,0xd1,0xd5,0x55,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xe2,0x55,0x56,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x31,0xaa,0xaa,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x3e,0xaa,0xab,0x8b,0xff,0x00,0x12,0xaa,0xaa,0x8b,0xff,0x00,0x14,0x55,0x56,0xff,0x00,0x01,0xaa,0xab,0xa1,0xff,0x00,0x03,0x55,0x55,0x08,0xbc,0xfb,0x28,0xcb,0xab,0x5d,0xf7,0x1f,0x05,0xff,0x00,0x4d,0x55,0x56,0xff,0x00,0x26,0xaa,0xaa,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x4e,0xaa,0xab,0xff,0x00,0x19,0x55,0x54,0xff,0x00,0x76,0xaa,0xab,0x08,0xb1,0xf7,0x47,0x05,0x91,0xa9,0x8e,0xa6,0x8b,0xa3,0x8b,0xff,0x00,0x3e,0xaa,0xac,0xff,0xff,0xed,0xaa,0xac,0xff,0x00,0x2e,0x2a,0xa8,0xff,0xff,0xdb,0x55,0x54,0xff,0x00,0x1d,0xaa,0xac,0x08,0x78,0xff,0xff,0x68,0x80,0x00,0x15,0x8b,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x54,0xff,0xff,0xe8,0x55,0x56,0xff,0xff,0xfa,0xaa,0xac,0x73,0x08,0x64,0xfb,0x48,0x05,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xbc,0xaa,0xad,0xff,0xff,0xe8,0x55,0x54,0x5a,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe1,0x55,0x53,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0xff,0xd5,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x57,0x8b,0x2d,0x8b,0x5c,0xff,0x00,0x2a,0x55,0x55,0x8b,0xff,0x00,0x54,0xaa,0xab,0x8b,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x02,0xaa,0xab,0xa1,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x19,0x55,0x55,0x08,0xb2,0xf7,0x48,0x05,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x47,0x55,0x56,0xa3,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x20,0xaa,0xab,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x20,0xaa,0xaa,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x0f,0xaa,0xac,0xc1,0x8b,0xff,0x00,0x5b,0x55,0x56,0x8b,0xff,0x00,0x2d,0xaa,0xaa,0xff,0xff,0xd4,0xaa,0xac,0x8b,0xff,0xff,0xa9,0x55,0x54,0x08,0x0e,0xd0,0xff,0x02,0x25,0x80,0x00,0xf8,0x1b,0x15,0xae,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x11,0x80,0x00,0xff,0x00,0x31,0xaa,0xaa,0x8b,0xc5,0x8b,0xbb,0xff,0xff,0xf0,0x80,0x00,0xb0,0x6c,0xa5,0x6c,0xa5,0xff,0xff,0xd5,0x2a,0xaa,0x98,0xff,0xff,0xc9,0x55,0x56,0x8b,0x08,0xfb,0x92,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xcc,0xf7,0xc3,0xf7,0x3a,0x8b,0xe7,0xfb,0xc3,0xde,0x8b,0x28,0xf7,0xca,0x05,0xff,0x00,0x3c,0xaa,0xaa,0xff,0x00,0x0c,0xaa,0xaa,0xff,0x00,0x2f,0xd5,0x56,0xa6,0xae,0xff,0x00,0x29,0x55,0x56,0x08,0x43,0x9d,0x15,0x6a,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xd5,0x80,0x00,0xff,0xff,0xf1,0xaa,0xaa,0x57,0x8b,0x08,0xfb,0x41,0x8b,0xc2,0xf7,0x96,0xf7,0x46,0x8b,0x05,0xb1,0x8b,0xa8,0xff,0xff,0xf7,0xd5,0x54,0x9f,0xff,0xff,0xef,0xaa,0xac,0x9f,0xff,0xff,0xef,0xaa,0xac,0x95,0xff,0xff,0xe7,0xd5,0x54,0x8b,0x6b,0x8b,0x59,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xd8,0xaa,0xaa,0x6a,0xff,0xff,0xe3,0x55,0x56,0x08,0x0e,0x9f,0xd3,0xb0,0x15,0x2f,0x0a,0x0e,0x5c,0xf8,0xbe,0xf9,0x04,0x15,0x99,0xcd,0xfc,0x67,0x8b,0x7d,0x49,0xf7,0x59,0x8b,0xfb,0x18,0xfd,0x04,0xd3,0x8b,0xf7,0x18,0xf9,0x04,0x05,0x0e,0xf4,0xff,0x00,0x7e,0x80,0x00,0xb7,0x15,0x30,0x0a,0x0e,0x7d,0xec,0xf9,0x46,0x15,0xd8,0xfd,0x46,0xc6,0x8b,0xf8,0x08,0xf9,0x46,0x3e,0x8b,0xfb,0xbf,0xfc,0xd0,0x52,0xf8,0xd0,0x05,0x0e,0xf7,0x97,0xfa,0x02,0xf9,0x46,0x15,0x48,0x8b,0xfb,0x96,0xfc,0xd0,0x78,0xf8,0xd0,0x2f,0x8b,0xfb,0x94,0xfc,0xd0,0x78,0xf8,0xd0,0x45,0x8b,0xa8,0xfd,0x46,0xcc,0x8b,0xf7,0xa9,0xf8,0xeb,0xa5,0xfc,0xeb,0xcc,0x8b,0x05,0x0e,0xa7,0xf7,0x97,0xf7,0xfd,0x15,0xfb,0xc9,0xfb,0xfd,0xe1,0x8b,0xf7,0x91,0xf7,0xc3,0xf7,0x10,0xfb,0xc3,0xe2,0x8b,0xfb,0x30,0xf7,0xfc,0xf7,0xaf,0xf7,0xde,0x36,0x8b,0xfb,0x78,0xfb,0xa4,0xfb,0x05,0xf7,0xa4,0x35,0x8b,0x05,0x0e,0x65,0xf7,0xb6,0xf7,0xb4,0x15,0x31,0x0a,0x0e,0x82,0xf8,0xc0,0xf9,0x04,0x15,0x32,0x0a,0x0e,0xfb,0x7f,0xf7,0x4b,0xf9,0x78,0x15,0xfb,0x43,0xfd,0xcc,0xf7,0x30,0x8b,0x99,0xcd,0x39,0x8b,0xf7,0x27,0xf9,0x48,0xdd,0x8b,0x99,0xcd,0x05,0x0e,0xfb,0x1e,0xf7,0x2c,0xf9,0x46,0x15,0xcc,0xfd,0x50,0xc7,0x8b,0x4a,0xf9,0x50,0x05,0x0e,0xfb,0x7f,0x8d,0x79,0x15,0x7c,0x49,0xf7,0x30,0x8b,0xf7,0x43,0xf9,0xcc,0xfb,0x30,0x8b,0x7e,0x49,0xdd,0x8b,0xfb,0x27,0xfd,0x48,0x05,0x0e,0xf7,0x7d,0xf9,0x46,0x15,0xfb,0x41,0xfc,0x29,0xc7,0x8b,0xf7,0x23,0xf7,0xe9,0xf7,0x23,0xfb,0xe9,0xc6,0x8b,0xfb,0x40,0xf8,0x29,0x05,0x0e,0x42,0x4a,0x55,0x15,0x80,0x59,0xf8,0x5e,0x8b,0x95,0xbd,0x05,0x0e,0x60,0xf7,0x88,0xf9,0x4d,0x15,0x33,0x0a,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0x0e,0x77,0xf7,0x2a,0xff,0x00,0x0c,0x80,0x00,0x15,0xff,0x00,0x15,0x55,0x55,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x1a,0xaa,0xab,0xff,0xff,0xf9,0xd5,0x55,0xab,0x8b,0xff,0x00,0x31,0x55,0x56,0x8b,0xff,0x00,0x2b,0xaa,0xaa,0xff,0x00,0x10,0x80,0x00,0xb1,0xac,0xb1,0xac,0xff,0x00,0x1a,0x55,0x56,0xff,0x00,0x34,0x80,0x00,0xff,0x00,0x0e,0xaa,0xaa,0xd3,0x08,0xa1,0xf4,0x05,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x02,0x55,0x56,0xa1,0x8b,0xff,0x00,0x15,0x55,0x56,0x8b,0xff,0x00,0x30,0xaa,0xaa,0x7e,0xff,0x00,0x23,0xd5,0x56,0x71,0xa2,0x71,0xa2,0xff,0xff,0xdd,0x55,0x56,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xd4,0xaa,0xaa,0x8b,0xff,0xff,0xc5,0x55,0x56,0x8b,0xff,0xff,0xcf,0xff,0xff,0x71,0xff,0xff,0xda,0xaa,0xab,0x57,0x08,0xc1,0xf7,0x92,0x47,0x8b,0xfb,0x27,0xfd,0x46,0xcf,0x8b,0x99,0xce,0x05,0xff,0x00,0x09,0xff,0xfc,0x73,0xff,0x00,0x0f,0xaa,0xab,0xff,0xff,0xed,0xd5,0x55,0xff,0x00,0x15,0x55,0x59,0xff,0xff,0xf3,0xaa,0xab,0x08,0xff,0x00,0xa7,0x80,0x00,0xd8,0x15,0xff,0xff,0xe7,0xaa,0xce,0x74,0xff,0xff,0xe3,0x2a,0xaa,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xde,0xaa,0x88,0x8b,0x69,0x8b,0xff,0xff,0xe6,0x55,0x55,0xff,0x00,0x09,0x80,0x00,0xff,0xff,0xee,0xaa,0xab,0x9e,0xff,0xff,0xee,0xaa,0xab,0x9e,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x19,0xd5,0x55,0x8b,0xff,0x00,0x20,0xaa,0xab,0x8b,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x01,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x03,0x55,0x56,0x9d,0x08,0x9e,0xe3,0x05,0xff,0x00,0x0a,0xaa,0xab,0xbb,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x26,0x2a,0xaa,0xa5,0xff,0x00,0x1c,0x55,0x56,0xa5,0xff,0x00,0x1c,0x55,0x56,0xac,0xff,0x00,0x0e,0x2a,0xaa,0xb3,0x8b,0xc9,0x8b,0xaa,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0xff,0xff,0xc1,0x55,0x56,0x8b,0xff,0xff,0xeb,0x55,0x56,0x89,0xff,0xff,0xed,0x55,0x54,0x87,0xff,0xff,0xef,0x55,0x56,0x08,0x76,0x2b,0x05,0x7f,0xff,0xff,0xc9,0x55,0x55,0xff,0xff,0xed,0xd5,0x56,0xff,0xff,0xd9,0x2a,0xab,0xff,0xff,0xe7,0xaa,0xaa,0x74,0x08,0x0e,0x71,0xe4,0xa9,0x15,0xff,0x00,0x1f,0x55,0x56,0x73,0xff,0x00,0x29,0xff,0xff,0x7f,0xff,0x00,0x34,0xaa,0xab,0x8b,0xff,0x00,0x3a,0xaa,0xaa,0x8b,0xbb,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x25,0x55,0x56,0xaa,0xff,0x00,0x25,0x55,0x56,0xaa,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x2a,0x2a,0xaa,0x91,0xff,0x00,0x35,0x55,0x56,0x08,0x4a,0x06,0x85,0x67,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xe0,0x55,0x56,0xff,0xff,0xf6,0x55,0x56,0x63,0xff,0xff,0xff,0xff,0xfe,0x69,0x8b,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x07,0x55,0x55,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xab,0xff,0xff,0xec,0xaa,0xaa,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x19,0xaa,0xab,0x8b,0xff,0x00,0x24,0xaa,0xab,0x8b,0x9d,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0x08,0x9e,0xe5,0x05,0x97,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x1b,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1b,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x22,0x55,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x29,0x55,0x56,0x8b,0xff,0x00,0x21,0x55,0x56,0x8b,0xff,0x00,0x18,0xd5,0x54,0xff,0xff,0xf8,0x2a,0xaa,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x08,0x2a,0xaa,0xff,0xff,0xe8,0x2a,0xaa,0x8b,0x6b,0x08,0x8a,0x7a,0xcd,0x8b,0x05,0xff,0x00,0x00,0xaa,0xaa,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x00,0x55,0x56,0xff,0x00,0x08,0x55,0x54,0x8b,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x30,0xaa,0xaa,0xff,0xff,0xf2,0x55,0x56,0xb0,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x19,0x55,0x56,0x63,0xff,0x00,0x0c,0xaa,0xaa,0xff,0xff,0xcb,0x55,0x56,0x8b,0xff,0xff,0x82,0xaa,0xa9,0xff,0x00,0x00,0x00,0x10,0xff,0xff,0xb2,0x55,0x55,0xff,0xff,0xba,0xaa,0xaa,0xff,0xff,0xe2,0x00,0x02,0xff,0xff,0x75,0x55,0x46,0x08,0x76,0x29,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xea,0xaa,0xab,0x8b,0x77,0x8b,0x57,0xff,0x00,0x0f,0xaa,0xaa,0x65,0xff,0x00,0x1f,0x55,0x56,0x73,0x08,0x0e,0x78,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x21,0x2a,0xab,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x28,0xaa,0xab,0x8b,0xcb,0x8b,0xbd,0xff,0x00,0x18,0x55,0x55,0xaf,0xff,0x00,0x30,0xaa,0xab,0x08,0x7c,0x48,0xd0,0x8b,0xf7,0x26,0xf9,0x46,0x46,0x8b,0x56,0xfb,0x92,0x05,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x33,0x55,0x56,0x62,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xc3,0x55,0x56,0x8b,0xff,0xff,0xcd,0x55,0x55,0x8b,0xff,0xff,0xd3,0xaa,0xab,0xff,0xff,0xef,0x55,0x56,0x65,0xff,0xff,0xde,0xaa,0xaa,0x65,0xff,0xff,0xde,0xaa,0xc4,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xcb,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xb8,0xaa,0x92,0x08,0x75,0x23,0x05,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe5,0x55,0x60,0xff,0xff,0xfd,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0x8b,0xff,0xff,0xed,0x55,0x4b,0x8b,0x5b,0xff,0x00,0x0c,0xd5,0x55,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xab,0xff,0xff,0xe9,0x55,0x56,0x08,0xf7,0x75,0xd0,0x15,0xff,0xff,0xe5,0xaa,0xaa,0x6f,0xff,0xff,0xde,0x2a,0xab,0x7d,0xff,0xff,0xd6,0xaa,0xab,0x8b,0xff,0xff,0xc3,0x55,0x59,0x8b,0xff,0xff,0xe1,0xaa,0xab,0xff,0x00,0x1f,0xaa,0xaa,0xff,0xff,0xff,0xff,0xfc,0xff,0x00,0x3f,0x55,0x56,0x8b,0xff,0x00,0x14,0xaa,0xab,0x8d,0xff,0x00,0x12,0xaa,0xaa,0x8f,0xff,0x00,0x10,0xaa,0xab,0x08,0xa0,0xea,0x05,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x64,0xaa,0xaa,0xff,0x00,0x30,0xaa,0xab,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x4a,0xaa,0xaa,0x8b,0xff,0x00,0x20,0xaa,0xaa,0x8b,0xff,0x00,0x18,0x55,0x56,0xff,0xff,0xf6,0xaa,0xaa,0x9b,0xff,0xff,0xed,0x55,0x56,0x9b,0xff,0xff,0xed,0x55,0x56,0x93,0x71,0x8b,0xff,0xff,0xde,0xaa,0xaa,0x8b,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xfe,0x55,0x56,0x7a,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x08,0x78,0x33,0x05,0xff,0xff,0xf6,0xaa,0xd6,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xee,0x2a,0xaa,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xe5,0xaa,0x80,0x6f,0x08,0x0e,0x71,0xf8,0x36,0xff,0x01,0xdd,0x80,0x00,0x15,0x36,0x0a,0x73,0xff,0xff,0x8b,0x80,0x00,0x15,0x37,0x0a,0x0e,0xfb,0x5e,0xf7,0x8e,0xf8,0xcb,0x15,0x38,0x0a,0x0e,0x78,0xff,0x00,0x31,0x80,0x00,0xff,0xff,0x85,0x80,0x00,0x15,0xa6,0xff,0xff,0xe8,0x55,0x55,0xff,0x00,0x27,0xd5,0x55,0xff,0xff,0xf4,0x2a,0xab,0xff,0x00,0x34,0xaa,0xab,0x8b,0xff,0x00,0x3a,0xaa,0xab,0x8b,0xff,0x00,0x30,0x2a,0xab,0xff,0x00,0x11,0x80,0x00,0xff,0x00,0x25,0xaa,0xaa,0xae,0xff,0x00,0x25,0xaa,0xaa,0xae,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x30,0x80,0x00,0xff,0x00,0x0d,0x55,0x56,0xc9,0x08,0xf0,0xf8,0x6b,0x47,0x8b,0x7c,0x44,0x05,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xf0,0x80,0x00,0x9e,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xe5,0x80,0x00,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0x59,0x8b,0xff,0xff,0xd4,0x2a,0xab,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xda,0x55,0x55,0x6a,0xff,0xff,0xda,0x55,0x57,0x6a,0xff,0xff,0xe5,0x80,0x00,0xff,0xff,0xcb,0x80,0x00,0xff,0xff,0xf0,0xaa,0xa9,0x43,0x08,0x7c,0x45,0x05,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe5,0x55,0x55,0xff,0xff,0xfd,0x55,0x55,0xff,0xff,0xe9,0xaa,0xab,0x8b,0x79,0x8b,0xff,0xff,0xcf,0x55,0x57,0x98,0xff,0xff,0xdc,0x2a,0xab,0xa5,0xff,0xff,0xe8,0xff,0xfe,0xa5,0x74,0xff,0x00,0x21,0x55,0x55,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x28,0xaa,0xab,0x8b,0xff,0x00,0x40,0xaa,0x99,0x8b,0xff,0x00,0x31,0xaa,0xab,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x22,0xaa,0xbc,0xff,0x00,0x31,0x55,0x55,0x08,0x7c,0x44,0x05,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xa7,0x55,0x56,0xff,0xff,0xcf,0x55,0x54,0xff,0xff,0xd3,0xaa,0xaa,0xff,0xff,0xb1,0x55,0x56,0x8b,0xff,0xff,0xc0,0xaa,0xab,0xff,0x00,0x00,0x00,0x03,0xff,0xff,0xdf,0x55,0x55,0xff,0x00,0x18,0xaa,0xab,0x89,0xff,0x00,0x31,0x55,0x52,0x08,0x47,0x06,0x8b,0xff,0xff,0xd6,0xaa,0xab,0xff,0x00,0x0d,0x80,0x00,0xff,0xff,0xdf,0x7f,0xff,0xa6,0xff,0xff,0xe8,0x55,0x56,0x08,0xff,0x01,0x05,0x80,0x00,0xf7,0x95,0x15,0x71,0xff,0xff,0xe4,0x55,0x56,0x69,0xff,0xff,0xf2,0x2a,0xaa,0x61,0x8b,0x4f,0x8b,0x6d,0xff,0x00,0x1f,0x55,0x55,0x8b,0xff,0x00,0x3e,0xaa,0xab,0x8b,0x9f,0x8d,0xff,0x00,0x12,0x55,0x55,0x8f,0xff,0x00,0x10,0xaa,0xab,0x08,0x99,0xca,0x05,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x12,0xd5,0x55,0xb2,0xa4,0xff,0x00,0x16,0xaa,0xaa,0xa4,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x1d,0x80,0x00,0xff,0x00,0x0b,0x55,0x56,0xad,0x8b,0xff,0x00,0x20,0xaa,0x82,0x8b,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x10,0xaa,0xd4,0x78,0xff,0x00,0x10,0xaa,0xaa,0x78,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xe6,0x2a,0xaa,0x8b,0xff,0xff,0xdf,0x55,0x56,0x8b,0xff,0xff,0xf0,0xaa,0xaa,0x89,0xff,0xff,0xef,0x55,0x56,0x87,0x79,0x08,0x7f,0x54,0x05,0x81,0x5d,0x79,0xff,0xff,0xdb,0x2a,0xab,0x71,0xff,0xff,0xe4,0x55,0x55,0x08,0x0e,0x83,0xf7,0x3c,0xf9,0x46,0x15,0xfb,0x27,0xfd,0x46,0xcf,0x8b,0xd0,0xf7,0xd7,0x05,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x11,0x2a,0xaa,0xff,0x00,0x1f,0xd5,0x54,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1f,0x2a,0xab,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xa9,0x8b,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0x7c,0xff,0x00,0x10,0xaa,0xaa,0x7c,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xea,0x2a,0xaa,0x8b,0xff,0xff,0xe3,0x55,0x56,0x8b,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf2,0x55,0x54,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0x08,0x47,0xfb,0xd7,0xcf,0x8b,0xd2,0xf7,0xe1,0x05,0x8f,0x9d,0x8d,0x9c,0x8b,0x9b,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0xff,0xf3,0xaa,0xaa,0xff,0x00,0x1f,0xd5,0x54,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xdd,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0x5f,0x8b,0xff,0xff,0xc3,0x55,0x56,0x8b,0xff,0xff,0xcf,0x55,0x55,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xd2,0xaa,0xaa,0x08,0xbf,0xf7,0x89,0x05,0x0e,0xfb,0xcc,0xf7,0x15,0xf8,0x8f,0x15,0x39,0x0a,0x6a,0xf7,0x41,0x15,0x3a,0x0a,0x0e,0xfb,0xba,0xf7,0x42,0xf9,0x46,0x15,0x3a,0x0a,0xfb,0xe8,0xfd,0xa0,0x15,0x7e,0x4d,0xbb,0x8b,0x05,0xff,0x00,0x28,0xaa,0xab,0x8b,0xff,0x00,0x21,0x55,0x55,0xff,0x00,0x0b,0x55,0x55,0xa5,0xff,0x00,0x16,0xaa,0xab,0xa5,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x11,0xaa,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x2b,0x55,0x56,0x08,0xf7,0x04,0xf8,0xa2,0x47,0x8b,0xfb,0x03,0xfc,0x9e,0x05,0xff,0xff,0xfa,0xaa,0xab,0x71,0x82,0x78,0xff,0xff,0xf3,0x55,0x55,0x7f,0xff,0xff,0xf3,0x55,0x55,0x7f,0xff,0xff,0xee,0x55,0x56,0x85,0xff,0xff,0xe9,0x55,0x55,0x8b,0x08,0x0e,0x62,0xf7,0xb8,0xf7,0xcb,0x15,0xf7,0x64,0xf7,0x58,0x35,0x8b,0xfb,0xa4,0xfb,0x97,0xe9,0xf8,0x4e,0x47,0x8b,0xfb,0x27,0xfd,0x46,0xcf,0x8b,0xab,0xf7,0x2a,0xf7,0x0b,0xf7,0x04,0xf0,0xfb,0x9a,0xd6,0x8b,0x05,0x0e,0xfb,0x95,0xd1,0xa2,0x15,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf0,0xaa,0xab,0xff,0x00,0x19,0x55,0x55,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x21,0x55,0x55,0x8b,0x08,0xbb,0x8b,0x98,0xc9,0x62,0x8b,0x05,0xff,0xff,0xee,0xaa,0xab,0x8b,0xff,0xff,0xf3,0x2a,0xaa,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf7,0xaa,0xab,0x92,0xff,0xff,0xf7,0xaa,0xaa,0x92,0xff,0xff,0xfb,0xd5,0x56,0xff,0x00,0x0b,0x2a,0xaa,0x8b,0xff,0x00,0x0f,0x55,0x56,0x8b,0x95,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0x08,0xf7,0x09,0xf8,0xbd,0x47,0x8b,0xfb,0x0b,0xfc,0xc1,0x05,0xff,0xff,0xfc,0xaa,0xab,0x79,0xff,0xff,0xfe,0x55,0x55,0xff,0xff,0xf1,0xaa,0xaa,0x8b,0xff,0xff,0xf5,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xab,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf0,0xaa,0xab,0x08,0x0e,0xf7,0xbc,0xf7,0x15,0xf8,0x8f,0x15,0x20,0xfc,0x8f,0xcf,0x8b,0xd0,0xf7,0xd7,0x05,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x11,0x2a,0xaa,0xff,0x00,0x1f,0xd5,0x54,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1f,0x2a,0xab,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xa9,0x8b,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0x7c,0xff,0x00,0x10,0xaa,0xaa,0x7c,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xe9,0xd5,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0xff,0xff,0xf4,0xaa,0xd6,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0x80,0x08,0x46,0xfb,0xd7,0xd0,0x8b,0xd0,0xf7,0xda,0x05,0xff,0x00,0x08,0xaa,0xaa,0xff,0x00,0x27,0x55,0x56,0x9c,0xff,0x00,0x1e,0xd5,0x54,0xff,0x00,0x19,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x19,0x55,0x10,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x25,0x55,0x9c,0x8b,0xa9,0x8b,0xff,0x00,0x17,0x55,0x54,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x10,0xaa,0xac,0x7c,0xff,0x00,0x10,0xaa,0xac,0x7c,0xff,0x00,0x08,0x55,0x54,0xff,0xff,0xe9,0xd5,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0x81,0xff,0xff,0xfe,0x55,0x54,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0xff,0xef,0x55,0x56,0x08,0x46,0xfb,0xd7,0xcf,0x8b,0xd2,0xf7,0xe1,0x05,0x8f,0x9d,0x8d,0x9c,0x8b,0x9b,0x8b,0xff,0x00,0x28,0xaa,0x90,0xff,0xff,0xf3,0x80,0x00,0xff,0x00,0x1f,0xaa,0xaa,0x72,0xff,0x00,0x16,0xaa,0xc6,0x72,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xdc,0xd5,0x54,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xd2,0xaa,0xac,0x8b,0xff,0xff,0xba,0xaa,0xac,0x8b,0xff,0xff,0xc7,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xd4,0xaa,0xaa,0xff,0xff,0xc7,0x55,0x56,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xf1,0x55,0x54,0xa0,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0x6e,0xff,0x00,0x07,0x55,0x56,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0x08,0xff,0xff,0xe2,0xaa,0xb4,0x8b,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0xfa,0x2a,0xaa,0xff,0xff,0xe6,0xaa,0xa2,0xff,0xff,0xf4,0x55,0x56,0xff,0xff,0xe6,0xaa,0xab,0xff,0xff,0xf4,0x55,0x56,0x75,0xff,0xff,0xef,0x2a,0xaa,0xff,0xff,0xed,0x55,0x55,0x75,0x08,0x99,0xc9,0x05,0x0e,0x84,0xf7,0x15,0xf8,0x8f,0x15,0x3b,0x0a,0x0e,0x72,0xe0,0xff,0x00,0x1c,0x80,0x00,0x15,0x3c,0x0a,0xff,0x00,0xe1,0x80,0x00,0xc7,0x15,0x3d,0x0a,0x0e,0xf7,0x15,0xf8,0x8f,0x15,0xfb,0x1f,0xfd,0x27,0xcf,0x8b,0xba,0xf7,0x73,0x05,0xff,0x00,0x17,0x55,0x55,0xff,0xff,0xcc,0xaa,0xab,0xb5,0xff,0xff,0xe6,0x55,0x55,0xff,0x00,0x3c,0xaa,0xab,0x8b,0xff,0x00,0x31,0x55,0x56,0x8b,0xff,0x00,0x2b,0x80,0x00,0xff,0x00,0x10,0x2a,0xaa,0xff,0x00,0x25,0xaa,0xaa,0xff,0x00,0x20,0x55,0x56,0xff,0x00,0x25,0xaa,0xaa,0xff,0x00,0x20,0x55,0x54,0xff,0x00,0x1a,0x80,0x00,0xff,0x00,0x33,0x80,0x00,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x46,0xaa,0xac,0x08,0xa2,0xf7,0x01,0x05,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x16,0xaa,0x80,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x15,0xaa,0xaa,0x8b,0xff,0x00,0x14,0xaa,0xd6,0x8b,0xbb,0xff,0xff,0xf3,0x2a,0xaa,0xff,0x00,0x23,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xdd,0xd5,0x54,0xff,0x00,0x0b,0xaa,0xaa,0xff,0xff,0xd5,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0xff,0xff,0xe4,0xd5,0x56,0xff,0xff,0xf9,0x80,0x00,0x72,0x7e,0x72,0x7e,0xff,0xff,0xea,0x2a,0xab,0xff,0xff,0xec,0xd5,0x56,0xff,0xff,0xed,0x55,0x55,0xff,0xff,0xe6,0xaa,0xaa,0x08,0x9a,0xd2,0x05,0xf7,0x44,0xfb,0xc2,0x15,0xff,0xff,0xeb,0x55,0x56,0x27,0xff,0xff,0xd0,0x55,0x54,0x59,0xff,0xff,0xb5,0x55,0x56,0x8b,0x69,0x8b,0xff,0xff,0xe6,0x80,0x00,0xff,0x00,0x09,0x80,0x00,0x7a,0x9e,0x7a,0xff,0x00,0x12,0xff,0xfe,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x1a,0x2a,0xab,0x8b,0xff,0x00,0x21,0x55,0x57,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8d,0xff,0x00,0x10,0xaa,0xab,0x8f,0x9d,0x08,0x9d,0xdf,0x05,0x95,0xff,0x00,0x2f,0x55,0x56,0xff,0x00,0x12,0x2a,0xab,0xff,0x00,0x25,0xd5,0x54,0xff,0x00,0x1a,0x55,0x55,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x1a,0x55,0x46,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x21,0x80,0x00,0xff,0x00,0x0e,0x2a,0xaa,0xff,0x00,0x28,0xaa,0xba,0x8b,0xff,0x00,0x1b,0x55,0x56,0x8b,0xff,0x00,0x16,0x2a,0xaa,0xff,0xff,0xf8,0x80,0x00,0x9c,0x7c,0x9c,0x7c,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xe7,0x2a,0xaa,0x8b,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x56,0x89,0x79,0x87,0xff,0xff,0xea,0xaa,0xaa,0x08,0x0e,0x77,0xf7,0xdc,0xce,0x15,0x5c,0xfb,0x6f,0xcf,0x8b,0xf7,0x20,0xf9,0x27,0x47,0x8b,0x7c,0x44,0x05,0xff,0xff,0xec,0xaa,0xaa,0xff,0x00,0x33,0x55,0x56,0x62,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xc1,0x55,0x56,0x8b,0x59,0x8b,0xff,0xff,0xd3,0xd5,0x55,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xd9,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xd9,0xaa,0xab,0xff,0xff,0xde,0xaa,0xc4,0xff,0xff,0xe5,0x2a,0xab,0xff,0xff,0xcb,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xb8,0xaa,0x92,0x08,0x75,0x23,0x05,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe5,0x55,0x60,0xff,0xff,0xfd,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0x8b,0xff,0xff,0xed,0x55,0x4b,0x8b,0x5b,0xff,0x00,0x0c,0xd5,0x55,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xab,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x21,0x2a,0xab,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x28,0xaa,0xab,0x8b,0xcb,0x8b,0xbd,0xff,0x00,0x18,0x55,0x55,0xaf,0xff,0x00,0x30,0xaa,0xab,0x08,0xff,0xff,0xe7,0x80,0x00,0xa9,0x15,0xff,0xff,0xe5,0xaa,0xaa,0x6f,0xff,0xff,0xdd,0xd5,0x55,0x7d,0xff,0xff,0xd6,0x00,0x01,0x8b,0x4f,0x8b,0x6d,0xff,0x00,0x1f,0xaa,0xaa,0x8b,0xff,0x00,0x3f,0x55,0x56,0x8b,0xff,0x00,0x14,0xaa,0xab,0x8d,0xff,0x00,0x12,0xaa,0xaa,0x8f,0xff,0x00,0x10,0xaa,0xab,0x08,0xa0,0xea,0x05,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x64,0xaa,0xaa,0xff,0x00,0x2f,0xff,0xff,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x20,0xaa,0x82,0x8b,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x10,0xaa,0xd4,0x78,0xff,0x00,0x10,0xaa,0xaa,0x78,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xe5,0xd5,0x56,0x8b,0xff,0xff,0xde,0xaa,0xaa,0x8b,0x79,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x08,0x78,0x33,0x05,0xff,0xff,0xf6,0xaa,0xd6,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xee,0x2a,0xaa,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xe5,0xaa,0x80,0x6f,0x08,0x0e,0xfb,0x54,0xf7,0x15,0xf8,0x8f,0x15,0x20,0xfc,0x8f,0xcf,0x8b,0xce,0xf7,0xce,0x05,0xff,0x00,0x08,0xaa,0xab,0xb5,0xff,0x00,0x11,0xaa,0xaa,0xff,0x00,0x21,0x55,0x56,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x1e,0xff,0xff,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x13,0x55,0x56,0x8b,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x56,0x99,0xff,0xff,0xfa,0xaa,0xaa,0x08,0x9a,0xcf,0x05,0x7f,0x8d,0xff,0xff,0xf3,0xaa,0xaa,0x8c,0xff,0xff,0xf3,0x55,0x56,0x8b,0xff,0xff,0xe3,0x55,0x56,0x8b,0xff,0xff,0xe4,0xd5,0x54,0xff,0xff,0xf9,0xd5,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xf3,0xaa,0xe6,0xff,0xff,0xe9,0x80,0x00,0xff,0xff,0xed,0x2a,0xaa,0xff,0xff,0xec,0xaa,0xab,0xff,0xff,0xe6,0xaa,0x70,0x08,0x9a,0xcf,0x05,0x0e,0x4b,0xce,0xff,0x00,0x21,0x80,0x00,0x15,0x3e,0x0a,0x0e,0xfb,0x47,0xf7,0x33,0xf7,0x15,0x15,0xd0,0xf7,0xd8,0xf7,0x07,0x8b,0x96,0xc1,0xfb,0x07,0x8b,0xab,0xf7,0x28,0x40,0x6b,0x72,0xfb,0x08,0x3c,0x8b,0x80,0x55,0xda,0x8b,0x45,0xfb,0xdb,0x05,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfe,0xaa,0xaa,0x7f,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0x6f,0xff,0x00,0x08,0xaa,0xaa,0x75,0xff,0x00,0x11,0x55,0x56,0x7b,0xff,0x00,0x11,0x55,0x55,0x7b,0xff,0x00,0x18,0xaa,0xab,0x83,0xab,0x8b,0x08,0xbe,0x8b,0x98,0xc7,0x63,0x8b,0x05,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xee,0x55,0x55,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x1e,0xaa,0xab,0x1f,0x8b,0x95,0xff,0x00,0x00,0xaa,0xab,0xff,0x00,0x07,0xaa,0xaa,0xff,0x00,0x01,0x55,0x55,0xff,0x00,0x05,0x55,0x56,0x08,0x0e,0x84,0xff,0x00,0x5f,0x80,0x00,0xa8,0x15,0x3f,0x0a,0x0e,0x30,0xcf,0xf8,0x8f,0x15,0xce,0xfc,0x8f,0xc8,0x8b,0xf7,0xaf,0xf8,0x8f,0x41,0x8b,0xfb,0x6f,0xfc,0x2b,0x5d,0xf8,0x2b,0x05,0x0e,0xf7,0x4c,0xcf,0xf8,0x8f,0x15,0xb9,0xfc,0x8f,0xc9,0x8b,0xf7,0x69,0xf8,0x2d,0xb4,0xfc,0x2d,0xc9,0x8b,0xf7,0x9a,0xf8,0x8f,0x42,0x8b,0xfb,0x5d,0xfc,0x2a,0x64,0xf8,0x2a,0x4d,0x8b,0xfb,0x67,0xfc,0x2a,0x6f,0xf8,0x2a,0x05,0x0e,0x21,0xf7,0x8f,0xf7,0x9c,0x15,0xf7,0x60,0xf7,0x87,0x3e,0x8b,0xfb,0x29,0xfb,0x51,0x40,0xf7,0x51,0x43,0x8b,0xed,0xfb,0x88,0xfb,0x6f,0xfb,0x9b,0xd9,0x8b,0xf7,0x38,0xf7,0x62,0xdd,0xfb,0x62,0xd1,0x8b,0x05,0x0e,0x31,0xf8,0x74,0xf8,0x8f,0x15,0x40,0x0a,0x0e,0x42,0xf8,0x4a,0xf8,0x50,0x15,0x41,0x0a,0x0e,0xfb,0x52,0xd7,0x7f,0x15,0xff,0xff,0xff,0xff,0xfe,0x5b,0xff,0x00,0x1b,0xaa,0xaa,0x73,0xff,0x00,0x37,0x55,0x58,0x8b,0x08,0xbd,0x8b,0x97,0xc8,0x68,0x8b,0x05,0xff,0xff,0xe7,0x55,0x55,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xab,0xff,0x00,0x15,0x55,0x55,0x1f,0x8b,0xff,0x00,0x07,0x55,0x55,0xff,0x00,0x00,0xaa,0xab,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x01,0x55,0x55,0xff,0x00,0x05,0x55,0x55,0x08,0xb2,0xf7,0x4c,0x05,0xff,0x00,0x04,0xaa,0xab,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x02,0x55,0x55,0xff,0x00,0x12,0xaa,0xab,0x8b,0x9b,0x8b,0xff,0x00,0x10,0xaa,0x62,0xff,0xff,0xfc,0xaa,0xab,0xff,0x00,0x0d,0x2a,0xaa,0xff,0xff,0xf9,0x55,0x55,0xff,0x00,0x09,0xaa,0xf4,0xff,0xff,0xf9,0x55,0x5b,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xf5,0x55,0x55,0xff,0x00,0x07,0x80,0x00,0xff,0xff,0xf1,0x55,0x50,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x18,0xaa,0xab,0x93,0xff,0x00,0x12,0x80,0x00,0xff,0x00,0x0c,0x80,0x00,0xff,0x00,0x0c,0x55,0x55,0x9c,0xff,0x00,0x0c,0x55,0x55,0x9c,0xff,0x00,0x0a,0x2a,0xab,0xff,0x00,0x1b,0x2a,0xaa,0x93,0xff,0x00,0x25,0x55,0x56,0x08,0xb1,0xf7,0x47,0x05,0x8f,0x9d,0xff,0x00,0x06,0x80,0x00,0x98,0x94,0x93,0x94,0x93,0xff,0x00,0x0c,0x2a,0xaa,0x8f,0xff,0x00,0x0f,0x55,0x56,0x8b,0x08,0xaf,0x8b,0x98,0xc8,0x59,0x8b,0x05,0xff,0xff,0xbb,0x55,0x56,0x8b,0xff,0xff,0xd5,0xff,0xff,0xff,0xff,0xdb,0x55,0x54,0xff,0xff,0xf0,0xaa,0xab,0xff,0xff,0xb6,0xaa,0xac,0x08,0x64,0xfb,0x4e,0x05,0x85,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xf6,0x55,0x55,0xff,0xff,0xeb,0x80,0x00,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xae,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xab,0xff,0xff,0xf9,0x80,0x00,0xff,0xff,0xe6,0xaa,0xa7,0xff,0xff,0xff,0x55,0x56,0x08,0x7d,0x4a,0x05,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xff,0x55,0x56,0xff,0x00,0x0e,0x2a,0xaa,0x87,0x94,0xff,0xff,0xf8,0xaa,0xaa,0x94,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x04,0x80,0x00,0x7f,0x8b,0xff,0xff,0xef,0x55,0x56,0x8b,0xff,0xff,0xf5,0x55,0x55,0xff,0xff,0xfe,0xaa,0xaa,0x80,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0x08,0x63,0xfb,0x53,0x05,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf3,0x55,0x55,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xf3,0x55,0x56,0x8b,0xff,0xff,0xf3,0x55,0x55,0x08,0x0e,0x57,0xf7,0x71,0xf9,0x78,0x15,0xfd,0xcb,0xce,0xf9,0xcb,0x07,0x0e,0x44,0xc6,0x74,0x15,0x7e,0x4e,0xbd,0x8b,0x05,0xff,0x00,0x44,0xaa,0xa5,0x8b,0xb5,0xff,0x00,0x24,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x5b,0xff,0x00,0x49,0x55,0x56,0x08,0xb3,0xf7,0x53,0x05,0x91,0xff,0x00,0x1c,0xaa,0xab,0xff,0x00,0x09,0xd5,0x56,0xff,0x00,0x14,0x7f,0xff,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x0d,0xaa,0x84,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x13,0x2a,0xaa,0xff,0x00,0x06,0x80,0x00,0xff,0x00,0x18,0xaa,0xd2,0xff,0x00,0x00,0xaa,0xaa,0x08,0x9a,0xcc,0x05,0x77,0xff,0x00,0x00,0xaa,0xaa,0xff,0xff,0xf1,0x80,0x00,0x8f,0x82,0xff,0x00,0x07,0x55,0x56,0x82,0xff,0x00,0x07,0x55,0x56,0xff,0xff,0xfb,0x80,0x00,0x97,0x8b,0xff,0x00,0x10,0xaa,0xaa,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x01,0x55,0x56,0x96,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x56,0x08,0xb3,0xf7,0x4e,0x05,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x01,0x55,0x56,0x97,0x8b,0xff,0x00,0x0c,0xaa,0xac,0x08,0xff,0x00,0x31,0x55,0x54,0x6f,0xff,0x00,0x18,0xaa,0xac,0x53,0x1e,0x59,0x8b,0x7e,0x4e,0xaf,0x8b,0x05,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xf5,0x55,0x54,0xff,0xff,0xea,0xaa,0xac,0x1f,0x8b,0x83,0xff,0xff,0xff,0x55,0x56,0xff,0xff,0xf9,0xaa,0xac,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x54,0x08,0x65,0xfb,0x47,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xed,0x55,0x56,0x8b,0x7b,0x8b,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x03,0x2a,0xab,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x06,0x55,0x36,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x0e,0xaa,0xca,0xff,0xff,0xfa,0xaa,0xaa,0x73,0x83,0xff,0xff,0xed,0xd5,0x55,0xff,0xff,0xf3,0x80,0x00,0xff,0xff,0xf3,0xaa,0xab,0x7a,0xff,0xff,0xf3,0xaa,0xab,0x7a,0xff,0xff,0xf5,0xd5,0x55,0xff,0xff,0xe5,0x2a,0xab,0x83,0xff,0xff,0xdb,0x55,0x55,0x08,0x64,0xfb,0x4c,0x05,0x87,0x79,0xff,0xff,0xf9,0x55,0x55,0x7e,0xff,0xff,0xf6,0xaa,0xab,0x83,0xff,0xff,0xf6,0xaa,0xb2,0x83,0xff,0xff,0xf3,0xaa,0xaa,0x87,0xff,0xff,0xf0,0xaa,0xa4,0x8b,0x08,0x0e,0xff,0x01,0x24,0x80,0x00,0xf7,0x71,0x15,0xff,0x00,0x0d,0xaa,0xaa,0x85,0xff,0x00,0x0f,0x80,0x00,0x88,0xff,0x00,0x11,0x55,0x56,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x18,0x55,0x56,0x93,0xa1,0x9b,0xa1,0x9b,0xff,0x00,0x12,0x55,0x56,0xa2,0xff,0x00,0x0e,0xaa,0xaa,0xa9,0x08,0x5a,0xaa,0x05,0xff,0xff,0xf3,0x55,0x56,0x75,0xff,0xff,0xf3,0xd5,0x54,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xf4,0x55,0x56,0x82,0xff,0xff,0xf4,0x55,0x56,0x82,0xff,0xff,0xf2,0x2a,0xaa,0xff,0xff,0xfb,0x80,0x00,0x7b,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0xff,0xff,0xf5,0x80,0x00,0xff,0x00,0x02,0x55,0x56,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xf3,0x2a,0xaa,0x92,0x7b,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x0b,0x55,0x56,0x7b,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xab,0x91,0xff,0xff,0xf2,0xaa,0xab,0x91,0x7c,0x8e,0xff,0xff,0xef,0x55,0x55,0x8b,0x08,0xff,0xff,0xe5,0x55,0x55,0x8b,0xff,0xff,0xe7,0xaa,0xab,0xff,0xff,0xf8,0x2a,0xaa,0x75,0xff,0xff,0xf0,0x55,0x56,0x75,0xff,0xff,0xf0,0x55,0x56,0x79,0xff,0xff,0xe8,0xd5,0x54,0x7d,0xff,0xff,0xe1,0x55,0x56,0x08,0xbc,0x6d,0x05,0xff,0x00,0x0c,0xaa,0xa4,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x0c,0x2a,0xaa,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x0b,0xaa,0xb2,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x0b,0xaa,0xab,0xff,0x00,0x08,0xaa,0xaa,0xff,0x00,0x0d,0xd5,0x55,0xff,0x00,0x04,0x55,0x56,0x9b,0x8b,0xff,0x00,0x0b,0x55,0x55,0x8b,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xfd,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xab,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x09,0xaa,0xab,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0c,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x55,0x81,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x0d,0xaa,0xaa,0x85,0x08,0x0e,0xfb,0xcd,0x0e,0xfb,0xb7,0xf7,0x15,0xf8,0x8f,0x15,0x77,0x2d,0xe5,0x8b,0x9f,0xe9,0x05,0xfb,0x07,0xfb,0x58,0x15,0xfb,0x04,0xfc,0x63,0xdf,0x8b,0xdf,0xf8,0x63,0x05,0x0e,0x71,0xf8,0x21,0xf7,0xe8,0x15,0xcd,0x06,0xff,0x00,0x00,0xaa,0xaa,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x00,0x55,0x56,0xff,0x00,0x08,0x55,0x54,0x8b,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x2b,0x55,0x56,0xff,0xff,0xf4,0xd5,0x56,0xff,0x00,0x22,0x2a,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xa4,0xff,0xff,0xe9,0xaa,0xaa,0xa4,0xff,0xff,0xdf,0x80,0x00,0xff,0x00,0x0e,0xd5,0x56,0xff,0xff,0xd5,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0x08,0x9f,0xea,0x51,0x8b,0x77,0x2d,0x05,0xff,0xff,0x92,0xaa,0xaa,0x81,0xff,0xff,0xbb,0xaa,0xaa,0x46,0xff,0xff,0xe4,0xaa,0xac,0xfb,0x14,0x08,0x76,0x29,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xea,0xaa,0xab,0x8b,0x77,0x8b,0xff,0xff,0xd5,0x55,0x56,0x96,0xff,0xff,0xde,0xaa,0xab,0xa1,0xff,0xff,0xe7,0xff,0xff,0xa1,0x73,0xa9,0xff,0xff,0xf0,0xaa,0xab,0xb1,0xff,0xff,0xf9,0x55,0x55,0x08,0x76,0x29,0xc5,0x8b,0x9f,0xe9,0x05,0xff,0x00,0x39,0x55,0x56,0xff,0x00,0x01,0x55,0x55,0xff,0x00,0x2e,0x80,0x00,0x9b,0xff,0x00,0x23,0xaa,0xaa,0xff,0x00,0x1e,0xaa,0xab,0xff,0x00,0x23,0xaa,0xaa,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x14,0xd5,0x56,0xff,0x00,0x29,0xaa,0xab,0x91,0xff,0x00,0x34,0xaa,0xab,0x08,0x4a,0x06,0xff,0xff,0xfa,0xaa,0xaa,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xf2,0xd5,0x56,0xff,0xff,0xe5,0xd5,0x55,0x76,0x78,0x76,0x78,0xff,0xff,0xe3,0xd5,0x56,0xff,0xff,0xf5,0x2a,0xab,0xff,0xff,0xdc,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x55,0x08,0xe0,0xf8,0x1f,0x05,0xbf,0x85,0xa5,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0xff,0xff,0xc7,0x55,0x56,0x08,0xff,0xfe,0xf2,0x80,0x00,0xff,0xfe,0xf4,0x80,0x00,0x15,0xff,0xff,0xf4,0x55,0x56,0x9a,0xff,0xff,0xfa,0x2a,0xaa,0xff,0x00,0x15,0x80,0x00,0x8b,0xa7,0x8b,0x9d,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0x08,0x9e,0xe5,0x05,0x95,0xff,0x00,0x2e,0xaa,0xaa,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x22,0xd5,0x56,0xa0,0xa2,0xa0,0xa2,0xff,0x00,0x19,0xd5,0x55,0xff,0x00,0x0e,0x2a,0xaa,0xff,0x00,0x1e,0xaa,0xab,0xff,0x00,0x05,0x55,0x56,0x08,0x38,0xfc,0x1a,0x05,0xff,0xff,0xea,0xaa,0xab,0xff,0x00,0x05,0x55,0x56,0xff,0xff,0xef,0x80,0x00,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xf4,0x55,0x55,0x9a,0x08,0x0e,0x2d,0xf8,0x46,0xff,0x02,0x9f,0x80,0x00,0x15,0xff,0xff,0xea,0xaa,0xc4,0x9e,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x09,0x80,0x00,0xff,0xff,0xda,0xaa,0x92,0x8b,0x5b,0x8b,0xff,0xff,0xd7,0x55,0x56,0xff,0xff,0xf0,0xd5,0x54,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xd5,0xd5,0x54,0xff,0xff,0xf4,0xaa,0xab,0x55,0x08,0x67,0xfb,0x40,0x49,0x8b,0x7d,0x49,0xcd,0x8b,0x71,0xfb,0x11,0x05,0xff,0xff,0xfa,0xaa,0xaf,0xff,0xff,0xe5,0x55,0x59,0xff,0xff,0xf8,0x2a,0xab,0xff,0xff,0xea,0xaa,0xab,0xff,0xff,0xf5,0xaa,0xa6,0xff,0xff,0xef,0xff,0xfc,0xff,0xff,0xf5,0xaa,0xab,0x7b,0xff,0xff,0xf1,0x7f,0xff,0x7e,0xff,0xff,0xed,0x55,0x56,0x81,0x08,0x7d,0x4d,0xf7,0xf1,0x8b,0x9a,0xcf,0xfb,0x9c,0x8b,0x05,0xff,0x00,0x0e,0xaa,0xa7,0xff,0x00,0x0c,0xaa,0xaa,0xff,0x00,0x0b,0xaa,0xab,0xff,0x00,0x0e,0xd5,0x56,0xff,0x00,0x08,0xaa,0xae,0x9c,0xff,0x00,0x08,0xaa,0xab,0x9c,0x92,0xff,0x00,0x14,0x80,0x00,0xff,0x00,0x05,0x55,0x55,0xa3,0x08,0xa3,0xf7,0x08,0xf7,0x1f,0x8b,0x99,0xcd,0xfb,0x1f,0x8b,0xb2,0xf7,0x4b,0x05,0xff,0x00,0x06,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xac,0xff,0x00,0x0b,0xd5,0x55,0xff,0x00,0x17,0x2a,0xa8,0x9c,0xff,0x00,0x0f,0xaa,0xac,0x9c,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x14,0xd5,0x56,0xff,0x00,0x07,0xd5,0x54,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xff,0x00,0x13,0x55,0x56,0x8b,0x9a,0xff,0xff,0xfa,0xd5,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0x00,0x05,0x55,0x56,0xff,0xff,0xf1,0x80,0x00,0x8b,0xff,0xff,0xed,0x55,0x54,0x8b,0xff,0xff,0xf8,0xaa,0xac,0x8a,0xff,0xff,0xf7,0xaa,0xa8,0x89,0xff,0xff,0xf6,0xaa,0xac,0x08,0xd3,0x06,0xff,0x00,0x03,0x55,0x56,0xff,0x00,0x10,0xaa,0xac,0xff,0x00,0x01,0xaa,0xaa,0x99,0x8b,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x23,0x55,0x54,0xff,0xff,0xf5,0x55,0x56,0xff,0x00,0x1b,0x2a,0xac,0xff,0xff,0xea,0xaa,0xaa,0x9e,0x08,0x0e,0xde,0xf8,0x26,0xf7,0x3a,0x15,0xc3,0x44,0xc4,0xbb,0x53,0xd1,0x05,0x9f,0xff,0x00,0x15,0x55,0x46,0xff,0x00,0x0f,0xd5,0x56,0xff,0x00,0x18,0x80,0x00,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x1b,0xaa,0xba,0xff,0x00,0x0b,0xaa,0xac,0xff,0x00,0x1b,0xaa,0xaa,0xff,0x00,0x05,0xd5,0x54,0xff,0x00,0x1b,0xd5,0x56,0x8b,0xa7,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xa3,0xff,0xff,0xf4,0xaa,0xac,0xff,0x00,0x15,0x55,0x56,0x08,0xe1,0xd1,0x66,0xba,0x36,0x45,0x05,0x6d,0xff,0x00,0x17,0x55,0x54,0xff,0xff,0xdc,0x55,0x56,0xff,0x00,0x0b,0xaa,0xac,0xff,0xff,0xd6,0xaa,0xaa,0x8b,0xff,0xff,0xd5,0x55,0x56,0x8b,0xff,0xff,0xd7,0xaa,0xaa,0xff,0xff,0xf4,0x55,0x54,0x65,0xff,0xff,0xe8,0xaa,0xac,0x08,0x53,0xd1,0x52,0x5c,0xc3,0x44,0x05,0x77,0xff,0xff,0xea,0xaa,0xde,0xff,0xff,0xf0,0x2a,0xab,0xff,0xff,0xe7,0x2a,0xaa,0xff,0xff,0xf4,0x55,0x55,0xff,0xff,0xe3,0xaa,0x78,0xff,0xff,0xf4,0x55,0x56,0xff,0xff,0xe3,0xaa,0xc0,0xff,0xff,0xfa,0x2a,0xaa,0xff,0xff,0xe4,0x2a,0xaa,0x8b,0xff,0xff,0xe4,0xaa,0x96,0x8b,0x73,0xff,0x00,0x05,0x55,0x56,0xff,0xff,0xe8,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x55,0x08,0x36,0x46,0xaf,0x5b,0xe0,0xd1,0x05,0xa7,0x73,0xaf,0x7f,0xb7,0x8b,0xff,0x00,0x2b,0x55,0x56,0x8b,0xff,0x00,0x28,0x55,0x54,0x97,0xff,0x00,0x25,0x55,0x56,0xa3,0x08,0x6f,0xbb,0x15,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xab,0x70,0xff,0xff,0xf8,0x55,0x55,0xff,0xff,0xe3,0x55,0x56,0x8b,0xff,0xff,0xdf,0x55,0x56,0x8b,0xff,0xff,0xe5,0xff,0xff,0xff,0x00,0x09,0x80,0x00,0xff,0xff,0xec,0xaa,0xab,0x9e,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x12,0xff,0xf1,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x18,0xd5,0x55,0x8b,0xff,0x00,0x1e,0xaa,0xba,0x8b,0xa7,0xff,0x00,0x07,0x55,0x55,0xff,0x00,0x1b,0x2a,0xaa,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x1a,0x55,0x56,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x1a,0x55,0x56,0x9f,0xff,0x00,0x15,0x2a,0xaa,0xff,0x00,0x19,0x55,0x55,0x9b,0xff,0x00,0x19,0x55,0x56,0x9b,0xff,0x00,0x1b,0xaa,0xaa,0x93,0xa9,0x8b,0x08,0xff,0x00,0x20,0xaa,0xaa,0x8b,0xa5,0xff,0xff,0xf6,0x2a,0xaa,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xec,0x55,0x56,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xec,0x55,0x56,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xe6,0xd5,0x54,0x8b,0xff,0xff,0xe1,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xf8,0x55,0x56,0xff,0xff,0xe4,0x80,0x00,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xf0,0xaa,0xde,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xeb,0x80,0x00,0xff,0xff,0xe6,0xaa,0x78,0xff,0xff,0xf0,0xaa,0xab,0x08,0x0e,0x3f,0xf7,0x3e,0xf7,0x2f,0x15,0x6a,0xfb,0x2f,0xd4,0x8b,0xac,0xf7,0x2f,0xf7,0x21,0x8b,0x97,0xc3,0xfb,0x21,0x8b,0x99,0xce,0xf7,0x21,0x8b,0x98,0xc4,0xfb,0x0e,0x8b,0xf7,0x80,0xf7,0xf7,0x3a,0x8b,0xfb,0x60,0xfb,0xd9,0x48,0xf7,0xd9,0x39,0x8b,0x05,0xe1,0xfb,0xf7,0xfb,0x0e,0x8b,0x7f,0x52,0xf7,0x21,0x8b,0x7d,0x48,0xfb,0x22,0x8b,0x7f,0x53,0x05,0x0e,0x57,0xf7,0x71,0xf9,0x78,0x15,0xfb,0xf4,0xce,0xf7,0xf4,0x07,0x48,0xfc,0x69,0x15,0xfb,0xf6,0xce,0xf7,0xf6,0x07,0x0e,0x78,0xff,0x00,0x45,0x80,0x00,0xfb,0x1f,0x15,0xa4,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x22,0xd5,0x55,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x2c,0xaa,0xab,0x8b,0xff,0x00,0x2f,0xff,0xf9,0x8b,0xff,0x00,0x28,0x55,0x55,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x20,0xaa,0xb2,0xa6,0xff,0x00,0x20,0xaa,0xaa,0xa6,0xa0,0xff,0x00,0x24,0x80,0x00,0xff,0x00,0x09,0x55,0x56,0xb9,0xff,0x00,0x03,0x55,0x56,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x01,0xaa,0xaa,0x99,0x8b,0xff,0x00,0x0b,0x55,0x55,0x8b,0xff,0x00,0x29,0x55,0x54,0xff,0xff,0xec,0xaa,0xaa,0xaa,0xff,0xff,0xd9,0x55,0x56,0xff,0x00,0x14,0xaa,0xac,0xff,0x00,0x21,0x55,0x56,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x1c,0x55,0x54,0xff,0x00,0x13,0x80,0x00,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x1c,0x55,0x56,0x08,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x1c,0x55,0x55,0xff,0x00,0x0f,0x55,0x54,0xff,0x00,0x21,0x2a,0xab,0xff,0x00,0x07,0x55,0x56,0xb1,0x8f,0x9f,0x8d,0x9d,0x8b,0x9b,0x8b,0xff,0x00,0x21,0x55,0x56,0x83,0xff,0x00,0x1a,0xaa,0xaa,0x7b,0x9f,0x7b,0x9f,0x70,0xff,0x00,0x0f,0x55,0x56,0x65,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xdb,0x55,0x56,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xf1,0x55,0x56,0x97,0xff,0xff,0xf1,0x55,0x55,0x97,0xff,0xff,0xf8,0xaa,0xab,0xff,0x00,0x10,0x55,0x54,0x8b,0xff,0x00,0x14,0xaa,0xac,0x08,0x8b,0xff,0x00,0x22,0xaa,0xac,0xff,0x00,0x09,0xaa,0xab,0xff,0x00,0x1b,0x55,0x54,0xff,0x00,0x13,0x55,0x55,0x9f,0xff,0x00,0x13,0x55,0x56,0x9f,0xff,0x00,0x19,0xaa,0xaa,0x95,0xab,0x8b,0xb9,0x8b,0xa2,0xff,0xff,0xeb,0x55,0x54,0x8b,0xff,0xff,0xd6,0xaa,0xac,0x8b,0x85,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf1,0x55,0x54,0x08,0xcf,0x06,0xff,0x00,0x03,0x55,0x56,0x99,0xff,0x00,0x01,0xaa,0xaa,0xff,0x00,0x0f,0xaa,0xac,0x8b,0xff,0x00,0x11,0x55,0x54,0x8b,0xff,0x00,0x22,0xaa,0xac,0x80,0xa6,0x75,0xff,0x00,0x13,0x55,0x54,0x75,0xff,0x00,0x13,0x55,0x54,0xff,0xff,0xdf,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xac,0xff,0xff,0xd5,0x55,0x56,0x8b,0xff,0xff,0xdb,0x55,0x56,0x8b,0xff,0xff,0xdf,0x80,0x00,0x83,0xff,0xff,0xe3,0xaa,0xaa,0x7b,0xff,0xff,0xe3,0xaa,0xab,0x7b,0xff,0xff,0xe9,0xd5,0x55,0xff,0xff,0xe9,0xd5,0x54,0x7b,0xff,0xff,0xe3,0xaa,0xac,0x7b,0xff,0xff,0xe3,0xaa,0xac,0x83,0xff,0xff,0xe0,0x2a,0xa8,0x8b,0xff,0xff,0xdc,0xaa,0xac,0x08,0x8b,0x63,0x9d,0x6c,0xaf,0x75,0xff,0xff,0xdd,0x55,0x55,0xff,0xff,0xf4,0xaa,0xde,0xff,0xff,0xe3,0x2a,0xab,0xff,0xff,0xec,0x2a,0xaa,0x74,0xff,0xff,0xe3,0xaa,0x78,0x74,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xde,0x80,0x00,0x83,0xff,0xff,0xd9,0x55,0x56,0x87,0xff,0xff,0xed,0x55,0x56,0x89,0xff,0xff,0xee,0x55,0x55,0x8b,0xff,0xff,0xef,0x55,0x55,0x8b,0xff,0xff,0xbd,0x55,0x56,0xae,0x61,0xd1,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x25,0x55,0x4e,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x1a,0xd5,0x55,0xff,0xff,0xf4,0xd5,0x56,0xff,0x00,0x10,0x55,0x5d,0x7e,0x08,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf3,0x00,0x01,0xff,0x00,0x08,0x2a,0xaa,0xff,0xff,0xee,0xd5,0x55,0x8b,0xff,0xff,0xea,0xaa,0xaa,0x8b,0x83,0x8a,0x82,0x89,0x81,0xff,0xff,0xfa,0xaa,0xaa,0xff,0xff,0xe3,0xff,0xff,0xff,0xff,0xf3,0xd5,0x56,0xff,0xff,0xea,0x55,0x55,0x78,0xff,0xff,0xf0,0xaa,0xac,0x78,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xe7,0xd5,0x55,0xff,0xff,0xf8,0x55,0x56,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xce,0xaa,0xab,0x8b,0xff,0xff,0xe7,0x55,0x55,0xa1,0x8b,0xb7,0x8b,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x55,0x08,0x46,0x06,0x87,0xff,0xff,0xec,0xaa,0xaa,0x89,0x7a,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xdb,0x55,0x52,0xff,0x00,0x0c,0x80,0x00,0x6f,0xa4,0xff,0xff,0xec,0xaa,0xae,0x08,0xff,0x00,0xf8,0x80,0x00,0xff,0x01,0x48,0x80,0x00,0x15,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xeb,0xaa,0xab,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0xf5,0xd5,0x55,0x6b,0x8b,0xff,0xff,0xe5,0x55,0x55,0x8b,0xff,0xff,0xeb,0x80,0x00,0x92,0xff,0xff,0xf1,0xaa,0xab,0x99,0xff,0xff,0xf1,0xaa,0xab,0x99,0xff,0xff,0xf8,0xd5,0x55,0xff,0x00,0x13,0xaa,0xab,0x8b,0xff,0x00,0x19,0x55,0x55,0x8b,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x01,0x55,0x55,0xff,0x00,0x0b,0xff,0xff,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x25,0x55,0x56,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x1c,0xd5,0x54,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x14,0x55,0x56,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x14,0x55,0x56,0xff,0x00,0x1b,0x80,0x00,0xff,0x00,0x0a,0x2a,0xaa,0xff,0x00,0x20,0xaa,0xab,0x8b,0x08,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xf9,0x2a,0xaa,0x99,0xff,0xff,0xf2,0x55,0x56,0x99,0xff,0xff,0xf2,0x55,0x56,0x92,0xff,0xff,0xec,0x2a,0xaa,0x8b,0x71,0x8b,0x7f,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf3,0x55,0x56,0x83,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xe3,0x80,0x00,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xeb,0xaa,0xab,0x08,0x8f,0xff,0x02,0x05,0x80,0x00,0x15,0x0e,0x6d,0xf7,0x69,0xf9,0x2c,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xf7,0xc9,0xff,0x01,0x02,0x80,0x00,0xff,0x00,0x22,0x80,0x00,0x15,0xff,0x00,0x34,0x55,0x56,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x3b,0xd5,0x54,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x43,0x55,0x56,0x8b,0xff,0x00,0x43,0x55,0x56,0x8b,0xff,0x00,0x3b,0xaa,0xaa,0xff,0x00,0x0e,0xd5,0x55,0xbf,0xff,0x00,0x1d,0xaa,0xab,0xbf,0xff,0x00,0x1d,0xaa,0xaa,0xff,0x00,0x28,0x80,0x00,0xff,0x00,0x29,0x55,0x56,0xa8,0xc0,0xa8,0xc0,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x3c,0x80,0x00,0x8b,0xcf,0x8b,0xcf,0xff,0xff,0xf1,0x80,0x00,0xff,0x00,0x3c,0x80,0x00,0x6e,0xc0,0x6e,0xc0,0xff,0xff,0xd7,0x80,0x00,0xff,0x00,0x29,0x55,0x54,0x57,0xff,0x00,0x1d,0xaa,0xac,0x08,0x57,0xff,0x00,0x1d,0xaa,0xac,0xff,0xff,0xc4,0x55,0x56,0xff,0x00,0x0e,0xd5,0x54,0xff,0xff,0xbc,0xaa,0xaa,0x8b,0xff,0xff,0xbc,0xaa,0xaa,0x8b,0xff,0xff,0xc4,0x55,0x56,0xff,0xff,0xf1,0x2a,0xac,0x57,0xff,0xff,0xe2,0x55,0x54,0x57,0xff,0xff,0xe2,0x55,0x54,0xff,0xff,0xd7,0x80,0x00,0xff,0xff,0xd6,0xaa,0xac,0x6e,0x56,0x6e,0x56,0xff,0xff,0xf1,0x80,0x00,0xff,0xff,0xc3,0x80,0x00,0x8b,0x47,0x8b,0x47,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xc3,0x80,0x00,0xff,0x00,0x1c,0xaa,0xaa,0x56,0xff,0x00,0x1c,0xaa,0xab,0x56,0xff,0x00,0x28,0x80,0x00,0xff,0xff,0xd6,0xaa,0xaa,0xff,0x00,0x34,0x55,0x55,0xff,0xff,0xe2,0x55,0x56,0x08,0xff,0x01,0x4a,0x80,0x00,0xff,0x00,0x2d,0x80,0x00,0x15,0xff,0xff,0xd4,0xaa,0xac,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xcd,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xc6,0xaa,0xaa,0x8b,0xff,0xff,0xc6,0xaa,0xaa,0x8b,0xff,0xff,0xcd,0x80,0x00,0xff,0x00,0x0c,0x55,0x55,0xff,0xff,0xd4,0x55,0x56,0xff,0x00,0x18,0xaa,0xab,0xff,0xff,0xd4,0x55,0x5d,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xde,0x55,0x55,0xff,0x00,0x22,0xaa,0xab,0xff,0xff,0xe8,0x55,0x4e,0xff,0x00,0x2c,0xaa,0xab,0xff,0xff,0xe8,0x55,0x55,0xff,0x00,0x2c,0xaa,0xab,0xff,0xff,0xf4,0x2a,0xab,0xff,0x00,0x33,0xff,0xff,0x8b,0xff,0x00,0x3b,0x55,0x56,0x8b,0xff,0x00,0x3b,0x55,0x56,0xff,0x00,0x0b,0xd5,0x55,0xbf,0xff,0x00,0x17,0xaa,0xab,0xff,0x00,0x2c,0xaa,0xaa,0xff,0x00,0x17,0xaa,0xab,0xff,0x00,0x2c,0xaa,0xac,0xff,0x00,0x21,0xaa,0xaa,0xff,0x00,0x22,0xaa,0xa8,0xff,0x00,0x2b,0xaa,0xab,0xff,0x00,0x18,0xaa,0xac,0x08,0xff,0x00,0x2b,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xac,0xff,0x00,0x32,0x80,0x00,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x39,0x55,0x56,0x8b,0xff,0x00,0x39,0x55,0x56,0x8b,0xff,0x00,0x32,0x55,0x56,0xff,0xff,0xf3,0xaa,0xac,0xff,0x00,0x2b,0x55,0x54,0xff,0xff,0xe7,0x55,0x54,0xff,0x00,0x2b,0x55,0x54,0xff,0xff,0xe7,0x55,0x9c,0xff,0x00,0x21,0x80,0x00,0xff,0xff,0xdd,0x55,0x54,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xd3,0x55,0x10,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xd3,0x55,0x56,0xff,0x00,0x0b,0xd5,0x54,0x57,0x8b,0xff,0xff,0xc4,0xaa,0xaa,0x8b,0xff,0xff,0xc4,0xaa,0xb2,0xff,0xff,0xf4,0x2a,0xac,0x57,0xff,0xff,0xe8,0x55,0x54,0xff,0xff,0xd3,0x55,0x4e,0xff,0xff,0xe8,0x55,0x54,0xff,0xff,0xd3,0x55,0x55,0xff,0xff,0xde,0x80,0x00,0xff,0xff,0xdd,0x55,0x55,0xff,0xff,0xd4,0xaa,0xac,0xff,0xff,0xe7,0x55,0x56,0x08,0xfb,0x94,0xf4,0x15,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x24,0x55,0x56,0xff,0xff,0xf3,0xaa,0xab,0xb9,0x8b,0xff,0x00,0x2a,0xaa,0x8c,0x8b,0xad,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x19,0x55,0x74,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x19,0x55,0x54,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x0c,0xaa,0xac,0xff,0x00,0x1e,0xaa,0xaa,0x8b,0xff,0x00,0x26,0xaa,0xab,0x08,0x90,0x57,0x87,0x07,0x8b,0xff,0xff,0xe7,0x55,0x55,0xff,0xff,0xf8,0x2a,0xac,0xff,0xff,0xec,0xaa,0xab,0xff,0xff,0xf0,0x55,0x54,0x7d,0xff,0xff,0xf0,0x55,0x56,0x7d,0xff,0xff,0xea,0xd5,0x54,0x84,0xff,0xff,0xe5,0x55,0x56,0x8b,0xff,0xff,0xe1,0x55,0x56,0x8b,0xff,0xff,0xe8,0x55,0x54,0xff,0x00,0x08,0x2a,0xab,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x1c,0xd5,0x55,0x8b,0xff,0x00,0x29,0x55,0x56,0x08,0xd2,0x07,0x8b,0xff,0x00,0x28,0xaa,0xaa,0xff,0x00,0x08,0x55,0x56,0xff,0x00,0x1c,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x10,0xaa,0x92,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x08,0x2a,0xaa,0xff,0x00,0x1e,0xaa,0xc4,0x8b,0xff,0x00,0x1a,0xaa,0x9c,0x8b,0xff,0x00,0x15,0x2a,0xaa,0xff,0xff,0xf9,0x2a,0xaa,0xff,0x00,0x0f,0xaa,0xba,0xff,0xff,0xf2,0x55,0x56,0xff,0x00,0x0f,0xaa,0xac,0xff,0xff,0xf2,0x55,0x56,0xff,0x00,0x07,0xd5,0x54,0xff,0xff,0xec,0x80,0x00,0x8b,0xff,0xff,0xe6,0xaa,0xaa,0x08,0x88,0xbf,0x90,0x07,0x8b,0xff,0x00,0x26,0xaa,0x8e,0xff,0xff,0xf3,0x55,0x54,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xe6,0xaa,0xac,0xff,0x00,0x16,0xaa,0xc8,0xff,0xff,0xe6,0xaa,0xac,0xff,0x00,0x16,0xaa,0xac,0xff,0xff,0xdd,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xd4,0xaa,0xaa,0x8b,0xff,0xff,0xd2,0xaa,0xaa,0x8b,0x67,0xff,0xff,0xf3,0xaa,0xac,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xe7,0x55,0x54,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xd8,0x55,0x54,0x8b,0xff,0xff,0xc9,0x55,0x56,0x08,0x3e,0x07,0x8b,0xff,0xff,0xc9,0x55,0x5d,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xd8,0x55,0x55,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x4e,0x08,0x0e,0xfb,0x5a,0xf7,0x0f,0xff,0x01,0xbf,0x80,0x00,0x15,0xff,0x00,0x0f,0x55,0x4c,0xff,0xff,0xf1,0xaa,0xaa,0xff,0x00,0x14,0x55,0x55,0xff,0xff,0xf8,0xd5,0x56,0xff,0x00,0x19,0x55,0x5f,0x8b,0xff,0x00,0x24,0xaa,0xab,0x8b,0xff,0x00,0x1b,0xaa,0xaa,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x1b,0x55,0x56,0x08,0x82,0x66,0xcc,0x8b,0xcd,0xf7,0xce,0x4d,0x8b,0x82,0x61,0x05,0x7d,0xff,0x00,0x1e,0xaa,0xac,0xff,0xff,0xe7,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x54,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xe1,0x55,0x62,0x8b,0xff,0xff,0xe5,0x55,0x55,0xff,0xff,0xf5,0x55,0x54,0xff,0xff,0xe9,0x55,0x49,0xff,0xff,0xea,0xaa,0xac,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xea,0xaa,0xac,0xff,0xff,0xf0,0x55,0x55,0xff,0xff,0xdf,0xaa,0xa8,0xff,0xff,0xf7,0x55,0x56,0xff,0xff,0xd4,0xaa,0xac,0x08,0x7e,0x4b,0x05,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xfe,0x55,0x56,0x7d,0x8b,0xff,0xff,0xf4,0xaa,0xac,0x8b,0xff,0xff,0xe2,0xaa,0xe6,0xff,0x00,0x07,0xaa,0xaa,0xff,0xff,0xea,0x2a,0xaa,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf1,0xaa,0x70,0x08,0xff,0x00,0x89,0x80,0x00,0xff,0x00,0x38,0x80,0x00,0x15,0xff,0xff,0xf3,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xef,0xd5,0x55,0xff,0xff,0xf9,0x55,0x56,0x77,0x8b,0x7d,0x8b,0xff,0xff,0xf4,0xd5,0x55,0xff,0x00,0x03,0xd5,0x56,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x07,0xaa,0xaa,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x07,0xaa,0xaa,0xff,0xff,0xfb,0xd5,0x55,0xff,0x00,0x0b,0xd5,0x56,0x8b,0x9b,0x8b,0x93,0x8c,0xff,0x00,0x08,0x55,0x54,0x8d,0xff,0x00,0x08,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0x00,0x0a,0xaa,0xab,0xff,0x00,0x30,0xaa,0xac,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x18,0x55,0x54,0xff,0x00,0x24,0xaa,0xab,0x8b,0x9b,0x8b,0x97,0xff,0xff,0xfb,0x55,0x54,0x93,0xff,0xff,0xf6,0xaa,0xac,0x93,0xff,0xff,0xf6,0xaa,0xac,0x8f,0xff,0xff,0xf3,0xaa,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf8,0xaa,0xac,0x8a,0xff,0xff,0xf7,0xaa,0xa8,0x89,0xff,0xff,0xf6,0xaa,0xac,0x08,0x7f,0x53,0x05,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xe9,0x55,0x54,0xff,0xff,0xf7,0x80,0x00,0x79,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xac,0x08,0xff,0xff,0xfb,0x80,0x00,0xf7,0xeb,0x15,0x0e,0x57,0xa6,0xf7,0x9c,0x15,0x43,0x0a,0x55,0xfb,0x5a,0x15,0x43,0x0a,0x0e,0xf8,0x12,0xf7,0x9c,0x15,0xfb,0x1a,0xd0,0xf7,0x58,0xfc,0x25,0x4d,0x07,0x0e,0xfb,0x1c,0xe1,0xf8,0x10,0x15,0x7e,0x49,0xf7,0xa7,0x8b,0x98,0xcd,0x05,0x0e,0x9b,0xff,0x00,0xe4,0x80,0x00,0xf7,0xdf,0x15,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x20,0x2a,0xaa,0xff,0xff,0xf7,0xaa,0xaa,0xaf,0x8b,0xaf,0x8b,0xff,0x00,0x20,0x55,0x56,0xff,0x00,0x08,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x16,0xd5,0x56,0x9b,0xa8,0x9b,0xa8,0x93,0xff,0x00,0x20,0xd5,0x56,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xaf,0xff,0xff,0xf7,0xd5,0x56,0xff,0x00,0x20,0x80,0x00,0xff,0xff,0xef,0xaa,0xaa,0xa8,0xff,0xff,0xef,0xaa,0xc8,0xa8,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x16,0xd5,0x54,0xff,0xff,0xe3,0xaa,0x8e,0xff,0x00,0x10,0xaa,0xac,0x08,0xff,0xff,0xe3,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xac,0xff,0xff,0xdf,0xd5,0x56,0xff,0x00,0x08,0x55,0x54,0x67,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0x6b,0xff,0xff,0xf7,0xaa,0xac,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xe3,0x55,0x55,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xe9,0x80,0x00,0xff,0xff,0xe9,0x2a,0xac,0xff,0xff,0xef,0xaa,0xab,0x6e,0xff,0xff,0xef,0xaa,0xab,0x6e,0xff,0xff,0xf7,0xd5,0x55,0xff,0xff,0xdf,0x80,0x00,0x8b,0x67,0x8b,0x67,0xff,0x00,0x08,0x2a,0xab,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x10,0x55,0x54,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x16,0x55,0x55,0x74,0xff,0x00,0x1c,0x55,0x57,0xff,0xff,0xef,0x55,0x56,0x08,0xf7,0x64,0xff,0x00,0x33,0x80,0x00,0x15,0x6e,0xff,0xff,0xe1,0xaa,0xaa,0xff,0xff,0xda,0xd5,0x56,0xff,0xff,0xf0,0xd5,0x56,0xff,0xff,0xd2,0xaa,0xaa,0x8b,0xff,0xff,0xd2,0xaa,0xaa,0x8b,0xff,0xff,0xda,0xd5,0x55,0xff,0x00,0x0f,0x2a,0xaa,0xff,0xff,0xe3,0x00,0x01,0xff,0x00,0x1e,0x55,0x56,0x6e,0xff,0x00,0x1e,0x55,0x56,0xff,0xff,0xf1,0x80,0x00,0xff,0x00,0x26,0x80,0x00,0x8b,0xff,0x00,0x2e,0xaa,0xaa,0x8b,0xff,0x00,0x2e,0xaa,0xac,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x26,0x55,0x54,0xa8,0xa9,0xa8,0xa9,0xff,0x00,0x25,0x2a,0xaa,0x9a,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x25,0x2a,0xaa,0x7c,0xa8,0x6d,0x08,0xa8,0x6d,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xd9,0xaa,0xac,0x8b,0xff,0xff,0xd1,0x55,0x54,0x8b,0xff,0xff,0xd1,0x55,0x56,0xff,0xff,0xf1,0x80,0x00,0xff,0xff,0xd9,0x80,0x00,0x6e,0xff,0xff,0xe1,0xaa,0xaa,0x08,0xff,0xff,0x4a,0x80,0x00,0xff,0x00,0xdf,0x80,0x00,0x15,0xfb,0x6a,0xaf,0xe3,0xb3,0x07,0xb5,0x33,0xb2,0x8b,0x5f,0xe7,0x05,0x97,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x09,0x80,0x00,0xff,0x00,0x07,0x80,0x00,0x92,0xff,0x00,0x0a,0x55,0x56,0x92,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x03,0x80,0x00,0xff,0x00,0x0c,0x2a,0xac,0x8b,0x99,0x8b,0x9f,0xff,0xff,0xf9,0xd5,0x56,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xf3,0xaa,0xaa,0x96,0xff,0xff,0xf3,0xaa,0xaa,0x96,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x05,0x80,0x00,0xff,0xff,0xe9,0x55,0x56,0x8b,0x08,0x2d,0x04,0x5e,0xc9,0xb8,0x06,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x0b,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xeb,0x55,0x54,0x1f,0x8b,0xff,0xff,0xeb,0x55,0x54,0xff,0xff,0xf4,0x55,0x56,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xaa,0xff,0x00,0x00,0x00,0x02,0x08,0x0e,0x60,0xf7,0x60,0xf9,0x20,0x15,0x7e,0x4d,0xf7,0x98,0x8b,0x98,0xc9,0x05,0x0e,0xfb,0x37,0xf7,0x29,0xf8,0x60,0x15,0xff,0x00,0x1a,0xaa,0xab,0xff,0xff,0xe5,0x55,0x56,0xff,0x00,0x21,0x55,0x55,0xff,0xff,0xf2,0xaa,0xaa,0xb3,0x8b,0xff,0x00,0x27,0x55,0x56,0x8b,0xff,0x00,0x21,0x2a,0xaa,0xff,0x00,0x0d,0x55,0x56,0xa6,0xff,0x00,0x1a,0xaa,0xaa,0xa6,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x21,0x55,0x56,0x8b,0xb3,0x8b,0xb3,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x21,0x55,0x54,0x70,0xff,0x00,0x1a,0xaa,0xac,0x70,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xde,0xd5,0x56,0xff,0x00,0x0d,0x55,0x54,0xff,0xff,0xd8,0xaa,0xaa,0x8b,0x63,0x8b,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0xff,0xff,0xe5,0x55,0x55,0xff,0xff,0xe5,0x55,0x54,0x08,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xe5,0x55,0x54,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xde,0xaa,0xac,0x8b,0x63,0x8b,0x63,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x56,0x08,0xf7,0x37,0xae,0x15,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xee,0xaa,0xaa,0x76,0xff,0xff,0xf7,0x55,0x56,0xff,0xff,0xe6,0xaa,0xaa,0x8b,0x71,0x8b,0xff,0xff,0xea,0xaa,0xab,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x15,0xaa,0xac,0x8b,0xa5,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x08,0x55,0x55,0xa1,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x08,0xaa,0xac,0xa5,0x8b,0xa5,0x8b,0xff,0x00,0x15,0x2a,0xaa,0xff,0xff,0xf7,0x55,0x54,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xee,0xaa,0xac,0x08,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x08,0x2a,0xaa,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x8b,0x71,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xea,0x55,0x54,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xee,0xaa,0xac,0x08,0x0e,0xf8,0x49,0xf7,0xed,0x15,0xfb,0x3a,0xf7,0x3a,0x49,0xfb,0x3a,0xfb,0x3a,0x49,0xf7,0x3a,0xfb,0x3a,0xcd,0xf7,0x3a,0xf7,0x3a,0x06,0xfc,0x22,0xfb,0x6d,0x15,0x49,0xf8,0x22,0xcd,0x07,0x0e,0xfb,0x25,0xf7,0x12,0xf8,0x76,0x15,0x44,0x0a,0x0e,0xfb,0x3f,0xf7,0x22,0xff,0x01,0xbc,0x80,0x00,0x15,0x45,0x0a,0x0e,0x6d,0xf7,0xf3,0xf9,0x4d,0x15,0x46,0x0a,0x0e,0x7d,0xf7,0x15,0xf8,0x8f,0x15,0xfb,0x1f,0xfd,0x27,0xcf,0x8b,0xb2,0xf7,0x4b,0x05,0x9d,0x71,0xff,0x00,0x1e,0xaa,0xaa,0x7e,0xff,0x00,0x2b,0x55,0x56,0x8b,0xff,0x00,0x39,0x55,0x55,0x8b,0xff,0x00,0x2f,0xaa,0xab,0xff,0x00,0x16,0xaa,0xab,0xb1,0xff,0x00,0x2d,0x55,0x55,0x08,0x7e,0x4f,0xcf,0x8b,0xf7,0x00,0xf8,0x8f,0x46,0x8b,0x45,0xfb,0xdd,0x05,0x83,0xff,0xff,0xd9,0x55,0x59,0xff,0xff,0xee,0x80,0x00,0xff,0xff,0xe1,0xaa,0xab,0x70,0xff,0xff,0xe9,0xff,0xfc,0x70,0x75,0xff,0xff,0xe1,0xd5,0x55,0x80,0xff,0xff,0xde,0xaa,0xab,0x8b,0x6f,0x8b,0x75,0xff,0x00,0x06,0xd5,0x55,0x7b,0xff,0x00,0x0d,0xaa,0xab,0x7b,0xff,0x00,0x0d,0xaa,0xaa,0x83,0xff,0x00,0x13,0x80,0x00,0x8b,0xff,0x00,0x19,0x55,0x56,0x8b,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x01,0xaa,0xaa,0x9a,0xff,0x00,0x03,0x55,0x56,0xff,0x00,0x10,0xaa,0xab,0x08,0xd1,0xf7,0xdd,0x05,0x0e,0xb5,0xf7,0xa3,0xf7,0xa4,0x15,0x31,0xfc,0x3c,0xce,0x8b,0xf7,0x39,0xf9,0x9d,0xe6,0x8b,0xfb,0x39,0xfd,0x9d,0xce,0x8b,0xf7,0x47,0xf9,0xde,0xfb,0x58,0x8b,0x05,0xff,0xff,0xd2,0xaa,0xaa,0x8b,0x62,0xff,0xff,0xf6,0xd5,0x54,0xff,0xff,0xdb,0x55,0x56,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xdb,0x55,0x5c,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xe1,0xd5,0x55,0x72,0xff,0xff,0xe8,0x55,0x4f,0xff,0xff,0xe0,0x55,0x54,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xe0,0x55,0x54,0xff,0xff,0xf0,0x2a,0xab,0xff,0xff,0xdc,0x80,0x00,0x83,0xff,0xff,0xd8,0xaa,0xac,0x87,0x79,0x89,0xff,0xff,0xee,0xaa,0xaa,0x8b,0xff,0xff,0xef,0x55,0x56,0x8b,0xff,0xff,0xd3,0x55,0x56,0x98,0xff,0xff,0xdb,0x80,0x00,0xa5,0xff,0xff,0xe3,0xaa,0xaa,0xa5,0xff,0xff,0xe3,0xaa,0xce,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xf0,0x2a,0xaa,0xff,0x00,0x2f,0x55,0x55,0xff,0xff,0xfc,0xaa,0x88,0x08,0x0e,0xfb,0xb7,0xe4,0xf7,0xd0,0x15,0x77,0x2e,0xe4,0x8b,0x9e,0xe8,0x05,0x0e,0x60,0xf7,0x5c,0x97,0x15,0x29,0xfb,0x36,0xd3,0x8b,0xe1,0xf7,0x36,0x05,0x0e,0xfb,0xab,0xf7,0x82,0xf9,0x9a,0x15,0x47,0x0a,0x0e,0xfb,0x5c,0xf7,0x16,0xff,0x01,0xc0,0x80,0x00,0x15,0x9f,0x7c,0xff,0x00,0x1a,0xaa,0xab,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x21,0x55,0x55,0x8b,0xff,0x00,0x4f,0x55,0x56,0x8b,0xbb,0xff,0x00,0x2b,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x57,0x55,0x56,0x08,0x97,0xc8,0x05,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0c,0xaa,0xac,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0c,0x55,0x54,0x8b,0x97,0x8b,0xff,0x00,0x1f,0x54,0xa8,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x17,0x55,0x54,0x78,0xff,0x00,0x0f,0x56,0x04,0x78,0xff,0x00,0x0f,0x55,0x54,0xff,0xff,0xe5,0xd5,0x56,0xff,0x00,0x07,0xaa,0xac,0xff,0xff,0xde,0xaa,0xaa,0x8b,0xff,0xff,0xd9,0x55,0x55,0x8b,0xff,0xff,0xe0,0xaa,0xab,0xff,0xff,0xf5,0x80,0x00,0x73,0x76,0x73,0x76,0x7a,0xff,0xff,0xde,0xd5,0x54,0x81,0xff,0xff,0xd2,0xaa,0xac,0x08,0x7e,0x4f,0x05,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xac,0xff,0xff,0xfe,0x55,0x56,0x7e,0x8b,0xff,0xff,0xf5,0x55,0x54,0x8b,0xff,0xff,0xe0,0xaa,0xaa,0x95,0xff,0xff,0xe8,0xd5,0x56,0x9f,0x7c,0x08,0xff,0x00,0x84,0x80,0x00,0xff,0x00,0x34,0x80,0x00,0x15,0xff,0xff,0xf4,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xf1,0x2a,0xab,0xff,0xff,0xfa,0x55,0x56,0x79,0x8b,0xff,0xff,0xdd,0x55,0x55,0x8b,0xff,0xff,0xee,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xaa,0x8b,0xff,0x00,0x1f,0x55,0x56,0x8b,0x93,0x8c,0xff,0x00,0x08,0x55,0x54,0x8d,0xff,0x00,0x08,0xaa,0xac,0x08,0x98,0xc8,0x05,0x91,0xa5,0x94,0xff,0x00,0x12,0xaa,0xac,0x97,0xff,0x00,0x0b,0x55,0x54,0x97,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x12,0xaa,0xab,0x8b,0xff,0x00,0x0f,0x55,0x56,0x8b,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xfc,0x2a,0xac,0x94,0xff,0xff,0xf8,0x55,0x54,0x94,0xff,0xff,0xf8,0x55,0x54,0xff,0x00,0x04,0x80,0x00,0xff,0xff,0xf4,0x2a,0xac,0x8b,0x7b,0x8b,0xff,0xff,0xf8,0xaa,0xac,0x8a,0xff,0xff,0xf7,0x55,0x54,0x89,0x81,0x08,0x7e,0x50,0x05,0x85,0xff,0xff,0xe5,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0x78,0xff,0xff,0xf4,0x55,0x56,0xff,0xff,0xf4,0xaa,0xac,0x08,0xff,0x00,0x02,0x80,0x00,0xf7,0xee,0x15,0x0e,0x58,0xc1,0xf7,0x29,0x15,0x48,0x0a,0xb9,0xfb,0x07,0x15,0x48,0x0a,0x0e,0xf7,0x88,0xf7,0x61,0xf8,0xfd,0x15,0x47,0x0a,0xf8,0xd4,0xfc,0x7b,0x15,0x49,0x0a,0x47,0xf8,0xfb,0x15,0x22,0x0a,0x0e,0xf7,0xb0,0xf7,0x61,0xf8,0xfd,0x15,0x47,0x0a,0xf7,0xeb,0xfc,0x92,0x15,0x7f,0x57,0xf7,0x7e,0x8b,0x97,0xc6,0xfb,0x26,0x8b,0xf7,0x1e,0xf7,0x27,0x05,0xff,0x00,0x15,0x55,0x54,0xa1,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x0b,0xaa,0xac,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x0b,0xaa,0xac,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x05,0xd5,0x54,0xa3,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x18,0xaa,0x7c,0xff,0xff,0xf7,0x2a,0xac,0xff,0x00,0x13,0xaa,0xaa,0xff,0xff,0xee,0x55,0x54,0xff,0x00,0x0e,0xaa,0xda,0xff,0xff,0xee,0x55,0x54,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xe8,0x2a,0xac,0xff,0x00,0x07,0x55,0x56,0x6d,0x8b,0xff,0xff,0xdb,0x55,0xa0,0x8b,0xff,0xff,0xe0,0xd5,0x54,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xe6,0x55,0x0c,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x54,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xe4,0xd5,0x56,0xff,0xff,0xf8,0xaa,0xac,0x69,0x08,0x88,0x7c,0xcc,0x8b,0x8d,0x96,0x05,0x8f,0x9f,0xff,0x00,0x07,0xaa,0xac,0x9a,0xff,0x00,0x0b,0x55,0x54,0x95,0xff,0x00,0x0b,0x55,0x54,0x95,0xff,0x00,0x0d,0xaa,0xac,0x90,0x9b,0x8b,0xff,0x00,0x0d,0x55,0x54,0x8b,0xff,0x00,0x0a,0x2a,0xac,0xff,0xff,0xfc,0xaa,0xaa,0x92,0xff,0xff,0xf9,0x55,0x56,0x92,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x55,0x54,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xf1,0xaa,0xac,0xff,0xff,0xe2,0x55,0x54,0xff,0xff,0xe3,0x55,0x54,0xff,0xff,0xe1,0x55,0x56,0x08,0x57,0xf8,0x56,0x15,0x22,0x0a,0x0e,0xf7,0xf4,0xf6,0xff,0x01,0x1f,0x80,0x00,0x15,0x4a,0x0a,0xf9,0x4d,0xff,0xff,0x2b,0x80,0x00,0x15,0x49,0x0a,0x47,0xf8,0xfb,0x15,0x22,0x0a,0x0e,0x27,0xf7,0x7a,0xf8,0x8f,0x15,0x20,0x0a,0xff,0xfe,0xdd,0x80,0x00,0xfd,0x0f,0x15,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x23,0x80,0x00,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x37,0x55,0x4f,0x8b,0xff,0x00,0x2d,0x55,0x55,0xff,0x00,0x0f,0x2a,0xab,0xff,0x00,0x23,0x55,0x5c,0xff,0x00,0x1e,0x55,0x55,0xff,0x00,0x23,0x55,0x56,0xff,0x00,0x1e,0x55,0x56,0xa2,0xff,0x00,0x2b,0x2a,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xc3,0x08,0x42,0x06,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xb6,0xaa,0xaa,0xff,0xff,0xd8,0x55,0x55,0xff,0xff,0xdb,0x55,0x56,0x49,0x8b,0x6f,0x8b,0x76,0xff,0x00,0x06,0x55,0x56,0x7d,0xff,0x00,0x0c,0xaa,0xaa,0x7d,0xff,0x00,0x0c,0xaa,0xaa,0x84,0x9d,0x8b,0xff,0x00,0x17,0x55,0x56,0x8b,0xa5,0xff,0x00,0x05,0xd5,0x55,0xff,0x00,0x17,0xd5,0x55,0xff,0x00,0x0b,0xaa,0xab,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x0b,0xaa,0xa8,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x12,0x2a,0xaa,0xff,0x00,0x16,0xd5,0x56,0xff,0x00,0x18,0xaa,0xae,0xa3,0x08,0xc6,0xc5,0x05,0xa1,0xa1,0xff,0x00,0x0f,0x2a,0xab,0x9e,0xff,0x00,0x08,0x55,0x55,0x9b,0xff,0x00,0x08,0x55,0x36,0x9b,0xff,0x00,0x07,0x80,0x00,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x06,0xaa,0xca,0xff,0x00,0x1b,0x55,0x56,0x08,0x94,0xaf,0x42,0x8b,0x83,0x68,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xfa,0x80,0x00,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xf9,0xaa,0xab,0xff,0xff,0xf4,0x55,0x56,0xff,0xff,0xf9,0xaa,0xab,0xff,0xff,0xf4,0x55,0x55,0xff,0xff,0xf4,0x2a,0xaa,0xff,0xff,0xf1,0x80,0x00,0xff,0xff,0xee,0xaa,0xab,0xff,0xff,0xee,0xaa,0xab,0x08,0x4f,0x4f,0x05,0x6d,0x6d,0xff,0xff,0xe9,0xaa,0xab,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xf1,0x55,0x55,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0xf1,0x55,0x55,0xff,0xff,0xe4,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xd9,0x55,0x55,0xff,0x00,0x0c,0xd5,0x55,0xff,0xff,0xe1,0x55,0x55,0xff,0x00,0x19,0xaa,0xab,0xff,0xff,0xe9,0x55,0x56,0x08,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0x28,0x0a,0xf7,0xb1,0xc9,0x15,0x29,0x0a,0x41,0xf7,0xaa,0x15,0x33,0x0a,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0x28,0x0a,0xf7,0xb1,0xc9,0x15,0x29,0x0a,0xd8,0xf7,0xaa,0x15,0x46,0x0a,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0x28,0x0a,0xf7,0xb1,0xc9,0x15,0x29,0x0a,0x9f,0xf7,0xb3,0x15,0x4b,0x0a,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0x28,0x0a,0xf7,0xb1,0xc9,0x15,0x29,0x0a,0x2e,0xf7,0x67,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x58,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0x8e,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xc8,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf1,0x56,0xf0,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x53,0xbc,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x12,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x44,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xfc,0xd5,0x54,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0x28,0x0a,0xf7,0xb1,0xc9,0x15,0x29,0x0a,0x35,0xf7,0x89,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xb3,0xf8,0x31,0xf7,0x3a,0x15,0xa2,0xfb,0x3a,0xd7,0x8b,0x25,0xf9,0x3e,0x05,0xff,0x00,0x14,0xaa,0x74,0xff,0x00,0x05,0x55,0x54,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xac,0xff,0x00,0x0c,0xaa,0xe2,0x9b,0xff,0x00,0x0c,0xaa,0xaa,0x9b,0xff,0x00,0x06,0x55,0x56,0x9e,0x8b,0xa1,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xf7,0x55,0x56,0xa1,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x08,0xaa,0xac,0x71,0x8b,0xff,0xff,0xe5,0x55,0x56,0x8b,0xff,0xff,0xea,0x2a,0xaa,0xff,0xff,0xf7,0x55,0x54,0x7a,0xff,0xff,0xee,0xaa,0xac,0x7a,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x08,0x8b,0x79,0xff,0x00,0x04,0x55,0x56,0xff,0xff,0xef,0xaa,0xac,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xf1,0x55,0x54,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xf1,0x55,0x54,0x97,0x80,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf8,0xaa,0xac,0x08,0xfc,0x20,0xfd,0x45,0xd8,0x8b,0xe8,0xf7,0x3a,0x05,0xf7,0x7b,0xff,0x02,0x83,0x80,0x00,0x15,0x95,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xfa,0xd5,0x54,0x95,0xff,0xff,0xf5,0xaa,0xac,0x95,0xff,0xff,0xf5,0xaa,0xac,0x90,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x86,0xff,0xff,0xf3,0x55,0x54,0x81,0x81,0x81,0x81,0xff,0xff,0xf3,0xaa,0xaa,0x86,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf3,0xaa,0xaa,0x90,0x81,0x95,0x08,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x54,0x90,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x56,0x1c,0x08,0xc1,0xff,0xfd,0xba,0x80,0x00,0x15,0x29,0x0a,0x9f,0xf1,0x15,0x0e,0xf7,0xe9,0xf8,0xd1,0xf9,0x04,0x15,0xf7,0xd4,0x8b,0x99,0xcd,0xfc,0x47,0x8b,0xfc,0x9e,0xfd,0x46,0xde,0x8b,0xf7,0x15,0xf7,0x3f,0xf7,0x86,0x8b,0x67,0xfb,0x3f,0xf8,0x1c,0x8b,0x9a,0xcd,0xfb,0xd4,0x8b,0xc0,0xf7,0x90,0xf7,0xa2,0x8b,0x98,0xcd,0xfb,0xa1,0x8b,0x05,0x75,0xf7,0x80,0x15,0x39,0xfc,0x17,0xfb,0x65,0x8b,0x05,0x0e,0xdb,0xf8,0x9c,0xf8,0x79,0x15,0xd4,0x06,0x8d,0xff,0x00,0x0b,0x55,0x56,0x8c,0x96,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x38,0xaa,0xac,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x2c,0x55,0x54,0xff,0xff,0xdd,0x55,0x54,0xab,0xff,0xff,0xdd,0x55,0x56,0xab,0xff,0xff,0xce,0x55,0x54,0x9b,0xff,0xff,0xbf,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xb4,0x8b,0xff,0xff,0xc2,0x2a,0xaa,0xff,0xff,0xeb,0x2a,0xac,0xff,0xff,0xcd,0xaa,0xa2,0xff,0xff,0xd6,0x55,0x54,0xff,0xff,0xcd,0xaa,0xab,0xff,0xff,0xd6,0x55,0x78,0xff,0xff,0xdd,0x2a,0xab,0xff,0xff,0xbc,0xd5,0x54,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xa3,0x55,0x34,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0x70,0x8b,0x73,0x8b,0xff,0xff,0xc6,0xaa,0xab,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xd4,0x7f,0xff,0xaa,0xff,0xff,0xe2,0x55,0x56,0xaa,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x2a,0x2a,0xab,0xff,0xff,0xee,0xd5,0x56,0xff,0x00,0x35,0x55,0x55,0xff,0xff,0xfb,0x55,0x55,0x08,0x34,0xfb,0x23,0xd3,0x8b,0xd7,0xf7,0x23,0x05,0xc9,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x33,0x80,0x00,0xff,0x00,0x15,0x55,0x56,0xb4,0xff,0x00,0x25,0x55,0x55,0xff,0x00,0x28,0xff,0xe2,0xff,0x00,0x25,0x55,0x54,0xff,0x00,0x1c,0x2a,0xaa,0xff,0x00,0x30,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x74,0xff,0x00,0x3c,0x00,0x02,0x08,0x8c,0x8f,0x44,0x8b,0x8a,0x87,0x05,0xff,0xff,0xf4,0xaa,0xe2,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xe0,0xaa,0x74,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xe0,0xaa,0xc0,0xff,0xff,0xe6,0xaa,0xac,0xff,0xff,0xd7,0xaa,0xaa,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xce,0xaa,0x96,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd2,0xaa,0xab,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xe6,0xaa,0xab,0xa0,0xff,0xff,0xe6,0xaa,0xab,0xa0,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x20,0x80,0x00,0x8b,0xb7,0x8b,0xff,0x00,0x11,0x55,0x48,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x19,0x55,0x63,0x08,0xb2,0xf7,0x48,0x05,0xff,0x00,0x0f,0x55,0x4f,0xff,0x00,0x47,0x55,0x56,0xff,0x00,0x18,0xd5,0x55,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x22,0x55,0x5c,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x22,0x55,0x56,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2c,0x80,0x00,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x36,0xaa,0xaa,0x8b,0xff,0x00,0x2c,0xaa,0xaa,0x8b,0xff,0x00,0x21,0xd5,0x56,0xff,0xff,0xf5,0x55,0x54,0xa2,0xff,0xff,0xea,0xaa,0xac,0xa2,0xff,0xff,0xea,0xaa,0xac,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xe1,0xaa,0xa8,0x8b,0xff,0xff,0xd8,0xaa,0xac,0x8b,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xff,0x55,0x54,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xfe,0xaa,0xac,0x85,0x08,0x0e,0xa5,0xf7,0x7c,0xf9,0x04,0x15,0x2a,0x0a,0xf7,0x05,0xf8,0x84,0x15,0x33,0x0a,0x0e,0xa5,0xf7,0x7c,0xf9,0x04,0x15,0x2a,0x0a,0xf7,0x9c,0xf8,0x84,0x15,0x46,0x0a,0x0e,0xa5,0xf7,0x7c,0xf9,0x04,0x15,0x2a,0x0a,0xf7,0x63,0xf8,0x8d,0x15,0x4b,0x0a,0x0e,0xa5,0xf7,0x7c,0xf9,0x04,0x15,0x2a,0x0a,0xf0,0xf8,0x63,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xfb,0xad,0xf7,0x49,0xf9,0x46,0x15,0x2b,0x0a,0xfb,0x08,0xf7,0x52,0x15,0x33,0x0a,0x0e,0xfb,0xad,0xf7,0x49,0xf9,0x46,0x15,0x2b,0x0a,0xae,0xf7,0x52,0x15,0x46,0x0a,0x0e,0xfb,0xad,0xf7,0x49,0xf9,0x46,0x15,0x2b,0x0a,0x75,0xf7,0x5b,0x15,0x4b,0x0a,0x0e,0xfb,0xad,0xf7,0x49,0xf9,0x46,0x15,0x2b,0x0a,0xfb,0x14,0xf7,0x31,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xf7,0x13,0xf8,0xde,0xff,0x02,0x87,0x80,0x00,0x15,0xff,0xff,0xdd,0x55,0x54,0xff,0x00,0x1c,0x55,0x54,0xff,0xff,0xd0,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xac,0xff,0xff,0xc4,0x00,0x02,0x8b,0x08,0xfb,0x7e,0x8b,0x49,0xfb,0xc8,0x3b,0x8b,0x7d,0x49,0xdb,0x8b,0x48,0xfb,0xd0,0xf7,0x80,0x8b,0x05,0xff,0x00,0x48,0xaa,0xaa,0x8b,0xff,0x00,0x3e,0x55,0x56,0xa0,0xbf,0xb5,0xbf,0xb5,0xff,0x00,0x23,0xaa,0xac,0xff,0x00,0x42,0xaa,0xaa,0xff,0x00,0x13,0x55,0x54,0xff,0x00,0x5b,0x55,0x56,0x08,0xae,0xf7,0x38,0x05,0xff,0x00,0x06,0xaa,0xac,0xff,0x00,0x1e,0xaa,0x70,0xff,0x00,0x03,0x55,0x54,0xff,0x00,0x1c,0xaa,0xaa,0x8b,0xff,0x00,0x1a,0xaa,0xe6,0x8b,0xff,0x00,0x3d,0x55,0x0c,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x2c,0xd5,0x54,0xff,0xff,0xdd,0x55,0x54,0xff,0x00,0x1c,0x55,0xa0,0x08,0x75,0xff,0xff,0x6f,0x80,0x00,0x15,0x8b,0xff,0xff,0xec,0xaa,0xe6,0xff,0xff,0xfc,0xaa,0xac,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0xff,0xde,0xaa,0x70,0x08,0x68,0xfb,0x39,0x05,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0x7f,0x55,0x55,0xff,0xff,0xbb,0x55,0x56,0xff,0xff,0xbf,0xaa,0xab,0xfb,0x02,0x8b,0x08,0xfb,0x36,0x8b,0xc0,0xf7,0x8e,0xf7,0x2b,0x8b,0x98,0xcd,0xfb,0x2a,0x8b,0xbe,0xf7,0x86,0xf7,0x3a,0x8b,0x05,0xb5,0x8b,0xab,0xff,0xff,0xf6,0x55,0x54,0xa1,0xff,0xff,0xec,0xaa,0xac,0xa1,0xff,0xff,0xec,0xaa,0xac,0x96,0xff,0xff,0xe1,0x55,0x54,0x8b,0x61,0x08,0x0e,0xf7,0x19,0xf9,0x38,0xf9,0x46,0x15,0x2c,0x0a,0xfb,0x69,0xf9,0xc1,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x58,0x64,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x52,0x48,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xf1,0x55,0x70,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xfa,0x55,0x3c,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x54,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x1e,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x38,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xfc,0xd5,0x54,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0xda,0xf7,0x05,0xff,0x00,0x24,0x80,0x00,0x15,0x2d,0x0a,0xf7,0xb2,0xff,0x00,0x44,0x80,0x00,0x15,0x2e,0x0a,0x30,0xf9,0x9b,0x15,0x33,0x0a,0x0e,0xda,0xf7,0x05,0xff,0x00,0x24,0x80,0x00,0x15,0x2d,0x0a,0xf7,0xb2,0xff,0x00,0x44,0x80,0x00,0x15,0x2e,0x0a,0xc7,0xf9,0x9b,0x15,0x46,0x0a,0x0e,0xda,0xf7,0x05,0xff,0x00,0x24,0x80,0x00,0x15,0x2d,0x0a,0xf7,0xb2,0xff,0x00,0x44,0x80,0x00,0x15,0x2e,0x0a,0x8e,0xf9,0xa4,0x15,0x4b,0x0a,0x0e,0xda,0xf7,0x05,0xff,0x00,0x24,0x80,0x00,0x15,0x2d,0x0a,0xf7,0xb2,0xff,0x00,0x44,0x80,0x00,0x15,0x2e,0x0a,0xfb,0x02,0xf9,0x58,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x58,0x64,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x52,0x48,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0x8c,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xca,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xf1,0x55,0x70,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xfa,0x55,0x3c,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x18,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x3e,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xfc,0xd5,0x54,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0xda,0xf7,0x05,0xff,0x00,0x24,0x80,0x00,0x15,0x2d,0x0a,0xf7,0xb2,0xff,0x00,0x44,0x80,0x00,0x15,0x2e,0x0a,0x24,0xf9,0x7a,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xf7,0xc6,0xf7,0xa9,0x15,0xf7,0x0f,0xf7,0x0f,0x5f,0xb7,0xfb,0x10,0xfb,0x0f,0xfb,0x0f,0xf7,0x0f,0x5e,0x5f,0xf7,0x10,0xfb,0x0f,0xfb,0x10,0xfb,0x10,0xb8,0x5f,0xf7,0x0f,0xf7,0x0f,0xf7,0x10,0xfb,0x0f,0xb7,0xb7,0x05,0x0e,0xda,0xf8,0xcb,0xf8,0xfd,0x15,0xd4,0xe8,0x51,0x8b,0x5e,0x52,0x05,0xff,0xff,0xdd,0x55,0x56,0xff,0x00,0x1e,0xaa,0xac,0xff,0xff,0xce,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x54,0x4b,0x8b,0xfb,0x2c,0x8b,0xff,0xff,0xa1,0x55,0x55,0x33,0xff,0xff,0xda,0xaa,0xab,0xfb,0x44,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0x70,0x8b,0x73,0x8b,0xff,0xff,0xd8,0xaa,0xab,0x93,0xff,0xff,0xde,0x55,0x55,0x9b,0x6f,0x08,0x41,0x2d,0xc5,0x8b,0xb9,0xc5,0x05,0xff,0x00,0x22,0xaa,0xab,0xff,0xff,0xe1,0x55,0x55,0xff,0x00,0x31,0xff,0xff,0xff,0xff,0xf0,0xaa,0xab,0xff,0x00,0x41,0x55,0x56,0x8b,0xff,0x00,0x96,0xaa,0xac,0x8b,0xff,0x00,0x5d,0xff,0xfe,0xe3,0xff,0x00,0x25,0x55,0x56,0xf7,0x44,0x08,0xb1,0xf7,0x47,0x05,0x91,0xa9,0x8e,0xa6,0x8b,0xa3,0x8b,0xff,0x00,0x27,0x55,0x54,0x83,0xff,0x00,0x21,0xaa,0xac,0x7b,0xa7,0x08,0xfc,0x43,0xfc,0x6e,0x15,0xff,0xff,0xfc,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xab,0xff,0xff,0xfe,0x55,0x55,0xff,0x00,0x0e,0x55,0x55,0x8b,0x99,0x8b,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x02,0xaa,0xab,0xa1,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x19,0x55,0x55,0x08,0xb2,0xf7,0x48,0x05,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x47,0x55,0x56,0xa3,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x20,0xaa,0xab,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x20,0xaa,0xaa,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x0f,0xaa,0xac,0xc1,0x8b,0xff,0x00,0x32,0xaa,0xa4,0x8b,0xff,0x00,0x24,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xac,0xff,0x00,0x16,0xaa,0xb2,0xff,0xff,0xe5,0x55,0x54,0x08,0xa1,0x5d,0x15,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf1,0x55,0xd8,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf1,0x55,0x54,0x8b,0xff,0xff,0xf1,0x54,0xd4,0x8b,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x54,0xff,0xff,0xe8,0x55,0x56,0xff,0xff,0xfa,0xaa,0xac,0x73,0x08,0x64,0xfb,0x48,0x05,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xbc,0xaa,0xad,0xff,0xff,0xe8,0x55,0x54,0x5a,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe1,0x55,0x53,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0xff,0xd5,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x57,0x8b,0x57,0x8b,0xff,0xff,0xda,0x55,0x55,0x98,0xff,0xff,0xe8,0xaa,0xab,0xa5,0x08,0x0e,0xf4,0xff,0x00,0x7e,0x80,0x00,0xb7,0x15,0x30,0x0a,0xff,0x00,0xc7,0x80,0x00,0xf9,0xd8,0x15,0x33,0x0a,0x0e,0xf4,0xff,0x00,0x7e,0x80,0x00,0xb7,0x15,0x30,0x0a,0xff,0x01,0x5e,0x80,0x00,0xf9,0xd8,0x15,0x46,0x0a,0x0e,0xf4,0xff,0x00,0x7e,0x80,0x00,0xb7,0x15,0x30,0x0a,0xff,0x01,0x25,0x80,0x00,0xf9,0xe1,0x15,0x4b,0x0a,0x0e,0xf4,0xff,0x00,0x7e,0x80,0x00,0xb7,0x15,0x30,0x0a,0xff,0x00,0xbb,0x80,0x00,0xf9,0xb7,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0x65,0xf7,0xb6,0xf7,0xb4,0x15,0x31,0x0a,0xf7,0x44,0xfa,0x04,0x15,0x46,0x0a,0x0e,0xbc,0xf8,0x98,0xff,0x02,0x0d,0x80,0x00,0x15,0xff,0xff,0xe0,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xac,0x5f,0xff,0x00,0x0c,0xd5,0x54,0xff,0xff,0xc7,0x55,0x56,0x8b,0x08,0xfb,0x39,0x8b,0xa6,0xf7,0x12,0x42,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xad,0xf7,0x33,0xf7,0x39,0x8b,0x05,0xff,0x00,0x45,0x55,0x56,0x8b,0xff,0x00,0x39,0xd5,0x54,0xff,0x00,0x12,0xd5,0x55,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x25,0xaa,0xab,0xff,0x00,0x2e,0x55,0x14,0xff,0x00,0x25,0xaa,0xab,0xff,0x00,0x1c,0xd5,0x54,0xff,0x00,0x33,0x2a,0xab,0xff,0x00,0x0b,0x55,0x98,0xff,0x00,0x40,0xaa,0xaa,0xff,0x00,0x03,0x55,0x54,0xff,0x00,0x12,0xaa,0x7a,0xff,0x00,0x01,0xaa,0xac,0xff,0x00,0x0f,0xaa,0xaa,0x8b,0xff,0x00,0x0c,0xaa,0xdc,0x8b,0xff,0x00,0x2f,0x55,0x56,0xff,0xff,0xf0,0x55,0x54,0xff,0x00,0x24,0x80,0x00,0xff,0xff,0xe0,0xaa,0xac,0xff,0x00,0x19,0xaa,0xaa,0x08,0x6f,0xff,0xff,0x83,0x80,0x00,0x15,0x8b,0xff,0xff,0xf5,0x55,0x56,0x8a,0xff,0xff,0xf4,0xaa,0xaa,0x89,0x7f,0x83,0x5b,0xff,0xff,0xec,0x80,0x00,0xff,0xff,0xdc,0x55,0x56,0x6c,0xff,0xff,0xe8,0xaa,0xaa,0x6c,0xff,0xff,0xe8,0xaa,0xab,0xff,0xff,0xd7,0xd5,0x56,0xff,0xff,0xf4,0x55,0x55,0xff,0xff,0xce,0xaa,0xaa,0x8b,0x08,0xfb,0x33,0x8b,0xc5,0xf7,0xa6,0xf7,0x33,0x8b,0x05,0xff,0x00,0x52,0xaa,0xaa,0xff,0x00,0x29,0x55,0x56,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xbe,0xaa,0xaa,0x1f,0x0e,0x73,0xf7,0x66,0xc5,0x15,0x7e,0x4d,0xa8,0x8b,0x05,0xff,0x00,0x2f,0x55,0x56,0x8b,0xb0,0xff,0x00,0x07,0x80,0x00,0xff,0x00,0x1a,0xaa,0xaa,0x9a,0xff,0x00,0x1a,0xaa,0x7c,0x9a,0xff,0x00,0x14,0xaa,0xaa,0xff,0x00,0x17,0x55,0x55,0xff,0x00,0x0e,0xaa,0xda,0xff,0x00,0x1f,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x1f,0xaa,0xaa,0x99,0xff,0x00,0x2d,0x80,0x00,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x3b,0x55,0x56,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x05,0xaa,0xaa,0xff,0x00,0x27,0x55,0x54,0x8b,0xff,0x00,0x1b,0x55,0x56,0x8b,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xfc,0x55,0x56,0x9c,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xf8,0xaa,0xc6,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xf3,0xaa,0xaa,0x96,0xff,0xff,0xee,0xaa,0x90,0xff,0x00,0x08,0xaa,0xaa,0x08,0xff,0x00,0x1e,0xaa,0xaa,0x99,0xff,0x00,0x17,0x80,0x00,0xff,0x00,0x14,0x80,0x00,0xff,0x00,0x10,0x55,0x56,0xa6,0xff,0x00,0x10,0x55,0x56,0xa6,0xff,0x00,0x08,0x2a,0xaa,0xff,0x00,0x1e,0x2a,0xac,0x8b,0xff,0x00,0x21,0x55,0x54,0x8b,0xaf,0xff,0xff,0xf2,0x2a,0xaa,0xff,0x00,0x1c,0xaa,0xac,0xff,0xff,0xe4,0x55,0x56,0xff,0x00,0x15,0x55,0x54,0xff,0xff,0xe4,0x55,0x56,0xff,0x00,0x15,0x55,0x54,0xff,0xff,0xd9,0x80,0x00,0xff,0x00,0x0a,0xaa,0xac,0xff,0xff,0xce,0xaa,0xaa,0x8b,0x4b,0x8b,0xff,0xff,0xce,0xd5,0x55,0x7b,0xff,0xff,0xdd,0xaa,0xab,0x6b,0xff,0xff,0xdd,0xaa,0xab,0x6b,0xff,0xff,0xe8,0x2a,0xaa,0xff,0xff,0xd0,0x55,0x54,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xc0,0xaa,0xac,0x08,0x20,0xfc,0x8e,0xcf,0x8b,0xf7,0x02,0xf8,0x97,0x05,0xff,0x00,0x08,0xaa,0xab,0xb5,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x1e,0x80,0x00,0xff,0x00,0x16,0xaa,0xab,0x9e,0xff,0x00,0x16,0xaa,0xaa,0x9e,0xff,0x00,0x1f,0x55,0x56,0xff,0x00,0x09,0x80,0x00,0xb3,0x8b,0xff,0x00,0x1e,0xaa,0xa8,0x8b,0xff,0x00,0x17,0x2a,0xaa,0xff,0xff,0xfa,0x2a,0xac,0xff,0x00,0x0f,0xaa,0xae,0xff,0xff,0xf4,0x55,0x54,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xf4,0x55,0x54,0xff,0x00,0x07,0xd5,0x56,0xff,0xff,0xef,0x2a,0xac,0x8b,0x75,0x8b,0xff,0xff,0xdd,0x55,0x54,0xff,0xff,0xf6,0x80,0x00,0xff,0xff,0xe4,0xaa,0xaa,0x78,0xff,0xff,0xec,0x00,0x02,0x78,0x77,0xff,0xff,0xe3,0xd5,0x56,0x81,0xff,0xff,0xda,0xaa,0xaa,0x8b,0x08,0x70,0x8b,0x7e,0x4d,0xa0,0x8b,0x05,0xff,0x00,0x1f,0x55,0x56,0x8b,0xa1,0xff,0xff,0xfa,0xaa,0xaa,0xff,0x00,0x0c,0xaa,0xaa,0xff,0xff,0xf5,0x55,0x56,0xff,0x00,0x0c,0xaa,0xaa,0xff,0xff,0xf5,0x55,0x56,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xee,0xaa,0xaa,0x8b,0x73,0x8b,0xff,0xff,0xea,0xaa,0xbc,0x86,0xff,0xff,0xde,0xaa,0xaa,0x81,0xff,0xff,0xd2,0xaa,0x9a,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xd1,0x55,0x5b,0xff,0xff,0xf6,0x80,0x00,0xff,0xff,0xdd,0xd5,0x55,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xea,0x55,0x50,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xf3,0xd5,0x56,0xff,0xff,0xef,0xd5,0x54,0x7b,0xff,0xff,0xf5,0x55,0x56,0x7b,0xff,0xff,0xf5,0x55,0x55,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe1,0x55,0x56,0x8b,0x08,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0xff,0xff,0xa7,0x80,0x00,0xf8,0xec,0x15,0x33,0x0a,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0xff,0x00,0x3e,0x80,0x00,0xf8,0xec,0x15,0x46,0x0a,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0xff,0x00,0x05,0x80,0x00,0xf8,0xf5,0x15,0x4b,0x0a,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0xff,0xff,0x94,0x80,0x00,0xf8,0xa9,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x57,0xac,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x53,0x00,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0x92,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xc4,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x54,0xb4,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x00,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x56,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xca,0x8b,0xff,0xff,0xf3,0x55,0x55,0xff,0xff,0xfc,0xd5,0x54,0xff,0xff,0xf3,0xff,0xe1,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0xff,0xff,0x9b,0x80,0x00,0xf8,0xcb,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0x77,0xff,0x00,0x4e,0x80,0x00,0xa7,0x15,0x34,0x0a,0xf7,0x75,0xd0,0x15,0x35,0x0a,0x5b,0xf8,0x7c,0x15,0x4c,0x0a,0xf1,0xa6,0x15,0xff,0xff,0xf6,0x55,0x56,0x81,0xff,0xff,0xf3,0xd5,0x54,0x86,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf3,0xaa,0xaa,0x90,0x81,0x95,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x55,0x2c,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x55,0x80,0x95,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0x56,0x8b,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xfa,0xd5,0x54,0xff,0x00,0x09,0xab,0x00,0xff,0xff,0xf5,0xaa,0xac,0x08,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0x00,0x04,0xd5,0x56,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0xff,0xff,0xfb,0x2a,0xaa,0xff,0xff,0xf3,0x55,0x54,0xff,0xff,0xf6,0x55,0x56,0x81,0x08,0x0e,0xf7,0xae,0xd5,0xff,0x00,0x19,0x80,0x00,0x15,0xff,0x00,0x1a,0xaa,0xaa,0x76,0xff,0x00,0x25,0xaa,0xab,0xff,0xff,0xf5,0x80,0x00,0xff,0x00,0x30,0xaa,0xab,0x8b,0xff,0x00,0x27,0x55,0x55,0x8b,0xff,0x00,0x22,0x2a,0xab,0xff,0x00,0x06,0xd5,0x55,0xa8,0xff,0x00,0x0d,0xaa,0xab,0xa8,0xff,0x00,0x0d,0xaa,0xab,0xff,0x00,0x19,0x2a,0xaa,0xff,0x00,0x13,0xd5,0x55,0xff,0x00,0x15,0x55,0x56,0xa5,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xca,0xaa,0xab,0xff,0x00,0x33,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x55,0xdb,0x8b,0xff,0x00,0x31,0x55,0x54,0x8b,0xb6,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x24,0xaa,0xac,0xa6,0xff,0x00,0x24,0xaa,0xac,0xa6,0xff,0x00,0x1a,0xaa,0xa8,0xff,0x00,0x28,0x80,0x00,0xff,0x00,0x10,0xaa,0xac,0xc1,0x08,0x48,0x06,0xff,0xff,0xf4,0xaa,0xac,0x69,0xff,0xff,0xee,0xd5,0x54,0xff,0xff,0xe6,0xaa,0xaa,0x74,0xff,0xff,0xef,0x55,0x56,0x74,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xe2,0xd5,0x54,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xac,0x8b,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0x72,0x92,0xff,0xff,0xed,0x55,0x56,0x99,0xff,0xff,0xed,0x55,0x56,0x99,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xaa,0x8b,0xff,0x00,0x1f,0x55,0x56,0x8b,0x97,0xff,0x00,0x00,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0a,0x55,0x54,0x8d,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x57,0x08,0x91,0xa9,0xf7,0xd0,0x8b,0x98,0xc7,0x05,0xff,0x00,0x05,0x55,0x54,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x02,0xaa,0xac,0xff,0x00,0x16,0xaa,0xaa,0x8b,0xa1,0x8b,0xbd,0xff,0xff,0xf2,0x55,0x54,0xff,0x00,0x24,0xd5,0x56,0xff,0xff,0xe4,0xaa,0xac,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xe4,0xaa,0xac,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xda,0x55,0x54,0xff,0x00,0x0b,0xd5,0x56,0x5b,0x8b,0xff,0xff,0xde,0xaa,0xac,0x8b,0xff,0xff,0xe0,0x55,0x54,0xff,0xff,0xfa,0x55,0x56,0x6d,0xff,0xff,0xf4,0xaa,0xaa,0x6d,0xff,0xff,0xf4,0xaa,0xaa,0x72,0xff,0xff,0xee,0x55,0x56,0x77,0x73,0xff,0xff,0xe8,0xaa,0xc4,0xff,0x00,0x2e,0xaa,0xaa,0xff,0xff,0xd0,0xaa,0xaa,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xb8,0xaa,0x92,0x8b,0x08,0xff,0xff,0xc8,0xaa,0xab,0x8b,0xff,0xff,0xd2,0x55,0x55,0x7e,0x67,0x71,0x67,0x71,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xdb,0xaa,0xaa,0xff,0xff,0xf6,0xaa,0xaa,0xff,0xff,0xd1,0x55,0x56,0x08,0xce,0x06,0x91,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x0d,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0x55,0x55,0x9b,0xff,0x00,0x15,0x55,0x55,0x9b,0xff,0x00,0x1c,0xaa,0xab,0x93,0xaf,0x8b,0xff,0x00,0x40,0xaa,0xaa,0x8b,0xff,0x00,0x20,0x55,0x56,0xff,0xff,0xe5,0xaa,0xaa,0x8b,0xff,0xff,0xcb,0x55,0x56,0x8b,0x7f,0xff,0xff,0xfa,0xaa,0xaa,0x6d,0xff,0xff,0xf5,0x55,0x56,0x5b,0x08,0xfb,0x18,0x06,0xff,0xff,0xd7,0x55,0x5b,0x8b,0xff,0xff,0xdb,0xd5,0x55,0x84,0xff,0xff,0xe0,0x55,0x50,0x7d,0xff,0xff,0xe0,0x55,0x56,0x7d,0xff,0xff,0xe7,0x55,0x54,0x77,0xff,0xff,0xee,0x55,0x56,0x71,0xff,0xff,0xee,0x55,0x56,0x71,0xff,0xff,0xf7,0x2a,0xaa,0xff,0xff,0xe2,0x55,0x55,0x8b,0xff,0xff,0xde,0xaa,0xab,0x8b,0xff,0xff,0xd7,0x55,0x56,0xff,0x00,0x0d,0x55,0x55,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x1a,0xaa,0xab,0xff,0xff,0xea,0xff,0xff,0x08,0xf8,0xfe,0xff,0x01,0x09,0x80,0x00,0x15,0xfb,0x8c,0x8b,0x90,0xa3,0x05,0xff,0x00,0x12,0xaa,0xaa,0xff,0x00,0x5b,0x55,0x56,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x2d,0xaa,0xaa,0xdf,0x8b,0xff,0x00,0x42,0xaa,0xac,0x8b,0xff,0x00,0x21,0x55,0x54,0xff,0xff,0xe2,0x55,0x56,0x8b,0xff,0xff,0xc4,0xaa,0xaa,0x8b,0x7b,0xff,0xff,0xfc,0x55,0x54,0x73,0xff,0xff,0xf8,0xaa,0xac,0x6b,0x08,0xff,0xfe,0x7a,0x80,0x00,0xfb,0x62,0x15,0xff,0xff,0xe7,0xaa,0xaa,0x73,0xff,0xff,0xdd,0x80,0x00,0x7f,0xff,0xff,0xd3,0x55,0x56,0x8b,0xff,0xff,0xde,0xaa,0xab,0x8b,0xff,0xff,0xe7,0x80,0x00,0xff,0x00,0x06,0x80,0x00,0xff,0xff,0xf0,0x55,0x55,0x98,0xff,0xff,0xf0,0x55,0x56,0x98,0xff,0xff,0xf8,0x2a,0xaa,0xff,0x00,0x13,0x2a,0xaa,0x8b,0xff,0x00,0x19,0x55,0x56,0x8b,0xff,0x00,0x21,0x55,0x55,0xff,0x00,0x0c,0x55,0x56,0xa6,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x22,0xaa,0xaa,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x2c,0xaa,0xab,0x8b,0x08,0xf7,0x0d,0x8b,0x82,0x62,0x05,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xcd,0x55,0x57,0xff,0xff,0xee,0x80,0x00,0xff,0xff,0xda,0xaa,0xab,0xff,0xff,0xe7,0xaa,0xaa,0xff,0xff,0xe7,0xff,0xfe,0x08,0x0e,0x71,0xf8,0x21,0xf7,0xe8,0x15,0xcd,0x06,0xff,0x00,0x00,0xaa,0xaa,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x00,0x55,0x56,0xff,0x00,0x08,0x55,0x54,0x8b,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x30,0xaa,0xaa,0xff,0xff,0xf2,0x55,0x56,0xb0,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x19,0x55,0x56,0x63,0xff,0x00,0x0c,0xaa,0xaa,0xff,0xff,0xcb,0x55,0x56,0x8b,0xff,0xff,0x82,0xaa,0xa9,0xff,0x00,0x00,0x00,0x10,0xff,0xff,0xb2,0x55,0x55,0xff,0xff,0xba,0xaa,0xaa,0xff,0xff,0xe2,0x00,0x02,0xff,0xff,0x75,0x55,0x46,0x08,0x76,0x29,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xea,0xaa,0xab,0x8b,0x77,0x8b,0x5d,0xff,0x00,0x0c,0x55,0x55,0x68,0xff,0x00,0x18,0xaa,0xab,0x73,0xff,0x00,0x18,0xaa,0xaa,0x73,0xff,0x00,0x21,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xab,0xff,0x00,0x2a,0xaa,0xab,0xff,0xff,0xfb,0x55,0x55,0x08,0x33,0xfb,0x26,0xd3,0x8b,0xd8,0xf7,0x25,0x05,0xbf,0xff,0x00,0x04,0xaa,0xab,0xff,0x00,0x2a,0x2a,0xaa,0xff,0x00,0x11,0x80,0x00,0xff,0x00,0x20,0x55,0x56,0xff,0x00,0x1e,0x55,0x55,0xff,0x00,0x20,0x55,0x56,0xff,0x00,0x1e,0x55,0x56,0xff,0x00,0x12,0xd5,0x54,0xff,0x00,0x27,0xd5,0x55,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x31,0x55,0x55,0x08,0x4a,0x06,0x85,0x67,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xe0,0x55,0x56,0xff,0xff,0xf6,0x55,0x56,0x63,0xff,0xff,0xff,0xff,0xfe,0x69,0x8b,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x07,0x55,0x55,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xab,0xff,0xff,0xec,0xaa,0xaa,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x19,0xaa,0xab,0x8b,0xff,0x00,0x24,0xaa,0xab,0x8b,0x9d,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0x08,0x9e,0xe5,0x05,0x97,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x1b,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1b,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x22,0x55,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x29,0x55,0x56,0x8b,0xff,0x00,0x21,0x55,0x56,0x8b,0xff,0x00,0x18,0xd5,0x54,0xff,0xff,0xf8,0x2a,0xaa,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x08,0x2a,0xaa,0xff,0xff,0xe8,0x2a,0xaa,0x8b,0x6b,0x08,0x0e,0x71,0xf8,0x36,0xff,0x01,0xdd,0x80,0x00,0x15,0x36,0x0a,0x73,0xff,0xff,0x8b,0x80,0x00,0x15,0x37,0x0a,0xfb,0x41,0xf7,0xe4,0x15,0x33,0x0a,0x0e,0x71,0xf8,0x36,0xff,0x01,0xdd,0x80,0x00,0x15,0x36,0x0a,0x73,0xff,0xff,0x8b,0x80,0x00,0x15,0x37,0x0a,0x75,0xf7,0xe4,0x15,0x46,0x0a,0x0e,0x71,0xf8,0x36,0xff,0x01,0xdd,0x80,0x00,0x15,0x36,0x0a,0x73,0xff,0xff,0x8b,0x80,0x00,0x15,0x37,0x0a,0x3c,0xf7,0xed,0x15,0x4b,0x0a,0x0e,0x71,0xf8,0x36,0xff,0x01,0xdd,0x80,0x00,0x15,0x36,0x0a,0x73,0xff,0xff,0x8b,0x80,0x00,0x15,0x37,0x0a,0xfb,0x4d,0xf7,0xc3,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xfb,0xcc,0xf7,0x15,0xf8,0x8f,0x15,0x39,0x0a,0xfb,0x05,0xf7,0x52,0x15,0x33,0x0a,0x0e,0xfb,0xcc,0xf7,0x15,0xf8,0x8f,0x15,0x39,0x0a,0xb1,0xf7,0x52,0x15,0x46,0x0a,0x0e,0xfb,0xcc,0xf7,0x15,0xf8,0x8f,0x15,0x39,0x0a,0x78,0xf7,0x5b,0x15,0x4b,0x0a,0x0e,0xfb,0xcc,0xf7,0x15,0xf8,0x8f,0x15,0x39,0x0a,0xfb,0x11,0xf7,0x31,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0x6a,0xf8,0x2d,0xf8,0x84,0x15,0x63,0xd9,0xe0,0xa3,0x88,0xc1,0x21,0x6d,0x68,0xcf,0x38,0x8b,0xb9,0x32,0x33,0x72,0x8e,0x55,0xf7,0x01,0xaa,0xbb,0x2e,0x05,0xff,0xff,0xee,0xaa,0xd2,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xe4,0xaa,0x84,0x8b,0xff,0xff,0xca,0xaa,0xab,0x8b,0xff,0xff,0xd2,0x2a,0xaa,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xd9,0xaa,0xab,0xff,0xff,0xdb,0x55,0x56,0xff,0xff,0xd9,0xaa,0xab,0xff,0xff,0xdb,0x55,0x56,0xff,0xff,0xe5,0x7f,0xff,0xff,0xff,0xcb,0xaa,0xaa,0xff,0xff,0xf1,0x55,0x56,0x47,0x08,0x7f,0x54,0x05,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe8,0xaa,0xab,0xff,0xff,0xfd,0x55,0x55,0xff,0xff,0xe8,0xaa,0xaa,0x8b,0xff,0xff,0xe8,0xaa,0xab,0x8b,0x5b,0xff,0x00,0x0c,0xd5,0x55,0xff,0xff,0xdb,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xab,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x19,0xaa,0xa7,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x25,0x80,0x00,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x31,0x55,0x59,0x8b,0xff,0x00,0x3c,0xaa,0xab,0x8b,0xff,0x00,0x32,0xff,0xff,0xff,0x00,0x12,0x80,0x00,0xff,0x00,0x29,0x55,0x56,0xb0,0xff,0x00,0x29,0x55,0x56,0xb0,0xa7,0xff,0x00,0x37,0x2a,0xaa,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x49,0x55,0x56,0x08,0x96,0xc2,0x05,0xff,0x00,0x05,0x55,0x56,0xa7,0xff,0x00,0x02,0xaa,0xaa,0xa4,0x8b,0xa1,0x8b,0xff,0x00,0x32,0xaa,0xaa,0x7e,0xff,0x00,0x33,0x55,0x56,0x71,0xbf,0x08,0x6b,0xfb,0x45,0x15,0x8b,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xaa,0x78,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0x08,0x80,0x53,0x05,0x81,0x59,0x79,0xff,0xff,0xda,0x80,0x00,0x71,0x72,0x71,0x72,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xf3,0x80,0x00,0xff,0xff,0xd8,0xaa,0xab,0x8b,0x4b,0xff,0xff,0xff,0xff,0xff,0x6b,0xff,0x00,0x1f,0xaa,0xab,0x8b,0xff,0x00,0x3f,0x55,0x56,0x8b,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x12,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xab,0x08,0x97,0xc4,0x05,0xff,0x00,0x14,0xaa,0xab,0xed,0xff,0x00,0x32,0xff,0xff,0xbc,0xff,0x00,0x51,0x55,0x56,0x8b,0xff,0x00,0x3e,0xaa,0xaa,0x8b,0xff,0x00,0x1f,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0x8b,0xff,0xff,0xc2,0xaa,0xaa,0x08,0x0e,0x84,0xf7,0x15,0xf8,0x8f,0x15,0x3b,0x0a,0x9b,0xf7,0x0f,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x57,0xac,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x53,0x00,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0x9e,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xb8,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x54,0xb4,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x04,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x52,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xfc,0xd5,0x54,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0x72,0xe0,0xff,0x00,0x1c,0x80,0x00,0x15,0x3c,0x0a,0xff,0x00,0xe1,0x80,0x00,0xc7,0x15,0x3d,0x0a,0xff,0xff,0xa8,0x80,0x00,0xff,0x02,0x60,0x80,0x00,0x15,0x33,0x0a,0x0e,0x72,0xe0,0xff,0x00,0x1c,0x80,0x00,0x15,0x3c,0x0a,0xff,0x00,0xe1,0x80,0x00,0xc7,0x15,0x3d,0x0a,0xff,0x00,0x3f,0x80,0x00,0xff,0x02,0x60,0x80,0x00,0x15,0x46,0x0a,0x0e,0x72,0xe0,0xff,0x00,0x1c,0x80,0x00,0x15,0x3c,0x0a,0xff,0x00,0xe1,0x80,0x00,0xc7,0x15,0x3d,0x0a,0xff,0x00,0x06,0x80,0x00,0xff,0x02,0x69,0x80,0x00,0x15,0x4b,0x0a,0x0e,0x72,0xe0,0xff,0x00,0x1c,0x80,0x00,0x15,0x3c,0x0a,0xff,0x00,0xe1,0x80,0x00,0xc7,0x15,0x3d,0x0a,0xff,0xff,0x95,0x80,0x00,0xff,0x02,0x1d,0x80,0x00,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x57,0xac,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x53,0x00,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0x78,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xde,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x54,0xb4,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x02,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x54,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x55,0xff,0xff,0xfc,0xd5,0x54,0xff,0xff,0xf4,0x00,0x01,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0x72,0xe0,0xff,0x00,0x1c,0x80,0x00,0x15,0x3c,0x0a,0xff,0x00,0xe1,0x80,0x00,0xc7,0x15,0x3d,0x0a,0xff,0xff,0x9c,0x80,0x00,0xff,0x02,0x3f,0x80,0x00,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xf7,0x77,0xf8,0x14,0x15,0xff,0x00,0x09,0x55,0x37,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0d,0x55,0x74,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xf6,0xaa,0xce,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0x88,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xaa,0x08,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xab,0x18,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0xff,0xff,0xf2,0xaa,0x3e,0x8b,0xff,0xff,0xf2,0xaa,0xc4,0xff,0x00,0x04,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x09,0x55,0x55,0xff,0xff,0xf6,0xaa,0x92,0x08,0xfb,0x39,0x40,0x15,0x49,0xf8,0x22,0xcd,0x07,0xfb,0x7d,0xfb,0x63,0x15,0xff,0x00,0x09,0x55,0x37,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0d,0x55,0x74,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0d,0x55,0x42,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x09,0x55,0x69,0xff,0xff,0xf6,0xaa,0xce,0xff,0x00,0x09,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xab,0xff,0xff,0xf2,0xaa,0x88,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xab,0x08,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf2,0xaa,0xb2,0xff,0x00,0x04,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x09,0x55,0x55,0xff,0xff,0xf6,0xaa,0xa4,0x08,0x0e,0x72,0xf8,0x4e,0xf8,0x5c,0x15,0xca,0xd8,0x60,0x8b,0x60,0x56,0x05,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xd8,0x55,0x56,0xff,0x00,0x0b,0x55,0x56,0x59,0x8b,0xff,0xff,0x86,0xaa,0xaa,0xff,0x00,0x00,0x00,0x10,0xff,0xff,0xb3,0xaa,0xaa,0xff,0xff,0xba,0xaa,0xaa,0xff,0xff,0xe0,0xaa,0xac,0xff,0xff,0x75,0x55,0x46,0x08,0x74,0x23,0x05,0xff,0xff,0xfa,0xaa,0xab,0x75,0xff,0xff,0xfd,0x55,0x55,0x75,0x8b,0x75,0x8b,0x67,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xe3,0x55,0x56,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xea,0xaa,0xaa,0x08,0x49,0x3b,0xb6,0x8b,0xb9,0xc4,0x05,0xff,0x00,0x1d,0x55,0x56,0x75,0xff,0x00,0x27,0xff,0xff,0x80,0xff,0x00,0x32,0xaa,0xab,0x8b,0xf7,0x0e,0x8b,0xff,0x00,0x4b,0xaa,0xaa,0xff,0x00,0x45,0x55,0x55,0xff,0x00,0x1d,0x55,0x56,0xff,0x00,0x8a,0xaa,0xab,0x08,0xa1,0xf3,0x05,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0x8b,0x9d,0x8b,0xff,0x00,0x20,0xaa,0x90,0x83,0xff,0x00,0x1b,0xaa,0xaa,0x7b,0xff,0x00,0x16,0xaa,0xc6,0x08,0xfb,0xda,0xfb,0xed,0x15,0xff,0xff,0xfc,0xaa,0xaa,0xff,0x00,0x0b,0xff,0xf8,0xff,0xff,0xfe,0x55,0x56,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x0d,0x55,0x5d,0x8b,0xff,0x00,0x11,0x55,0x55,0xff,0x00,0x02,0x55,0x56,0x9e,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0x08,0x9f,0xeb,0x05,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x13,0x80,0x00,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x1b,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1b,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x21,0x7f,0xff,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x27,0x55,0x56,0x8b,0xff,0x00,0x22,0xaa,0x80,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x10,0xaa,0xd6,0xff,0xff,0xee,0xaa,0xaa,0x08,0x9c,0x6b,0x15,0xff,0x00,0x02,0xaa,0xaa,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x01,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0x7d,0x8b,0x79,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0x08,0x77,0x2b,0x05,0xff,0xff,0xf4,0xaa,0xd6,0x53,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xd8,0xd5,0x56,0xff,0xff,0xe4,0xaa,0x80,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe4,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xda,0x00,0x01,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xff,0xff,0xfe,0x71,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x10,0xaa,0xac,0x08,0x0e,0x84,0xff,0x00,0x5f,0x80,0x00,0xa8,0x15,0x3f,0x0a,0xff,0x00,0x8c,0x80,0x00,0xf9,0x30,0x15,0x33,0x0a,0x0e,0x84,0xff,0x00,0x5f,0x80,0x00,0xa8,0x15,0x3f,0x0a,0xff,0x01,0x23,0x80,0x00,0xf9,0x30,0x15,0x46,0x0a,0x0e,0x84,0xff,0x00,0x5f,0x80,0x00,0xa8,0x15,0x3f,0x0a,0xff,0x00,0xea,0x80,0x00,0xf9,0x39,0x15,0x4b,0x0a,0x0e,0x84,0xff,0x00,0x5f,0x80,0x00,0xa8,0x15,0x3f,0x0a,0xff,0x00,0x80,0x80,0x00,0xf9,0x0f,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0x31,0xf8,0x74,0xf8,0x8f,0x15,0x40,0x0a,0xf7,0x40,0xf9,0x84,0x15,0x46,0x0a,0x0e,0xf7,0x3c,0xf9,0x46,0x15,0xfb,0x47,0xfd,0xde,0xcf,0x8b,0xb9,0xf7,0x6f,0x05,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xcf,0x55,0x55,0xff,0x00,0x28,0xaa,0xaa,0xff,0xff,0xe7,0xaa,0xab,0xcb,0x8b,0xff,0x00,0x31,0x55,0x56,0x8b,0xff,0x00,0x2c,0x2a,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xb2,0xff,0x00,0x21,0x55,0x56,0xb2,0xff,0x00,0x21,0x55,0x54,0xff,0x00,0x1b,0x80,0x00,0xff,0x00,0x34,0xaa,0xab,0x9b,0xff,0x00,0x48,0x00,0x01,0x08,0xa0,0xea,0x05,0xff,0x00,0x06,0xaa,0xaa,0xff,0x00,0x1e,0xaa,0x96,0xff,0x00,0x03,0x55,0x56,0xff,0x00,0x19,0xaa,0xaa,0x8b,0xff,0x00,0x14,0xaa,0xc0,0x8b,0xbb,0xff,0xff,0xf3,0x2a,0xaa,0xff,0x00,0x23,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xdd,0xd5,0x54,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xd5,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0xff,0xff,0xe4,0xd5,0x56,0xff,0xff,0xf9,0x55,0x56,0x72,0xff,0xff,0xf2,0xaa,0xaa,0x72,0xff,0xff,0xf2,0xaa,0xe6,0xff,0xff,0xe9,0xd5,0x55,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xab,0xff,0xff,0xe6,0xaa,0x70,0x08,0xc1,0xf7,0x92,0x05,0xdc,0xff,0xfd,0xa8,0x80,0x00,0x15,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xe8,0x55,0x56,0xff,0xff,0xe2,0x55,0x56,0xff,0xff,0xf4,0x2a,0xaa,0x69,0x8b,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xff,0xff,0xfe,0x72,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x12,0xaa,0xac,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x19,0x55,0x56,0x8b,0xab,0x8b,0xff,0x00,0x11,0x55,0x55,0x8e,0xff,0x00,0x16,0xaa,0xab,0x91,0xa7,0x08,0x9a,0xd0,0x05,0x95,0xff,0x00,0x2e,0xaa,0x94,0xff,0x00,0x12,0x80,0x00,0xff,0x00,0x25,0xaa,0xaa,0xa6,0xff,0x00,0x1c,0xaa,0xc2,0xff,0x00,0x1a,0xff,0xf1,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x21,0xd5,0x55,0xff,0x00,0x0e,0x55,0x56,0xff,0x00,0x28,0xaa,0xba,0x8b,0xff,0x00,0x3c,0xaa,0xaa,0x8b,0xff,0x00,0x1e,0x55,0x56,0x6c,0x8b,0x4d,0x8b,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xaa,0x78,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0x08,0x77,0x2d,0x05,0x7f,0xff,0xff,0xc9,0x55,0x55,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xd8,0xd5,0x55,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xe8,0x55,0x56,0x08,0x0e,0x31,0xf8,0x74,0xf8,0x8f,0x15,0x40,0x0a,0x94,0xf9,0x63,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xfb,0xcc,0xf7,0x15,0xf8,0x8f,0x15,0x39,0x0a,0x0e,0xf8,0x36,0xf9,0x04,0xf9,0x04,0x15,0xf7,0xee,0x8b,0x99,0xcd,0xfc,0x37,0x8b,0x80,0x55,0x05,0xff,0xff,0xdc,0xaa,0xac,0xb5,0xff,0xff,0xc8,0xff,0xfe,0xa0,0xff,0xff,0xb5,0x55,0x56,0x8b,0xfb,0x2c,0x8b,0xff,0xff,0xa1,0x55,0x55,0x33,0xff,0xff,0xda,0xaa,0xab,0xfb,0x44,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0x70,0x8b,0x73,0x8b,0xff,0xff,0xc1,0x55,0x55,0xff,0x00,0x12,0x55,0x55,0xff,0xff,0xd1,0xd5,0x55,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xe2,0x55,0x56,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x31,0xaa,0xaa,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x3e,0xaa,0xab,0x8b,0xff,0x00,0x42,0xaa,0xaa,0x8b,0xc2,0x9c,0xff,0x00,0x2b,0x55,0x56,0xad,0x08,0x82,0x60,0xf8,0x37,0x8b,0x9a,0xcd,0xfb,0xef,0x8b,0xc1,0xf7,0x90,0xf7,0xbc,0x8b,0x99,0xcd,0xfb,0xbc,0x8b,0x05,0xfb,0x42,0xfb,0xab,0x15,0x2e,0x0a,0x0e,0xf7,0xb9,0xf9,0x75,0xff,0x01,0xdd,0x80,0x00,0x15,0xff,0xff,0xe2,0xaa,0xac,0xff,0x00,0x18,0x55,0x56,0x64,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xcf,0x55,0x54,0x8b,0xff,0xff,0xb9,0x55,0x54,0x8b,0xff,0xff,0xc7,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xd6,0x00,0x02,0xff,0xff,0xce,0xaa,0xaa,0x7f,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xed,0x2a,0xaa,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0x97,0xff,0xff,0xe6,0x55,0x56,0x97,0xff,0xff,0xe1,0xd5,0x54,0x91,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xc5,0x55,0x55,0x8b,0xff,0xff,0xce,0x2a,0xab,0xff,0xff,0xef,0x55,0x56,0x62,0xff,0xff,0xde,0xaa,0xaa,0x62,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xe3,0xd5,0x56,0xff,0xff,0xcb,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0x43,0x08,0x75,0x23,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xea,0xaa,0xab,0x8b,0x77,0x8b,0x59,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xdb,0x80,0x00,0xff,0x00,0x1d,0x55,0x56,0x74,0xff,0x00,0x1d,0x55,0x56,0x74,0xff,0x00,0x27,0xaa,0xaa,0xff,0xff,0xf4,0x80,0x00,0xbd,0x8b,0xd5,0x8b,0xff,0x00,0x39,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x33,0x55,0x55,0xff,0x00,0x0d,0x55,0x56,0x71,0xff,0x00,0x13,0xd5,0x54,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x1a,0x55,0x56,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x1a,0x55,0x56,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x1e,0xd5,0x54,0xff,0xff,0xf9,0xaa,0xab,0xff,0x00,0x23,0x55,0x56,0x8b,0x08,0xff,0x00,0x38,0xaa,0xac,0x8b,0xff,0x00,0x2e,0x80,0x00,0x99,0xff,0x00,0x24,0x55,0x54,0xa7,0xff,0x00,0x24,0x55,0x54,0xa7,0xff,0x00,0x17,0x80,0x00,0xb3,0xff,0x00,0x0a,0xaa,0xac,0xbf,0x08,0x49,0x06,0xff,0xff,0xf7,0x55,0x54,0xff,0xff,0xdf,0x55,0x57,0x7b,0x72,0xff,0xff,0xe8,0xaa,0xac,0xff,0xff,0xee,0xaa,0xa9,0xff,0xff,0xe8,0xaa,0xac,0xff,0xff,0xee,0xaa,0xac,0x6e,0xff,0xff,0xf7,0x55,0x56,0xff,0xff,0xdd,0x55,0x54,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xde,0xaa,0xaa,0x8b,0xff,0xff,0xe5,0xd5,0x56,0xff,0x00,0x07,0x2a,0xab,0x78,0xff,0x00,0x0e,0x55,0x55,0x78,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x18,0xd5,0x55,0x8b,0xff,0x00,0x23,0x55,0x55,0x8b,0x9d,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0x08,0x91,0xaa,0xf7,0xd1,0x8b,0x97,0xc5,0x05,0xff,0x00,0x05,0x55,0x54,0xff,0x00,0x1a,0xaa,0x96,0xff,0x00,0x02,0xaa,0xac,0xff,0x00,0x16,0xaa,0xaa,0x8b,0xff,0x00,0x12,0xaa,0xc0,0x8b,0xbd,0xff,0xff,0xf1,0x55,0x54,0xff,0x00,0x25,0x2a,0xaa,0xff,0xff,0xe2,0xaa,0xac,0xff,0x00,0x18,0x55,0x56,0x08,0xff,0xfe,0x55,0x80,0x00,0xfc,0x19,0x15,0x3d,0x0a,0xff,0x01,0x92,0x80,0x00,0xff,0x01,0x10,0x80,0x00,0x15,0x8b,0xff,0xff,0xf1,0x55,0x56,0x89,0xff,0xff,0xee,0xaa,0xaa,0x87,0x77,0x08,0x87,0x79,0xfb,0x8c,0x8b,0x8d,0x96,0x05,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x13,0x55,0x54,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x1b,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1b,0x55,0x54,0xff,0x00,0x16,0x55,0x56,0xac,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x26,0xaa,0xac,0x8b,0xff,0x00,0x1f,0x55,0x04,0x8b,0xff,0x00,0x18,0x55,0x54,0x84,0xff,0x00,0x11,0x55,0xa8,0x7d,0xff,0x00,0x11,0x55,0x54,0x7d,0xff,0x00,0x08,0xaa,0xac,0xff,0xff,0xe8,0xaa,0xaa,0x8b,0xff,0xff,0xdf,0x55,0x56,0x08,0x0e,0x9f,0xd3,0xb0,0x15,0x2f,0x0a,0xf7,0x50,0xf9,0xe9,0x15,0x4d,0x0a,0x0e,0x4b,0xce,0xff,0x00,0x21,0x80,0x00,0x15,0x3e,0x0a,0xf7,0x00,0xff,0x02,0xa1,0x80,0x00,0x15,0x4d,0x0a,0x0e,0x65,0xf7,0xb6,0xf7,0xb4,0x15,0x31,0x0a,0x98,0xf9,0xe3,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0x82,0xf8,0xc0,0xf9,0x04,0x15,0x32,0x0a,0xf7,0x44,0xf9,0xcc,0x15,0x4d,0x0a,0x0e,0x42,0xf8,0x4a,0xf8,0x50,0x15,0x41,0x0a,0xdd,0xf9,0x18,0x15,0x4d,0x0a,0x0e,0xfb,0x0f,0x51,0x35,0x15,0x7c,0x49,0xa8,0x8b,0x05,0xbb,0x8b,0xff,0x00,0x25,0xd5,0x56,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x1b,0xaa,0xaa,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x1b,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x17,0xd5,0x56,0xff,0x00,0x26,0xd5,0x55,0x9f,0xff,0x00,0x37,0x55,0x55,0x08,0xf7,0x13,0xf7,0xf1,0xf7,0x07,0x8b,0x98,0xca,0x22,0x8b,0xbc,0xf7,0x19,0x05,0xff,0x00,0x0a,0xaa,0xaa,0xa9,0xff,0x00,0x0c,0xd5,0x56,0xa0,0x9a,0x97,0x9a,0x97,0xff,0x00,0x14,0x2a,0xaa,0x91,0xff,0x00,0x19,0x55,0x56,0x8b,0x08,0xad,0x8b,0x99,0xcd,0x6b,0x8b,0x05,0x5b,0x8b,0xff,0xff,0xd9,0xd5,0x56,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xe3,0xaa,0xaa,0x74,0xff,0xff,0xe3,0xaa,0xbe,0x74,0xff,0xff,0xe8,0x2a,0xaa,0xff,0xff,0xda,0x2a,0xac,0xff,0xff,0xec,0xaa,0x98,0xff,0xff,0xcb,0x55,0x54,0x08,0x5b,0xfb,0x18,0x2c,0x8b,0x7e,0x4c,0xe0,0x8b,0xfb,0x13,0xfb,0xf3,0x05,0x7f,0x6b,0xff,0xff,0xf2,0xd5,0x55,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xf1,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xeb,0x80,0x00,0xff,0xff,0xfa,0x55,0x56,0xff,0xff,0xe5,0x55,0x55,0x8b,0x08,0x0e,0x60,0xf7,0xd2,0xf9,0x56,0x15,0x4b,0x0a,0x0e,0x6d,0xf7,0x68,0xf9,0x57,0x15,0x4d,0x0a,0x0e,0x6d,0xf7,0xb4,0xf9,0x3c,0x15,0x3a,0x0a,0x0e,0x6d,0xff,0x01,0x0c,0x80,0x00,0xf8,0xdd,0x15,0x4c,0x0a,0xf1,0xa6,0x15,0xff,0xff,0xf6,0x55,0x56,0x81,0xff,0xff,0xf3,0xd5,0x54,0x86,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf3,0xaa,0xaa,0x90,0x81,0x95,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x55,0x2c,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x55,0x80,0x95,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0x52,0x8b,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xfa,0xd5,0x54,0xff,0x00,0x09,0xab,0x04,0xff,0xff,0xf5,0xaa,0xac,0x08,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xac,0xff,0x00,0x04,0xd5,0x56,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0xff,0xff,0xfb,0x2a,0xaa,0xff,0xff,0xf3,0x55,0x54,0xff,0xff,0xf6,0x55,0x56,0x81,0x08,0x0e,0x60,0xf7,0x62,0xf9,0x0a,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x57,0xac,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x53,0x00,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0x78,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xde,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x54,0xb4,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0x8e,0xff,0xff,0xf8,0xab,0x02,0x8e,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0x54,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xfc,0xd5,0x54,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0xfc,0xa6,0x72,0xf9,0x4d,0x15,0x33,0x0a,0x0e,0xfc,0xa6,0xf7,0x12,0xf9,0x4d,0x15,0x46,0x0a,0x0e,0xfc,0xa6,0xd0,0xf9,0x56,0x15,0x4b,0x0a,0x0e,0xfc,0xa6,0x5f,0xf9,0x0a,0x15,0x7e,0x4e,0x05,0xff,0x00,0x10,0xaa,0xac,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x02,0xd5,0x54,0x97,0x8b,0x93,0x8b,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x57,0xac,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x0a,0xaa,0xab,0xff,0xff,0xf9,0x53,0x00,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x09,0x55,0x56,0x86,0x93,0xff,0xff,0xfc,0xaa,0xac,0x93,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0x08,0xff,0x00,0x18,0xaa,0xab,0x8b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x18,0xaa,0xac,0x08,0x98,0xc8,0x05,0xff,0xff,0xef,0x55,0x55,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xf5,0xaa,0xab,0xff,0xff,0xfa,0x54,0xb4,0xff,0xff,0xf5,0xaa,0xab,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf4,0xd5,0x55,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf7,0x55,0x5d,0x8b,0x83,0xff,0x00,0x01,0x80,0x00,0xff,0xff,0xf8,0xaa,0xa3,0x8e,0xff,0xff,0xf8,0xaa,0xb1,0x8e,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x04,0xd5,0x54,0xff,0xff,0xf6,0xaa,0xa4,0xff,0x00,0x06,0xaa,0xac,0x81,0xff,0x00,0x06,0xaa,0xac,0x82,0x90,0x83,0xff,0x00,0x03,0x55,0x54,0x83,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0xaa,0xab,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x55,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf3,0x55,0x55,0xff,0xff,0xfc,0xd5,0x54,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7f,0xff,0xff,0xf9,0xaa,0xac,0x7e,0xff,0xff,0xf6,0x80,0x00,0x7d,0xff,0xff,0xf3,0x55,0x54,0x08,0x0e,0xfc,0xa6,0x66,0xf9,0x2c,0x15,0x42,0x0a,0xea,0x16,0x42,0x0a,0x0e,0xfc,0xa6,0xff,0x00,0x12,0x80,0x00,0xf8,0xdd,0x15,0x9c,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x15,0xd5,0x55,0xff,0xff,0xf7,0x55,0x54,0xff,0x00,0x1a,0xaa,0xab,0x8b,0xff,0x00,0x19,0xff,0xfc,0x8b,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x08,0xaa,0xac,0xff,0x00,0x11,0x55,0x59,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x11,0x55,0x55,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x15,0xaa,0xac,0x8b,0xa5,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xf7,0x55,0x55,0xa1,0xff,0xff,0xee,0xaa,0xab,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xee,0xaa,0xab,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xea,0x55,0x55,0xff,0x00,0x08,0xaa,0xac,0x71,0x8b,0xff,0xff,0xe5,0x55,0x56,0x8b,0xff,0xff,0xea,0x2a,0xaa,0xff,0xff,0xf7,0x55,0x54,0x7a,0xff,0xff,0xee,0xaa,0xac,0x08,0x7a,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x8b,0x71,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xea,0x55,0x54,0x9c,0xff,0xff,0xee,0xaa,0xac,0x08,0xff,0x00,0x66,0x80,0x00,0xa6,0x15,0x81,0x81,0xff,0xff,0xf3,0xaa,0xaa,0x86,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf3,0xaa,0xaa,0x90,0x81,0x95,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x55,0x2c,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x55,0x80,0xff,0x00,0x09,0xff,0xfe,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xac,0x8b,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xfa,0xd5,0x54,0x95,0xff,0xff,0xf5,0xaa,0xac,0x08,0x95,0xff,0xff,0xf5,0xaa,0xac,0x90,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x86,0xff,0xff,0xf3,0x55,0x54,0x81,0x81,0x08,0x0e,0xfb,0x05,0xa6,0xf8,0x10,0x15,0x7d,0x49,0xf8,0x35,0x8b,0x99,0xcd,0x05,0x0e,0xf7,0xc3,0xa6,0xf8,0x10,0x15,0x7d,0x49,0xf9,0xd5,0x8b,0x99,0xcd,0x05,0x0e,0xfb,0xf8,0xf7,0x3a,0xf8,0x6f,0x15,0x4e,0x0a,0xca,0xf7,0x6b,0x15,0x0e,0xfb,0xf8,0xf7,0x27,0xf9,0x46,0x15,0x26,0x0a,0x0e,0xfb,0xf8,0x9f,0xe8,0x15,0x26,0x0a,0x0e,0xfb,0x6d,0xf7,0x3b,0xf8,0x6f,0x15,0x4e,0x0a,0xf7,0x60,0x16,0x4e,0x0a,0x48,0xf7,0x6b,0x15,0x0e,0xfb,0x6d,0xf7,0x28,0xf9,0x47,0x15,0x26,0x0a,0xd3,0x16,0x26,0x0a,0x0e,0xfb,0x6f,0xf7,0x31,0xe8,0x15,0x26,0x0a,0xfb,0x5e,0x16,0x26,0x0a,0x0e,0x88,0xf8,0x73,0xf8,0x11,0x15,0x99,0xcc,0xfb,0x2c,0x8b,0xbf,0xf7,0x88,0x43,0x8b,0x57,0xfb,0x88,0xfb,0x2d,0x8b,0x7d,0x4a,0xf7,0x2d,0x8b,0xfb,0x06,0xfc,0xa9,0xd5,0x8b,0xf7,0x05,0xf8,0xa9,0x05,0x0e,0x88,0xf7,0xdd,0xf8,0x14,0x15,0xf7,0x2b,0x8b,0x99,0xcd,0xfb,0x2b,0x8b,0xbe,0xf7,0x84,0x42,0x8b,0x58,0xfb,0x84,0xfb,0x2d,0x8b,0x7d,0x49,0xf7,0x2d,0x8b,0x5b,0xfb,0x77,0xfb,0x2d,0x8b,0x7d,0x49,0xf7,0x2d,0x8b,0x57,0xfb,0x87,0xd4,0x8b,0x05,0xbf,0xf7,0x87,0xf7,0x2b,0x8b,0x99,0xcd,0xfb,0x2b,0x8b,0x05,0x0e,0x57,0xf7,0x37,0xff,0x00,0xdc,0x80,0x00,0x15,0xff,0x00,0x17,0x55,0x49,0x74,0xff,0x00,0x1d,0x55,0x55,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x23,0x55,0x62,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x1d,0x2a,0xaa,0xff,0x00,0x0b,0x80,0x00,0xa2,0xa2,0xa2,0xa2,0xff,0x00,0x0b,0x80,0x00,0xff,0x00,0x1d,0x2a,0xaa,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x23,0x55,0x56,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x1d,0x2a,0xaa,0x74,0xa2,0x74,0xa2,0xff,0xff,0xe2,0xd5,0x56,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xe8,0xaa,0xab,0x74,0x08,0xff,0xff,0xe8,0xaa,0xab,0x74,0xff,0xff,0xf4,0x55,0x55,0xff,0xff,0xe2,0xd5,0x56,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x0b,0xaa,0xaa,0xff,0xff,0xe2,0xd5,0x55,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xe9,0x00,0x01,0x08,0x0e,0xf7,0x47,0xb4,0xe7,0x15,0x27,0x0a,0xf8,0x11,0x16,0x27,0x0a,0xfb,0xd8,0x16,0x27,0x0a,0x0e,0xf9,0x60,0xde,0xf7,0xfa,0x15,0x21,0x0a,0xf8,0xf7,0xf7,0xe0,0x15,0x22,0x0a,0xfc,0x98,0xfb,0xec,0x15,0x23,0x0a,0xf7,0xd3,0xfb,0x99,0x15,0x24,0x0a,0xf7,0xf8,0x16,0xff,0xff,0xc3,0x55,0x55,0xff,0x00,0x21,0x55,0x54,0xff,0xff,0xe1,0xaa,0xab,0xff,0x00,0x42,0xaa,0xac,0x1e,0xb5,0x8b,0xac,0xff,0x00,0x0c,0x55,0x55,0xa3,0xff,0x00,0x18,0xaa,0xab,0xa3,0xff,0x00,0x18,0xaa,0xaa,0x9c,0xb0,0x95,0xff,0x00,0x31,0x55,0x56,0x08,0xa8,0xf7,0x1f,0x05,0x8f,0x9f,0x8d,0x9d,0x8b,0x9b,0x8b,0xff,0x00,0x3b,0x55,0x56,0xff,0xff,0xde,0xaa,0xa8,0xff,0x00,0x1d,0xaa,0xaa,0xff,0xff,0xbd,0x55,0x58,0x8b,0x63,0x8b,0xff,0xff,0xdf,0xd5,0x58,0x7f,0xff,0xff,0xe7,0xaa,0xa8,0x73,0xff,0xff,0xe7,0xaa,0xac,0x73,0xff,0xff,0xee,0xd5,0x54,0xff,0xff,0xdc,0x55,0x56,0x81,0xff,0xff,0xd0,0xaa,0xaa,0x08,0x6d,0xfb,0x1f,0x05,0xff,0xff,0xfb,0x55,0x54,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xac,0x78,0x8b,0xff,0xff,0xed,0x55,0x56,0x08,0xfb,0x5b,0x7f,0x15,0x25,0x0a,0xf7,0xf8,0x16,0x81,0x7d,0xff,0xff,0xf0,0xaa,0xa8,0x84,0xff,0xff,0xeb,0x55,0x58,0x8b,0xff,0xff,0xf1,0x57,0x4c,0x8b,0xff,0xff,0xf5,0x55,0x54,0xff,0x00,0x03,0x55,0x55,0xff,0xff,0xf9,0x53,0x60,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x06,0xaa,0xa6,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0xb0,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x02,0x55,0x54,0x9c,0xff,0x00,0x04,0xaa,0xac,0xff,0x00,0x17,0x55,0x56,0x08,0xa7,0xf7,0x16,0x05,0xff,0x00,0x06,0xaa,0xa8,0xff,0x00,0x20,0xaa,0xa6,0xff,0x00,0x08,0x55,0x58,0xff,0x00,0x17,0x2a,0xaa,0x95,0xff,0x00,0x0d,0xaa,0xb0,0x95,0xff,0x00,0x0d,0xaa,0xaa,0x9a,0xff,0x00,0x06,0xd5,0x56,0x9f,0x8b,0xff,0x00,0x0e,0xa6,0x58,0x8b,0xff,0x00,0x0a,0xaa,0xa8,0xff,0xff,0xfc,0xaa,0xaa,0xff,0x00,0x06,0xaf,0x00,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x06,0xaa,0xa8,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x03,0x55,0x58,0xff,0xff,0xf5,0xaa,0xaa,0x8b,0x7d,0x8b,0xff,0xff,0xf6,0xaa,0xd2,0xff,0xff,0xfd,0xaa,0xa8,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x58,0xff,0xff,0xe8,0xaa,0x84,0x08,0x70,0xfb,0x16,0x05,0xff,0xff,0xf9,0x55,0x58,0x69,0xff,0xff,0xf7,0xaa,0xa8,0x73,0x81,0x7d,0x08,0x0e,0xfb,0x7f,0xa6,0xf7,0x9c,0x15,0x43,0x0a,0x0e,0xfb,0x7e,0xc1,0xf7,0x29,0x15,0x48,0x0a,0x0e,0xa3,0xff,0x00,0x89,0x80,0x00,0xa9,0x15,0xff,0x00,0x1d,0xaa,0xab,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x29,0xd5,0x55,0xff,0xff,0xf2,0xaa,0xab,0xc1,0x8b,0xff,0x00,0x32,0xaa,0x96,0x8b,0xff,0x00,0x2a,0xaa,0xaa,0xff,0x00,0x0d,0xd5,0x55,0xff,0x00,0x22,0xaa,0xc0,0xff,0x00,0x1b,0xaa,0xab,0xff,0x00,0x22,0xaa,0xaa,0xff,0x00,0x1b,0xaa,0xaa,0xa4,0xff,0x00,0x27,0x2a,0xab,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x32,0xaa,0xab,0x08,0x46,0x06,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xe1,0x55,0x56,0x7b,0xff,0xff,0xe8,0xd5,0x54,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xf0,0x55,0x55,0x70,0xff,0xff,0xf8,0x2a,0xab,0xff,0xff,0xde,0xaa,0xaa,0x8b,0x69,0x8b,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x17,0x55,0x54,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x10,0xaa,0xab,0x8d,0xff,0x00,0x11,0x55,0x55,0x8f,0x9d,0x08,0x96,0xbe,0xf7,0x40,0x8b,0xa1,0xc4,0xfb,0x4a,0x8b,0x9a,0xd3,0xf7,0x58,0x8b,0xa2,0xc3,0xfb,0x63,0x8b,0x96,0xc0,0x05,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x2c,0xaa,0xac,0xff,0x00,0x0f,0xd5,0x55,0xff,0x00,0x22,0xaa,0xa8,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0xff,0x00,0x21,0x2a,0xaa,0xff,0x00,0x0c,0x55,0x54,0xb7,0x8b,0x08,0xcd,0xac,0x6c,0x4d,0x1f,0xcd,0x06,0x8b,0xff,0x00,0x34,0xaa,0xac,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x27,0xaa,0xa8,0x70,0xff,0x00,0x1a,0xaa,0xac,0x70,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xd8,0x80,0x00,0xff,0x00,0x0d,0x55,0x54,0x57,0x8b,0x4f,0x8b,0xff,0xff,0xce,0xaa,0xaa,0xff,0xff,0xec,0xd5,0x54,0xff,0xff,0xd9,0x55,0x56,0xff,0xff,0xd9,0xaa,0xac,0xff,0xff,0xd9,0x55,0x55,0xff,0xff,0xd9,0xaa,0xac,0x71,0xff,0xff,0xcd,0xd5,0x54,0xff,0xff,0xf2,0xaa,0xab,0x4d,0x08,0x80,0x57,0x4f,0x8b,0x7f,0x53,0xc7,0x8b,0x7c,0x43,0x4f,0x8b,0x7f,0x52,0xc7,0x8b,0x81,0x5a,0x05,0xff,0xff,0xfa,0xaa,0xaa,0xff,0xff,0xe6,0xaa,0xab,0xff,0xff,0xfd,0x55,0x56,0x74,0x8b,0xff,0xff,0xeb,0x55,0x55,0x8b,0xff,0xff,0xd3,0x55,0x55,0xff,0x00,0x0e,0xd5,0x56,0xff,0xff,0xdc,0x55,0x55,0xff,0x00,0x1d,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x56,0x08,0x0e,0xf8,0x09,0xf7,0x8c,0xf9,0x11,0x15,0xfb,0xe9,0xc6,0xf7,0xe9,0xf7,0x06,0xc0,0xfb,0xb4,0x56,0x07,0xf7,0xf9,0xc0,0x15,0xfc,0x1e,0xc3,0xf7,0x99,0x8d,0x07,0xe7,0xfb,0x5f,0xb6,0x8b,0xe6,0xf7,0x5f,0x8d,0x8b,0x8b,0xfb,0x99,0xc3,0x8b,0x8b,0xf8,0x1e,0x55,0x8b,0xfb,0x06,0xfb,0x9c,0x88,0x8b,0xfb,0x09,0xf7,0x9c,0x05,0x0e,0x9b,0xf7,0x8e,0xf8,0xcb,0x15,0x38,0x0a,0xf7,0x70,0x16,0x39,0x0a,0x6a,0xf7,0x41,0x15,0x3a,0x0a,0x0e,0xd2,0xf7,0x8e,0xf8,0xcb,0x15,0x38,0x0a,0xf7,0x35,0xfc,0x78,0x15,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf0,0xaa,0xab,0xff,0x00,0x19,0x55,0x54,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x21,0x55,0x56,0x8b,0x08,0xbb,0x8b,0x98,0xc9,0x62,0x8b,0x05,0xff,0xff,0xee,0xaa,0xe6,0x8b,0xff,0xff,0xf3,0x2a,0xaa,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf7,0xaa,0x70,0x92,0xff,0xff,0xf7,0xaa,0xaa,0x92,0xff,0xff,0xfb,0xd5,0x56,0xff,0x00,0x0b,0x2a,0xaa,0x8b,0xff,0x00,0x0f,0x55,0x56,0x8b,0x95,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x0a,0x55,0x56,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0x08,0xf7,0x09,0xf8,0xbd,0x47,0x8b,0xfb,0x0b,0xfc,0xc1,0x05,0xff,0xff,0xfc,0xaa,0xaa,0x79,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf1,0xaa,0xaa,0x8b,0xff,0xff,0xf5,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xab,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf0,0xaa,0xab,0x08,0x0e,0xfc,0xa6,0x0e,0xd1,0x0e,0xf6,0xf8,0x51,0xf7,0x15,0x15,0xd0,0xf7,0xd8,0xf7,0x07,0x8b,0x96,0xc1,0xfb,0x07,0x8b,0xab,0xf7,0x28,0x40,0x6b,0x72,0xfb,0x08,0xfb,0x6e,0x8b,0xab,0xf7,0x28,0x40,0x6b,0x72,0xfb,0x08,0x3c,0x8b,0x80,0x55,0xda,0x8b,0x45,0xfb,0xdb,0x05,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfe,0xaa,0xaa,0x7f,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0x6f,0xff,0x00,0x08,0xaa,0xaa,0x75,0xff,0x00,0x11,0x55,0x56,0x7b,0xff,0x00,0x11,0x55,0x55,0x7b,0xff,0x00,0x18,0xaa,0xab,0x83,0xab,0x8b,0x08,0xbe,0x8b,0x98,0xc7,0x63,0x8b,0x05,0x67,0x79,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x1e,0xaa,0xab,0x1f,0x8b,0xff,0x00,0x06,0xaa,0xa4,0x8c,0xff,0x00,0x07,0xaa,0xaa,0x8d,0xff,0x00,0x08,0xaa,0xb2,0x08,0xd0,0xf7,0xd8,0xf7,0x6e,0x8b,0x45,0xfb,0xdb,0x05,0xff,0xff,0xfd,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfe,0xaa,0xaa,0x7f,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0x6f,0xff,0x00,0x08,0xaa,0xaa,0x75,0xff,0x00,0x11,0x55,0x56,0x7b,0xff,0x00,0x11,0x55,0x56,0x7b,0xff,0x00,0x18,0xaa,0xaa,0x83,0xab,0x8b,0x08,0xbe,0x8b,0x98,0xc7,0x63,0x8b,0x05,0x67,0x79,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x1e,0xaa,0xab,0x1f,0x8b,0xff,0x00,0x06,0xaa,0xa4,0x8c,0xff,0x00,0x07,0xaa,0xaa,0x8d,0xff,0x00,0x08,0xaa,0xb2,0x08,0x0e,0xfb,0x42,0xa4,0xe0,0x15,0xff,0xff,0xc3,0x55,0x55,0xff,0x00,0x21,0x55,0x55,0xff,0xff,0xe1,0xaa,0xab,0xff,0x00,0x42,0xaa,0xab,0x1e,0xb5,0x8b,0xac,0xff,0x00,0x0c,0x55,0x55,0xa3,0xff,0x00,0x18,0xaa,0xab,0xa3,0xff,0x00,0x18,0xaa,0xaa,0x9c,0xb0,0x95,0xff,0x00,0x31,0x55,0x56,0x08,0xa8,0xf7,0x1f,0x05,0x8f,0x9f,0x8d,0x9d,0x8b,0x9b,0x8b,0xff,0x00,0x3b,0x55,0x56,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x1d,0xaa,0xaa,0xff,0xff,0xbd,0x55,0x56,0x8b,0x63,0x8b,0xff,0xff,0xdf,0xd5,0x55,0x7f,0xff,0xff,0xe7,0xaa,0xab,0x73,0xff,0xff,0xe7,0xaa,0xaa,0x73,0xff,0xff,0xee,0xd5,0x56,0xff,0xff,0xdc,0x55,0x56,0x81,0xff,0xff,0xd0,0xaa,0xaa,0x08,0x6d,0xfb,0x1f,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xab,0x78,0x8b,0xff,0xff,0xed,0x55,0x56,0x08,0xf7,0x31,0x7f,0x15,0x81,0x7d,0xff,0xff,0xf0,0xaa,0xab,0x84,0xff,0xff,0xeb,0x55,0x55,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf5,0x55,0x54,0xff,0x00,0x03,0x55,0x55,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x06,0xaa,0xa6,0xff,0xff,0xfc,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0xb0,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x02,0x55,0x56,0x9c,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x17,0x55,0x56,0x08,0xa7,0xf7,0x16,0x05,0xff,0x00,0x06,0xaa,0xab,0xff,0x00,0x20,0xaa,0xa6,0xff,0x00,0x08,0x55,0x55,0xff,0x00,0x17,0x2a,0xaa,0x95,0xff,0x00,0x0d,0xaa,0xb0,0x95,0xff,0x00,0x0d,0xaa,0xaa,0x9a,0xff,0x00,0x06,0xd5,0x56,0x9f,0x8b,0xff,0x00,0x0e,0xaa,0xab,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xaa,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x03,0x55,0x55,0xff,0xff,0xf5,0xaa,0xaa,0x8b,0x7d,0x8b,0xff,0xff,0xf6,0xaa,0xd2,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe8,0xaa,0x84,0x08,0x70,0xfb,0x16,0x05,0xff,0xff,0xf9,0x55,0x55,0x69,0xff,0xff,0xf7,0xaa,0xab,0x73,0x81,0x7d,0x08,0x0e,0xfb,0xab,0xf7,0x27,0xf7,0xec,0x15,0x47,0x0a,0x0e,0xfb,0x25,0xad,0xbf,0x15,0x7f,0x57,0xf7,0x7e,0x8b,0x97,0xc6,0xfb,0x26,0x8b,0xf7,0x1e,0xf7,0x27,0x05,0xff,0x00,0x15,0x55,0x56,0xa1,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x05,0xd5,0x56,0xa3,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x18,0xaa,0x7c,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x13,0xaa,0xaa,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x0e,0xaa,0xda,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xe8,0x2a,0xaa,0xff,0x00,0x07,0x55,0x56,0x6d,0x8b,0xff,0xff,0xdb,0x55,0x5b,0x8b,0xff,0xff,0xe0,0xd5,0x55,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xe6,0x55,0x50,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xe4,0xd5,0x56,0xff,0xff,0xf8,0xaa,0xaa,0x69,0x08,0x88,0x7c,0xcc,0x8b,0x8d,0x96,0x05,0x8f,0x9f,0xff,0x00,0x07,0xaa,0xab,0x9a,0xff,0x00,0x0b,0x55,0x55,0x95,0xff,0x00,0x0b,0x55,0x55,0x95,0xff,0x00,0x0d,0xaa,0xab,0x90,0x9b,0x8b,0xff,0x00,0x0d,0x55,0x55,0x8b,0xff,0x00,0x0a,0x2a,0xab,0xff,0xff,0xfc,0xaa,0xaa,0x92,0xff,0xff,0xf9,0x55,0x56,0x92,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x55,0x54,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xf1,0xaa,0xab,0xff,0xff,0xe2,0x55,0x54,0xff,0xff,0xe3,0x55,0x55,0xff,0xff,0xe1,0x55,0x56,0x08,0x0e,0xfb,0x3f,0xbc,0xff,0x00,0x0e,0x80,0x00,0x15,0x9d,0xff,0xff,0xf2,0x55,0x55,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xf9,0x2a,0xab,0xff,0x00,0x1f,0x55,0x56,0x8b,0xa7,0x8b,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x07,0x2a,0xab,0xa2,0xff,0x00,0x0e,0x55,0x55,0xa2,0xff,0x00,0x0e,0x55,0x55,0x9d,0x9e,0x98,0xff,0x00,0x17,0xaa,0xab,0x98,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x06,0x80,0x00,0xff,0x00,0x19,0xd5,0x56,0x8b,0xa7,0x8b,0xff,0x00,0x10,0xaa,0xab,0xff,0xff,0xfc,0x55,0x56,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x55,0xff,0xff,0xf8,0xaa,0xab,0xff,0x00,0x0c,0x55,0x3b,0x80,0xff,0x00,0x08,0xd5,0x55,0xff,0xff,0xf1,0x55,0x55,0xff,0x00,0x05,0x55,0x70,0x08,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x13,0x2a,0xab,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x06,0xd5,0x56,0xff,0x00,0x17,0x80,0x00,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xff,0x00,0x1b,0x55,0x56,0x82,0xff,0x00,0x15,0x55,0x54,0x79,0xff,0x00,0x0f,0x55,0x56,0x79,0xff,0x00,0x0f,0x55,0x56,0x73,0xff,0x00,0x07,0xaa,0xaa,0x6d,0x8b,0x67,0x8b,0xff,0xff,0xe2,0x2a,0xab,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xe8,0x55,0x56,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xf1,0x2a,0xaa,0x71,0x85,0xff,0xff,0xdf,0x55,0x56,0x08,0x89,0x80,0xc8,0x8b,0x8d,0x95,0x05,0xff,0x00,0x03,0x55,0x55,0x9b,0xff,0x00,0x07,0x2a,0xab,0xff,0x00,0x0c,0xaa,0xaa,0x96,0xff,0x00,0x09,0x55,0x56,0x96,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x0d,0xd5,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xab,0x8b,0xff,0x00,0x0d,0x55,0x55,0x8b,0xff,0x00,0x0a,0x2a,0xab,0xff,0xff,0xfc,0x80,0x00,0x92,0x84,0x92,0x84,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x2a,0xaa,0x8b,0xff,0xff,0xf3,0x55,0x56,0x8b,0x75,0xff,0xff,0xf9,0xd5,0x55,0xff,0xff,0xec,0x80,0x00,0xff,0xff,0xf3,0xaa,0xab,0x7a,0xff,0xff,0xf3,0xaa,0xab,0x7a,0xff,0xff,0xee,0xd5,0x55,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0x08,0x76,0x8b,0x7f,0x53,0xa0,0x8b,0x05,0x9b,0x8b,0xff,0x00,0x0c,0x2a,0xab,0x87,0xff,0x00,0x08,0x55,0x55,0x83,0xff,0x00,0x08,0x55,0x55,0x83,0xff,0x00,0x04,0x2a,0xab,0x80,0x8b,0x7d,0x8b,0x73,0xff,0xff,0xf9,0x55,0x55,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xe8,0xaa,0xab,0xff,0xff,0xff,0xff,0xfe,0x7d,0x8b,0x80,0xff,0x00,0x03,0xaa,0xab,0x83,0xff,0x00,0x07,0x55,0x55,0x83,0xff,0x00,0x07,0x55,0x56,0x87,0xff,0x00,0x09,0xaa,0xaa,0x8b,0x97,0x08,0x8b,0xff,0x00,0x04,0xaa,0xa4,0x8c,0xff,0x00,0x07,0xaa,0xab,0x8d,0xff,0x00,0x0a,0xaa,0xb1,0x08,0x4f,0x06,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xf2,0x55,0x54,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x73,0x94,0xff,0xff,0xed,0x2a,0xab,0x9d,0xff,0xff,0xf2,0x55,0x55,0x08,0x0e,0xfb,0x4d,0xf7,0x9f,0xd6,0x15,0x49,0x0a,0x0e,0xfb,0x42,0xde,0xf7,0xfa,0x15,0x21,0x0a,0xf7,0x31,0x7f,0x15,0x23,0x0a,0x0e,0xfb,0xab,0xf7,0x61,0xf8,0xfd,0x15,0x47,0x0a,0x0e,0xfb,0x25,0xe7,0xf7,0xd9,0x15,0x7f,0x57,0xf7,0x7e,0x8b,0x97,0xc6,0xfb,0x26,0x8b,0xf7,0x1e,0xf7,0x27,0x05,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x15,0xff,0xc2,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x15,0x55,0x94,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x15,0x55,0x54,0xff,0x00,0x05,0xd5,0x56,0xa3,0x8b,0xff,0x00,0x1a,0xaa,0xac,0x8b,0xff,0x00,0x18,0xaa,0xac,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x13,0xaa,0xa8,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0xff,0xe8,0x2a,0xaa,0xff,0x00,0x07,0x55,0x54,0x6d,0x8b,0xff,0xff,0xdb,0x55,0x5d,0x8b,0xff,0xff,0xe0,0xd5,0x55,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xe6,0x55,0x4e,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xe4,0xd5,0x54,0xff,0xff,0xf8,0xaa,0xab,0x69,0x08,0x88,0x7c,0xcc,0x8b,0x8d,0x96,0x05,0x8f,0x9f,0xff,0x00,0x07,0xaa,0xab,0x9a,0xff,0x00,0x0b,0x55,0x55,0x95,0xff,0x00,0x0b,0x55,0x55,0x95,0xff,0x00,0x0d,0xaa,0xab,0x90,0x9b,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x92,0xff,0xff,0xf9,0x55,0x54,0x92,0xff,0xff,0xf9,0x56,0x8c,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x55,0x54,0x8b,0xff,0xff,0xf3,0x54,0x20,0x8b,0xff,0xff,0xe3,0x55,0x9c,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xe2,0x55,0x54,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe1,0x55,0x10,0x08,0x0e,0xfb,0x3f,0xf6,0xff,0x01,0x1f,0x80,0x00,0x15,0x4a,0x0a,0x0e,0xfb,0x4d,0xf7,0xd9,0xf7,0xf0,0x15,0x49,0x0a,0x0e,0xfb,0x42,0xf7,0x09,0xf8,0x97,0x15,0xff,0xff,0xc3,0x55,0x56,0xff,0x00,0x21,0x55,0x55,0xff,0xff,0xe1,0xaa,0xaa,0xff,0x00,0x42,0xaa,0xab,0x1e,0xb5,0x8b,0xac,0xff,0x00,0x0c,0x55,0x56,0xa3,0xff,0x00,0x18,0xaa,0xaa,0xa3,0xff,0x00,0x18,0xaa,0x8c,0x9c,0xb0,0x95,0xff,0x00,0x31,0x55,0x74,0x08,0xa8,0xf7,0x1f,0x05,0x8f,0x9f,0x8d,0x9d,0x8b,0x9b,0x8b,0xff,0x00,0x3b,0x55,0x54,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x1d,0xaa,0xac,0xff,0xff,0xbd,0x55,0x56,0x8b,0x63,0x8b,0xff,0xff,0xdf,0xd5,0x55,0x7f,0xff,0xff,0xe7,0xaa,0xab,0x73,0xff,0xff,0xe7,0xaa,0xab,0x73,0xff,0xff,0xee,0xd5,0x55,0xff,0xff,0xdc,0x55,0x54,0x81,0xff,0xff,0xd0,0xaa,0xac,0x08,0x6d,0xfb,0x1f,0x05,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xfd,0xaa,0xaa,0x78,0x8b,0xff,0xff,0xed,0x55,0x54,0x08,0xf7,0x31,0x7f,0x15,0x81,0x7d,0xff,0xff,0xf0,0xaa,0xab,0x84,0xff,0xff,0xeb,0x55,0x55,0x8b,0xff,0xff,0xf1,0x55,0x5c,0x8b,0xff,0xff,0xf5,0x55,0x55,0xff,0x00,0x03,0x55,0x56,0xff,0xff,0xf9,0x55,0x4f,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x55,0xff,0x00,0x06,0xaa,0x6c,0xff,0xff,0xfc,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0xea,0x8b,0xff,0x00,0x0a,0xaa,0xac,0xff,0x00,0x02,0x55,0x55,0x9c,0xff,0x00,0x04,0xaa,0xab,0xff,0x00,0x17,0x55,0x54,0x08,0xa7,0xf7,0x16,0x05,0xff,0x00,0x06,0xaa,0xab,0xff,0x00,0x20,0xaa,0xac,0xff,0x00,0x08,0x55,0x55,0xff,0x00,0x17,0x2a,0xa8,0x95,0xff,0x00,0x0d,0xaa,0xac,0x95,0xff,0x00,0x0d,0xaa,0xac,0x9a,0xff,0x00,0x06,0xd5,0x54,0x9f,0x8b,0xff,0x00,0x0e,0xaa,0x84,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xd2,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x03,0x55,0x56,0xff,0xff,0xf5,0xaa,0xac,0x8b,0x7d,0x8b,0xff,0xff,0xf6,0xaa,0xac,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xa8,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xe8,0xaa,0xac,0x08,0x70,0xfb,0x16,0x05,0xff,0xff,0xf9,0x55,0x56,0x69,0xff,0xff,0xf7,0xaa,0xaa,0x73,0x81,0x7d,0x08,0x0e,0xfb,0xab,0xf7,0x82,0xf9,0x9a,0x15,0x47,0x0a,0x0e,0xfb,0x25,0xf7,0x12,0xf8,0x76,0x15,0x44,0x0a,0x0e,0xfb,0x3f,0xf7,0x22,0xff,0x01,0xbc,0x80,0x00,0x15,0x45,0x0a,0x0e,0xfb,0x4d,0xf7,0xfa,0xf8,0x8d,0x15,0x49,0x0a,0x0e,0xfb,0xf4,0xf7,0xea,0xf9,0x46,0x15,0x22,0x0a,0x0e,0xf8,0x94,0x14,0xf8,0xa6,0x15,0x83,0x93,0xf8,0x8f,0x92,0xf7,0x44,0x94,0x06,0xfb,0x2c,0x8b,0x07,0x8b,0x0c,0x0a,0x1c,0x00,0x1a,0x13,0x00,0x2f,0x02,0x00,0x01,0x00,0x09,0x00,0x9c,0x00,0xa8,0x01,0x8c,0x02,0x1f,0x03,0x03,0x03,0x0d,0x03,0x15,0x03,0x2a,0x03,0x33,0x03,0x54,0x03,0x60,0x03,0x7e,0x04,0x1d,0x04,0xd9,0x07,0x02,0x07,0xe0,0x07,0xfa,0x08,0x14,0x08,0x1e,0x08,0xf2,0x09,0x98,0x0a,0xf8,0x0b,0x6d,0x0b,0xcc,0x0b,0xd7,0x0b,0xdf,0x0c,0xd7,0x0d,0xb5,0x0e,0x95,0x10,0xd8,0x11,0xb1,0x12,0x38,0x12,0x52,0x12,0x5a,0x12,0x6b,0x13,0x7a,0x15,0xa7,0x15,0xb3,0x15,0xc3,0x15,0xd4,0x15,0xf7,0x18,0x28,0x18,0x39,0x18,0xe4,0x18,0xf5,0x18,0xff,0x77,0x2e,0xe4,0x8b,0x9f,0xe8,0x05,0x0b,0xff,0xff,0xc3,0x55,0x56,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xe1,0xaa,0xaa,0xff,0x00,0x42,0xaa,0xaa,0x1e,0xb5,0x8b,0xac,0xff,0x00,0x0c,0x55,0x56,0xa3,0xff,0x00,0x18,0xaa,0xaa,0xa3,0xff,0x00,0x18,0xaa,0xaa,0x9c,0xb0,0x95,0xff,0x00,0x31,0x55,0x56,0x08,0xa8,0xf7,0x1f,0x05,0x8f,0x9f,0x8d,0x9d,0x8b,0x9b,0x8b,0xff,0x00,0x3b,0x55,0x54,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x1d,0xaa,0xac,0xff,0xff,0xbd,0x55,0x56,0x8b,0x63,0x8b,0xff,0xff,0xdf,0xd5,0x55,0x7f,0xff,0xff,0xe7,0xaa,0xab,0x73,0xff,0xff,0xe7,0xaa,0xab,0x73,0xff,0xff,0xee,0xd5,0x55,0xff,0xff,0xdc,0x55,0x54,0x81,0xff,0xff,0xd0,0xaa,0xac,0x08,0x6d,0xfb,0x1f,0x05,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xaa,0x78,0x8b,0xff,0xff,0xed,0x55,0x56,0x08,0x0b,0xfc,0x9d,0xfd,0x46,0xca,0x8b,0xf8,0x9c,0xf9,0x46,0x05,0x0b,0x81,0x7d,0xff,0xff,0xf0,0xaa,0xab,0x84,0xff,0xff,0xeb,0x55,0x55,0x8b,0xff,0xff,0xf1,0x55,0x6b,0x8b,0xff,0xff,0xf5,0x55,0x55,0xff,0x00,0x03,0x55,0x56,0xff,0xff,0xf9,0x55,0x40,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x55,0xff,0x00,0x06,0xaa,0x54,0xff,0xff,0xfc,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xab,0x02,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x02,0x55,0x55,0x9c,0xff,0x00,0x04,0xaa,0xab,0xff,0x00,0x17,0x55,0x56,0x08,0xa7,0xf7,0x16,0x05,0xff,0x00,0x06,0xaa,0xab,0xff,0x00,0x20,0xaa,0xac,0xff,0x00,0x08,0x55,0x55,0xff,0x00,0x17,0x2a,0xa8,0x95,0xff,0x00,0x0d,0xaa,0xac,0x95,0xff,0x00,0x0d,0xaa,0xac,0x9a,0xff,0x00,0x06,0xd5,0x54,0x9f,0x8b,0xff,0x00,0x0e,0xaa,0x66,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xf0,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x03,0x55,0x56,0xff,0xff,0xf5,0xaa,0xac,0x8b,0x7d,0x8b,0xff,0xff,0xf6,0xaa,0xac,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xa8,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xe8,0xaa,0xac,0x08,0x70,0xfb,0x16,0x05,0xff,0xff,0xf9,0x55,0x56,0x69,0xff,0xff,0xf7,0xaa,0xaa,0x73,0x81,0x7d,0x08,0x0b,0xff,0xff,0xc3,0x55,0x55,0xff,0x00,0x21,0x55,0x54,0xff,0xff,0xe1,0xaa,0xab,0xff,0x00,0x42,0xaa,0xac,0x1e,0xb5,0x8b,0xac,0xff,0x00,0x0c,0x55,0x55,0xa3,0xff,0x00,0x18,0xaa,0xab,0xa3,0xff,0x00,0x18,0xaa,0xaa,0x9c,0xb0,0x95,0xff,0x00,0x31,0x55,0x56,0x08,0xa8,0xf7,0x1f,0x05,0x8f,0x9f,0x8d,0x9d,0x8b,0x9b,0x8b,0xff,0x00,0x3b,0x55,0x56,0xff,0xff,0xde,0xaa,0xac,0xff,0x00,0x1d,0xaa,0xaa,0xff,0xff,0xbd,0x55,0x54,0x8b,0x63,0x8b,0xff,0xff,0xdf,0xd5,0x54,0x7f,0xff,0xff,0xe7,0xaa,0xac,0x73,0xff,0xff,0xe7,0xaa,0xac,0x73,0xff,0xff,0xee,0xd5,0x54,0xff,0xff,0xdc,0x55,0x56,0x81,0xff,0xff,0xd0,0xaa,0xaa,0x08,0x6d,0xfb,0x1f,0x05,0xff,0xff,0xfb,0x55,0x54,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xfd,0xaa,0xac,0x78,0x8b,0xff,0xff,0xed,0x55,0x56,0x08,0x0b,0x81,0x7d,0xff,0xff,0xf0,0xaa,0xac,0x84,0xff,0xff,0xeb,0x55,0x54,0x8b,0xff,0xff,0xf1,0x56,0x9c,0x8b,0xff,0xff,0xf5,0x55,0x54,0xff,0x00,0x03,0x55,0x55,0xff,0xff,0xf9,0x54,0x10,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xf9,0x55,0x54,0xff,0x00,0x06,0xaa,0xa6,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0xb0,0x8b,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x02,0x55,0x54,0x9c,0xff,0x00,0x04,0xaa,0xac,0xff,0x00,0x17,0x55,0x56,0x08,0xa7,0xf7,0x16,0x05,0xff,0x00,0x06,0xaa,0xac,0xff,0x00,0x20,0xaa,0xa6,0xff,0x00,0x08,0x55,0x54,0xff,0x00,0x17,0x2a,0xaa,0x95,0xff,0x00,0x0d,0xaa,0xb0,0x95,0xff,0x00,0x0d,0xaa,0xaa,0x9a,0xff,0x00,0x06,0xd5,0x56,0x9f,0x8b,0xff,0x00,0x0e,0xaa,0xac,0x8b,0xff,0x00,0x0a,0xaa,0xa8,0xff,0xff,0xfc,0xaa,0xaa,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf5,0xaa,0xaa,0x8b,0x7d,0x8b,0xff,0xff,0xf6,0xaa,0xd2,0xff,0xff,0xfd,0xaa,0xac,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x54,0xff,0xff,0xe8,0xaa,0x84,0x08,0x70,0xfb,0x16,0x05,0xff,0xff,0xf9,0x55,0x54,0x69,0xff,0xff,0xf7,0xaa,0xac,0x73,0x81,0x7d,0x08,0x0b,0x58,0xfb,0x7a,0xdd,0xc9,0xae,0xf7,0x3c,0x05,0x0b,0x78,0x2f,0xe3,0x8b,0x9f,0xe7,0x05,0x0b,0xa2,0xfb,0x3a,0xd7,0x8b,0x24,0xf9,0x46,0x4d,0x8b,0xfc,0x21,0xfd,0x46,0xd8,0x8b,0xe8,0xf7,0x3a,0x05,0x0b,0xfb,0x8e,0x8b,0xf7,0x5d,0xf7,0xfc,0x05,0x0b,0xf7,0xee,0x8b,0x99,0xcd,0xfc,0x37,0x8b,0xfb,0x27,0xfd,0x46,0xf8,0x37,0x8b,0x9a,0xcd,0xfb,0xef,0x8b,0xc1,0xf7,0x90,0xf7,0xbc,0x8b,0x99,0xcd,0xfb,0xbc,0x8b,0x05,0x0b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xf7,0x27,0xf9,0x46,0x05,0x0b,0x43,0x8b,0xfb,0x0b,0xfc,0xbe,0xfb,0x83,0xf8,0xbe,0x42,0x8b,0xfb,0x27,0xfd,0x46,0xd4,0x8b,0xf7,0x0a,0xf8,0xc0,0xf7,0x83,0xfc,0xc0,0xd4,0x8b,0x05,0x0b,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x31,0xaa,0xaa,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x3e,0xaa,0xab,0x8b,0xff,0x00,0x96,0xaa,0xac,0x8b,0xff,0x00,0x5d,0xff,0xfe,0xe3,0xff,0x00,0x25,0x55,0x56,0xf7,0x44,0x08,0xb1,0xf7,0x47,0x05,0x91,0xa9,0x8e,0xa6,0x8b,0xa3,0x8b,0xff,0x00,0x3e,0xaa,0xac,0xff,0xff,0xed,0xaa,0xac,0xff,0x00,0x2e,0x2a,0xa8,0xff,0xff,0xdb,0x55,0x54,0xff,0x00,0x1d,0xaa,0xac,0xff,0xff,0xdb,0x55,0x56,0xff,0x00,0x1d,0xaa,0xac,0x5a,0xff,0x00,0x0e,0xd5,0x54,0xff,0xff,0xc2,0xaa,0xaa,0x8b,0xfb,0x2c,0x8b,0xff,0xff,0xa1,0x55,0x55,0x33,0xff,0xff,0xda,0xaa,0xab,0xfb,0x44,0x08,0x65,0xfb,0x47,0x05,0x85,0x6d,0x88,0x70,0x8b,0x73,0x8b,0xff,0xff,0xc1,0x55,0x55,0xff,0x00,0x12,0x55,0x55,0xff,0xff,0xd1,0xd5,0x55,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xe2,0x55,0x56,0x08,0x0b,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0xff,0xd5,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x57,0x8b,0x2d,0x8b,0x5c,0xff,0x00,0x2a,0x55,0x55,0x8b,0xff,0x00,0x54,0xaa,0xab,0x8b,0xff,0x00,0x12,0xaa,0xab,0xff,0x00,0x02,0xaa,0xab,0xa1,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x19,0x55,0x55,0x08,0xb2,0xf7,0x48,0x05,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x47,0x55,0x56,0xa3,0xff,0x00,0x33,0x55,0x56,0xff,0x00,0x20,0xaa,0xab,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x20,0xaa,0xaa,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x0f,0xaa,0xac,0xc1,0x8b,0xff,0x00,0x5b,0x55,0x56,0x8b,0xff,0x00,0x2d,0xaa,0xaa,0xff,0xff,0xd4,0xaa,0xac,0x8b,0xff,0xff,0xa9,0x55,0x54,0x8b,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x54,0xff,0xff,0xe8,0x55,0x56,0xff,0xff,0xfa,0xaa,0xac,0x73,0x08,0x64,0xfb,0x48,0x05,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xbc,0xaa,0xad,0xff,0xff,0xe8,0x55,0x54,0x5a,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xe1,0x55,0x53,0x08,0x0b,0xff,0x00,0x23,0x55,0x53,0xff,0xff,0xe3,0x55,0x55,0xbd,0xff,0xff,0xf1,0xaa,0xab,0xff,0x00,0x40,0xaa,0xad,0x8b,0xdf,0x8b,0xcd,0xff,0x00,0x14,0xaa,0xaa,0xbb,0xff,0x00,0x29,0x55,0x56,0xbb,0xff,0x00,0x29,0x55,0x53,0xa3,0xc5,0x8b,0xff,0x00,0x4a,0xaa,0xad,0x8b,0xb5,0xff,0xff,0xf3,0xaa,0xaa,0xff,0x00,0x20,0xd5,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x17,0xaa,0x7e,0x67,0xff,0x00,0x10,0x2a,0xaa,0xff,0xff,0xd0,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xd8,0x08,0x3b,0x9a,0x05,0xff,0xff,0xde,0xaa,0xab,0x91,0xff,0xff,0xe7,0x2a,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xab,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xef,0xaa,0xab,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf7,0xd5,0x55,0xff,0x00,0x14,0xaa,0xaa,0x8b,0xa5,0x8b,0xb7,0xff,0x00,0x10,0x2a,0xab,0xaf,0xff,0x00,0x20,0x55,0x55,0xa7,0xff,0x00,0x20,0x55,0x55,0xa7,0xff,0x00,0x2c,0x2a,0xab,0x99,0xc3,0x8b,0xff,0x00,0x52,0xaa,0xaa,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0xff,0xdd,0x55,0x54,0x8b,0xff,0xff,0xba,0xaa,0xac,0x8b,0xff,0xff,0xfb,0x55,0x54,0xff,0xff,0xff,0x55,0x56,0xff,0xff,0xf7,0xaa,0xac,0xff,0xff,0xfe,0xaa,0xaa,0x7f,0x08,0xd3,0x06,0xff,0x00,0x00,0xaa,0xac,0x91,0xff,0x00,0x00,0x55,0x54,0xff,0x00,0x08,0xaa,0xac,0x8b,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x37,0x55,0x54,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x29,0x80,0x00,0xff,0xff,0xdd,0x55,0x54,0xff,0x00,0x1b,0xaa,0xac,0xff,0xff,0xdd,0x55,0x56,0xff,0x00,0x1b,0xaa,0xac,0x5d,0xff,0x00,0x0d,0xd5,0x54,0xff,0xff,0xc6,0xaa,0xaa,0x8b,0xff,0xff,0xcd,0x55,0x56,0x8b,0x5e,0xff,0xff,0xf6,0xd5,0x54,0xff,0xff,0xd8,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xd8,0xaa,0xab,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xe1,0x80,0x00,0xff,0xff,0xe5,0xd5,0x54,0xff,0xff,0xea,0x55,0x55,0x69,0xff,0xff,0xea,0x55,0x56,0x69,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xd7,0xaa,0xac,0x8b,0xff,0xff,0xd1,0x55,0x54,0x08,0x8b,0xff,0xff,0xb2,0xaa,0xaa,0xba,0xff,0xff,0xd0,0x55,0x56,0xe9,0x79,0x08,0xd9,0x7c,0x05,0xff,0x00,0x23,0x55,0x56,0xff,0xff,0xf9,0x55,0x56,0xff,0x00,0x1a,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x54,0x9c,0xff,0xff,0xf0,0x55,0x56,0x9c,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xea,0x2a,0xaa,0x8b,0x6f,0x8b,0xff,0xff,0xcf,0x55,0x55,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xd9,0xaa,0xab,0xff,0xff,0xdf,0x55,0x56,0x6f,0xff,0xff,0xdf,0x55,0x56,0x6f,0x5c,0x7d,0xff,0xff,0xc2,0xaa,0xaa,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x8b,0xff,0xff,0xd2,0x55,0x56,0xb1,0xff,0xff,0xff,0xff,0xfe,0xd7,0x8b,0x95,0xff,0x00,0x00,0x55,0x56,0xff,0x00,0x07,0xaa,0xab,0xff,0x00,0x00,0xaa,0xaa,0xff,0x00,0x05,0x55,0x55,0x08,0x44,0x06,0xff,0xff,0xfe,0xaa,0xab,0x83,0xff,0xff,0xff,0x55,0x55,0xff,0xff,0xf4,0xaa,0xab,0x8b,0xff,0xff,0xf1,0x55,0x55,0x8b,0x55,0xff,0x00,0x11,0xaa,0xaa,0xff,0xff,0xd6,0xaa,0xaa,0xff,0x00,0x23,0x55,0x56,0xff,0xff,0xe3,0x55,0x56,0x08,0x0b,0xff,0x00,0x26,0x55,0x54,0xff,0xff,0xde,0xaa,0xab,0xff,0x00,0x31,0xd5,0x55,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x3d,0x55,0x57,0x8b,0xd1,0x8b,0xff,0x00,0x3b,0x55,0x56,0xa0,0xff,0x00,0x30,0xaa,0xaa,0xb5,0xff,0x00,0x30,0xaa,0xaa,0xb5,0xff,0x00,0x1f,0xaa,0xaa,0xc3,0xff,0x00,0x0e,0xaa,0xac,0xd1,0x08,0xee,0xf8,0x65,0x42,0x8b,0x29,0xfc,0x5f,0x05,0xff,0xff,0xf4,0xaa,0xaa,0x55,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xd5,0xd5,0x55,0x69,0xff,0xff,0xe1,0xaa,0xab,0x69,0xff,0xff,0xe1,0xaa,0xaa,0x61,0xff,0xff,0xf0,0xd5,0x56,0x59,0x8b,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xff,0xff,0xfe,0x69,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x16,0xaa,0xac,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xab,0xaa,0x8b,0xff,0x00,0x27,0x55,0x56,0x8b,0x97,0xff,0x00,0x01,0xaa,0xab,0x9a,0xff,0x00,0x03,0x55,0x55,0x9d,0x08,0xed,0xf8,0x5f,0x41,0x8b,0x29,0xfc,0x61,0x05,0x87,0x79,0x89,0xff,0xff,0xee,0xaa,0xab,0x8b,0xff,0xff,0xef,0x55,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc8,0xaa,0xab,0xff,0x00,0x13,0x2a,0xab,0xff,0xff,0xd3,0xaa,0xaa,0xff,0x00,0x26,0x55,0x56,0xff,0xff,0xde,0xaa,0xab,0x08,0x0b,0xf7,0xb7,0xf8,0x26,0x3c,0x8b,0xfb,0x7e,0xfb,0xe1,0x2e,0xf7,0xe1,0x3d,0x8b,0xf7,0x0c,0xfc,0x24,0x4e,0xfb,0xb6,0xd3,0x8b,0x05,0x0b,0x99,0xcd,0xfc,0x3c,0x8b,0x7e,0x49,0xf7,0xe6,0x8b,0xfc,0x6b,0xfc,0xc2,0x7d,0x49,0xf8,0x4d,0x8b,0x99,0xcd,0xfb,0xf9,0x8b,0x05,0x0b,0xe9,0xfb,0x11,0xc4,0x8b,0x42,0xf7,0x11,0x05,0x0b,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x21,0x2a,0xab,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x28,0xaa,0xab,0x8b,0xff,0x00,0x3f,0xff,0xff,0x8b,0xff,0x00,0x32,0x55,0x55,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x24,0xaa,0xac,0xff,0x00,0x31,0x55,0x55,0x08,0x7c,0x47,0xce,0x8b,0xf7,0x00,0xf8,0x8f,0x47,0x8b,0x7c,0x44,0x05,0xff,0xff,0xf6,0xaa,0xdc,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xf1,0x2a,0xaa,0xff,0x00,0x13,0x2a,0xaa,0xff,0xff,0xeb,0xaa,0x7a,0x98,0xff,0xff,0xeb,0xaa,0xaa,0x98,0xff,0xff,0xe6,0xd5,0x56,0xff,0x00,0x06,0x80,0x00,0x6d,0x8b,0xff,0xff,0xcc,0xaa,0xab,0x8b,0x5e,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xd9,0x55,0x55,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xd9,0x55,0x57,0xff,0xff,0xde,0xaa,0xc4,0x70,0xff,0xff,0xcb,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xa9,0xff,0xff,0xb8,0xaa,0x92,0x08,0x75,0x23,0x05,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe5,0x55,0x60,0xff,0xff,0xfd,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0x8b,0xff,0xff,0xed,0x55,0x4b,0x8b,0x5b,0xff,0x00,0x0c,0xd5,0x55,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xab,0xff,0xff,0xe9,0x55,0x56,0x08,0x0b,0xff,0xff,0xe5,0xaa,0xaa,0x6f,0xff,0xff,0xdd,0xd5,0x55,0x7d,0xff,0xff,0xd6,0x00,0x01,0x8b,0x4f,0x8b,0x6d,0xff,0x00,0x1f,0x55,0x55,0x8b,0xff,0x00,0x3e,0xaa,0xab,0x8b,0xff,0x00,0x14,0xaa,0xab,0x8d,0xff,0x00,0x12,0xaa,0xaa,0x8f,0xff,0x00,0x10,0xaa,0xab,0x08,0xa0,0xeb,0x05,0xa1,0xff,0x00,0x64,0xaa,0xaa,0xff,0x00,0x30,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x4b,0x55,0x56,0x8b,0xff,0x00,0x20,0xaa,0xaa,0x8b,0xff,0x00,0x18,0x55,0x56,0xff,0xff,0xf6,0xaa,0xaa,0x9b,0xff,0xff,0xed,0x55,0x56,0x9b,0xff,0xff,0xed,0x55,0x56,0x93,0x71,0x8b,0xff,0xff,0xde,0xaa,0xaa,0x8b,0x79,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xfc,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0x08,0x78,0x32,0x05,0xff,0xff,0xf6,0xaa,0xd6,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xee,0x2a,0xaa,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xe5,0xaa,0x80,0x6f,0x08,0x0b,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x18,0x55,0x56,0x64,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xcf,0x55,0x56,0x8b,0xff,0xff,0xc6,0xaa,0xab,0x8b,0xff,0xff,0xce,0xd5,0x55,0xff,0xff,0xee,0xaa,0xaa,0x62,0xff,0xff,0xdd,0x55,0x56,0x62,0xff,0xff,0xdd,0x55,0x56,0xff,0xff,0xe3,0xd5,0x56,0x55,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xb6,0xaa,0xaa,0x08,0x79,0x34,0x05,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe5,0x55,0x55,0xff,0xff,0xfd,0x55,0x55,0xff,0xff,0xe9,0xaa,0xab,0x8b,0x79,0x8b,0x57,0xff,0x00,0x0f,0x2a,0xaa,0xff,0xff,0xd9,0xaa,0xaa,0xff,0x00,0x1e,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x1e,0x55,0x56,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x28,0x7f,0xff,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x32,0xaa,0xab,0x8b,0xff,0x00,0x38,0xaa,0xaa,0x8b,0xff,0x00,0x2e,0x80,0x00,0x99,0xff,0x00,0x24,0x55,0x56,0xa7,0xff,0x00,0x24,0x55,0x56,0xa7,0xff,0x00,0x17,0x80,0x00,0xb3,0xff,0x00,0x0a,0xaa,0xaa,0xbf,0x08,0x49,0x06,0xff,0xff,0xf7,0x55,0x56,0xff,0xff,0xdf,0x55,0x57,0x7b,0x72,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xa9,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xac,0x6e,0xff,0xff,0xf7,0x55,0x56,0xff,0xff,0xdd,0x55,0x56,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xde,0xaa,0xab,0x8b,0xff,0xff,0xe5,0xd5,0x55,0xff,0x00,0x07,0x2a,0xab,0x78,0xff,0x00,0x0e,0x55,0x55,0x78,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x18,0xd5,0x55,0x8b,0xff,0x00,0x23,0x55,0x55,0x8b,0x9d,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xab,0x08,0x91,0xaa,0xf7,0xd1,0x8b,0x97,0xc5,0x05,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x1a,0xaa,0x96,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x16,0xaa,0xaa,0x8b,0xff,0x00,0x12,0xaa,0xc0,0x8b,0xbd,0xff,0xff,0xf1,0x55,0x56,0xff,0x00,0x25,0x2a,0xaa,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x18,0x55,0x56,0x08,0x0b,0x8b,0xff,0xff,0xf1,0x55,0x56,0x89,0xff,0xff,0xee,0xaa,0xaa,0x87,0x77,0x08,0x87,0x79,0xfb,0x8c,0x8b,0x8d,0x96,0x05,0xff,0x00,0x0b,0x55,0x53,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x1b,0x55,0x58,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1b,0x55,0x4e,0xff,0x00,0x16,0x55,0x56,0xac,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x26,0xaa,0xb2,0x8b,0xff,0x00,0x1f,0x55,0x56,0x8b,0xff,0x00,0x18,0x55,0x54,0x84,0xff,0x00,0x11,0x55,0x56,0x7d,0xff,0x00,0x11,0x55,0x56,0x7d,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xe8,0xaa,0xaa,0x8b,0xff,0xff,0xdf,0x55,0x56,0x08,0x0b,0xff,0x00,0x09,0x55,0x56,0xb9,0xa5,0xa2,0xff,0x00,0x2a,0xaa,0xaa,0x8b,0x08,0xb5,0x8b,0x97,0xc1,0x56,0x8b,0x05,0x65,0x8b,0xff,0xff,0xdf,0xaa,0xaa,0xff,0xff,0xf4,0xaa,0xac,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xe9,0x55,0x54,0xff,0xff,0xe5,0x55,0x55,0xff,0xff,0xe9,0x55,0xa4,0xff,0xff,0xee,0xaa,0xab,0xff,0xff,0xe1,0x55,0x54,0x83,0xff,0xff,0xd9,0x55,0x08,0x08,0x7f,0x52,0x4b,0x8b,0x7f,0x55,0xcc,0x8b,0x2b,0xfc,0x59,0xcf,0x8b,0xec,0xf8,0x59,0xf5,0x8b,0x96,0xc1,0x21,0x8b,0x05,0x0b,0x20,0xfc,0x8f,0xce,0x8b,0xf7,0x00,0xf8,0x8f,0x05,0x0b,0x78,0x31,0xd3,0x8b,0x9e,0xe5,0x05,0x0b,0x20,0xfc,0x8f,0xcf,0x8b,0xd0,0xf7,0xd7,0x05,0xff,0x00,0x08,0xaa,0xab,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x11,0xaa,0xaa,0xff,0x00,0x1f,0xd5,0x54,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1f,0xaa,0xab,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xf8,0xaa,0xaa,0x9b,0xff,0xff,0xf1,0x55,0x56,0x9b,0xff,0xff,0xf1,0x55,0x56,0x93,0xff,0xff,0xea,0x55,0x54,0x8b,0xff,0xff,0xe3,0x55,0x56,0x8b,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xfe,0x55,0x56,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xaa,0x79,0x08,0x47,0xfb,0xd6,0xcf,0x8b,0xd2,0xf7,0xe1,0x05,0x8f,0x9d,0x8d,0xff,0x00,0x11,0x55,0x56,0x8b,0xff,0x00,0x10,0xaa,0xaa,0x8b,0xff,0x00,0x28,0xaa,0xaa,0x7f,0xff,0x00,0x1f,0x80,0x00,0x73,0xff,0x00,0x16,0x55,0x56,0x73,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xdd,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0xff,0xd3,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0xff,0xff,0xe4,0x80,0x00,0xff,0xff,0xfa,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x63,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xe9,0xd5,0x55,0x7a,0xff,0xff,0xed,0x55,0x48,0xff,0xff,0xe9,0x55,0x56,0x08,0x99,0xc9,0x05,0x0b,0xff,0x00,0x1d,0x55,0x56,0x74,0xff,0x00,0x27,0xaa,0xaa,0xff,0xff,0xf4,0x80,0x00,0xbd,0x8b,0xff,0x00,0x39,0x55,0x56,0x8b,0xbc,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x28,0xaa,0xaa,0xac,0xff,0x00,0x28,0xaa,0xaa,0xff,0x00,0x20,0xff,0xfe,0xa7,0xff,0x00,0x34,0xd5,0x56,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x48,0xaa,0xac,0x08,0xa1,0xf3,0x05,0xff,0x00,0x05,0x55,0x56,0xff,0x00,0x19,0x55,0x56,0xff,0x00,0x02,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xaa,0x8b,0x9d,0x8b,0xff,0x00,0x30,0xaa,0xaa,0xff,0xff,0xf1,0x55,0x56,0xaf,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x17,0x55,0x56,0x64,0xff,0x00,0x0b,0xaa,0xaa,0xff,0xff,0xcf,0x55,0x56,0x8b,0xff,0xff,0xc5,0x55,0x55,0x8b,0xff,0xff,0xce,0x2a,0xab,0xff,0xff,0xef,0x55,0x56,0x62,0xff,0xff,0xde,0xaa,0xaa,0x62,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xe3,0xd5,0x56,0xff,0xff,0xcb,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0x43,0x08,0x75,0x23,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xea,0xaa,0xab,0x8b,0x77,0x8b,0x59,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xdb,0x80,0x00,0xff,0x00,0x1d,0x55,0x56,0x74,0x08,0x0b,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xdf,0xd5,0x55,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xda,0x00,0x01,0xff,0xff,0xff,0xff,0xfe,0x6b,0x8b,0xff,0xff,0xe6,0xd5,0x55,0xff,0x00,0x07,0x2a,0xab,0xff,0xff,0xed,0xaa,0xab,0xff,0x00,0x0e,0x55,0x55,0xff,0xff,0xed,0xaa,0xaa,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xf6,0xd5,0x56,0xff,0x00,0x18,0xd5,0x55,0x8b,0xff,0x00,0x23,0x55,0x55,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8d,0x9d,0x8f,0xff,0x00,0x14,0xaa,0xab,0x08,0x9f,0xec,0x05,0x97,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x13,0x55,0x55,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1a,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xac,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x27,0x55,0x55,0x8b,0xff,0x00,0x42,0xaa,0xaa,0x8b,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0xff,0xff,0xc1,0x55,0x56,0x8b,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xed,0x55,0x54,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0x08,0x77,0x2b,0x05,0xff,0xff,0xf4,0xaa,0xd6,0x53,0xff,0xff,0xed,0x2a,0xaa,0xff,0xff,0xd8,0xd5,0x56,0xff,0xff,0xe5,0xaa,0x80,0xff,0xff,0xe9,0xaa,0xaa,0x08,0x0b,0xff,0x00,0x1c,0xaa,0xaa,0xff,0xff,0xe5,0xaa,0xab,0xff,0x00,0x2a,0xaa,0xab,0xff,0xff,0xf2,0xd5,0x55,0xff,0x00,0x38,0xaa,0xab,0x8b,0xc9,0x8b,0xbd,0xff,0x00,0x0f,0xaa,0xab,0xb1,0xff,0x00,0x1f,0x55,0x55,0xb1,0xff,0x00,0x1f,0x55,0x56,0x9e,0xff,0x00,0x29,0xaa,0xaa,0x8b,0xbf,0x8b,0xff,0x00,0x20,0xaa,0xab,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x19,0x80,0x00,0xff,0xff,0xec,0xaa,0xaa,0xff,0x00,0x12,0x55,0x55,0xff,0xff,0xec,0xaa,0xaa,0xff,0x00,0x12,0x55,0x56,0x6c,0xff,0x00,0x0d,0x2a,0xaa,0xff,0xff,0xd5,0x55,0x56,0x93,0x08,0x4c,0x97,0x05,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x04,0xaa,0x14,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x07,0x2a,0xaa,0x7f,0xff,0x00,0x09,0xab,0x42,0x7f,0xff,0x00,0x09,0xaa,0x58,0x85,0xff,0x00,0x0e,0x2a,0xaa,0x8b,0xff,0x00,0x12,0xaa,0xfe,0x8b,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xab,0xff,0x00,0x17,0xd5,0x56,0xff,0x00,0x16,0x55,0x55,0x9e,0xff,0x00,0x16,0x55,0x55,0x9e,0xff,0x00,0x1d,0x80,0x00,0xff,0x00,0x09,0x80,0x00,0xff,0x00,0x24,0xaa,0xab,0x8b,0xb1,0x8b,0xff,0x00,0x1b,0xaa,0xaa,0xff,0xff,0xf8,0xd5,0x56,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf1,0xaa,0xaa,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf1,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xe9,0x80,0x00,0x8b,0xff,0xff,0xe1,0x55,0x56,0x08,0xcd,0x06,0x8b,0xb9,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x23,0xaa,0xaa,0x70,0xff,0x00,0x19,0x55,0x56,0x70,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xd5,0xd5,0x56,0xff,0x00,0x0c,0xaa,0xaa,0xff,0xff,0xc6,0xaa,0xaa,0x8b,0x63,0x8b,0xff,0xff,0xdd,0x2a,0xab,0xff,0xff,0xf8,0xd5,0x56,0xff,0xff,0xe2,0x55,0x55,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xe2,0x55,0x59,0xff,0xff,0xf1,0xaa,0xaa,0x74,0x77,0xff,0xff,0xef,0xaa,0xa7,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xf7,0xd5,0x56,0xff,0xff,0xe2,0xd5,0x54,0x8b,0xff,0xff,0xdf,0x55,0x56,0x8b,0x6b,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xe7,0xaa,0xaa,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0x08,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xab,0xb5,0x83,0x08,0xc6,0x80,0x05,0xff,0x00,0x1a,0xaa,0x86,0xff,0xff,0xfb,0x55,0x55,0xff,0x00,0x13,0xaa,0xaa,0xff,0xff,0xf8,0xaa,0xab,0xff,0x00,0x0c,0xaa,0xd0,0x81,0xff,0x00,0x0c,0xaa,0xaa,0x81,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xf0,0xaa,0xab,0x8b,0xff,0xff,0xeb,0x55,0x55,0x8b,0x6b,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xe0,0xff,0xff,0xff,0xff,0xf6,0xaa,0xaa,0xff,0xff,0xda,0xaa,0xab,0x8b,0x63,0x8b,0xff,0xff,0xe2,0xd5,0x55,0xff,0x00,0x07,0xd5,0x55,0xff,0xff,0xed,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xab,0xff,0xff,0xed,0xaa,0xaa,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xf6,0xd5,0x56,0xff,0x00,0x17,0x80,0x00,0x8b,0xff,0x00,0x1f,0x55,0x56,0x08,0x4b,0x06,0x8b,0xff,0xff,0xcf,0x55,0x56,0xff,0x00,0x0e,0x55,0x55,0xff,0xff,0xda,0x80,0x00,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xe5,0xaa,0xaa,0x08,0x0b,0xa6,0xff,0xff,0xe8,0xaa,0xab,0xff,0x00,0x27,0x80,0x00,0xff,0xff,0xf4,0x55,0x55,0xbf,0x8b,0xff,0x00,0x77,0x55,0x56,0x8b,0xff,0x00,0x49,0x55,0x54,0xcb,0xff,0x00,0x1b,0x55,0x56,0xf7,0x14,0x08,0xcf,0xf7,0xd5,0x47,0x8b,0x48,0xfb,0xcc,0x05,0x81,0xff,0xff,0xcf,0x55,0x57,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xdc,0x80,0x00,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xe9,0xaa,0xa9,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xdf,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xd5,0x55,0x56,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xde,0xaa,0xab,0x8b,0xff,0xff,0xe7,0xaa,0xaa,0x92,0xff,0xff,0xf0,0xaa,0xab,0x99,0xff,0xff,0xf0,0xaa,0xab,0x99,0xff,0xff,0xf8,0x55,0x55,0xa0,0x8b,0xa7,0x8b,0xff,0x00,0x0d,0x55,0x4b,0xff,0x00,0x02,0x55,0x56,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x17,0x55,0x60,0x08,0xce,0xf7,0xcd,0x46,0x8b,0x48,0xfb,0xd2,0x05,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xe7,0x55,0x5f,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xec,0x55,0x55,0x8b,0xff,0xff,0xf1,0x55,0x4c,0x8b,0x5f,0xff,0x00,0x0d,0x80,0x00,0xff,0xff,0xde,0x55,0x55,0xa6,0xff,0xff,0xe8,0xaa,0xab,0x08,0x0b,0x42,0x8b,0xfb,0x6f,0xfc,0x26,0x5c,0xf8,0x26,0x42,0x8b,0xce,0xfc,0x88,0x79,0x6a,0x05,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xf1,0xaa,0xab,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xec,0x7f,0xff,0xff,0xff,0xfb,0x2a,0xaa,0xff,0xff,0xe7,0x55,0x56,0x8b,0x08,0x73,0x8b,0x7e,0x4d,0xa9,0x8b,0x05,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x1d,0x7f,0xff,0xff,0x00,0x07,0xaa,0xab,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x15,0xd5,0x55,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x13,0x55,0x55,0xad,0x08,0x0b,0x98,0xca,0xfb,0xe6,0x8b,0x7e,0x4c,0xf7,0x96,0x8b,0xfb,0xe7,0xfc,0x11,0x7d,0x4c,0xf7,0xe7,0x8b,0x98,0xca,0xfb,0x97,0x8b,0x05,0x0b,0x79,0x35,0xd7,0x8b,0x9d,0xe1,0x05,0x0b,0xf7,0x2d,0xfb,0x5a,0x9d,0xde,0x32,0xf7,0x07,0xf7,0x1e,0xf7,0x07,0x9c,0xde,0x05,0x0b,0x7f,0x57,0xf7,0x7e,0x8b,0x97,0xc6,0xfb,0x26,0x8b,0xf7,0x1e,0xf7,0x27,0x05,0xff,0x00,0x15,0x55,0x56,0xa1,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x15,0xaa,0xac,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x15,0x55,0x54,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x15,0x55,0x54,0xff,0x00,0x05,0xd5,0x56,0xa3,0x8b,0xff,0x00,0x1a,0xaa,0xac,0x8b,0xff,0x00,0x18,0xaa,0xac,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x13,0xaa,0xa8,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0xff,0xe8,0x2a,0xaa,0xff,0x00,0x07,0x55,0x54,0x6d,0x8b,0xff,0xff,0xdb,0x55,0x56,0x8b,0xff,0xff,0xe0,0xd5,0x55,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xef,0x80,0x00,0xff,0xff,0xe4,0xd5,0x54,0xff,0xff,0xf8,0xaa,0xab,0x69,0x08,0x88,0x7c,0xcc,0x8b,0x8d,0x96,0x05,0x8f,0x9f,0xff,0x00,0x07,0xaa,0xab,0x9a,0xff,0x00,0x0b,0x55,0x55,0x95,0xff,0x00,0x0b,0x55,0x56,0x95,0xff,0x00,0x0d,0xaa,0xaa,0x90,0x9b,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x92,0xff,0xff,0xf9,0x55,0x54,0x92,0xff,0xff,0xf9,0x56,0x18,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x55,0x54,0x8b,0xff,0xff,0xf3,0x54,0x94,0x8b,0xff,0xff,0xe3,0x55,0xb0,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xe2,0x55,0x54,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe1,0x54,0xfc,0x08,0x0b,0x9d,0xff,0xff,0xf2,0x55,0x56,0xff,0x00,0x18,0xaa,0xab,0xff,0xff,0xf9,0x2a,0xaa,0xff,0x00,0x1f,0x55,0x55,0x8b,0xa7,0x8b,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x07,0x2a,0xaa,0xa2,0xff,0x00,0x0e,0x55,0x56,0xa2,0xff,0x00,0x0e,0x55,0x56,0x9d,0x9e,0x98,0xff,0x00,0x17,0xaa,0xaa,0x98,0xff,0x00,0x17,0xaa,0xac,0xff,0x00,0x06,0x80,0x00,0xff,0x00,0x19,0xd5,0x54,0x8b,0xa7,0x8b,0xff,0x00,0x10,0xaa,0xac,0xff,0xff,0xfc,0x55,0x56,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x4c,0x80,0xff,0x00,0x08,0xd5,0x54,0xff,0xff,0xf1,0x55,0x56,0xff,0x00,0x05,0x55,0x60,0x08,0xff,0x00,0x18,0xaa,0x7e,0xff,0x00,0x08,0xaa,0xac,0xff,0x00,0x13,0x2a,0xaa,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x0d,0xaa,0xd8,0xff,0x00,0x16,0x55,0x54,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x16,0x55,0x54,0xff,0x00,0x06,0xd5,0x56,0xff,0x00,0x17,0x80,0x00,0x8b,0xff,0x00,0x18,0xaa,0xac,0x8b,0xff,0x00,0x1b,0x54,0x8c,0x82,0xff,0x00,0x15,0x55,0x54,0x79,0xff,0x00,0x0f,0x56,0x20,0x79,0xff,0x00,0x0f,0x55,0x54,0x73,0xff,0x00,0x07,0xaa,0xac,0x6d,0x8b,0x67,0x8b,0xff,0xff,0xe2,0x2a,0xab,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xf1,0x2a,0xab,0x71,0x85,0xff,0xff,0xdf,0x55,0x54,0x08,0x89,0x80,0xc8,0x8b,0x8d,0x95,0x05,0xff,0x00,0x03,0x55,0x55,0x9b,0xff,0x00,0x07,0x2a,0xab,0xff,0x00,0x0c,0xaa,0xac,0x96,0xff,0x00,0x09,0x55,0x54,0x96,0xff,0x00,0x09,0x55,0x54,0xff,0x00,0x0d,0xd5,0x56,0xff,0x00,0x04,0xaa,0xac,0xff,0x00,0x10,0xaa,0xaa,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xfc,0x80,0x00,0x92,0x84,0x92,0x84,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x2a,0xac,0x8b,0xff,0xff,0xf3,0x55,0x54,0x8b,0x75,0xff,0xff,0xf9,0xd5,0x56,0xff,0xff,0xec,0x80,0x00,0xff,0xff,0xf3,0xaa,0xaa,0x7a,0xff,0xff,0xf3,0xaa,0xaa,0x7a,0xff,0xff,0xee,0xd5,0x56,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0x08,0x76,0x8b,0x7f,0x53,0xa0,0x8b,0x05,0x9b,0x8b,0xff,0x00,0x0c,0x2a,0xaa,0x87,0xff,0x00,0x08,0x55,0x56,0x83,0xff,0x00,0x08,0x55,0x56,0x83,0xff,0x00,0x04,0x2a,0xaa,0x80,0x8b,0x7d,0x8b,0x73,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xea,0x55,0x54,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xab,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xe8,0xaa,0xab,0x8b,0x7d,0x8b,0x80,0xff,0x00,0x03,0xaa,0xaa,0x83,0xff,0x00,0x07,0x55,0x56,0x83,0xff,0x00,0x07,0x55,0x56,0x87,0xff,0x00,0x09,0xaa,0xaa,0x8b,0x97,0x08,0x8b,0xff,0x00,0x04,0xaa,0xac,0x8c,0xff,0x00,0x07,0xaa,0xa8,0x8d,0xff,0x00,0x0a,0xaa,0xac,0x08,0x4f,0x06,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xed,0x55,0x54,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xf2,0x55,0x56,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x73,0x94,0xff,0xff,0xed,0x2a,0xaa,0x9d,0xff,0xff,0xf2,0x55,0x56,0x08,0x0b,0xfb,0x11,0xfb,0x11,0xca,0x8b,0xf7,0x26,0xf7,0x11,0x05,0x0b,0x42,0xfb,0xec,0xd0,0x8b,0xe4,0xf8,0x35,0x45,0x8b,0x36,0x55,0x7c,0x41,0x05,0x0b,0x79,0x38,0xf7,0x81,0xf7,0x5a,0xfb,0x2d,0xf7,0x5a,0x79,0x38,0xe4,0xfb,0x07,0x05,0x0b,0x98,0xc6,0x63,0x8b,0xa0,0xed,0x47,0x8b,0x76,0x29,0x32,0x8b,0xf7,0x45,0xf7,0xaf,0x47,0x8b,0xfb,0x45,0xfb,0xaf,0x7f,0x50,0xf7,0x30,0x8b,0x7b,0x40,0xd0,0x8b,0x9b,0xd6,0x05,0x0b,0x9d,0xff,0xff,0xf2,0x55,0x56,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xf9,0x2a,0xaa,0xff,0x00,0x1f,0x55,0x56,0x8b,0xa7,0x8b,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x07,0x2a,0xaa,0xa2,0xff,0x00,0x0e,0x55,0x56,0xa2,0xff,0x00,0x0e,0x55,0x56,0x9d,0x9e,0x98,0xff,0x00,0x17,0xaa,0xaa,0x98,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x06,0x80,0x00,0xff,0x00,0x19,0xd5,0x56,0x8b,0xa7,0x8b,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xfc,0x55,0x56,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x56,0x80,0xff,0x00,0x08,0xd5,0x54,0xff,0xff,0xf1,0x55,0x56,0xff,0x00,0x05,0x55,0x56,0x08,0xff,0x00,0x18,0xaa,0xa6,0xff,0x00,0x08,0xaa,0x2c,0xff,0x00,0x13,0x2a,0xaa,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x0d,0xaa,0xb0,0xff,0x00,0x16,0x55,0xd4,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x16,0x55,0x54,0xff,0x00,0x06,0xd5,0x56,0xff,0x00,0x17,0x80,0x00,0x8b,0xff,0x00,0x18,0xaa,0xac,0x8b,0xff,0x00,0x1b,0x54,0xb4,0x82,0xff,0x00,0x15,0x55,0x54,0x79,0xff,0x00,0x0f,0x55,0xf8,0x79,0xff,0x00,0x0f,0x55,0x54,0x73,0xff,0x00,0x07,0xaa,0xac,0x6d,0x8b,0x67,0x8b,0xff,0xff,0xe2,0x2a,0xab,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xf1,0x2a,0xab,0x71,0x85,0xff,0xff,0xdf,0x55,0x54,0x08,0x89,0x80,0xc8,0x8b,0x8d,0x95,0x05,0xff,0x00,0x03,0x55,0x55,0x9b,0xff,0x00,0x07,0x2a,0xab,0xff,0x00,0x0c,0xaa,0xac,0x96,0xff,0x00,0x09,0x55,0x54,0x96,0xff,0x00,0x09,0x55,0x54,0xff,0x00,0x0d,0xd5,0x55,0xff,0x00,0x04,0xaa,0xac,0xff,0x00,0x10,0xaa,0xab,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xfc,0x80,0x00,0x92,0x84,0x92,0x84,0xff,0x00,0x03,0x80,0x00,0xff,0xff,0xf6,0x2a,0xac,0x8b,0xff,0xff,0xf3,0x55,0x54,0x8b,0x75,0xff,0xff,0xf9,0xd5,0x56,0xff,0xff,0xec,0x80,0x00,0xff,0xff,0xf3,0xaa,0xaa,0x7a,0xff,0xff,0xf3,0xaa,0xaa,0x7a,0xff,0xff,0xee,0xd5,0x55,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xea,0x00,0x01,0x8b,0x08,0x76,0x8b,0x7f,0x53,0xa0,0x8b,0x05,0x9b,0x8b,0xff,0x00,0x0c,0x2a,0xab,0x87,0xff,0x00,0x08,0x55,0x55,0x83,0xff,0x00,0x08,0x55,0x56,0x83,0xff,0x00,0x04,0x2a,0xaa,0x80,0x8b,0x7d,0x8b,0x73,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xe8,0xaa,0xab,0x8b,0x7d,0x8b,0x80,0xff,0x00,0x03,0xaa,0xaa,0x83,0xff,0x00,0x07,0x55,0x56,0x83,0xff,0x00,0x07,0x55,0x56,0x87,0xff,0x00,0x09,0xaa,0xaa,0x8b,0x97,0x08,0x8b,0xff,0x00,0x04,0xaa,0x4e,0x8c,0xff,0x00,0x07,0xaa,0xaa,0x8d,0xff,0x00,0x0a,0xab,0x08,0x08,0x4f,0x06,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xfd,0xaa,0xaa,0xff,0xff,0xf2,0x55,0x54,0x8b,0xff,0xff,0xf7,0x55,0x56,0x8b,0x73,0x94,0xff,0xff,0xed,0x2a,0xaa,0x9d,0xff,0xff,0xf2,0x55,0x56,0x08,0x0b,0xfb,0x1d,0xfb,0x24,0xc8,0x8b,0xe9,0xea,0xbe,0x2c,0xc9,0x8b,0x3f,0xf7,0x24,0x05,0x0b,0x9c,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x15,0xd5,0x56,0xff,0xff,0xf7,0x55,0x54,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xa5,0x8b,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xac,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x08,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xac,0x8b,0xa5,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xf7,0x55,0x56,0xa1,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x08,0xaa,0xac,0x71,0x8b,0xff,0xff,0xe5,0x55,0x56,0x8b,0xff,0xff,0xea,0x2a,0xaa,0xff,0xff,0xf7,0x55,0x54,0x7a,0xff,0xff,0xee,0xaa,0xac,0x08,0x7a,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x8b,0x71,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xea,0x55,0x54,0x9c,0xff,0xff,0xee,0xaa,0xac,0x08,0x0b,0xd6,0xfb,0x24,0xc3,0x8b,0xf7,0x1d,0xf7,0x24,0x4b,0x8b,0x2e,0x2a,0x57,0xec,0x05,0x0b,0xbe,0xf7,0x7a,0x39,0x4d,0x68,0xfb,0x3c,0x05,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x48,0x00,0x50,0x00,0x00,0x00,0x02,0x00,0x09,0x00,0x01,0x00,0x7c,0x00,0x01,0x00,0x7d,0x00,0x7f,0x00,0x02,0x00,0x80,0x00,0xce,0x00,0x01,0x00,0xcf,0x00,0xd4,0x00,0x03,0x00,0xd5,0x00,0xe5,0x00,0x01,0x00,0xe6,0x00,0xe7,0x00,0x02,0x00,0xe8,0x00,0xe9,0x00,0x01,0x00,0xea,0x00,0xea,0x00,0x02,0x00,0xeb,0x00,0xfa,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0xcf,0x00,0xd4,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x28,0x00,0x72,0x00,0x01,0x44,0x46,0x4c,0x54,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,0x61,0x61,0x6c,0x74,0x00,0x26,0x64,0x6c,0x69,0x67,0x00,0x2c,0x66,0x72,0x61,0x63,0x00,0x32,0x6c,0x69,0x67,0x61,0x00,0x38,0x6f,0x72,0x64,0x6e,0x00,0x3e,0x73,0x75,0x70,0x73,0x00,0x44,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x07,0x00,0x10,0x00,0x18,0x00,0x20,0x00,0x28,0x00,0x32,0x00,0x3a,0x00,0x42,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x3a,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x58,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x66,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x92,0x00,0xb6,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0xd0,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0xe0,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0xf8,0x00,0x02,0x00,0x14,0x00,0x07,0x00,0x7a,0x00,0x73,0x00,0x74,0x00,0x6b,0x00,0x7b,0x00,0x6b,0x00,0x7b,0x00,0x01,0x00,0x07,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x23,0x00,0x31,0x00,0x43,0x00,0x51,0x00,0x02,0x00,0x0c,0x00,0x03,0x00,0x7a,0x00,0x73,0x00,0x74,0x00,0x01,0x00,0x03,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x01,0x00,0x2c,0x00,0x02,0x00,0x0a,0x00,0x20,0x00,0x02,0x00,0x06,0x00,0x0e,0x00,0x7e,0x00,0x03,0x00,0x11,0x00,0x14,0x00,0x7d,0x00,0x03,0x00,0x11,0x00,0x16,0x00,0x01,0x00,0x04,0x00,0x7f,0x00,0x03,0x00,0x11,0x00,0x16,0x00,0x01,0x00,0x02,0x00,0x13,0x00,0x15,0x00,0x03,0x00,0x01,0x00,0x1a,0x00,0x01,0x00,0x12,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x02,0x00,0x23,0x00,0x43,0x00,0x02,0x00,0x01,0x00,0x12,0x00,0x1b,0x00,0x00,0x00,0x03,0x00,0x01,0x00,0x1a,0x00,0x01,0x00,0x12,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x02,0x00,0x31,0x00,0x51,0x00,0x02,0x00,0x01,0x00,0x12,0x00,0x1b,0x00,0x00,0x00,0x01,0x00,0x12,0x00,0x01,0x00,0x08,0x00,0x01,0x00,0x04,0x00,0xea,0x00,0x02,0x00,0x56,0x00,0x01,0x00,0x01,0x00,0x56,0x00,0x01,0x00,0x1a,0x00,0x01,0x00,0x08,0x00,0x02,0x00,0x06,0x00,0x0c,0x00,0xe7,0x00,0x02,0x00,0x4e,0x00,0xe6,0x00,0x02,0x00,0x4b,0x00,0x01,0x00,0x01,0x00,0x48,0x00,0x02,0x00,0x0e,0x00,0x04,0x00,0x6b,0x00,0x7b,0x00,0x6b,0x00,0x7b,0x00,0x01,0x00,0x04,0x00,0x23,0x00,0x31,0x00,0x43,0x00,0x51,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x20,0x00,0x3c,0x00,0x01,0x44,0x46,0x4c,0x54,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x02,0x6b,0x65,0x72,0x6e,0x00,0x0e,0x6d,0x61,0x72,0x6b,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x03,0x00,0x08,0x00,0x18,0x00,0x24,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x24,0x00,0x94,0x04,0xd6,0x05,0x4c,0x06,0x44,0x00,0x02,0x00,0x00,0x00,0x03,0x07,0x68,0x07,0xca,0x08,0x14,0x00,0x04,0x00,0x00,0x00,0x01,0x08,0x4c,0x00,0x01,0x00,0x5a,0x00,0x04,0x00,0x00,0x00,0x09,0x00,0x1c,0x00,0x26,0x00,0x2c,0x00,0x32,0x00,0x38,0x00,0x3e,0x00,0x44,0x00,0x4e,0x00,0x54,0x00,0x02,0x00,0x38,0xff,0xf2,0x00,0x3b,0xff,0xf6,0x00,0x01,0x00,0x49,0xff,0xe7,0x00,0x01,0x00,0x5c,0xff,0xba,0x00,0x01,0x00,0x5c,0xff,0xd8,0x00,0x01,0x00,0x49,0x00,0x0a,0x00,0x01,0x00,0x4c,0x00,0x14,0x00,0x02,0x00,0xd8,0xff,0xf6,0x00,0xdb,0xff,0xf6,0x00,0x01,0x00,0x90,0x00,0x5a,0x00,0x01,0x00,0xb0,0x00,0x65,0x00,0x01,0x00,0x09,0x00,0x24,0x00,0x27,0x00,0x36,0x00,0x3b,0x00,0x49,0x00,0x4c,0x00,0x50,0x00,0x90,0x00,0xb0,0x00,0x02,0x04,0x1c,0x00,0x04,0x00,0x00,0x02,0xf0,0x03,0x28,0x00,0x10,0x00,0x17,0x00,0x00,0xff,0xf7,0xff,0xb3,0xff,0xed,0xff,0xdb,0xff,0xed,0xff,0xd1,0x00,0x14,0xff,0xcb,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x76,0x00,0x00,0xff,0xec,0xff,0xbc,0xff,0xce,0xff,0xd5,0xff,0xce,0xff,0xd2,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xd9,0x00,0x00,0xff,0xf6,0xff,0xfa,0xff,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xd9,0xff,0x8e,0xff,0xca,0xff,0x9b,0xff,0xbb,0xff,0x96,0x00,0x00,0xff,0x9a,0xff,0xa5,0x00,0x00,0xff,0xf0,0xff,0xe1,0xff,0xe4,0x00,0x00,0x00,0x00,0xff,0x7e,0xff,0x88,0xff,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x90,0x00,0x00,0x00,0x00,0xff,0xd4,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0xff,0xb2,0x00,0x00,0xff,0xc4,0xff,0xb3,0xff,0xae,0xff,0xbc,0xff,0xb0,0xff,0xb9,0x00,0x00,0xff,0xba,0x00,0x00,0x00,0x00,0xff,0xd9,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xd9,0x00,0x00,0x00,0x00,0xff,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xbc,0x00,0x00,0x00,0x01,0xff,0xe2,0xff,0xd9,0xff,0xe4,0xff,0xda,0x00,0x00,0x00,0x00,0xff,0xd9,0x00,0x00,0x00,0x00,0xff,0xed,0x00,0x00,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc8,0x00,0x00,0x00,0x00,0xff,0xed,0xff,0xed,0xff,0xfb,0xff,0xee,0x00,0x00,0x00,0x00,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xa4,0x00,0x14,0xff,0xe8,0xff,0xd1,0xff,0xc3,0xff,0xd6,0xff,0xba,0xff,0xc4,0x00,0x00,0xff,0xba,0x00,0x00,0x00,0x00,0xff,0xe3,0x00,0x00,0xff,0xce,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfd,0x00,0x00,0xff,0xf8,0xff,0xf9,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xec,0x00,0x00,0xff,0xdd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x24,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x0d,0x00,0x0e,0x00,0x06,0x00,0x07,0x00,0x08,0x00,0x09,0x00,0x0a,0x00,0x0b,0x00,0x0f,0x00,0x02,0x00,0x28,0x00,0x0e,0x00,0x0e,0x00,0x07,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x07,0x00,0x1c,0x00,0x1d,0x00,0x13,0x00,0x23,0x00,0x23,0x00,0x0a,0x00,0x25,0x00,0x25,0x00,0x01,0x00,0x29,0x00,0x29,0x00,0x01,0x00,0x31,0x00,0x31,0x00,0x01,0x00,0x33,0x00,0x33,0x00,0x01,0x00,0x36,0x00,0x36,0x00,0x02,0x00,0x37,0x00,0x37,0x00,0x03,0x00,0x38,0x00,0x38,0x00,0x04,0x00,0x39,0x00,0x39,0x00,0x05,0x00,0x3b,0x00,0x3b,0x00,0x06,0x00,0x3e,0x00,0x3e,0x00,0x12,0x00,0x43,0x00,0x43,0x00,0x0b,0x00,0x45,0x00,0x47,0x00,0x0d,0x00,0x4b,0x00,0x4b,0x00,0x0f,0x00,0x50,0x00,0x50,0x00,0x0c,0x00,0x51,0x00,0x51,0x00,0x0d,0x00,0x53,0x00,0x53,0x00,0x0d,0x00,0x54,0x00,0x54,0x00,0x0c,0x00,0x55,0x00,0x55,0x00,0x0e,0x00,0x57,0x00,0x57,0x00,0x0c,0x00,0x58,0x00,0x59,0x00,0x09,0x00,0x5a,0x00,0x5a,0x00,0x14,0x00,0x5b,0x00,0x5b,0x00,0x09,0x00,0x6c,0x00,0x6c,0x00,0x16,0x00,0x7c,0x00,0x7c,0x00,0x15,0x00,0x86,0x00,0x86,0x00,0x0a,0x00,0x99,0x00,0x99,0x00,0x01,0x00,0xa7,0x00,0xa7,0x00,0x0b,0x00,0xc2,0x00,0xc2,0x00,0x01,0x00,0xc3,0x00,0xc3,0x00,0x0d,0x00,0xd7,0x00,0xd7,0x00,0x11,0x00,0xd8,0x00,0xd8,0x00,0x08,0x00,0xd9,0x00,0xd9,0x00,0x07,0x00,0xda,0x00,0xda,0x00,0x11,0x00,0xdb,0x00,0xdb,0x00,0x08,0x00,0xdc,0x00,0xdc,0x00,0x07,0x00,0x01,0x00,0x11,0x00,0x23,0x00,0x24,0x00,0x27,0x00,0x28,0x00,0x2d,0x00,0x2e,0x00,0x32,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x86,0x00,0x02,0x00,0x66,0x00,0x04,0x00,0x00,0x00,0x1e,0x00,0x26,0x00,0x01,0x00,0x07,0x00,0x00,0xff,0xf1,0xff,0xf7,0xff,0xef,0xff,0xee,0xff,0xe1,0xff,0xec,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x0a,0x00,0x0e,0x00,0x0e,0x00,0x05,0x00,0x10,0x00,0x10,0x00,0x05,0x00,0x23,0x00,0x23,0x00,0x01,0x00,0x38,0x00,0x38,0x00,0x02,0x00,0x3a,0x00,0x3a,0x00,0x03,0x00,0x3b,0x00,0x3b,0x00,0x04,0x00,0x5c,0x00,0x5c,0x00,0x06,0x00,0x86,0x00,0x86,0x00,0x01,0x00,0xd9,0x00,0xd9,0x00,0x05,0x00,0xdc,0x00,0xdc,0x00,0x05,0x00,0x01,0x00,0x06,0x00,0x02,0x00,0x25,0x00,0x26,0x00,0x29,0x00,0x31,0x00,0x99,0x00,0x02,0x00,0xdc,0x00,0x04,0x00,0x00,0x00,0x58,0x00,0x90,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x13,0xff,0xd9,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc1,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf3,0x00,0x01,0x00,0x43,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x04,0x00,0x02,0x00,0x0c,0x00,0x0e,0x00,0x0e,0x00,0x02,0x00,0x10,0x00,0x10,0x00,0x02,0x00,0x45,0x00,0x47,0x00,0x05,0x00,0x48,0x00,0x48,0x00,0x01,0x00,0x51,0x00,0x51,0x00,0x05,0x00,0x53,0x00,0x53,0x00,0x05,0x00,0x5a,0x00,0x5a,0x00,0x04,0x00,0xc3,0x00,0xc3,0x00,0x05,0x00,0xd8,0x00,0xd8,0x00,0x03,0x00,0xd9,0x00,0xd9,0x00,0x02,0x00,0xdb,0x00,0xdb,0x00,0x03,0x00,0xdc,0x00,0xdc,0x00,0x02,0x00,0x01,0x00,0x0c,0x00,0x43,0x00,0x45,0x00,0x47,0x00,0x48,0x00,0x50,0x00,0x51,0x00,0x54,0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5a,0x00,0x5b,0x00,0x02,0x01,0x20,0x00,0x04,0x00,0x00,0x00,0x94,0x00,0xc2,0x00,0x06,0x00,0x0b,0x00,0x00,0xff,0xba,0xff,0xd9,0xff,0xe1,0xff,0xba,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x14,0xff,0xcb,0xff,0xb5,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc1,0xff,0xd4,0x00,0x10,0x00,0x00,0x00,0x00,0xff,0xf6,0x00,0x00,0xff,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xce,0x00,0x00,0x00,0x00,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xba,0xff,0xba,0x00,0x00,0xff,0xba,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x00,0x6c,0x00,0x6c,0x00,0x03,0x00,0x7c,0x00,0x7c,0x00,0x04,0x00,0xd7,0x00,0xd7,0x00,0x01,0x00,0xd8,0x00,0xd8,0x00,0x02,0x00,0xda,0x00,0xda,0x00,0x01,0x00,0xdb,0x00,0xdb,0x00,0x02,0x00,0xdc,0x00,0xdc,0x00,0x05,0x00,0x02,0x00,0x0f,0x00,0x23,0x00,0x23,0x00,0x05,0x00,0x2c,0x00,0x2c,0x00,0x06,0x00,0x36,0x00,0x36,0x00,0x01,0x00,0x38,0x00,0x38,0x00,0x02,0x00,0x39,0x00,0x39,0x00,0x03,0x00,0x3b,0x00,0x3b,0x00,0x04,0x00,0x45,0x00,0x47,0x00,0x08,0x00,0x51,0x00,0x51,0x00,0x08,0x00,0x53,0x00,0x53,0x00,0x08,0x00,0x55,0x00,0x55,0x00,0x09,0x00,0x58,0x00,0x59,0x00,0x0a,0x00,0x5b,0x00,0x5b,0x00,0x0a,0x00,0x86,0x00,0x86,0x00,0x05,0x00,0x87,0x00,0x87,0x00,0x07,0x00,0xc3,0x00,0xc3,0x00,0x08,0x00,0x01,0x00,0x08,0x00,0x0f,0x00,0x6c,0x00,0x7c,0x00,0xd7,0x00,0xd8,0x00,0xda,0x00,0xdb,0x00,0xdc,0x00,0x01,0x00,0x4e,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x1a,0x00,0x20,0x00,0x26,0x00,0x2c,0x00,0x32,0x00,0x38,0x00,0x26,0x00,0x1a,0x00,0x01,0x00,0x19,0xff,0xec,0x00,0x01,0x00,0x19,0xff,0xf6,0x00,0x01,0x00,0x19,0xff,0xe2,0x00,0x01,0x00,0x19,0xff,0xd8,0x00,0x01,0x00,0x19,0xff,0xe1,0x00,0x05,0x00,0x15,0xff,0xec,0x00,0x16,0xff,0xd8,0x00,0x18,0xff,0xd8,0x00,0x1a,0xff,0xf6,0x00,0x1b,0xff,0xf1,0x00,0x01,0x00,0x08,0x00,0x12,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x18,0x00,0x19,0x00,0x1a,0x00,0x1b,0x00,0x02,0x00,0x40,0x00,0x04,0x00,0x00,0x00,0x1e,0x00,0x26,0x00,0x01,0x00,0x07,0x00,0x00,0xff,0xf5,0xff,0xc7,0xff,0xdf,0xff,0xfc,0xff,0xfd,0xff,0xf3,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x12,0x00,0x0a,0x00,0x06,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x03,0x00,0x0e,0x00,0x10,0x00,0xd9,0x00,0x02,0x00,0x3c,0x00,0x04,0x00,0x00,0x00,0x18,0x00,0x20,0x00,0x02,0x00,0x02,0x00,0x00,0xff,0xdb,0x00,0x00,0xff,0xa3,0x00,0x01,0x00,0x19,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x0e,0x00,0x0e,0x00,0x01,0x00,0x10,0x00,0x10,0x00,0x01,0x00,0xd9,0x00,0xd9,0x00,0x01,0x00,0xdc,0x00,0xdc,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x19,0x00,0x1b,0x00,0x01,0x03,0x18,0x02,0x7e,0x00,0x01,0x03,0x22,0x00,0x0c,0x00,0x4e,0x00,0x9e,0x00,0xa4,0x00,0xaa,0x00,0xb0,0x00,0xb6,0x00,0xbc,0x00,0xc2,0x00,0xc8,0x00,0xce,0x00,0xd4,0x00,0xda,0x00,0xe0,0x00,0xe6,0x00,0xec,0x00,0xf2,0x00,0xf8,0x00,0xfe,0x01,0x04,0x01,0x0a,0x01,0x10,0x01,0x16,0x01,0x1c,0x01,0x22,0x01,0x28,0x01,0x2e,0x01,0x34,0x01,0x3a,0x01,0x40,0x01,0x46,0x01,0x4c,0x01,0x52,0x01,0x58,0x01,0x5e,0x01,0x64,0x01,0x6a,0x01,0x70,0x01,0x76,0x01,0x7c,0x01,0x82,0x01,0x88,0x01,0x8e,0x01,0x94,0x01,0x9a,0x01,0xa0,0x01,0xa6,0x01,0xac,0x01,0xb2,0x01,0xb8,0x01,0xbe,0x01,0xc4,0x01,0xca,0x01,0xd0,0x01,0xd6,0x01,0xdc,0x01,0xe2,0x01,0xe8,0x01,0xee,0x01,0xf4,0x01,0xfa,0x02,0x00,0x02,0x06,0x02,0x0c,0x02,0x12,0x02,0x18,0x02,0x1e,0x02,0x24,0x02,0x2a,0x02,0x30,0x02,0x36,0x02,0x3c,0x02,0x42,0x02,0x48,0x02,0x4e,0x02,0x54,0x02,0x5a,0x02,0x60,0x02,0x66,0x02,0x6c,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x75,0x02,0xb2,0x00,0x01,0x00,0xd9,0x02,0xb2,0x00,0x01,0x01,0x9e,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x55,0x02,0xb2,0x00,0x01,0x01,0x95,0x02,0xb2,0x00,0x01,0x01,0x4c,0x02,0xb2,0x00,0x01,0x01,0x55,0x02,0xb2,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x2c,0x01,0xfb,0x00,0x01,0x00,0xa3,0x01,0xfb,0x00,0x01,0x01,0x37,0x01,0xfb,0x00,0x01,0x01,0x2e,0x01,0xfb,0x00,0x01,0x01,0x00,0x01,0xfb,0x00,0x01,0x01,0x3b,0x01,0xfb,0x00,0x01,0x01,0x09,0x01,0xfb,0x00,0x01,0x01,0x05,0x01,0xfb,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x69,0x02,0xa4,0x00,0x01,0x01,0x75,0x02,0xb2,0x00,0x01,0x01,0x75,0x02,0xb2,0x00,0x01,0x01,0x75,0x02,0xb2,0x00,0x01,0x01,0x75,0x02,0xb2,0x00,0x01,0x00,0xd9,0x02,0xb2,0x00,0x01,0x00,0xd9,0x02,0xb2,0x00,0x01,0x00,0xd9,0x02,0xb2,0x00,0x01,0x00,0xd9,0x02,0xb2,0x00,0x01,0x01,0x9e,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x83,0x02,0xb2,0x00,0x01,0x01,0x95,0x02,0xb2,0x00,0x01,0x01,0x95,0x02,0xb2,0x00,0x01,0x01,0x95,0x02,0xb2,0x00,0x01,0x01,0x95,0x02,0xb2,0x00,0x01,0x01,0x4c,0x02,0xb2,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x26,0x01,0xfb,0x00,0x01,0x01,0x2c,0x01,0xfb,0x00,0x01,0x01,0x2c,0x01,0xfb,0x00,0x01,0x01,0x2c,0x01,0xfb,0x00,0x01,0x01,0x2c,0x01,0xfb,0x00,0x01,0x00,0xa3,0x01,0xfb,0x00,0x01,0x00,0xa3,0x01,0xfb,0x00,0x01,0x00,0xa3,0x01,0xfb,0x00,0x01,0x00,0xa3,0x01,0xfb,0x00,0x01,0x01,0x37,0x01,0xfb,0x00,0x01,0x01,0x2e,0x01,0xfb,0x00,0x01,0x01,0x2e,0x01,0xfb,0x00,0x01,0x01,0x2e,0x01,0xfb,0x00,0x01,0x01,0x2e,0x01,0xfb,0x00,0x01,0x01,0x2e,0x01,0xfb,0x00,0x01,0x01,0x3b,0x01,0xfb,0x00,0x01,0x01,0x3b,0x01,0xfb,0x00,0x01,0x01,0x3b,0x01,0xfb,0x00,0x01,0x01,0x3b,0x01,0xfb,0x00,0x01,0x01,0x09,0x01,0xfb,0x00,0x01,0x01,0x09,0x01,0xfb,0x00,0x01,0x00,0xa3,0x01,0xfb,0x00,0x01,0x03,0x25,0x01,0xfb,0x00,0x01,0x01,0x55,0x02,0xb2,0x00,0x01,0x01,0x00,0x01,0xfb,0x00,0x01,0x01,0x4c,0x02,0xb2,0x00,0x01,0x01,0x55,0x02,0xb2,0x00,0x01,0x01,0x05,0x01,0xfb,0x00,0x02,0x00,0x19,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x27,0x00,0x27,0x00,0x01,0x00,0x2b,0x00,0x2b,0x00,0x02,0x00,0x30,0x00,0x31,0x00,0x03,0x00,0x33,0x00,0x33,0x00,0x05,0x00,0x35,0x00,0x35,0x00,0x06,0x00,0x37,0x00,0x37,0x00,0x07,0x00,0x3b,0x00,0x3c,0x00,0x08,0x00,0x43,0x00,0x43,0x00,0x0a,0x00,0x47,0x00,0x47,0x00,0x0b,0x00,0x4b,0x00,0x4b,0x00,0x0c,0x00,0x50,0x00,0x51,0x00,0x0d,0x00,0x55,0x00,0x55,0x00,0x0f,0x00,0x57,0x00,0x57,0x00,0x10,0x00,0x5b,0x00,0x5c,0x00,0x11,0x00,0x81,0x00,0x86,0x00,0x13,0x00,0x89,0x00,0x90,0x00,0x19,0x00,0x92,0x00,0x97,0x00,0x21,0x00,0x99,0x00,0x9e,0x00,0x27,0x00,0xa1,0x00,0xa6,0x00,0x2d,0x00,0xa9,0x00,0xb0,0x00,0x33,0x00,0xb2,0x00,0xb7,0x00,0x3b,0x00,0xba,0x00,0xbe,0x00,0x41,0x00,0xc0,0x00,0xc1,0x00,0x46,0x00,0xc3,0x00,0xc8,0x00,0x48,0x00,0x02,0x00,0x01,0x00,0xcf,0x00,0xd4,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x01,0xfb,0x00,0x01,0x00,0x36,0x01,0xfb,0x00,0x01,0x00,0x36,0x01,0xfb,0x00,0x01,0x00,0x36,0x01,0xfb,0x00,0x01,0x00,0x36,0x01,0xfb,0x00,0x01,0x00,0x36,0x01,0xfb,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xcc,0x3d,0xa2,0xcf,0x00,0x00,0x00,0x00,0xd3,0x57,0xea,0xdd,0x00,0x00,0x00,0x00,0xd6,0x21,0x41,0x55,0x02,0x58,0x00,0x79,0x02,0x58,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,0xef,0x00,0x15,0x01,0x34,0x00,0x60,0x02,0x00,0x00,0x12,0x01,0xc9,0x00,0x15,0x03,0x7a,0x00,0x53,0x02,0x58,0x00,0x26,0x00,0xab,0x00,0x60,0x01,0x21,0x00,0x3a,0x01,0x21,0xff,0xf3,0x01,0x7a,0x00,0x70,0x02,0x00,0x00,0x3e,0x00,0xae,0xff,0xe1,0x01,0x8a,0x00,0x49,0x00,0xef,0x00,0x16,0x01,0x88,0x00,0x03,0x01,0xec,0x00,0x30,0x01,0x49,0x00,0x6a,0x01,0xd5,0x00,0x06,0x01,0xef,0x00,0x27,0x01,0xf3,0x00,0x15,0x01,0xe3,0x00,0x29,0x01,0xee,0x00,0x28,0x01,0xaf,0x00,0x27,0x02,0x00,0x00,0x2f,0x01,0xee,0x00,0x64,0x00,0xc2,0xff,0xff,0x00,0xc3,0xff,0xf6,0x02,0x00,0x00,0x2c,0x02,0x00,0x00,0x3d,0x02,0x00,0x00,0x4f,0x01,0xae,0x00,0x5f,0x03,0x68,0x00,0x30,0x02,0x3a,0xff,0xce,0x02,0x69,0x00,0x1a,0x02,0x62,0x00,0x3a,0x02,0x6c,0x00,0x1a,0x02,0x2c,0x00,0x1a,0x02,0x1b,0x00,0x1a,0x02,0x62,0x00,0x3a,0x02,0x75,0x00,0x1a,0x00,0xf9,0x00,0x22,0x01,0x3a,0xff,0xea,0x02,0x50,0x00,0x1a,0x02,0x12,0x00,0x1b,0x02,0xf0,0x00,0x1a,0x02,0x97,0x00,0x1a,0x02,0x61,0x00,0x3a,0x02,0x43,0x00,0x1a,0x02,0x61,0x00,0x3a,0x02,0x57,0x00,0x1a,0x02,0x26,0x00,0x13,0x01,0xe3,0x00,0x57,0x02,0x7b,0x00,0x45,0x02,0x04,0x00,0x61,0x03,0x15,0x00,0x61,0x02,0x2e,0xff,0xce,0x01,0xec,0x00,0x61,0x02,0x09,0xff,0xf2,0x01,0x27,0x00,0x08,0x01,0x88,0x00,0x98,0x01,0x27,0xff,0xf3,0x02,0x00,0x00,0x3c,0x01,0xc9,0xff,0xb4,0x01,0xe7,0x00,0xf4,0x01,0xfe,0x00,0x28,0x01,0xfe,0x00,0x15,0x01,0xf8,0x00,0x2a,0x01,0xff,0x00,0x28,0x01,0xf8,0x00,0x2b,0x01,0x48,0x00,0x3d,0x01,0xff,0x00,0x09,0x02,0x0a,0x00,0x15,0x00,0xda,0x00,0x16,0x00,0xec,0xff,0x95,0x01,0xe9,0x00,0x15,0x01,0x11,0x00,0x2c,0x03,0x3a,0x00,0x16,0x02,0x0b,0x00,0x16,0x01,0xf9,0x00,0x29,0x02,0x00,0xff,0xf6,0x01,0xfe,0x00,0x28,0x01,0x52,0x00,0x16,0x01,0xd2,0x00,0x18,0x01,0x5f,0x00,0x51,0x02,0x0b,0x00,0x37,0x01,0xb7,0x00,0x44,0x02,0xca,0x00,0x44,0x01,0xa8,0xff,0xd9,0x01,0xb8,0xff,0xed,0x01,0xc9,0x00,0x05,0x01,0x54,0x00,0x44,0x01,0xde,0x00,0xdd,0x01,0xcb,0x00,0x2e,0x02,0x00,0x00,0x32,0x00,0xd9,0x00,0x00,0x00,0xef,0xff,0xf8,0x01,0xf8,0x00,0x2a,0x01,0xb4,0x00,0x00,0x02,0x65,0x00,0x34,0x01,0xc6,0x00,0x1c,0x01,0xde,0x00,0xdd,0x01,0xff,0x00,0x20,0x01,0xf4,0x00,0xc3,0x03,0x47,0x00,0x5e,0x01,0x4c,0x00,0x64,0x01,0xde,0x00,0x1b,0x02,0x00,0x00,0x32,0x01,0x8a,0x00,0x49,0x02,0x22,0x00,0x89,0x01,0xe7,0x00,0xbf,0x01,0x6f,0x00,0x6d,0x02,0x00,0x00,0x27,0x01,0x81,0x00,0x72,0x01,0x67,0x00,0x73,0x01,0xf4,0x00,0xe2,0x02,0x04,0xff,0xf6,0x02,0x3c,0x00,0x7a,0x00,0xef,0x00,0x45,0x01,0xe7,0x00,0x66,0x00,0xfb,0x00,0x99,0x01,0x4a,0x00,0x64,0x01,0xdf,0x00,0x24,0x03,0x06,0x00,0x44,0x03,0x2e,0x00,0x44,0x03,0x72,0x00,0x50,0x01,0xae,0xff,0xf6,0x02,0x3a,0xff,0xce,0x02,0x3a,0xff,0xce,0x02,0x3a,0xff,0xce,0x02,0x3a,0xff,0xce,0x02,0x3a,0xff,0xce,0x02,0x3a,0xff,0xce,0x03,0x67,0xff,0xce,0x02,0x62,0x00,0x3a,0x02,0x2c,0x00,0x1a,0x02,0x2c,0x00,0x1a,0x02,0x2c,0x00,0x1a,0x02,0x2c,0x00,0x1a,0x00,0xf9,0x00,0x22,0x00,0xf9,0x00,0x22,0x00,0xf9,0x00,0x22,0x00,0xf9,0x00,0x22,0x02,0x91,0x00,0x32,0x02,0x97,0x00,0x1a,0x02,0x61,0x00,0x3a,0x02,0x61,0x00,0x3a,0x02,0x61,0x00,0x3a,0x02,0x61,0x00,0x3a,0x02,0x61,0x00,0x3a,0x02,0x00,0x00,0x5d,0x02,0x61,0x00,0x08,0x02,0x7b,0x00,0x45,0x02,0x7b,0x00,0x45,0x02,0x7b,0x00,0x45,0x02,0x7b,0x00,0x45,0x01,0xec,0x00,0x61,0x02,0x43,0x00,0x1a,0x01,0xfa,0x00,0x16,0x01,0xfe,0x00,0x28,0x01,0xfe,0x00,0x28,0x01,0xfe,0x00,0x28,0x01,0xfe,0x00,0x28,0x01,0xfe,0x00,0x28,0x01,0xfe,0x00,0x28,0x03,0x2c,0x00,0x22,0x01,0xf8,0x00,0x2a,0x01,0xf8,0x00,0x2b,0x01,0xf8,0x00,0x2b,0x01,0xf8,0x00,0x2b,0x01,0xf8,0x00,0x2b,0x00,0xda,0x00,0x16,0x00,0xda,0x00,0x16,0x00,0xda,0x00,0x16,0x00,0xda,0x00,0x16,0x01,0xf1,0x00,0x29,0x02,0x0b,0x00,0x16,0x01,0xf9,0x00,0x29,0x01,0xf9,0x00,0x29,0x01,0xf9,0x00,0x29,0x01,0xf9,0x00,0x29,0x01,0xf9,0x00,0x29,0x02,0x00,0x00,0x3e,0x01,0xf9,0x00,0x00,0x02,0x0b,0x00,0x37,0x02,0x0b,0x00,0x37,0x02,0x0b,0x00,0x37,0x02,0x0b,0x00,0x37,0x01,0xb8,0xff,0xed,0x02,0x00,0xff,0xf5,0x01,0xb8,0xff,0xed,0x00,0xda,0x00,0x16,0x03,0xb4,0x00,0x3a,0x03,0x37,0x00,0x29,0x02,0x26,0x00,0x13,0x01,0xd2,0x00,0x18,0x01,0xec,0x00,0x61,0x02,0x09,0xff,0xf2,0x01,0xc9,0x00,0x05,0x01,0x97,0xff,0xb7,0x01,0xe7,0x00,0xb5,0x01,0xf4,0x00,0xd4,0x01,0xf4,0x01,0x0d,0x01,0xf4,0x00,0xf3,0x01,0xe7,0x00,0xc1,0x00,0x00,0xff,0xe7,0x00,0x00,0x00,0x01,0x00,0x00,0xff,0xbc,0x00,0x00,0xff,0xc7,0x00,0x00,0xff,0xc9,0x00,0x00,0xff,0xf9,0x01,0xa1,0x00,0x0d,0x03,0x41,0x00,0x0d,0x00,0xae,0x00,0x64,0x00,0xae,0x00,0x60,0x00,0xae,0xff,0xe1,0x01,0x39,0x00,0x65,0x01,0x39,0x00,0x61,0x01,0x37,0xff,0xe2,0x02,0x0f,0x00,0x66,0x02,0x0f,0x00,0x29,0x01,0xde,0x00,0x80,0x02,0xc5,0x00,0x16,0x04,0xde,0x00,0x53,0x01,0x27,0x00,0x1b,0x01,0x28,0x00,0x24,0x02,0x2a,0x00,0x33,0x03,0x87,0x00,0x85,0x02,0x22,0x00,0x3d,0x02,0x59,0x00,0x3d,0x00,0x00,0x00,0x00,0x02,0x58,0x00,0x00,0x02,0x7d,0x00,0x51,0x01,0x64,0x00,0x19,0x00,0xfb,0x00,0x3e,0x01,0x81,0x00,0x16,0x01,0x67,0x00,0x16,0x01,0x59,0x00,0x03,0x01,0x64,0x00,0x53,0x00,0xfb,0x00,0x78,0x01,0x81,0x00,0x50,0x01,0x67,0x00,0x50,0x01,0x59,0x00,0x3d,0x01,0x64,0x00,0x75,0x00,0xfb,0x00,0x99,0x01,0x81,0x00,0x72,0x01,0x67,0x00,0x73,0x01,0x59,0x00,0x5e,0x00,0xb2,0xff,0x4d,};
+const unsigned D_DIN_Italic_otf_size = sizeof(D_DIN_Italic_otf);
+
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+namespace resources 
+{
+const unsigned char D_DIN_otf[] = {0x4f,0x54,0x54,0x4f,0x00,0x0d,0x00,0x80,0x00,0x03,0x00,0x50,0x43,0x46,0x46,0x20,0xb9,0x31,0x12,0x1f,0x00,0x00,0x3a,0xd4,0x00,0x00,0x9d,0xf2,0x46,0x46,0x54,0x4d,0x75,0xb6,0xce,0xda,0x00,0x00,0xe5,0xcc,0x00,0x00,0x00,0x1c,0x47,0x44,0x45,0x46,0x05,0xf1,0x04,0xee,0x00,0x00,0xd8,0xc8,0x00,0x00,0x00,0x4c,0x47,0x50,0x4f,0x53,0x0f,0x8e,0x5e,0x2b,0x00,0x00,0xda,0x70,0x00,0x00,0x0b,0x5c,0x47,0x53,0x55,0x42,0xd5,0x28,0xdc,0xc1,0x00,0x00,0xd9,0x14,0x00,0x00,0x01,0x5c,0x4f,0x53,0x2f,0x32,0x66,0x29,0x3b,0xc4,0x00,0x00,0x01,0x40,0x00,0x00,0x00,0x60,0x63,0x6d,0x61,0x70,0x72,0x92,0x45,0xd4,0x00,0x00,0x38,0xb0,0x00,0x00,0x02,0x02,0x68,0x65,0x61,0x64,0x0f,0x35,0xc8,0x87,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0x36,0x68,0x68,0x65,0x61,0x07,0x6c,0x04,0x51,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0x24,0x68,0x6d,0x74,0x78,0xc5,0x2d,0x30,0x9e,0x00,0x00,0xe5,0xe8,0x00,0x00,0x03,0xec,0x6d,0x61,0x78,0x70,0x00,0xfb,0x50,0x00,0x00,0x00,0x01,0x38,0x00,0x00,0x00,0x06,0x6e,0x61,0x6d,0x65,0x54,0xa7,0x8d,0x5f,0x00,0x00,0x01,0xa0,0x00,0x00,0x37,0x0e,0x70,0x6f,0x73,0x74,0xff,0x86,0x00,0x32,0x00,0x00,0x3a,0xb4,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x84,0x1c,0xc1,0x19,0x5f,0x0f,0x3c,0xf5,0x00,0x0b,0x03,0xe8,0x00,0x00,0x00,0x00,0xd6,0x21,0x42,0x68,0x00,0x00,0x00,0x00,0xd6,0x21,0x42,0x68,0xff,0x79,0xff,0x58,0x04,0x5b,0x03,0x7a,0x00,0x00,0x00,0x08,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x3f,0xff,0x57,0x00,0x56,0x04,0x85,0xff,0x79,0xff,0x79,0x04,0x5b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0x00,0x00,0x50,0x00,0x00,0xfb,0x00,0x00,0x00,0x03,0x01,0xe6,0x01,0x90,0x00,0x05,0x00,0x04,0x02,0x8a,0x02,0x58,0x00,0x00,0x00,0x4b,0x02,0x8a,0x02,0x58,0x00,0x00,0x01,0x5e,0x00,0x32,0x01,0x30,0x00,0x00,0x02,0x0b,0x05,0x04,0x03,0x02,0x02,0x03,0x02,0x04,0x80,0x00,0x00,0x6f,0x40,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x4f,0x4e,0x4f,0x00,0x40,0x00,0x0d,0xfb,0x02,0x03,0x3f,0xff,0x57,0x00,0x56,0x03,0x86,0x00,0xb8,0x20,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x01,0xfb,0x02,0xb2,0x00,0x20,0x00,0x20,0x00,0x03,0x00,0x00,0x00,0x1a,0x01,0x3e,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x5a,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x00,0x93,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x00,0xa9,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0f,0x00,0xd1,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x00,0xed,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x01,0x0d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x05,0x01,0x26,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x23,0x01,0x74,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0a,0x01,0xae,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x0b,0x01,0xd1,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x15,0x02,0x09,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x11,0x1f,0x24,0x5f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x1a,0x35,0xb5,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x01,0x00,0x0a,0x00,0x87,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x02,0x00,0x0e,0x00,0x99,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x03,0x00,0x1e,0x00,0xb1,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x04,0x00,0x0a,0x00,0xe1,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x05,0x00,0x18,0x00,0xf3,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x06,0x00,0x0a,0x01,0x1a,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x07,0x00,0x46,0x01,0x2c,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x08,0x00,0x14,0x01,0x98,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x09,0x00,0x16,0x01,0xb9,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0b,0x00,0x2a,0x01,0xdd,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0d,0x22,0x3e,0x02,0x1f,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0e,0x00,0x34,0x35,0x7f,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0xa9,0x00,0x20,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x20,0x00,0x41,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x2e,0x00,0x00,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0xa9,0x20,0x44,0x61,0x74,0x74,0x6f,0x2c,0x20,0x49,0x6e,0x63,0x2e,0x20,0x41,0x6c,0x6c,0x20,0x72,0x69,0x67,0x68,0x74,0x73,0x20,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x2e,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x00,0x00,0x52,0x00,0x65,0x00,0x67,0x00,0x75,0x00,0x6c,0x00,0x61,0x00,0x72,0x00,0x00,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x42,0x00,0x75,0x00,0x69,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x31,0x00,0x30,0x00,0x30,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x20,0x42,0x75,0x69,0x6c,0x64,0x20,0x31,0x30,0x30,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x00,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x31,0x00,0x2e,0x00,0x30,0x00,0x30,0x00,0x00,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x30,0x30,0x00,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x00,0x44,0x2d,0x44,0x49,0x4e,0x00,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x74,0x00,0x72,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x6b,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x00,0x44,0x61,0x74,0x74,0x6f,0x20,0x69,0x73,0x20,0x61,0x20,0x74,0x72,0x61,0x64,0x65,0x6d,0x61,0x72,0x6b,0x20,0x6f,0x66,0x20,0x44,0x61,0x74,0x74,0x6f,0x2c,0x20,0x49,0x6e,0x63,0x2e,0x00,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x00,0x44,0x61,0x74,0x74,0x6f,0x20,0x49,0x6e,0x63,0x2e,0x00,0x00,0x43,0x00,0x68,0x00,0x61,0x00,0x72,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x4e,0x00,0x69,0x00,0x78,0x00,0x00,0x43,0x68,0x61,0x72,0x6c,0x65,0x73,0x20,0x4e,0x69,0x78,0x00,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x73,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x2e,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2e,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x00,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x64,0x61,0x74,0x74,0x6f,0x2e,0x63,0x6f,0x6d,0x00,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x28,0x00,0x63,0x00,0x29,0x00,0x20,0x00,0x32,0x00,0x30,0x00,0x31,0x00,0x37,0x00,0x2c,0x00,0x20,0x00,0x44,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x49,0x00,0x6e,0x00,0x63,0x00,0x2e,0x00,0x20,0x00,0x28,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x40,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x74,0x00,0x6f,0x00,0x2e,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x29,0x00,0x2c,0x00,0x0a,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x52,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x20,0x00,0x44,0x00,0x2d,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x53,0x00,0x49,0x00,0x4c,0x00,0x20,0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x31,0x00,0x2e,0x00,0x31,0x00,0x2e,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x6c,0x00,0x6f,0x00,0x77,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x6c,0x00,0x73,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x76,0x00,0x61,0x00,0x69,0x00,0x6c,0x00,0x61,0x00,0x62,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x46,0x00,0x41,0x00,0x51,0x00,0x20,0x00,0x61,0x00,0x74,0x00,0x3a,0x00,0x0a,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x73,0x00,0x63,0x00,0x72,0x00,0x69,0x00,0x70,0x00,0x74,0x00,0x73,0x00,0x2e,0x00,0x73,0x00,0x69,0x00,0x6c,0x00,0x2e,0x00,0x6f,0x00,0x72,0x00,0x67,0x00,0x2f,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x0a,0x00,0x53,0x00,0x49,0x00,0x4c,0x00,0x20,0x00,0x4f,0x00,0x50,0x00,0x45,0x00,0x4e,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x43,0x00,0x45,0x00,0x4e,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x31,0x00,0x2e,0x00,0x31,0x00,0x20,0x00,0x2d,0x00,0x20,0x00,0x32,0x00,0x36,0x00,0x20,0x00,0x46,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x75,0x00,0x61,0x00,0x72,0x00,0x79,0x00,0x20,0x00,0x32,0x00,0x30,0x00,0x30,0x00,0x37,0x00,0x0a,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x0a,0x00,0x0a,0x00,0x50,0x00,0x52,0x00,0x45,0x00,0x41,0x00,0x4d,0x00,0x42,0x00,0x4c,0x00,0x45,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x67,0x00,0x6f,0x00,0x61,0x00,0x6c,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x28,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x29,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x69,0x00,0x6d,0x00,0x75,0x00,0x6c,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6c,0x00,0x64,0x00,0x77,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x0a,0x00,0x64,0x00,0x65,0x00,0x76,0x00,0x65,0x00,0x6c,0x00,0x6f,0x00,0x70,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6c,0x00,0x6c,0x00,0x61,0x00,0x62,0x00,0x6f,0x00,0x72,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x6a,0x00,0x65,0x00,0x63,0x00,0x74,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x70,0x00,0x70,0x00,0x6f,0x00,0x72,0x00,0x74,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x63,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x0a,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x61,0x00,0x63,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x6d,0x00,0x69,0x00,0x63,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x75,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x69,0x00,0x63,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x6d,0x00,0x75,0x00,0x6e,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x0a,0x00,0x6f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6b,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x69,0x00,0x63,0x00,0x68,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x68,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x6d,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x61,0x00,0x72,0x00,0x74,0x00,0x6e,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x68,0x00,0x69,0x00,0x70,0x00,0x0a,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x20,0x00,0x61,0x00,0x6c,0x00,0x6c,0x00,0x6f,0x00,0x77,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x75,0x00,0x64,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x6f,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x6d,0x00,0x73,0x00,0x65,0x00,0x6c,0x00,0x76,0x00,0x65,0x00,0x73,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x63,0x00,0x6c,0x00,0x75,0x00,0x64,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6b,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x6c,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6d,0x00,0x62,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x2f,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x61,0x00,0x74,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x0a,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x77,0x00,0x6f,0x00,0x72,0x00,0x6b,0x00,0x73,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x0a,0x00,0x68,0x00,0x6f,0x00,0x77,0x00,0x65,0x00,0x76,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x6c,0x00,0x65,0x00,0x61,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x79,0x00,0x70,0x00,0x65,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x71,0x00,0x75,0x00,0x69,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x6c,0x00,0x79,0x00,0x0a,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x63,0x00,0x75,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x63,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x69,0x00,0x72,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x73,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x49,0x00,0x4e,0x00,0x49,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x53,0x00,0x0a,0x00,0x22,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x65,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x6c,0x00,0x65,0x00,0x61,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x0a,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x63,0x00,0x6c,0x00,0x65,0x00,0x61,0x00,0x72,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x6b,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x63,0x00,0x68,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x63,0x00,0x6c,0x00,0x75,0x00,0x64,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x75,0x00,0x72,0x00,0x63,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x62,0x00,0x75,0x00,0x69,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x73,0x00,0x63,0x00,0x72,0x00,0x69,0x00,0x70,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x63,0x00,0x75,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x52,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x4e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x70,0x00,0x65,0x00,0x63,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x63,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x66,0x00,0x74,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6c,0x00,0x6c,0x00,0x65,0x00,0x63,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x0a,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x69,0x00,0x76,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x64,0x00,0x64,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x2c,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x6c,0x00,0x65,0x00,0x74,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x2c,0x00,0x0a,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x62,0x00,0x73,0x00,0x74,0x00,0x69,0x00,0x74,0x00,0x75,0x00,0x74,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x2d,0x00,0x2d,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x61,0x00,0x72,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x6f,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x2d,0x00,0x2d,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2c,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x63,0x00,0x68,0x00,0x61,0x00,0x6e,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x6d,0x00,0x61,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x70,0x00,0x6f,0x00,0x72,0x00,0x74,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x0a,0x00,0x6e,0x00,0x65,0x00,0x77,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x76,0x00,0x69,0x00,0x72,0x00,0x6f,0x00,0x6e,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x22,0x00,0x41,0x00,0x75,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x72,0x00,0x22,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x73,0x00,0x69,0x00,0x67,0x00,0x6e,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x65,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x67,0x00,0x72,0x00,0x61,0x00,0x6d,0x00,0x6d,0x00,0x65,0x00,0x72,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x65,0x00,0x63,0x00,0x68,0x00,0x6e,0x00,0x69,0x00,0x63,0x00,0x61,0x00,0x6c,0x00,0x0a,0x00,0x77,0x00,0x72,0x00,0x69,0x00,0x74,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x6f,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x50,0x00,0x45,0x00,0x52,0x00,0x4d,0x00,0x49,0x00,0x53,0x00,0x53,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x20,0x00,0x26,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x4e,0x00,0x44,0x00,0x49,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x53,0x00,0x0a,0x00,0x50,0x00,0x65,0x00,0x72,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x65,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x67,0x00,0x72,0x00,0x61,0x00,0x6e,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x63,0x00,0x68,0x00,0x61,0x00,0x72,0x00,0x67,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x62,0x00,0x74,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x0a,0x00,0x61,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x75,0x00,0x64,0x00,0x79,0x00,0x2c,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x65,0x00,0x72,0x00,0x67,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6d,0x00,0x62,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x79,0x00,0x2c,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x73,0x00,0x65,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x69,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x0a,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x73,0x00,0x75,0x00,0x62,0x00,0x6a,0x00,0x65,0x00,0x63,0x00,0x74,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6c,0x00,0x6c,0x00,0x6f,0x00,0x77,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x3a,0x00,0x0a,0x00,0x0a,0x00,0x31,0x00,0x29,0x00,0x20,0x00,0x4e,0x00,0x65,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x69,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x75,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x2c,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x69,0x00,0x74,0x00,0x73,0x00,0x65,0x00,0x6c,0x00,0x66,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x32,0x00,0x29,0x00,0x20,0x00,0x4f,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x6c,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x6c,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x2f,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x73,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x76,0x00,0x69,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x61,0x00,0x74,0x00,0x20,0x00,0x65,0x00,0x61,0x00,0x63,0x00,0x68,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x0a,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x62,0x00,0x6f,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x63,0x00,0x6c,0x00,0x75,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x65,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x74,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x2d,0x00,0x61,0x00,0x6c,0x00,0x6f,0x00,0x6e,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x65,0x00,0x78,0x00,0x74,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x2c,0x00,0x20,0x00,0x68,0x00,0x75,0x00,0x6d,0x00,0x61,0x00,0x6e,0x00,0x2d,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x64,0x00,0x61,0x00,0x62,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x68,0x00,0x65,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x0a,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x70,0x00,0x72,0x00,0x69,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x63,0x00,0x68,0x00,0x69,0x00,0x6e,0x00,0x65,0x00,0x2d,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x64,0x00,0x61,0x00,0x62,0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x65,0x00,0x74,0x00,0x61,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x61,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x6c,0x00,0x64,0x00,0x73,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x74,0x00,0x65,0x00,0x78,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x0a,0x00,0x62,0x00,0x69,0x00,0x6e,0x00,0x61,0x00,0x72,0x00,0x79,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x6f,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x6c,0x00,0x64,0x00,0x73,0x00,0x20,0x00,0x63,0x00,0x61,0x00,0x6e,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x65,0x00,0x61,0x00,0x73,0x00,0x69,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x76,0x00,0x69,0x00,0x65,0x00,0x77,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x33,0x00,0x29,0x00,0x20,0x00,0x4e,0x00,0x6f,0x00,0x20,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x52,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x76,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x0a,0x00,0x4e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x6c,0x00,0x65,0x00,0x73,0x00,0x73,0x00,0x20,0x00,0x65,0x00,0x78,0x00,0x70,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x69,0x00,0x74,0x00,0x20,0x00,0x77,0x00,0x72,0x00,0x69,0x00,0x74,0x00,0x74,0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x67,0x00,0x72,0x00,0x61,0x00,0x6e,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x62,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x72,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x70,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x0a,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x63,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x6f,0x00,0x6e,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x6c,0x00,0x69,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x69,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x79,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x73,0x00,0x0a,0x00,0x70,0x00,0x72,0x00,0x65,0x00,0x73,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x34,0x00,0x29,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x6e,0x00,0x61,0x00,0x6d,0x00,0x65,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x41,0x00,0x75,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x0a,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x20,0x00,0x73,0x00,0x68,0x00,0x61,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x70,0x00,0x72,0x00,0x6f,0x00,0x6d,0x00,0x6f,0x00,0x74,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x64,0x00,0x6f,0x00,0x72,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x64,0x00,0x76,0x00,0x65,0x00,0x72,0x00,0x74,0x00,0x69,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x0a,0x00,0x4d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2c,0x00,0x20,0x00,0x65,0x00,0x78,0x00,0x63,0x00,0x65,0x00,0x70,0x00,0x74,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x63,0x00,0x6b,0x00,0x6e,0x00,0x6f,0x00,0x77,0x00,0x6c,0x00,0x65,0x00,0x64,0x00,0x67,0x00,0x65,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x0a,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0x48,0x00,0x6f,0x00,0x6c,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x41,0x00,0x75,0x00,0x74,0x00,0x68,0x00,0x6f,0x00,0x72,0x00,0x28,0x00,0x73,0x00,0x29,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x77,0x00,0x69,0x00,0x74,0x00,0x68,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x69,0x00,0x72,0x00,0x20,0x00,0x65,0x00,0x78,0x00,0x70,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x69,0x00,0x74,0x00,0x20,0x00,0x77,0x00,0x72,0x00,0x69,0x00,0x74,0x00,0x74,0x00,0x65,0x00,0x6e,0x00,0x0a,0x00,0x70,0x00,0x65,0x00,0x72,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x35,0x00,0x29,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x6d,0x00,0x6f,0x00,0x64,0x00,0x69,0x00,0x66,0x00,0x69,0x00,0x65,0x00,0x64,0x00,0x2c,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x70,0x00,0x61,0x00,0x72,0x00,0x74,0x00,0x20,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x77,0x00,0x68,0x00,0x6f,0x00,0x6c,0x00,0x65,0x00,0x2c,0x00,0x0a,0x00,0x6d,0x00,0x75,0x00,0x73,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x69,0x00,0x72,0x00,0x65,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x6d,0x00,0x75,0x00,0x73,0x00,0x74,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x0a,0x00,0x64,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x72,0x00,0x69,0x00,0x62,0x00,0x75,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x2e,0x00,0x20,0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x71,0x00,0x75,0x00,0x69,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x72,0x00,0x20,0x00,0x66,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x73,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x0a,0x00,0x72,0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x61,0x00,0x70,0x00,0x70,0x00,0x6c,0x00,0x79,0x00,0x20,0x00,0x74,0x00,0x6f,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x64,0x00,0x6f,0x00,0x63,0x00,0x75,0x00,0x6d,0x00,0x65,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x63,0x00,0x72,0x00,0x65,0x00,0x61,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x0a,0x00,0x75,0x00,0x73,0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x46,0x00,0x6f,0x00,0x6e,0x00,0x74,0x00,0x20,0x00,0x53,0x00,0x6f,0x00,0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x54,0x00,0x45,0x00,0x52,0x00,0x4d,0x00,0x49,0x00,0x4e,0x00,0x41,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x0a,0x00,0x54,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x65,0x00,0x73,0x00,0x20,0x00,0x6e,0x00,0x75,0x00,0x6c,0x00,0x6c,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,0x00,0x76,0x00,0x6f,0x00,0x69,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x66,0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x79,0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x62,0x00,0x6f,0x00,0x76,0x00,0x65,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x72,0x00,0x65,0x00,0x0a,0x00,0x6e,0x00,0x6f,0x00,0x74,0x00,0x20,0x00,0x6d,0x00,0x65,0x00,0x74,0x00,0x2e,0x00,0x0a,0x00,0x0a,0x00,0x44,0x00,0x49,0x00,0x53,0x00,0x43,0x00,0x4c,0x00,0x41,0x00,0x49,0x00,0x4d,0x00,0x45,0x00,0x52,0x00,0x0a,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x4f,0x00,0x46,0x00,0x54,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x45,0x00,0x20,0x00,0x49,0x00,0x53,0x00,0x20,0x00,0x50,0x00,0x52,0x00,0x4f,0x00,0x56,0x00,0x49,0x00,0x44,0x00,0x45,0x00,0x44,0x00,0x20,0x00,0x22,0x00,0x41,0x00,0x53,0x00,0x20,0x00,0x49,0x00,0x53,0x00,0x22,0x00,0x2c,0x00,0x20,0x00,0x57,0x00,0x49,0x00,0x54,0x00,0x48,0x00,0x4f,0x00,0x55,0x00,0x54,0x00,0x20,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x52,0x00,0x41,0x00,0x4e,0x00,0x54,0x00,0x59,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x4b,0x00,0x49,0x00,0x4e,0x00,0x44,0x00,0x2c,0x00,0x0a,0x00,0x45,0x00,0x58,0x00,0x50,0x00,0x52,0x00,0x45,0x00,0x53,0x00,0x53,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x49,0x00,0x4d,0x00,0x50,0x00,0x4c,0x00,0x49,0x00,0x45,0x00,0x44,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x43,0x00,0x4c,0x00,0x55,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x20,0x00,0x42,0x00,0x55,0x00,0x54,0x00,0x20,0x00,0x4e,0x00,0x4f,0x00,0x54,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x4d,0x00,0x49,0x00,0x54,0x00,0x45,0x00,0x44,0x00,0x20,0x00,0x54,0x00,0x4f,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x52,0x00,0x41,0x00,0x4e,0x00,0x54,0x00,0x49,0x00,0x45,0x00,0x53,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x0a,0x00,0x4d,0x00,0x45,0x00,0x52,0x00,0x43,0x00,0x48,0x00,0x41,0x00,0x4e,0x00,0x54,0x00,0x41,0x00,0x42,0x00,0x49,0x00,0x4c,0x00,0x49,0x00,0x54,0x00,0x59,0x00,0x2c,0x00,0x20,0x00,0x46,0x00,0x49,0x00,0x54,0x00,0x4e,0x00,0x45,0x00,0x53,0x00,0x53,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x41,0x00,0x20,0x00,0x50,0x00,0x41,0x00,0x52,0x00,0x54,0x00,0x49,0x00,0x43,0x00,0x55,0x00,0x4c,0x00,0x41,0x00,0x52,0x00,0x20,0x00,0x50,0x00,0x55,0x00,0x52,0x00,0x50,0x00,0x4f,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x44,0x00,0x20,0x00,0x4e,0x00,0x4f,0x00,0x4e,0x00,0x49,0x00,0x4e,0x00,0x46,0x00,0x52,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x45,0x00,0x4d,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x0a,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x50,0x00,0x59,0x00,0x52,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x50,0x00,0x41,0x00,0x54,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x54,0x00,0x52,0x00,0x41,0x00,0x44,0x00,0x45,0x00,0x4d,0x00,0x41,0x00,0x52,0x00,0x4b,0x00,0x2c,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x52,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x54,0x00,0x2e,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x4e,0x00,0x4f,0x00,0x20,0x00,0x45,0x00,0x56,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x48,0x00,0x41,0x00,0x4c,0x00,0x4c,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x0a,0x00,0x43,0x00,0x4f,0x00,0x50,0x00,0x59,0x00,0x52,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x54,0x00,0x20,0x00,0x48,0x00,0x4f,0x00,0x4c,0x00,0x44,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x42,0x00,0x45,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x41,0x00,0x42,0x00,0x4c,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x43,0x00,0x4c,0x00,0x41,0x00,0x49,0x00,0x4d,0x00,0x2c,0x00,0x20,0x00,0x44,0x00,0x41,0x00,0x4d,0x00,0x41,0x00,0x47,0x00,0x45,0x00,0x53,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x4c,0x00,0x49,0x00,0x41,0x00,0x42,0x00,0x49,0x00,0x4c,0x00,0x49,0x00,0x54,0x00,0x59,0x00,0x2c,0x00,0x0a,0x00,0x49,0x00,0x4e,0x00,0x43,0x00,0x4c,0x00,0x55,0x00,0x44,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x59,0x00,0x20,0x00,0x47,0x00,0x45,0x00,0x4e,0x00,0x45,0x00,0x52,0x00,0x41,0x00,0x4c,0x00,0x2c,0x00,0x20,0x00,0x53,0x00,0x50,0x00,0x45,0x00,0x43,0x00,0x49,0x00,0x41,0x00,0x4c,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x44,0x00,0x49,0x00,0x52,0x00,0x45,0x00,0x43,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x43,0x00,0x49,0x00,0x44,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x41,0x00,0x4c,0x00,0x2c,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x4e,0x00,0x53,0x00,0x45,0x00,0x51,0x00,0x55,0x00,0x45,0x00,0x4e,0x00,0x54,0x00,0x49,0x00,0x41,0x00,0x4c,0x00,0x0a,0x00,0x44,0x00,0x41,0x00,0x4d,0x00,0x41,0x00,0x47,0x00,0x45,0x00,0x53,0x00,0x2c,0x00,0x20,0x00,0x57,0x00,0x48,0x00,0x45,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x41,0x00,0x4e,0x00,0x20,0x00,0x41,0x00,0x43,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x43,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x52,0x00,0x41,0x00,0x43,0x00,0x54,0x00,0x2c,0x00,0x20,0x00,0x54,0x00,0x4f,0x00,0x52,0x00,0x54,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x57,0x00,0x49,0x00,0x53,0x00,0x45,0x00,0x2c,0x00,0x20,0x00,0x41,0x00,0x52,0x00,0x49,0x00,0x53,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x0a,0x00,0x46,0x00,0x52,0x00,0x4f,0x00,0x4d,0x00,0x2c,0x00,0x20,0x00,0x4f,0x00,0x55,0x00,0x54,0x00,0x20,0x00,0x4f,0x00,0x46,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x55,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x41,0x00,0x42,0x00,0x49,0x00,0x4c,0x00,0x49,0x00,0x54,0x00,0x59,0x00,0x20,0x00,0x54,0x00,0x4f,0x00,0x20,0x00,0x55,0x00,0x53,0x00,0x45,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x4f,0x00,0x46,0x00,0x54,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x45,0x00,0x20,0x00,0x4f,0x00,0x52,0x00,0x20,0x00,0x46,0x00,0x52,0x00,0x4f,0x00,0x4d,0x00,0x0a,0x00,0x4f,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x52,0x00,0x20,0x00,0x44,0x00,0x45,0x00,0x41,0x00,0x4c,0x00,0x49,0x00,0x4e,0x00,0x47,0x00,0x53,0x00,0x20,0x00,0x49,0x00,0x4e,0x00,0x20,0x00,0x54,0x00,0x48,0x00,0x45,0x00,0x20,0x00,0x46,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x20,0x00,0x53,0x00,0x4f,0x00,0x46,0x00,0x54,0x00,0x57,0x00,0x41,0x00,0x52,0x00,0x45,0x00,0x2e,0x00,0x00,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x31,0x37,0x2c,0x20,0x44,0x61,0x74,0x74,0x6f,0x20,0x49,0x6e,0x63,0x2e,0x20,0x28,0x66,0x6f,0x6e,0x74,0x73,0x40,0x64,0x61,0x74,0x74,0x6f,0x2e,0x63,0x6f,0x6d,0x29,0x2c,0x0a,0x77,0x69,0x74,0x68,0x20,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4e,0x61,0x6d,0x65,0x20,0x44,0x2d,0x44,0x49,0x4e,0x2e,0x0a,0x0a,0x54,0x68,0x69,0x73,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x49,0x4c,0x20,0x4f,0x70,0x65,0x6e,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x31,0x2e,0x0a,0x54,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x69,0x73,0x20,0x63,0x6f,0x70,0x69,0x65,0x64,0x20,0x62,0x65,0x6c,0x6f,0x77,0x2c,0x20,0x61,0x6e,0x64,0x20,0x69,0x73,0x20,0x61,0x6c,0x73,0x6f,0x20,0x61,0x76,0x61,0x69,0x6c,0x61,0x62,0x6c,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x46,0x41,0x51,0x20,0x61,0x74,0x3a,0x0a,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x73,0x2e,0x73,0x69,0x6c,0x2e,0x6f,0x72,0x67,0x2f,0x4f,0x46,0x4c,0x0a,0x0a,0x0a,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x0a,0x53,0x49,0x4c,0x20,0x4f,0x50,0x45,0x4e,0x20,0x46,0x4f,0x4e,0x54,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x31,0x20,0x2d,0x20,0x32,0x36,0x20,0x46,0x65,0x62,0x72,0x75,0x61,0x72,0x79,0x20,0x32,0x30,0x30,0x37,0x0a,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x0a,0x0a,0x50,0x52,0x45,0x41,0x4d,0x42,0x4c,0x45,0x0a,0x54,0x68,0x65,0x20,0x67,0x6f,0x61,0x6c,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x4f,0x70,0x65,0x6e,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x28,0x4f,0x46,0x4c,0x29,0x20,0x61,0x72,0x65,0x20,0x74,0x6f,0x20,0x73,0x74,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x20,0x77,0x6f,0x72,0x6c,0x64,0x77,0x69,0x64,0x65,0x0a,0x64,0x65,0x76,0x65,0x6c,0x6f,0x70,0x6d,0x65,0x6e,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6c,0x6c,0x61,0x62,0x6f,0x72,0x61,0x74,0x69,0x76,0x65,0x20,0x66,0x6f,0x6e,0x74,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2c,0x20,0x74,0x6f,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x65,0x66,0x66,0x6f,0x72,0x74,0x73,0x20,0x6f,0x66,0x20,0x61,0x63,0x61,0x64,0x65,0x6d,0x69,0x63,0x20,0x61,0x6e,0x64,0x20,0x6c,0x69,0x6e,0x67,0x75,0x69,0x73,0x74,0x69,0x63,0x20,0x63,0x6f,0x6d,0x6d,0x75,0x6e,0x69,0x74,0x69,0x65,0x73,0x2c,0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x20,0x61,0x20,0x66,0x72,0x65,0x65,0x20,0x61,0x6e,0x64,0x0a,0x6f,0x70,0x65,0x6e,0x20,0x66,0x72,0x61,0x6d,0x65,0x77,0x6f,0x72,0x6b,0x20,0x69,0x6e,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x73,0x68,0x61,0x72,0x65,0x64,0x20,0x61,0x6e,0x64,0x20,0x69,0x6d,0x70,0x72,0x6f,0x76,0x65,0x64,0x20,0x69,0x6e,0x20,0x70,0x61,0x72,0x74,0x6e,0x65,0x72,0x73,0x68,0x69,0x70,0x0a,0x77,0x69,0x74,0x68,0x20,0x6f,0x74,0x68,0x65,0x72,0x73,0x2e,0x0a,0x0a,0x54,0x68,0x65,0x20,0x4f,0x46,0x4c,0x20,0x61,0x6c,0x6c,0x6f,0x77,0x73,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x64,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x74,0x6f,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x2c,0x20,0x73,0x74,0x75,0x64,0x69,0x65,0x64,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x61,0x6e,0x64,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x66,0x72,0x65,0x65,0x6c,0x79,0x20,0x61,0x73,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x79,0x20,0x61,0x72,0x65,0x20,0x6e,0x6f,0x74,0x20,0x73,0x6f,0x6c,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x6d,0x73,0x65,0x6c,0x76,0x65,0x73,0x2e,0x20,0x54,0x68,0x65,0x0a,0x66,0x6f,0x6e,0x74,0x73,0x2c,0x20,0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x61,0x6e,0x79,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x20,0x77,0x6f,0x72,0x6b,0x73,0x2c,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x62,0x75,0x6e,0x64,0x6c,0x65,0x64,0x2c,0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x2c,0x20,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x6f,0x6c,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x6e,0x79,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x61,0x6e,0x79,0x20,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x0a,0x6e,0x61,0x6d,0x65,0x73,0x20,0x61,0x72,0x65,0x20,0x6e,0x6f,0x74,0x20,0x75,0x73,0x65,0x64,0x20,0x62,0x79,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x20,0x77,0x6f,0x72,0x6b,0x73,0x2e,0x20,0x54,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x61,0x6e,0x64,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x73,0x2c,0x0a,0x68,0x6f,0x77,0x65,0x76,0x65,0x72,0x2c,0x20,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x62,0x65,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x61,0x6e,0x79,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2e,0x20,0x54,0x68,0x65,0x0a,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x6d,0x65,0x6e,0x74,0x20,0x66,0x6f,0x72,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x74,0x6f,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x70,0x70,0x6c,0x79,0x0a,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x64,0x20,0x75,0x73,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x6f,0x72,0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x73,0x2e,0x0a,0x0a,0x44,0x45,0x46,0x49,0x4e,0x49,0x54,0x49,0x4f,0x4e,0x53,0x0a,0x22,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x74,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x73,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x0a,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x61,0x6e,0x64,0x20,0x63,0x6c,0x65,0x61,0x72,0x6c,0x79,0x20,0x6d,0x61,0x72,0x6b,0x65,0x64,0x20,0x61,0x73,0x20,0x73,0x75,0x63,0x68,0x2e,0x20,0x54,0x68,0x69,0x73,0x20,0x6d,0x61,0x79,0x0a,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x69,0x6c,0x65,0x73,0x2c,0x20,0x62,0x75,0x69,0x6c,0x64,0x20,0x73,0x63,0x72,0x69,0x70,0x74,0x73,0x20,0x61,0x6e,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x0a,0x22,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4e,0x61,0x6d,0x65,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x61,0x73,0x20,0x73,0x75,0x63,0x68,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x74,0x68,0x65,0x0a,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x73,0x29,0x2e,0x0a,0x0a,0x22,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x20,0x61,0x73,0x0a,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x2e,0x0a,0x0a,0x22,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x20,0x6d,0x61,0x64,0x65,0x20,0x62,0x79,0x20,0x61,0x64,0x64,0x69,0x6e,0x67,0x20,0x74,0x6f,0x2c,0x20,0x64,0x65,0x6c,0x65,0x74,0x69,0x6e,0x67,0x2c,0x0a,0x6f,0x72,0x20,0x73,0x75,0x62,0x73,0x74,0x69,0x74,0x75,0x74,0x69,0x6e,0x67,0x20,0x2d,0x2d,0x20,0x69,0x6e,0x20,0x70,0x61,0x72,0x74,0x20,0x6f,0x72,0x20,0x69,0x6e,0x20,0x77,0x68,0x6f,0x6c,0x65,0x20,0x2d,0x2d,0x20,0x61,0x6e,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x0a,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2c,0x20,0x62,0x79,0x20,0x63,0x68,0x61,0x6e,0x67,0x69,0x6e,0x67,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x73,0x20,0x6f,0x72,0x20,0x62,0x79,0x20,0x70,0x6f,0x72,0x74,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x74,0x6f,0x20,0x61,0x0a,0x6e,0x65,0x77,0x20,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x2e,0x0a,0x0a,0x22,0x41,0x75,0x74,0x68,0x6f,0x72,0x22,0x20,0x72,0x65,0x66,0x65,0x72,0x73,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x65,0x73,0x69,0x67,0x6e,0x65,0x72,0x2c,0x20,0x65,0x6e,0x67,0x69,0x6e,0x65,0x65,0x72,0x2c,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x6d,0x65,0x72,0x2c,0x20,0x74,0x65,0x63,0x68,0x6e,0x69,0x63,0x61,0x6c,0x0a,0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x20,0x77,0x68,0x6f,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x0a,0x50,0x45,0x52,0x4d,0x49,0x53,0x53,0x49,0x4f,0x4e,0x20,0x26,0x20,0x43,0x4f,0x4e,0x44,0x49,0x54,0x49,0x4f,0x4e,0x53,0x0a,0x50,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,0x6e,0x67,0x0a,0x61,0x20,0x63,0x6f,0x70,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x73,0x74,0x75,0x64,0x79,0x2c,0x20,0x63,0x6f,0x70,0x79,0x2c,0x20,0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x65,0x6d,0x62,0x65,0x64,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x2c,0x20,0x61,0x6e,0x64,0x20,0x73,0x65,0x6c,0x6c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x61,0x6e,0x64,0x20,0x75,0x6e,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x0a,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x3a,0x0a,0x0a,0x31,0x29,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x6e,0x6f,0x72,0x20,0x61,0x6e,0x79,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x20,0x69,0x6e,0x64,0x69,0x76,0x69,0x64,0x75,0x61,0x6c,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x2c,0x0a,0x69,0x6e,0x20,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x6f,0x72,0x20,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x73,0x6f,0x6c,0x64,0x20,0x62,0x79,0x20,0x69,0x74,0x73,0x65,0x6c,0x66,0x2e,0x0a,0x0a,0x32,0x29,0x20,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x6f,0x72,0x20,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x62,0x75,0x6e,0x64,0x6c,0x65,0x64,0x2c,0x0a,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x6f,0x6c,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x6e,0x79,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x65,0x61,0x63,0x68,0x20,0x63,0x6f,0x70,0x79,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2e,0x20,0x54,0x68,0x65,0x73,0x65,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x0a,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x20,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x61,0x73,0x20,0x73,0x74,0x61,0x6e,0x64,0x2d,0x61,0x6c,0x6f,0x6e,0x65,0x20,0x74,0x65,0x78,0x74,0x20,0x66,0x69,0x6c,0x65,0x73,0x2c,0x20,0x68,0x75,0x6d,0x61,0x6e,0x2d,0x72,0x65,0x61,0x64,0x61,0x62,0x6c,0x65,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x20,0x6f,0x72,0x0a,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x70,0x70,0x72,0x6f,0x70,0x72,0x69,0x61,0x74,0x65,0x20,0x6d,0x61,0x63,0x68,0x69,0x6e,0x65,0x2d,0x72,0x65,0x61,0x64,0x61,0x62,0x6c,0x65,0x20,0x6d,0x65,0x74,0x61,0x64,0x61,0x74,0x61,0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x20,0x77,0x69,0x74,0x68,0x69,0x6e,0x20,0x74,0x65,0x78,0x74,0x20,0x6f,0x72,0x0a,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x69,0x6c,0x65,0x73,0x20,0x61,0x73,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x73,0x20,0x74,0x68,0x6f,0x73,0x65,0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x65,0x61,0x73,0x69,0x6c,0x79,0x20,0x76,0x69,0x65,0x77,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x75,0x73,0x65,0x72,0x2e,0x0a,0x0a,0x33,0x29,0x20,0x4e,0x6f,0x20,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x6d,0x61,0x79,0x20,0x75,0x73,0x65,0x20,0x74,0x68,0x65,0x20,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x20,0x46,0x6f,0x6e,0x74,0x0a,0x4e,0x61,0x6d,0x65,0x28,0x73,0x29,0x20,0x75,0x6e,0x6c,0x65,0x73,0x73,0x20,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x72,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x69,0x6e,0x67,0x0a,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x2e,0x20,0x54,0x68,0x69,0x73,0x20,0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x61,0x70,0x70,0x6c,0x69,0x65,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6e,0x61,0x6d,0x65,0x20,0x61,0x73,0x0a,0x70,0x72,0x65,0x73,0x65,0x6e,0x74,0x65,0x64,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x75,0x73,0x65,0x72,0x73,0x2e,0x0a,0x0a,0x34,0x29,0x20,0x54,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x28,0x73,0x29,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x20,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x41,0x75,0x74,0x68,0x6f,0x72,0x28,0x73,0x29,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x0a,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x73,0x68,0x61,0x6c,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x2c,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x61,0x64,0x76,0x65,0x72,0x74,0x69,0x73,0x65,0x20,0x61,0x6e,0x79,0x0a,0x4d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2c,0x20,0x65,0x78,0x63,0x65,0x70,0x74,0x20,0x74,0x6f,0x20,0x61,0x63,0x6b,0x6e,0x6f,0x77,0x6c,0x65,0x64,0x67,0x65,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x28,0x73,0x29,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x0a,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x48,0x6f,0x6c,0x64,0x65,0x72,0x28,0x73,0x29,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x41,0x75,0x74,0x68,0x6f,0x72,0x28,0x73,0x29,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x0a,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x0a,0x35,0x29,0x20,0x54,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x20,0x6f,0x72,0x20,0x75,0x6e,0x6d,0x6f,0x64,0x69,0x66,0x69,0x65,0x64,0x2c,0x20,0x69,0x6e,0x20,0x70,0x61,0x72,0x74,0x20,0x6f,0x72,0x20,0x69,0x6e,0x20,0x77,0x68,0x6f,0x6c,0x65,0x2c,0x0a,0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x65,0x6e,0x74,0x69,0x72,0x65,0x6c,0x79,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,0x20,0x61,0x6e,0x64,0x20,0x6d,0x75,0x73,0x74,0x20,0x6e,0x6f,0x74,0x20,0x62,0x65,0x0a,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x61,0x6e,0x79,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2e,0x20,0x54,0x68,0x65,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x6d,0x65,0x6e,0x74,0x20,0x66,0x6f,0x72,0x20,0x66,0x6f,0x6e,0x74,0x73,0x20,0x74,0x6f,0x0a,0x72,0x65,0x6d,0x61,0x69,0x6e,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x70,0x70,0x6c,0x79,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x64,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x6f,0x6e,0x74,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x0a,0x54,0x45,0x52,0x4d,0x49,0x4e,0x41,0x54,0x49,0x4f,0x4e,0x0a,0x54,0x68,0x69,0x73,0x20,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x20,0x62,0x65,0x63,0x6f,0x6d,0x65,0x73,0x20,0x6e,0x75,0x6c,0x6c,0x20,0x61,0x6e,0x64,0x20,0x76,0x6f,0x69,0x64,0x20,0x69,0x66,0x20,0x61,0x6e,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x0a,0x6e,0x6f,0x74,0x20,0x6d,0x65,0x74,0x2e,0x0a,0x0a,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x52,0x0a,0x54,0x48,0x45,0x20,0x46,0x4f,0x4e,0x54,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,0x2c,0x0a,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x0a,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,0x54,0x0a,0x4f,0x46,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x2c,0x20,0x50,0x41,0x54,0x45,0x4e,0x54,0x2c,0x20,0x54,0x52,0x41,0x44,0x45,0x4d,0x41,0x52,0x4b,0x2c,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x52,0x49,0x47,0x48,0x54,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x41,0x4e,0x59,0x20,0x47,0x45,0x4e,0x45,0x52,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x0a,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x0a,0x46,0x52,0x4f,0x4d,0x2c,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x52,0x20,0x49,0x4e,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x54,0x4f,0x20,0x55,0x53,0x45,0x20,0x54,0x48,0x45,0x20,0x46,0x4f,0x4e,0x54,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x4f,0x52,0x20,0x46,0x52,0x4f,0x4d,0x0a,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x20,0x46,0x4f,0x4e,0x54,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x00,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x73,0x00,0x63,0x00,0x72,0x00,0x69,0x00,0x70,0x00,0x74,0x00,0x73,0x00,0x2e,0x00,0x73,0x00,0x69,0x00,0x6c,0x00,0x2e,0x00,0x6f,0x00,0x72,0x00,0x67,0x00,0x2f,0x00,0x4f,0x00,0x46,0x00,0x4c,0x00,0x00,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x73,0x2e,0x73,0x69,0x6c,0x2e,0x6f,0x72,0x67,0x2f,0x4f,0x46,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x04,0x00,0xe0,0x00,0x00,0x00,0x34,0x00,0x20,0x00,0x04,0x00,0x14,0x00,0x0d,0x00,0x7e,0x00,0xff,0x01,0x31,0x01,0x53,0x01,0x61,0x01,0x78,0x01,0x7e,0x01,0x92,0x02,0xc7,0x02,0xda,0x02,0xdc,0x03,0x03,0x03,0x08,0x03,0x0a,0x20,0x14,0x20,0x1a,0x20,0x1e,0x20,0x22,0x20,0x26,0x20,0x30,0x20,0x3a,0x20,0xac,0x21,0x22,0xfb,0x02,0xff,0xff,0x00,0x00,0x00,0x0d,0x00,0x20,0x00,0xa0,0x01,0x31,0x01,0x52,0x01,0x60,0x01,0x78,0x01,0x7d,0x01,0x92,0x02,0xc6,0x02,0xd9,0x02,0xdc,0x03,0x00,0x03,0x08,0x03,0x0a,0x20,0x13,0x20,0x18,0x20,0x1c,0x20,0x20,0x20,0x26,0x20,0x30,0x20,0x39,0x20,0xac,0x21,0x22,0xfb,0x01,0xff,0xff,0xff,0xf4,0xff,0xe2,0xff,0xc1,0xff,0x90,0xff,0x70,0xff,0x64,0xff,0x4e,0xff,0x4a,0xff,0x37,0xfe,0x04,0xfd,0xf3,0xfd,0xf2,0xfd,0xcf,0xfd,0xcb,0xfd,0xca,0xe0,0xc2,0xe0,0xbf,0xe0,0xbe,0xe0,0xbd,0xe0,0xba,0xe0,0xb1,0xe0,0xa9,0xe0,0x38,0xdf,0xc3,0x05,0xe5,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x00,0x85,0x86,0x88,0x8a,0x92,0x97,0x9d,0xa2,0xa1,0xa3,0xa5,0xa4,0xa6,0xa8,0xaa,0xa9,0xab,0xac,0xae,0xad,0xaf,0xb0,0xb2,0xb4,0xb3,0xb5,0xb7,0xb6,0xbb,0xba,0xbc,0xbd,0xdd,0x71,0x63,0x64,0x68,0xdf,0x77,0xa0,0x6f,0x6a,0xe5,0x75,0x69,0x00,0x87,0x99,0x00,0x72,0x00,0x00,0x66,0x76,0x00,0x00,0x00,0x00,0x00,0x6b,0x7b,0x00,0xa7,0xb9,0x80,0x62,0x6d,0x00,0xc9,0x00,0x00,0x6c,0x7c,0xe0,0x61,0x81,0x84,0x96,0xc2,0xc3,0xd5,0xd6,0xda,0xdb,0xd7,0xd8,0xb8,0x00,0xc0,0xc6,0x00,0xe4,0xe2,0xe3,0xe6,0xe7,0xde,0x78,0xd9,0xdc,0xe1,0x83,0x8b,0x82,0x8c,0x89,0x8e,0x8f,0x90,0x8d,0x94,0x95,0x00,0x93,0x9b,0x9c,0x9a,0xc1,0xca,0xce,0x70,0x00,0xcc,0xcd,0x79,0x00,0x00,0xcb,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x83,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x04,0x00,0x01,0x01,0x01,0x06,0x44,0x2d,0x44,0x49,0x4e,0x00,0x01,0x02,0x00,0x01,0x00,0x36,0xf8,0x3c,0x00,0xf8,0x3d,0x01,0xf8,0x3e,0x02,0xf8,0x3f,0x03,0xf8,0x15,0x04,0xfb,0x1b,0xfb,0x3c,0xfa,0xef,0xfa,0x0e,0x05,0x1d,0x00,0x00,0x01,0xdd,0x0f,0x1d,0x00,0x00,0x00,0x00,0x10,0x1d,0x00,0x00,0x03,0xd2,0x11,0x1d,0x00,0x00,0x00,0x1a,0x1d,0x00,0x00,0x85,0xf9,0x12,0x00,0x25,0x02,0x00,0x01,0x00,0x11,0x00,0x18,0x00,0x1f,0x00,0x26,0x00,0x2d,0x00,0x34,0x00,0x3b,0x00,0x44,0x00,0x4d,0x00,0x54,0x00,0x5d,0x00,0x64,0x00,0x6b,0x00,0x6f,0x00,0x74,0x00,0x78,0x00,0x7b,0x00,0x84,0x00,0x8c,0x00,0x94,0x00,0x9e,0x00,0xa7,0x00,0xb0,0x00,0xb8,0x00,0xc0,0x00,0xca,0x00,0xd3,0x00,0xdc,0x00,0xe4,0x00,0xec,0x00,0xf6,0x00,0xff,0x01,0x07,0x01,0x0b,0x01,0x39,0x01,0x3e,0x01,0x43,0x6e,0x6f,0x6e,0x6d,0x61,0x72,0x6b,0x69,0x6e,0x67,0x72,0x65,0x74,0x75,0x72,0x6e,0x75,0x6e,0x69,0x30,0x30,0x41,0x30,0x75,0x6e,0x69,0x30,0x30,0x41,0x44,0x75,0x6e,0x69,0x30,0x30,0x42,0x32,0x75,0x6e,0x69,0x30,0x30,0x42,0x33,0x75,0x6e,0x69,0x30,0x30,0x42,0x35,0x75,0x6e,0x69,0x30,0x30,0x42,0x39,0x67,0x72,0x61,0x76,0x65,0x63,0x6f,0x6d,0x62,0x61,0x63,0x75,0x74,0x65,0x63,0x6f,0x6d,0x62,0x75,0x6e,0x69,0x30,0x33,0x30,0x32,0x74,0x69,0x6c,0x64,0x65,0x63,0x6f,0x6d,0x62,0x75,0x6e,0x69,0x30,0x33,0x30,0x38,0x75,0x6e,0x69,0x30,0x33,0x30,0x41,0x45,0x75,0x72,0x6f,0x2e,0x6e,0x75,0x6c,0x6c,0x4e,0x55,0x4c,0x4c,0x74,0x5f,0x74,0x7a,0x65,0x72,0x6f,0x2e,0x64,0x6e,0x6f,0x6d,0x6f,0x6e,0x65,0x2e,0x64,0x6e,0x6f,0x6d,0x74,0x77,0x6f,0x2e,0x64,0x6e,0x6f,0x6d,0x74,0x68,0x72,0x65,0x65,0x2e,0x64,0x6e,0x6f,0x6d,0x66,0x6f,0x75,0x72,0x2e,0x64,0x6e,0x6f,0x6d,0x7a,0x65,0x72,0x6f,0x2e,0x6e,0x75,0x6d,0x72,0x6f,0x6e,0x65,0x2e,0x6e,0x75,0x6d,0x72,0x74,0x77,0x6f,0x2e,0x6e,0x75,0x6d,0x72,0x74,0x68,0x72,0x65,0x65,0x2e,0x6e,0x75,0x6d,0x72,0x66,0x6f,0x75,0x72,0x2e,0x6e,0x75,0x6d,0x72,0x7a,0x65,0x72,0x6f,0x2e,0x73,0x75,0x70,0x73,0x6f,0x6e,0x65,0x2e,0x73,0x75,0x70,0x73,0x74,0x77,0x6f,0x2e,0x73,0x75,0x70,0x73,0x74,0x68,0x72,0x65,0x65,0x2e,0x73,0x75,0x70,0x73,0x66,0x6f,0x75,0x72,0x2e,0x73,0x75,0x70,0x73,0x67,0x6c,0x79,0x70,0x68,0x32,0x34,0x39,0x31,0x2e,0x30,0x30,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x44,0x61,0x74,0x74,0x6f,0x2c,0x20,0x49,0x6e,0x63,0x2e,0x20,0x41,0x6c,0x6c,0x20,0x72,0x69,0x67,0x68,0x74,0x73,0x20,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x64,0x2e,0x44,0x2d,0x44,0x49,0x4e,0x44,0x2d,0x44,0x49,0x4e,0x00,0x00,0x00,0x01,0x87,0x00,0x01,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,0x00,0x07,0x00,0x68,0x00,0x09,0x00,0x0a,0x00,0x0b,0x00,0x0c,0x00,0x0d,0x00,0x0e,0x00,0x0f,0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x1a,0x00,0x1b,0x00,0x1c,0x00,0x1d,0x00,0x1e,0x00,0x1f,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2a,0x00,0x2b,0x00,0x2c,0x00,0x2d,0x00,0x2e,0x00,0x2f,0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x3d,0x00,0x3e,0x00,0x3f,0x00,0x40,0x00,0x7c,0x00,0x42,0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4a,0x00,0x4b,0x00,0x4c,0x00,0x4d,0x00,0x4e,0x00,0x4f,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5a,0x00,0x5b,0x00,0x5c,0x00,0x5d,0x00,0x5e,0x00,0x5f,0x01,0x88,0x00,0x60,0x00,0x61,0x00,0x62,0x00,0x67,0x00,0x64,0x00,0xa0,0x00,0x66,0x00,0x83,0x00,0xaa,0x00,0x8b,0x00,0x6a,0x00,0x97,0x01,0x89,0x00,0xa5,0x00,0x80,0x00,0xa1,0x00,0x9c,0x01,0x8a,0x01,0x8b,0x00,0x7d,0x01,0x8c,0x00,0x73,0x00,0x72,0x00,0x85,0x01,0x8d,0x00,0x8f,0x00,0x78,0x00,0x9e,0x00,0x9b,0x00,0xa3,0x00,0x7b,0x00,0xae,0x00,0xab,0x00,0xac,0x00,0xb0,0x00,0xad,0x00,0xaf,0x00,0x8a,0x00,0xb1,0x00,0xb5,0x00,0xb2,0x00,0xb3,0x00,0xb4,0x00,0xb9,0x00,0xb6,0x00,0xb7,0x00,0xb8,0x00,0x9a,0x00,0xba,0x00,0xbe,0x00,0xbb,0x00,0xbc,0x00,0xbf,0x00,0xbd,0x00,0xa8,0x00,0x8d,0x00,0xc4,0x00,0xc1,0x00,0xc2,0x00,0xc3,0x00,0xc5,0x00,0x9d,0x00,0x95,0x00,0xcb,0x00,0xc8,0x00,0xc9,0x00,0xcd,0x00,0xca,0x00,0xcc,0x00,0x90,0x00,0xce,0x00,0xd2,0x00,0xcf,0x00,0xd0,0x00,0xd1,0x00,0xd6,0x00,0xd3,0x00,0xd4,0x00,0xd5,0x00,0xa7,0x00,0xd7,0x00,0xdb,0x00,0xd8,0x00,0xd9,0x00,0xdc,0x00,0xda,0x00,0x9f,0x00,0x93,0x00,0xe1,0x00,0xde,0x00,0xdf,0x00,0xe0,0x00,0xe2,0x00,0xa2,0x00,0xe3,0x00,0x91,0x00,0x8e,0x00,0x94,0x00,0xc0,0x00,0xdd,0x00,0xc6,0x00,0xc7,0x00,0xe4,0x00,0x65,0x00,0x7e,0x00,0x88,0x00,0x82,0x00,0x84,0x00,0x7f,0x01,0x8e,0x01,0x8f,0x01,0x90,0x01,0x91,0x01,0x92,0x01,0x93,0x00,0x6f,0x00,0x89,0x00,0x41,0x00,0x08,0x00,0x75,0x00,0x69,0x00,0x77,0x00,0x76,0x00,0x70,0x00,0x71,0x00,0x74,0x00,0x79,0x00,0x7a,0x00,0x6b,0x00,0x6c,0x01,0x94,0x00,0x99,0x00,0x6d,0x00,0x6e,0x01,0x95,0x01,0x96,0x01,0x97,0x01,0x98,0x01,0x99,0x01,0x9a,0x01,0x9b,0x01,0x9c,0x01,0x9d,0x01,0x9e,0x01,0x9f,0x01,0xa0,0x01,0xa1,0x01,0xa2,0x01,0xa3,0x01,0xa4,0x01,0xa5,0x01,0xa6,0x01,0xa7,0x00,0xfb,0x02,0x00,0x01,0x00,0x19,0x00,0x1c,0x00,0x1f,0x00,0x37,0x00,0x4c,0x00,0xa2,0x03,0x0a,0x03,0x38,0x06,0x1e,0x06,0x2b,0x06,0xba,0x07,0x5f,0x07,0x88,0x07,0x91,0x07,0x99,0x07,0xa5,0x07,0xaf,0x07,0xc2,0x08,0xc4,0x08,0xd9,0x09,0xea,0x0b,0xe4,0x0c,0x0d,0x0d,0x6b,0x0f,0x31,0x0f,0x49,0x12,0xe0,0x14,0xb1,0x14,0xc3,0x14,0xd4,0x14,0xef,0x15,0x04,0x15,0x1d,0x16,0x76,0x1a,0x2d,0x1a,0x3c,0x1b,0xb4,0x1c,0xf8,0x1d,0xa4,0x1d,0xad,0x1d,0xc4,0x1f,0x7b,0x1f,0x95,0x1f,0x9e,0x20,0x03,0x20,0x2c,0x20,0x3c,0x20,0x68,0x20,0x72,0x20,0x8d,0x21,0x33,0x22,0x75,0x23,0x4c,0x23,0x53,0x23,0x66,0x23,0x6e,0x23,0x89,0x23,0xb8,0x23,0xe4,0x23,0xed,0x23,0xf5,0x24,0x07,0x24,0x19,0x24,0x2b,0x24,0x47,0x24,0x50,0x24,0x59,0x24,0x6e,0x25,0x20,0x26,0xa2,0x27,0xc3,0x27,0xd5,0x27,0xdf,0x29,0xb6,0x2a,0x67,0x2a,0x78,0x2a,0xd7,0x2b,0x00,0x2b,0x57,0x2c,0xb4,0x2c,0xbc,0x2c,0xd1,0x2e,0x04,0x2f,0x30,0x2f,0xbb,0x2f,0xc2,0x30,0x27,0x30,0x36,0x30,0x51,0x30,0x81,0x30,0xab,0x30,0xb4,0x30,0xbd,0x32,0x09,0x32,0x17,0x33,0x5d,0x34,0xaa,0x34,0xad,0x34,0xc5,0x36,0x6d,0x37,0x7e,0x38,0xc6,0x39,0x02,0x39,0x1a,0x3c,0x9d,0x3c,0xae,0x40,0x88,0x41,0xf6,0x42,0x04,0x42,0x14,0x42,0x20,0x44,0x8e,0x44,0x9a,0x46,0x1c,0x46,0x2d,0x46,0x36,0x46,0x42,0x46,0x4b,0x46,0xd6,0x47,0x62,0x47,0x6d,0x47,0x7c,0x47,0x85,0x48,0x67,0x48,0x84,0x48,0x9b,0x49,0xa3,0x49,0xc0,0x4b,0x16,0x4b,0x2c,0x4b,0x41,0x4b,0x56,0x4c,0xea,0x4d,0x08,0x4e,0x62,0x4e,0x9f,0x4f,0xf8,0x50,0x07,0x50,0x17,0x50,0x26,0x50,0x3d,0x50,0x4d,0x50,0x5c,0x50,0x6b,0x50,0x83,0x51,0x4d,0x52,0xd8,0x52,0xfa,0x53,0x1c,0x53,0x3e,0x54,0xda,0x55,0x04,0x55,0x2f,0x56,0x95,0x56,0xa3,0x56,0xb2,0x56,0xc0,0x56,0xd6,0x56,0xe5,0x57,0x96,0x59,0x95,0x59,0xb7,0x59,0xd9,0x59,0xfb,0x5b,0x97,0x5b,0xc1,0x5b,0xe9,0x5e,0x94,0x60,0x14,0x60,0x2f,0x60,0x4b,0x60,0x66,0x60,0x89,0x60,0x99,0x60,0xa8,0x60,0xb7,0x60,0xcf,0x62,0x19,0x63,0xa1,0x63,0xc3,0x63,0xe5,0x64,0x07,0x65,0xa3,0x65,0xcd,0x67,0x86,0x69,0x0f,0x69,0x2b,0x69,0x47,0x69,0x63,0x69,0x87,0x69,0x96,0x6a,0x4a,0x6a,0x62,0x6a,0x6b,0x6b,0x3c,0x6d,0xcb,0x6d,0xd8,0x6d,0xe5,0x6d,0xfd,0x6e,0x0c,0x6e,0x1b,0x6f,0x0f,0x6f,0x18,0x6f,0x21,0x6f,0x2c,0x6f,0x41,0x70,0xc4,0x70,0xce,0x70,0xd7,0x70,0xe0,0x72,0x64,0x72,0x76,0x73,0x14,0x73,0x1f,0x73,0x2a,0x73,0x38,0x73,0x41,0x73,0x49,0x73,0x5c,0x73,0x69,0x73,0x77,0x73,0x91,0x73,0xba,0x74,0x6d,0x74,0x85,0x76,0x13,0x76,0x1c,0x76,0x25,0x77,0x81,0x77,0xbf,0x77,0xd5,0x78,0x34,0x78,0x37,0x78,0x39,0x78,0xed,0x7a,0x51,0x7a,0x5a,0x7b,0x53,0x7d,0x61,0x7d,0x6a,0x7d,0x7d,0x7d,0x86,0x7e,0x80,0x7e,0x8c,0x7e,0x96,0x7f,0xfb,0x80,0x04,0x80,0x0d,0x80,0x19,0x80,0x23,0x80,0x2d,0xd3,0xf0,0xf9,0x46,0x15,0xfd,0x46,0xf8,0x21,0xf9,0x46,0x07,0x69,0xfd,0x24,0x15,0xfb,0xdd,0xf9,0x02,0xf7,0xdd,0x06,0x0e,0xfb,0xcb,0x0e,0xfb,0xcb,0x0e,0xfb,0xb5,0xd9,0xf9,0x46,0x15,0x99,0xfc,0x82,0xc3,0x8b,0x99,0xf8,0x82,0x05,0x34,0xfc,0xe9,0x15,0x2e,0xe4,0xe8,0x07,0x0e,0xfb,0x70,0xc0,0xf9,0x46,0x15,0xfb,0x7a,0xcd,0xf7,0x7a,0x07,0xd1,0x16,0xfb,0x7a,0xcd,0xf7,0x7a,0x07,0x0e,0x7a,0xf8,0x1c,0xf8,0x42,0x15,0xe9,0xc2,0x34,0x06,0xa6,0xf7,0x61,0x4f,0x8b,0x70,0xfb,0x61,0xfb,0x1e,0x8b,0xa6,0xf7,0x61,0x50,0x8b,0x70,0xfb,0x61,0x2e,0x8b,0x8b,0x54,0xe1,0x8b,0x77,0xfb,0x2d,0x31,0x8b,0x8b,0x53,0xdd,0x8b,0x6e,0xfb,0x71,0x05,0xc7,0x8b,0xa8,0xf7,0x71,0xf7,0x1e,0x8b,0x6e,0xfb,0x71,0xc7,0x8b,0xa8,0xf7,0x71,0xec,0x8b,0x8b,0xc3,0x31,0x8b,0x05,0x63,0xf7,0x2d,0x15,0x77,0xfb,0x2d,0xfb,0x1e,0x8b,0x9f,0xf7,0x2d,0x05,0x0e,0x44,0xff,0x01,0x70,0x80,0x00,0xde,0x15,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xaa,0xb4,0x8b,0xff,0x00,0x33,0x55,0x56,0x8b,0xff,0x00,0x31,0x55,0x55,0xff,0xff,0xf3,0xd5,0x56,0xff,0x00,0x26,0x55,0x55,0xff,0xff,0xe7,0xaa,0xaa,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xe7,0xaa,0xaa,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xdc,0x80,0x00,0x9d,0xff,0xff,0xd1,0x55,0x56,0xff,0x00,0x08,0xaa,0xaa,0x08,0x7a,0x8e,0x8b,0xf7,0x6f,0x05,0xbd,0x81,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xdb,0x55,0x54,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xc0,0xaa,0xac,0x08,0xd0,0x06,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x35,0x55,0x10,0xff,0xff,0xf0,0x80,0x00,0xff,0x00,0x28,0xd5,0x54,0xff,0xff,0xe5,0xaa,0xaa,0xff,0x00,0x1c,0x55,0x9c,0xff,0xff,0xe5,0xaa,0xbe,0xff,0x00,0x1c,0x54,0xb4,0xff,0xff,0xdd,0x2a,0xaa,0xff,0x00,0x10,0xd5,0x54,0xff,0xff,0xd4,0xaa,0x98,0xff,0x00,0x05,0x55,0xf8,0x08,0xdc,0x51,0x39,0x07,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xfa,0xaa,0xac,0xff,0xff,0xdb,0xd5,0x55,0xff,0xff,0xee,0x2a,0xa8,0x70,0xff,0xff,0xe1,0xaa,0xac,0x70,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xd8,0x2a,0xa8,0x8b,0xff,0xff,0xce,0xaa,0xac,0x8b,0x5b,0x97,0xff,0xff,0xdb,0x2a,0xaa,0xa3,0xff,0xff,0xe6,0x55,0x56,0xa3,0xff,0xff,0xe6,0x55,0x56,0xff,0x00,0x23,0x55,0x55,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x2e,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xaa,0x08,0x92,0x8a,0x8b,0xfb,0x7a,0x05,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x04,0xaa,0xaa,0x76,0xff,0x00,0x0b,0xd5,0x56,0xff,0xff,0xf0,0xaa,0xab,0x9e,0xff,0xff,0xf0,0xaa,0xb2,0x9e,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x1b,0x2a,0xab,0xff,0xff,0xfc,0xaa,0xa4,0xff,0x00,0x23,0x55,0x55,0x08,0x46,0x06,0x8f,0x55,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xd5,0xaa,0xaa,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x25,0xaa,0xaa,0xff,0xff,0xed,0xff,0xff,0xbb,0xff,0xff,0xfa,0xaa,0xab,0x08,0x34,0xc5,0xe3,0x07,0xbd,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x27,0x2a,0xaa,0x9d,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x1e,0xaa,0xab,0x08,0xfb,0x7f,0xff,0x01,0x55,0x80,0x00,0x15,0x7e,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf9,0x80,0x00,0xff,0x00,0x16,0x2a,0xaa,0x8b,0xa7,0x8b,0xff,0x00,0x1c,0xaa,0xac,0xff,0x00,0x06,0xaa,0xaa,0xff,0x00,0x17,0x80,0x00,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x12,0x55,0x54,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x12,0x55,0x54,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0b,0x80,0x00,0xa5,0xff,0x00,0x04,0xaa,0xac,0x08,0xfb,0x62,0x07,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xec,0x2a,0xab,0xff,0x00,0x0b,0x80,0x00,0x7e,0xff,0x00,0x10,0x55,0x56,0x08,0xf7,0x4d,0xff,0xfe,0xd4,0x80,0x00,0x15,0x7c,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xe9,0x80,0x00,0xff,0xff,0xf4,0xaa,0xaa,0x6d,0x87,0x08,0xf7,0x6f,0x07,0xff,0x00,0x1f,0x55,0x56,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x16,0xd5,0x54,0x7f,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xe7,0xaa,0xaa,0x8b,0x6b,0x8b,0x6b,0xff,0xff,0xf8,0x80,0x00,0xff,0xff,0xe6,0xaa,0xab,0x7c,0xff,0xff,0xed,0x55,0x55,0x08,0xff,0xff,0x3c,0x80,0x00,0xf8,0xc7,0x15,0x0e,0xf7,0xc2,0xd2,0xf7,0xc4,0x15,0x20,0x0a,0xf8,0x87,0xf8,0x16,0x15,0x21,0x0a,0xfc,0x40,0xff,0xfe,0xa8,0x80,0x00,0x15,0x22,0x0a,0xf8,0x05,0xff,0xfe,0xc4,0x80,0x00,0x15,0x23,0x0a,0xf7,0x1a,0xff,0x00,0x2a,0x80,0x00,0x15,0x24,0x0a,0x0e,0xd0,0xf8,0xae,0xcc,0x15,0x74,0x06,0x7d,0x8b,0xff,0xff,0xf2,0xaa,0xaa,0x94,0xff,0xff,0xf3,0x55,0x56,0x9d,0x08,0x68,0xbd,0xdc,0xf7,0x01,0x5c,0xb4,0x43,0x2b,0xfb,0x10,0xf7,0x45,0x05,0xb7,0xff,0x00,0x26,0xaa,0x90,0xff,0x00,0x1e,0x80,0x00,0xff,0x00,0x20,0xaa,0xaa,0x9c,0xff,0x00,0x1a,0xaa,0xc6,0x9c,0xff,0x00,0x1a,0xaa,0x6c,0xff,0x00,0x08,0x80,0x00,0xa8,0x8b,0xff,0x00,0x1f,0x55,0x94,0x8b,0xff,0x00,0x28,0xaa,0xac,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x21,0xd5,0x54,0xff,0xff,0xe5,0x55,0x56,0xa6,0xff,0xff,0xe5,0x55,0x56,0xa6,0xff,0xff,0xdd,0xaa,0xaa,0xff,0x00,0x0d,0x80,0x00,0x61,0x8b,0x61,0x8b,0xff,0xff,0xdd,0x55,0x55,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xe4,0xaa,0xab,0x70,0xff,0xff,0xe4,0xaa,0xaa,0x70,0xff,0xff,0xf2,0x55,0x56,0xff,0xff,0xdd,0x80,0x00,0x8b,0x61,0x08,0x8b,0xff,0xff,0xe9,0x55,0x54,0xff,0x00,0x05,0xaa,0xaa,0xff,0xff,0xe9,0x80,0x00,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xe9,0xaa,0xac,0xff,0x00,0x0b,0x55,0x51,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x16,0x55,0x55,0xff,0xff,0xdc,0x80,0x00,0xff,0x00,0x21,0x55,0x5a,0xff,0xff,0xcf,0x55,0x56,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xd7,0x55,0x56,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xda,0xaa,0xaa,0xff,0xff,0xea,0xaa,0xaa,0x69,0xff,0xff,0xea,0xaa,0xac,0x69,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xdc,0x55,0x55,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xda,0xaa,0xab,0x8b,0x57,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xd6,0x2a,0xaa,0xff,0x00,0x1d,0x55,0x56,0xff,0xff,0xe0,0x55,0x56,0xff,0x00,0x1d,0x55,0x55,0xff,0xff,0xe0,0x55,0x55,0xb4,0xff,0xff,0xf0,0x2a,0xab,0xff,0x00,0x34,0xaa,0xab,0x8b,0x08,0xff,0x00,0x21,0x55,0x56,0x8b,0xff,0x00,0x1e,0x55,0x54,0xff,0x00,0x07,0xaa,0xab,0xff,0x00,0x1b,0x55,0x56,0xff,0x00,0x0f,0x55,0x55,0xff,0x00,0x1b,0x55,0x56,0xff,0x00,0x0f,0x55,0x55,0xa6,0xff,0x00,0x18,0x55,0x55,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x21,0x55,0x56,0x08,0xa8,0x62,0x05,0x97,0xff,0xff,0xee,0xaa,0xab,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xf4,0x2a,0xab,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf9,0xaa,0xab,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xfc,0xd5,0x55,0x9d,0x8b,0x08,0xad,0x06,0xff,0xfe,0xaa,0x80,0x00,0xff,0x02,0x69,0x80,0x00,0x15,0xff,0x00,0x0e,0x55,0x55,0x9a,0xff,0x00,0x12,0x80,0x00,0xff,0x00,0x07,0x80,0x00,0xff,0x00,0x16,0xaa,0xab,0x8b,0xff,0x00,0x16,0xaa,0xaa,0x8b,0xff,0x00,0x12,0x55,0x56,0xff,0xff,0xf8,0x80,0x00,0x99,0x7c,0x99,0x7c,0x92,0xff,0xff,0xec,0x80,0x00,0x8b,0x73,0x8b,0xff,0xff,0xea,0xaa,0xac,0xff,0xff,0xfa,0x55,0x56,0xff,0xff,0xec,0x55,0x54,0xff,0xff,0xf4,0xaa,0xaa,0x79,0xff,0xff,0xf4,0xaa,0xb4,0x79,0xff,0xff,0xe8,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xdc,0xaa,0xa2,0xff,0xff,0xe0,0xaa,0xaa,0xff,0xff,0xe4,0xaa,0xab,0xff,0x00,0x27,0x55,0x56,0xff,0xff,0xee,0x2a,0xaa,0xa7,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x10,0xaa,0xaa,0x08,0xff,0xff,0xf7,0xaa,0xab,0xff,0x00,0x10,0xaa,0xac,0xff,0xff,0xfb,0xd5,0x55,0x9b,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x18,0xaa,0xac,0xff,0x00,0x07,0x2a,0xab,0xff,0x00,0x13,0xd5,0x54,0xff,0x00,0x0e,0x55,0x55,0x9a,0x08,0xff,0x00,0x61,0x80,0x00,0xfc,0xb5,0x15,0xff,0xff,0xec,0xaa,0xaa,0x7e,0xff,0xff,0xea,0xaa,0xab,0xff,0xff,0xf9,0x80,0x00,0xff,0xff,0xe8,0xaa,0xab,0x8b,0x6b,0x8b,0xff,0xff,0xe6,0xd5,0x55,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xed,0xaa,0xab,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xed,0xaa,0xab,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xf6,0xd5,0x55,0xff,0x00,0x1b,0x7f,0xff,0x8b,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x1a,0xaa,0xab,0x93,0xff,0x00,0x1a,0x2a,0xaa,0x9b,0xff,0x00,0x19,0xaa,0xab,0x9b,0xff,0x00,0x19,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xab,0xff,0x00,0x1c,0x80,0x00,0xff,0x00,0x23,0x55,0x55,0xff,0x00,0x1f,0x55,0x56,0x08,0xf7,0x18,0xfb,0x52,0x05,0xff,0xff,0xe7,0x55,0x56,0x6b,0x75,0xff,0xff,0xe9,0x80,0x00,0xff,0xff,0xec,0xaa,0xaa,0x7e,0x08,0x0e,0xfb,0xf8,0xc0,0xf9,0x46,0x15,0xfb,0x7a,0xcd,0xf7,0x7a,0x07,0x0e,0xfb,0x84,0xc6,0xf7,0xdc,0x15,0x8b,0xfb,0x24,0xff,0x00,0x27,0x55,0x55,0xff,0xff,0x76,0xaa,0xab,0xff,0x00,0x4e,0xaa,0xab,0xff,0xff,0x7d,0x55,0x55,0x08,0xbf,0x06,0xff,0xff,0xde,0xaa,0xab,0xcb,0xff,0xff,0xe6,0xd5,0x55,0xff,0x00,0x43,0x2a,0xaa,0x7a,0xff,0x00,0x46,0x55,0x56,0x7a,0xff,0x00,0x46,0x55,0x56,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x46,0x2a,0xaa,0x8b,0xd1,0x8b,0xff,0x00,0x45,0x55,0x56,0xff,0x00,0x08,0x80,0x00,0xff,0x00,0x45,0xaa,0xaa,0x9c,0xd1,0x9c,0xd1,0xff,0x00,0x19,0x2a,0xab,0xff,0x00,0x43,0xaa,0xac,0xff,0x00,0x21,0x55,0x55,0xff,0x00,0x41,0x55,0x54,0x08,0x58,0x06,0xff,0xff,0xb0,0xaa,0xaa,0xff,0xff,0x7e,0xaa,0xac,0xff,0xff,0xd8,0x55,0x56,0xff,0xff,0x76,0xaa,0xa8,0x8b,0xff,0xff,0x6e,0xaa,0xac,0x08,0x0e,0xfb,0x84,0xf7,0x1b,0xf7,0x0a,0x15,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xb9,0x55,0x56,0xff,0xff,0xe6,0xaa,0xab,0xff,0xff,0xbc,0xaa,0xaa,0xff,0xff,0xde,0xaa,0xab,0x4b,0x08,0xbf,0x06,0xff,0x00,0x4e,0xaa,0xa4,0xff,0x00,0x82,0xaa,0xab,0xff,0x00,0x27,0x55,0x55,0xff,0x00,0x89,0x55,0x55,0xff,0x00,0x00,0x00,0x07,0xf7,0x24,0xff,0x00,0x00,0x00,0x07,0xff,0x00,0x92,0xaa,0xac,0xff,0xff,0xd8,0x55,0x55,0xff,0x00,0x89,0x55,0x54,0xff,0xff,0xb0,0xaa,0xa4,0xf7,0x14,0x08,0x58,0x06,0xff,0x00,0x21,0x55,0x55,0xff,0xff,0xbe,0xaa,0xac,0xff,0x00,0x19,0x55,0x55,0xff,0xff,0xbc,0x55,0x54,0xff,0x00,0x11,0x55,0x56,0x45,0xff,0x00,0x11,0x55,0x55,0x45,0xff,0x00,0x08,0xaa,0xab,0xff,0xff,0xba,0x55,0x56,0x8b,0xff,0xff,0xba,0xaa,0xaa,0x8b,0xff,0xff,0xba,0xaa,0xaa,0xff,0xff,0xf7,0x55,0x55,0x45,0xff,0xff,0xee,0xaa,0xab,0xff,0xff,0xb9,0x55,0x56,0x08,0x0e,0xfb,0x2b,0xf7,0x3a,0xf8,0x9b,0x15,0x23,0xb8,0xf3,0x07,0xe2,0x59,0x9f,0xaf,0x33,0xbe,0xe3,0xbd,0x77,0xaf,0x34,0x59,0x8b,0xed,0x5e,0x8b,0x8b,0x29,0x35,0xbd,0x76,0x67,0xe3,0x59,0x33,0x58,0xa0,0x67,0x05,0x0e,0x7b,0xf7,0x73,0xf7,0x87,0x15,0x25,0x0a,0x0e,0xfb,0xf8,0xc0,0xe8,0x15,0x26,0x0a,0x0e,0xfb,0x1b,0xc6,0xf8,0x10,0x15,0x49,0xf7,0xa7,0xcd,0x07,0x0e,0xfb,0xe2,0xc0,0xe7,0x15,0x2f,0xe3,0xe7,0x07,0x0e,0xfb,0x1c,0xf7,0xa5,0xf9,0x46,0x15,0xfb,0x6a,0xfd,0x50,0xc7,0x8b,0xf7,0x6a,0xf9,0x50,0x05,0x0e,0x68,0xcd,0xf7,0x67,0x15,0xff,0xff,0x6c,0xaa,0xab,0xc7,0xff,0xff,0xb6,0x55,0x55,0xf7,0x0c,0x1e,0xff,0x00,0x78,0xaa,0xaa,0xff,0x00,0x00,0x00,0x01,0xff,0x00,0x3c,0x55,0x56,0xff,0x00,0x49,0xaa,0xaa,0x8b,0xff,0x00,0x93,0x55,0x55,0x08,0xf7,0xa4,0x07,0xff,0x00,0x90,0xaa,0xac,0xff,0xff,0xc3,0xaa,0xaa,0xff,0x00,0x48,0x55,0x54,0xff,0xff,0x87,0x55,0x56,0xfb,0x0c,0x4f,0xff,0xff,0xb7,0xaa,0xac,0xff,0xff,0x6f,0x55,0x54,0x1e,0xf7,0x9b,0xfc,0x18,0x15,0xff,0xff,0xef,0x55,0x56,0x71,0xff,0xff,0xe4,0x55,0x54,0x7e,0xff,0xff,0xd9,0x55,0x56,0x8b,0xff,0xff,0xd9,0x55,0x55,0x8b,0xff,0xff,0xe4,0x80,0x00,0x98,0xff,0xff,0xef,0xaa,0xab,0xa5,0xff,0xff,0xef,0xaa,0xab,0xa5,0xff,0xff,0xf7,0xd5,0x55,0xff,0x00,0x2b,0x55,0x55,0x8b,0xff,0x00,0x3c,0xaa,0xab,0x08,0xf7,0x84,0x07,0x8b,0xff,0x00,0x3c,0xaa,0xac,0xff,0x00,0x08,0x2a,0xab,0xff,0x00,0x2b,0x55,0x54,0xff,0x00,0x10,0x55,0x55,0xa5,0xff,0x00,0x10,0x55,0x55,0xa5,0xff,0x00,0x1b,0x80,0x00,0x98,0xff,0x00,0x26,0xaa,0xab,0x8b,0xff,0x00,0x26,0xaa,0x98,0x8b,0xff,0x00,0x1b,0xaa,0xaa,0x7e,0xff,0x00,0x10,0xaa,0xbe,0x71,0xff,0x00,0x10,0xaa,0xaa,0x71,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xd4,0xaa,0xac,0x8b,0xff,0xff,0xc3,0x55,0x54,0x08,0xfb,0x84,0x07,0x8b,0xff,0xff,0xc3,0x55,0x55,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xef,0x55,0x56,0x71,0x08,0x0e,0xfb,0x5b,0xf7,0x3d,0xf8,0xf2,0x15,0xfc,0xf2,0xd3,0xf9,0x46,0x42,0x07,0xfb,0x0a,0x30,0x8b,0x39,0x05,0x0e,0x4f,0xc6,0xc6,0x15,0x50,0xf7,0xf2,0xcc,0xfb,0x98,0x07,0xf7,0x5c,0xf7,0xb4,0x05,0x9f,0xff,0x00,0x1b,0x55,0x56,0x9a,0xff,0x00,0x1a,0x55,0x54,0x95,0xff,0x00,0x19,0x55,0x56,0x95,0xff,0x00,0x19,0x55,0x56,0x90,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xa7,0x08,0x9c,0x07,0x8b,0xab,0xff,0xff,0xf8,0xd5,0x56,0xa8,0xff,0xff,0xf1,0xaa,0xaa,0xa5,0xff,0xff,0xf1,0xaa,0xaa,0xa5,0xff,0xff,0xeb,0x80,0x00,0xff,0x00,0x14,0x80,0x00,0xff,0xff,0xe5,0x55,0x56,0x9a,0xff,0xff,0xe5,0x55,0x56,0x9a,0xff,0xff,0xe1,0x55,0x54,0xff,0x00,0x07,0x80,0x00,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xca,0xaa,0xab,0x8b,0xff,0xff,0xd5,0x80,0x00,0xff,0xff,0xf0,0x2a,0xac,0xff,0xff,0xe0,0x55,0x55,0xff,0xff,0xe0,0x55,0x54,0xff,0xff,0xe0,0x55,0x56,0xff,0xff,0xe0,0x55,0x54,0xff,0xff,0xf0,0x2a,0xaa,0xff,0xff,0xd6,0x2a,0xac,0x8b,0x57,0x08,0x75,0xd3,0x9d,0x07,0x8b,0xff,0x00,0x24,0xaa,0xac,0x94,0xff,0x00,0x1b,0xd5,0x54,0x9d,0x9e,0x9d,0x9e,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x09,0x80,0x00,0xff,0x00,0x1f,0x55,0x55,0x8b,0xff,0x00,0x1f,0x55,0x56,0x8b,0xa4,0xff,0xff,0xf6,0x55,0x54,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xac,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xe5,0xaa,0xa8,0x8b,0xff,0xff,0xde,0xaa,0xac,0x08,0x7c,0x07,0x8b,0xff,0xff,0xda,0xaa,0xc8,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xd7,0xaa,0xaa,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xd4,0xaa,0x8e,0x08,0x0e,0x6a,0xf7,0x02,0xff,0x00,0x22,0x80,0x00,0x15,0xff,0x00,0x20,0xaa,0xab,0xff,0xff,0xe2,0x55,0x55,0xb7,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x37,0x55,0x55,0x8b,0xc3,0x8b,0xff,0x00,0x2d,0x2a,0xaa,0xff,0x00,0x11,0x2a,0xab,0xff,0x00,0x22,0x55,0x56,0xff,0x00,0x22,0x55,0x55,0xff,0x00,0x22,0x55,0x56,0xff,0x00,0x22,0x55,0x54,0xff,0x00,0x11,0x2a,0xaa,0xff,0x00,0x2d,0xd5,0x55,0x8b,0xff,0x00,0x39,0x55,0x57,0x08,0xa3,0x07,0x8b,0xff,0x00,0x27,0x55,0x55,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x21,0xd5,0x55,0x7a,0xff,0x00,0x1c,0x55,0x56,0x7a,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xe7,0x80,0x00,0xff,0x00,0x14,0x2a,0xaa,0x6b,0x97,0xa5,0x97,0xa0,0xff,0x00,0x12,0x55,0x56,0x9b,0xff,0x00,0x18,0xaa,0xaa,0x9b,0xff,0x00,0x18,0xaa,0xaa,0x93,0xa8,0x8b,0xff,0x00,0x21,0x55,0x56,0x08,0xa1,0x07,0x8b,0xbf,0xff,0xff,0xf0,0x55,0x56,0xff,0x00,0x29,0x80,0x00,0xff,0xff,0xe0,0xaa,0xaa,0xaa,0xff,0xff,0xe0,0xaa,0xb0,0xaa,0xff,0xff,0xd5,0xaa,0xaa,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xca,0xaa,0xa6,0x8b,0x55,0x8b,0xff,0xff,0xd5,0x80,0x00,0x7c,0x6c,0x6d,0x6c,0x6d,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xd7,0xaa,0xac,0x8b,0xff,0xff,0xcd,0x55,0x54,0x08,0x79,0xd1,0x9b,0x07,0x8b,0xff,0x00,0x1f,0x55,0x54,0x94,0xa4,0x9d,0xff,0x00,0x12,0xaa,0xac,0x9d,0xff,0x00,0x12,0xaa,0xac,0xa4,0xff,0x00,0x09,0x55,0x54,0xab,0x8b,0xab,0x8b,0xff,0x00,0x19,0x55,0x56,0x81,0xff,0x00,0x12,0xaa,0xaa,0x77,0xff,0x00,0x12,0xaa,0xaa,0x77,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xe5,0x55,0x54,0x8b,0xff,0xff,0xde,0xaa,0xac,0x08,0x77,0x07,0x8b,0x69,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xe4,0x80,0x00,0xff,0xff,0xec,0xaa,0xaa,0x76,0xff,0xff,0xec,0xaa,0xbc,0x76,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xde,0xaa,0x9a,0x8b,0x08,0x68,0x49,0xaf,0x06,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xff,0x00,0x1c,0xd5,0x56,0xff,0xff,0xf4,0xd5,0x56,0xa0,0xff,0xff,0xe9,0xaa,0xaa,0xa0,0xff,0xff,0xe9,0xaa,0xba,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xe1,0xd5,0x55,0x8b,0xff,0xff,0xd9,0xff,0xf1,0x08,0x71,0x07,0x8b,0xff,0xff,0xdb,0x55,0x55,0x81,0xff,0xff,0xe2,0xd5,0x55,0x77,0xff,0xff,0xea,0x55,0x56,0x77,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xde,0xaa,0xab,0x8b,0xff,0xff,0xe5,0x80,0x00,0xff,0x00,0x09,0x2a,0xaa,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x12,0x55,0x56,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x12,0x55,0x56,0xff,0xff,0xf6,0x2a,0xab,0xff,0x00,0x19,0x2a,0xaa,0x8b,0xab,0x08,0x98,0x42,0x7b,0x07,0x8b,0xff,0xff,0xcd,0x55,0x55,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xd7,0xd5,0x55,0xff,0x00,0x20,0xaa,0xab,0xff,0xff,0xe2,0x55,0x56,0x08,0x0e,0x6e,0xf8,0x59,0xf7,0x1b,0x15,0xcd,0x40,0xf7,0x50,0x42,0xfb,0x50,0xfb,0x4e,0x07,0xf7,0x63,0xf8,0x7d,0x42,0x8b,0xfb,0x63,0xfc,0x7d,0x8b,0x49,0xf7,0x97,0x8b,0x8b,0xfb,0x1b,0xd4,0x8b,0x8b,0xf7,0x1b,0x05,0x0e,0x5f,0xff,0x00,0x70,0x80,0x00,0xac,0x15,0xaa,0xff,0xff,0xe3,0x55,0x55,0xff,0x00,0x2a,0xd5,0x55,0xff,0xff,0xf1,0xaa,0xab,0xff,0x00,0x36,0xaa,0xab,0x8b,0xff,0x00,0x37,0x55,0x56,0x8b,0xff,0x00,0x2b,0x55,0x54,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x1f,0x55,0x56,0xff,0x00,0x21,0x55,0x55,0xff,0x00,0x1f,0x55,0x56,0xff,0x00,0x21,0x55,0x54,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x2e,0xaa,0xab,0x8b,0xff,0x00,0x3c,0x00,0x01,0x08,0xd6,0x07,0x8b,0xc9,0x7d,0xff,0x00,0x2f,0xaa,0xaa,0x6f,0xff,0x00,0x21,0x55,0x56,0x6f,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xd6,0x55,0x56,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xc8,0xaa,0xaa,0x8b,0x75,0x8b,0xff,0xff,0xeb,0xaa,0xab,0xff,0xff,0xfb,0xd5,0x56,0xff,0xff,0xed,0x55,0x55,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xed,0x55,0x55,0xff,0xff,0xf7,0xab,0x14,0xff,0xff,0xf0,0xaa,0xab,0xff,0xff,0xf5,0x2a,0xaa,0x7f,0xff,0xff,0xf2,0xaa,0x42,0x08,0xf7,0x70,0xf7,0x9b,0xce,0xfb,0xde,0xfc,0x0e,0xcb,0x07,0xff,0x00,0x07,0x55,0x42,0xa1,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x11,0x2a,0xaa,0xff,0x00,0x11,0x55,0x69,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x11,0x55,0x55,0xff,0x00,0x0c,0x55,0x56,0xa0,0xff,0x00,0x06,0x2a,0xaa,0xff,0x00,0x18,0xaa,0xab,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x1a,0x2a,0xaa,0xff,0xff,0xf5,0x2a,0xaa,0x9c,0xff,0xff,0xea,0x55,0x56,0x9c,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xdf,0x2a,0xaa,0x8b,0x5f,0x08,0x4a,0x07,0xff,0xff,0xa9,0x55,0x56,0x68,0xff,0xff,0xd4,0xaa,0xaa,0x45,0x1e,0xff,0xff,0xde,0xaa,0xab,0x8b,0xff,0xff,0xe6,0x55,0x55,0xff,0x00,0x08,0xaa,0xaa,0x79,0xff,0x00,0x11,0x55,0x56,0x79,0xff,0x00,0x11,0x55,0x56,0x82,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xab,0x08,0x92,0x45,0x7e,0x07,0x8b,0xff,0xff,0xce,0xaa,0xab,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xd8,0xff,0xff,0xaa,0xff,0xff,0xe3,0x55,0x56,0x08,0x0e,0x69,0xf7,0x02,0xff,0x00,0x2a,0x80,0x00,0x15,0xad,0x68,0xff,0x00,0x2d,0xaa,0xab,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x39,0x55,0x55,0x8b,0xaf,0x8b,0xff,0x00,0x20,0x2a,0xaa,0xff,0x00,0x07,0xd5,0x55,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x16,0x55,0x54,0xff,0x00,0x16,0x7f,0xff,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x1d,0x55,0x56,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x1d,0x55,0x56,0xff,0x00,0x08,0x2a,0xaa,0xff,0x00,0x22,0xff,0xff,0x8b,0xff,0x00,0x28,0xaa,0xab,0x08,0xad,0x07,0x8b,0xff,0x00,0x39,0x55,0x56,0xff,0xff,0xf0,0x2a,0xaa,0xff,0x00,0x2d,0xaa,0xaa,0xff,0xff,0xe0,0x55,0x56,0xad,0xff,0xff,0xe0,0x55,0x56,0xad,0xff,0xff,0xd6,0x80,0x00,0x9c,0xff,0xff,0xcc,0xaa,0xaa,0x8b,0xff,0xff,0xf1,0x55,0x65,0x8b,0xff,0xff,0xf1,0xd5,0x55,0x89,0xff,0xff,0xf2,0x55,0x46,0x87,0xff,0xff,0xf2,0x55,0x55,0x87,0xff,0xff,0xf5,0x2a,0xab,0x86,0x83,0x85,0x08,0xf7,0x29,0xf7,0xc3,0x3f,0x8b,0xfb,0x35,0xfb,0xd9,0x05,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xf5,0xd5,0x56,0x72,0x84,0xff,0xff,0xe8,0xaa,0xaa,0x84,0xff,0xff,0xe8,0xaa,0xba,0xff,0xff,0xfc,0x80,0x00,0x73,0x8b,0xff,0xff,0xe7,0x55,0x46,0x08,0x69,0x07,0x8b,0xff,0xff,0xc4,0xaa,0xab,0x9c,0xff,0xff,0xd0,0xd5,0x55,0xad,0x68,0x08,0xf7,0x71,0xba,0x15,0xff,0xff,0xeb,0x55,0x56,0x74,0x6f,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe4,0x2a,0xaa,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xeb,0xaa,0xab,0xa2,0xff,0xff,0xeb,0xaa,0xab,0xff,0x00,0x16,0xff,0xfc,0xff,0xff,0xf5,0xd5,0x55,0xff,0x00,0x1f,0x2a,0xab,0x8b,0xff,0x00,0x27,0x55,0x59,0x08,0xad,0x07,0x8b,0xff,0x00,0x26,0xaa,0xab,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x1e,0x7f,0xff,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1b,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xa7,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xe9,0x55,0x56,0xff,0x00,0x0a,0x55,0x56,0xff,0xff,0xe1,0x55,0x55,0x8b,0xff,0xff,0xd9,0x55,0x55,0x08,0x69,0x07,0x8b,0xff,0xff,0xd9,0x55,0x59,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xe1,0x2a,0xab,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xe8,0xff,0xfc,0x08,0x0e,0x2a,0xf8,0x1b,0xf9,0x46,0x15,0xfb,0xf3,0x49,0xf7,0xad,0x06,0xfb,0x78,0xfd,0x04,0xd4,0x8b,0xf7,0x75,0xf9,0x04,0x05,0x0e,0x7b,0xf7,0x31,0xff,0x00,0x0d,0x80,0x00,0x15,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xf0,0x55,0x55,0xff,0x00,0x20,0xaa,0xaa,0xff,0xff,0xf8,0x2a,0xab,0xff,0x00,0x24,0xaa,0xab,0x8b,0xff,0x00,0x25,0x55,0x56,0x8b,0xac,0xff,0x00,0x07,0xd5,0x55,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x16,0x80,0x00,0xff,0x00,0x16,0x2a,0xab,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x08,0x2a,0xaa,0xff,0x00,0x21,0x55,0x56,0x8b,0xb1,0x08,0xa4,0x07,0x8b,0xff,0x00,0x22,0xaa,0xab,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x1f,0x7f,0xff,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xe8,0x55,0x54,0xff,0x00,0x15,0x80,0x00,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x19,0x55,0x56,0xff,0x00,0x0c,0xaa,0xaa,0xff,0x00,0x14,0x2a,0xaa,0xff,0x00,0x12,0x80,0x00,0x9a,0xff,0x00,0x18,0x55,0x56,0x9a,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x07,0x80,0x00,0xff,0x00,0x1c,0xd5,0x54,0x8b,0xff,0x00,0x21,0x55,0x56,0x08,0x9f,0x07,0x8b,0xff,0x00,0x20,0xaa,0xac,0xff,0xff,0xf8,0xd5,0x56,0xff,0x00,0x1d,0x80,0x00,0xff,0xff,0xf1,0xaa,0xaa,0xff,0x00,0x1a,0x55,0x54,0xff,0xff,0xf1,0xaa,0xaa,0xff,0x00,0x1a,0x54,0xb4,0xff,0xff,0xeb,0x55,0x56,0xff,0x00,0x14,0xd5,0x54,0x70,0xff,0x00,0x0f,0x55,0xf8,0x70,0xff,0x00,0x0f,0x55,0x54,0xff,0xff,0xe0,0xd5,0x56,0xff,0x00,0x07,0xaa,0xac,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xdd,0x55,0x5c,0x8b,0xff,0xff,0xe1,0x55,0x55,0xff,0xff,0xf8,0x55,0x54,0xff,0xff,0xe5,0x55,0x4f,0xff,0xff,0xf0,0xaa,0xac,0xff,0xff,0xe5,0x55,0x55,0xff,0xff,0xf0,0xaa,0xac,0xff,0xff,0xeb,0x55,0x55,0xff,0xff,0xeb,0x2a,0xa8,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xe5,0xaa,0xac,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xe5,0xaa,0xac,0xff,0xff,0xf8,0xaa,0xaa,0xff,0xff,0xe2,0x80,0x00,0x8b,0xff,0xff,0xdf,0x55,0x54,0x08,0x77,0x07,0x8b,0xff,0xff,0xde,0xaa,0xc8,0xff,0x00,0x07,0x55,0x56,0xff,0xff,0xe3,0x2a,0xaa,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xe7,0xaa,0x8e,0xff,0x00,0x0e,0xaa,0xa7,0xff,0xff,0xe7,0xaa,0xaa,0x9f,0xff,0xff,0xed,0x80,0x00,0xff,0x00,0x19,0x55,0x59,0xff,0xff,0xf3,0x55,0x56,0x6d,0x7d,0xff,0xff,0xe8,0x80,0x00,0xff,0xff,0xea,0xd5,0x56,0x7a,0xff,0xff,0xe3,0xaa,0xaa,0x7a,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xdf,0xd5,0x55,0x8b,0xff,0xff,0xdc,0x00,0x01,0x08,0x72,0x07,0x8b,0xff,0xff,0xda,0xaa,0xab,0x93,0xff,0xff,0xde,0xff,0xff,0x9b,0xff,0xff,0xe3,0x55,0x56,0x9b,0xff,0xff,0xe3,0x55,0x56,0xff,0x00,0x16,0x55,0x55,0xff,0xff,0xe9,0xd5,0x55,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xf0,0x55,0x55,0x08,0xff,0x00,0xae,0x80,0x00,0xff,0x01,0x9c,0x80,0x00,0x15,0x78,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xe6,0xd5,0x56,0xff,0xff,0xf5,0xaa,0xaa,0xff,0xff,0xe0,0xaa,0xaa,0x8b,0xff,0xff,0xe0,0xaa,0xab,0x8b,0x72,0xff,0x00,0x0a,0x55,0x56,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x14,0xaa,0x8e,0xff,0xff,0xf6,0xaa,0xab,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x20,0xaa,0xc8,0x08,0xa0,0x07,0x8b,0xff,0x00,0x1f,0x55,0x10,0xff,0x00,0x09,0x80,0x00,0xff,0x00,0x19,0xd5,0x54,0x9e,0xff,0x00,0x14,0x55,0x9c,0x9e,0xff,0x00,0x14,0x55,0x54,0xff,0x00,0x18,0xd5,0x55,0xff,0x00,0x0a,0x2a,0xac,0xff,0x00,0x1e,0xaa,0xab,0x8b,0xff,0x00,0x1e,0xaa,0xaa,0x8b,0xa4,0xff,0xff,0xf5,0xd5,0x54,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xeb,0xaa,0xac,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xeb,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xe6,0x2a,0xa8,0x8b,0xff,0xff,0xe0,0xaa,0xac,0x08,0x76,0x07,0x8b,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xf6,0x80,0x00,0xff,0xff,0xe5,0x55,0x54,0x78,0xff,0xff,0xeb,0x55,0x56,0x08,0xff,0x00,0x09,0x80,0x00,0xff,0xfe,0xaf,0x80,0x00,0x15,0xff,0xff,0xea,0xaa,0xbe,0x74,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xdc,0xaa,0x98,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe3,0xaa,0xaa,0xff,0x00,0x0b,0xaa,0xaa,0xff,0xff,0xea,0xaa,0xab,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xea,0xaa,0xab,0xff,0x00,0x17,0x55,0x56,0xff,0xff,0xf5,0x55,0x55,0xff,0x00,0x1d,0xff,0xff,0x8b,0xff,0x00,0x24,0xaa,0xab,0x08,0xa4,0x07,0x8b,0xff,0x00,0x24,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xab,0xff,0x00,0x1d,0xff,0xff,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x15,0x55,0x4f,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x1c,0x55,0x55,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x23,0x55,0x5c,0x8b,0xaf,0x8b,0xff,0x00,0x1c,0x80,0x00,0xff,0xff,0xf4,0x80,0x00,0xa0,0x74,0xa0,0x74,0xff,0x00,0x0a,0x80,0x00,0xff,0xff,0xe1,0xd5,0x55,0x8b,0xff,0xff,0xda,0xaa,0xab,0x08,0x72,0x07,0x8b,0xff,0xff,0xda,0xaa,0xab,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xe1,0xd5,0x55,0xff,0xff,0xea,0xaa,0xaa,0x74,0x08,0x0e,0x69,0xf7,0xc6,0xf7,0xc3,0x15,0xfb,0x28,0xfb,0xc3,0xd7,0x8b,0xf7,0x34,0xf7,0xd9,0x05,0xff,0x00,0x0d,0x55,0x56,0xa7,0xff,0x00,0x0a,0x2a,0xaa,0xff,0x00,0x19,0x55,0x56,0x92,0xff,0x00,0x16,0xaa,0xaa,0x92,0xff,0x00,0x16,0xaa,0x90,0xff,0x00,0x03,0x80,0x00,0xff,0x00,0x17,0xaa,0xaa,0x8b,0xff,0x00,0x18,0xaa,0xc6,0x08,0xad,0x07,0x8b,0xff,0x00,0x3b,0x55,0x54,0x7a,0xff,0x00,0x2f,0x2a,0xac,0x69,0xae,0x69,0xae,0xff,0xff,0xd2,0x55,0x56,0xff,0x00,0x11,0x80,0x00,0xff,0xff,0xc6,0xaa,0xaa,0x8b,0x67,0x8b,0xff,0xff,0xdf,0xd5,0x55,0xff,0xff,0xf8,0x2a,0xac,0xff,0xff,0xe3,0xaa,0xab,0xff,0xff,0xf0,0x55,0x54,0xff,0xff,0xe3,0xaa,0xac,0xff,0xff,0xf0,0x55,0x54,0xff,0xff,0xe9,0xaa,0xab,0xff,0xff,0xe9,0x80,0x00,0xff,0xff,0xef,0xaa,0xa9,0xff,0xff,0xe2,0xaa,0xac,0xff,0xff,0xef,0xaa,0xae,0xff,0xff,0xe2,0xaa,0xac,0xff,0xff,0xf7,0xd5,0x56,0x68,0xff,0xff,0xff,0xff,0xfc,0xff,0xff,0xd7,0x55,0x54,0x08,0x69,0x07,0x8b,0xff,0xff,0xc7,0x55,0x56,0xff,0x00,0x0f,0xd5,0x55,0xff,0xff,0xd2,0x80,0x00,0xff,0x00,0x1f,0xaa,0xab,0xff,0xff,0xdd,0xaa,0xaa,0xff,0x00,0x1f,0xaa,0xab,0xff,0xff,0xdd,0xaa,0xaa,0xff,0x00,0x29,0x80,0x00,0xff,0xff,0xee,0xd5,0x56,0xff,0x00,0x33,0x55,0x55,0x8b,0xff,0x00,0x0e,0xaa,0xab,0x8b,0xff,0x00,0x0e,0x2a,0xab,0x8d,0xff,0x00,0x0d,0xaa,0xaa,0x8f,0xff,0x00,0x0d,0xaa,0xaa,0x8f,0xff,0x00,0x0a,0xd5,0x56,0x90,0x93,0x91,0x08,0xff,0x00,0x18,0x80,0x00,0xff,0x00,0x4e,0x80,0x00,0x15,0xff,0xff,0xeb,0xaa,0xd0,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe4,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xdc,0xaa,0x86,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0x6f,0xff,0x00,0x0b,0x55,0x56,0xff,0xff,0xeb,0x55,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0xff,0xeb,0x55,0x55,0xff,0x00,0x16,0xaa,0x90,0xff,0xff,0xf5,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xaa,0x8b,0xff,0x00,0x26,0xaa,0xc6,0x08,0xad,0x07,0x8b,0xff,0x00,0x26,0xaa,0xac,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x1e,0xd5,0x54,0xff,0x00,0x14,0xaa,0xab,0xa2,0xff,0x00,0x14,0xaa,0xab,0xa2,0xa7,0xff,0x00,0x0b,0x80,0x00,0xff,0x00,0x23,0x55,0x55,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x1b,0xd5,0x54,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x14,0x55,0x56,0x74,0xff,0x00,0x14,0x55,0x56,0x74,0xff,0x00,0x0a,0x2a,0xaa,0xff,0xff,0xe0,0xd5,0x54,0x8b,0xff,0xff,0xd8,0xaa,0xac,0x08,0x69,0x07,0x8b,0xff,0xff,0xd9,0x55,0x56,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xe1,0x80,0x00,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0x08,0x0e,0xfb,0xe2,0xc0,0xe7,0x15,0x2f,0xe3,0xe7,0x07,0x33,0xf7,0xe6,0x15,0x2f,0xe3,0xe7,0x07,0x0e,0xfb,0xe2,0xc0,0xf8,0x42,0x15,0x2f,0xe3,0xe7,0x07,0x49,0xfb,0xe5,0x15,0x26,0x0a,0x0e,0x7b,0xc4,0xf7,0x8b,0x15,0xf8,0x22,0xfb,0x37,0x8b,0xd2,0xfb,0xc5,0xf7,0x0d,0xf7,0xc5,0xf7,0x0d,0x8b,0xd2,0xfc,0x22,0xfb,0x36,0x05,0x0e,0x7b,0xc4,0xf8,0x29,0x15,0x48,0xf8,0x22,0xce,0x07,0xfc,0x22,0xfb,0x54,0x15,0x49,0xf8,0x22,0xcd,0x07,0x0e,0x7b,0xc4,0xf7,0x2f,0x15,0x8b,0x44,0xf8,0x22,0xf7,0x37,0x8b,0xc6,0xfc,0x22,0xf7,0x36,0x8b,0x44,0xf7,0xc5,0xfb,0x0d,0x05,0x0e,0x28,0xf7,0x40,0xf7,0x81,0x15,0x50,0xd4,0xc5,0x07,0x8b,0xff,0x00,0x10,0xaa,0xab,0x8d,0xff,0x00,0x0d,0xff,0xff,0x8f,0xff,0x00,0x0b,0x55,0x56,0x8f,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x07,0xaa,0xaa,0xff,0x00,0x0d,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x56,0x9b,0x08,0xc4,0xdb,0x05,0x9d,0xff,0x00,0x19,0x55,0x56,0x98,0xff,0x00,0x16,0xaa,0xaa,0x93,0x9f,0x93,0x9f,0x8f,0xa1,0x8b,0xa3,0x8b,0xbd,0xff,0xff,0xf0,0xaa,0xaa,0xff,0x00,0x28,0x55,0x54,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x1e,0xaa,0xac,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x1e,0xaa,0xac,0xff,0xff,0xd6,0x55,0x54,0xff,0x00,0x0f,0x55,0x54,0xff,0xff,0xcb,0x55,0x56,0x8b,0xff,0xff,0xc8,0xaa,0xab,0x8b,0xff,0xff,0xd5,0xaa,0xab,0xff,0xff,0xf0,0xd5,0x54,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xf0,0xaa,0xab,0xff,0xff,0xd4,0xd5,0x54,0xff,0xff,0xfe,0xaa,0xab,0x53,0x08,0xd3,0x06,0xff,0x00,0x01,0x55,0x54,0xff,0x00,0x48,0xaa,0xac,0xac,0xff,0x00,0x24,0x55,0x54,0xff,0x00,0x40,0xaa,0xac,0x8b,0xab,0x8b,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xf7,0x2a,0xac,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xee,0x55,0x54,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xee,0x55,0x54,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xe7,0x2a,0xac,0x8b,0x6b,0x8b,0xff,0xff,0xed,0x55,0x54,0xff,0xff,0xfc,0xd5,0x56,0xff,0xff,0xee,0xd5,0x56,0xff,0xff,0xf9,0xaa,0xaa,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xf9,0xaa,0xaa,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xf3,0xd5,0x56,0xff,0xff,0xec,0x2a,0xaa,0x79,0x73,0x08,0x55,0x42,0x05,0xff,0xff,0xf0,0xaa,0xab,0xff,0xff,0xeb,0x55,0x56,0x81,0xff,0xff,0xee,0x2a,0xaa,0xff,0xff,0xfb,0x55,0x55,0x7c,0xff,0xff,0xfb,0x55,0x55,0x7c,0xff,0xff,0xfd,0xaa,0xab,0xff,0xff,0xec,0x80,0x00,0x8b,0x73,0x08,0x83,0xfb,0x24,0x15,0x2e,0xe4,0xe8,0x07,0x0e,0xf7,0xec,0xf7,0x84,0xff,0xff,0xaf,0x80,0x00,0x15,0xff,0x00,0x39,0x55,0x56,0xff,0xff,0xe0,0x55,0x56,0xff,0x00,0x41,0x55,0x54,0xff,0xff,0xf0,0x2a,0xaa,0xff,0x00,0x49,0x55,0x56,0x8b,0xbb,0x8b,0xff,0x00,0x2a,0xd5,0x54,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x25,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x25,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x24,0xd5,0x54,0x9a,0xaf,0xff,0x00,0x14,0xaa,0xaa,0x08,0x73,0xc4,0x05,0xff,0xff,0xdf,0x55,0x54,0xff,0xff,0xee,0xaa,0xab,0x6a,0xff,0xff,0xf3,0x2a,0xaa,0xff,0xff,0xde,0xaa,0xac,0xff,0xff,0xf7,0xaa,0xab,0xff,0xff,0xde,0xaa,0xac,0xff,0xff,0xf7,0xaa,0xab,0xff,0xff,0xd9,0x55,0x54,0xff,0xff,0xfb,0xd5,0x55,0x5f,0x8b,0xff,0xff,0xc1,0x55,0x56,0x8b,0xff,0xff,0xc9,0xaa,0xaa,0x98,0x5d,0xa5,0x5d,0xa5,0xff,0xff,0xdc,0xaa,0xab,0xff,0x00,0x24,0x80,0x00,0xff,0xff,0xe7,0x55,0x55,0xba,0xff,0xff,0xe7,0x55,0x55,0xba,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x36,0x2a,0xab,0x8b,0xff,0x00,0x3d,0x55,0x55,0x08,0xd2,0x07,0x8b,0xff,0x00,0x3d,0x55,0x56,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x35,0xd5,0x54,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x2e,0x55,0x34,0xff,0x00,0x23,0x80,0x00,0xff,0x00,0x23,0xd5,0x54,0xff,0x00,0x2e,0x55,0x55,0xff,0x00,0x19,0x55,0x78,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x19,0x55,0x54,0xff,0x00,0x36,0x2a,0xaa,0xff,0x00,0x0c,0xaa,0xac,0xc9,0x8b,0xff,0x00,0x3d,0xff,0xfe,0x8b,0xff,0x00,0x36,0x2a,0xaa,0xff,0xff,0xf3,0x55,0x54,0xff,0x00,0x2e,0x55,0x58,0xff,0xff,0xe6,0xaa,0xac,0xff,0x00,0x2e,0x55,0x54,0xff,0xff,0xe6,0xaa,0xac,0xff,0x00,0x23,0x80,0x00,0xff,0xff,0xdc,0x2a,0xa8,0xff,0x00,0x18,0xaa,0xac,0xff,0xff,0xd1,0xaa,0xac,0xff,0x00,0x18,0xaa,0xac,0xff,0xff,0xd1,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x54,0xff,0xff,0xc9,0xd5,0x56,0x8b,0x4d,0x08,0x48,0x07,0x8b,0xff,0xff,0xce,0xaa,0xab,0xff,0xff,0xf9,0x55,0x54,0xff,0xff,0xdc,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xac,0xff,0xff,0xea,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xec,0x55,0x54,0xff,0xff,0xf5,0x55,0x56,0x71,0x8b,0xff,0xff,0xeb,0x55,0x54,0x8b,0xff,0xff,0xef,0x2a,0xac,0xff,0x00,0x07,0x55,0x56,0x7e,0xff,0x00,0x0e,0xaa,0xaa,0x7e,0xff,0x00,0x0e,0xaa,0xab,0xff,0xff,0xf9,0x80,0x00,0xff,0x00,0x15,0xaa,0xaa,0x8b,0xff,0x00,0x1c,0xaa,0xab,0x08,0xf7,0xb5,0x4a,0x5e,0x07,0xff,0xff,0xf5,0x55,0xd4,0xff,0x00,0x11,0x55,0x56,0x7c,0xff,0x00,0x0d,0x80,0x00,0xff,0xff,0xec,0xaa,0x2c,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xec,0xaa,0xe4,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x04,0xd5,0x56,0xff,0xff,0xe6,0xaa,0x72,0x8b,0x59,0x8b,0x66,0xff,0xff,0xf0,0x2a,0xaa,0x73,0xff,0xff,0xe0,0x55,0x56,0x73,0xff,0xff,0xe0,0x55,0x56,0x7f,0xff,0xff,0xd3,0x2a,0xaa,0x8b,0x51,0x08,0x3b,0x07,0x8b,0xff,0xff,0xc6,0xaa,0xab,0x97,0xff,0xff,0xd3,0x80,0x00,0xa3,0xff,0xff,0xe0,0x55,0x55,0xa3,0xff,0xff,0xe0,0x55,0x56,0xff,0x00,0x25,0xaa,0xaa,0xff,0xff,0xf0,0x2a,0xaa,0xff,0x00,0x33,0x55,0x56,0x8b,0xab,0x8b,0xff,0x00,0x1a,0xd5,0x56,0x91,0xff,0x00,0x15,0xaa,0xaa,0x97,0xff,0x00,0x15,0xaa,0xac,0x97,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x11,0xaa,0xaa,0x95,0xff,0x00,0x17,0x55,0x56,0x95,0xff,0xff,0xe9,0x55,0x56,0x9a,0xff,0xff,0xee,0x80,0x00,0x9f,0xff,0xff,0xf3,0xaa,0xaa,0x9f,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xf9,0xd5,0x55,0xff,0x00,0x1b,0x55,0x54,0x8b,0x08,0xff,0x00,0x2c,0xaa,0xac,0x8b,0xff,0x00,0x24,0x55,0x54,0xff,0x00,0x10,0x55,0x55,0xa7,0xff,0x00,0x20,0xaa,0xab,0xa7,0xff,0x00,0x20,0xaa,0xab,0x99,0xff,0x00,0x30,0xff,0xff,0x8b,0xff,0x00,0x41,0x55,0x56,0x08,0xce,0x07,0x8b,0xd3,0x7b,0xff,0x00,0x40,0x2a,0xaa,0x6b,0xff,0x00,0x38,0x55,0x56,0x6b,0xff,0x00,0x38,0x55,0x0c,0xff,0xff,0xd3,0x55,0x54,0xff,0x00,0x2b,0xd5,0x54,0xff,0xff,0xc6,0xaa,0xac,0xff,0x00,0x1f,0x55,0xa0,0xff,0xff,0xc6,0xaa,0xac,0xff,0x00,0x1f,0x55,0x54,0xff,0xff,0xbe,0xff,0xfe,0xff,0x00,0x0f,0xaa,0xac,0xff,0xff,0xb7,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xaa,0x8b,0xff,0xff,0xbe,0xd5,0x56,0xff,0xff,0xf0,0x55,0x54,0x52,0xff,0xff,0xe0,0xaa,0xac,0x52,0xff,0xff,0xe0,0xaa,0xac,0xff,0xff,0xd3,0x80,0x00,0xff,0xff,0xd4,0x2a,0xa8,0x6b,0xff,0xff,0xc7,0xaa,0xac,0x6b,0xff,0xff,0xc7,0xaa,0xb8,0x7b,0xff,0xff,0xbf,0x2a,0xaa,0x8b,0xff,0xff,0xb6,0xaa,0x9e,0x08,0x47,0x07,0x8b,0x41,0xff,0x00,0x0f,0xd5,0x55,0xff,0xff,0xbe,0x80,0x00,0xff,0x00,0x1f,0xaa,0xab,0x52,0xff,0x00,0x1f,0xaa,0xab,0x52,0xff,0x00,0x2c,0x80,0x00,0xff,0xff,0xd3,0xaa,0xaa,0xff,0x00,0x39,0x55,0x55,0xff,0xff,0xe0,0x55,0x56,0x08,0xf7,0xb1,0xff,0x01,0x3d,0x80,0x00,0x15,0x39,0x6c,0x62,0x4d,0x1e,0xff,0xff,0xde,0xaa,0xaa,0x8b,0x73,0x96,0xff,0xff,0xf1,0x55,0x56,0xa1,0xff,0xff,0xf1,0x55,0x56,0xa1,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x1f,0xaa,0xab,0x8b,0xff,0x00,0x29,0x55,0x55,0x08,0xd5,0x07,0xff,0x00,0x53,0x55,0x56,0xff,0x00,0x1f,0x55,0x56,0xff,0x00,0x29,0xaa,0xaa,0xff,0x00,0x3e,0xaa,0xaa,0xc9,0xaa,0xff,0xff,0xd7,0x55,0x56,0xff,0xff,0xae,0xaa,0xaa,0x1e,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0x27,0x0a,0xf7,0xa4,0xc9,0x15,0x28,0x0a,0x0e,0xe1,0xff,0x02,0x06,0x80,0x00,0xf7,0xba,0x15,0xff,0xff,0xec,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0xff,0xff,0xe2,0xd5,0x54,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xd9,0x55,0x56,0x97,0xff,0x00,0x21,0x55,0x56,0xff,0x00,0x0a,0xaa,0xaa,0xa5,0xff,0x00,0x13,0x55,0x56,0xff,0x00,0x12,0xaa,0xaa,0xa7,0xff,0x00,0x12,0xaa,0xac,0xa7,0xff,0x00,0x09,0x55,0x54,0xff,0x00,0x1f,0xaa,0xaa,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xc5,0xff,0xff,0xee,0x2a,0xac,0xff,0x00,0x2c,0xd5,0x54,0xff,0xff,0xdc,0x55,0x54,0xff,0x00,0x1f,0xaa,0xac,0xff,0xff,0xdc,0x55,0x56,0xff,0x00,0x1f,0xaa,0xac,0xff,0xff,0xcd,0xd5,0x54,0xff,0x00,0x0f,0xd5,0x54,0xff,0xff,0xbf,0x55,0x56,0x8b,0x08,0xfb,0x91,0xfd,0x46,0xf7,0x97,0x06,0xff,0x00,0x40,0xaa,0xaa,0x8b,0xbe,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x25,0x55,0x56,0xff,0x00,0x21,0x55,0x55,0xff,0x00,0x25,0x55,0x54,0xff,0x00,0x21,0x55,0x54,0xff,0x00,0x12,0xaa,0xac,0xff,0x00,0x2e,0x55,0x55,0x8b,0xff,0x00,0x3b,0x55,0x57,0x8b,0xff,0x00,0x29,0x55,0x4e,0xff,0xff,0xf6,0x2a,0xac,0xae,0xff,0xff,0xec,0x55,0x54,0xff,0x00,0x1c,0xaa,0xb2,0x08,0xff,0xfe,0x92,0x80,0x00,0xf7,0xdf,0x15,0xf7,0x41,0x06,0xb7,0x8b,0xad,0xff,0xff,0xf5,0xd5,0x54,0xa3,0xff,0xff,0xeb,0xaa,0xac,0xa3,0xff,0xff,0xeb,0xaa,0xac,0x97,0xff,0xff,0xe1,0xd5,0x54,0x8b,0x63,0x8b,0x63,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xe2,0x2a,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xec,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xec,0x55,0x56,0x69,0xff,0xff,0xf6,0x2a,0xaa,0xff,0xff,0xd4,0xaa,0xaa,0x8b,0x08,0xfb,0x40,0x06,0xf7,0xb0,0xfb,0xb3,0x15,0xff,0xff,0xe6,0xaa,0xaa,0x75,0xff,0xff,0xdc,0x55,0x56,0x80,0x5d,0x8b,0x08,0xfb,0x45,0xf7,0x93,0xf7,0x46,0x06,0xb9,0x8b,0xff,0x00,0x23,0x80,0x00,0xff,0xff,0xf5,0x55,0x56,0xa4,0xff,0xff,0xea,0xaa,0xaa,0xa4,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x0c,0x80,0x00,0xff,0xff,0xe0,0xaa,0xab,0x8b,0xff,0xff,0xd6,0xaa,0xab,0x8b,0x61,0xff,0xff,0xf3,0x55,0x56,0x6b,0xff,0xff,0xe6,0xaa,0xaa,0x75,0x08,0x0e,0xf7,0x18,0xff,0x00,0x37,0x80,0x00,0x15,0xb7,0xff,0xff,0xd5,0xaa,0xab,0xc6,0xff,0xff,0xea,0xd5,0x55,0xd5,0x8b,0xff,0x00,0x47,0x55,0x56,0x8b,0xff,0x00,0x38,0xaa,0xaa,0x9e,0xb5,0xb1,0xb5,0xff,0x00,0x25,0xff,0xfe,0xa0,0xff,0x00,0x33,0x55,0x56,0x8b,0xff,0x00,0x40,0xaa,0xac,0x08,0x8f,0x44,0x87,0x07,0x8b,0xff,0xff,0xd3,0x55,0x55,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xdc,0xd5,0x55,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xd8,0xaa,0xaa,0xff,0xff,0xf3,0x2a,0xaa,0x59,0x8b,0x08,0xfb,0x06,0x52,0xff,0x00,0x40,0x55,0x55,0xff,0x00,0x80,0xaa,0xab,0x1f,0xf7,0x48,0x07,0x8b,0xff,0x00,0x47,0x55,0x56,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x33,0x55,0x56,0xa8,0xff,0x00,0x1f,0x55,0x54,0xa8,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2a,0x2a,0xab,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x37,0x55,0x55,0x8b,0xbd,0x8b,0xff,0x00,0x27,0x80,0x00,0x7e,0xa8,0x71,0xa8,0x71,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xdc,0xaa,0xac,0x8b,0xff,0xff,0xd3,0x55,0x54,0x08,0x88,0xd4,0x8e,0x07,0x8b,0xb5,0xff,0xff,0xf6,0x55,0x54,0xb0,0xff,0xff,0xec,0xaa,0xac,0xab,0xff,0xff,0xec,0xaa,0xaa,0xab,0xff,0xff,0xe4,0x80,0x00,0xff,0x00,0x18,0xaa,0xac,0xff,0xff,0xdc,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xdc,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xd6,0xd5,0x54,0xff,0x00,0x08,0xaa,0xac,0xff,0xff,0xd1,0x55,0x56,0x8b,0x41,0x8b,0x50,0xff,0xff,0xea,0xd5,0x54,0x5f,0xff,0xff,0xd5,0xaa,0xac,0x5f,0xff,0xff,0xd5,0xaa,0xac,0x75,0xff,0xff,0xbd,0x2a,0xa8,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0xff,0xff,0xa4,0xaa,0xaa,0xa1,0xff,0xff,0xbd,0x2a,0xaa,0xb7,0xff,0xff,0xd5,0xaa,0xac,0x08,0x0e,0xe8,0xdb,0xf9,0x46,0x15,0xfd,0x46,0xf7,0x80,0x07,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x3a,0x2a,0xaa,0xff,0x00,0x15,0x2a,0xab,0xb6,0xff,0x00,0x2a,0x55,0x55,0xb6,0xff,0x00,0x2a,0x55,0x55,0xff,0x00,0x15,0x80,0x00,0xff,0x00,0x42,0xd5,0x55,0x8b,0xff,0x00,0x5b,0x55,0x56,0x08,0xf7,0x36,0x07,0x8b,0xff,0x00,0x5b,0x55,0x34,0xff,0xff,0xea,0x80,0x00,0xff,0x00,0x42,0xd5,0x54,0x60,0xff,0x00,0x2a,0x55,0x78,0x60,0xff,0x00,0x2a,0x55,0x54,0xff,0xff,0xc5,0xd5,0x56,0xff,0x00,0x15,0x2a,0xac,0xff,0xff,0xb6,0xaa,0xaa,0x8b,0x08,0x8c,0xfd,0x04,0x15,0xfb,0x37,0xf8,0xc2,0xf7,0x37,0x06,0xff,0x00,0x34,0xaa,0xaa,0x8b,0xff,0x00,0x28,0x80,0x00,0x7b,0xff,0x00,0x1c,0x55,0x56,0x6b,0xff,0x00,0x1c,0x55,0x56,0x6b,0xff,0x00,0x0e,0x2a,0xaa,0x58,0x8b,0x45,0x08,0xfb,0x37,0x07,0xff,0xff,0x7e,0xaa,0xab,0xff,0xff,0xc9,0x55,0x56,0xff,0xff,0xbf,0x55,0x55,0xff,0xff,0x92,0xaa,0xaa,0x1e,0x0e,0x9e,0xf7,0x2d,0xf9,0x04,0x15,0x29,0x0a,0x0e,0x96,0xf7,0x2d,0xf9,0x04,0x15,0xf7,0xee,0xcd,0xfc,0x37,0xfd,0x46,0xd4,0xf7,0xd0,0xf7,0xbc,0xcd,0xfb,0xbc,0x06,0x0e,0xff,0x00,0x83,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0xff,0x00,0x2b,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xab,0xff,0x00,0x3a,0x7f,0xff,0xff,0xff,0xea,0xd5,0x55,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x48,0xaa,0x9e,0x8b,0xff,0x00,0x39,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0x00,0x2a,0xaa,0xb8,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x2a,0xaa,0xac,0xff,0x00,0x29,0x55,0x53,0xff,0x00,0x15,0x55,0x54,0xcd,0x8b,0xff,0x00,0x5a,0xaa,0xad,0x08,0xf2,0xfb,0x82,0x4c,0xf7,0x39,0x56,0x07,0x8b,0xff,0xff,0xc1,0x55,0x58,0xff,0xff,0xf2,0x2a,0xaa,0xff,0xff,0xd2,0x55,0x55,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xe3,0x55,0x53,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xd7,0xd5,0x54,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xcb,0x55,0x56,0x8b,0xff,0xff,0x8e,0xaa,0xad,0x8b,0xff,0xff,0xc7,0x55,0x55,0xff,0x00,0x40,0x55,0x55,0xff,0xff,0xff,0xff,0xfe,0xff,0x00,0x80,0xaa,0xab,0x08,0xf7,0x48,0x07,0x8b,0xff,0x00,0x46,0xaa,0xaa,0xff,0x00,0x0e,0x55,0x55,0xff,0x00,0x33,0x2a,0xaa,0xff,0x00,0x1c,0xaa,0xab,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x1c,0xaa,0xab,0xff,0x00,0x1f,0xaa,0xac,0xb5,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x37,0x55,0x55,0x8b,0xff,0x00,0x31,0x55,0x56,0x8b,0xff,0x00,0x27,0x2a,0xaa,0xff,0xff,0xf3,0x2a,0xac,0xa8,0xff,0xff,0xe6,0x55,0x54,0xa8,0xff,0xff,0xe6,0x55,0x54,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xdd,0x2a,0xac,0x8b,0x5f,0x08,0x87,0xd4,0x8f,0x07,0x8b,0xff,0x00,0x29,0x55,0x54,0xff,0xff,0xf6,0x55,0x54,0xff,0x00,0x24,0x80,0x00,0xff,0xff,0xec,0xaa,0xac,0xff,0x00,0x1f,0xaa,0xac,0xff,0xff,0xec,0xaa,0xba,0xff,0x00,0x1f,0xaa,0xac,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x18,0x80,0x00,0xff,0xff,0xdc,0xaa,0x9c,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xdc,0xaa,0xc2,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xd6,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xac,0xff,0xff,0xd0,0xaa,0x94,0x8b,0xff,0xff,0xb6,0xaa,0xae,0x8b,0xff,0xff,0xc5,0x80,0x00,0xff,0xff,0xea,0xd5,0x54,0xff,0xff,0xd4,0x55,0x52,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xd4,0x55,0x58,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xea,0x2a,0xaa,0xff,0xff,0xbd,0x2a,0xa8,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0xff,0xff,0xa4,0xaa,0xaa,0xff,0x00,0x15,0xd5,0x55,0xff,0xff,0xbd,0x2a,0xaa,0xff,0x00,0x2b,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0x08,0x0e,0xf0,0xf8,0xb9,0xf9,0x46,0x15,0x42,0xfb,0xc4,0xfb,0xd7,0xf7,0xc4,0x42,0xfd,0x46,0xd4,0xf7,0xd4,0xf7,0xd7,0xfb,0xd4,0xd4,0x06,0x0e,0xfb,0xab,0xe3,0xf9,0x46,0x15,0x2a,0x0a,0x0e,0xfb,0x6b,0xab,0xcd,0x15,0x49,0xcf,0x07,0xff,0x00,0x28,0xaa,0xab,0x8b,0xaa,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xab,0xac,0x8b,0xff,0x00,0x2b,0x55,0x56,0x08,0xf8,0xc1,0x42,0xfc,0xb8,0x07,0x8b,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xfb,0x2a,0xab,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x55,0x7f,0xff,0xff,0xf6,0x55,0x56,0x7f,0xff,0xff,0xef,0xd5,0x54,0x85,0xff,0xff,0xe9,0x55,0x56,0x8b,0x08,0x0e,0xd1,0xf7,0xba,0xf8,0x00,0x15,0xf7,0x67,0xfc,0x00,0xe0,0x8b,0xfb,0x8d,0xf8,0x39,0xf7,0x6e,0xf7,0xa1,0x34,0x8b,0xfb,0xd3,0xfc,0x26,0x8b,0xf8,0x26,0x42,0x8b,0x8b,0xfd,0x46,0xd4,0x8b,0x8b,0xf7,0x52,0x05,0x0e,0x8c,0xdb,0xf9,0x46,0x15,0xfd,0x46,0xf8,0x35,0xcd,0xfb,0xec,0xf9,0x04,0x07,0x0e,0xf7,0x75,0xf9,0x35,0xf9,0x46,0x15,0x42,0x8b,0xfb,0x73,0xfc,0x65,0xfb,0x74,0xf8,0x65,0x42,0x8b,0x8b,0xfd,0x46,0xd4,0x8b,0x8b,0xf8,0xb0,0xf7,0x58,0xfc,0x26,0xc3,0x8b,0xf7,0x57,0xf8,0x26,0x8b,0xfc,0xb0,0xd4,0x8b,0x05,0x0e,0xf7,0x1b,0xf8,0xdb,0xf9,0x46,0x15,0x2b,0x0a,0x0e,0xff,0x00,0x82,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0x2c,0x0a,0xff,0x01,0x54,0x80,0x00,0xff,0x00,0xc4,0x80,0x00,0x15,0x2d,0x0a,0x0e,0xbc,0xf8,0x7b,0xff,0x02,0x7c,0x80,0x00,0x15,0xff,0xff,0xd9,0x55,0x56,0xff,0x00,0x23,0xaa,0xac,0x56,0xff,0x00,0x11,0xd5,0x54,0xff,0xff,0xbc,0xaa,0xaa,0x8b,0x08,0xfb,0x8c,0xfd,0x46,0xd4,0xf7,0xb1,0xf7,0x43,0x06,0xff,0x00,0x42,0xaa,0xaa,0x8b,0xff,0x00,0x34,0xd5,0x56,0xff,0x00,0x11,0xaa,0xaa,0xb2,0xff,0x00,0x23,0x55,0x56,0xb2,0xff,0x00,0x23,0x55,0x56,0xff,0x00,0x13,0x80,0x00,0xff,0x00,0x30,0xaa,0xaa,0x8b,0xc9,0x8b,0xcd,0xff,0xff,0xec,0xaa,0xac,0xff,0x00,0x32,0xd5,0x54,0xff,0xff,0xd9,0x55,0x54,0xff,0x00,0x23,0xaa,0xac,0x08,0x55,0xff,0xff,0x03,0x80,0x00,0x15,0x71,0x75,0x66,0x80,0x5b,0x8b,0x08,0xfb,0x3d,0xf7,0xa5,0xf7,0x3d,0x06,0xbb,0x8b,0xb0,0xff,0xff,0xf4,0x80,0x00,0xa5,0x74,0xa5,0x74,0x98,0xff,0xff,0xdc,0xd5,0x54,0x8b,0xff,0xff,0xd0,0xaa,0xac,0x8b,0xff,0xff,0xd3,0x55,0x56,0x7e,0xff,0xff,0xde,0xaa,0xaa,0x71,0x75,0x08,0x0e,0xf8,0x44,0x9f,0x15,0xff,0x00,0x4a,0xaa,0xaa,0xff,0x00,0x27,0x55,0x56,0xff,0x00,0x25,0x55,0x56,0xff,0x00,0x4e,0xaa,0xaa,0x8b,0xf7,0x0a,0x08,0xf7,0x47,0x07,0x8b,0xff,0x00,0x5b,0x55,0x34,0xff,0xff,0xea,0x80,0x00,0xff,0x00,0x42,0xd5,0x54,0x60,0xff,0x00,0x2a,0x55,0x78,0x60,0xff,0x00,0x2a,0x55,0x54,0xff,0xff,0xc6,0x2a,0xaa,0xff,0x00,0x15,0x2a,0xac,0xff,0xff,0xb7,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xaa,0x8b,0xff,0xff,0xc5,0xaa,0xab,0xff,0xff,0xea,0xd5,0x54,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xbd,0x2a,0xa8,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0xff,0xff,0xa4,0xaa,0xaa,0xff,0x00,0x15,0x80,0x00,0xff,0xff,0xbd,0x2a,0xaa,0xb6,0xff,0xff,0xd5,0xaa,0xac,0xb6,0xff,0xff,0xd5,0xaa,0xab,0xff,0x00,0x3a,0x2a,0xaa,0xff,0xff,0xea,0xd5,0x55,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x16,0xaa,0xaa,0x8b,0xff,0x00,0x15,0x55,0x56,0x8d,0x9f,0x8f,0x08,0xdc,0xfb,0x29,0xc4,0xab,0x05,0x67,0xf8,0xbb,0x15,0xfb,0x48,0x07,0xff,0xff,0x7f,0x55,0x55,0x54,0xff,0xff,0xbf,0xaa,0xab,0xfb,0x02,0x1e,0xff,0xff,0xc9,0x55,0x55,0x8b,0xff,0xff,0xd6,0x80,0x00,0xff,0x00,0x0f,0x55,0x55,0xff,0xff,0xe3,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xab,0xff,0xff,0xe3,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xab,0xff,0xff,0xf1,0xd5,0x55,0xff,0x00,0x30,0xff,0xff,0x8b,0xff,0x00,0x43,0x55,0x56,0x08,0xf7,0x48,0x07,0x8b,0xff,0x00,0x46,0xaa,0xaa,0x99,0xff,0x00,0x33,0x2a,0xaa,0xa7,0xff,0x00,0x1f,0xaa,0xac,0xa7,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x29,0xaa,0xab,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x37,0x55,0x55,0x8b,0x08,0xf7,0x02,0xc2,0x48,0xfb,0x1a,0x1f,0x0e,0xd2,0xf7,0xd3,0xf7,0xc3,0x15,0xf7,0x30,0xfb,0xc3,0xdf,0x8b,0xfb,0x37,0xf7,0xca,0x05,0xff,0x00,0x2e,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x24,0x55,0x56,0xff,0x00,0x15,0x55,0x56,0xa5,0xab,0xa5,0xab,0x98,0xff,0x00,0x28,0xaa,0xaa,0x8b,0xff,0x00,0x31,0x55,0x56,0x8b,0xc9,0xff,0xff,0xed,0x80,0x00,0xff,0x00,0x2f,0xd5,0x54,0x66,0xff,0x00,0x21,0xaa,0xac,0x66,0xff,0x00,0x21,0xaa,0xac,0xff,0xff,0xcd,0x2a,0xaa,0xff,0x00,0x10,0xd5,0x54,0xff,0xff,0xbf,0x55,0x56,0x8b,0x08,0xfb,0x94,0xfd,0x46,0xd4,0xf7,0xc3,0x06,0xca,0x04,0xf7,0x96,0xf7,0x45,0x07,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x22,0xd5,0x54,0xff,0xff,0xf5,0x2a,0xac,0xff,0x00,0x18,0x55,0x56,0xff,0xff,0xea,0x55,0x54,0xff,0x00,0x18,0x55,0x56,0xff,0xff,0xea,0x55,0x9c,0xff,0x00,0x0c,0x2a,0xaa,0xff,0xff,0xdf,0xd5,0x54,0x8b,0xff,0xff,0xd5,0x55,0x10,0x8b,0xff,0xff,0xd6,0xaa,0xc6,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xe0,0x2a,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xe9,0xaa,0x90,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xdd,0x55,0x54,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xd3,0x55,0x56,0x8b,0x08,0x0e,0x9d,0xf0,0xb8,0x15,0x2e,0x0a,0x0e,0x5d,0xf8,0x6e,0xf9,0x04,0x15,0xcd,0xfc,0x66,0x49,0xf7,0x59,0xfd,0x04,0xd3,0xf9,0x04,0x07,0x0e,0xf6,0xf7,0x58,0xa2,0x15,0x2f,0x0a,0x0e,0x86,0x92,0xf9,0x46,0x15,0xf7,0x74,0xfd,0x46,0xc7,0x8b,0xf7,0x75,0xf9,0x46,0x3f,0x8b,0xfb,0x46,0xfc,0xd0,0xfb,0x47,0xf8,0xd0,0x05,0x0e,0xf7,0xa0,0xf9,0xa9,0xf9,0x46,0x15,0x47,0x8b,0xfb,0x1b,0xfc,0xd0,0xfb,0x20,0xf8,0xd0,0x2e,0x8b,0xfb,0x1b,0xfc,0xd0,0xfb,0x20,0xf8,0xd0,0x44,0x8b,0xf7,0x45,0xfd,0x46,0xcc,0x8b,0xf7,0x29,0xf8,0xeb,0xf7,0x2d,0xfc,0xeb,0xcc,0x8b,0x05,0x0e,0xb1,0xf7,0x83,0xf7,0xfb,0x15,0xfb,0x7c,0xfb,0xfb,0xe0,0x8b,0xf7,0x51,0xf7,0xc1,0xf7,0x52,0xfb,0xc1,0xe3,0x8b,0xfb,0x7d,0xf7,0xfe,0xf7,0x67,0xf7,0xdc,0x36,0x8b,0xfb,0x3d,0xfb,0xa3,0xfb,0x3d,0xf7,0xa3,0x33,0x8b,0x05,0x0e,0x6e,0xf7,0xb2,0xf7,0xb5,0x15,0x30,0x0a,0x0e,0x7f,0xf8,0x74,0xcd,0x15,0x31,0x0a,0x0e,0xfb,0x7d,0xdb,0xf9,0x78,0x15,0xfd,0xcc,0xf7,0x30,0xcd,0x35,0xf9,0x48,0xe1,0xcd,0x07,0x0e,0xfb,0x1c,0xc6,0xf9,0x46,0x15,0xf7,0x6a,0xfd,0x50,0xc7,0x8b,0xfb,0x6a,0xf9,0x50,0x05,0x0e,0xfb,0x7d,0xc6,0x79,0x15,0x49,0xf7,0x30,0xf9,0xcc,0xfb,0x30,0x49,0xe1,0xfd,0x48,0x07,0x0e,0x7b,0xf7,0x77,0xf9,0x46,0x15,0xfb,0x41,0xfc,0x29,0xc7,0x8b,0xf7,0x22,0xf7,0xe9,0xf7,0x23,0xfb,0xe9,0xc7,0x8b,0xfb,0x41,0xf8,0x29,0x05,0x0e,0x44,0x55,0x04,0x59,0xf8,0x5d,0xbd,0x07,0x0e,0x6f,0xf7,0x28,0xf9,0x4d,0x15,0x32,0x0a,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0x0e,0x79,0xf7,0x23,0xce,0x15,0xa7,0xff,0xff,0xcf,0x55,0x55,0xff,0x00,0x2d,0xaa,0xab,0xff,0xff,0xe7,0xaa,0xab,0xff,0x00,0x3f,0x55,0x55,0x8b,0xbd,0x8b,0xb4,0xff,0x00,0x10,0xd5,0x55,0xab,0xff,0x00,0x21,0xaa,0xab,0xab,0xff,0x00,0x21,0xaa,0xab,0x9b,0xff,0x00,0x34,0x7f,0xff,0x8b,0xff,0x00,0x47,0x55,0x56,0x08,0xf3,0x07,0x8b,0xff,0x00,0x47,0x55,0x56,0xff,0xff,0xef,0xaa,0xaa,0xff,0x00,0x34,0x80,0x00,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x21,0xaa,0xaa,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x21,0xaa,0xaa,0xff,0xff,0xd5,0xaa,0xaa,0xff,0x00,0x10,0xd5,0x56,0x57,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xe6,0x2a,0xaa,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xe9,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xe6,0xff,0xff,0xed,0xd5,0x55,0xff,0xff,0xec,0xaa,0xaa,0x7d,0xff,0xff,0xe6,0xaa,0x70,0x08,0xf7,0x92,0x47,0xfd,0x46,0xcf,0x07,0xf7,0x84,0xf7,0x62,0x15,0x35,0x0a,0x0e,0x72,0xff,0x00,0x70,0x80,0x00,0xff,0x00,0x2b,0x80,0x00,0x15,0xff,0x00,0x23,0xaa,0xab,0x6a,0xff,0x00,0x30,0x2a,0xaa,0xff,0xff,0xef,0x80,0x00,0xff,0x00,0x3c,0xaa,0xab,0x8b,0xff,0x00,0x38,0xaa,0xaa,0x8b,0xff,0x00,0x2d,0x55,0x56,0xff,0x00,0x0f,0x55,0x55,0xad,0xff,0x00,0x1e,0xaa,0xab,0xad,0xff,0x00,0x1e,0xaa,0xaa,0x9c,0xb4,0x8b,0xff,0x00,0x33,0x55,0x56,0x08,0x8f,0x49,0x86,0x07,0x8b,0x69,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xea,0xaa,0xbe,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xf6,0xaa,0xaa,0xff,0xff,0xda,0xaa,0x98,0x8b,0xff,0xff,0xd6,0xaa,0xab,0x8b,0xff,0xff,0xdf,0xd5,0x55,0xff,0x00,0x0b,0x2a,0xaa,0x74,0xff,0x00,0x16,0x55,0x56,0x74,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x27,0x2a,0xaa,0x8b,0xc3,0x08,0xeb,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x17,0x55,0x4f,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x20,0x55,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x29,0x55,0x5c,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xa8,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xe5,0xaa,0xaa,0x8b,0x69,0x08,0x86,0xcd,0x90,0x07,0x8b,0xff,0x00,0x33,0x55,0x56,0xff,0xff,0xef,0x2a,0xaa,0xb4,0xff,0xff,0xde,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xde,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xd2,0x2a,0xaa,0xff,0x00,0x0f,0x55,0x56,0x51,0x8b,0x4f,0x8b,0xff,0xff,0xd0,0x2a,0xab,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xdc,0x55,0x55,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xdc,0x55,0x54,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xee,0x2a,0xab,0xff,0xff,0xcb,0x55,0x56,0xff,0x00,0x00,0x00,0x01,0x43,0x08,0x23,0x07,0x8b,0xff,0xff,0xb7,0x55,0x56,0xff,0x00,0x11,0xd5,0x55,0xff,0xff,0xcb,0x2a,0xaa,0xff,0x00,0x23,0xaa,0xab,0x6a,0x08,0x0e,0x7a,0xf6,0xff,0x00,0x2c,0x80,0x00,0x15,0xab,0xff,0xff,0xde,0x55,0x56,0xb4,0xff,0xff,0xef,0x2a,0xaa,0xbd,0x8b,0xab,0x8b,0xff,0x00,0x1b,0x80,0x00,0xff,0x00,0x06,0x2a,0xab,0xa2,0xff,0x00,0x0c,0x55,0x55,0xa2,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x12,0x2a,0xaa,0xff,0x00,0x12,0x2a,0xab,0xff,0x00,0x0d,0x55,0x56,0xa3,0x08,0x48,0xd0,0xf9,0x46,0x46,0xfb,0x92,0x07,0xff,0xff,0xe2,0xaa,0xb0,0xbf,0xff,0xff,0xd2,0xaa,0xaa,0xa5,0xff,0xff,0xc2,0xaa,0xa6,0x8b,0xff,0xff,0xcd,0x55,0x55,0x8b,0xff,0xff,0xd6,0xaa,0xab,0xff,0xff,0xef,0x2a,0xaa,0x6b,0xff,0xff,0xde,0x55,0x56,0x6b,0xff,0xff,0xde,0x55,0x56,0x7b,0xff,0xff,0xcb,0x80,0x00,0x8b,0xff,0xff,0xb8,0xaa,0xaa,0x08,0x23,0x07,0x8b,0xff,0xff,0xb8,0xaa,0xad,0x9b,0xff,0xff,0xcb,0x80,0x00,0xab,0xff,0xff,0xde,0x55,0x53,0x08,0xf7,0x78,0xff,0x00,0x34,0x80,0x00,0x15,0xff,0xff,0xea,0xaa,0xaa,0x6f,0xff,0xff,0xe0,0x55,0x56,0x7d,0x61,0x8b,0x08,0xff,0xff,0xb5,0x55,0x56,0xff,0xff,0xda,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x64,0xaa,0xaa,0x1f,0xeb,0x07,0xef,0xff,0x00,0x26,0xaa,0xaa,0xbd,0xff,0x00,0x4d,0x55,0x56,0x1e,0xff,0x00,0x28,0xaa,0x98,0x8b,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf1,0xd5,0x56,0xff,0x00,0x14,0xaa,0xbe,0xff,0xff,0xe3,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xc2,0xff,0x00,0x0a,0x55,0x56,0xff,0xff,0xda,0x2a,0xaa,0x8b,0xff,0xff,0xd0,0xaa,0x94,0x08,0x32,0x07,0x8b,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xea,0xaa,0xaa,0x6f,0x08,0x0e,0x72,0xf7,0x13,0xf7,0x84,0x15,0x36,0x0a,0xad,0xff,0x00,0xd0,0x80,0x00,0x15,0x37,0x0a,0x0e,0xfb,0x5d,0xf7,0x4b,0xf8,0xcb,0x15,0x38,0x0a,0x0e,0x7a,0xff,0x00,0x78,0x80,0x00,0xfb,0x0e,0x15,0xff,0x00,0x1f,0xaa,0xab,0x73,0xff,0x00,0x2a,0x80,0x00,0x7f,0xff,0x00,0x35,0x55,0x55,0x8b,0xff,0x00,0x3b,0x55,0x56,0x8b,0xff,0x00,0x2e,0x2a,0xaa,0xff,0x00,0x11,0xaa,0xab,0xac,0xff,0x00,0x23,0x55,0x55,0xac,0xff,0x00,0x23,0x55,0x55,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x30,0x55,0x55,0x8b,0xff,0x00,0x3d,0x55,0x56,0x08,0xf8,0x6b,0x46,0x44,0x07,0xff,0xff,0xe3,0x55,0x56,0xff,0x00,0x33,0x55,0x56,0xff,0xff,0xd2,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xaa,0x4d,0x8b,0xff,0xff,0xcd,0x55,0x55,0x8b,0xff,0xff,0xd6,0xaa,0xab,0xff,0xff,0xef,0x55,0x56,0x6b,0xff,0xff,0xde,0xaa,0xaa,0x6b,0xff,0xff,0xde,0xaa,0xb8,0x7b,0xff,0xff,0xcb,0xaa,0xaa,0x8b,0xff,0xff,0xb8,0xaa,0x9e,0x08,0x45,0x07,0x8b,0x43,0x9b,0xff,0xff,0xcb,0x2a,0xaa,0xab,0xff,0xff,0xde,0x55,0x56,0xab,0xff,0xff,0xde,0x55,0x55,0xb4,0xff,0xff,0xef,0x2a,0xab,0xbd,0x8b,0xab,0x8b,0xff,0x00,0x1b,0x80,0x00,0xff,0x00,0x06,0x55,0x55,0xa2,0xff,0x00,0x0c,0xaa,0xab,0xa2,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x12,0x2a,0xaa,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x0d,0x55,0x56,0xa3,0x08,0x44,0x07,0xff,0xff,0xa7,0x55,0x56,0xff,0xff,0xd8,0x55,0x56,0xff,0xff,0xd3,0xaa,0xaa,0xff,0xff,0xb0,0xaa,0xaa,0x1e,0x6b,0x8b,0xff,0xff,0xe6,0x2a,0xab,0xff,0x00,0x06,0xd5,0x56,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x0d,0xaa,0xaa,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x0d,0xaa,0xac,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x11,0xd5,0x55,0xff,0xff,0xfc,0xaa,0xab,0xff,0x00,0x15,0xff,0xff,0x08,0x47,0x06,0xff,0x00,0x03,0x55,0x56,0xff,0xff,0xd7,0x55,0x54,0xff,0x00,0x11,0x80,0x00,0xff,0xff,0xdf,0xaa,0xaa,0xff,0x00,0x1f,0xaa,0xaa,0xff,0xff,0xe8,0x00,0x02,0x08,0xff,0x00,0xd6,0x80,0x00,0xf7,0x95,0x15,0xff,0xff,0xea,0xaa,0xaa,0x6f,0xff,0xff,0xe0,0x55,0x56,0x7d,0x61,0x8b,0xff,0xff,0xb5,0x55,0x56,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xda,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0x8b,0xff,0x00,0x64,0xaa,0xac,0x08,0xc8,0x07,0xff,0x00,0x64,0xaa,0xaa,0xff,0x00,0x26,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x4d,0x55,0x56,0x1e,0xff,0x00,0x28,0xaa,0x98,0x8b,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf1,0xd5,0x56,0xff,0x00,0x14,0xaa,0xbe,0xff,0xff,0xe3,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xc2,0xff,0x00,0x0a,0x55,0x56,0xff,0xff,0xda,0x2a,0xaa,0x8b,0xff,0xff,0xd0,0xaa,0x94,0x08,0x54,0x07,0x8b,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xea,0xaa,0xaa,0x6f,0x08,0x0e,0x85,0xd6,0xf9,0x46,0x15,0xfd,0x46,0xcf,0xf7,0xd7,0x07,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x1f,0xd5,0x54,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1c,0xd5,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xaf,0x8b,0xff,0x00,0x24,0xaa,0x84,0x8b,0xff,0x00,0x1c,0xaa,0xaa,0x80,0xff,0x00,0x14,0xaa,0xd2,0x75,0xff,0x00,0x14,0xaa,0xaa,0x75,0xff,0x00,0x0a,0x55,0x56,0x6b,0x8b,0x61,0x08,0xfb,0xd7,0xcf,0xf7,0xe1,0x07,0x8b,0xff,0x00,0x39,0x55,0x56,0xff,0xff,0xf1,0x2a,0xaa,0xff,0x00,0x2c,0x55,0x54,0xff,0xff,0xe2,0x55,0x56,0xff,0x00,0x1f,0x55,0x56,0xff,0xff,0xe2,0x55,0x56,0xff,0x00,0x1f,0x55,0x56,0xff,0xff,0xd6,0xd5,0x54,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xcb,0x55,0x56,0x8b,0x4f,0x8b,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xe1,0x55,0x55,0xff,0xff,0xd2,0xaa,0xaa,0x08,0xf7,0x89,0x07,0x0e,0xfb,0xba,0xde,0xf8,0x8f,0x15,0x39,0x0a,0x45,0xf7,0x41,0x15,0x31,0xd3,0xe5,0x07,0x0e,0xfb,0xc2,0xd3,0xf9,0x46,0x15,0x31,0xd3,0xe5,0x07,0xfb,0x42,0xfd,0xa0,0x15,0x4d,0xbb,0x07,0xff,0x00,0x28,0xaa,0xab,0x8b,0xff,0x00,0x1e,0xff,0xff,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xab,0xac,0x8b,0xff,0x00,0x2b,0x55,0x56,0x08,0xf8,0xa2,0x47,0xfc,0x9e,0x07,0x8b,0x71,0x86,0x78,0x81,0x7f,0x81,0x7f,0xff,0xff,0xef,0xaa,0xaa,0x85,0xff,0xff,0xe9,0x55,0x56,0x8b,0x08,0x0e,0x69,0xf7,0x82,0xf7,0x9b,0x15,0xf7,0x2e,0xfb,0x9b,0xde,0x8b,0xfb,0x54,0xf7,0xcf,0xf7,0x37,0xf7,0x54,0x39,0x8b,0xfb,0x71,0xfb,0xa2,0x8b,0xf8,0x59,0x47,0x8b,0x8b,0xfd,0x46,0xcf,0x8b,0x8b,0xf7,0x2b,0x05,0x0e,0xfb,0x93,0xf6,0xad,0x15,0xff,0x00,0x15,0x55,0x55,0xff,0xff,0xe9,0x55,0x55,0xaa,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x28,0xaa,0xab,0x8b,0x08,0xbb,0xc9,0x62,0x06,0xff,0xff,0xe9,0x55,0x55,0x8b,0xff,0xff,0xef,0xaa,0xab,0x91,0x81,0x97,0x81,0x97,0x86,0x9e,0x8b,0xa5,0x08,0xf8,0xbd,0x47,0xfc,0xc1,0x07,0x8b,0xff,0xff,0xd4,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xde,0xff,0xff,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xe9,0x55,0x56,0x08,0x0e,0xf7,0xbd,0xd6,0xf8,0x8f,0x15,0xfc,0x8f,0xcf,0xf7,0xd7,0x07,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x1f,0xd5,0x54,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1c,0xd5,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xaf,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xff,0x00,0x1c,0x80,0x00,0x80,0xff,0x00,0x14,0x55,0x56,0x75,0xff,0x00,0x14,0x55,0x56,0x75,0xff,0x00,0x0a,0x2a,0xaa,0x6b,0x8b,0x61,0x08,0xfb,0xd7,0xd0,0xf7,0xda,0x07,0x8b,0xff,0x00,0x27,0x55,0x56,0xff,0x00,0x0a,0x80,0x00,0xff,0x00,0x1e,0xd5,0x54,0xa0,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x14,0xff,0xfe,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1d,0x2a,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x25,0x55,0x58,0x8b,0xff,0x00,0x24,0xaa,0xac,0x8b,0xff,0x00,0x1c,0x80,0x00,0x80,0xff,0x00,0x14,0x55,0x54,0x75,0xff,0x00,0x14,0x55,0x54,0x75,0xff,0x00,0x0a,0x2a,0xac,0x6b,0x8b,0x61,0x08,0xfb,0xd7,0xcf,0xf7,0xe1,0x07,0x8b,0xff,0x00,0x38,0xaa,0x9e,0x7c,0xff,0x00,0x2c,0x2a,0xaa,0x6d,0xff,0x00,0x1f,0xaa,0xb8,0x6d,0xff,0x00,0x1f,0xaa,0xaa,0x61,0xff,0x00,0x0f,0xd5,0x56,0x55,0x8b,0xff,0xff,0xba,0xaa,0xba,0x8b,0xff,0xff,0xcc,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xde,0xaa,0x9c,0xff,0xff,0xc7,0x55,0x56,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x1b,0x55,0x56,0x78,0xa0,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0xff,0xff,0xe2,0x55,0x54,0xff,0x00,0x07,0x55,0x56,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xe5,0x80,0x00,0xff,0xff,0xfa,0x2a,0xaa,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xf4,0x55,0x56,0x08,0xff,0xff,0xe8,0x55,0x60,0xff,0xff,0xf4,0x55,0x56,0xff,0xff,0xec,0xd5,0x55,0xff,0xff,0xef,0x2a,0xaa,0xff,0xff,0xf1,0x55,0x4b,0x75,0x08,0xc9,0x07,0x0e,0x85,0xd6,0xf8,0x8f,0x15,0x3a,0x0a,0x0e,0x74,0xf7,0x04,0xff,0x00,0x2b,0x80,0x00,0x15,0x3b,0x0a,0xff,0x00,0xe8,0x80,0x00,0xb8,0x15,0x3c,0x0a,0x0e,0x79,0xd6,0xf8,0x8f,0x15,0xfd,0x27,0xcf,0xf7,0x6f,0x07,0xa7,0xff,0xff,0xcf,0x55,0x55,0xff,0x00,0x2d,0xaa,0xab,0xff,0xff,0xe7,0xaa,0xab,0xff,0x00,0x3f,0x55,0x55,0x8b,0xbd,0x8b,0xb4,0xff,0x00,0x10,0xaa,0xaa,0xab,0xff,0x00,0x21,0x55,0x56,0xab,0xff,0x00,0x21,0x55,0x54,0x9b,0xff,0x00,0x34,0xaa,0xab,0x8b,0xff,0x00,0x48,0x00,0x01,0x08,0xf3,0x07,0x8b,0xff,0x00,0x47,0x55,0x56,0xff,0xff,0xef,0xaa,0xaa,0xff,0x00,0x34,0x55,0x54,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xd5,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0x57,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0x71,0xff,0xff,0xf9,0x80,0x00,0xff,0xff,0xe9,0x55,0x55,0x7e,0xff,0xff,0xe9,0x55,0x55,0x7e,0x79,0xff,0xff,0xec,0xd5,0x56,0xff,0xff,0xf2,0xaa,0xab,0xff,0xff,0xe6,0xaa,0xaa,0x08,0xd2,0x07,0xf7,0x84,0xfb,0xc1,0x15,0xff,0xff,0x9b,0x55,0x56,0xff,0xff,0xda,0x55,0x56,0xff,0xff,0xcd,0xaa,0xaa,0xff,0xff,0xb4,0xaa,0xaa,0x1e,0xff,0xff,0xd6,0xaa,0xab,0x8b,0xff,0xff,0xe0,0x80,0x00,0xff,0x00,0x0e,0x2a,0xaa,0xff,0xff,0xea,0x55,0x55,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xea,0x55,0x55,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xf5,0x2a,0xab,0xff,0x00,0x24,0x7f,0xff,0x8b,0xff,0x00,0x2c,0xaa,0xab,0x08,0xe4,0x07,0x8b,0xff,0x00,0x2f,0x55,0x56,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x25,0xd5,0x54,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xaa,0xff,0x00,0x28,0xaa,0xab,0x8b,0x08,0xd9,0xb2,0xff,0xff,0xcd,0xaa,0xaa,0xff,0xff,0x9b,0x55,0x56,0x1f,0x0e,0x7a,0xf8,0x03,0xce,0x15,0xfb,0x6f,0xd0,0xf9,0x27,0x46,0x44,0x07,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x19,0x55,0x56,0x79,0xff,0x00,0x13,0x2a,0xaa,0xff,0xff,0xe9,0x55,0x56,0x98,0xff,0xff,0xe9,0x55,0x56,0x98,0x71,0xff,0x00,0x06,0x80,0x00,0xff,0xff,0xe2,0xaa,0xaa,0x8b,0x57,0x8b,0xff,0xff,0xd5,0xaa,0xab,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xdf,0x55,0x54,0xff,0xff,0xde,0xaa,0xc4,0xff,0xff,0xef,0xaa,0xab,0xff,0xff,0xcb,0xaa,0xaa,0xff,0x00,0x00,0x00,0x01,0xff,0xff,0xb8,0xaa,0x92,0x08,0x23,0x07,0x8b,0x43,0x9b,0xff,0xff,0xcb,0x55,0x55,0xab,0xff,0xff,0xde,0xaa,0xab,0xab,0xff,0xff,0xde,0xaa,0xab,0xb4,0xff,0xff,0xef,0x55,0x55,0xbd,0x8b,0xff,0x00,0x3f,0x55,0x56,0x8b,0xff,0x00,0x2d,0xaa,0xaa,0xff,0x00,0x18,0x55,0x55,0xa7,0xff,0x00,0x30,0xaa,0xab,0x08,0x6b,0xa9,0x15,0xff,0xff,0xea,0xaa,0xaa,0x6f,0xff,0xff,0xe0,0x55,0x56,0x7d,0x61,0x8b,0x08,0xff,0xff,0xb5,0x55,0x56,0xff,0xff,0xda,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x64,0xaa,0xaa,0x1f,0xea,0x07,0xff,0x00,0x64,0xaa,0xaa,0xff,0x00,0x26,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0xff,0x00,0x4d,0x55,0x56,0x1e,0xff,0x00,0x28,0xaa,0x98,0x8b,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf1,0xd5,0x56,0xff,0x00,0x14,0xaa,0xbe,0xff,0xff,0xe3,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xe3,0xaa,0xc2,0xff,0x00,0x0a,0x55,0x56,0xff,0xff,0xda,0x2a,0xaa,0x8b,0xff,0xff,0xd0,0xaa,0x94,0x08,0x32,0x07,0x8b,0xff,0xff,0xd2,0xaa,0xab,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xea,0xaa,0xaa,0x6f,0x08,0x0e,0xfb,0x53,0xd6,0xf8,0x8f,0x15,0xfc,0x8f,0xcf,0xf7,0xd5,0x07,0x8b,0xff,0x00,0x26,0xaa,0xaa,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x1f,0x55,0x56,0xff,0x00,0x15,0xaa,0xab,0xa3,0xff,0x00,0x15,0xaa,0xab,0xa3,0xff,0x00,0x1c,0x2a,0xaa,0x97,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x12,0xaa,0xaa,0x8b,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xfd,0x55,0x56,0x9b,0xff,0xff,0xfa,0xaa,0xaa,0x08,0xcf,0x07,0x7f,0x8d,0xff,0xff,0xf3,0xaa,0xaa,0x8c,0xff,0xff,0xf3,0x55,0x56,0x8b,0xff,0xff,0xe3,0x55,0x55,0x8b,0xff,0xff,0xe6,0x2a,0xab,0xff,0xff,0xf9,0xd5,0x56,0x74,0xff,0xff,0xf3,0xaa,0xaa,0x74,0xff,0xff,0xf3,0xaa,0xe6,0xff,0xff,0xed,0x80,0x00,0xff,0xff,0xed,0x2a,0xaa,0x7d,0xff,0xff,0xe6,0xaa,0x70,0x08,0xcf,0x07,0x0e,0x49,0xec,0xad,0x15,0x3d,0x0a,0x0e,0xfb,0x50,0xf7,0x4a,0xf8,0x59,0x15,0xf7,0x06,0xc1,0xfb,0x06,0xf7,0x28,0x06,0x46,0x6b,0x8b,0xfb,0x08,0x3c,0x8b,0x8b,0x55,0xda,0x8b,0x8b,0xfb,0xdb,0x05,0x8b,0xff,0xff,0xd8,0xaa,0xab,0xff,0x00,0x0a,0xd5,0x56,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x15,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xab,0xff,0xff,0xe9,0xaa,0xab,0xff,0x00,0x1e,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x55,0xff,0x00,0x26,0xaa,0xab,0x8b,0x08,0xbe,0xc7,0x63,0x06,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xea,0x55,0x55,0xa2,0xb9,0x1f,0x0e,0x85,0xff,0x00,0x79,0x80,0x00,0xff,0x00,0x2b,0x80,0x00,0x15,0x3e,0x0a,0x0e,0x32,0x99,0xf8,0x8f,0x15,0xf7,0x43,0xfc,0x8f,0xc8,0x8b,0xf7,0x43,0xf8,0x8f,0x42,0x8b,0xfb,0x18,0xfc,0x2b,0xfb,0x18,0xf8,0x2b,0x05,0x0e,0xf7,0x4e,0x99,0xf8,0x8f,0x15,0xf7,0x2e,0xfc,0x8f,0xc8,0x8b,0xf7,0x13,0xf8,0x2d,0xf7,0x14,0xfc,0x2d,0xc9,0x8b,0xf7,0x2e,0xf8,0x8f,0x41,0x8b,0xfb,0x07,0xfc,0x2a,0xfb,0x12,0xf8,0x2a,0x52,0x8b,0xfb,0x12,0xfc,0x2a,0xfb,0x06,0xf8,0x2a,0x05,0x0e,0x20,0xf7,0xe2,0x16,0xd4,0x8b,0xfb,0x36,0xf7,0x9d,0xf7,0x2c,0xf7,0x86,0x42,0x8b,0xfb,0x04,0xfb,0x50,0xfb,0x07,0xf7,0x50,0x42,0x8b,0xf7,0x2a,0xfb,0x8a,0xfb,0x34,0xfb,0x99,0xd4,0x8b,0xf7,0x0f,0xf7,0x5f,0x05,0x0e,0x32,0xf8,0x3d,0xf8,0x8f,0x15,0x3f,0x0a,0x0e,0x43,0xf8,0x21,0xf8,0x50,0x15,0x40,0x0a,0x0e,0xfb,0x50,0xff,0x00,0x9a,0x80,0x00,0x52,0x15,0x9c,0x79,0xff,0x00,0x19,0x80,0x00,0x82,0xad,0x8b,0x08,0xbd,0xc8,0x68,0x06,0x7b,0x8b,0xff,0xff,0xf4,0x55,0x55,0x8f,0xff,0xff,0xf8,0xaa,0xab,0x93,0xff,0xff,0xf8,0xaa,0xab,0x93,0xff,0xff,0xfc,0x55,0x55,0x98,0x8b,0x9d,0x08,0xf7,0x4c,0x07,0x8b,0xff,0x00,0x24,0xaa,0xab,0xff,0xff,0xfb,0xaa,0xab,0xff,0x00,0x1a,0xd5,0x55,0xff,0xff,0xf7,0x55,0x55,0x9c,0xff,0xff,0xf7,0x55,0x60,0x9c,0xff,0xff,0xf0,0x55,0x55,0xff,0x00,0x0c,0x80,0x00,0xff,0xff,0xe9,0x55,0x4b,0x93,0xa1,0x93,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x0c,0x80,0x00,0x94,0x9c,0x94,0x9c,0xff,0x00,0x04,0x80,0x00,0xff,0x00,0x1b,0x2a,0xaa,0x8b,0xff,0x00,0x25,0x55,0x56,0x08,0xf7,0x47,0x07,0x8b,0x9d,0xff,0x00,0x03,0xaa,0xab,0x98,0xff,0x00,0x07,0x55,0x55,0x93,0xff,0x00,0x07,0x55,0x55,0x93,0xff,0x00,0x0b,0xaa,0xab,0x8f,0x9b,0x8b,0x08,0xae,0xc8,0x59,0x06,0x69,0x8b,0xff,0xff,0xe6,0x80,0x00,0x82,0x7a,0x79,0x7a,0x79,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xe4,0x55,0x54,0x8b,0xff,0xff,0xda,0xaa,0xac,0x08,0xfb,0x4e,0x07,0x8b,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xfa,0xaa,0xaa,0xff,0xff,0xeb,0x80,0x00,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xf3,0xaa,0xaa,0x79,0xff,0xff,0xf9,0x80,0x00,0xff,0xff,0xe6,0xaa,0xaa,0xff,0xff,0xff,0x55,0x56,0x08,0x4a,0x07,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xff,0x55,0x56,0x9d,0xff,0xff,0xf9,0x80,0x00,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xba,0xff,0x00,0x05,0x55,0x56,0xff,0xff,0xeb,0x80,0x00,0x8b,0xff,0xff,0xe3,0x55,0x46,0x08,0xfb,0x53,0x07,0x8b,0xff,0xff,0xda,0xaa,0xab,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xe4,0x55,0x55,0x9c,0x79,0x08,0x0e,0xfb,0x75,0xf7,0x0a,0xf9,0x78,0x15,0xfd,0xcb,0xce,0xf9,0xcb,0x07,0x0e,0xfb,0x50,0xc6,0x74,0x15,0x4e,0xbd,0x07,0xad,0x8b,0xff,0x00,0x19,0x80,0x00,0x94,0x9c,0x9d,0x9c,0x9d,0xff,0x00,0x08,0x80,0x00,0xff,0x00,0x1b,0xaa,0xab,0x8b,0xff,0x00,0x25,0x55,0x55,0x08,0xf7,0x53,0x07,0x8b,0xff,0x00,0x1c,0xaa,0xab,0xff,0x00,0x05,0x55,0x55,0xff,0x00,0x14,0x7f,0xff,0xff,0x00,0x0a,0xaa,0xab,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x0a,0xaa,0xab,0xff,0x00,0x0c,0x55,0x56,0x9d,0xff,0x00,0x06,0x80,0x00,0xff,0x00,0x19,0x55,0x55,0xff,0x00,0x00,0xaa,0xaa,0x08,0xcc,0x07,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x00,0xaa,0xaa,0x79,0xff,0x00,0x06,0x80,0x00,0xff,0xff,0xf5,0x55,0x55,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xf5,0x55,0x55,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xfa,0xaa,0xab,0xff,0x00,0x14,0x80,0x00,0x8b,0xff,0x00,0x1c,0xaa,0xaa,0x08,0xf7,0x4e,0x07,0x8b,0xff,0x00,0x25,0x55,0x54,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x1b,0xaa,0xac,0x7a,0x9d,0x7a,0x9d,0xff,0xff,0xe6,0x80,0x00,0x94,0x69,0x8b,0x08,0x59,0x4e,0xae,0x06,0x9b,0x8b,0xff,0x00,0x0b,0xaa,0xaa,0x87,0xff,0x00,0x07,0x55,0x56,0x83,0xff,0x00,0x07,0x55,0x55,0x83,0xff,0x00,0x03,0xaa,0xab,0x7e,0x8b,0x79,0x08,0xfb,0x47,0x07,0x8b,0xff,0xff,0xda,0xaa,0xaa,0xff,0x00,0x04,0x80,0x00,0xff,0xff,0xe4,0xd5,0x56,0x94,0x7a,0x94,0x7a,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xf3,0x80,0x00,0xa1,0x83,0xff,0xff,0xe9,0x55,0x60,0x83,0xff,0xff,0xf0,0x55,0x55,0xff,0xff,0xf3,0x80,0x00,0xff,0xff,0xf7,0x55,0x4b,0x7a,0xff,0xff,0xf7,0x55,0x55,0x7a,0xff,0xff,0xfb,0xaa,0xab,0xff,0xff,0xe5,0x2a,0xab,0x8b,0xff,0xff,0xdb,0x55,0x55,0x08,0xfb,0x4c,0x07,0x8b,0x79,0xff,0xff,0xfc,0x55,0x55,0x7e,0xff,0xff,0xf8,0xaa,0xab,0x83,0xff,0xff,0xf8,0xaa,0xaa,0x83,0xff,0xff,0xf4,0x55,0x56,0x87,0x7b,0x8b,0x08,0x0e,0x7b,0xf7,0xb6,0xf7,0x71,0x15,0x99,0x85,0xff,0x00,0x0f,0x55,0x56,0x88,0xff,0x00,0x10,0xaa,0xaa,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xff,0x00,0x18,0x55,0x56,0x93,0xa1,0x9b,0xa1,0x9b,0xff,0x00,0x12,0x55,0x56,0xa2,0xff,0x00,0x0e,0xaa,0xaa,0xa9,0x08,0x5a,0xaa,0x05,0xff,0xff,0xf3,0x55,0x56,0x75,0xff,0xff,0xf3,0xd5,0x54,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xf4,0x55,0x56,0x82,0xff,0xff,0xf4,0x55,0x56,0x82,0xff,0xff,0xf2,0x2a,0xaa,0xff,0xff,0xfb,0x80,0x00,0x7b,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0xff,0xff,0xf5,0x80,0x00,0xff,0x00,0x02,0x55,0x56,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xf3,0x2a,0xaa,0x92,0x7b,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x0b,0x55,0x56,0x7b,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xab,0x91,0xff,0xff,0xf2,0xaa,0xab,0x91,0x7c,0x8e,0xff,0xff,0xef,0x55,0x55,0x8b,0x08,0xff,0xff,0xe5,0x55,0x55,0x8b,0xff,0xff,0xe7,0xaa,0xab,0xff,0xff,0xf8,0x2a,0xaa,0x75,0xff,0xff,0xf0,0x55,0x56,0x75,0xff,0xff,0xf0,0x55,0x56,0x79,0xff,0xff,0xe8,0xd5,0x54,0x7d,0xff,0xff,0xe1,0x55,0x56,0x08,0xbc,0x6d,0x05,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x0c,0x2a,0xaa,0xff,0x00,0x0f,0xaa,0xaa,0x96,0xff,0x00,0x08,0xaa,0xab,0x96,0xff,0x00,0x08,0xaa,0xaa,0xff,0x00,0x0d,0x80,0x00,0xff,0x00,0x04,0x55,0x56,0x9b,0x8b,0xff,0x00,0x0b,0x55,0x55,0x8b,0xff,0x00,0x0a,0xaa,0xab,0xff,0xff,0xfd,0xaa,0xaa,0x95,0xff,0xff,0xfb,0x55,0x56,0x95,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0c,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x0f,0x55,0x55,0x81,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xaa,0xff,0xff,0xf7,0x55,0x55,0x99,0x85,0x08,0x0e,0xfb,0xcb,0x0e,0xfb,0xb5,0xd6,0xf8,0x8f,0x15,0x2d,0xe5,0xe9,0x07,0x42,0xfb,0x58,0x15,0x7d,0xfc,0x63,0xdf,0x8b,0x7d,0xf8,0x63,0x05,0x0e,0x72,0xf8,0x0e,0xf7,0xe8,0x15,0xcd,0x90,0x06,0x8b,0xff,0x00,0x30,0xaa,0xaa,0xff,0xff,0xf0,0xd5,0x56,0xff,0x00,0x27,0x80,0x00,0xff,0xff,0xe1,0xaa,0xaa,0xff,0x00,0x1e,0x55,0x56,0xff,0xff,0xe1,0xaa,0xaa,0xff,0x00,0x1e,0x55,0x56,0xff,0xff,0xd6,0xd5,0x56,0xff,0x00,0x10,0x80,0x00,0x57,0xff,0x00,0x02,0xaa,0xaa,0x08,0xe9,0x51,0x2c,0x07,0xff,0xff,0xce,0xaa,0xab,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xd9,0x55,0x55,0x77,0x6f,0xff,0xff,0xde,0xaa,0xaa,0x6f,0xff,0xff,0xde,0xaa,0xaa,0x7d,0xff,0xff,0xcf,0x55,0x56,0x8b,0x4b,0x08,0x23,0x07,0x8b,0x4b,0xff,0x00,0x0e,0x2a,0xaa,0xff,0xff,0xcf,0x80,0x00,0xff,0x00,0x1c,0x55,0x56,0x6a,0xff,0x00,0x1c,0x55,0x55,0x6a,0xff,0x00,0x26,0x80,0x00,0xff,0xff,0xec,0x2a,0xab,0xff,0x00,0x30,0xaa,0xab,0xff,0xff,0xf9,0x55,0x55,0x08,0x2a,0xc5,0xea,0x07,0xbf,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x29,0x2a,0xaa,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x1e,0x55,0x56,0xff,0x00,0x1e,0x55,0x55,0xff,0x00,0x1e,0x55,0x56,0xff,0x00,0x1e,0x55,0x56,0xff,0x00,0x0f,0x2a,0xaa,0xff,0x00,0x27,0x7f,0xff,0x8b,0xff,0x00,0x30,0xaa,0xab,0x08,0x8f,0x49,0x86,0x07,0x8b,0xff,0xff,0xe0,0xaa,0xab,0xff,0xff,0xf6,0xd5,0x56,0xff,0xff,0xe7,0x2a,0xab,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xe6,0xd5,0x56,0xff,0xff,0xf5,0x80,0x00,0x6b,0xff,0xff,0xfd,0x55,0x54,0x08,0xf8,0x1f,0x07,0xff,0x00,0x20,0xaa,0xaa,0xff,0xff,0xfd,0x55,0x56,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xf5,0x80,0x00,0x9d,0xff,0xff,0xed,0xaa,0xaa,0x9d,0xff,0xff,0xed,0xaa,0xdc,0x94,0xff,0xff,0xe7,0x2a,0xaa,0x8b,0xff,0xff,0xe0,0xaa,0x7a,0x08,0xff,0xff,0x1c,0x80,0x00,0xff,0xff,0x0d,0x80,0x00,0x15,0xff,0xff,0xf0,0x55,0x55,0xa2,0xff,0xff,0xf8,0x2a,0xab,0xff,0x00,0x22,0x80,0x00,0x8b,0xb9,0x08,0xeb,0x07,0x8b,0xff,0x00,0x2d,0x55,0x56,0xff,0x00,0x07,0xd5,0x55,0xad,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x16,0xaa,0x74,0xff,0x00,0x16,0x2a,0xaa,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x1c,0xaa,0xab,0xff,0x00,0x06,0xaa,0xe2,0x08,0xfc,0x19,0x07,0xff,0xff,0xe3,0x55,0x5b,0x91,0xff,0xff,0xe9,0xd5,0x55,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xf0,0x55,0x50,0xa2,0x08,0x0e,0x2f,0xf8,0x27,0xcf,0x15,0xfb,0x9b,0x06,0xff,0x00,0x0b,0x55,0x42,0xff,0x00,0x0c,0xaa,0xaa,0xff,0x00,0x08,0x55,0x55,0xff,0x00,0x0e,0xd5,0x56,0xff,0x00,0x05,0x55,0x69,0x9c,0xff,0x00,0x05,0x55,0x55,0x9c,0xff,0x00,0x02,0xaa,0xab,0xff,0x00,0x14,0x80,0x00,0x8b,0xa3,0x08,0xf7,0x08,0xf7,0x1f,0xcd,0xfb,0x1f,0xf7,0x4b,0x07,0x8b,0xff,0x00,0x1e,0xaa,0xac,0xff,0x00,0x06,0xaa,0xab,0xff,0x00,0x17,0x2a,0xa8,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x0f,0xaa,0xac,0x9e,0xff,0x00,0x07,0xd5,0x54,0xff,0x00,0x18,0xaa,0xab,0x8b,0xa3,0x8b,0xff,0x00,0x12,0xd5,0x56,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x0d,0xaa,0xaa,0x7c,0xff,0x00,0x0d,0xaa,0xaa,0x7c,0xff,0x00,0x06,0xd5,0x56,0xff,0xff,0xeb,0x80,0x00,0x8b,0x71,0x08,0xd3,0x06,0x8b,0xff,0x00,0x2f,0x55,0x54,0xff,0xff,0xf2,0x80,0x00,0xff,0x00,0x25,0x2a,0xac,0x70,0xa6,0x70,0xa6,0xff,0xff,0xdc,0x2a,0xaa,0xff,0x00,0x0d,0x80,0x00,0xff,0xff,0xd3,0x55,0x56,0x8b,0xff,0xff,0xd0,0xaa,0xab,0x8b,0xff,0xff,0xda,0xd5,0x55,0xff,0xff,0xf0,0xd5,0x54,0x70,0xff,0xff,0xe1,0xaa,0xac,0x70,0xff,0xff,0xe1,0xaa,0xac,0xff,0xff,0xf2,0x80,0x00,0xff,0xff,0xd5,0xd5,0x54,0x8b,0x55,0x08,0xfb,0x40,0x49,0x49,0xcd,0xfb,0x11,0x07,0x8b,0xff,0xff,0xe5,0x55,0x59,0xff,0xff,0xfc,0x80,0x00,0xff,0xff,0xea,0xaa,0xab,0x84,0xff,0xff,0xef,0xff,0xfc,0x84,0x7b,0xff,0xff,0xf4,0x80,0x00,0x7e,0x7b,0x81,0x08,0x4d,0xf7,0xf1,0x07,0x0e,0xe0,0xf8,0x38,0xf7,0x3a,0x15,0xd2,0x44,0xba,0xbb,0x44,0xd1,0x05,0xa3,0xff,0x00,0x21,0x55,0x54,0x97,0xb1,0x8b,0xff,0x00,0x2a,0xaa,0xac,0x8b,0xb5,0x7f,0xff,0x00,0x26,0x55,0x56,0x73,0xff,0x00,0x22,0xaa,0xaa,0x08,0xd1,0xd1,0x5c,0xba,0x44,0x45,0x05,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x17,0x55,0x54,0xff,0xff,0xda,0x55,0x54,0xff,0x00,0x0b,0xaa,0xac,0xff,0xff,0xd5,0x55,0x56,0x8b,0xff,0xff,0xd4,0xaa,0xb2,0x8b,0x65,0xff,0xff,0xf4,0x55,0x54,0xff,0xff,0xdf,0x55,0x4e,0xff,0xff,0xe8,0xaa,0xac,0x08,0x44,0xd1,0x5d,0x5c,0xd1,0x44,0x05,0x73,0xff,0xff,0xdf,0x55,0x56,0x7f,0x65,0x8b,0xff,0xff,0xd4,0xaa,0xaa,0x8b,0x61,0xff,0x00,0x0b,0xaa,0xaa,0x65,0xff,0x00,0x17,0x55,0x56,0x69,0x08,0x46,0x46,0xb9,0x5b,0xd1,0xd1,0x05,0xff,0x00,0x21,0x55,0x55,0x73,0xff,0x00,0x26,0x55,0x55,0x7f,0xff,0x00,0x2b,0x55,0x56,0x8b,0xff,0x00,0x2a,0xaa,0xaa,0x8b,0xb1,0x97,0xff,0x00,0x21,0x55,0x56,0xa3,0x08,0x78,0xcb,0x15,0xff,0xff,0xe6,0xaa,0xaa,0x71,0xff,0xff,0xe0,0x55,0x56,0x7e,0x65,0x8b,0x65,0x8b,0xff,0xff,0xe0,0x55,0x55,0x98,0xff,0xff,0xe6,0xaa,0xab,0xa5,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x19,0xff,0xff,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x20,0x55,0x55,0x8b,0xff,0x00,0x26,0xaa,0xac,0x8b,0xff,0x00,0x26,0xaa,0xaa,0xff,0x00,0x0c,0xaa,0xab,0xff,0x00,0x20,0x55,0x56,0xff,0x00,0x19,0x55,0x55,0xa5,0xff,0x00,0x19,0x55,0x55,0xa5,0xff,0x00,0x1f,0xaa,0xab,0x98,0xb1,0x8b,0xb1,0x8b,0xff,0x00,0x1f,0xaa,0xaa,0x7e,0xff,0x00,0x19,0x55,0x56,0x71,0x08,0xff,0x00,0x19,0x55,0x56,0x71,0xff,0x00,0x0c,0xaa,0xaa,0xff,0xff,0xdf,0xaa,0xaa,0x8b,0xff,0xff,0xd9,0x55,0x56,0x8b,0xff,0xff,0xd9,0x55,0x56,0xff,0xff,0xf3,0x55,0x56,0xff,0xff,0xdf,0xaa,0xaa,0xff,0xff,0xe6,0xaa,0xaa,0x71,0x08,0x0e,0x41,0xf7,0x53,0xf7,0x2f,0x15,0xfb,0x2f,0xd4,0xf7,0x2f,0xf7,0x21,0xc3,0xfb,0x21,0xce,0xf7,0x21,0xc4,0xfb,0x0e,0x07,0xf7,0x35,0xf7,0xf7,0x3a,0x8b,0xfb,0x1b,0xfb,0xd9,0xfb,0x1c,0xf7,0xd9,0x39,0x8b,0xf7,0x36,0xfb,0xf7,0xfb,0x0f,0x8b,0x8b,0x52,0xf7,0x22,0x8b,0x8b,0x48,0xfb,0x22,0x8b,0x8b,0x53,0x05,0x0e,0xfb,0x75,0xf7,0x0a,0xf9,0x78,0x15,0xfb,0xf4,0xce,0xf7,0xf4,0x07,0x48,0xfc,0x69,0x15,0xfb,0xf6,0xce,0xf7,0xf6,0x07,0x0e,0x7a,0xf7,0x1a,0xff,0xff,0x81,0x80,0x00,0x15,0xff,0x00,0x1b,0x55,0x55,0xff,0xff,0xe4,0x55,0x55,0xb3,0xff,0xff,0xf2,0x2a,0xab,0xff,0x00,0x34,0xaa,0xab,0x8b,0xbb,0x8b,0xff,0x00,0x26,0xd5,0x56,0xff,0x00,0x0d,0xaa,0xab,0xff,0x00,0x1d,0xaa,0xaa,0xff,0x00,0x1b,0x55,0x55,0xff,0x00,0x1d,0xaa,0xaa,0xff,0x00,0x1b,0x55,0x56,0xff,0x00,0x0e,0xd5,0x56,0xff,0x00,0x24,0x55,0x55,0x8b,0xff,0x00,0x2d,0x55,0x55,0x8b,0xad,0xff,0xff,0xf9,0x80,0x00,0xff,0x00,0x1b,0xd5,0x56,0x7e,0xff,0x00,0x15,0xaa,0xaa,0x7e,0xff,0x00,0x15,0xaa,0xaa,0xff,0xff,0xeb,0x80,0x00,0xff,0x00,0x11,0x2a,0xaa,0x6f,0xff,0x00,0x0c,0xaa,0xac,0xff,0x00,0x1e,0xaa,0xaa,0x95,0xff,0x00,0x17,0xd5,0x56,0xff,0x00,0x13,0x55,0x55,0x9c,0xff,0x00,0x1c,0xaa,0xab,0x08,0x9c,0xff,0x00,0x1c,0xaa,0xab,0xff,0x00,0x08,0x80,0x00,0xff,0x00,0x21,0x55,0x55,0x8b,0xb1,0x8b,0xff,0x00,0x31,0x55,0x56,0x80,0xff,0x00,0x27,0xaa,0xaa,0x75,0xa9,0x75,0xa9,0xff,0xff,0xdd,0x55,0x56,0xff,0x00,0x14,0x55,0x56,0xff,0xff,0xd0,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xd3,0x55,0x5d,0xff,0x00,0x0a,0xaa,0x70,0xff,0xff,0xe0,0xd5,0x55,0xff,0x00,0x0d,0xaa,0xaa,0xff,0xff,0xee,0x55,0x4e,0xff,0x00,0x10,0xaa,0xe6,0xff,0xff,0xee,0x55,0x55,0xff,0x00,0x10,0xaa,0xac,0xff,0xff,0xf7,0x2a,0xab,0xff,0x00,0x17,0x55,0x54,0x8b,0xa9,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x07,0x80,0x00,0xff,0x00,0x14,0xaa,0xa8,0x9a,0xff,0x00,0x0e,0xaa,0xac,0x08,0x9a,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x14,0xd5,0x55,0xff,0x00,0x07,0x55,0x54,0xff,0x00,0x1a,0xaa,0xab,0x8b,0x08,0xff,0x00,0x38,0xaa,0xaa,0xff,0x00,0x1c,0x55,0x56,0x6c,0x4d,0x1f,0xd0,0x06,0x8b,0xff,0x00,0x30,0xaa,0xac,0xff,0xff,0xf3,0x2a,0xaa,0xff,0x00,0x26,0x55,0x54,0xff,0xff,0xe6,0x55,0x56,0xa7,0xff,0xff,0xe6,0x55,0x56,0xa7,0xff,0xff,0xd9,0x2a,0xaa,0x99,0x57,0x8b,0xff,0xff,0xd1,0x55,0x55,0x8b,0xff,0xff,0xda,0x55,0x55,0xff,0xff,0xf2,0x2a,0xac,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe4,0x55,0x54,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe4,0x55,0x54,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xdc,0x80,0x00,0x8b,0xff,0xff,0xd4,0xaa,0xac,0x8b,0x6b,0x91,0xff,0xff,0xe5,0xaa,0xaa,0x97,0xff,0xff,0xeb,0x55,0x56,0x97,0xff,0xff,0xeb,0x55,0x56,0x9f,0xff,0xff,0xee,0xaa,0xaa,0xa7,0x7d,0x08,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xf4,0xaa,0xde,0xff,0xff,0xe7,0x2a,0xab,0xff,0xff,0xec,0x2a,0xaa,0x7a,0xff,0xff,0xe3,0xaa,0x78,0x7a,0xff,0xff,0xe3,0xaa,0xaa,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xde,0x80,0x00,0x8b,0xff,0xff,0xd9,0x55,0x56,0x8b,0xff,0xff,0xcf,0x55,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xff,0xff,0xd8,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0x6d,0xff,0x00,0x16,0x55,0x51,0x6d,0xff,0x00,0x22,0xd5,0x55,0xff,0xff,0xeb,0xaa,0xaa,0xff,0x00,0x2f,0x55,0x5a,0xff,0xff,0xf5,0x55,0x56,0xb9,0xff,0xff,0xf5,0x55,0x56,0xff,0x00,0x20,0x55,0x56,0xff,0xff,0xf2,0x55,0x54,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x12,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xe8,0x55,0x55,0x8b,0xff,0xff,0xe1,0x55,0x55,0x08,0x8b,0xff,0xff,0xe3,0xff,0xff,0xff,0xff,0xf8,0x2a,0xaa,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xf0,0xaa,0xac,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xe9,0xd5,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0xff,0xe3,0x55,0x56,0x8b,0x6d,0x8b,0xff,0xff,0xe9,0x55,0x55,0x93,0xff,0xff,0xf0,0xaa,0xab,0x9b,0xff,0xff,0xf0,0xaa,0xab,0x9b,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x19,0x55,0x55,0x8b,0xff,0x00,0x22,0xaa,0xab,0x08,0x46,0x06,0x8b,0x55,0xff,0x00,0x0d,0xaa,0xaa,0xff,0xff,0xd7,0x2a,0xaa,0xff,0x00,0x1b,0x55,0x56,0xff,0xff,0xe4,0x55,0x56,0x08,0xff,0x00,0xc5,0x80,0x00,0xf7,0xd0,0x15,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xab,0xff,0xff,0xe6,0xd5,0x56,0xff,0xff,0xf5,0xd5,0x55,0x6b,0x8b,0x6b,0x8b,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x0a,0x2a,0xab,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x14,0x55,0x55,0xff,0xff,0xed,0x55,0x55,0xff,0x00,0x14,0x55,0x55,0xff,0xff,0xf6,0xaa,0xab,0xff,0x00,0x1c,0x80,0x00,0x8b,0xff,0x00,0x24,0xaa,0xab,0x8b,0xff,0x00,0x25,0x55,0x56,0xff,0x00,0x09,0x2a,0xab,0xff,0x00,0x1c,0xd5,0x54,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x14,0x55,0x56,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x14,0x55,0x56,0xff,0x00,0x19,0x80,0x00,0xff,0x00,0x0a,0x2a,0xaa,0xff,0x00,0x20,0xaa,0xab,0x8b,0xff,0x00,0x20,0xaa,0xaa,0x8b,0xff,0x00,0x19,0x55,0x56,0xff,0xff,0xf5,0xd5,0x56,0x9d,0xff,0xff,0xeb,0xaa,0xaa,0x08,0x9d,0xff,0xff,0xeb,0xaa,0xd4,0x94,0xff,0xff,0xe3,0x2a,0xaa,0x8b,0xff,0xff,0xda,0xaa,0x82,0x8b,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xf6,0xd5,0x56,0xff,0xff,0xe3,0x80,0x00,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xab,0x08,0xff,0xff,0xa1,0x80,0x00,0xff,0x02,0x05,0x80,0x00,0x15,0x0e,0x6f,0xf7,0x12,0xf9,0x2c,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xf7,0xb9,0xf7,0x7b,0xff,0x00,0x22,0x80,0x00,0x15,0xbf,0xff,0xff,0xe2,0x55,0x55,0xff,0x00,0x3b,0xaa,0xaa,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x43,0x55,0x56,0x8b,0xff,0x00,0x43,0x55,0x56,0x8b,0xff,0x00,0x3b,0xd5,0x56,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x34,0x55,0x54,0xff,0x00,0x1d,0x55,0x55,0xff,0x00,0x34,0x55,0x54,0xff,0x00,0x1d,0x55,0x55,0xff,0x00,0x28,0xaa,0xac,0xff,0x00,0x29,0x55,0x55,0xa8,0xff,0x00,0x35,0x55,0x56,0xa8,0xff,0x00,0x35,0x55,0x55,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x3c,0xaa,0xab,0x8b,0xcf,0x8b,0xcf,0xff,0xff,0xf1,0x80,0x00,0xff,0x00,0x3c,0x80,0x00,0x6e,0xc0,0x6e,0xc0,0xff,0xff,0xd7,0x55,0x54,0xff,0x00,0x29,0x55,0x54,0xff,0xff,0xcb,0xaa,0xac,0xff,0x00,0x1d,0xaa,0xac,0x08,0xff,0xff,0xcb,0xaa,0xac,0xff,0x00,0x1d,0xaa,0xac,0xff,0xff,0xc4,0x2a,0xaa,0xff,0x00,0x0e,0xd5,0x54,0xff,0xff,0xbc,0xaa,0xaa,0x8b,0xff,0xff,0xbc,0xaa,0xaa,0x8b,0xff,0xff,0xc4,0x55,0x56,0xff,0xff,0xf1,0x2a,0xac,0x57,0xff,0xff,0xe2,0x55,0x54,0x57,0xff,0xff,0xe2,0x55,0x54,0xff,0xff,0xd7,0x80,0x00,0xff,0xff,0xd6,0xaa,0xac,0x6e,0x56,0x6e,0x56,0xff,0xff,0xf1,0x80,0x00,0xff,0xff,0xc3,0x80,0x00,0x8b,0x47,0x8b,0x47,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xc3,0x80,0x00,0xa8,0x56,0xa8,0x56,0xff,0x00,0x28,0x80,0x00,0xff,0xff,0xd6,0xaa,0xaa,0xbf,0xff,0xff,0xe2,0x55,0x56,0x08,0xff,0x01,0x4a,0x80,0x00,0xff,0x00,0x2d,0x80,0x00,0x15,0xff,0xff,0xd4,0x55,0x74,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xcd,0x80,0x00,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xc6,0xaa,0x8c,0x8b,0xff,0xff,0xc6,0xaa,0xb6,0x8b,0xff,0xff,0xcd,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x55,0xff,0xff,0xd4,0xaa,0xa0,0xff,0x00,0x18,0xaa,0xab,0xff,0xff,0xd4,0xaa,0xab,0xff,0x00,0x18,0xaa,0xaa,0xff,0xff,0xde,0x80,0x00,0xff,0x00,0x22,0xaa,0xab,0xff,0xff,0xe8,0x55,0x55,0xff,0x00,0x2c,0xaa,0xab,0xff,0xff,0xe8,0x55,0x5d,0xff,0x00,0x2c,0xaa,0xab,0xff,0xff,0xf4,0x2a,0xab,0xff,0x00,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xff,0x00,0x3b,0x55,0x56,0x8b,0xff,0x00,0x3b,0x55,0x56,0xff,0x00,0x0b,0xd5,0x55,0xbf,0xff,0x00,0x17,0xaa,0xab,0xff,0x00,0x2c,0xaa,0xaa,0xff,0x00,0x17,0xaa,0xab,0xff,0x00,0x2c,0xaa,0xac,0xff,0x00,0x21,0x80,0x00,0xff,0x00,0x22,0xaa,0xa8,0xff,0x00,0x2b,0x55,0x55,0xff,0x00,0x18,0xaa,0xac,0x08,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0xff,0x00,0x32,0x55,0x54,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x39,0x55,0x56,0x8b,0xff,0x00,0x39,0x55,0x56,0x8b,0xff,0x00,0x32,0x7f,0xfe,0xff,0xff,0xf3,0xaa,0xac,0xff,0x00,0x2b,0xaa,0xac,0xff,0xff,0xe7,0x55,0x54,0xff,0x00,0x2b,0xaa,0xac,0xff,0xff,0xe7,0x55,0x9c,0xff,0x00,0x21,0xaa,0xa8,0xff,0xff,0xdd,0x55,0x54,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xd3,0x55,0x10,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xd3,0x55,0x56,0xff,0x00,0x0b,0xd5,0x54,0x57,0x8b,0xff,0xff,0xc4,0xaa,0xaa,0x8b,0xff,0xff,0xc4,0xaa,0xb2,0xff,0xff,0xf4,0x2a,0xac,0x57,0xff,0xff,0xe8,0x55,0x54,0xff,0xff,0xd3,0x55,0x4e,0xff,0xff,0xe8,0x55,0xa4,0xff,0xff,0xd3,0x55,0x55,0xff,0xff,0xde,0x55,0x54,0xff,0xff,0xdd,0x55,0x55,0xff,0xff,0xd4,0x55,0x08,0xff,0xff,0xe7,0x55,0x56,0x08,0xff,0xff,0x00,0x80,0x00,0xf4,0x15,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x55,0xaf,0xff,0xff,0xf3,0xaa,0xab,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x2a,0xaa,0xaa,0x8b,0xad,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x19,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x19,0x55,0x54,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x0c,0xaa,0xac,0xff,0x00,0x1e,0xaa,0xaa,0x8b,0xff,0x00,0x26,0xaa,0xab,0x08,0x90,0x57,0x87,0x07,0x8b,0xff,0xff,0xe7,0x55,0x55,0xff,0xff,0xf8,0x55,0x56,0xff,0xff,0xec,0xaa,0xab,0xff,0xff,0xf0,0xaa,0xaa,0x7d,0xff,0xff,0xf0,0xaa,0xaa,0x7d,0x76,0x84,0xff,0xff,0xe5,0x55,0x56,0x8b,0xff,0xff,0xe1,0x55,0x56,0x8b,0xff,0xff,0xe8,0x55,0x54,0xff,0x00,0x08,0x2a,0xab,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x1c,0xd5,0x55,0x8b,0xff,0x00,0x29,0x55,0x56,0x08,0xd2,0x07,0x8b,0xff,0x00,0x28,0xaa,0xaa,0xff,0x00,0x08,0x55,0x56,0xff,0x00,0x1c,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x10,0xaa,0x7c,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x17,0xaa,0xaa,0xff,0x00,0x08,0x2a,0xaa,0xff,0x00,0x1e,0xaa,0xda,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0x8b,0xa0,0xff,0xff,0xf9,0x2a,0xaa,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf2,0x55,0x56,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xf2,0x55,0x56,0xff,0x00,0x07,0xaa,0xaa,0xff,0xff,0xec,0x80,0x00,0x8b,0xff,0xff,0xe6,0xaa,0xaa,0x08,0x88,0xbf,0x90,0x07,0x8b,0xff,0x00,0x26,0xaa,0x8e,0xff,0xff,0xf3,0x80,0x00,0xff,0x00,0x1e,0xaa,0xaa,0x72,0xff,0x00,0x16,0xaa,0xc8,0x72,0xff,0x00,0x16,0xaa,0xac,0xff,0xff,0xdd,0xd5,0x56,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xd4,0xaa,0xaa,0x8b,0xff,0xff,0xd2,0xaa,0xaa,0x8b,0x67,0xff,0xff,0xf3,0xaa,0xac,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xe7,0x55,0x54,0xff,0xff,0xe5,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xd8,0x55,0x54,0x8b,0xff,0xff,0xc9,0x55,0x56,0x08,0x3e,0x07,0x8b,0xff,0xff,0xc9,0x55,0x5d,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xd8,0x55,0x55,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xe7,0x55,0x4e,0x08,0x0e,0xfb,0x5a,0xf7,0x8a,0xf9,0x65,0x15,0xff,0xff,0xeb,0x55,0x5c,0x9d,0xff,0xff,0xe2,0x55,0x55,0x94,0xff,0xff,0xd9,0x55,0x4f,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe4,0x2a,0xab,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xeb,0xaa,0xaa,0x7a,0xff,0xff,0xeb,0xaa,0xaa,0x7a,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xe9,0x2a,0xac,0x8b,0xff,0xff,0xe3,0x55,0x54,0x08,0x89,0xc7,0x8d,0x07,0x8b,0x99,0xff,0x00,0x04,0xaa,0xaa,0x96,0xff,0x00,0x09,0x55,0x56,0x93,0xff,0x00,0x09,0x55,0x56,0x93,0xff,0x00,0x0d,0x55,0x55,0x8f,0xff,0x00,0x11,0x55,0x55,0x8b,0x9d,0x8b,0xff,0x00,0x0d,0xd5,0x55,0xff,0xff,0xfb,0x55,0x54,0xff,0x00,0x09,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xac,0xff,0x00,0x09,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xac,0xff,0x00,0x04,0xd5,0x55,0xff,0xff,0xf2,0x55,0x54,0x8b,0x79,0x08,0x6c,0x43,0x07,0xff,0xff,0xdf,0x55,0x55,0x8b,0xff,0xff,0xe6,0x2a,0xab,0x83,0x78,0x7b,0x78,0x7b,0xff,0xff,0xf6,0x80,0x00,0x75,0x8b,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x08,0xd5,0x55,0xff,0xff,0xe8,0x2a,0xaa,0xff,0x00,0x11,0xaa,0xac,0x7a,0xff,0x00,0x11,0xaa,0xaa,0x7a,0xff,0x00,0x19,0x2a,0xab,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x20,0xaa,0xab,0x8b,0x9d,0x8b,0xff,0x00,0x0f,0x2a,0xab,0xff,0x00,0x02,0xd5,0x56,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x05,0xaa,0xaa,0xff,0x00,0x0c,0x55,0x49,0xff,0x00,0x05,0xaa,0xaa,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x08,0xd5,0x56,0xff,0x00,0x09,0x55,0x62,0x97,0x08,0x6c,0xc9,0xf7,0x67,0x07,0x8b,0xff,0x00,0x23,0x55,0x54,0xff,0xff,0xf5,0xaa,0xaa,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xeb,0x55,0x56,0x9d,0x08,0x5b,0xfb,0x77,0x15,0x81,0x81,0x7b,0x86,0x75,0x8b,0x08,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xee,0x55,0x55,0x9a,0xa9,0xff,0x00,0x1d,0x55,0x54,0x9d,0xff,0x00,0x0e,0xaa,0xac,0xaf,0x1f,0xc9,0x6f,0x06,0x8b,0xff,0xff,0xeb,0x55,0xd4,0x86,0xff,0xff,0xf0,0xaa,0xaa,0x81,0xff,0xff,0xf5,0xff,0x82,0x08,0x6a,0xf7,0xf5,0x15,0x0e,0x59,0xa4,0xf7,0x9c,0x15,0x41,0x0a,0x7f,0xfb,0x5a,0x15,0x41,0x0a,0x0e,0x7b,0xf8,0x17,0xf7,0x9c,0x15,0xfb,0x1a,0xd0,0xf7,0x58,0xfc,0x24,0x4d,0x07,0x0e,0xfb,0x1b,0xc6,0xf8,0x10,0x15,0x49,0xf7,0xa7,0xcd,0x07,0x0e,0x94,0xf7,0x40,0xf7,0xdf,0x15,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xef,0x55,0x56,0xab,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x23,0x55,0x55,0x8b,0xaf,0x8b,0xff,0x00,0x20,0x55,0x56,0xff,0x00,0x08,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x16,0x80,0x00,0xff,0x00,0x16,0xd5,0x56,0xff,0x00,0x10,0x55,0x56,0xa8,0xff,0x00,0x10,0x55,0x56,0xa8,0xff,0x00,0x08,0x2a,0xaa,0xff,0x00,0x20,0xd5,0x56,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xaf,0xff,0xff,0xf7,0xd5,0x56,0xff,0x00,0x20,0x80,0x00,0xff,0xff,0xef,0xaa,0xaa,0xa8,0xff,0xff,0xef,0xaa,0xaa,0xa8,0xff,0xff,0xe9,0x80,0x00,0xff,0x00,0x16,0xd5,0x54,0xff,0xff,0xe3,0x55,0x56,0xff,0x00,0x10,0xaa,0xac,0x08,0xff,0xff,0xe3,0x55,0x56,0xff,0x00,0x10,0xaa,0xac,0xff,0xff,0xdf,0xaa,0xaa,0xff,0x00,0x08,0x55,0x54,0x67,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0x6b,0xff,0xff,0xf7,0xaa,0xac,0xff,0xff,0xe3,0x55,0x55,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xe3,0x55,0x55,0xff,0xff,0xef,0x55,0x54,0xff,0xff,0xe9,0x80,0x00,0xff,0xff,0xe9,0x2a,0xac,0xff,0xff,0xef,0xaa,0xab,0x6e,0xff,0xff,0xef,0xaa,0xaa,0x6e,0xff,0xff,0xf7,0xd5,0x56,0xff,0xff,0xdf,0x80,0x00,0x8b,0x67,0x8b,0x67,0xff,0x00,0x08,0x2a,0xaa,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x16,0x7f,0xff,0x74,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xef,0x55,0x56,0x08,0xf7,0x64,0xff,0x00,0x33,0x80,0x00,0x15,0xff,0xff,0xe2,0xaa,0xc0,0xff,0xff,0xe1,0xaa,0xaa,0xff,0xff,0xda,0xaa,0xaa,0xff,0xff,0xf0,0xd5,0x56,0xff,0xff,0xd2,0xaa,0x96,0x8b,0xff,0xff,0xd3,0x55,0x55,0x8b,0xff,0xff,0xdb,0x2a,0xab,0x9a,0x6e,0xa9,0x6e,0xa9,0xff,0xff,0xf1,0x80,0x00,0xff,0x00,0x26,0xaa,0xaa,0x8b,0xff,0x00,0x2f,0x55,0x56,0x8b,0xff,0x00,0x2e,0xaa,0xac,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x26,0x55,0x54,0xa8,0xa9,0xa8,0xa9,0xff,0x00,0x24,0xd5,0x55,0x9a,0xff,0x00,0x2c,0xaa,0xab,0x8b,0xff,0x00,0x1d,0x55,0x56,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0xff,0xff,0xf9,0x2a,0xac,0xa3,0xff,0xff,0xf2,0x55,0x54,0x08,0xa3,0xff,0xff,0xf2,0x55,0x54,0xff,0x00,0x12,0xaa,0xaa,0x78,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xe7,0xaa,0xac,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xe7,0xaa,0xac,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xe4,0x80,0x00,0x8b,0xff,0xff,0xe1,0x55,0x54,0x8b,0xff,0xff,0xd1,0x55,0x56,0xff,0xff,0xf1,0x55,0x56,0xff,0xff,0xd9,0x80,0x00,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xe1,0xaa,0xaa,0x08,0xfb,0x4a,0xff,0x00,0xdf,0x80,0x00,0x15,0xfb,0x6a,0xaf,0xe3,0xb3,0x07,0xb5,0x33,0xb2,0x8b,0x5f,0xe7,0x05,0xff,0x00,0x0c,0xaa,0x82,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xaa,0xff,0x00,0x07,0x55,0x56,0xff,0x00,0x06,0xaa,0xd4,0x95,0xff,0x00,0x06,0xaa,0xaa,0x95,0xff,0x00,0x03,0x55,0x56,0xff,0x00,0x0c,0x55,0x54,0x8b,0xff,0x00,0x0e,0xaa,0xac,0x8b,0x9f,0xff,0xff,0xf9,0xd5,0x56,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xf3,0xaa,0xaa,0x96,0xff,0xff,0xf3,0xaa,0xaa,0x96,0xff,0xff,0xee,0xd5,0x56,0xff,0x00,0x05,0x80,0x00,0x75,0x8b,0x08,0x8a,0x2d,0x15,0x5e,0xc9,0xb8,0x06,0xa3,0x97,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xeb,0x55,0x54,0x1f,0x8b,0xff,0xff,0xeb,0x55,0x54,0x7f,0xff,0xff,0xf5,0xaa,0xaa,0x73,0xff,0x00,0x00,0x00,0x02,0x08,0x0e,0x6f,0xf7,0x0c,0xf9,0x20,0x15,0x4d,0xf7,0x98,0xc9,0x07,0x0e,0xfb,0x09,0xff,0x00,0x69,0x80,0x00,0xf8,0x60,0x15,0xff,0x00,0x1a,0x55,0x55,0xff,0xff,0xe5,0x55,0x56,0xff,0x00,0x21,0x80,0x00,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x28,0xaa,0xab,0x8b,0xff,0x00,0x27,0x55,0x54,0x8b,0xac,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x21,0x55,0x56,0x8b,0xb3,0x8b,0xb3,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x21,0x55,0x54,0xff,0xff,0xe5,0x55,0x56,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xe5,0x55,0x56,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xde,0xff,0xff,0xff,0x00,0x0d,0x55,0x54,0xff,0xff,0xd8,0xaa,0xab,0x8b,0xff,0xff,0xd7,0x55,0x55,0x8b,0xff,0xff,0xde,0x80,0x00,0xff,0xff,0xf2,0xaa,0xac,0xff,0xff,0xe5,0xaa,0xab,0xff,0xff,0xe5,0x55,0x54,0x08,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xe5,0x55,0x54,0xff,0xff,0xf2,0xd5,0x56,0xff,0xff,0xde,0xaa,0xac,0x8b,0x63,0x8b,0x63,0xff,0x00,0x0d,0x2a,0xaa,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x1a,0x55,0x56,0xff,0xff,0xe5,0x55,0x56,0x08,0xff,0x00,0xa3,0x80,0x00,0xae,0x15,0xff,0xff,0xef,0x55,0x55,0xff,0xff,0xee,0xaa,0xaa,0x76,0xff,0xff,0xf7,0x55,0x56,0xff,0xff,0xe6,0xaa,0xab,0x8b,0x71,0x8b,0xff,0xff,0xea,0xaa,0xab,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xef,0x55,0x55,0xff,0x00,0x11,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xf7,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xac,0x8b,0xa5,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x08,0x55,0x56,0xa1,0xff,0x00,0x10,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x10,0xaa,0xab,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x15,0x55,0x55,0xff,0x00,0x08,0xaa,0xac,0xa5,0x8b,0xff,0x00,0x19,0x55,0x55,0x8b,0xa0,0xff,0xff,0xf7,0x55,0x54,0xff,0x00,0x10,0xaa,0xab,0xff,0xff,0xee,0xaa,0xac,0x08,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x08,0x55,0x56,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x8b,0x71,0xff,0xff,0xf7,0xaa,0xaa,0xff,0xff,0xea,0x55,0x54,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xee,0xaa,0xac,0x08,0x0e,0x7b,0xf7,0x73,0xf7,0xab,0x15,0x25,0x0a,0xfb,0x6d,0x04,0x49,0xf8,0x22,0xcd,0x07,0x0e,0xfb,0x63,0xb8,0xf8,0x76,0x15,0x42,0x0a,0x0e,0xfb,0x65,0xd1,0xff,0x01,0xc4,0x80,0x00,0x15,0x43,0x0a,0x0e,0x6f,0xf7,0xa0,0xf9,0x4d,0x15,0x44,0x0a,0x0e,0x7e,0xd6,0xf8,0x8f,0x15,0xfd,0x27,0xcf,0xf7,0x4b,0x07,0xa3,0x71,0xff,0x00,0x21,0x55,0x55,0x7e,0xff,0x00,0x2a,0xaa,0xab,0x8b,0xa7,0x8b,0xa4,0xff,0x00,0x05,0xaa,0xab,0xa1,0xff,0x00,0x0b,0x55,0x55,0xa1,0xff,0x00,0x0b,0x55,0x55,0x9d,0x9c,0x99,0xff,0x00,0x16,0xaa,0xab,0x08,0x4f,0xcf,0xf8,0x8f,0x46,0xfb,0xdd,0x07,0x8b,0xff,0xff,0xd8,0xaa,0xab,0x80,0xff,0xff,0xe1,0x7f,0xff,0x75,0xff,0xff,0xea,0x55,0x56,0x75,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xe4,0x55,0x56,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xde,0xaa,0xaa,0x8b,0xff,0xff,0xdd,0x55,0x55,0x8b,0xff,0xff,0xe4,0xaa,0xab,0xff,0x00,0x0a,0x80,0x00,0x77,0xa0,0x77,0xa0,0x81,0xff,0x00,0x1e,0xd5,0x55,0x8b,0xff,0x00,0x28,0xaa,0xab,0x08,0xf7,0xdd,0x07,0x0e,0xe0,0xf7,0xa0,0xf7,0xa4,0x15,0xfc,0x3c,0xce,0xf9,0x9d,0xe6,0xfd,0x9d,0xce,0xf9,0xde,0xfb,0x58,0x07,0xff,0xff,0xd2,0xaa,0xab,0x8b,0x64,0xff,0xff,0xf6,0xd5,0x54,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xed,0xaa,0xac,0xff,0xff,0xe7,0x2a,0xab,0x72,0x7a,0xff,0xff,0xe0,0x55,0x54,0x7a,0xff,0xff,0xe0,0x55,0x54,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xdc,0x80,0x00,0x8b,0xff,0xff,0xd8,0xaa,0xac,0xff,0xff,0xff,0xff,0xfe,0x51,0xff,0x00,0x11,0x2a,0xaa,0xff,0xff,0xcf,0xaa,0xaa,0xff,0x00,0x22,0x55,0x58,0xff,0xff,0xd9,0x55,0x56,0xff,0x00,0x22,0x55,0x55,0xff,0xff,0xd9,0x55,0x56,0xff,0x00,0x2d,0x80,0x00,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x38,0xaa,0xab,0x87,0x08,0x0e,0xfb,0xe2,0xc0,0xf7,0xcf,0x15,0x2f,0xe3,0xe7,0x07,0x0e,0x6f,0xf7,0x8f,0x97,0x15,0x4c,0xfb,0x36,0xd2,0x8b,0xc0,0xf7,0x36,0x05,0x0e,0xfb,0xc6,0xee,0xf9,0x9a,0x15,0x45,0x0a,0x0e,0xfb,0x5a,0xd5,0xf8,0x5e,0x15,0xa1,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x1e,0x55,0x55,0xff,0xff,0xf5,0x55,0x56,0xff,0x00,0x26,0xaa,0xab,0x8b,0xff,0x00,0x26,0xaa,0xab,0x8b,0xff,0x00,0x1e,0x55,0x55,0xff,0x00,0x0a,0xaa,0xaa,0xa1,0xff,0x00,0x15,0x55,0x56,0xa1,0xff,0x00,0x15,0x55,0x56,0x96,0xff,0x00,0x20,0xff,0xfe,0x8b,0xff,0x00,0x2c,0xaa,0xac,0x08,0xc7,0x07,0x8b,0xff,0x00,0x2c,0xaa,0xac,0x80,0xac,0x75,0xff,0x00,0x15,0x55,0x54,0x75,0xff,0x00,0x15,0x55,0x54,0xff,0xff,0xe1,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xac,0xff,0xff,0xd9,0x55,0x55,0x8b,0xff,0xff,0xd9,0x55,0x57,0x8b,0xff,0xff,0xe1,0xaa,0xab,0xff,0xff,0xf5,0x55,0x54,0xff,0xff,0xe9,0xff,0xfe,0xff,0xff,0xea,0xaa,0xac,0x75,0xff,0xff,0xea,0xaa,0xac,0x80,0x6a,0x8b,0xff,0xff,0xd3,0x55,0x54,0x08,0x4f,0x07,0x8b,0xff,0xff,0xd3,0x55,0x74,0x96,0x6a,0xa1,0xff,0xff,0xea,0xaa,0x8c,0x08,0xf7,0x2b,0xee,0x15,0xff,0xff,0xcf,0x55,0x56,0x77,0xff,0xff,0xe7,0xaa,0xaa,0x63,0x63,0x77,0xff,0x00,0x18,0x55,0x56,0xff,0x00,0x30,0xaa,0xaa,0x1e,0xc7,0x07,0xff,0x00,0x30,0xaa,0xac,0x9f,0xff,0x00,0x18,0x55,0x54,0xb3,0xb3,0x9f,0xff,0xff,0xe7,0xaa,0xac,0xff,0xff,0xcf,0x55,0x54,0x1e,0x4f,0xf7,0x7a,0x15,0x0e,0x59,0xd6,0xf7,0x29,0x15,0x46,0x0a,0xd0,0xfb,0x07,0x15,0x8b,0x38,0xf7,0x58,0xf7,0x5a,0xfb,0x58,0xf7,0x5a,0x8b,0x38,0xf7,0x06,0xfb,0x07,0x05,0x0e,0xf7,0x5e,0xee,0xf8,0xfd,0x15,0x45,0x0a,0xf9,0x35,0xfc,0x7b,0x15,0x47,0x0a,0xfb,0x57,0xf8,0xfb,0x15,0x21,0x0a,0x0e,0xf7,0x53,0xee,0xf8,0xfd,0x15,0x45,0x0a,0xf8,0x35,0xfc,0x92,0x15,0x57,0xf7,0x7e,0xc6,0xfb,0x27,0x07,0xf6,0xf7,0x27,0x05,0xff,0x00,0x0d,0x55,0x04,0xff,0x00,0x11,0x55,0x47,0xff,0x00,0x09,0xd5,0x54,0xff,0x00,0x10,0x55,0x55,0xff,0x00,0x06,0x55,0xa8,0xff,0x00,0x0f,0x55,0x64,0xff,0x00,0x06,0x55,0x54,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x03,0x2a,0xac,0xff,0x00,0x10,0xaa,0xaa,0x8b,0x9d,0x08,0x96,0x07,0x8b,0xab,0xff,0xff,0xf5,0x55,0x54,0xa5,0xff,0xff,0xea,0xaa,0xac,0x9f,0xff,0xff,0xea,0xaa,0xac,0x9f,0xff,0xff,0xe3,0xaa,0xa8,0x95,0xff,0xff,0xdc,0xaa,0xac,0x8b,0x67,0x8b,0xff,0xff,0xe3,0x2a,0xaa,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xe4,0xd5,0x56,0x8b,0x69,0x08,0x7c,0xcd,0x96,0x07,0x8b,0x9f,0xff,0x00,0x04,0x80,0x00,0x9a,0x94,0x95,0x94,0x95,0xff,0x00,0x0c,0x80,0x00,0x90,0x9b,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0c,0x2a,0xac,0xff,0xff,0xfb,0x2a,0xaa,0x94,0xff,0xff,0xf6,0x55,0x56,0x94,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x04,0x80,0x00,0xff,0xff,0xf2,0x80,0x00,0x8b,0xff,0xff,0xee,0xaa,0xaa,0x08,0x83,0x07,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0x89,0xff,0xff,0xf5,0x55,0x56,0x87,0x81,0x87,0x81,0xff,0xff,0xf9,0xaa,0xac,0x80,0xff,0xff,0xf7,0x55,0x54,0x7f,0x08,0xfb,0x09,0xf8,0x56,0x15,0x21,0x0a,0x0e,0xf7,0xbf,0xd1,0xff,0x01,0x27,0x80,0x00,0x15,0x48,0x0a,0xf9,0x6a,0xff,0xff,0x23,0x80,0x00,0x15,0x47,0x0a,0xfb,0x57,0xf8,0xfb,0x15,0x21,0x0a,0x0e,0x28,0xf7,0x45,0xf8,0x8f,0x15,0x2e,0xe4,0xe8,0x07,0xff,0xff,0x53,0x80,0x00,0xfd,0x03,0x15,0xaa,0xff,0xff,0xe1,0x55,0x55,0xff,0x00,0x29,0xd5,0x55,0xff,0xff,0xf0,0xaa,0xab,0xff,0x00,0x34,0xaa,0xab,0x8b,0xff,0x00,0x37,0x55,0x56,0x8b,0xff,0x00,0x2a,0x55,0x54,0x9a,0xff,0x00,0x1d,0x55,0x56,0xa9,0xff,0x00,0x1d,0x55,0x56,0xa9,0xff,0x00,0x0f,0x55,0x54,0xff,0x00,0x2b,0x55,0x55,0xff,0x00,0x01,0x55,0x56,0xff,0x00,0x38,0xaa,0xab,0x08,0x42,0x06,0xff,0xff,0xfe,0xaa,0xaa,0xff,0xff,0xb7,0x55,0x56,0xff,0xff,0xdf,0x55,0x56,0xff,0xff,0xdb,0xaa,0xaa,0x4b,0x8b,0x6b,0x8b,0xff,0xff,0xe7,0x2a,0xab,0x94,0xff,0xff,0xee,0x55,0x55,0x9d,0xff,0xff,0xee,0x55,0x5d,0x9d,0xff,0xff,0xf7,0x2a,0xab,0xff,0x00,0x18,0xaa,0xab,0xff,0xff,0xff,0xff,0xf8,0xff,0x00,0x1f,0x55,0x55,0x8b,0x9f,0xff,0x00,0x03,0x2a,0xaa,0x9d,0xff,0x00,0x06,0x55,0x56,0x9b,0xff,0x00,0x06,0x55,0x55,0x9b,0xff,0x00,0x0c,0x2a,0xab,0x9e,0x9d,0xa1,0x08,0xba,0xc5,0x05,0x9d,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x0b,0xd5,0x55,0xff,0x00,0x13,0x80,0x00,0xff,0x00,0x05,0xaa,0xab,0xff,0x00,0x10,0x55,0x55,0xff,0x00,0x05,0xaa,0xab,0xff,0x00,0x10,0x55,0x55,0xff,0x00,0x02,0xd5,0x55,0xff,0x00,0x15,0x2a,0xab,0x8b,0xa5,0x08,0xaf,0x42,0x68,0x07,0x8b,0xff,0xff,0xeb,0x55,0x56,0x89,0xff,0xff,0xef,0xaa,0xaa,0x87,0x7f,0x87,0x7f,0x82,0xff,0xff,0xf1,0x55,0x55,0x7d,0xff,0xff,0xee,0xaa,0xab,0x08,0x5c,0x4f,0x05,0xff,0xff,0xea,0xaa,0xad,0xff,0xff,0xe4,0xaa,0xae,0xff,0xff,0xf1,0x2a,0xab,0xff,0xff,0xe8,0x2a,0xaa,0xff,0xff,0xf7,0xaa,0xa8,0xff,0xff,0xeb,0xaa,0xa8,0xff,0xff,0xf7,0xaa,0xab,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xfb,0xd5,0x55,0xff,0xff,0xe9,0x80,0x00,0x8b,0xff,0xff,0xe7,0x55,0x56,0x8b,0x59,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xd7,0xaa,0xaa,0xaa,0xff,0xff,0xe1,0x55,0x56,0x08,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0x27,0x0a,0xf7,0xa4,0xc9,0x15,0x28,0x0a,0xfb,0x11,0xf7,0xb8,0x15,0x32,0x0a,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0x27,0x0a,0xf7,0xa4,0xc9,0x15,0x28,0x0a,0xa4,0xf7,0xb8,0x15,0x44,0x0a,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0x27,0x0a,0xf7,0xa4,0xc9,0x15,0x28,0x0a,0x70,0xf7,0xc1,0x15,0x49,0x0a,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0x27,0x0a,0xf7,0xa4,0xc9,0x15,0x28,0x0a,0xfb,0x0f,0xf7,0x75,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x4a,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x61,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x05,0xff,0xff,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x56,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0x60,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xf6,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0x70,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x55,0x3c,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xaa,0x90,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x75,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x36,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x55,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0x27,0x0a,0xf7,0xa4,0xc9,0x15,0x28,0x0a,0xfb,0x0f,0xf7,0x97,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xbc,0xf8,0x47,0xf7,0x3a,0x15,0xc5,0xfb,0x3a,0xd8,0x8b,0xfb,0x8f,0xf9,0x45,0x05,0x9d,0x91,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x0a,0xd5,0x54,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x05,0xaa,0xaa,0xff,0x00,0x11,0xd5,0x54,0x8b,0x9f,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xf7,0x55,0x56,0xa1,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x08,0xaa,0xac,0x71,0x8b,0xff,0xff,0xe5,0x55,0x56,0x8b,0xff,0xff,0xea,0x2a,0xaa,0xff,0xff,0xf7,0x55,0x54,0x7a,0xff,0xff,0xee,0xaa,0xac,0x7a,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x08,0x8b,0x77,0xff,0x00,0x05,0x80,0x00,0xff,0xff,0xee,0x2a,0xac,0x96,0xff,0xff,0xf0,0x55,0x54,0x96,0xff,0xff,0xf0,0x55,0x54,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xf5,0x2a,0xac,0x9d,0x85,0x08,0xfb,0x8f,0xfd,0x45,0xd8,0x8b,0xc5,0xf7,0x3a,0x05,0xf7,0x02,0xf8,0xcf,0x15,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x53,0xc8,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x56,0xe4,0x95,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xfa,0xd5,0x54,0x95,0xff,0xff,0xf5,0xaa,0xac,0x95,0xff,0xff,0xf5,0xaa,0xac,0x90,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x86,0xff,0xff,0xf3,0x55,0x54,0x81,0x81,0x08,0x81,0x81,0xff,0xff,0xf3,0xaa,0xaa,0x86,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf3,0xaa,0xaa,0x90,0x81,0x95,0x08,0xf7,0x36,0xfc,0x91,0x15,0x28,0x0a,0x92,0xf1,0x15,0x0e,0xf7,0xe6,0xf8,0x86,0xf9,0x04,0x15,0xf7,0xd4,0xcd,0xfc,0x48,0x06,0xfc,0x0b,0xfd,0x46,0xda,0x8b,0xe7,0xf7,0x3f,0xf7,0x8b,0x8b,0x8b,0xfb,0x3f,0xf8,0x1d,0x8b,0x8b,0xcd,0xfb,0xd4,0x8b,0x8b,0xf7,0x90,0xf7,0xa1,0x8b,0x8b,0xcd,0xfb,0xa1,0x8b,0x05,0x42,0xfb,0x2b,0x15,0xfb,0x69,0x8b,0xf7,0x69,0xf8,0x1e,0x05,0x0e,0xf8,0x6b,0xf8,0x79,0x15,0xd4,0x8e,0x06,0x8b,0xb5,0xff,0xff,0xf6,0x55,0x54,0xb0,0xff,0xff,0xec,0xaa,0xac,0xab,0xff,0xff,0xec,0xaa,0xaa,0xab,0xff,0xff,0xe4,0x80,0x00,0xff,0x00,0x18,0xaa,0xac,0xff,0xff,0xdc,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xdc,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xd6,0xd5,0x54,0xff,0x00,0x08,0xaa,0xac,0xff,0xff,0xd1,0x55,0x56,0x8b,0x41,0x8b,0x50,0xff,0xff,0xea,0xd5,0x54,0x5f,0xff,0xff,0xd5,0xaa,0xac,0x5f,0xff,0xff,0xd5,0xaa,0xac,0x75,0xff,0xff,0xbd,0x2a,0xa8,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0xff,0xff,0xa6,0xaa,0xaa,0xa0,0xff,0xff,0xbe,0x2a,0xaa,0xb5,0xff,0xff,0xd5,0xaa,0xac,0xff,0x00,0x29,0xff,0xfd,0xff,0xff,0xd5,0xaa,0xab,0xff,0x00,0x38,0x55,0x55,0xff,0xff,0xe9,0xd5,0x55,0xff,0x00,0x46,0xaa,0xae,0x89,0x08,0x54,0xfb,0x22,0xd2,0x8b,0xbb,0xf7,0x26,0x05,0xc3,0xff,0x00,0x09,0x55,0x55,0xb7,0xff,0x00,0x16,0xd5,0x56,0xab,0xff,0x00,0x24,0x55,0x55,0xab,0xff,0x00,0x24,0x55,0x54,0x9b,0xff,0x00,0x2e,0x2a,0xaa,0x8b,0xff,0x00,0x38,0x00,0x02,0x08,0x8f,0x44,0x87,0x07,0x8b,0xff,0xff,0xd3,0x55,0x55,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xdc,0xd5,0x55,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xd8,0xaa,0xaa,0xff,0xff,0xf3,0x2a,0xaa,0x59,0x8b,0x08,0xfb,0x06,0x52,0xff,0x00,0x40,0x55,0x55,0xff,0x00,0x80,0xaa,0xab,0x1f,0xf7,0x48,0x07,0x8b,0xff,0x00,0x47,0x55,0x56,0xff,0x00,0x0e,0x80,0x00,0xff,0x00,0x33,0x55,0x56,0xa8,0xff,0x00,0x1f,0x55,0x54,0xa8,0xff,0x00,0x1f,0x55,0x54,0xff,0x00,0x2a,0x2a,0xab,0xff,0x00,0x0f,0xaa,0xac,0xff,0x00,0x37,0x55,0x55,0x8b,0xbd,0x8b,0xff,0x00,0x27,0x80,0x00,0x7e,0xa8,0x71,0xa8,0x71,0xff,0x00,0x0e,0x80,0x00,0xff,0xff,0xdc,0xaa,0xac,0x8b,0xff,0xff,0xd3,0x55,0x54,0x08,0x0e,0x9e,0xf7,0x2d,0xf9,0x04,0x15,0x29,0x0a,0x8c,0xf8,0x84,0x15,0x32,0x0a,0x0e,0x9e,0xf7,0x2d,0xf9,0x04,0x15,0x29,0x0a,0xf7,0x2b,0xf8,0x84,0x15,0x44,0x0a,0x0e,0x9e,0xf7,0x2d,0xf9,0x04,0x15,0x29,0x0a,0xee,0xf8,0x8d,0x15,0x49,0x0a,0x0e,0x9e,0xf7,0x2d,0xf9,0x04,0x15,0x29,0x0a,0x8e,0xf8,0x63,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xfb,0xab,0xe3,0xf9,0x46,0x15,0x2a,0x0a,0xfb,0x36,0xf7,0x52,0x15,0x32,0x0a,0x0e,0xfb,0xab,0xe3,0xf9,0x46,0x15,0x2a,0x0a,0x7f,0xf7,0x52,0x15,0x44,0x0a,0x0e,0xfb,0xab,0xe3,0xf9,0x46,0x15,0x2a,0x0a,0x4b,0xf7,0x5b,0x15,0x49,0x0a,0x0e,0xfb,0xab,0xe3,0xf9,0x46,0x15,0x2a,0x0a,0xfb,0x34,0xf7,0x31,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xf7,0x21,0xff,0x02,0x1a,0x80,0x00,0xff,0x02,0x72,0x80,0x00,0x15,0x60,0xff,0x00,0x2a,0x55,0x54,0xff,0xff,0xc5,0xd5,0x56,0xff,0x00,0x15,0x2a,0xac,0xff,0xff,0xb6,0xaa,0xaa,0x8b,0x08,0xfb,0x80,0xfb,0xc8,0x31,0x49,0xe5,0xfb,0xd0,0xf7,0x80,0x06,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x3a,0x2a,0xaa,0xff,0x00,0x15,0x2a,0xab,0xb6,0xff,0x00,0x2a,0x55,0x55,0xb6,0xff,0x00,0x2a,0x55,0x55,0xff,0x00,0x15,0x80,0x00,0xff,0x00,0x42,0xd5,0x55,0x8b,0xff,0x00,0x5b,0x55,0x56,0x08,0xf7,0x36,0x07,0x8b,0xff,0x00,0x5b,0x55,0x34,0xff,0xff,0xea,0x80,0x00,0xff,0x00,0x42,0xd5,0x54,0x60,0xff,0x00,0x2a,0x55,0x78,0x08,0xff,0xff,0xf6,0x80,0x00,0xff,0xff,0x34,0x80,0x00,0x15,0xfb,0x37,0x07,0xff,0xff,0x7e,0xaa,0xab,0xff,0xff,0xc9,0x55,0x56,0xff,0xff,0xbf,0x55,0x55,0xff,0xff,0x92,0xaa,0xaa,0x1e,0xfb,0x37,0xf7,0x8e,0xf7,0x20,0xcd,0xfb,0x20,0xf7,0x86,0xf7,0x37,0x06,0xff,0x00,0x34,0xaa,0xaa,0x8b,0xff,0x00,0x28,0x80,0x00,0x7b,0xff,0x00,0x1c,0x55,0x56,0x6b,0xff,0x00,0x1c,0x55,0x54,0x6b,0xff,0x00,0x0e,0x2a,0xac,0x58,0x8b,0x45,0x08,0x0e,0xf7,0x1b,0xf8,0xdb,0xf9,0x46,0x15,0x2b,0x0a,0xfc,0x0c,0xf9,0xc1,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x39,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x72,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x36,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xca,0x8b,0xff,0x00,0x05,0x55,0x56,0x8b,0xff,0x00,0x05,0xaa,0xaa,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x56,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0x56,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xab,0x00,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0x70,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x55,0x3c,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xaa,0x90,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x54,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xca,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x36,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0xff,0x00,0x82,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0x2c,0x0a,0xff,0x01,0x54,0x80,0x00,0xff,0x00,0xc4,0x80,0x00,0x15,0x2d,0x0a,0xfb,0xb8,0xf8,0x54,0x15,0x32,0x0a,0x0e,0xff,0x00,0x82,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0x2c,0x0a,0xff,0x01,0x54,0x80,0x00,0xff,0x00,0xc4,0x80,0x00,0x15,0x2d,0x0a,0xfb,0x22,0xf8,0x54,0x15,0x44,0x0a,0x0e,0xff,0x00,0x82,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0x2c,0x0a,0xff,0x01,0x54,0x80,0x00,0xff,0x00,0xc4,0x80,0x00,0x15,0x2d,0x0a,0xfb,0x56,0xf8,0x5d,0x15,0x49,0x0a,0x0e,0xff,0x00,0x82,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0x2c,0x0a,0xff,0x01,0x54,0x80,0x00,0xff,0x00,0xc4,0x80,0x00,0x15,0x2d,0x0a,0xfb,0xb6,0xf8,0x11,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x49,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x62,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x56,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0x5c,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xfa,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0x70,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x55,0x3c,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xaa,0x90,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x54,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x55,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0xff,0x00,0x82,0x80,0x00,0xff,0x00,0x37,0x80,0x00,0x15,0x2c,0x0a,0xff,0x01,0x54,0x80,0x00,0xff,0x00,0xc4,0x80,0x00,0x15,0x2d,0x0a,0xfb,0xb6,0xf8,0x33,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x7b,0xe4,0xf7,0x2d,0x15,0xb7,0x5f,0xf7,0x0f,0xf7,0x0f,0xf7,0x0f,0xfb,0x0f,0xb8,0xb7,0xfb,0x0f,0xf7,0x10,0xf7,0x0f,0xf7,0x0f,0x5e,0xb7,0xfb,0x0f,0xfb,0x0f,0xfb,0x0f,0xf7,0x0f,0x5f,0x5f,0xf7,0x0f,0xfb,0x0f,0x05,0x0e,0xf8,0x80,0xf9,0x00,0x15,0xbf,0xe5,0x51,0x8b,0x6c,0x56,0x05,0xff,0xff,0xd9,0x55,0x56,0xa7,0xff,0xff,0xce,0x55,0x54,0x99,0xff,0xff,0xc3,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xaa,0x8b,0xff,0xff,0xc5,0xaa,0xab,0xff,0xff,0xea,0xd5,0x54,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xbd,0x2a,0xa8,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0x3b,0xff,0x00,0x11,0x55,0x55,0x4d,0xff,0x00,0x22,0xaa,0xab,0x5f,0x08,0x57,0x31,0xc5,0x8b,0xaa,0xc1,0x05,0xff,0x00,0x26,0xaa,0xab,0x6f,0xbd,0x7d,0xff,0x00,0x3d,0x55,0x55,0x8b,0xff,0x00,0x48,0xaa,0xaa,0x8b,0xc5,0xff,0x00,0x15,0x2a,0xab,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x2a,0x55,0x55,0xff,0x00,0x2b,0x55,0x54,0xff,0x00,0x2a,0x55,0x55,0xff,0x00,0x15,0xaa,0xac,0xff,0x00,0x42,0xd5,0x55,0x8b,0xff,0x00,0x5b,0x55,0x56,0x08,0xf7,0x47,0x07,0x8b,0xff,0x00,0x4f,0x55,0x54,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x3d,0xaa,0xac,0xff,0xff,0xdd,0x55,0x54,0xb7,0x08,0xfb,0xe1,0xfc,0x73,0x15,0xff,0xff,0xf2,0xaa,0xab,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xf9,0x55,0x55,0xb0,0x8b,0xff,0x00,0x2d,0x55,0x55,0x08,0xf7,0x48,0x07,0x8b,0xff,0x00,0x46,0xaa,0xaa,0x99,0xff,0x00,0x33,0x2a,0xaa,0xa7,0xff,0x00,0x1f,0xaa,0xac,0xa7,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x29,0xaa,0xab,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x37,0x55,0x55,0x8b,0xff,0x00,0x30,0xaa,0x94,0x8b,0xff,0x00,0x25,0xaa,0xaa,0x7e,0xff,0x00,0x1a,0xaa,0xc2,0x71,0x08,0xab,0x5d,0x15,0xff,0x00,0x0d,0x55,0x56,0x6d,0xff,0x00,0x06,0xaa,0xaa,0xff,0xff,0xd9,0x55,0x56,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0x08,0xfb,0x48,0x07,0xff,0xff,0x7f,0x55,0x55,0x54,0xff,0xff,0xbf,0xaa,0xab,0xfb,0x02,0x1e,0x59,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd9,0xaa,0xab,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x18,0xaa,0xac,0x08,0x0e,0xf6,0xf7,0x58,0xa2,0x15,0x2f,0x0a,0x86,0xf9,0xed,0x15,0x32,0x0a,0x0e,0xf6,0xf7,0x58,0xa2,0x15,0x2f,0x0a,0xf7,0x25,0xf9,0xed,0x15,0x44,0x0a,0x0e,0xf6,0xf7,0x58,0xa2,0x15,0x2f,0x0a,0xe8,0xf9,0xf6,0x15,0x49,0x0a,0x0e,0xf6,0xf7,0x58,0xa2,0x15,0x2f,0x0a,0x88,0xf9,0xcc,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x6e,0xf7,0xb2,0xf7,0xb5,0x15,0x30,0x0a,0x7f,0xfa,0x04,0x15,0x44,0x0a,0x0e,0xbc,0xf8,0x71,0xff,0x01,0xfe,0x80,0x00,0x15,0xff,0xff,0xd9,0x55,0x56,0xff,0x00,0x23,0xaa,0xac,0x56,0xff,0x00,0x11,0xd5,0x54,0xff,0xff,0xbc,0xaa,0xaa,0x8b,0x08,0xfb,0x39,0xf7,0x12,0x42,0xfd,0x46,0xd4,0xf7,0x33,0xf7,0x39,0x06,0xff,0x00,0x42,0xaa,0xaa,0x8b,0xff,0x00,0x34,0xd5,0x56,0xff,0x00,0x11,0xaa,0xab,0xb2,0xff,0x00,0x23,0x55,0x55,0xb2,0xff,0x00,0x23,0x55,0x55,0xff,0x00,0x13,0x80,0x00,0xff,0x00,0x30,0xaa,0xab,0x8b,0xc9,0x8b,0xcd,0xff,0xff,0xec,0xaa,0xac,0xff,0x00,0x32,0xd5,0x56,0xff,0xff,0xd9,0x55,0x54,0xff,0x00,0x23,0xaa,0xaa,0x08,0x55,0xff,0xff,0x03,0x80,0x00,0x15,0x71,0x75,0x66,0x80,0x5b,0x8b,0x08,0xfb,0x33,0xf7,0xa6,0xf7,0x33,0x06,0xbb,0x8b,0xb0,0xff,0xff,0xf4,0x55,0x56,0xa5,0xff,0xff,0xe8,0xaa,0xaa,0xa5,0xff,0xff,0xe8,0xaa,0xc6,0x98,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xd0,0xaa,0x90,0x8b,0xff,0xff,0xd3,0x55,0x56,0x7e,0xff,0xff,0xde,0xaa,0xaa,0x71,0x75,0x08,0x0e,0x74,0xf7,0x8f,0xc5,0x15,0x4d,0xa8,0x07,0xff,0x00,0x2f,0x55,0x56,0x8b,0xff,0x00,0x23,0x80,0x00,0xff,0x00,0x07,0x80,0x00,0xff,0x00,0x17,0xaa,0xaa,0x9a,0xff,0x00,0x17,0xaa,0xaa,0x9a,0xff,0x00,0x0f,0xd5,0x56,0xff,0x00,0x17,0x80,0x00,0x93,0xab,0x93,0xab,0x8f,0xff,0x00,0x2d,0x55,0x55,0x8b,0xff,0x00,0x3a,0xaa,0xab,0x8b,0xb7,0xff,0xff,0xfe,0x55,0x56,0xff,0x00,0x22,0x2a,0xaa,0xff,0xff,0xfc,0xaa,0xaa,0xff,0x00,0x18,0x55,0x56,0xff,0xff,0xfc,0xab,0x84,0xff,0x00,0x18,0x55,0x56,0xff,0xff,0xf9,0x2a,0xaa,0xff,0x00,0x14,0x2a,0xaa,0xff,0xff,0xf5,0xa9,0xd2,0x9b,0xff,0xff,0xf5,0xaa,0xde,0x9b,0xff,0xff,0xf0,0x2a,0xaa,0x98,0xff,0xff,0xea,0xaa,0x78,0x95,0x08,0xa1,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x10,0x55,0x56,0x9a,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x12,0xaa,0xaa,0xff,0x00,0x0a,0xaa,0xaa,0xff,0x00,0x12,0xaa,0x6c,0xff,0x00,0x05,0x55,0x56,0xa3,0x8b,0xff,0x00,0x1d,0x55,0x94,0x8b,0xff,0x00,0x30,0xaa,0xac,0xff,0xff,0xf0,0x80,0x00,0xff,0x00,0x25,0xaa,0xa8,0x6c,0xff,0x00,0x1a,0xaa,0xac,0x6c,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xd3,0x80,0x00,0xff,0x00,0x0d,0x55,0x54,0x51,0x8b,0xff,0xff,0xbf,0x55,0x56,0x8b,0xff,0xff,0xd1,0x55,0x55,0xff,0xff,0xef,0xd5,0x54,0xff,0xff,0xe3,0x55,0x55,0xff,0xff,0xdf,0xaa,0xac,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xdf,0xaa,0xac,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xd0,0x80,0x00,0x8b,0xff,0xff,0xc1,0x55,0x54,0x08,0xfc,0x8e,0xcf,0xf8,0x97,0x07,0x8b,0xb5,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x1e,0x80,0x00,0xff,0x00,0x12,0xaa,0xab,0x9e,0xff,0x00,0x12,0xaa,0xab,0x9e,0xff,0x00,0x1d,0x55,0x55,0xff,0x00,0x09,0x80,0x00,0xb3,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xff,0x00,0x1b,0x80,0x00,0xff,0xff,0xf8,0x80,0x00,0xff,0x00,0x12,0x55,0x56,0x7c,0xff,0x00,0x12,0x55,0x56,0x7c,0xff,0x00,0x09,0x2a,0xaa,0xff,0xff,0xe8,0xd5,0x54,0x8b,0xff,0xff,0xe0,0xaa,0xac,0x8b,0x6d,0xff,0xff,0xf8,0xd5,0x56,0xff,0xff,0xe9,0xd5,0x56,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xf1,0xaa,0xaa,0xff,0xff,0xe8,0x80,0x00,0xff,0xff,0xf8,0xd5,0x56,0xff,0xff,0xdf,0x55,0x56,0x8b,0x08,0x70,0x4d,0xa0,0x06,0xff,0x00,0x20,0xaa,0xaa,0x8b,0xff,0x00,0x17,0xd5,0x56,0xff,0xff,0xfa,0x55,0x56,0x9a,0xff,0xff,0xf4,0xaa,0xaa,0x9a,0xff,0xff,0xf4,0xaa,0xd8,0xff,0x00,0x09,0x80,0x00,0xff,0xff,0xef,0x2a,0xaa,0x8f,0xff,0xff,0xe9,0xaa,0x7e,0x8f,0xff,0xff,0xe9,0xaa,0xaa,0x8d,0xff,0xff,0xde,0x80,0x00,0x8b,0xff,0xff,0xd3,0x55,0x56,0x8b,0x5d,0x89,0x69,0x87,0x75,0x87,0x75,0x82,0xff,0xff,0xef,0xaa,0xaa,0x7d,0xff,0xff,0xf5,0x55,0x56,0x7d,0xff,0xff,0xf5,0x55,0x55,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xab,0xff,0xff,0xe1,0x55,0x56,0x8b,0x08,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0xff,0xff,0x34,0x80,0x00,0xff,0x02,0x69,0x80,0x00,0x15,0x32,0x0a,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0xff,0xff,0xca,0x80,0x00,0xff,0x02,0x69,0x80,0x00,0x15,0x44,0x0a,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0xff,0xff,0x96,0x80,0x00,0xff,0x02,0x72,0x80,0x00,0x15,0x49,0x0a,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0xff,0xff,0x36,0x80,0x00,0xff,0x02,0x26,0x80,0x00,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x44,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x67,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x55,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xab,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x54,0xb4,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xab,0x90,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x6f,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x3c,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x55,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0xff,0xff,0x36,0x80,0x00,0xff,0x02,0x48,0x80,0x00,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x6c,0xff,0x01,0x76,0x80,0x00,0xf8,0x6b,0x15,0x33,0x0a,0x58,0xff,0xfe,0x78,0x80,0x00,0x15,0x34,0x0a,0xfb,0x23,0xff,0x01,0xf9,0x80,0x00,0x15,0x4a,0x0a,0xff,0x00,0x66,0x80,0x00,0xa6,0x15,0x4b,0x0a,0x0e,0xf7,0xa2,0xf8,0x3a,0xf7,0x84,0x15,0xf7,0xd1,0xc7,0x06,0x8b,0xff,0x00,0x48,0xaa,0xaa,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x35,0xd5,0x56,0x68,0xae,0x68,0xae,0xff,0xff,0xd1,0x80,0x00,0xff,0x00,0x11,0x80,0x00,0x51,0x8b,0x47,0x8b,0xff,0xff,0xcd,0x55,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xd3,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x2c,0xaa,0xaa,0xff,0xff,0xcb,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0x41,0x8b,0xff,0xff,0xc9,0x55,0x55,0x8b,0x60,0x7e,0xff,0xff,0xe0,0xaa,0xab,0x71,0xff,0xff,0xe0,0xaa,0xaa,0x71,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xd4,0xaa,0xaa,0x08,0x86,0xcd,0x8e,0x07,0x8b,0xff,0x00,0x1b,0x55,0x56,0xff,0x00,0x09,0xd5,0x55,0xff,0x00,0x15,0x80,0x00,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x1b,0x2a,0xaa,0xff,0x00,0x07,0xd5,0x56,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xf6,0xaa,0xaa,0x9f,0xff,0xff,0xed,0x55,0x56,0x9f,0xff,0xff,0xed,0x55,0x56,0x95,0xff,0xff,0xe4,0x55,0x54,0x8b,0xff,0xff,0xdb,0x55,0x56,0x08,0x51,0xfb,0x1d,0x07,0x55,0x8b,0xff,0xff,0xd6,0x2a,0xaa,0xff,0xff,0xf3,0x2a,0xaa,0xff,0xff,0xe2,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xe2,0x55,0x56,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xf1,0x2a,0xaa,0xff,0xff,0xdc,0x80,0x00,0x8b,0xff,0xff,0xd2,0xaa,0xab,0x8b,0x5b,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xdb,0x2a,0xaa,0xaa,0xff,0xff,0xe6,0x55,0x56,0xaa,0xff,0xff,0xe6,0x55,0x55,0xff,0x00,0x2a,0x80,0x00,0xff,0xff,0xf3,0x2a,0xab,0xc1,0x8b,0xd9,0x8b,0xff,0x00,0x38,0x55,0x56,0xa6,0xff,0x00,0x22,0xaa,0xaa,0xc1,0xff,0x00,0x11,0x55,0x56,0x6f,0xff,0x00,0x16,0xd5,0x54,0xff,0xff,0xeb,0x80,0x00,0xff,0x00,0x1c,0x55,0x56,0x7e,0x08,0xff,0x00,0x1c,0x55,0x56,0x7e,0xff,0x00,0x20,0x2a,0xaa,0xff,0xff,0xf9,0x80,0x00,0xaf,0x8b,0xff,0x00,0x38,0xaa,0xac,0x8b,0xff,0x00,0x2c,0x2a,0xa8,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x1d,0x55,0x55,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x1d,0x55,0x56,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x25,0xaa,0xaa,0x8b,0xb9,0x08,0x90,0x49,0x88,0x07,0x8b,0xff,0xff,0xe1,0x55,0x56,0xff,0xff,0xf5,0xd5,0x54,0x73,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xe3,0xd5,0x54,0xff,0xff,0xf7,0x55,0x56,0x67,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd6,0xaa,0xac,0x8b,0xff,0xff,0xdf,0xaa,0xaa,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xe8,0xaa,0xaa,0xa2,0xff,0xff,0xe8,0xaa,0xaa,0xa2,0xff,0xff,0xf4,0x55,0x56,0xff,0x00,0x28,0x2a,0xaa,0x8b,0xff,0x00,0x39,0x55,0x56,0x08,0xad,0xff,0x00,0xd0,0x80,0x00,0x15,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1e,0x55,0x56,0xff,0x00,0x0b,0x2a,0xaa,0xb1,0x8b,0xff,0x00,0x26,0xaa,0xac,0x8b,0xff,0x00,0x1e,0x2a,0xa8,0xff,0xff,0xf5,0x55,0x56,0xff,0x00,0x15,0xaa,0xac,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xac,0xff,0xff,0xea,0xaa,0xaa,0xff,0x00,0x0a,0xd5,0x54,0x66,0x8b,0xff,0xff,0xcb,0x55,0x56,0x08,0x79,0xfb,0x8c,0x96,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0x55,0x56,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0x08,0x25,0xff,0xff,0x4b,0x80,0x00,0x15,0x4e,0x07,0xff,0xff,0xaa,0xaa,0xaa,0xff,0xff,0xd5,0x55,0x56,0xff,0xff,0xd5,0x55,0x56,0xff,0xff,0xaa,0xaa,0xaa,0x41,0x66,0xff,0x00,0x1f,0xaa,0xaa,0xff,0x00,0x3f,0x55,0x56,0xff,0x00,0x3e,0xaa,0xab,0xff,0x00,0x25,0x55,0x55,0xff,0x00,0x1f,0x55,0x55,0xff,0x00,0x4a,0xaa,0xab,0x1e,0x0e,0x72,0xf8,0x0e,0xf7,0xe8,0x15,0xcd,0x90,0x06,0x8b,0xff,0x00,0x33,0x55,0x56,0xff,0xff,0xef,0x2a,0xaa,0xb4,0xff,0xff,0xde,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xde,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xd2,0x2a,0xaa,0xff,0x00,0x0f,0x55,0x56,0x51,0x8b,0x4f,0x8b,0xff,0xff,0xd0,0x2a,0xab,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xdc,0x55,0x55,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xdc,0x55,0x54,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xee,0x2a,0xab,0xff,0xff,0xcb,0x55,0x56,0xff,0x00,0x00,0x00,0x01,0x43,0x08,0x23,0x07,0x8b,0x45,0xff,0x00,0x10,0xaa,0xaa,0xff,0xff,0xcc,0x55,0x55,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xde,0xaa,0xab,0xff,0x00,0x21,0x55,0x53,0xff,0xff,0xde,0xaa,0xab,0xff,0x00,0x2d,0x55,0x55,0xff,0xff,0xee,0x55,0x55,0xff,0x00,0x39,0x55,0x58,0x89,0x08,0x53,0xfb,0x24,0xd2,0x8b,0xbc,0xf7,0x29,0x05,0xb5,0xff,0x00,0x08,0xaa,0xab,0xac,0xff,0x00,0x12,0xd5,0x55,0xa3,0xa8,0xa3,0xa8,0x97,0xff,0x00,0x23,0xd5,0x55,0x8b,0xff,0x00,0x2a,0xaa,0xab,0x08,0x8f,0x49,0x86,0x07,0x8b,0x69,0xff,0xff,0xf5,0x55,0x56,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xea,0xaa,0xaa,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xea,0xaa,0xbe,0xff,0xff,0xed,0x55,0x56,0xff,0xff,0xe2,0xaa,0xaa,0xff,0xff,0xf6,0xaa,0xaa,0xff,0xff,0xda,0xaa,0x98,0x8b,0xff,0xff,0xd6,0xaa,0xab,0x8b,0xff,0xff,0xdf,0xd5,0x55,0xff,0x00,0x0b,0x2a,0xaa,0x74,0xff,0x00,0x16,0x55,0x56,0x74,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x27,0x2a,0xaa,0x8b,0xc3,0x08,0xeb,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x17,0x55,0x4f,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x20,0x55,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x29,0x55,0x5c,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xa8,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xed,0x55,0x56,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xe5,0xaa,0xaa,0x8b,0x69,0x08,0x0e,0x72,0xf7,0x13,0xf7,0x84,0x15,0x36,0x0a,0xad,0xff,0x00,0xd0,0x80,0x00,0x15,0x37,0x0a,0x68,0xff,0x01,0x16,0x80,0x00,0x15,0x32,0x0a,0x0e,0x72,0xf7,0x13,0xf7,0x84,0x15,0x36,0x0a,0xad,0xff,0x00,0xd0,0x80,0x00,0x15,0x37,0x0a,0xf7,0x07,0xff,0x01,0x16,0x80,0x00,0x15,0x44,0x0a,0x0e,0x72,0xf7,0x13,0xf7,0x84,0x15,0x36,0x0a,0xad,0xff,0x00,0xd0,0x80,0x00,0x15,0x37,0x0a,0xca,0xff,0x01,0x1f,0x80,0x00,0x15,0x49,0x0a,0x0e,0x72,0xf7,0x13,0xf7,0x84,0x15,0x36,0x0a,0xad,0xff,0x00,0xd0,0x80,0x00,0x15,0x37,0x0a,0x6a,0xff,0x00,0xf5,0x80,0x00,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xfb,0xba,0xde,0xf8,0x8f,0x15,0x39,0x0a,0xfb,0x52,0xf7,0x52,0x15,0x32,0x0a,0x0e,0xfb,0xba,0xde,0xf8,0x8f,0x15,0x39,0x0a,0xa0,0xf7,0x52,0x15,0x44,0x0a,0x0e,0xfb,0xba,0xde,0xf8,0x8f,0x15,0x39,0x0a,0x4d,0xf7,0x5b,0x15,0x49,0x0a,0x0e,0xfb,0xba,0xde,0xf8,0x8f,0x15,0x39,0x0a,0xfb,0x32,0xf7,0x31,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x6b,0xff,0x01,0xa1,0x80,0x00,0xff,0x01,0x80,0x80,0x00,0x15,0x7e,0xb0,0xff,0xff,0xeb,0xd5,0x56,0xff,0x00,0x25,0x2a,0xaa,0xff,0xff,0xe4,0xaa,0xaa,0xff,0x00,0x25,0x55,0x56,0x08,0x53,0xd9,0xda,0xa3,0x7c,0xc1,0x28,0x6d,0x59,0xcf,0x39,0x8b,0xcb,0x32,0x39,0x72,0x9a,0x55,0xf1,0xaa,0xcf,0x2e,0x05,0xff,0xff,0xec,0xaa,0xbc,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xe8,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xe4,0xaa,0x9a,0x8b,0x55,0x8b,0xff,0xff,0xd5,0xd5,0x55,0xff,0xff,0xed,0xaa,0xaa,0xff,0xff,0xe1,0xaa,0xab,0xff,0xff,0xdb,0x55,0x56,0xff,0xff,0xe1,0xaa,0xaa,0xff,0xff,0xdb,0x55,0x56,0xff,0xff,0xf0,0xd5,0x56,0xff,0xff,0xcb,0xaa,0xaa,0x8b,0x47,0x08,0x54,0x07,0x8b,0xff,0xff,0xb9,0x55,0x56,0xff,0x00,0x10,0x55,0x55,0xff,0xff,0xca,0x55,0x55,0xff,0x00,0x20,0xaa,0xab,0xff,0xff,0xdb,0x55,0x55,0xff,0x00,0x20,0xaa,0xab,0xff,0xff,0xdb,0x55,0x56,0xff,0x00,0x2e,0x55,0x55,0xff,0xff,0xed,0xaa,0xab,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x3c,0xaa,0xaa,0x8b,0xff,0x00,0x2e,0xd5,0x56,0xff,0x00,0x12,0x80,0x00,0xac,0xb0,0xac,0xb0,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x37,0x2a,0xaa,0x8b,0xff,0x00,0x49,0x55,0x56,0x08,0xc2,0x07,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0xff,0xf9,0x80,0x00,0xff,0x00,0x27,0x2a,0xaa,0x7e,0xb0,0x08,0xff,0xff,0xce,0x80,0x00,0xff,0xff,0x85,0x80,0x00,0x15,0x53,0x07,0x27,0xff,0xff,0xd8,0x55,0x56,0x59,0xff,0xff,0xb0,0xaa,0xaa,0x1e,0xff,0xff,0xae,0xaa,0xae,0x8b,0xff,0xff,0xd7,0x55,0x56,0xff,0x00,0x32,0x55,0x56,0xff,0xff,0xff,0xff,0xfc,0xff,0x00,0x64,0xaa,0xaa,0x08,0xc4,0x07,0xed,0xff,0x00,0x28,0xaa,0xaa,0xbc,0xff,0x00,0x51,0x55,0x56,0xff,0x00,0x4f,0x55,0x56,0xff,0x00,0x27,0xaa,0xaa,0xff,0xff,0xce,0x55,0x56,0xff,0xff,0x9c,0xaa,0xaa,0x1e,0x0e,0x85,0xd6,0xf8,0x8f,0x15,0x3a,0x0a,0x87,0xf7,0x0f,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x42,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x69,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x55,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0x9a,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xbc,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x54,0xb4,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xab,0x90,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x71,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x3a,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x55,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0x74,0xf7,0x04,0xff,0x00,0x2b,0x80,0x00,0x15,0x3b,0x0a,0xff,0x00,0xe8,0x80,0x00,0xb8,0x15,0x3c,0x0a,0xff,0xff,0x25,0x80,0x00,0xff,0x02,0x60,0x80,0x00,0x15,0x32,0x0a,0x0e,0x74,0xf7,0x04,0xff,0x00,0x2b,0x80,0x00,0x15,0x3b,0x0a,0xff,0x00,0xe8,0x80,0x00,0xb8,0x15,0x3c,0x0a,0xff,0xff,0xbb,0x80,0x00,0xff,0x02,0x60,0x80,0x00,0x15,0x44,0x0a,0x0e,0x74,0xf7,0x04,0xff,0x00,0x2b,0x80,0x00,0x15,0x3b,0x0a,0xff,0x00,0xe8,0x80,0x00,0xb8,0x15,0x3c,0x0a,0xff,0xff,0x87,0x80,0x00,0xff,0x02,0x69,0x80,0x00,0x15,0x49,0x0a,0x0e,0x74,0xf7,0x04,0xff,0x00,0x2b,0x80,0x00,0x15,0x3b,0x0a,0xff,0x00,0xe8,0x80,0x00,0xb8,0x15,0x3c,0x0a,0xff,0xff,0x27,0x80,0x00,0xff,0x02,0x1d,0x80,0x00,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x43,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x68,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x55,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0x6a,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xec,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x54,0xb4,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xab,0x90,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x70,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x3b,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x55,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0x74,0xf7,0x04,0xff,0x00,0x2b,0x80,0x00,0x15,0x3b,0x0a,0xff,0x00,0xe8,0x80,0x00,0xb8,0x15,0x3c,0x0a,0xff,0xff,0x27,0x80,0x00,0xff,0x02,0x3f,0x80,0x00,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x7b,0xf7,0x72,0xf8,0x14,0x15,0xff,0x00,0x09,0x55,0x38,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0d,0x55,0x73,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0d,0x55,0x56,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xf6,0xaa,0xf0,0xff,0x00,0x09,0x55,0x56,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0x66,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x56,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xaa,0x08,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xab,0x18,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0xff,0xff,0xf2,0xaa,0x3e,0x8b,0xff,0xff,0xf2,0xaa,0xc4,0xff,0x00,0x04,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x09,0x55,0x55,0xff,0xff,0xf6,0xaa,0x92,0x08,0xfb,0x39,0x40,0x15,0x49,0xf8,0x22,0xcd,0x07,0xfb,0x7d,0xfb,0x63,0x15,0xff,0x00,0x09,0x55,0x38,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0d,0x55,0x73,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x54,0x8b,0xff,0x00,0x0d,0x55,0x56,0x8b,0xff,0x00,0x0d,0x55,0x42,0xff,0xff,0xfb,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x09,0x55,0x69,0xff,0xff,0xf6,0xaa,0xf0,0xff,0x00,0x09,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xab,0xff,0xff,0xf2,0xaa,0x66,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xab,0x08,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xf6,0xaa,0xab,0xff,0xff,0xfb,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0x8b,0xff,0xff,0xf2,0xaa,0xab,0x8b,0xff,0xff,0xf2,0xaa,0xb2,0xff,0x00,0x04,0xaa,0xab,0xff,0xff,0xf4,0xaa,0xaa,0xff,0x00,0x09,0x55,0x55,0xff,0xff,0xf6,0xaa,0xa4,0x08,0x0e,0x74,0xf8,0x24,0xf8,0x5d,0x15,0xb9,0xd7,0x5f,0x8b,0x6c,0x58,0x05,0xff,0xff,0xe0,0xaa,0xaa,0xff,0x00,0x15,0x55,0x56,0x64,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xd1,0x55,0x56,0x8b,0xff,0xff,0xc4,0xaa,0xab,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xee,0x55,0x55,0xff,0xff,0xcb,0x55,0x56,0x8b,0x43,0x08,0x23,0x07,0x8b,0xff,0xff,0xbd,0x55,0x56,0x9b,0xff,0xff,0xcc,0xff,0xff,0xab,0xff,0xff,0xdc,0xaa,0xab,0x08,0x5b,0x3c,0xb7,0x8b,0xac,0xc1,0x05,0xff,0x00,0x1f,0x55,0x50,0x77,0xff,0x00,0x27,0x55,0x55,0x81,0xff,0x00,0x2f,0x55,0x5b,0x8b,0xc5,0x8b,0xff,0x00,0x2e,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0xae,0xff,0x00,0x21,0x55,0x56,0xae,0xff,0x00,0x21,0x55,0x54,0xff,0x00,0x11,0x80,0x00,0xff,0x00,0x34,0xaa,0xab,0x8b,0xff,0x00,0x48,0x00,0x01,0x08,0xf3,0x07,0x8b,0xcd,0xff,0xff,0xf0,0xaa,0xaa,0xff,0x00,0x32,0x55,0x56,0xff,0xff,0xe1,0x55,0x56,0xff,0x00,0x22,0xaa,0xaa,0x08,0xfb,0x93,0xfb,0xee,0x15,0x7f,0xff,0x00,0x19,0x55,0x55,0x85,0xff,0x00,0x1f,0xaa,0xab,0x8b,0xb1,0x08,0xeb,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x27,0x55,0x55,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x1b,0xaa,0xaa,0xff,0xff,0xf7,0x55,0x56,0x9f,0xff,0xff,0xee,0xaa,0xaa,0x08,0xa3,0x6b,0x15,0xff,0x00,0x0b,0x55,0x56,0x73,0xff,0x00,0x05,0xaa,0xaa,0xff,0xff,0xe1,0x55,0x56,0x8b,0xff,0xff,0xda,0xaa,0xaa,0x08,0x2b,0x07,0x8b,0x53,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xd8,0xd5,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xe1,0xd5,0x56,0xff,0xff,0xf4,0xd5,0x56,0x65,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xdb,0x55,0x55,0xff,0xff,0xff,0xff,0xfe,0x6f,0xff,0x00,0x08,0x55,0x56,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x10,0xaa,0xac,0x08,0x0e,0x85,0xff,0x00,0x79,0x80,0x00,0xff,0x00,0x2b,0x80,0x00,0x15,0x3e,0x0a,0xff,0x00,0x0d,0x80,0x00,0xff,0x02,0x8d,0x80,0x00,0x15,0x32,0x0a,0x0e,0x85,0xff,0x00,0x79,0x80,0x00,0xff,0x00,0x2b,0x80,0x00,0x15,0x3e,0x0a,0xff,0x00,0xa3,0x80,0x00,0xff,0x02,0x8d,0x80,0x00,0x15,0x44,0x0a,0x0e,0x85,0xff,0x00,0x79,0x80,0x00,0xff,0x00,0x2b,0x80,0x00,0x15,0x3e,0x0a,0xff,0x00,0x6f,0x80,0x00,0xff,0x02,0x96,0x80,0x00,0x15,0x49,0x0a,0x0e,0x85,0xff,0x00,0x79,0x80,0x00,0xff,0x00,0x2b,0x80,0x00,0x15,0x3e,0x0a,0xff,0x00,0x0f,0x80,0x00,0xff,0x02,0x6c,0x80,0x00,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x32,0xf8,0x3d,0xf8,0x8f,0x15,0x3f,0x0a,0x98,0xf9,0x84,0x15,0x44,0x0a,0x0e,0x79,0xd6,0xf9,0x46,0x15,0xfd,0xde,0xcf,0xf7,0x6f,0x07,0xa7,0xff,0xff,0xcf,0x55,0x55,0xff,0x00,0x2d,0xaa,0xab,0xff,0xff,0xe7,0xaa,0xab,0xff,0x00,0x3f,0x55,0x55,0x8b,0xbd,0x8b,0xb4,0xff,0x00,0x10,0xd5,0x55,0xab,0xff,0x00,0x21,0xaa,0xab,0xab,0xff,0x00,0x21,0xaa,0xab,0x9b,0xff,0x00,0x34,0x7f,0xff,0x8b,0xff,0x00,0x47,0x55,0x56,0x08,0xf3,0x07,0x8b,0xff,0x00,0x47,0x55,0x56,0xff,0xff,0xef,0xaa,0xaa,0xff,0x00,0x34,0x80,0x00,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x21,0xaa,0xaa,0xff,0xff,0xdf,0x55,0x56,0xff,0x00,0x21,0xaa,0xaa,0xff,0xff,0xd5,0xaa,0xaa,0xff,0x00,0x10,0xd5,0x56,0x57,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xe6,0x2a,0xaa,0xff,0xff,0xf9,0x55,0x56,0xff,0xff,0xe9,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xe6,0xff,0xff,0xed,0xd5,0x55,0xff,0xff,0xec,0xaa,0xaa,0x7d,0xff,0xff,0xe6,0xaa,0x70,0x08,0xf7,0x92,0x07,0xf7,0x84,0xfc,0x78,0x15,0x35,0x0a,0x0e,0x32,0xf8,0x3d,0xf8,0x8f,0x15,0x3f,0x0a,0xfb,0x1b,0xf9,0x63,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xfb,0xba,0xde,0xf8,0x8f,0x15,0x39,0x0a,0x0e,0xf8,0x01,0xf8,0xb3,0xf9,0x04,0x15,0xf7,0xc2,0xcd,0xfc,0x0a,0x5b,0x06,0x63,0xb1,0xff,0xff,0xc8,0xaa,0xaa,0x9e,0xff,0xff,0xb9,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xae,0x8b,0xff,0xff,0xc5,0xd5,0x55,0xff,0xff,0xea,0xd5,0x54,0xff,0xff,0xd4,0xff,0xfd,0xff,0xff,0xd5,0xaa,0xac,0x60,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xea,0x80,0x00,0xff,0xff,0xbd,0x2a,0xa8,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0x2f,0xff,0x00,0x15,0x55,0x55,0x48,0xff,0x00,0x2a,0xaa,0xab,0x61,0xff,0x00,0x2a,0xaa,0xab,0x61,0xff,0x00,0x39,0xff,0xff,0x76,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x46,0xaa,0x92,0x8b,0xff,0x00,0x37,0xaa,0xaa,0x9e,0xff,0x00,0x28,0xaa,0xc4,0xb1,0x08,0x5a,0xf8,0x0a,0xcd,0xfb,0xc2,0xf7,0x3b,0x07,0xff,0x00,0x00,0xaa,0xac,0xff,0x00,0x07,0x55,0x37,0xff,0x00,0x00,0x55,0x54,0xff,0x00,0x0b,0x55,0x55,0x8b,0xff,0x00,0x0f,0x55,0x74,0x08,0xbe,0xf7,0x8e,0xcd,0xfb,0x8e,0xb3,0x07,0x8b,0xff,0x00,0x0f,0x55,0x56,0xff,0xff,0xff,0xaa,0xac,0xff,0x00,0x0b,0x55,0x54,0xff,0xff,0xff,0x55,0x54,0xff,0x00,0x07,0x55,0x56,0x08,0x43,0xfb,0x62,0x15,0x2d,0x0a,0x0e,0xf7,0xba,0xf8,0x52,0xf7,0x84,0x15,0xf7,0xd1,0xc7,0x06,0x8b,0xff,0x00,0x48,0xaa,0xaa,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x35,0xd5,0x56,0x68,0xae,0x68,0xae,0xff,0xff,0xd1,0x2a,0xac,0xff,0x00,0x11,0x80,0x00,0xff,0xff,0xc5,0x55,0x54,0x8b,0x69,0x8b,0xff,0xff,0xe1,0x80,0x00,0xff,0xff,0xf9,0xd5,0x56,0x70,0xff,0xff,0xf3,0xaa,0xaa,0x70,0xff,0xff,0xf3,0xaa,0xe6,0xff,0xff,0xea,0x2a,0xaa,0xff,0xff,0xed,0x2a,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xe6,0xaa,0x70,0x6b,0xbd,0x56,0xa4,0x41,0x8b,0xff,0xff,0xc4,0xaa,0xab,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0x08,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xee,0x55,0x55,0xff,0xff,0xcb,0x55,0x56,0x8b,0x43,0x08,0x23,0x07,0x8b,0xff,0xff,0xb7,0x55,0x56,0xff,0x00,0x11,0xaa,0xaa,0xff,0xff,0xcb,0x2a,0xaa,0xff,0x00,0x23,0x55,0x56,0x6a,0xff,0x00,0x23,0x55,0x50,0x6a,0xff,0x00,0x2f,0x55,0x55,0xff,0xff,0xef,0x80,0x00,0xff,0x00,0x3b,0x55,0x5b,0x8b,0xff,0x00,0x4a,0xaa,0xaa,0x8b,0xc0,0xa4,0xff,0x00,0x1f,0x55,0x56,0xbd,0xff,0x00,0x21,0x55,0x56,0x59,0xff,0x00,0x35,0x55,0x54,0x72,0xff,0x00,0x49,0x55,0x56,0x8b,0xc5,0x8b,0xff,0x00,0x2d,0x80,0x00,0xff,0x00,0x0e,0x55,0x55,0xac,0xff,0x00,0x1c,0xaa,0xab,0xac,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0x80,0x00,0xb1,0x8b,0xff,0x00,0x2f,0x55,0x56,0x08,0x90,0x49,0x88,0x07,0x8b,0xff,0xff,0xe1,0x55,0x56,0xff,0xff,0xf5,0xd5,0x54,0x73,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xe3,0xd5,0x54,0xff,0xff,0xf7,0x55,0x56,0x67,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd6,0xaa,0xac,0x8b,0xff,0xff,0xdf,0xaa,0xaa,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xe8,0xaa,0xaa,0xa2,0xff,0xff,0xe8,0xaa,0xaa,0xa2,0xff,0xff,0xf4,0x55,0x56,0xff,0x00,0x28,0x2a,0xaa,0x8b,0xff,0x00,0x39,0x55,0x56,0x08,0x47,0xe7,0x15,0x2b,0x07,0x8b,0x53,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xd8,0xd5,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xe1,0xd5,0x56,0xff,0xff,0xf4,0xd5,0x56,0x65,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd8,0xaa,0xab,0x8b,0x6c,0xff,0x00,0x0b,0x2a,0xaa,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x27,0x2a,0xaa,0x8b,0xc3,0x08,0xeb,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x27,0x55,0x55,0x8b,0xb1,0x8b,0xff,0x00,0x1e,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe9,0xaa,0xc2,0xff,0x00,0x0b,0x2a,0xaa,0xff,0xff,0xd9,0x2a,0xaa,0x8b,0xff,0xff,0xc8,0xaa,0x94,0x08,0xff,0x00,0x65,0x80,0x00,0xff,0x00,0x74,0x80,0x00,0x15,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1e,0x7f,0xfe,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x26,0xaa,0xac,0x8b,0xb1,0x8b,0xa9,0xff,0xff,0xf5,0x2a,0xaa,0xa1,0xff,0xff,0xea,0x55,0x56,0xa1,0xff,0xff,0xea,0x55,0x56,0x96,0xff,0xff,0xdb,0x2a,0xaa,0x8b,0x57,0x08,0x79,0xfb,0x8c,0x96,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x16,0x55,0x56,0x08,0x0e,0x9d,0xf0,0xb8,0x15,0x2e,0x0a,0xb0,0xf9,0xe1,0x15,0x4c,0x0a,0x0e,0x49,0xec,0xad,0x15,0x3d,0x0a,0x8a,0xf9,0x35,0x15,0x4c,0x0a,0x0e,0x6e,0xf7,0xb2,0xf7,0xb5,0x15,0x30,0x0a,0xfb,0x34,0xf9,0xe3,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0x7f,0xf8,0x74,0xcd,0x15,0x31,0x0a,0xfb,0xf9,0xfa,0x0e,0x15,0x4c,0x0a,0x0e,0x43,0xf8,0x21,0xf8,0x50,0x15,0x40,0x0a,0x61,0xf9,0x18,0x15,0x4c,0x0a,0x0e,0xfb,0x0e,0x98,0x35,0x15,0x49,0xa7,0x07,0xbb,0x8b,0xff,0x00,0x23,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x17,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x17,0x55,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x0f,0xaa,0xab,0xff,0x00,0x26,0xaa,0xab,0x93,0xff,0x00,0x36,0xaa,0xab,0x08,0xbf,0xf7,0xf1,0xf7,0x07,0x8b,0x8b,0xca,0x22,0x8b,0xa0,0xf7,0x19,0x05,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x1e,0xaa,0xac,0xff,0x00,0x08,0x80,0x00,0xff,0x00,0x15,0x2a,0xa8,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x0b,0xaa,0xac,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x0b,0xaa,0xac,0xff,0x00,0x12,0xd5,0x54,0xff,0x00,0x05,0xd5,0x54,0xff,0x00,0x19,0x55,0x56,0x8b,0x08,0xac,0xcd,0x6b,0x06,0xff,0xff,0xd0,0xaa,0xaa,0x8b,0xff,0xff,0xdc,0x80,0x00,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xe8,0x55,0x56,0x74,0xff,0xff,0xe8,0x55,0x55,0x74,0xff,0xff,0xf0,0x2a,0xab,0xff,0xff,0xda,0x2a,0xac,0x83,0xff,0xff,0xcb,0x55,0x54,0x08,0x77,0xfb,0x18,0x2c,0x8b,0x8b,0x4c,0xe0,0x8b,0x57,0xfb,0xf3,0x05,0xff,0xff,0xfb,0x55,0x56,0x6b,0xff,0xff,0xf7,0x80,0x00,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf3,0xaa,0xaa,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xec,0x80,0x00,0xff,0xff,0xfa,0x55,0x56,0xff,0xff,0xe5,0x55,0x56,0x8b,0x08,0x0e,0x6f,0xf7,0x72,0xf9,0x56,0x15,0x49,0x0a,0x0e,0x6f,0xf7,0x07,0xf9,0x57,0x15,0x4c,0x0a,0x0e,0x6f,0xf7,0x6a,0xf9,0x3c,0x15,0x31,0xd3,0xe5,0x07,0x0e,0x6f,0xff,0x00,0xb8,0x80,0x00,0xf8,0xdd,0x15,0x4a,0x0a,0xff,0x00,0x66,0x80,0x00,0xa6,0x15,0x4b,0x0a,0x0e,0x6f,0xf7,0x12,0xf9,0x0a,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x51,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x5a,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x55,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xab,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x55,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xab,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xaa,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x56,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x54,0xb4,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xaa,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xaa,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xab,0x90,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x70,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x3b,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xab,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x55,0x85,0xff,0xff,0xf5,0x55,0x55,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xab,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0xfc,0xa4,0xfb,0x12,0xf9,0x4d,0x15,0x32,0x0a,0x0e,0xfc,0xa4,0xa3,0xf9,0x4d,0x15,0x44,0x0a,0x0e,0xfc,0xa4,0x6f,0xf9,0x56,0x15,0x49,0x0a,0x0e,0xfc,0xa4,0xfb,0x10,0xf9,0x0a,0x15,0x4e,0x07,0xff,0x00,0x0d,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x0a,0x2a,0xa8,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x05,0xaa,0xac,0x96,0xff,0x00,0x02,0xd5,0x54,0xff,0x00,0x0c,0xaa,0xaa,0x8b,0xff,0x00,0x05,0x55,0x55,0x8b,0xff,0x00,0x05,0xaa,0xab,0xff,0xff,0xff,0x2a,0xac,0x91,0xff,0xff,0xfe,0x55,0x54,0x91,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x06,0x55,0x55,0xff,0xff,0xfd,0x80,0x00,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x06,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0xff,0x00,0x04,0x55,0x55,0xff,0xff,0xfd,0xaa,0xa8,0x8d,0xff,0xff,0xfe,0xaa,0xac,0xff,0x00,0x0c,0xaa,0xab,0xff,0xff,0xf8,0xaa,0xac,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xfa,0xaa,0xa8,0xff,0x00,0x08,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0x08,0xff,0x00,0x08,0xaa,0xab,0xff,0xff,0xfc,0xaa,0xac,0x95,0xff,0xff,0xfe,0x55,0x54,0xff,0x00,0x0b,0x55,0x55,0x8b,0xff,0x00,0x18,0xaa,0xaa,0x8b,0xa2,0xff,0x00,0x0c,0x55,0x54,0xff,0x00,0x15,0x55,0x56,0xff,0x00,0x18,0xaa,0xac,0x08,0xc8,0x07,0x7d,0xff,0xff,0xf1,0x55,0xf8,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xf5,0xd5,0x54,0x82,0xff,0xff,0xfa,0x54,0xb4,0x82,0xff,0xff,0xfa,0x55,0x54,0xff,0xff,0xf5,0x80,0x00,0xff,0xff,0xfd,0x2a,0xac,0x7f,0x8b,0xff,0xff,0xf6,0xaa,0xab,0x8b,0xff,0xff,0xf7,0x80,0x00,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x2a,0xab,0xff,0x00,0x04,0xaa,0xac,0x81,0x91,0x7f,0xff,0x00,0x06,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xaa,0x90,0xff,0xff,0xf7,0x55,0x56,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf7,0x55,0x55,0xff,0x00,0x03,0x55,0x54,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x01,0xaa,0xac,0xff,0xff,0xf5,0x55,0x56,0x8b,0x08,0xff,0xff,0xf2,0xaa,0xaa,0x8b,0x7f,0x88,0xff,0xff,0xf5,0x55,0x56,0x85,0xff,0xff,0xf5,0x55,0x56,0x85,0x80,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xf2,0xaa,0xac,0x08,0x0e,0xfc,0xa4,0xfb,0x10,0xf9,0x2c,0x15,0x35,0xd7,0xe1,0x07,0xea,0x16,0x35,0xd7,0xe1,0x07,0x0e,0xfc,0xa4,0xff,0xff,0xbe,0x80,0x00,0xf8,0xdd,0x15,0x4a,0x0a,0xff,0x00,0x66,0x80,0x00,0xa6,0x15,0x81,0x81,0xff,0xff,0xf3,0xaa,0xab,0x86,0xff,0xff,0xf1,0x55,0x55,0x8b,0xff,0xff,0xf1,0x55,0x55,0x8b,0xff,0xff,0xf3,0xaa,0xab,0x90,0x81,0x95,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x55,0x2c,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x55,0x80,0x95,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xab,0x8b,0xff,0x00,0x0e,0xaa,0xab,0x8b,0xff,0x00,0x0c,0x55,0x55,0xff,0xff,0xfa,0xd5,0x54,0x95,0xff,0xff,0xf5,0xaa,0xac,0x08,0x95,0xff,0xff,0xf5,0xaa,0xac,0x90,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x86,0xff,0xff,0xf3,0x55,0x54,0x81,0x81,0x08,0x0e,0xfb,0x03,0xf8,0x10,0x04,0x49,0xf8,0x35,0xcd,0x07,0x0e,0xf7,0xc5,0xf8,0x10,0x04,0x49,0xf9,0xd5,0xcd,0x07,0x0e,0xfb,0xf8,0xf7,0x0b,0xf8,0x83,0x15,0x4d,0x0a,0x99,0xf7,0x57,0x15,0x0e,0xfb,0xf8,0xc0,0xf9,0x46,0x15,0x26,0x0a,0x0e,0xfb,0xf8,0xc0,0xe8,0x15,0x26,0x0a,0x0e,0xfb,0x70,0xf7,0x0a,0xf8,0x83,0x15,0x4d,0x0a,0xf7,0x5f,0x16,0x4d,0x0a,0x35,0xf7,0x57,0x15,0x0e,0xfb,0x70,0xc0,0xf9,0x47,0x15,0x26,0x0a,0xd2,0x16,0x26,0x0a,0x0e,0xfb,0x70,0xf7,0x51,0xe8,0x15,0x26,0x0a,0xfb,0x5e,0x16,0x26,0x0a,0x0e,0x8a,0xf8,0x58,0xf8,0x11,0x15,0xcc,0xfb,0x2c,0xf7,0x88,0x42,0xfb,0x88,0xfb,0x2c,0x4a,0xf7,0x2c,0xfc,0xa9,0xd4,0xf8,0xa9,0x07,0x0e,0x8a,0xf7,0xc0,0xf8,0x14,0x15,0xf7,0x2c,0xcd,0xfb,0x2c,0xf7,0x84,0x42,0xfb,0x84,0xfb,0x2c,0x49,0xf7,0x2c,0xfb,0x77,0xfb,0x2c,0x49,0xf7,0x2c,0xfb,0x87,0xd4,0x06,0xf7,0x87,0xf7,0x2c,0xcd,0xfb,0x2c,0x07,0x0e,0x52,0xff,0x00,0x93,0x80,0x00,0xff,0x00,0xdc,0x80,0x00,0x15,0xa2,0x74,0xff,0x00,0x1d,0x2a,0xab,0xff,0xff,0xf4,0x80,0x00,0xff,0x00,0x23,0x55,0x55,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x1d,0x55,0x54,0xff,0x00,0x0b,0x80,0x00,0xff,0x00,0x17,0x55,0x56,0xa2,0xff,0x00,0x17,0x55,0x56,0xa2,0xff,0x00,0x0b,0xaa,0xaa,0xff,0x00,0x1d,0x2a,0xaa,0x8b,0xff,0x00,0x23,0x55,0x56,0x8b,0xff,0x00,0x23,0x55,0x56,0xff,0xff,0xf4,0x55,0x56,0xff,0x00,0x1d,0x2a,0xaa,0xff,0xff,0xe8,0xaa,0xaa,0xa2,0xff,0xff,0xe8,0xaa,0xbc,0xa2,0xff,0xff,0xe2,0xaa,0xaa,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xdc,0xaa,0x9a,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe2,0xd5,0x55,0xff,0xff,0xf4,0x80,0x00,0x74,0x74,0x08,0x74,0x74,0xff,0xff,0xf4,0x80,0x00,0xff,0xff,0xe2,0xd5,0x56,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0x8b,0xff,0xff,0xdc,0xaa,0xaa,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xe2,0xd5,0x55,0xa2,0xff,0xff,0xe9,0x00,0x01,0x08,0x0e,0xf7,0x1c,0xc0,0xe7,0x15,0x2f,0xe3,0xe7,0x07,0xf8,0x12,0x16,0x2f,0xe3,0xe7,0x07,0xfb,0xd7,0x16,0x2f,0xe3,0xe7,0x07,0x0e,0xf9,0x09,0xd2,0xf7,0xc4,0x15,0x20,0x0a,0xf8,0x87,0xf8,0x16,0x15,0x21,0x0a,0xfc,0x40,0xff,0xfe,0xa8,0x80,0x00,0x15,0x22,0x0a,0xf8,0x05,0xff,0xfe,0xc4,0x80,0x00,0x15,0x23,0x0a,0xf7,0xdb,0x16,0xff,0x00,0x13,0x55,0x54,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x1e,0xaa,0xac,0xff,0xff,0xf3,0xaa,0xab,0xb5,0x8b,0xb5,0x8b,0xff,0x00,0x1e,0xd5,0x58,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x13,0xaa,0xa8,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x13,0xaa,0xa8,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x09,0xd5,0x58,0xb0,0x8b,0xff,0x00,0x31,0x55,0x56,0x08,0xf7,0x1f,0x07,0x8b,0xbb,0xff,0xff,0xf6,0x2a,0xa8,0xff,0x00,0x23,0xd5,0x56,0xff,0xff,0xec,0x55,0x58,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xec,0x55,0x58,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xe1,0x2a,0xa8,0xff,0x00,0x0b,0xd5,0x56,0x61,0x8b,0x63,0x8b,0xff,0xff,0xe1,0xd5,0x54,0x7f,0xff,0xff,0xeb,0xaa,0xac,0x73,0xff,0xff,0xeb,0xaa,0xac,0x73,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xdc,0x55,0x56,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0x08,0xfb,0x1f,0x07,0x8b,0xff,0xff,0xce,0xaa,0xab,0xff,0x00,0x09,0xaa,0xac,0xff,0xff,0xda,0xff,0xff,0xff,0x00,0x13,0x55,0x54,0xff,0xff,0xe7,0x55,0x56,0x08,0xfb,0x55,0xff,0x00,0x2a,0x80,0x00,0x15,0x24,0x0a,0xf7,0xdb,0x16,0xff,0xff,0xf8,0xac,0xa8,0xff,0xff,0xf1,0xaa,0xab,0x7d,0xff,0xff,0xf8,0xd5,0x55,0xff,0xff,0xeb,0x53,0x58,0x8b,0x77,0x8b,0xff,0xff,0xf2,0x2a,0xac,0xff,0x00,0x07,0x2a,0xab,0xff,0xff,0xf8,0x55,0x54,0xff,0x00,0x0e,0x55,0x55,0xff,0xff,0xf8,0x55,0x54,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xfc,0x2a,0xac,0xff,0x00,0x17,0xd5,0x55,0x8b,0xff,0x00,0x21,0x55,0x55,0x08,0xf7,0x16,0x07,0x8b,0xab,0xff,0x00,0x03,0xd5,0x54,0xa2,0xff,0x00,0x07,0xaa,0xac,0x99,0xff,0x00,0x07,0xaa,0xac,0x99,0xff,0x00,0x0d,0xd5,0x54,0x92,0x9f,0x8b,0xff,0x00,0x13,0xfe,0x04,0x8b,0xff,0x00,0x0d,0xd5,0x54,0x84,0xff,0x00,0x07,0xac,0xa8,0x7d,0xff,0x00,0x07,0xaa,0xa8,0x7d,0xff,0x00,0x03,0xd5,0x58,0x74,0x8b,0x6b,0x08,0xfb,0x16,0x07,0x8b,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xfc,0x55,0x58,0xff,0xff,0xe8,0x2a,0xab,0xff,0xff,0xf8,0xaa,0xa8,0xff,0xff,0xf1,0xaa,0xaa,0x08,0x0e,0xfb,0x7d,0xa4,0xf7,0x9c,0x15,0x41,0x0a,0x0e,0xfb,0x70,0xd6,0xf7,0x29,0x15,0x46,0x0a,0x0e,0x99,0xff,0x00,0x91,0x80,0x00,0xbc,0x15,0xff,0x00,0x1f,0xaa,0xab,0xff,0xff,0xd8,0xaa,0xab,0xff,0x00,0x30,0xd5,0x55,0xff,0xff,0xec,0x55,0x55,0xcd,0x8b,0xbf,0x8b,0xff,0x00,0x2a,0x80,0x00,0x99,0xac,0xa7,0xac,0xa7,0xff,0x00,0x12,0xd5,0x56,0xb2,0xff,0x00,0x04,0xaa,0xaa,0xbd,0x08,0x46,0x06,0x7f,0x4d,0x65,0x6c,0x4b,0x8b,0xff,0xff,0xd4,0xaa,0xab,0x8b,0xff,0xff,0xe0,0xd5,0x55,0xff,0x00,0x0d,0x80,0x00,0x78,0xa6,0x78,0xa6,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x23,0xd5,0x55,0x8b,0xff,0x00,0x2c,0xaa,0xab,0x08,0xbe,0xf7,0x40,0x07,0x95,0xc4,0xfb,0x4a,0x8b,0x8b,0xd3,0xf7,0x58,0x8b,0x96,0xc3,0xfb,0x63,0x8b,0x8b,0xc0,0x05,0x8b,0xff,0x00,0x28,0xaa,0xac,0xff,0x00,0x09,0x2a,0xab,0xff,0x00,0x21,0xaa,0xa8,0xff,0x00,0x12,0x55,0x55,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x12,0x55,0x47,0xff,0x00,0x1a,0xaa,0xac,0xff,0x00,0x1e,0xd5,0x55,0xff,0x00,0x0d,0x55,0x54,0xff,0x00,0x2b,0x55,0x64,0x8b,0xff,0x00,0x22,0xaa,0xaa,0x8b,0xff,0x00,0x1a,0x80,0x00,0x83,0xff,0x00,0x12,0x55,0x56,0x7b,0xff,0x00,0x12,0x55,0x56,0x7b,0xff,0x00,0x0c,0x2a,0xaa,0x74,0x91,0x6d,0x08,0xcc,0x06,0x87,0xff,0x00,0x31,0x55,0x30,0xff,0xff,0xee,0x55,0x56,0xff,0x00,0x26,0xd5,0x54,0xff,0xff,0xe0,0xaa,0xaa,0xff,0x00,0x1c,0x55,0x7c,0xff,0xff,0xe0,0xaa,0xc2,0xff,0x00,0x1c,0x55,0x54,0xff,0xff,0xd5,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xac,0xff,0xff,0xca,0xaa,0x94,0x8b,0xff,0xff,0xbf,0x55,0x56,0x8b,0xff,0xff,0xcf,0x7f,0xff,0xff,0xff,0xec,0xd5,0x54,0xff,0xff,0xdf,0xaa,0xab,0xff,0xff,0xd9,0xaa,0xac,0xff,0xff,0xdf,0xaa,0xab,0xff,0xff,0xd9,0xaa,0xac,0xff,0xff,0xef,0xd5,0x55,0xff,0xff,0xcd,0xd5,0x54,0x8b,0x4d,0x08,0x57,0x4f,0x53,0xc7,0x43,0x4f,0x52,0xc7,0x5a,0x07,0x8b,0xff,0xff,0xbe,0xaa,0xac,0xff,0x00,0x0f,0xd5,0x56,0xff,0xff,0xcb,0xaa,0xaa,0xff,0x00,0x1f,0xaa,0xaa,0xff,0xff,0xd8,0xaa,0xaa,0x08,0x0e,0xf7,0xb7,0xf7,0x2f,0xf9,0x11,0x15,0xfb,0xe9,0xc6,0xf7,0xe9,0xf7,0x06,0xc0,0xfb,0xb4,0x56,0x07,0xf7,0xf9,0xc0,0x15,0xfc,0x1e,0xc3,0xf7,0x99,0x8d,0x07,0xe7,0xfb,0x5f,0xb6,0x8b,0xe6,0xf7,0x5f,0x8d,0x8b,0x8b,0xfb,0x99,0xc3,0x8b,0x8b,0xf8,0x1e,0x55,0x8b,0xfb,0x06,0xfb,0x9c,0x88,0x8b,0xfb,0x09,0xf7,0x9c,0x05,0x0e,0xac,0xf7,0x4b,0xf8,0xcb,0x15,0x38,0x0a,0xf7,0x77,0x16,0x39,0x0a,0x45,0xf7,0x41,0x15,0x31,0xd3,0xe5,0x07,0x0e,0xd3,0xf7,0x4b,0xf8,0xcb,0x15,0x38,0x0a,0xf7,0x8f,0xfc,0x6d,0x15,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xe9,0x55,0x55,0xaa,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x28,0xaa,0xaa,0x8b,0x08,0xbb,0xc9,0x62,0x06,0xff,0xff,0xe9,0x55,0x56,0x8b,0xff,0xff,0xef,0xaa,0xaa,0x91,0x81,0x97,0x81,0x97,0x86,0x9e,0x8b,0xa5,0x08,0xf8,0xbd,0x47,0xfc,0xc1,0x07,0x8b,0xff,0xff,0xd4,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xde,0xff,0xff,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xe9,0x55,0x56,0x08,0x0e,0xfc,0xa4,0x0e,0xd3,0x0e,0xed,0xf8,0x67,0xf8,0x59,0x15,0xf7,0x07,0xc1,0xfb,0x07,0xf7,0x28,0x06,0x47,0x6b,0x8b,0xfb,0x08,0xfb,0x6d,0x8b,0x8b,0xf7,0x28,0x46,0x6b,0x8b,0xfb,0x08,0x3c,0x8b,0x8b,0x55,0xda,0x8b,0x8b,0xfb,0xdb,0x05,0x8b,0xff,0xff,0xd8,0xaa,0xab,0xff,0x00,0x0a,0xd5,0x56,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x15,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xab,0xff,0xff,0xe9,0xaa,0xab,0xff,0x00,0x1e,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x55,0xff,0x00,0x26,0xaa,0xab,0x8b,0x08,0xbe,0xc7,0x63,0x06,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xea,0x55,0x55,0xa2,0xb9,0x1f,0xf7,0xd8,0xf7,0x6d,0xfb,0xdb,0x07,0x8b,0xff,0xff,0xd8,0xaa,0xab,0xff,0x00,0x0a,0xd5,0x56,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x15,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x15,0xaa,0x8e,0xff,0xff,0xe9,0xaa,0xab,0xff,0x00,0x1e,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x55,0xff,0x00,0x26,0xaa,0xc8,0x8b,0x08,0xbe,0xc7,0x63,0x06,0x5f,0x75,0xa2,0xb9,0x1f,0x0e,0xfb,0x5d,0xd2,0xaa,0x15,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xab,0xb5,0x8b,0xb5,0x8b,0xff,0x00,0x1e,0xd5,0x55,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x13,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x09,0xd5,0x56,0xb0,0x8b,0xff,0x00,0x31,0x55,0x56,0x08,0xf7,0x1f,0x07,0x8b,0xbb,0xff,0xff,0xf6,0x2a,0xaa,0xff,0x00,0x23,0xd5,0x56,0xff,0xff,0xec,0x55,0x56,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x0b,0xd5,0x56,0x61,0x8b,0x63,0x8b,0xff,0xff,0xe1,0xd5,0x56,0x7f,0xff,0xff,0xeb,0xaa,0xaa,0x73,0xff,0xff,0xeb,0xaa,0xaa,0x73,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xdc,0x55,0x56,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0x08,0xfb,0x1f,0x07,0x8b,0xff,0xff,0xce,0xaa,0xab,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xda,0xff,0xff,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0x08,0xf7,0x1a,0xff,0x00,0x2a,0x80,0x00,0x15,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xab,0x7d,0xff,0xff,0xf8,0xd5,0x55,0xff,0xff,0xeb,0x55,0x55,0x8b,0x77,0x8b,0xff,0xff,0xf2,0x2a,0xab,0xff,0x00,0x07,0x2a,0xab,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x0e,0x55,0x55,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xfc,0x2a,0xaa,0xff,0x00,0x17,0xd5,0x55,0x8b,0xff,0x00,0x21,0x55,0x55,0x08,0xf7,0x16,0x07,0x8b,0xab,0xff,0x00,0x03,0xd5,0x56,0xa2,0xff,0x00,0x07,0xaa,0xaa,0x99,0xff,0x00,0x07,0xaa,0xab,0x99,0xff,0x00,0x0d,0xd5,0x55,0x92,0x9f,0x8b,0x9f,0x8b,0xff,0x00,0x0d,0xd5,0x55,0x84,0xff,0x00,0x07,0xaa,0xab,0x7d,0xff,0x00,0x07,0xaa,0xab,0x7d,0xff,0x00,0x03,0xd5,0x55,0x74,0x8b,0x6b,0x08,0xfb,0x16,0x07,0x8b,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xfc,0x55,0x55,0xff,0xff,0xe8,0x2a,0xab,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xaa,0x08,0x0e,0xfb,0xc6,0xee,0xf7,0xec,0x15,0x45,0x0a,0x0e,0xfb,0x63,0xb8,0xbf,0x15,0x57,0xf7,0x7e,0xc6,0xfb,0x27,0x07,0xf6,0xf7,0x27,0x05,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x11,0x55,0x47,0xff,0x00,0x09,0xd5,0x55,0xff,0x00,0x10,0x55,0x55,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x0f,0x55,0x64,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x03,0x2a,0xaa,0xff,0x00,0x10,0xaa,0xaa,0x8b,0x9d,0x08,0x96,0x07,0x8b,0xab,0xff,0xff,0xf5,0x55,0x56,0xa5,0xff,0xff,0xea,0xaa,0xaa,0x9f,0xff,0xff,0xea,0xaa,0xab,0x9f,0xff,0xff,0xe3,0xaa,0xaa,0x95,0xff,0xff,0xdc,0xaa,0xab,0x8b,0x67,0x8b,0xff,0xff,0xe3,0x2a,0xaa,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xe4,0xd5,0x56,0x8b,0x69,0x08,0x7c,0xcd,0x96,0x07,0x8b,0x9f,0xff,0x00,0x04,0x80,0x00,0x9a,0x94,0x95,0x94,0x95,0xff,0x00,0x0c,0x80,0x00,0x90,0x9b,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8b,0xff,0x00,0x0c,0x2a,0xab,0xff,0xff,0xfb,0x2a,0xaa,0x94,0xff,0xff,0xf6,0x55,0x56,0x94,0xff,0xff,0xf6,0x55,0x56,0xff,0x00,0x04,0x80,0x00,0xff,0xff,0xf2,0x80,0x00,0x8b,0xff,0xff,0xee,0xaa,0xaa,0x08,0x83,0x07,0x8b,0xff,0xff,0xf4,0xaa,0xaa,0x89,0xff,0xff,0xf5,0x55,0x56,0x87,0x81,0x87,0x81,0xff,0xff,0xf9,0xaa,0xab,0x80,0xff,0xff,0xf7,0x55,0x55,0x7f,0x08,0x0e,0xfb,0x65,0xd1,0xff,0x00,0x16,0x80,0x00,0x15,0xff,0x00,0x14,0xaa,0xaa,0x78,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x24,0xaa,0xab,0x8b,0xaf,0x8b,0xff,0x00,0x1d,0x2a,0xab,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x1c,0x2a,0xab,0x8b,0xff,0x00,0x22,0xaa,0xab,0x08,0x97,0x07,0x8b,0xff,0x00,0x17,0x55,0x4c,0x86,0xff,0x00,0x14,0x55,0x55,0x81,0xff,0x00,0x11,0x55,0x5f,0x81,0xff,0x00,0x11,0x55,0x4f,0x7d,0xff,0x00,0x0c,0x55,0x55,0x79,0xff,0x00,0x07,0x55,0x5c,0xff,0x00,0x0f,0x55,0x4e,0x93,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x09,0x55,0x5d,0xff,0x00,0x0e,0xaa,0xab,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x11,0x55,0x56,0x8b,0x9f,0x08,0x95,0x07,0x8b,0xab,0xff,0xff,0xf5,0xaa,0xaa,0xff,0x00,0x19,0xd5,0x56,0xff,0xff,0xeb,0x55,0x56,0xff,0x00,0x13,0xaa,0xaa,0xff,0xff,0xeb,0x55,0x55,0xff,0x00,0x13,0xaa,0xaa,0x6f,0xff,0x00,0x09,0xd5,0x56,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe3,0xff,0xff,0xff,0xff,0xf6,0x55,0x56,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xec,0xaa,0xaa,0xff,0xff,0xf5,0xaa,0xaa,0x71,0x8b,0xff,0xff,0xdf,0x55,0x56,0x08,0x80,0xc8,0x95,0x07,0x8b,0x9b,0xff,0x00,0x04,0x80,0x00,0xff,0x00,0x0c,0xaa,0xaa,0x94,0xff,0x00,0x09,0x55,0x56,0x94,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x0c,0xd5,0x55,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x10,0xaa,0xab,0x8b,0x9b,0x8b,0xff,0x00,0x0c,0x80,0x00,0x86,0x94,0x81,0x94,0x81,0xff,0x00,0x04,0x80,0x00,0x7d,0x8b,0x79,0x08,0x81,0x07,0x8b,0xff,0xff,0xee,0xaa,0xf0,0xff,0xff,0xfb,0x2a,0xab,0xff,0xff,0xf2,0x2a,0xaa,0xff,0xff,0xf6,0x55,0x55,0xff,0xff,0xf5,0xaa,0x66,0xff,0xff,0xf6,0x55,0x60,0xff,0xff,0xf5,0xaa,0xab,0xff,0xff,0xf2,0xd5,0x55,0xff,0xff,0xfa,0xd5,0x55,0xff,0xff,0xef,0x55,0x4b,0x8b,0x08,0x76,0x53,0xa0,0x06,0xff,0x00,0x12,0xaa,0xab,0x8b,0xff,0x00,0x0e,0xd5,0x55,0xff,0xff,0xfa,0x2a,0xab,0x96,0xff,0xff,0xf4,0x55,0x55,0x96,0xff,0xff,0xf4,0x55,0x55,0xff,0x00,0x05,0x80,0x00,0xff,0xff,0xf0,0x80,0x00,0x8b,0xff,0xff,0xec,0xaa,0xab,0x08,0x7e,0x07,0x8b,0xff,0xff,0xec,0xaa,0xaa,0x86,0xff,0xff,0xf0,0xd5,0x56,0x81,0x80,0x81,0x80,0x7d,0xff,0xff,0xfa,0x80,0x00,0x79,0x8b,0xff,0xff,0xee,0xaa,0xab,0x8b,0xff,0xff,0xf2,0x55,0x55,0xff,0x00,0x04,0xd5,0x55,0x81,0xff,0x00,0x09,0xaa,0xab,0x81,0xff,0x00,0x09,0xaa,0xaa,0x86,0xff,0x00,0x0c,0xd5,0x56,0x8b,0x9b,0x08,0x95,0x4f,0x80,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xaa,0xab,0xff,0x00,0x0a,0x55,0x55,0xff,0xff,0xe5,0xd5,0x55,0xff,0x00,0x14,0xaa,0xac,0x78,0x08,0x0e,0xfb,0x58,0xf7,0xc1,0xd6,0x15,0x47,0x0a,0x0e,0xfb,0x5d,0xd2,0xf7,0xc4,0x15,0x20,0x0a,0xf7,0x1a,0xff,0x00,0x2a,0x80,0x00,0x15,0x22,0x0a,0x0e,0xfb,0xc6,0xee,0xf8,0xfd,0x15,0x45,0x0a,0x0e,0xfb,0x63,0xb8,0xf7,0xd9,0x15,0x57,0xf7,0x7e,0xc6,0xfb,0x27,0x07,0xf6,0xf7,0x27,0x05,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x09,0xd5,0x55,0xff,0x00,0x10,0x55,0x56,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x0f,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x0f,0x55,0x54,0xff,0x00,0x03,0x2a,0xaa,0xff,0x00,0x10,0xaa,0xac,0x8b,0x9d,0x08,0x96,0x07,0x8b,0xab,0xff,0xff,0xf5,0x55,0x56,0xa5,0xff,0xff,0xea,0xaa,0xaa,0x9f,0xff,0xff,0xea,0xaa,0xab,0x9f,0xff,0xff,0xe3,0xaa,0xaa,0x95,0xff,0xff,0xdc,0xaa,0xab,0x8b,0x67,0x8b,0xff,0xff,0xe3,0x2a,0xaa,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xe4,0xd5,0x54,0x8b,0x69,0x08,0x7c,0xcd,0x96,0x07,0x8b,0x9f,0xff,0x00,0x04,0x80,0x00,0x9a,0x94,0x95,0x94,0x95,0xff,0x00,0x0c,0x80,0x00,0x90,0x9b,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8b,0xff,0x00,0x0c,0x2a,0xab,0xff,0xff,0xfb,0x2a,0xac,0x94,0xff,0xff,0xf6,0x55,0x54,0x94,0xff,0xff,0xf6,0x55,0x54,0xff,0x00,0x04,0x80,0x00,0xff,0xff,0xf2,0x80,0x00,0x8b,0xff,0xff,0xee,0xaa,0xac,0x08,0x83,0x07,0x8b,0xff,0xff,0xf4,0xaa,0xac,0x89,0xff,0xff,0xf5,0x55,0x54,0x87,0x81,0x87,0x81,0xff,0xff,0xf9,0xaa,0xab,0x80,0xff,0xff,0xf7,0x55,0x55,0x7f,0x08,0x0e,0xfb,0x65,0xd1,0xff,0x01,0x27,0x80,0x00,0x15,0x48,0x0a,0x0e,0xfb,0x58,0xf7,0xc1,0xf7,0xf0,0x15,0x47,0x0a,0x0e,0xfb,0x5d,0xd2,0xf8,0x61,0x15,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xaa,0xb5,0x8b,0xb5,0x8b,0xff,0x00,0x1e,0xd5,0x55,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x13,0xaa,0xaa,0xff,0x00,0x18,0xaa,0x8c,0xff,0x00,0x09,0xd5,0x56,0xb0,0x8b,0xff,0x00,0x31,0x55,0x74,0x08,0xf7,0x1f,0x07,0x8b,0xbb,0xff,0xff,0xf6,0x2a,0xaa,0xff,0x00,0x23,0xd5,0x54,0xff,0xff,0xec,0x55,0x56,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x0b,0xd5,0x54,0x61,0x8b,0x63,0x8b,0xff,0xff,0xe1,0xd5,0x56,0x7f,0xff,0xff,0xeb,0xaa,0xaa,0x73,0xff,0xff,0xeb,0xaa,0xaa,0x73,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xdc,0x55,0x54,0x8b,0xff,0xff,0xd0,0xaa,0xac,0x08,0xfb,0x1f,0x07,0x8b,0xff,0xff,0xce,0xaa,0xac,0xff,0x00,0x09,0xaa,0xaa,0xff,0xff,0xda,0xff,0xfe,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0x08,0xf7,0x1a,0xff,0x00,0x2a,0x80,0x00,0x15,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xaa,0x7d,0xff,0xff,0xf8,0xd5,0x56,0xff,0xff,0xeb,0x55,0x55,0x8b,0x77,0x8b,0xff,0xff,0xf2,0x2a,0xab,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x0e,0x55,0x14,0xff,0xff,0xfc,0x2a,0xaa,0xff,0x00,0x17,0xd5,0x54,0x8b,0xff,0x00,0x21,0x55,0x98,0x08,0xf7,0x16,0x07,0x8b,0xab,0xff,0x00,0x03,0xd5,0x56,0xa2,0xff,0x00,0x07,0xaa,0xaa,0x99,0xff,0x00,0x07,0xaa,0xab,0x99,0xff,0x00,0x0d,0xd5,0x55,0x92,0x9f,0x8b,0x9f,0x8b,0xff,0x00,0x0d,0xd5,0x55,0x84,0xff,0x00,0x07,0xaa,0xab,0x7d,0xff,0x00,0x07,0xaa,0xab,0x7d,0xff,0x00,0x03,0xd5,0x55,0x74,0x8b,0x6b,0x08,0xfb,0x16,0x07,0x8b,0xff,0xff,0xde,0xaa,0xac,0xff,0xff,0xfc,0x55,0x55,0xff,0xff,0xe8,0x2a,0xa8,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xac,0x08,0x0e,0xfb,0xc6,0xee,0xf9,0x9a,0x15,0x45,0x0a,0x0e,0xfb,0x63,0xb8,0xf8,0x76,0x15,0x42,0x0a,0x0e,0xfb,0x65,0xd1,0xff,0x01,0xc4,0x80,0x00,0x15,0x43,0x0a,0x0e,0xfb,0x58,0xf7,0xc1,0xf8,0x8d,0x15,0x47,0x0a,0x0e,0xfb,0xf4,0xf7,0x8c,0xf9,0x46,0x15,0x21,0x0a,0x0e,0xf8,0xf6,0x14,0xf8,0xa4,0x15,0x83,0x93,0xf8,0x8f,0x92,0xf7,0x44,0x94,0x06,0xfb,0x2c,0x8b,0x07,0x8b,0x0c,0x0a,0x1c,0x00,0x1a,0x13,0x00,0x2e,0x02,0x00,0x01,0x00,0xb3,0x00,0xbf,0x01,0x61,0x02,0x17,0x02,0xb9,0x02,0xcd,0x02,0xd7,0x02,0xed,0x02,0xf6,0x03,0x0b,0x03,0x12,0x03,0x2c,0x03,0xf2,0x04,0x69,0x06,0x2d,0x07,0x0d,0x07,0x28,0x07,0x44,0x07,0x4f,0x08,0xa5,0x09,0x05,0x09,0x8c,0x0a,0x96,0x0a,0xf2,0x0b,0x42,0x0b,0x49,0x0c,0x06,0x0c,0xb6,0x0d,0x7a,0x0f,0xaa,0x10,0x46,0x10,0xb0,0x10,0xc7,0x10,0xd9,0x11,0xcd,0x13,0xd2,0x13,0xdd,0x13,0xea,0x13,0xfc,0x14,0x1a,0x16,0x1f,0x16,0x2f,0x16,0xda,0x17,0x65,0x17,0x75,0x17,0x7f,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xaa,0xb5,0x8b,0xb5,0x8b,0xff,0x00,0x1e,0xd5,0x55,0xff,0x00,0x0c,0x55,0x56,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x13,0xaa,0xaa,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x09,0xd5,0x56,0xb0,0x8b,0xff,0x00,0x31,0x55,0x56,0x08,0xf7,0x1f,0x07,0x8b,0xbb,0xff,0xff,0xf6,0x2a,0xaa,0xff,0x00,0x23,0xd5,0x54,0xff,0xff,0xec,0x55,0x56,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xec,0x55,0x55,0xff,0x00,0x17,0xaa,0xac,0xff,0xff,0xe1,0x2a,0xab,0xff,0x00,0x0b,0xd5,0x54,0x61,0x8b,0x63,0x8b,0xff,0xff,0xe1,0xd5,0x56,0x7f,0xff,0xff,0xeb,0xaa,0xaa,0x73,0xff,0xff,0xeb,0xaa,0xaa,0x73,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xdc,0x55,0x54,0x8b,0xff,0xff,0xd0,0xaa,0xac,0x08,0xfb,0x1f,0x07,0x8b,0xff,0xff,0xce,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xaa,0x66,0xff,0x00,0x13,0x55,0x56,0xff,0xff,0xe7,0x55,0x56,0x08,0x0b,0xfc,0x09,0xfd,0x46,0xca,0x8b,0xf8,0x09,0xf9,0x46,0x05,0x0b,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xf1,0xaa,0xaa,0x7d,0xff,0xff,0xf8,0xd5,0x56,0xff,0xff,0xeb,0x55,0x55,0x8b,0x77,0x8b,0xff,0xff,0xf2,0x2a,0xab,0xff,0x00,0x07,0x2a,0xaa,0xff,0xff,0xf8,0x55,0x55,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xfc,0x2a,0xaa,0xff,0x00,0x17,0xd5,0x54,0x8b,0xff,0x00,0x21,0x55,0x56,0x08,0xf7,0x16,0x07,0x8b,0xab,0xff,0x00,0x03,0xd5,0x56,0xa2,0xff,0x00,0x07,0xaa,0xaa,0x99,0xff,0x00,0x07,0xaa,0xab,0x99,0xff,0x00,0x0d,0xd5,0x55,0x92,0x9f,0x8b,0x9f,0x8b,0xff,0x00,0x0d,0xd5,0x55,0x84,0xff,0x00,0x07,0xaa,0xab,0x7d,0xff,0x00,0x07,0xaa,0xab,0x7d,0xff,0x00,0x03,0xd5,0x55,0x74,0x8b,0x6b,0x08,0xfb,0x16,0x07,0x8b,0xff,0xff,0xde,0xaa,0xda,0xff,0xff,0xfc,0x55,0x55,0xff,0xff,0xe8,0x2a,0xaa,0xff,0xff,0xf8,0xaa,0xab,0xff,0xff,0xf1,0xaa,0x7c,0x08,0x0b,0xff,0x00,0x13,0x55,0x54,0xff,0xff,0xe7,0x55,0x55,0xff,0x00,0x1e,0xaa,0xac,0xff,0xff,0xf3,0xaa,0xab,0xb5,0x8b,0xb5,0x8b,0xff,0x00,0x1e,0xd5,0x54,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x13,0xaa,0xac,0xff,0x00,0x18,0xaa,0xab,0xff,0x00,0x13,0xaa,0xac,0xff,0x00,0x18,0xaa,0xaa,0xff,0x00,0x09,0xd5,0x54,0xb0,0x8b,0xff,0x00,0x31,0x55,0x56,0x08,0xf7,0x1f,0x07,0x8b,0xbb,0xff,0xff,0xf6,0x2a,0xac,0xff,0x00,0x23,0xd5,0x56,0xff,0xff,0xec,0x55,0x54,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xec,0x55,0x54,0xff,0x00,0x17,0xaa,0xaa,0xff,0xff,0xe1,0x2a,0xac,0xff,0x00,0x0b,0xd5,0x56,0x61,0x8b,0x63,0x8b,0xff,0xff,0xe1,0xd5,0x54,0x7f,0xff,0xff,0xeb,0xaa,0xac,0x73,0xff,0xff,0xeb,0xaa,0xac,0x73,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xdc,0x55,0x56,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0x08,0xfb,0x1f,0x07,0x8b,0xff,0xff,0xce,0xaa,0xab,0xff,0x00,0x09,0xaa,0xac,0xff,0xff,0xda,0xff,0xff,0xff,0x00,0x13,0x55,0x54,0xff,0xff,0xe7,0x55,0x56,0x08,0x0b,0xff,0xff,0xf8,0xaa,0xac,0xff,0xff,0xf1,0xaa,0xab,0x7d,0xff,0xff,0xf8,0xd5,0x55,0xff,0xff,0xeb,0x55,0x54,0x8b,0x77,0x8b,0xff,0xff,0xf2,0x2a,0xac,0xff,0x00,0x07,0x2a,0xab,0xff,0xff,0xf8,0x55,0x54,0xff,0x00,0x0e,0x55,0x55,0xff,0xff,0xf8,0x55,0x54,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xfc,0x2a,0xac,0xff,0x00,0x17,0xd5,0x55,0x8b,0xff,0x00,0x21,0x55,0x55,0x08,0xf7,0x16,0x07,0x8b,0xab,0xff,0x00,0x03,0xd5,0x54,0xa2,0xff,0x00,0x07,0xaa,0xac,0x99,0xff,0x00,0x07,0xaa,0xac,0x99,0xff,0x00,0x0d,0xd5,0x54,0x92,0x9f,0x8b,0x9f,0x8b,0xff,0x00,0x0d,0xd5,0x54,0x84,0xff,0x00,0x07,0xaa,0xac,0x7d,0xff,0x00,0x07,0xaa,0xac,0x7d,0xff,0x00,0x03,0xd5,0x54,0x74,0x8b,0x6b,0x08,0xfb,0x16,0x07,0x8b,0xff,0xff,0xde,0xaa,0xab,0xff,0xff,0xfc,0x55,0x54,0xff,0xff,0xe8,0x2a,0xab,0xff,0xff,0xf8,0xaa,0xac,0xff,0xff,0xf1,0xaa,0xaa,0x08,0x0b,0xfb,0x3a,0xcd,0xf7,0x3a,0xf7,0x3a,0xcd,0xfb,0x3a,0xf7,0x3a,0x49,0xfb,0x3a,0xfb,0x3a,0x49,0x07,0x0b,0x8b,0xfb,0x7a,0xcd,0xc9,0x8b,0xf7,0x3c,0x05,0x0b,0xc5,0xfb,0x3a,0xd8,0x8b,0xfb,0x8f,0xf9,0x46,0x4e,0x8b,0xfb,0x8f,0xfd,0x46,0xd8,0x8b,0xc5,0xf7,0x3a,0x05,0x0b,0xfb,0x8f,0x8b,0xf7,0x11,0xf7,0xfc,0x05,0x0b,0xf7,0xee,0xcd,0xfc,0x37,0xfd,0x46,0xf8,0x37,0xcd,0xfb,0xee,0xf7,0x90,0xf7,0xbc,0xcd,0xfb,0xbc,0x06,0x0b,0xfd,0x46,0xd4,0xf9,0x46,0x07,0x0b,0x42,0xfc,0xbe,0x06,0xfb,0xf9,0xf8,0xbe,0x42,0x8b,0x8b,0xfd,0x46,0xd4,0x8b,0x8b,0xf8,0xc0,0xf7,0xf9,0xfc,0xc0,0xd4,0x8b,0x05,0x0b,0xb6,0xff,0xff,0xd5,0xaa,0xab,0xff,0x00,0x3a,0x2a,0xaa,0xff,0xff,0xea,0xd5,0x55,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x48,0xaa,0xaa,0x8b,0xc5,0xff,0x00,0x15,0x2a,0xab,0xff,0x00,0x2b,0x55,0x56,0xff,0x00,0x2a,0x55,0x55,0xff,0x00,0x2b,0x55,0x54,0xff,0x00,0x2a,0x55,0x55,0xff,0x00,0x15,0xaa,0xac,0xff,0x00,0x42,0xd5,0x55,0x8b,0xff,0x00,0x5b,0x55,0x56,0x08,0xf7,0x47,0x07,0x8b,0xff,0x00,0x5b,0x55,0x34,0xff,0xff,0xea,0x80,0x00,0xff,0x00,0x42,0xd5,0x54,0x60,0xff,0x00,0x2a,0x55,0x78,0x60,0xff,0x00,0x2a,0x55,0x54,0xff,0xff,0xc6,0x2a,0xaa,0xff,0x00,0x15,0x2a,0xac,0xff,0xff,0xb7,0x55,0x56,0x8b,0xff,0xff,0xb6,0xaa,0xaa,0x8b,0xff,0xff,0xc5,0xaa,0xab,0xff,0xff,0xea,0xd5,0x54,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xd4,0xaa,0xab,0xff,0xff,0xd5,0xaa,0xac,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xbd,0x2a,0xa8,0x8b,0xff,0xff,0xa4,0xaa,0xac,0x08,0xfb,0x47,0x07,0x8b,0xff,0xff,0xa4,0xaa,0xaa,0xff,0x00,0x15,0x80,0x00,0xff,0xff,0xbd,0x2a,0xaa,0xb6,0xff,0xff,0xd5,0xaa,0xac,0x08,0x0b,0xff,0xff,0x7f,0x55,0x55,0x54,0xff,0xff,0xbf,0xaa,0xab,0xfb,0x02,0x1e,0xff,0xff,0xc9,0x55,0x55,0x8b,0xff,0xff,0xd6,0x80,0x00,0xff,0x00,0x0f,0x55,0x55,0xff,0xff,0xe3,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xab,0xff,0xff,0xe3,0xaa,0xab,0xff,0x00,0x1e,0xaa,0xab,0xff,0xff,0xf1,0xd5,0x55,0xff,0x00,0x30,0xff,0xff,0x8b,0xff,0x00,0x43,0x55,0x56,0x08,0xf7,0x48,0x07,0x8b,0xff,0x00,0x46,0xaa,0xaa,0x99,0xff,0x00,0x33,0x2a,0xaa,0xa7,0xff,0x00,0x1f,0xaa,0xac,0xa7,0xff,0x00,0x1f,0xaa,0xac,0xff,0x00,0x29,0xaa,0xab,0xff,0x00,0x0f,0xd5,0x54,0xff,0x00,0x37,0x55,0x55,0x8b,0x08,0xf7,0x02,0xc2,0x48,0xfb,0x1a,0x1f,0x0b,0xff,0x00,0x27,0x55,0x55,0x69,0xff,0x00,0x36,0x55,0x55,0x7a,0xff,0x00,0x45,0x55,0x56,0x8b,0xff,0x00,0x49,0x55,0x56,0x8b,0xff,0x00,0x39,0xaa,0xaa,0xff,0x00,0x11,0x2a,0xab,0xb5,0xff,0x00,0x22,0x55,0x55,0xb5,0xff,0x00,0x22,0x55,0x55,0xa0,0xff,0x00,0x30,0x80,0x00,0x8b,0xff,0x00,0x3e,0xaa,0xab,0x8b,0xff,0x00,0x36,0xaa,0xab,0xff,0xff,0xf0,0xaa,0xaa,0xff,0x00,0x2a,0x55,0x55,0xff,0xff,0xe1,0x55,0x56,0xa9,0xff,0xff,0xe1,0x55,0x56,0xa9,0xff,0xff,0xd3,0xaa,0xaa,0x9f,0x51,0x95,0x08,0x3b,0x99,0x05,0xff,0xff,0xd6,0xaa,0xab,0xff,0x00,0x07,0x55,0x56,0xff,0xff,0xe1,0x2a,0xaa,0xff,0x00,0x0d,0x2a,0xaa,0xff,0xff,0xeb,0xaa,0xab,0x9e,0xff,0xff,0xeb,0xaa,0xab,0x9e,0xff,0xff,0xf5,0xd5,0x55,0xff,0x00,0x1a,0x80,0x00,0x8b,0xad,0xff,0xff,0xff,0xff,0xf8,0xff,0x00,0x26,0xaa,0xac,0xff,0x00,0x0d,0x2a,0xab,0xff,0x00,0x1e,0x80,0x00,0xff,0x00,0x1a,0x55,0x5d,0xff,0x00,0x16,0x55,0x54,0xff,0x00,0x1a,0x55,0x4f,0xff,0x00,0x16,0x55,0x54,0xff,0x00,0x24,0xd5,0x55,0xff,0x00,0x0b,0x2a,0xac,0xff,0x00,0x2f,0x55,0x5c,0x8b,0xff,0x00,0x5b,0x55,0x56,0x8b,0xff,0x00,0x31,0xaa,0xaa,0x60,0x93,0x35,0x08,0xd3,0x06,0xff,0xff,0xf8,0xaa,0xaa,0xff,0x00,0x40,0xaa,0xac,0xff,0xff,0xe8,0xd5,0x56,0xff,0x00,0x30,0x2a,0xa8,0x64,0xff,0x00,0x1f,0xaa,0xac,0x64,0xff,0x00,0x1f,0xaa,0xac,0xff,0xff,0xcd,0xd5,0x56,0xff,0x00,0x0f,0xd5,0x54,0xff,0xff,0xc2,0xaa,0xaa,0x8b,0xff,0xff,0xbd,0x55,0x56,0x8b,0xff,0xff,0xca,0x55,0x55,0x7a,0xff,0xff,0xd7,0x55,0x55,0x69,0xff,0xff,0xd7,0x55,0x56,0x69,0xff,0xff,0xeb,0xaa,0xab,0xff,0xff,0xd0,0xaa,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc3,0x55,0x54,0x8b,0xff,0xff,0xcb,0x55,0x56,0x9a,0xff,0xff,0xd7,0x2a,0xaa,0xa9,0x6e,0xa9,0x6e,0xb6,0xff,0xff,0xec,0xd5,0x56,0xc3,0xff,0xff,0xf6,0xaa,0xaa,0x08,0xd9,0x7e,0x05,0xff,0x00,0x2b,0x55,0x56,0xff,0xff,0xf8,0xaa,0xf6,0xff,0x00,0x20,0x55,0x54,0xff,0xff,0xf2,0xaa,0xaa,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xec,0xaa,0x60,0xff,0x00,0x15,0x55,0x56,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x0a,0xaa,0xaa,0xff,0xff,0xe3,0x55,0x55,0x8b,0x65,0x8b,0x61,0xff,0xff,0xf2,0x80,0x00,0x6b,0x70,0x75,0x70,0x75,0xff,0xff,0xd8,0x80,0x00,0x80,0x57,0x8b,0x27,0x8b,0xff,0xff,0xc9,0x55,0x56,0xff,0x00,0x2d,0xaa,0xaa,0xff,0xff,0xf6,0xaa,0xaa,0xff,0x00,0x5b,0x55,0x56,0x08,0x43,0x06,0x91,0x49,0xff,0x00,0x16,0xaa,0xab,0x59,0xff,0x00,0x27,0x55,0x55,0x69,0x08,0x0b,0xaf,0xff,0xff,0xec,0xaa,0xab,0xff,0x00,0x28,0xaa,0xaa,0xff,0xff,0xf6,0x55,0x55,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x2d,0x55,0x56,0x8b,0xff,0x00,0x28,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xab,0xaf,0xff,0x00,0x13,0x55,0x55,0xaf,0xff,0x00,0x13,0x55,0x56,0xff,0x00,0x1c,0x2a,0xaa,0xff,0x00,0x1b,0x2a,0xaa,0xff,0x00,0x14,0x55,0x56,0xae,0xff,0x00,0x14,0x55,0x54,0xae,0xff,0x00,0x0a,0x2a,0xac,0xff,0x00,0x28,0x2a,0xab,0x8b,0xff,0x00,0x2d,0x55,0x55,0x08,0xf8,0x65,0x42,0xfc,0x5f,0x07,0x8b,0xff,0xff,0xcb,0x55,0x55,0x7c,0xff,0xff,0xd6,0x2a,0xab,0x6d,0x6c,0x6d,0x6c,0xff,0xff,0xd8,0x55,0x56,0xff,0xff,0xf0,0x80,0x00,0xff,0xff,0xce,0xaa,0xaa,0x8b,0x59,0x8b,0xff,0xff,0xd8,0x2a,0xab,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xe2,0x55,0x55,0xaa,0xff,0xff,0xe2,0x55,0x55,0xaa,0xff,0xff,0xf1,0x2a,0xab,0xff,0x00,0x29,0xd5,0x55,0x8b,0xff,0x00,0x34,0xaa,0xab,0x08,0xf8,0x5f,0x41,0xfc,0x65,0x07,0x8b,0xff,0xff,0xd3,0x55,0x55,0xff,0x00,0x0a,0x55,0x56,0x63,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xab,0xff,0x00,0x14,0xaa,0xab,0xff,0xff,0xdc,0xaa,0xab,0xff,0x00,0x1c,0x55,0x55,0xff,0xff,0xe4,0xaa,0xab,0xaf,0xff,0xff,0xec,0xaa,0xaa,0x08,0x0b,0xf7,0x62,0xf8,0x25,0x3c,0x8b,0xfb,0x38,0xfb,0xdf,0xfb,0x37,0xf7,0xdf,0x3c,0x8b,0xf7,0x62,0xfc,0x24,0x8b,0xfb,0xb6,0xd4,0x8b,0x05,0x0b,0xfb,0xf9,0x8b,0xf7,0xf6,0xf8,0xc2,0x8b,0xcd,0xfc,0x3c,0x8b,0x8b,0x49,0xf7,0xe9,0x8b,0xfb,0xf6,0xfc,0xc2,0x8b,0x49,0xf8,0x4c,0x8b,0x05,0x0b,0xf7,0x0c,0xfb,0x11,0xca,0x8b,0x28,0xf7,0x11,0x05,0x0b,0xff,0xff,0xe0,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0xff,0xff,0xd2,0x80,0x00,0xff,0x00,0x0e,0x55,0x56,0xff,0xff,0xc4,0xaa,0xaa,0x8b,0xff,0xff,0xc9,0x55,0x55,0x8b,0x60,0x7e,0xff,0xff,0xe0,0xaa,0xab,0x71,0xff,0xff,0xe0,0xaa,0xaa,0x71,0xff,0xff,0xf0,0x55,0x56,0xff,0xff,0xdd,0x55,0x56,0x8b,0xff,0xff,0xd4,0xaa,0xaa,0x08,0x86,0xcd,0x8e,0x07,0x8b,0xff,0x00,0x1b,0x55,0x56,0xff,0x00,0x09,0xd5,0x55,0xff,0x00,0x15,0x80,0x00,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0f,0xaa,0xaa,0xff,0x00,0x1b,0x2a,0xaa,0xff,0x00,0x07,0xd5,0x56,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x24,0xaa,0xaa,0x8b,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xf6,0xaa,0xaa,0x9f,0xff,0xff,0xed,0x55,0x56,0x9f,0xff,0xff,0xed,0x55,0x56,0x95,0xff,0xff,0xe4,0x55,0x54,0x8b,0xff,0xff,0xdb,0x55,0x56,0x08,0x51,0xfb,0x1d,0x07,0x55,0x8b,0xff,0xff,0xd6,0x2a,0xaa,0xff,0xff,0xf3,0x2a,0xaa,0xff,0xff,0xe2,0x55,0x56,0xff,0xff,0xe6,0x55,0x56,0xff,0xff,0xe2,0x55,0x56,0xff,0xff,0xe6,0x55,0x55,0xff,0xff,0xf1,0x2a,0xaa,0xff,0xff,0xdc,0x80,0x00,0x8b,0xff,0xff,0xd2,0xaa,0xab,0x8b,0xff,0xff,0xcf,0x55,0x56,0xff,0x00,0x0e,0xaa,0xaa,0x66,0xff,0x00,0x1d,0x55,0x56,0xff,0xff,0xe6,0xaa,0xaa,0xff,0x00,0x1d,0x55,0x56,0xff,0xff,0xe6,0xaa,0xab,0xff,0x00,0x29,0x55,0x55,0xff,0xff,0xf3,0x55,0x55,0xff,0x00,0x35,0x55,0x55,0x8b,0xff,0x00,0x20,0xaa,0xab,0x8b,0xff,0x00,0x1b,0xaa,0xab,0xff,0x00,0x04,0xd5,0x55,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xab,0xff,0x00,0x16,0xaa,0xaa,0xff,0x00,0x09,0xaa,0xab,0x9e,0xff,0x00,0x0f,0x2a,0xaa,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x14,0xaa,0xab,0x08,0x55,0xce,0xf7,0xed,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0xff,0xf0,0x2a,0xaa,0xb5,0xff,0xff,0xe0,0x55,0x56,0xff,0x00,0x1c,0xaa,0xaa,0x08,0x0b,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xdf,0x80,0x00,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xd3,0x55,0x56,0xff,0xff,0xff,0xff,0xfe,0x08,0x41,0x66,0xff,0x00,0x1f,0xaa,0xaa,0xff,0x00,0x3f,0x55,0x56,0xff,0x00,0x3e,0xaa,0xab,0xff,0x00,0x25,0x55,0x55,0xff,0x00,0x1f,0x55,0x55,0xff,0x00,0x4a,0xaa,0xab,0x1f,0xf7,0x13,0x49,0x06,0x8b,0xff,0xff,0xd6,0xaa,0xab,0xff,0xff,0xf5,0xd5,0x56,0xff,0xff,0xe1,0x2a,0xab,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xaa,0x08,0x0b,0xff,0xff,0x9b,0x55,0x56,0xff,0xff,0xda,0x55,0x56,0xff,0xff,0xcd,0xaa,0xaa,0xff,0xff,0xb4,0xaa,0xaa,0x1e,0xff,0xff,0xd6,0xaa,0xab,0x8b,0xff,0xff,0xe0,0x80,0x00,0xff,0x00,0x0e,0x2a,0xaa,0xff,0xff,0xea,0x55,0x55,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xea,0x55,0x55,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xf5,0x2a,0xab,0xff,0x00,0x24,0x7f,0xff,0x8b,0xff,0x00,0x2c,0xaa,0xab,0x08,0xe4,0x07,0x8b,0xff,0x00,0x2f,0x55,0x56,0xff,0x00,0x0a,0x55,0x55,0xff,0x00,0x25,0xd5,0x54,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x14,0xaa,0xab,0xff,0x00,0x1c,0x55,0x56,0xff,0x00,0x1e,0xaa,0xaa,0xff,0x00,0x0e,0x2a,0xaa,0xff,0x00,0x28,0xaa,0xab,0x8b,0x08,0xd9,0xb2,0x59,0x27,0x1f,0x0b,0xf7,0xd1,0xc7,0x06,0x8b,0xff,0x00,0x48,0xaa,0xaa,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x35,0xd5,0x56,0x68,0xae,0x68,0xae,0xff,0xff,0xd1,0x80,0x00,0xff,0x00,0x11,0x80,0x00,0x51,0x8b,0x51,0x8b,0xff,0xff,0xd1,0x55,0x55,0xff,0xff,0xee,0x80,0x00,0xff,0xff,0xdc,0xaa,0xab,0x68,0xff,0xff,0xdc,0xaa,0xab,0x68,0xff,0xff,0xee,0x55,0x55,0xff,0xff,0xca,0x2a,0xaa,0x8b,0xff,0xff,0xb7,0x55,0x56,0x08,0x33,0x07,0x8b,0xff,0xff,0xb5,0x55,0x56,0xff,0x00,0x11,0xaa,0xaa,0xff,0xff,0xc8,0xff,0xff,0xff,0x00,0x23,0x55,0x56,0xff,0xff,0xdc,0xaa,0xab,0xff,0x00,0x23,0x55,0x50,0xff,0xff,0xdc,0xaa,0xab,0xff,0x00,0x2f,0x55,0x55,0xff,0xff,0xee,0x55,0x55,0xff,0x00,0x3b,0x55,0x5b,0x8b,0xc5,0x8b,0xff,0x00,0x2d,0x80,0x00,0xff,0x00,0x0e,0x55,0x55,0xac,0xff,0x00,0x1c,0xaa,0xab,0xac,0xff,0x00,0x1c,0xaa,0xaa,0xff,0x00,0x10,0x80,0x00,0xb1,0x8b,0xff,0x00,0x2f,0x55,0x56,0x08,0x90,0x49,0x88,0x07,0x8b,0xff,0xff,0xe1,0x55,0x56,0xff,0xff,0xf5,0xd5,0x56,0x73,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xaa,0xff,0xff,0xeb,0xaa,0xaa,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xe3,0xd5,0x56,0xff,0xff,0xf7,0x55,0x56,0x67,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd6,0xaa,0xab,0x8b,0xff,0xff,0xdf,0xaa,0xaa,0xff,0x00,0x0b,0x80,0x00,0xff,0xff,0xe8,0xaa,0xab,0xa2,0xff,0xff,0xe8,0xaa,0xab,0xa2,0xff,0xff,0xf4,0x55,0x55,0xff,0x00,0x28,0x2a,0xaa,0x8b,0xff,0x00,0x39,0x55,0x56,0x08,0x0b,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1e,0x55,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xb1,0x8b,0xff,0x00,0x26,0xaa,0xaa,0x8b,0xff,0x00,0x1e,0x55,0x56,0xff,0xff,0xf5,0x55,0x56,0xa1,0xff,0xff,0xea,0xaa,0xaa,0xa1,0xff,0xff,0xea,0xaa,0xaa,0x96,0x66,0x8b,0xff,0xff,0xcb,0x55,0x56,0x08,0x79,0xfb,0x8d,0x96,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0x08,0x0b,0xb9,0xff,0x00,0x15,0x55,0x55,0xa2,0xff,0x00,0x2a,0xaa,0xab,0x1e,0xb5,0xc1,0x56,0x06,0x65,0x8b,0xff,0xff,0xe2,0x2a,0xab,0xff,0xff,0xf4,0xaa,0xac,0xff,0xff,0xea,0x55,0x55,0xff,0xff,0xe9,0x55,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xe9,0x55,0xa4,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xe1,0x55,0x54,0x8b,0xff,0xff,0xd9,0x55,0x08,0x08,0x52,0x4b,0x55,0xcb,0xfc,0x59,0xd0,0xf8,0x59,0xf5,0xc1,0x21,0x07,0x0b,0xfc,0x8f,0xcf,0xf8,0x8f,0x07,0x0b,0xfc,0x8f,0xcf,0xf7,0xd7,0x07,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0x00,0x0a,0xd5,0x55,0xff,0x00,0x1f,0xd5,0x54,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x1c,0xd5,0x55,0xff,0x00,0x0b,0x2a,0xaa,0xaf,0x8b,0xff,0x00,0x24,0xaa,0x84,0x8b,0xff,0x00,0x1c,0xaa,0xaa,0x80,0xff,0x00,0x14,0xaa,0xd2,0x75,0xff,0x00,0x14,0xaa,0xaa,0x75,0xff,0x00,0x0a,0x55,0x56,0x6b,0x8b,0x61,0x08,0xfb,0xd7,0xcf,0xf7,0xe1,0x07,0x8b,0xff,0x00,0x38,0xaa,0x9e,0xff,0xff,0xf1,0x80,0x00,0xff,0x00,0x2c,0x2a,0xaa,0x6e,0xff,0x00,0x1f,0xaa,0xb8,0x6e,0xff,0x00,0x1f,0xaa,0xaa,0xff,0xff,0xd6,0x80,0x00,0xff,0x00,0x0f,0xd5,0x56,0x55,0x8b,0xff,0xff,0xe2,0xaa,0xab,0x8b,0xff,0xff,0xe5,0x80,0x00,0xff,0xff,0xfa,0x55,0x56,0xff,0xff,0xe8,0x55,0x55,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xe8,0x55,0x60,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xec,0xd5,0x55,0x7a,0xff,0xff,0xf1,0x55,0x4b,0xff,0xff,0xe9,0x55,0x56,0x08,0xc9,0x07,0x0b,0xff,0x00,0x23,0x55,0x50,0x6a,0xff,0x00,0x2f,0x55,0x55,0xff,0xff,0xef,0x80,0x00,0xff,0x00,0x3b,0x55,0x5b,0x8b,0xc5,0x8b,0xff,0x00,0x2e,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0xae,0xff,0x00,0x21,0x55,0x56,0xae,0xff,0x00,0x21,0x55,0x54,0xff,0x00,0x11,0x80,0x00,0xff,0x00,0x34,0xaa,0xab,0x8b,0xff,0x00,0x48,0x00,0x01,0x08,0xf3,0x07,0x8b,0xd3,0xff,0xff,0xee,0x80,0x00,0xff,0x00,0x34,0xaa,0xaa,0x68,0xff,0x00,0x21,0x55,0x56,0x68,0xff,0x00,0x21,0x55,0x56,0xff,0xff,0xd1,0x80,0x00,0xff,0x00,0x10,0xaa,0xaa,0x51,0x8b,0xff,0xff,0xc4,0xaa,0xab,0x8b,0xff,0xff,0xd0,0xaa,0xaa,0xff,0xff,0xef,0x55,0x56,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xdc,0xaa,0xab,0xff,0xff,0xde,0xaa,0xaa,0xff,0xff,0xee,0x55,0x55,0xff,0xff,0xcb,0x55,0x56,0x8b,0x43,0x08,0x23,0x07,0x8b,0xff,0xff,0xb7,0x55,0x56,0xff,0x00,0x11,0xaa,0xaa,0xff,0xff,0xcb,0x2a,0xaa,0xff,0x00,0x23,0x55,0x56,0x6a,0x08,0x0b,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xac,0xff,0xff,0xe1,0xd5,0x56,0xff,0xff,0xf4,0xd5,0x56,0x65,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd8,0xaa,0xab,0x8b,0x6c,0xff,0x00,0x0b,0x2a,0xaa,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe9,0x55,0x55,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xf4,0xaa,0xab,0xff,0x00,0x27,0x2a,0xaa,0x8b,0xc3,0x08,0xeb,0x07,0x8b,0xff,0x00,0x37,0x55,0x56,0xff,0x00,0x0b,0x55,0x55,0xff,0x00,0x26,0xd5,0x54,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x16,0xaa,0xab,0xff,0x00,0x16,0x55,0x56,0xaa,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x27,0x55,0x55,0x8b,0xb1,0x8b,0xff,0x00,0x1e,0x2a,0xaa,0xff,0xff,0xf4,0xd5,0x56,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0xff,0xe9,0xaa,0xc2,0xff,0x00,0x0b,0x2a,0xaa,0xff,0xff,0xd9,0x2a,0xaa,0x8b,0xff,0xff,0xc8,0xaa,0x94,0x08,0x2b,0x07,0x8b,0x53,0xff,0xff,0xf4,0xd5,0x56,0xff,0xff,0xd8,0xd5,0x56,0xff,0xff,0xe9,0xaa,0xaa,0xff,0xff,0xe9,0xaa,0xaa,0x08,0x0b,0xff,0x00,0x21,0x55,0x51,0xff,0xff,0xe5,0x55,0x55,0xff,0x00,0x2c,0x55,0x55,0xff,0xff,0xf2,0xaa,0xab,0xff,0x00,0x37,0x55,0x5a,0x8b,0xc5,0x8b,0xff,0x00,0x2e,0x55,0x56,0xff,0x00,0x0d,0x2a,0xab,0xff,0x00,0x22,0xaa,0xaa,0xff,0x00,0x1a,0x55,0x55,0xff,0x00,0x22,0xaa,0xaa,0xff,0x00,0x1a,0x55,0x56,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x25,0x2a,0xaa,0x8b,0xbb,0x8b,0xb3,0xff,0xff,0xf4,0x2a,0xaa,0xff,0x00,0x1e,0x80,0x00,0xff,0xff,0xe8,0x55,0x56,0xa0,0xff,0xff,0xe8,0x55,0x56,0xa0,0xff,0xff,0xdb,0x2a,0xaa,0xff,0x00,0x0f,0x2a,0xaa,0x59,0xff,0x00,0x09,0x55,0x56,0x08,0x49,0x97,0x05,0xff,0xff,0xe1,0x55,0x55,0xff,0x00,0x05,0x55,0x56,0xff,0xff,0xe9,0xaa,0xab,0xff,0x00,0x08,0xd5,0x54,0x7d,0xff,0x00,0x0c,0x55,0x56,0x7d,0xff,0x00,0x0c,0x55,0x56,0x84,0xff,0x00,0x11,0x2a,0xaa,0x8b,0xa1,0x8b,0xff,0x00,0x1a,0xaa,0xaa,0xff,0x00,0x09,0xd5,0x55,0xa0,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x13,0xaa,0xab,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x1b,0x80,0x00,0xff,0x00,0x07,0xaa,0xaa,0xff,0x00,0x23,0x55,0x55,0x8b,0xaf,0x8b,0xff,0x00,0x1c,0x55,0x56,0xff,0xff,0xf8,0x55,0x56,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0xff,0x00,0x14,0xaa,0xaa,0xff,0xff,0xf0,0xaa,0xaa,0xff,0x00,0x0a,0x55,0x56,0x76,0x8b,0xff,0xff,0xe5,0x55,0x56,0x08,0x88,0xcd,0x91,0x07,0x8b,0xff,0x00,0x29,0x55,0x56,0xff,0xff,0xef,0x55,0x56,0xff,0x00,0x21,0x80,0x00,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x19,0xaa,0xaa,0xff,0xff,0xd3,0x55,0x56,0xff,0x00,0x0c,0xd5,0x56,0x53,0x8b,0x57,0x8b,0xff,0xff,0xd5,0xaa,0xab,0xff,0xff,0xf2,0xd5,0x56,0xff,0xff,0xdf,0x55,0x55,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xdf,0x55,0x57,0xff,0xff,0xe5,0xaa,0xaa,0xff,0xff,0xef,0xaa,0xab,0xff,0xff,0xdc,0xd5,0x56,0xff,0xff,0xff,0xff,0xfe,0x5f,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xd8,0xaa,0xaa,0xff,0x00,0x0b,0x55,0x56,0x6d,0xff,0x00,0x16,0xaa,0xac,0xff,0xff,0xeb,0x55,0x56,0xff,0x00,0x16,0xaa,0xa9,0xff,0xff,0xeb,0x55,0x56,0xaf,0xff,0xff,0xf1,0x55,0x55,0xff,0x00,0x31,0x55,0x57,0xff,0xff,0xf7,0x55,0x55,0x08,0xca,0x80,0x05,0xff,0x00,0x21,0x55,0x56,0x85,0xff,0x00,0x18,0x2a,0xaa,0x82,0x9a,0x7f,0x9a,0x7f,0xff,0x00,0x07,0x80,0x00,0xff,0xff,0xed,0x55,0x55,0x8b,0xff,0xff,0xe6,0xaa,0xab,0x8b,0xff,0xff,0xe3,0x55,0x56,0xff,0xff,0xf5,0x2a,0xaa,0x75,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xf0,0xaa,0xaa,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xf0,0xaa,0xab,0xff,0xff,0xe2,0x2a,0xaa,0xff,0xff,0xf8,0x55,0x55,0x65,0x8b,0xff,0xff,0xdb,0x55,0x5b,0x8b,0xff,0xff,0xe2,0xd5,0x55,0xff,0x00,0x08,0x2a,0xaa,0xff,0xff,0xea,0x55,0x50,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x10,0x55,0x56,0xff,0xff,0xf5,0x2a,0xaa,0xff,0x00,0x16,0x2a,0xaa,0x8b,0xa7,0x08,0x8e,0x49,0x87,0x07,0x8b,0xff,0xff,0xd2,0xaa,0xab,0xff,0x00,0x10,0xaa,0xab,0xff,0xff,0xdb,0xff,0xff,0xff,0x00,0x21,0x55,0x55,0xff,0xff,0xe5,0x55,0x56,0x08,0x0b,0xaa,0x6a,0xff,0x00,0x2e,0x2a,0xab,0xff,0xff,0xef,0x80,0x00,0xff,0x00,0x3d,0x55,0x55,0x8b,0xff,0x00,0x3e,0xaa,0xaa,0x8b,0xff,0x00,0x2e,0xd5,0x56,0xff,0x00,0x10,0x80,0x00,0xaa,0xac,0xaa,0xac,0xff,0x00,0x0f,0x80,0x00,0xff,0x00,0x2f,0x80,0x00,0x8b,0xc9,0x08,0xf7,0xd5,0x47,0xfb,0xcc,0x07,0x8b,0x5b,0x82,0xff,0xff,0xdc,0xaa,0xaa,0x79,0xff,0xff,0xe9,0x55,0x56,0x79,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xe1,0xaa,0xaa,0xff,0xff,0xf4,0xaa,0xaa,0xff,0xff,0xd5,0x55,0x56,0x8b,0xff,0xff,0xd5,0x55,0x55,0x8b,0xff,0xff,0xe1,0xaa,0xab,0xff,0x00,0x0b,0xaa,0xaa,0x79,0xff,0x00,0x17,0x55,0x56,0x79,0xff,0x00,0x17,0x55,0x56,0x82,0xff,0x00,0x22,0xff,0xff,0x8b,0xff,0x00,0x2e,0xaa,0xab,0x08,0xf7,0xcc,0x47,0xfb,0xd5,0x07,0x8b,0x4d,0xff,0x00,0x0f,0x80,0x00,0xff,0xff,0xd0,0x80,0x00,0xaa,0x6a,0x08,0x0b,0x44,0x8b,0xfb,0x19,0xfc,0x27,0xfb,0x19,0xf8,0x27,0x41,0x8b,0xf7,0x42,0xfc,0x8a,0x81,0x6c,0x05,0x83,0xff,0xff,0xe9,0x55,0x56,0xff,0xff,0xf5,0xd5,0x55,0xff,0xff,0xef,0xaa,0xaa,0xff,0xff,0xf3,0xaa,0xab,0x81,0xff,0xff,0xf3,0xaa,0xab,0x81,0xff,0xff,0xed,0x7f,0xff,0x86,0xff,0xff,0xe7,0x55,0x56,0x8b,0x08,0x72,0x4d,0xa9,0x06,0xff,0x00,0x22,0xaa,0xab,0x8b,0xff,0x00,0x1b,0xd5,0x55,0xff,0x00,0x07,0xaa,0xab,0xa0,0xff,0x00,0x0f,0x55,0x55,0xa0,0xff,0x00,0x0f,0x55,0x56,0xff,0x00,0x10,0x80,0x00,0xff,0x00,0x18,0xaa,0xaa,0x97,0xad,0x08,0x0b,0xca,0xfb,0xe6,0x4c,0xf7,0x98,0x07,0xfb,0x98,0xfc,0x11,0x8b,0x4c,0xf7,0xe6,0x8b,0x8b,0xca,0xfb,0x9a,0x8b,0x05,0x0b,0xf7,0x57,0xfb,0x5a,0x8b,0xde,0xfb,0x05,0xf7,0x07,0xf7,0x05,0xf7,0x07,0x8b,0xde,0x05,0x0b,0x57,0xf7,0x7e,0xc6,0xfb,0x27,0x07,0xf6,0xf7,0x27,0x05,0xff,0x00,0x0d,0x55,0x55,0xff,0x00,0x11,0x54,0xb0,0xff,0x00,0x09,0xd5,0x55,0xff,0x00,0x10,0x55,0x54,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x0f,0x55,0xfc,0xff,0x00,0x06,0x55,0x56,0xff,0x00,0x0f,0x55,0x54,0xff,0x00,0x03,0x2a,0xaa,0xff,0x00,0x10,0xaa,0xac,0x8b,0x9d,0x08,0x96,0x07,0x8b,0xab,0xff,0xff,0xf5,0x55,0x56,0xa5,0xff,0xff,0xea,0xaa,0xaa,0x9f,0xff,0xff,0xea,0xaa,0xab,0x9f,0xff,0xff,0xe3,0xaa,0xaa,0x95,0xff,0xff,0xdc,0xaa,0xab,0x8b,0x67,0x8b,0xff,0xff,0xe3,0x2a,0xaa,0xff,0xff,0xf5,0xd5,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xea,0x55,0x56,0xff,0xff,0xeb,0xaa,0xac,0xff,0xff,0xf5,0x2a,0xaa,0xff,0xff,0xe4,0xd5,0x54,0x8b,0x69,0x08,0x7c,0xcd,0x96,0x07,0x8b,0x9f,0xff,0x00,0x04,0x80,0x00,0x9a,0x94,0x95,0x94,0x95,0xff,0x00,0x0c,0x80,0x00,0x90,0x9b,0x8b,0xff,0x00,0x0f,0x55,0x55,0x8b,0xff,0x00,0x0c,0x2a,0xab,0xff,0xff,0xfb,0x2a,0xac,0x94,0xff,0xff,0xf6,0x55,0x54,0x94,0xff,0xff,0xf6,0x55,0x54,0xff,0x00,0x04,0x80,0x00,0xff,0xff,0xf2,0x80,0x00,0x8b,0xff,0xff,0xee,0xaa,0xac,0x08,0x83,0x07,0x8b,0xff,0xff,0xf4,0xaa,0xac,0x89,0xff,0xff,0xf5,0x55,0x54,0x87,0x81,0x87,0x81,0xff,0xff,0xf9,0xaa,0xab,0x80,0xff,0xff,0xf7,0x55,0x55,0x7f,0x08,0x0b,0xff,0x00,0x14,0xaa,0xaa,0x78,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x24,0xaa,0xab,0x8b,0xaf,0x8b,0xff,0x00,0x1d,0x2a,0xab,0xff,0x00,0x0a,0xd5,0x56,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0xaa,0x8c,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x1c,0x2a,0xaa,0x8b,0xff,0x00,0x22,0xaa,0xca,0x08,0x97,0x07,0x8b,0xff,0x00,0x17,0x54,0xc4,0x86,0xff,0x00,0x14,0x55,0x54,0x81,0xff,0x00,0x11,0x55,0xe8,0x81,0xff,0x00,0x11,0x54,0x18,0x7d,0xff,0x00,0x0c,0x55,0x54,0x79,0xff,0x00,0x07,0x56,0x94,0xff,0x00,0x0f,0x55,0x4e,0x93,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x09,0x55,0x5d,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0x8b,0x9f,0x08,0x95,0x07,0x8b,0xab,0xff,0xff,0xf5,0xaa,0xaa,0xff,0x00,0x19,0xd5,0x54,0xff,0xff,0xeb,0x55,0x56,0xff,0x00,0x13,0xaa,0xac,0xff,0xff,0xeb,0x55,0x55,0xff,0x00,0x13,0xaa,0xac,0x6f,0xff,0x00,0x09,0xd5,0x54,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe3,0xff,0xff,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xaa,0x71,0x8b,0xff,0xff,0xdf,0x55,0x54,0x08,0x80,0xc8,0x95,0x07,0x8b,0x9b,0xff,0x00,0x04,0x80,0x00,0xff,0x00,0x0c,0xaa,0xac,0x94,0xff,0x00,0x09,0x55,0x54,0x94,0xff,0x00,0x09,0x55,0x54,0xff,0x00,0x0c,0xd5,0x55,0xff,0x00,0x04,0xaa,0xac,0xff,0x00,0x10,0xaa,0xab,0x8b,0x9b,0x8b,0xff,0x00,0x0c,0x80,0x00,0x86,0x94,0x81,0x94,0x81,0xff,0x00,0x04,0x80,0x00,0x7d,0x8b,0x79,0x08,0x81,0x07,0x8b,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xfb,0x2a,0xab,0xff,0xff,0xf2,0x2a,0xa8,0xff,0xff,0xf6,0x55,0x55,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xf6,0x55,0x60,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xf2,0xd5,0x55,0xff,0xff,0xfa,0xd5,0x54,0xff,0xff,0xef,0x55,0x4b,0x8b,0x08,0x76,0x53,0xa0,0x06,0xff,0x00,0x12,0xaa,0xab,0x8b,0xff,0x00,0x0e,0xd5,0x55,0xff,0xff,0xfa,0x2a,0xac,0x96,0xff,0xff,0xf4,0x55,0x54,0x96,0xff,0xff,0xf4,0x55,0x54,0xff,0x00,0x05,0x80,0x00,0xff,0xff,0xf0,0x80,0x00,0x8b,0xff,0xff,0xec,0xaa,0xac,0x08,0x7e,0x07,0x8b,0xff,0xff,0xec,0xaa,0xac,0x86,0xff,0xff,0xf0,0xd5,0x54,0x81,0x80,0x81,0x80,0x7d,0xff,0xff,0xfa,0x80,0x00,0x79,0x8b,0xff,0xff,0xee,0xaa,0xab,0x8b,0xff,0xff,0xf2,0x55,0x55,0xff,0x00,0x04,0xd5,0x56,0x81,0xff,0x00,0x09,0xaa,0xaa,0x81,0xff,0x00,0x09,0xaa,0xaa,0x86,0xff,0x00,0x0c,0xd5,0x56,0x8b,0x9b,0x08,0x95,0x4f,0x80,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x0a,0x55,0x55,0xff,0xff,0xe5,0xd5,0x56,0xff,0x00,0x14,0xaa,0xac,0x78,0x08,0x0b,0x28,0xfb,0x11,0xca,0x8b,0xf7,0x0c,0xf7,0x11,0x05,0x0b,0xfb,0xec,0xd0,0xf8,0x35,0x46,0x07,0x42,0x55,0x8b,0x41,0x05,0x0b,0x8b,0x38,0xf7,0x57,0xf7,0x5a,0xfb,0x57,0xf7,0x5a,0x8b,0x38,0xf7,0x05,0xfb,0x07,0x05,0x0b,0xc6,0x64,0xed,0x46,0x29,0x33,0x07,0xf7,0x08,0xf7,0xaf,0x47,0x8b,0xfb,0x09,0xfb,0xaf,0x8b,0x50,0xf7,0x31,0x8b,0x8b,0x40,0xd0,0x8b,0x8b,0xd6,0x05,0x0b,0xff,0x00,0x14,0xaa,0xaa,0x78,0xff,0x00,0x1c,0xaa,0xab,0xff,0xff,0xf6,0x80,0x00,0xff,0x00,0x24,0xaa,0xab,0x8b,0xaf,0x8b,0xff,0x00,0x1d,0x2a,0xab,0xff,0x00,0x0a,0xd5,0x56,0xff,0x00,0x16,0x55,0x55,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x16,0x55,0x56,0xff,0x00,0x15,0xaa,0x96,0xff,0x00,0x0b,0x2a,0xaa,0xff,0x00,0x1c,0x2a,0xaa,0x8b,0xff,0x00,0x22,0xaa,0xc0,0x08,0x97,0x07,0x8b,0xff,0x00,0x17,0x55,0x56,0x86,0xff,0x00,0x14,0x55,0x54,0x81,0xff,0x00,0x11,0x55,0x56,0x81,0xff,0x00,0x11,0x55,0x56,0x7d,0xff,0x00,0x0c,0x55,0x54,0x79,0xff,0x00,0x07,0x55,0x56,0xff,0x00,0x0f,0x55,0x4e,0x93,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x0b,0x55,0x54,0xff,0x00,0x09,0x55,0x5d,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x09,0x55,0x56,0xff,0x00,0x0e,0xaa,0xac,0xff,0x00,0x04,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0x8b,0x9f,0x08,0x95,0x07,0x8b,0xab,0xff,0xff,0xf5,0xaa,0xaa,0xff,0x00,0x19,0xd5,0x54,0xff,0xff,0xeb,0x55,0x56,0xff,0x00,0x13,0xaa,0xac,0xff,0xff,0xeb,0x55,0x55,0xff,0x00,0x13,0xaa,0xac,0x6f,0xff,0x00,0x09,0xd5,0x54,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xdc,0xaa,0xab,0x8b,0xff,0xff,0xe3,0xff,0xff,0xff,0xff,0xf6,0x55,0x54,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xeb,0x55,0x56,0xff,0xff,0xec,0xaa,0xac,0xff,0xff,0xf5,0xaa,0xaa,0x71,0x8b,0xff,0xff,0xdf,0x55,0x54,0x08,0x80,0xc8,0x95,0x07,0x8b,0x9b,0xff,0x00,0x04,0x80,0x00,0xff,0x00,0x0c,0xaa,0xac,0x94,0xff,0x00,0x09,0x55,0x54,0x94,0xff,0x00,0x09,0x55,0x54,0xff,0x00,0x0c,0xd5,0x55,0xff,0x00,0x04,0xaa,0xac,0xff,0x00,0x10,0xaa,0xab,0x8b,0x9b,0x8b,0xff,0x00,0x0c,0x80,0x00,0x86,0x94,0x81,0x94,0x81,0xff,0x00,0x04,0x80,0x00,0x7d,0x8b,0x79,0x08,0x81,0x07,0x8b,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xfb,0x2a,0xab,0xff,0xff,0xf2,0x2a,0xa8,0xff,0xff,0xf6,0x55,0x55,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xf6,0x55,0x60,0xff,0xff,0xf5,0xaa,0xac,0xff,0xff,0xf2,0xd5,0x55,0xff,0xff,0xfa,0xd5,0x54,0xff,0xff,0xef,0x55,0x4b,0x8b,0x08,0x76,0x53,0xa0,0x06,0xff,0x00,0x12,0xaa,0xab,0x8b,0xff,0x00,0x0e,0xd5,0x55,0xff,0xff,0xfa,0x2a,0xaa,0x96,0xff,0xff,0xf4,0x55,0x56,0x96,0xff,0xff,0xf4,0x55,0x56,0xff,0x00,0x05,0x80,0x00,0xff,0xff,0xf0,0x80,0x00,0x8b,0xff,0xff,0xec,0xaa,0xaa,0x08,0x7e,0x07,0x8b,0xff,0xff,0xec,0xaa,0xaa,0x86,0xff,0xff,0xf0,0xd5,0x56,0x81,0x80,0x81,0x80,0x7d,0xff,0xff,0xfa,0x80,0x00,0x79,0x8b,0xff,0xff,0xee,0xaa,0xab,0x8b,0xff,0xff,0xf2,0x55,0x55,0xff,0x00,0x04,0xd5,0x56,0x81,0xff,0x00,0x09,0xaa,0xaa,0x81,0xff,0x00,0x09,0xaa,0xaa,0x86,0xff,0x00,0x0c,0xd5,0x56,0x8b,0x9b,0x08,0x95,0x4f,0x80,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xaa,0xaa,0xff,0x00,0x0a,0x55,0x55,0xff,0xff,0xe5,0xd5,0x56,0xff,0x00,0x14,0xaa,0xac,0x78,0x08,0x0b,0x20,0xfb,0x24,0xc9,0x8b,0xd4,0xea,0xd3,0x2c,0xc9,0x8b,0x20,0xf7,0x24,0x05,0x0b,0x9c,0xff,0xff,0xee,0xaa,0xac,0xff,0x00,0x15,0xd5,0x55,0xff,0xff,0xf7,0x55,0x54,0xff,0x00,0x1a,0xaa,0xab,0x8b,0xa5,0x8b,0xff,0x00,0x15,0xaa,0xaa,0xff,0x00,0x08,0xaa,0xac,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x11,0x55,0x56,0xff,0x00,0x11,0x55,0x54,0xff,0x00,0x08,0xaa,0xaa,0xff,0x00,0x15,0xaa,0xac,0x8b,0xa5,0x8b,0xff,0x00,0x1a,0xaa,0xac,0xff,0xff,0xf7,0x55,0x56,0xa1,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xee,0xaa,0xaa,0xff,0x00,0x11,0x55,0x54,0xff,0xff,0xea,0x55,0x56,0xff,0x00,0x08,0xaa,0xac,0x71,0x8b,0xff,0xff,0xe5,0x55,0x55,0x8b,0xff,0xff,0xea,0x2a,0xab,0xff,0xff,0xf7,0x55,0x54,0x7a,0xff,0xff,0xee,0xaa,0xac,0x08,0x7a,0xff,0xff,0xee,0xaa,0xac,0xff,0xff,0xf7,0x80,0x00,0x75,0x8b,0xff,0xff,0xe5,0x55,0x54,0x8b,0x71,0xff,0x00,0x08,0x80,0x00,0xff,0xff,0xea,0x55,0x54,0x9c,0xff,0xff,0xee,0xaa,0xac,0x08,0x0b,0x81,0x81,0xff,0xff,0xf3,0xaa,0xaa,0x86,0xff,0xff,0xf1,0x55,0x56,0x8b,0xff,0xff,0xf1,0x55,0x55,0x8b,0xff,0xff,0xf3,0xaa,0xab,0x90,0x81,0x95,0x81,0x95,0x86,0xff,0x00,0x0c,0xaa,0xac,0x8b,0xff,0x00,0x0f,0x55,0x54,0x8b,0xff,0x00,0x0f,0x55,0x2c,0x90,0xff,0x00,0x0c,0xd5,0x54,0x95,0xff,0x00,0x0a,0x55,0x80,0x95,0xff,0x00,0x0a,0x55,0x54,0xff,0x00,0x0c,0x55,0x55,0xff,0x00,0x05,0x2a,0xac,0xff,0x00,0x0e,0xaa,0xab,0x8b,0xff,0x00,0x0e,0xaa,0xaa,0x8b,0xff,0x00,0x0c,0x55,0x56,0xff,0xff,0xfa,0xd5,0x54,0x95,0xff,0xff,0xf5,0xaa,0xac,0x08,0x95,0xff,0xff,0xf5,0xaa,0xac,0x90,0xff,0xff,0xf3,0x2a,0xa8,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x8b,0xff,0xff,0xf0,0xaa,0xac,0x86,0xff,0xff,0xf3,0x55,0x54,0x81,0x81,0x08,0x0b,0xf6,0xfb,0x24,0xc2,0x8b,0xf6,0xf7,0x24,0x4d,0x8b,0x43,0x2c,0x42,0xea,0x05,0x0b,0x8b,0xf7,0x7a,0x49,0x4d,0x8b,0xfb,0x3c,0x05,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3c,0x00,0x44,0x00,0x00,0x00,0x02,0x00,0x07,0x00,0x01,0x00,0x7c,0x00,0x01,0x00,0x7d,0x00,0x7f,0x00,0x02,0x00,0x80,0x00,0xe5,0x00,0x01,0x00,0xe6,0x00,0xe7,0x00,0x02,0x00,0xe8,0x00,0xe9,0x00,0x01,0x00,0xea,0x00,0xea,0x00,0x02,0x00,0xeb,0x00,0xfa,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x36,0x00,0x74,0x00,0x02,0x44,0x46,0x4c,0x54,0x00,0x0e,0x6c,0x61,0x74,0x6e,0x00,0x1e,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x03,0x00,0x01,0x00,0x03,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x05,0x64,0x6c,0x69,0x67,0x00,0x20,0x66,0x72,0x61,0x63,0x00,0x26,0x6c,0x69,0x67,0x61,0x00,0x2c,0x72,0x74,0x6c,0x61,0x00,0x32,0x73,0x75,0x70,0x73,0x00,0x38,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x05,0x00,0x0c,0x00,0x14,0x00,0x1c,0x00,0x24,0x00,0x2c,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x28,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x52,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x60,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x8c,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x9c,0x00,0x02,0x00,0x1a,0x00,0x0a,0x00,0x0b,0x00,0x0a,0x00,0x20,0x00,0x1e,0x00,0x3f,0x00,0x3d,0x00,0x5f,0x00,0x5d,0x00,0xe3,0x00,0xe2,0x00,0x01,0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x1e,0x00,0x20,0x00,0x3d,0x00,0x3f,0x00,0x5d,0x00,0x5f,0x00,0xe2,0x00,0xe3,0x00,0x02,0x00,0x0c,0x00,0x03,0x00,0x7a,0x00,0x73,0x00,0x74,0x00,0x01,0x00,0x03,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x01,0x00,0x2c,0x00,0x02,0x00,0x0a,0x00,0x20,0x00,0x02,0x00,0x06,0x00,0x0e,0x00,0x7e,0x00,0x03,0x00,0x11,0x00,0x14,0x00,0x7d,0x00,0x03,0x00,0x11,0x00,0x16,0x00,0x01,0x00,0x04,0x00,0x7f,0x00,0x03,0x00,0x11,0x00,0x16,0x00,0x01,0x00,0x02,0x00,0x13,0x00,0x15,0x00,0x01,0x00,0x12,0x00,0x01,0x00,0x08,0x00,0x01,0x00,0x04,0x00,0xea,0x00,0x02,0x00,0x56,0x00,0x01,0x00,0x01,0x00,0x56,0x00,0x01,0x00,0x1a,0x00,0x01,0x00,0x08,0x00,0x02,0x00,0x06,0x00,0x0c,0x00,0xe7,0x00,0x02,0x00,0x4e,0x00,0xe6,0x00,0x02,0x00,0x4b,0x00,0x01,0x00,0x01,0x00,0x48,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x30,0x00,0x50,0x00,0x02,0x44,0x46,0x4c,0x54,0x00,0x0e,0x6c,0x61,0x74,0x6e,0x00,0x1a,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x01,0x00,0x01,0x00,0x02,0x6b,0x65,0x72,0x6e,0x00,0x0e,0x6b,0x65,0x72,0x6e,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x07,0x00,0x10,0x00,0x18,0x00,0x20,0x00,0x28,0x00,0x30,0x00,0x38,0x00,0x40,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x38,0x00,0x02,0x00,0x00,0x00,0x01,0x02,0x98,0x00,0x02,0x00,0x00,0x00,0x01,0x06,0x6c,0x00,0x02,0x00,0x00,0x00,0x01,0x07,0x34,0x00,0x02,0x00,0x00,0x00,0x01,0x08,0xc8,0x00,0x02,0x00,0x00,0x00,0x01,0x0a,0x2c,0x00,0x02,0x00,0x00,0x00,0x01,0x0a,0x80,0x00,0x01,0x02,0x38,0x00,0x04,0x00,0x00,0x00,0x16,0x00,0x36,0x00,0x3c,0x00,0x42,0x00,0x48,0x00,0x4e,0x00,0x54,0x00,0x42,0x00,0x36,0x00,0x6a,0x00,0x7c,0x00,0xc2,0x00,0xc8,0x01,0x96,0x01,0xa4,0x01,0xaa,0x02,0x10,0x02,0x16,0x02,0x1c,0x02,0x26,0x02,0x2c,0x02,0x32,0x02,0x32,0x00,0x01,0x00,0x19,0xff,0xec,0x00,0x01,0x00,0x19,0xff,0xf6,0x00,0x01,0x00,0x19,0xff,0xe2,0x00,0x01,0x00,0x19,0xff,0xd8,0x00,0x01,0x00,0x19,0xff,0xe1,0x00,0x05,0x00,0x15,0xff,0xec,0x00,0x16,0xff,0xd8,0x00,0x18,0xff,0xd8,0x00,0x1a,0xff,0xf6,0x00,0x1b,0xff,0xf1,0x00,0x04,0x00,0x38,0xff,0xf2,0x00,0x3b,0xff,0xf6,0x00,0x9e,0xff,0xf6,0x00,0xc6,0xff,0xf6,0x00,0x11,0x00,0x45,0xff,0xf1,0x00,0x46,0xff,0xf1,0x00,0x47,0xff,0xf1,0x00,0x49,0xff,0xe7,0x00,0x51,0xff,0xf1,0x00,0x53,0xff,0xf1,0x00,0xa8,0xff,0xf1,0x00,0xa9,0xff,0xf1,0x00,0xaa,0xff,0xf1,0x00,0xab,0xff,0xf1,0x00,0xac,0xff,0xf1,0x00,0xb3,0xff,0xf1,0x00,0xb4,0xff,0xf1,0x00,0xb5,0xff,0xf1,0x00,0xb6,0xff,0xf1,0x00,0xb7,0xff,0xf1,0x00,0xc3,0xff,0xf1,0x00,0x01,0x00,0x4b,0xff,0xf4,0x00,0x33,0x00,0x39,0x00,0x0a,0x00,0x43,0xff,0xf8,0x00,0x44,0xff,0xf9,0x00,0x45,0xff,0xf3,0x00,0x46,0xff,0xf3,0x00,0x47,0xff,0xf3,0x00,0x49,0xff,0xf3,0x00,0x4a,0xff,0xf9,0x00,0x4b,0xff,0xf9,0x00,0x4d,0xff,0xf9,0x00,0x4e,0xff,0xf9,0x00,0x4f,0xff,0xf9,0x00,0x50,0xff,0xf9,0x00,0x51,0xff,0xf3,0x00,0x52,0xff,0xf9,0x00,0x53,0xff,0xf3,0x00,0x54,0xff,0xf9,0x00,0x57,0xff,0xf9,0x00,0x58,0xff,0xfd,0x00,0x59,0xff,0xfd,0x00,0x5b,0xff,0xfd,0x00,0xa1,0xff,0xf8,0x00,0xa2,0xff,0xf8,0x00,0xa3,0xff,0xf8,0x00,0xa4,0xff,0xf8,0x00,0xa5,0xff,0xf8,0x00,0xa6,0xff,0xf8,0x00,0xa7,0xff,0xf8,0x00,0xa8,0xff,0xf3,0x00,0xa9,0xff,0xf3,0x00,0xaa,0xff,0xf3,0x00,0xab,0xff,0xf3,0x00,0xac,0xff,0xf3,0x00,0xad,0xff,0xf9,0x00,0xae,0xff,0xf9,0x00,0xaf,0xff,0xf9,0x00,0xb0,0xff,0xf9,0x00,0xb2,0xff,0xf9,0x00,0xb3,0xff,0xf3,0x00,0xb4,0xff,0xf3,0x00,0xb5,0xff,0xf3,0x00,0xb6,0xff,0xf3,0x00,0xb7,0xff,0xf3,0x00,0xba,0xff,0xf9,0x00,0xbb,0xff,0xf9,0x00,0xbc,0xff,0xf9,0x00,0xbd,0xff,0xf9,0x00,0xbe,0xff,0xfd,0x00,0xbf,0xff,0xf9,0x00,0xc0,0xff,0xfd,0x00,0xc3,0xff,0xf3,0x00,0x03,0x00,0x3b,0xff,0xf6,0x00,0x9e,0xff,0xf6,0x00,0xc6,0xff,0xf6,0x00,0x01,0x00,0x5c,0xff,0xba,0x00,0x19,0x00,0x43,0xff,0xec,0x00,0x45,0xff,0xdd,0x00,0x46,0xff,0xdd,0x00,0x47,0xff,0xdd,0x00,0x49,0xff,0xdd,0x00,0x51,0xff,0xdd,0x00,0x53,0xff,0xdd,0x00,0xa1,0xff,0xec,0x00,0xa2,0xff,0xec,0x00,0xa3,0xff,0xec,0x00,0xa4,0xff,0xec,0x00,0xa5,0xff,0xec,0x00,0xa6,0xff,0xec,0x00,0xa7,0xff,0xec,0x00,0xa8,0xff,0xdd,0x00,0xa9,0xff,0xdd,0x00,0xaa,0xff,0xdd,0x00,0xab,0xff,0xdd,0x00,0xac,0xff,0xdd,0x00,0xb3,0xff,0xdd,0x00,0xb4,0xff,0xdd,0x00,0xb5,0xff,0xdd,0x00,0xb6,0xff,0xdd,0x00,0xb7,0xff,0xdd,0x00,0xc3,0xff,0xdd,0x00,0x01,0x00,0x49,0x00,0x0a,0x00,0x01,0x00,0x4c,0x00,0x14,0x00,0x02,0x00,0xd8,0xff,0xf6,0x00,0xdb,0xff,0xf6,0x00,0x01,0x00,0x90,0x00,0x5a,0x00,0x01,0x00,0xb0,0x00,0x65,0x00,0x01,0x00,0x87,0xff,0x60,0x00,0x01,0x00,0x16,0x00,0x12,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x18,0x00,0x19,0x00,0x1a,0x00,0x1b,0x00,0x24,0x00,0x27,0x00,0x28,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x3c,0x00,0x49,0x00,0x4c,0x00,0x50,0x00,0x90,0x00,0xb0,0x00,0xd7,0x00,0xda,0x00,0x02,0x03,0xae,0x00,0x04,0x00,0x00,0x02,0x08,0x02,0x5a,0x00,0x0c,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf7,0xff,0xb3,0xff,0xed,0xff,0xdb,0xff,0xed,0xff,0xd1,0x00,0x14,0xff,0xcb,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x76,0x00,0x00,0xff,0xec,0xff,0xbc,0xff,0xce,0xff,0xd5,0xff,0xce,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xd9,0x00,0x00,0xff,0xf6,0xff,0xfa,0xff,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xd9,0xff,0x8e,0xff,0xca,0xff,0x9b,0xff,0xbb,0xff,0x96,0x00,0x00,0xff,0x9a,0xff,0xa5,0x00,0x00,0xff,0xf0,0xff,0xe1,0xff,0xe4,0x00,0x00,0xff,0x7e,0xff,0x88,0xff,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x90,0x00,0x00,0x00,0x00,0xff,0xd4,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0xff,0xb2,0x00,0x00,0xff,0xc4,0xff,0xb3,0xff,0xae,0xff,0xbc,0xff,0xb0,0xff,0xb9,0xff,0xba,0x00,0x00,0x00,0x00,0xff,0xd9,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xd9,0x00,0x00,0x00,0x00,0xff,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xbc,0x00,0x00,0x00,0x01,0xff,0xe2,0xff,0xd9,0xff,0xe4,0xff,0xda,0x00,0x00,0xff,0xd9,0x00,0x00,0x00,0x00,0xff,0xed,0x00,0x00,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc8,0x00,0x00,0x00,0x00,0xff,0xed,0xff,0xed,0xff,0xfb,0xff,0xee,0x00,0x00,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0d,0x00,0x23,0x00,0x23,0x00,0x01,0x00,0x24,0x00,0x24,0x00,0x02,0x00,0x28,0x00,0x28,0x00,0x03,0x00,0x2d,0x00,0x2d,0x00,0x04,0x00,0x2e,0x00,0x2e,0x00,0x05,0x00,0x32,0x00,0x32,0x00,0x06,0x00,0x36,0x00,0x36,0x00,0x07,0x00,0x37,0x00,0x37,0x00,0x08,0x00,0x38,0x00,0x38,0x00,0x09,0x00,0x39,0x00,0x39,0x00,0x0a,0x00,0x3a,0x00,0x3a,0x00,0x0b,0x00,0x81,0x00,0x86,0x00,0x01,0x00,0x9a,0x00,0x9d,0x00,0x08,0x00,0x02,0x00,0x38,0x00,0x0e,0x00,0x0e,0x00,0x07,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x07,0x00,0x1c,0x00,0x1d,0x00,0x12,0x00,0x23,0x00,0x23,0x00,0x0a,0x00,0x25,0x00,0x25,0x00,0x01,0x00,0x29,0x00,0x29,0x00,0x01,0x00,0x31,0x00,0x31,0x00,0x01,0x00,0x33,0x00,0x33,0x00,0x01,0x00,0x36,0x00,0x36,0x00,0x02,0x00,0x37,0x00,0x37,0x00,0x03,0x00,0x38,0x00,0x38,0x00,0x04,0x00,0x39,0x00,0x39,0x00,0x05,0x00,0x3b,0x00,0x3b,0x00,0x06,0x00,0x3e,0x00,0x3e,0x00,0x11,0x00,0x43,0x00,0x43,0x00,0x0b,0x00,0x44,0x00,0x44,0x00,0x0c,0x00,0x45,0x00,0x47,0x00,0x0d,0x00,0x49,0x00,0x49,0x00,0x0d,0x00,0x4a,0x00,0x4b,0x00,0x0c,0x00,0x4d,0x00,0x50,0x00,0x0c,0x00,0x51,0x00,0x51,0x00,0x0d,0x00,0x52,0x00,0x52,0x00,0x0c,0x00,0x53,0x00,0x53,0x00,0x0d,0x00,0x54,0x00,0x54,0x00,0x0c,0x00,0x55,0x00,0x55,0x00,0x0e,0x00,0x57,0x00,0x57,0x00,0x0c,0x00,0x58,0x00,0x59,0x00,0x09,0x00,0x5a,0x00,0x5a,0x00,0x13,0x00,0x5b,0x00,0x5b,0x00,0x09,0x00,0x7c,0x00,0x7c,0x00,0x14,0x00,0x81,0x00,0x87,0x00,0x0a,0x00,0x88,0x00,0x88,0x00,0x01,0x00,0x93,0x00,0x97,0x00,0x01,0x00,0x99,0x00,0x99,0x00,0x01,0x00,0x9a,0x00,0x9d,0x00,0x03,0x00,0x9e,0x00,0x9e,0x00,0x06,0x00,0xa1,0x00,0xa7,0x00,0x0b,0x00,0xa8,0x00,0xac,0x00,0x0d,0x00,0xad,0x00,0xb0,0x00,0x0c,0x00,0xb2,0x00,0xb2,0x00,0x0c,0x00,0xb3,0x00,0xb7,0x00,0x0d,0x00,0xba,0x00,0xbd,0x00,0x0c,0x00,0xbe,0x00,0xbe,0x00,0x09,0x00,0xbf,0x00,0xbf,0x00,0x0c,0x00,0xc0,0x00,0xc0,0x00,0x09,0x00,0xc2,0x00,0xc2,0x00,0x01,0x00,0xc3,0x00,0xc3,0x00,0x0d,0x00,0xc5,0x00,0xc5,0x00,0x0e,0x00,0xc6,0x00,0xc6,0x00,0x06,0x00,0xd7,0x00,0xd7,0x00,0x10,0x00,0xd8,0x00,0xd8,0x00,0x08,0x00,0xd9,0x00,0xd9,0x00,0x07,0x00,0xda,0x00,0xda,0x00,0x10,0x00,0xdb,0x00,0xdb,0x00,0x08,0x00,0xdc,0x00,0xdc,0x00,0x07,0x00,0x01,0x00,0x15,0x00,0x23,0x00,0x24,0x00,0x28,0x00,0x2d,0x00,0x2e,0x00,0x32,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x81,0x00,0x82,0x00,0x83,0x00,0x84,0x00,0x85,0x00,0x86,0x00,0x9a,0x00,0x9b,0x00,0x9c,0x00,0x9d,0x00,0x02,0x00,0xb2,0x00,0x04,0x00,0x00,0x00,0x2c,0x00,0x60,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf1,0xff,0xf7,0xff,0xef,0xff,0xee,0xff,0xe1,0xff,0xec,0x00,0x02,0x00,0x08,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x25,0x00,0x26,0x00,0x01,0x00,0x29,0x00,0x29,0x00,0x01,0x00,0x31,0x00,0x31,0x00,0x01,0x00,0x88,0x00,0x88,0x00,0x01,0x00,0x91,0x00,0x91,0x00,0x01,0x00,0x93,0x00,0x97,0x00,0x01,0x00,0x99,0x00,0x99,0x00,0x01,0x00,0x02,0x00,0x0d,0x00,0x0e,0x00,0x0e,0x00,0x05,0x00,0x10,0x00,0x10,0x00,0x05,0x00,0x23,0x00,0x23,0x00,0x01,0x00,0x38,0x00,0x38,0x00,0x02,0x00,0x3a,0x00,0x3a,0x00,0x03,0x00,0x3b,0x00,0x3b,0x00,0x04,0x00,0x5c,0x00,0x5c,0x00,0x06,0x00,0x81,0x00,0x87,0x00,0x01,0x00,0x9e,0x00,0x9e,0x00,0x04,0x00,0xc6,0x00,0xc6,0x00,0x04,0x00,0xc8,0x00,0xc8,0x00,0x06,0x00,0xd9,0x00,0xd9,0x00,0x05,0x00,0xdc,0x00,0xdc,0x00,0x05,0x00,0x01,0x00,0x0d,0x00,0x02,0x00,0x25,0x00,0x26,0x00,0x29,0x00,0x31,0x00,0x88,0x00,0x91,0x00,0x93,0x00,0x94,0x00,0x95,0x00,0x96,0x00,0x97,0x00,0x99,0x00,0x02,0x01,0x68,0x00,0x04,0x00,0x00,0x00,0x64,0x01,0x04,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xff,0xd9,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc1,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf3,0x00,0x02,0x00,0x1a,0x00,0x43,0x00,0x43,0x00,0x02,0x00,0x44,0x00,0x45,0x00,0x03,0x00,0x46,0x00,0x46,0x00,0x02,0x00,0x47,0x00,0x47,0x00,0x03,0x00,0x48,0x00,0x48,0x00,0x01,0x00,0x49,0x00,0x4c,0x00,0x02,0x00,0x4f,0x00,0x50,0x00,0x02,0x00,0x51,0x00,0x52,0x00,0x03,0x00,0x53,0x00,0x53,0x00,0x02,0x00,0x54,0x00,0x54,0x00,0x04,0x00,0x57,0x00,0x57,0x00,0x02,0x00,0x58,0x00,0x59,0x00,0x05,0x00,0x5a,0x00,0x5a,0x00,0x06,0x00,0x5b,0x00,0x5b,0x00,0x05,0x00,0xa1,0x00,0xa6,0x00,0x02,0x00,0xa7,0x00,0xac,0x00,0x03,0x00,0xad,0x00,0xb0,0x00,0x02,0x00,0xb2,0x00,0xb2,0x00,0x02,0x00,0xb3,0x00,0xb7,0x00,0x03,0x00,0xb9,0x00,0xb9,0x00,0x03,0x00,0xba,0x00,0xbd,0x00,0x02,0x00,0xbe,0x00,0xbe,0x00,0x05,0x00,0xbf,0x00,0xbf,0x00,0x03,0x00,0xc0,0x00,0xc0,0x00,0x05,0x00,0xc3,0x00,0xc3,0x00,0x03,0x00,0xe6,0x00,0xe6,0x00,0x02,0x00,0x02,0x00,0x10,0x00,0x0e,0x00,0x0e,0x00,0x02,0x00,0x10,0x00,0x10,0x00,0x02,0x00,0x45,0x00,0x47,0x00,0x05,0x00,0x48,0x00,0x48,0x00,0x01,0x00,0x49,0x00,0x49,0x00,0x05,0x00,0x51,0x00,0x51,0x00,0x05,0x00,0x53,0x00,0x53,0x00,0x05,0x00,0x5a,0x00,0x5a,0x00,0x04,0x00,0xa8,0x00,0xac,0x00,0x05,0x00,0xb3,0x00,0xb7,0x00,0x05,0x00,0xc3,0x00,0xc3,0x00,0x05,0x00,0xd8,0x00,0xd8,0x00,0x03,0x00,0xd9,0x00,0xd9,0x00,0x02,0x00,0xdb,0x00,0xdb,0x00,0x03,0x00,0xdc,0x00,0xdc,0x00,0x02,0x00,0xe6,0x00,0xe7,0x00,0x01,0x00,0x02,0x00,0x08,0x00,0x43,0x00,0x4c,0x00,0x00,0x00,0x4f,0x00,0x54,0x00,0x0a,0x00,0x57,0x00,0x5b,0x00,0x10,0x00,0xa1,0x00,0xb0,0x00,0x15,0x00,0xb2,0x00,0xb7,0x00,0x25,0x00,0xb9,0x00,0xc0,0x00,0x2b,0x00,0xc3,0x00,0xc3,0x00,0x33,0x00,0xe6,0x00,0xe6,0x00,0x34,0x00,0x02,0x01,0x58,0x00,0x04,0x00,0x00,0x00,0x9c,0x00,0xd0,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xba,0xff,0xd9,0xff,0xe1,0xff,0xba,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x14,0xff,0xcb,0xff,0xb5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc1,0xff,0xd4,0x00,0x10,0x00,0x00,0x00,0x00,0xff,0xf6,0x00,0x00,0xff,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xce,0x00,0x00,0x00,0x00,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xba,0xff,0xba,0x00,0x00,0xff,0xba,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x08,0x00,0x0f,0x00,0x0f,0x00,0x01,0x00,0x6c,0x00,0x6c,0x00,0x04,0x00,0x7c,0x00,0x7c,0x00,0x05,0x00,0xd7,0x00,0xd7,0x00,0x02,0x00,0xd8,0x00,0xd8,0x00,0x03,0x00,0xda,0x00,0xda,0x00,0x02,0x00,0xdb,0x00,0xdb,0x00,0x03,0x00,0xdc,0x00,0xdc,0x00,0x06,0x00,0x02,0x00,0x16,0x00,0x23,0x00,0x23,0x00,0x05,0x00,0x2c,0x00,0x2c,0x00,0x06,0x00,0x36,0x00,0x36,0x00,0x01,0x00,0x38,0x00,0x38,0x00,0x02,0x00,0x39,0x00,0x39,0x00,0x03,0x00,0x3b,0x00,0x3b,0x00,0x04,0x00,0x45,0x00,0x47,0x00,0x07,0x00,0x49,0x00,0x49,0x00,0x07,0x00,0x51,0x00,0x51,0x00,0x07,0x00,0x53,0x00,0x53,0x00,0x07,0x00,0x55,0x00,0x55,0x00,0x08,0x00,0x58,0x00,0x59,0x00,0x09,0x00,0x5b,0x00,0x5b,0x00,0x09,0x00,0x81,0x00,0x87,0x00,0x05,0x00,0x9e,0x00,0x9e,0x00,0x04,0x00,0xa8,0x00,0xac,0x00,0x07,0x00,0xb3,0x00,0xb7,0x00,0x07,0x00,0xbe,0x00,0xbe,0x00,0x09,0x00,0xc0,0x00,0xc0,0x00,0x09,0x00,0xc3,0x00,0xc3,0x00,0x07,0x00,0xc5,0x00,0xc5,0x00,0x08,0x00,0xc6,0x00,0xc6,0x00,0x04,0x00,0x01,0x00,0x08,0x00,0x0f,0x00,0x6c,0x00,0x7c,0x00,0xd7,0x00,0xd8,0x00,0xda,0x00,0xdb,0x00,0xdc,0x00,0x02,0x00,0x52,0x00,0x04,0x00,0x00,0x00,0x24,0x00,0x3a,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf5,0xff,0xc7,0xff,0xdf,0xff,0xfc,0x00,0x02,0x00,0x03,0x00,0x0e,0x00,0x0e,0x00,0x01,0x00,0x10,0x00,0x10,0x00,0x01,0x00,0xd9,0x00,0xd9,0x00,0x01,0x00,0x01,0x00,0x13,0x00,0x09,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x03,0x00,0x0e,0x00,0x10,0x00,0xd9,0x00,0x02,0x00,0x44,0x00,0x04,0x00,0x00,0x00,0x1c,0x00,0x28,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xdb,0x00,0x00,0xff,0xa3,0x00,0x01,0x00,0x19,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x0e,0x00,0x0e,0x00,0x01,0x00,0x10,0x00,0x10,0x00,0x01,0x00,0xd9,0x00,0xd9,0x00,0x01,0x00,0xdc,0x00,0xdc,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x19,0x00,0x1b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xcc,0x3d,0xa2,0xcf,0x00,0x00,0x00,0x00,0xd3,0x57,0xea,0xc9,0x00,0x00,0x00,0x00,0xd6,0x21,0x41,0x41,0x02,0x58,0x00,0x65,0x00,0xd9,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,0xef,0x00,0x4b,0x01,0x34,0x00,0x35,0x01,0xff,0x00,0x19,0x01,0xc9,0x00,0x21,0x03,0x3e,0x00,0x2a,0x02,0x55,0x00,0x3b,0x00,0xac,0x00,0x35,0x01,0x20,0x00,0x3b,0x01,0x20,0x00,0x3b,0x01,0x79,0x00,0x3b,0x02,0x00,0x00,0x39,0x00,0xac,0x00,0x35,0x01,0x89,0x00,0x3b,0x00,0xc2,0x00,0x35,0x01,0x88,0x00,0x3b,0x01,0xed,0x00,0x42,0x01,0x49,0x00,0x32,0x01,0xd4,0x00,0x3b,0x01,0xef,0x00,0x3d,0x01,0xf3,0x00,0x2e,0x01,0xe4,0x00,0x42,0x01,0xee,0x00,0x3b,0x01,0xaf,0x00,0x28,0x02,0x00,0x00,0x42,0x01,0xee,0x00,0x3b,0x00,0xc2,0x00,0x35,0x00,0xc2,0x00,0x35,0x02,0x00,0x00,0x39,0x02,0x00,0x00,0x39,0x02,0x00,0x00,0x39,0x01,0xad,0x00,0x26,0x03,0x68,0x00,0x3b,0x02,0x41,0x00,0x07,0x02,0x66,0x00,0x50,0x02,0x62,0x00,0x42,0x02,0x6d,0x00,0x50,0x02,0x23,0x00,0x50,0x02,0x1b,0x00,0x50,0x02,0x62,0x00,0x42,0x02,0x75,0x00,0x50,0x00,0xf9,0x00,0x58,0x01,0x39,0x00,0x20,0x02,0x56,0x00,0x50,0x02,0x11,0x00,0x50,0x02,0xf1,0x00,0x50,0x02,0x97,0x00,0x50,0x02,0x62,0x00,0x42,0x02,0x41,0x00,0x50,0x02,0x62,0x00,0x42,0x02,0x57,0x00,0x50,0x02,0x22,0x00,0x21,0x01,0xe2,0x00,0x08,0x02,0x7b,0x00,0x50,0x02,0x0b,0x00,0x07,0x03,0x1c,0x00,0x07,0x02,0x36,0x00,0x07,0x01,0xf3,0x00,0x07,0x02,0x04,0x00,0x28,0x01,0x27,0x00,0x50,0x01,0x88,0x00,0x3b,0x01,0x27,0x00,0x3b,0x02,0x00,0x00,0x36,0x01,0xc9,0x00,0x00,0x01,0xf4,0x00,0x94,0x01,0xf1,0x00,0x2f,0x01,0xfe,0x00,0x4b,0x01,0xf7,0x00,0x3b,0x01,0xff,0x00,0x3b,0x01,0xf7,0x00,0x3b,0x01,0x47,0x00,0x32,0x01,0xff,0x00,0x3b,0x02,0x0a,0x00,0x4b,0x00,0xea,0x00,0x51,0x00,0xe2,0xff,0xe2,0x01,0xee,0x00,0x4b,0x01,0x11,0x00,0x4b,0x03,0x39,0x00,0x4b,0x02,0x0a,0x00,0x4b,0x01,0xf9,0x00,0x3b,0x01,0xfe,0x00,0x4b,0x01,0xff,0x00,0x3b,0x01,0x51,0x00,0x4b,0x01,0xce,0x00,0x2f,0x01,0x54,0x00,0x22,0x02,0x0a,0x00,0x4b,0x01,0xb7,0x00,0x0e,0x02,0xca,0x00,0x0e,0x01,0xa5,0x00,0x0e,0x01,0xb7,0x00,0x0e,0x01,0xc8,0x00,0x3b,0x01,0x54,0x00,0x3b,0x01,0x2f,0x00,0x76,0x01,0x54,0x00,0x3b,0x02,0x00,0x00,0x2f,0x00,0xd9,0x00,0x00,0x00,0xef,0x00,0x4b,0x01,0xf7,0x00,0x3b,0x01,0xb4,0x00,0x21,0x02,0x65,0x00,0x4b,0x01,0xc6,0x00,0x0a,0x01,0x2f,0x00,0x76,0x01,0xff,0x00,0x50,0x01,0xf4,0x00,0x7e,0x03,0x35,0x00,0x42,0x01,0x4a,0x00,0x23,0x01,0xde,0x00,0x19,0x02,0x00,0x00,0x38,0x01,0x89,0x00,0x3b,0x02,0x19,0x00,0x50,0x01,0xf4,0x00,0x78,0x01,0x9b,0x00,0x42,0x02,0x00,0x00,0x39,0x01,0x41,0x00,0x2a,0x01,0x3f,0x00,0x27,0x01,0xf4,0x00,0xa9,0x02,0x03,0x00,0x4b,0x02,0x65,0x00,0x50,0x00,0xc2,0x00,0x35,0x01,0xf4,0x00,0xbc,0x00,0xde,0x00,0x1a,0x01,0x4a,0x00,0x29,0x01,0xde,0x00,0x4b,0x02,0xda,0x00,0x1a,0x02,0xcf,0x00,0x1a,0x03,0x3b,0x00,0x27,0x01,0xad,0x00,0x2f,0x02,0x41,0x00,0x07,0x02,0x41,0x00,0x07,0x02,0x41,0x00,0x07,0x02,0x41,0x00,0x07,0x02,0x41,0x00,0x07,0x02,0x41,0x00,0x07,0x03,0x62,0x00,0x07,0x02,0x62,0x00,0x42,0x02,0x23,0x00,0x50,0x02,0x23,0x00,0x50,0x02,0x23,0x00,0x50,0x02,0x23,0x00,0x50,0x00,0xf9,0xff,0xff,0x00,0xf9,0x00,0x32,0x00,0xf9,0xff,0xf6,0x00,0xf9,0x00,0x01,0x02,0x9d,0x00,0x26,0x02,0x97,0x00,0x50,0x02,0x62,0x00,0x42,0x02,0x62,0x00,0x42,0x02,0x62,0x00,0x42,0x02,0x62,0x00,0x42,0x02,0x62,0x00,0x42,0x02,0x00,0x00,0x59,0x02,0x62,0x00,0x42,0x02,0x7b,0x00,0x50,0x02,0x7b,0x00,0x50,0x02,0x7b,0x00,0x50,0x02,0x7b,0x00,0x50,0x01,0xf3,0x00,0x07,0x02,0x41,0x00,0x50,0x01,0xf9,0x00,0x4b,0x01,0xf1,0x00,0x2f,0x01,0xf1,0x00,0x2f,0x01,0xf1,0x00,0x2f,0x01,0xf1,0x00,0x2f,0x01,0xf1,0x00,0x2f,0x01,0xf1,0x00,0x2f,0x03,0x1e,0x00,0x2f,0x01,0xf7,0x00,0x3b,0x01,0xf7,0x00,0x3b,0x01,0xf7,0x00,0x3b,0x01,0xf7,0x00,0x3b,0x01,0xf7,0x00,0x3b,0x00,0xea,0xff,0xd9,0x00,0xea,0x00,0x49,0x00,0xea,0xff,0xee,0x00,0xea,0xff,0xf9,0x01,0xf0,0x00,0x3b,0x02,0x0a,0x00,0x4b,0x01,0xf9,0x00,0x3b,0x01,0xf9,0x00,0x3b,0x01,0xf9,0x00,0x3b,0x01,0xf9,0x00,0x3b,0x01,0xf9,0x00,0x3b,0x02,0x00,0x00,0x39,0x01,0xf9,0x00,0x3b,0x02,0x0a,0x00,0x4b,0x02,0x0a,0x00,0x4b,0x02,0x0a,0x00,0x4b,0x02,0x0a,0x00,0x4b,0x01,0xb7,0x00,0x0e,0x01,0xfe,0x00,0x4b,0x01,0xb7,0x00,0x0e,0x00,0xea,0x00,0x53,0x03,0x7d,0x00,0x42,0x03,0x36,0x00,0x3b,0x02,0x22,0x00,0x21,0x01,0xce,0x00,0x2f,0x01,0xf3,0x00,0x07,0x02,0x04,0x00,0x28,0x01,0xc8,0x00,0x3b,0x01,0x96,0x00,0x0d,0x01,0xf4,0x00,0x73,0x01,0xf4,0x00,0x73,0x01,0xf4,0x00,0xd6,0x01,0xf4,0x00,0x9f,0x01,0xf4,0x00,0x7e,0x00,0x00,0xff,0x82,0x00,0x00,0xff,0xb5,0x00,0x00,0xff,0x79,0x00,0x00,0xff,0x84,0x00,0x00,0xff,0x84,0x00,0x00,0xff,0xa5,0x01,0xa1,0x00,0x00,0x03,0x41,0x00,0x00,0x00,0xac,0x00,0x35,0x00,0xac,0x00,0x35,0x00,0xac,0x00,0x35,0x01,0x34,0x00,0x34,0x01,0x34,0x00,0x35,0x01,0x34,0x00,0x35,0x02,0x0f,0x00,0x4b,0x02,0x0f,0x00,0x4b,0x01,0xd7,0x00,0x71,0x02,0x98,0x00,0x35,0x04,0x85,0x00,0x2a,0x01,0x27,0x00,0x19,0x01,0x34,0x00,0x4b,0x02,0x1e,0x00,0x26,0x03,0x33,0x00,0x28,0x02,0x31,0x00,0x32,0x02,0x58,0x00,0x32,0x00,0x00,0x00,0x00,0x02,0x58,0x00,0x00,0x02,0x72,0x00,0x22,0x01,0x47,0x00,0x2a,0x00,0xde,0x00,0x1a,0x01,0x41,0x00,0x2a,0x01,0x3f,0x00,0x27,0x01,0x4c,0x00,0x24,0x01,0x47,0x00,0x2a,0x00,0xde,0x00,0x1a,0x01,0x41,0x00,0x2a,0x01,0x3f,0x00,0x27,0x01,0x4c,0x00,0x24,0x01,0x47,0x00,0x2a,0x00,0xde,0x00,0x1a,0x01,0x41,0x00,0x2a,0x01,0x3f,0x00,0x27,0x01,0x4c,0x00,0x24,0x00,0xb0,0xff,0x83,};
+const unsigned D_DIN_otf_size = sizeof(D_DIN_otf);
+
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+namespace resources 
+{
+const unsigned char about_resources_txt[] = {0x54,0x65,0x73,0x73,0x65,0x72,0x61,0x63,0x74,0x5f,0x4d,0x61,0x72,0x6b,0x2e,0x73,0x76,0x67,0x3a,0x0a,0x59,0x69,0x6e,0x77,0x65,0x69,0x63,0x68,0x65,0x6e,0x2c,0x20,0x43,0x43,0x20,0x42,0x59,0x2d,0x53,0x41,0x20,0x34,0x2e,0x30,0x2c,0x20,0x76,0x69,0x61,0x20,0x57,0x69,0x6b,0x69,0x6d,0x65,0x64,0x69,0x61,0x20,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x0a,0x0a,0x44,0x2d,0x44,0x49,0x4e,0x20,0x46,0x6f,0x6e,0x74,0x73,0x3a,0x0a,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x43,0x29,0x20,0x32,0x30,0x31,0x37,0x20,0x44,0x61,0x74,0x74,0x6f,0x20,0x49,0x6e,0x63,0x2e,0x20,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x64,0x61,0x74,0x74,0x6f,0x2e,0x63,0x6f,0x6d,0x2f,0x66,0x6f,0x6e,0x74,0x73,0x2f,0x64,0x2d,0x64,0x69,0x6e,0x2c,0x0a,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x49,0x4c,0x20,0x4f,0x70,0x65,0x6e,0x20,0x46,0x6f,0x6e,0x74,0x20,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x2e,0x31,0x2e,0x0a,0x0a,};
+const unsigned about_resources_txt_size = sizeof(about_resources_txt);
+
+}
\ No newline at end of file
@@ -0,0 +1,5 @@
+#include "D_DIN_Italic_otf.c"
+#include "D_DIN_otf.c"
+#include "Tesseract_Mark_svg.c"
+#include "about_resources_txt.c"
+#include "vignette_jpg.c"
@@ -0,0 +1,6 @@
+namespace resources 
+{
+const unsigned char vignette_jpg[] = {0xff,0xd8,0xff,0xe0,0x00,0x10,0x4a,0x46,0x49,0x46,0x00,0x01,0x01,0x01,0x00,0x48,0x00,0x48,0x00,0x00,0xff,0xe1,0x00,0xa0,0x45,0x78,0x69,0x66,0x00,0x00,0x4d,0x4d,0x00,0x2a,0x00,0x00,0x00,0x08,0x00,0x05,0x01,0x1a,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4a,0x01,0x1b,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x52,0x01,0x28,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x01,0x32,0x00,0x02,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x5a,0x87,0x69,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x01,0x32,0x30,0x32,0x32,0x3a,0x30,0x37,0x3a,0x31,0x36,0x20,0x31,0x30,0x3a,0x32,0x37,0x3a,0x33,0x32,0x00,0x00,0x03,0xa0,0x01,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0xa0,0x02,0x00,0x03,0x00,0x00,0x00,0x01,0x05,0xa0,0x00,0x00,0xa0,0x03,0x00,0x03,0x00,0x00,0x00,0x01,0x03,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe1,0x0b,0xc8,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x6e,0x73,0x2e,0x61,0x64,0x6f,0x62,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x78,0x61,0x70,0x2f,0x31,0x2e,0x30,0x2f,0x00,0x3c,0x3f,0x78,0x70,0x61,0x63,0x6b,0x65,0x74,0x20,0x62,0x65,0x67,0x69,0x6e,0x3d,0x22,0xef,0xbb,0xbf,0x22,0x20,0x69,0x64,0x3d,0x22,0x57,0x35,0x4d,0x30,0x4d,0x70,0x43,0x65,0x68,0x69,0x48,0x7a,0x72,0x65,0x53,0x7a,0x4e,0x54,0x63,0x7a,0x6b,0x63,0x39,0x64,0x22,0x3f,0x3e,0x20,0x3c,0x78,0x3a,0x78,0x6d,0x70,0x6d,0x65,0x74,0x61,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x3d,0x22,0x61,0x64,0x6f,0x62,0x65,0x3a,0x6e,0x73,0x3a,0x6d,0x65,0x74,0x61,0x2f,0x22,0x20,0x78,0x3a,0x78,0x6d,0x70,0x74,0x6b,0x3d,0x22,0x58,0x4d,0x50,0x20,0x43,0x6f,0x72,0x65,0x20,0x35,0x2e,0x35,0x2e,0x30,0x22,0x3e,0x20,0x3c,0x72,0x64,0x66,0x3a,0x52,0x44,0x46,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x72,0x64,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x30,0x32,0x2f,0x32,0x32,0x2d,0x72,0x64,0x66,0x2d,0x73,0x79,0x6e,0x74,0x61,0x78,0x2d,0x6e,0x73,0x23,0x22,0x3e,0x20,0x3c,0x72,0x64,0x66,0x3a,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6f,0x6e,0x20,0x72,0x64,0x66,0x3a,0x61,0x62,0x6f,0x75,0x74,0x3d,0x22,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x64,0x63,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x70,0x75,0x72,0x6c,0x2e,0x6f,0x72,0x67,0x2f,0x64,0x63,0x2f,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x2f,0x31,0x2e,0x31,0x2f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x70,0x68,0x6f,0x74,0x6f,0x73,0x68,0x6f,0x70,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x6e,0x73,0x2e,0x61,0x64,0x6f,0x62,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x70,0x68,0x6f,0x74,0x6f,0x73,0x68,0x6f,0x70,0x2f,0x31,0x2e,0x30,0x2f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6d,0x70,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x6e,0x73,0x2e,0x61,0x64,0x6f,0x62,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x78,0x61,0x70,0x2f,0x31,0x2e,0x30,0x2f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6d,0x70,0x4d,0x4d,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x6e,0x73,0x2e,0x61,0x64,0x6f,0x62,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x78,0x61,0x70,0x2f,0x31,0x2e,0x30,0x2f,0x6d,0x6d,0x2f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x73,0x74,0x45,0x76,0x74,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x6e,0x73,0x2e,0x61,0x64,0x6f,0x62,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x78,0x61,0x70,0x2f,0x31,0x2e,0x30,0x2f,0x73,0x54,0x79,0x70,0x65,0x2f,0x52,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x45,0x76,0x65,0x6e,0x74,0x23,0x22,0x20,0x70,0x68,0x6f,0x74,0x6f,0x73,0x68,0x6f,0x70,0x3a,0x43,0x6f,0x6c,0x6f,0x72,0x4d,0x6f,0x64,0x65,0x3d,0x22,0x33,0x22,0x20,0x70,0x68,0x6f,0x74,0x6f,0x73,0x68,0x6f,0x70,0x3a,0x49,0x43,0x43,0x50,0x72,0x6f,0x66,0x69,0x6c,0x65,0x3d,0x22,0x73,0x52,0x47,0x42,0x20,0x49,0x45,0x43,0x36,0x31,0x39,0x36,0x36,0x2d,0x32,0x2e,0x31,0x22,0x20,0x78,0x6d,0x70,0x3a,0x4d,0x6f,0x64,0x69,0x66,0x79,0x44,0x61,0x74,0x65,0x3d,0x22,0x32,0x30,0x32,0x32,0x2d,0x30,0x37,0x2d,0x31,0x36,0x54,0x31,0x30,0x3a,0x32,0x37,0x3a,0x33,0x32,0x2d,0x30,0x37,0x3a,0x30,0x30,0x22,0x20,0x78,0x6d,0x70,0x3a,0x4d,0x65,0x74,0x61,0x64,0x61,0x74,0x61,0x44,0x61,0x74,0x65,0x3d,0x22,0x32,0x30,0x32,0x32,0x2d,0x30,0x37,0x2d,0x31,0x36,0x54,0x31,0x30,0x3a,0x32,0x37,0x3a,0x33,0x32,0x2d,0x30,0x37,0x3a,0x30,0x30,0x22,0x3e,0x20,0x3c,0x64,0x63,0x3a,0x74,0x69,0x74,0x6c,0x65,0x3e,0x20,0x3c,0x72,0x64,0x66,0x3a,0x41,0x6c,0x74,0x3e,0x20,0x3c,0x72,0x64,0x66,0x3a,0x6c,0x69,0x20,0x78,0x6d,0x6c,0x3a,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x78,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x76,0x69,0x67,0x6e,0x65,0x74,0x74,0x65,0x3c,0x2f,0x72,0x64,0x66,0x3a,0x6c,0x69,0x3e,0x20,0x3c,0x2f,0x72,0x64,0x66,0x3a,0x41,0x6c,0x74,0x3e,0x20,0x3c,0x2f,0x64,0x63,0x3a,0x74,0x69,0x74,0x6c,0x65,0x3e,0x20,0x3c,0x78,0x6d,0x70,0x4d,0x4d,0x3a,0x48,0x69,0x73,0x74,0x6f,0x72,0x79,0x3e,0x20,0x3c,0x72,0x64,0x66,0x3a,0x53,0x65,0x71,0x3e,0x20,0x3c,0x72,0x64,0x66,0x3a,0x6c,0x69,0x20,0x73,0x74,0x45,0x76,0x74,0x3a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x64,0x22,0x20,0x73,0x74,0x45,0x76,0x74,0x3a,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x41,0x67,0x65,0x6e,0x74,0x3d,0x22,0x41,0x66,0x66,0x69,0x6e,0x69,0x74,0x79,0x20,0x50,0x68,0x6f,0x74,0x6f,0x20,0x31,0x2e,0x31,0x30,0x2e,0x35,0x22,0x20,0x73,0x74,0x45,0x76,0x74,0x3a,0x77,0x68,0x65,0x6e,0x3d,0x22,0x32,0x30,0x32,0x32,0x2d,0x30,0x37,0x2d,0x31,0x36,0x54,0x31,0x30,0x3a,0x32,0x37,0x3a,0x33,0x32,0x2d,0x30,0x37,0x3a,0x30,0x30,0x22,0x2f,0x3e,0x20,0x3c,0x2f,0x72,0x64,0x66,0x3a,0x53,0x65,0x71,0x3e,0x20,0x3c,0x2f,0x78,0x6d,0x70,0x4d,0x4d,0x3a,0x48,0x69,0x73,0x74,0x6f,0x72,0x79,0x3e,0x20,0x3c,0x2f,0x72,0x64,0x66,0x3a,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x20,0x3c,0x2f,0x72,0x64,0x66,0x3a,0x52,0x44,0x46,0x3e,0x20,0x3c,0x2f,0x78,0x3a,0x78,0x6d,0x70,0x6d,0x65,0x74,0x61,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x3f,0x78,0x70,0x61,0x63,0x6b,0x65,0x74,0x20,0x65,0x6e,0x64,0x3d,0x22,0x77,0x22,0x3f,0x3e,0xff,0xed,0x00,0x54,0x50,0x68,0x6f,0x74,0x6f,0x73,0x68,0x6f,0x70,0x20,0x33,0x2e,0x30,0x00,0x38,0x42,0x49,0x4d,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x1c,0x1c,0x01,0x5a,0x00,0x03,0x1b,0x25,0x47,0x1c,0x02,0x00,0x00,0x02,0x00,0x04,0x1c,0x02,0x05,0x00,0x08,0x76,0x69,0x67,0x6e,0x65,0x74,0x74,0x65,0x38,0x42,0x49,0x4d,0x04,0x25,0x00,0x00,0x00,0x00,0x00,0x10,0x7e,0xc6,0x70,0x2c,0xe6,0x25,0x8c,0xbe,0x69,0x27,0x2f,0xaa,0xc6,0xca,0x76,0x1e,0xff,0xe2,0x02,0x64,0x49,0x43,0x43,0x5f,0x50,0x52,0x4f,0x46,0x49,0x4c,0x45,0x00,0x01,0x01,0x00,0x00,0x02,0x54,0x6c,0x63,0x6d,0x73,0x04,0x30,0x00,0x00,0x6d,0x6e,0x74,0x72,0x52,0x47,0x42,0x20,0x58,0x59,0x5a,0x20,0x07,0xe6,0x00,0x07,0x00,0x10,0x00,0x11,0x00,0x14,0x00,0x08,0x61,0x63,0x73,0x70,0x41,0x50,0x50,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xd6,0x00,0x01,0x00,0x00,0x00,0x00,0xd3,0x2d,0x6c,0x63,0x6d,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x64,0x65,0x73,0x63,0x00,0x00,0x01,0x08,0x00,0x00,0x00,0x3e,0x63,0x70,0x72,0x74,0x00,0x00,0x01,0x48,0x00,0x00,0x00,0x4c,0x77,0x74,0x70,0x74,0x00,0x00,0x01,0x94,0x00,0x00,0x00,0x14,0x63,0x68,0x61,0x64,0x00,0x00,0x01,0xa8,0x00,0x00,0x00,0x2c,0x72,0x58,0x59,0x5a,0x00,0x00,0x01,0xd4,0x00,0x00,0x00,0x14,0x62,0x58,0x59,0x5a,0x00,0x00,0x01,0xe8,0x00,0x00,0x00,0x14,0x67,0x58,0x59,0x5a,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x14,0x72,0x54,0x52,0x43,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x20,0x67,0x54,0x52,0x43,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x20,0x62,0x54,0x52,0x43,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x20,0x63,0x68,0x72,0x6d,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x24,0x6d,0x6c,0x75,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x65,0x6e,0x55,0x53,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x1c,0x00,0x73,0x00,0x52,0x00,0x47,0x00,0x42,0x00,0x20,0x00,0x49,0x00,0x45,0x00,0x43,0x00,0x36,0x00,0x31,0x00,0x39,0x00,0x36,0x00,0x36,0x00,0x2d,0x00,0x32,0x00,0x2e,0x00,0x31,0x00,0x00,0x6d,0x6c,0x75,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x65,0x6e,0x55,0x53,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x1c,0x00,0x4e,0x00,0x6f,0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x2c,0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x20,0x00,0x66,0x00,0x72,0x00,0x65,0x00,0x65,0x00,0x6c,0x00,0x79,0x58,0x59,0x5a,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xd6,0x00,0x01,0x00,0x00,0x00,0x00,0xd3,0x2d,0x73,0x66,0x33,0x32,0x00,0x00,0x00,0x00,0x00,0x01,0x0c,0x42,0x00,0x00,0x05,0xde,0xff,0xff,0xf3,0x25,0x00,0x00,0x07,0x93,0x00,0x00,0xfd,0x90,0xff,0xff,0xfb,0xa1,0xff,0xff,0xfd,0xa2,0x00,0x00,0x03,0xdc,0x00,0x00,0xc0,0x6e,0x58,0x59,0x5a,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xa0,0x00,0x00,0x38,0xf5,0x00,0x00,0x03,0x90,0x58,0x59,0x5a,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9f,0x00,0x00,0x0f,0x84,0x00,0x00,0xb6,0xc3,0x58,0x59,0x5a,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x97,0x00,0x00,0xb7,0x87,0x00,0x00,0x18,0xd9,0x70,0x61,0x72,0x61,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x66,0x66,0x00,0x00,0xf2,0xa7,0x00,0x00,0x0d,0x59,0x00,0x00,0x13,0xd0,0x00,0x00,0x0a,0x5b,0x63,0x68,0x72,0x6d,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0xa3,0xd7,0x00,0x00,0x54,0x7b,0x00,0x00,0x4c,0xcd,0x00,0x00,0x99,0x9a,0x00,0x00,0x26,0x66,0x00,0x00,0x0f,0x5c,0xff,0xdb,0x00,0x43,0x00,0x10,0x0b,0x0c,0x0e,0x0c,0x0a,0x10,0x0e,0x0d,0x0e,0x12,0x11,0x10,0x13,0x18,0x28,0x1a,0x18,0x16,0x16,0x18,0x31,0x23,0x25,0x1d,0x28,0x3a,0x33,0x3d,0x3c,0x39,0x33,0x38,0x37,0x40,0x48,0x5c,0x4e,0x40,0x44,0x57,0x45,0x37,0x38,0x50,0x6d,0x51,0x57,0x5f,0x62,0x67,0x68,0x67,0x3e,0x4d,0x71,0x79,0x70,0x64,0x78,0x5c,0x65,0x67,0x63,0xff,0xdb,0x00,0x43,0x01,0x11,0x12,0x12,0x18,0x15,0x18,0x2f,0x1a,0x1a,0x2f,0x63,0x42,0x38,0x42,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0xff,0xc0,0x00,0x11,0x08,0x03,0x84,0x05,0xa0,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,0x01,0xff,0xc4,0x00,0x17,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x04,0xff,0xc4,0x00,0x23,0x10,0x01,0x00,0x02,0x02,0x03,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x41,0x11,0x31,0x21,0x61,0x71,0x81,0x51,0xb1,0xa1,0x91,0xc1,0xd1,0x42,0xff,0xc4,0x00,0x14,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xc4,0x00,0x14,0x11,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xda,0x00,0x0c,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,0x3f,0x00,0xef,0x00,0x14,0x00,0x00,0x00,0x20,0x00,0x36,0xa0,0x48,0x00,0x00,0x02,0xa2,0x81,0xa0,0x00,0x05,0xd0,0x22,0x86,0x80,0x14,0x01,0x14,0x00,0xca,0x80,0x00,0x00,0x28,0x00,0xa0,0x8a,0x8a,0x04,0x78,0x00,0x0a,0x00,0x02,0x80,0x1a,0x24,0x00,0x50,0x4c,0x0a,0x00,0x58,0x00,0x28,0x00,0x00,0x60,0x50,0x00,0x00,0x30,0x28,0x21,0xb0,0xc4,0x64,0x14,0x34,0x02,0x28,0x6e,0x40,0x24,0x00,0x00,0x0f,0x57,0x06,0x00,0x11,0x70,0x02,0x5a,0x80,0x18,0x02,0x80,0x45,0xc7,0x06,0x00,0x00,0x00,0x00,0x09,0x24,0x00,0x00,0x30,0x00,0x02,0xea,0x81,0x05,0xed,0x00,0x00,0x0c,0x87,0x00,0x00,0x60,0x00,0x24,0x0f,0xe0,0x7a,0x00,0x6c,0x00,0x02,0x81,0x14,0x01,0x3c,0x15,0x00,0x36,0x00,0x22,0x9c,0x82,0x60,0x50,0x10,0x5c,0x00,0x86,0x03,0x00,0x50,0x50,0x08,0x49,0x80,0x03,0x06,0x39,0x01,0x05,0x80,0x10,0x0f,0xa0,0x24,0x2d,0x80,0x82,0xca,0x02,0x28,0x4c,0x02,0x0a,0x92,0x02,0x28,0x09,0x8e,0x45,0x40,0x11,0x40,0x41,0x65,0x01,0x05,0x01,0x3e,0x9a,0x00,0x41,0x40,0x40,0xff,0x00,0x40,0x40,0xc0,0x02,0x2d,0x80,0x9f,0x82,0xa4,0x80,0x00,0x20,0xa8,0x00,0x58,0x00,0x00,0x82,0x80,0x80,0x00,0x12,0x00,0x81,0x80,0x00,0x01,0x50,0x01,0x40,0x00,0x00,0x14,0x04,0x5f,0xa0,0x00,0x00,0x0a,0x00,0x00,0x10,0x0a,0x00,0x00,0x2a,0x5a,0x80,0x10,0x00,0x28,0x00,0x78,0x02,0x84,0x00,0x06,0xd4,0x00,0x00,0x14,0x00,0x28,0x00,0x58,0x00,0x05,0xa0,0x41,0x40,0x01,0x41,0x14,0x3a,0x04,0x50,0x01,0x51,0x40,0x08,0x00,0x0c,0x70,0xb2,0x08,0x0a,0x08,0xa1,0x1c,0xfa,0x01,0x67,0x4a,0x08,0x00,0x28,0x8a,0x09,0x2a,0x00,0x68,0xf8,0x00,0x01,0xd0,0x02,0xc8,0x09,0x81,0x53,0xc0,0x0e,0x15,0x00,0x50,0x00,0x00,0x43,0xc0,0x00,0x50,0x11,0x40,0x04,0x50,0x04,0x5b,0x01,0x05,0x01,0x05,0x3f,0xd0,0x45,0x00,0x41,0x62,0x00,0x00,0xb0,0x32,0x82,0x82,0x02,0x82,0x18,0x54,0x00,0x0c,0x00,0x05,0x00,0x1a,0x00,0x45,0x01,0x05,0x3f,0x80,0x82,0xa0,0x10,0x00,0x09,0x85,0xb4,0x00,0xc1,0x92,0x80,0x4a,0x50,0x04,0x52,0xc1,0x38,0x0c,0x00,0x22,0x92,0x08,0x68,0x01,0x05,0xa0,0x12,0xc5,0xc2,0x58,0x08,0xa0,0x20,0x00,0x96,0x28,0x08,0x8a,0x68,0x10,0x54,0xc4,0x80,0x8a,0x02,0x0a,0x92,0x02,0x2c,0x80,0x81,0x80,0x04,0x52,0xc1,0x12,0x97,0x00,0x20,0xa8,0x02,0x28,0x04,0xa2,0xa0,0x00,0x02,0x2e,0x11,0x41,0x05,0x40,0x00,0x00,0x00,0x11,0x40,0x48,0x50,0x00,0x80,0x00,0x00,0x15,0x14,0x00,0x00,0x15,0x01,0x76,0x40,0x00,0x28,0x00,0x00,0x0b,0xe1,0x60,0x00,0x02,0x80,0x1b,0x0a,0x50,0x45,0x00,0x3a,0x16,0x34,0x01,0x80,0x20,0x05,0x08,0xd8,0x00,0xa0,0x18,0xc0,0x00,0x40,0xa0,0x00,0x02,0xc2,0x28,0x00,0x00,0x47,0x02,0xd0,0x05,0x80,0x06,0x14,0x04,0x14,0x00,0x3d,0x00,0x39,0x0a,0x00,0x50,0x11,0x40,0x00,0x00,0x0d,0x00,0x18,0x50,0x10,0x54,0xc0,0x2a,0x28,0x06,0x00,0x03,0x64,0x80,0x00,0x00,0x58,0x01,0x10,0x00,0x19,0x00,0x00,0x00,0x02,0xc0,0x00,0x00,0x00,0x0d,0x80,0x14,0x72,0x00,0x07,0xa0,0x12,0x00,0x00,0x05,0xe0,0xf8,0x16,0x00,0x00,0x04,0x00,0x65,0x17,0xa0,0x10,0x50,0x10,0x2c,0x90,0x05,0xca,0x00,0x00,0x22,0x86,0xe8,0x0e,0x11,0x40,0x42,0x57,0xc4,0xb0,0x25,0x1a,0x40,0x41,0x76,0x02,0x00,0x02,0x28,0x08,0x2d,0xa0,0x00,0x02,0x0a,0x80,0x01,0x80,0x41,0x40,0x40,0x01,0x05,0xb4,0x01,0x25,0x40,0x41,0x70,0x80,0x22,0xa4,0x80,0x48,0x02,0x49,0x21,0x80,0x41,0x50,0x00,0x30,0x02,0x2a,0x01,0x20,0x02,0x0a,0x80,0x01,0x20,0x80,0xa0,0x80,0x02,0x0a,0x02,0x00,0x00,0x00,0x02,0x02,0x80,0x00,0x00,0x28,0x00,0x00,0x00,0xa0,0x00,0x00,0xa0,0x00,0x00,0xb0,0x00,0x00,0x02,0x80,0x00,0xa0,0x00,0x00,0xa0,0x18,0x00,0x05,0x00,0x01,0x40,0xe8,0x30,0x02,0x99,0xc9,0x80,0x0f,0x80,0x02,0xa0,0xa0,0x12,0x40,0x02,0xd8,0x01,0x80,0x85,0x00,0x3c,0x28,0x0c,0x00,0x00,0x69,0x72,0x08,0x7a,0xa0,0x00,0x00,0x00,0x00,0x00,0x29,0x8e,0x39,0x02,0x88,0x30,0x02,0x28,0x00,0x00,0x1d,0x87,0x80,0x04,0x80,0x01,0x8e,0xc0,0x00,0x00,0x00,0x05,0xc0,0x09,0xd0,0x00,0x04,0x28,0x21,0x3d,0xa8,0x09,0x0a,0x51,0x3b,0x04,0x24,0x50,0x0c,0x08,0x0b,0x8f,0xd0,0x40,0x38,0x15,0x00,0x14,0x04,0x00,0x01,0x78,0x40,0x03,0xc0,0x00,0x00,0xd8,0x00,0x18,0x0c,0x00,0x60,0xb0,0x11,0x75,0x01,0x80,0x49,0x50,0x04,0x15,0x00,0x00,0x00,0x00,0xb0,0x01,0x24,0x54,0x00,0xc0,0x01,0x68,0xb8,0xca,0x00,0x00,0x21,0x85,0x28,0x10,0x00,0x11,0x70,0x76,0x08,0x2a,0x48,0x08,0xb4,0x93,0xc8,0x01,0x3e,0x00,0x82,0x80,0x96,0x00,0x20,0xa8,0x02,0x2a,0x00,0x07,0x20,0x82,0xa6,0x80,0x45,0x40,0x00,0x00,0x00,0x40,0x01,0x05,0xfd,0x40,0x09,0x00,0x30,0x8a,0x80,0x00,0x02,0x28,0x08,0x00,0x01,0x60,0x07,0xc0,0x02,0x48,0x85,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x50,0x8d,0x80,0x0a,0x00,0x00,0x14,0xa6,0x00,0x28,0x14,0x11,0x48,0x00,0x58,0x20,0x00,0x14,0x00,0x00,0xc2,0x84,0x00,0x0a,0x08,0xa7,0x65,0x80,0x28,0x01,0x40,0x06,0x14,0xe8,0xd8,0x00,0x01,0xc8,0xb6,0x7a,0x01,0x8e,0x40,0x00,0x50,0x0d,0x22,0xe0,0x11,0x40,0x00,0x00,0xc2,0xa2,0x80,0x8b,0x80,0x0a,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x18,0x14,0x11,0x50,0x05,0x94,0x81,0x68,0x12,0x95,0x00,0x54,0xe9,0x4b,0x04,0x9f,0xc0,0x50,0x13,0x0a,0x00,0x82,0x80,0x81,0xe0,0x02,0x80,0x8a,0x8a,0x08,0x0a,0x08,0x2a,0x68,0x16,0x93,0x6b,0x90,0x11,0x51,0x40,0x0b,0x00,0x40,0x01,0x44,0x05,0x3e,0x18,0x01,0x21,0x6d,0x00,0x34,0x60,0x00,0x3f,0x15,0x28,0x0a,0x0c,0x00,0x00,0x00,0x00,0x61,0x14,0x02,0x80,0x01,0x15,0x00,0xa1,0x50,0x02,0x60,0x00,0x04,0xf0,0x00,0x90,0x09,0x00,0x10,0x54,0x00,0x2c,0x04,0x17,0x19,0x40,0x00,0x03,0xe2,0x28,0x09,0x60,0x02,0x0a,0x80,0x96,0x65,0x40,0x65,0x40,0x10,0x0e,0xc0,0x45,0x01,0x05,0x40,0x42,0x55,0x00,0x45,0x01,0x09,0x00,0x41,0x40,0x4b,0x09,0x01,0x34,0x2a,0x00,0x07,0x80,0x81,0x24,0xf2,0x00,0x00,0x8a,0x00,0x80,0x00,0x0a,0x08,0xa5,0x00,0x00,0x02,0x80,0x00,0xb6,0x08,0xa6,0xc0,0x16,0xd1,0x40,0x05,0x04,0x50,0x80,0x15,0x14,0x00,0xc0,0x02,0x80,0x02,0xd0,0x00,0x00,0x2a,0x28,0x1a,0x5c,0x61,0x30,0xbd,0x82,0x42,0x87,0xa0,0x2a,0x28,0x05,0x80,0x16,0xa6,0x00,0x02,0xd6,0x00,0x45,0x00,0xb0,0x50,0x42,0x96,0x4b,0x00,0x00,0x00,0xa0,0x05,0xd7,0x80,0x00,0x00,0x50,0x01,0x40,0x00,0x00,0x00,0xb9,0x04,0x91,0x40,0x11,0x79,0x00,0x00,0x0d,0x89,0xc1,0x18,0x00,0x53,0x90,0x42,0xc0,0x0d,0xaa,0x4a,0x82,0x28,0x02,0x0a,0x9b,0x05,0xd0,0x80,0x2f,0x08,0xb0,0x94,0x00,0xbf,0xe2,0x02,0x81,0xa0,0x45,0x10,0x05,0x10,0x0b,0x15,0x01,0x50,0x2c,0x05,0x00,0x00,0x04,0x17,0xb4,0x01,0x49,0x40,0x51,0x37,0xd2,0x80,0x1b,0x01,0x05,0x4c,0x00,0xa2,0x02,0xa6,0x15,0x00,0x03,0x1c,0x00,0x6c,0x00,0x9d,0x87,0x80,0x00,0x02,0x5a,0x87,0xc0,0x40,0x00,0x23,0x40,0x00,0x00,0x86,0x14,0x04,0x80,0xe0,0x04,0xc0,0xa4,0x82,0x49,0x80,0x04,0x36,0xa0,0x20,0x48,0x02,0x28,0x08,0x05,0x82,0x0b,0xd8,0x08,0x00,0x21,0x80,0x04,0xc0,0xb8,0x40,0x11,0x40,0x40,0x01,0x05,0x40,0x11,0x40,0x40,0x00,0x9f,0xd4,0x54,0x01,0x14,0x04,0xec,0x54,0x00,0x00,0x4a,0x00,0x00,0x00,0x45,0x40,0x50,0x00,0x02,0xc0,0x50,0x00,0x00,0x50,0x80,0x00,0x80,0x14,0x00,0x14,0xfa,0x01,0x06,0x15,0x00,0x50,0x03,0xea,0x80,0x00,0xa0,0x78,0x10,0xbd,0x82,0x28,0x00,0x06,0xc1,0x4a,0x00,0x16,0x00,0x00,0x2c,0x14,0x30,0x01,0xb5,0x40,0x16,0x00,0x00,0x14,0x04,0xf1,0x40,0x00,0xc0,0x1d,0x00,0x01,0xb9,0x53,0xf0,0x00,0x00,0x0a,0x00,0x00,0x01,0x78,0x40,0x15,0x00,0x54,0x3f,0x54,0x01,0x16,0x80,0x45,0x00,0x11,0x41,0x16,0x10,0x01,0x40,0x01,0x21,0x40,0x41,0x40,0x00,0x04,0xd9,0xd2,0x80,0x14,0x6c,0x10,0x16,0xc0,0x2d,0x14,0x10,0xc2,0xa0,0x10,0x2d,0x80,0x85,0x00,0x00,0x00,0x0a,0x08,0xb8,0x4e,0x54,0x11,0x40,0x11,0x51,0x41,0x15,0x2c,0x02,0xd4,0xda,0x02,0x88,0x00,0x14,0xa0,0x08,0x68,0x17,0xe2,0x28,0x02,0x0a,0x09,0x46,0x85,0x04,0x00,0x00,0x00,0x00,0x00,0x80,0x10,0x5f,0x00,0x42,0x7b,0x00,0x00,0x04,0x15,0x31,0xd0,0x06,0x40,0x04,0x50,0x12,0x40,0x90,0x11,0x40,0x43,0xd5,0x40,0x11,0x40,0x40,0x24,0x12,0x74,0x2a,0x01,0xf5,0x14,0x04,0x00,0x10,0x54,0x01,0x14,0x90,0x40,0x01,0x05,0x40,0x11,0x40,0x44,0x50,0x10,0x54,0x02,0x42,0x40,0x40,0x01,0x05,0x90,0x10,0x54,0x00,0x00,0x00,0x02,0x88,0x14,0x00,0x00,0x54,0x50,0x00,0x05,0x03,0x90,0x3e,0xaa,0x28,0x00,0x01,0x4a,0x10,0x02,0x80,0x10,0x0a,0x05,0x10,0x00,0x28,0x00,0xbb,0xd2,0x69,0x40,0x80,0x20,0x05,0xf4,0x00,0x20,0x58,0x00,0x08,0x00,0x17,0xf8,0x00,0x10,0x07,0xc1,0x6c,0x00,0x00,0x20,0x00,0x29,0x50,0x01,0x48,0x00,0x00,0x00,0x00,0x0f,0x8a,0x02,0x50,0xa0,0x20,0x00,0x29,0x40,0x9b,0x51,0x01,0x43,0x60,0x14,0x81,0x20,0xa2,0x28,0x22,0x88,0x0a,0x82,0x82,0x7f,0x85,0xa8,0x08,0xa8,0x00,0xa8,0x02,0x9c,0xa0,0x0a,0x8a,0x02,0x2a,0x00,0x29,0x84,0x05,0xe1,0x29,0x50,0x03,0x42,0x81,0x68,0x5a,0x80,0x80,0x00,0x28,0x20,0x2e,0x80,0x00,0x04,0x00,0x15,0x14,0x04,0xa5,0x4d,0x81,0xea,0x80,0x06,0x90,0x00,0x2c,0x00,0x25,0x40,0xf0,0x4c,0x80,0xbf,0xb2,0x82,0x82,0x2a,0x28,0x00,0x02,0x01,0x80,0x02,0xb2,0x58,0x00,0x01,0x84,0x50,0x12,0x85,0x01,0x00,0x00,0x00,0x36,0x8a,0x02,0x05,0x99,0x03,0xfe,0xa0,0x01,0x20,0x00,0x8a,0x9b,0x04,0x2d,0x40,0x40,0x00,0xda,0x05,0x80,0x00,0x20,0x50,0x09,0x80,0x01,0x00,0x01,0x2d,0x40,0x42,0x80,0x00,0x01,0x00,0x04,0x00,0x04,0x50,0x10,0x00,0x11,0x76,0x80,0x00,0x00,0x68,0x05,0x08,0x00,0x54,0x50,0x00,0x01,0x40,0x00,0x50,0x01,0x41,0x16,0x12,0x94,0x00,0x50,0x01,0x40,0x02,0x00,0x14,0x02,0x00,0x05,0x8f,0xd2,0xc0,0x14,0x45,0x00,0x30,0x02,0x80,0x04,0x7e,0x1f,0x8a,0x01,0x40,0x00,0x28,0x06,0xcf,0x0e,0x80,0x00,0x05,0x41,0x40,0x00,0x00,0xa0,0x00,0x00,0x14,0x04,0x15,0x00,0x02,0xc0,0x05,0xb0,0x10,0x50,0x01,0x00,0x54,0x50,0x04,0x01,0x7c,0x0f,0x50,0x15,0x15,0x00,0x15,0x39,0x02,0xd4,0x40,0x54,0x50,0x11,0x67,0x82,0xc8,0x04,0x15,0x00,0x15,0x00,0x5f,0x10,0x05,0x0e,0xd2,0x41,0x4f,0xa9,0x6a,0x02,0x0b,0xc8,0x02,0x28,0x02,0x28,0x08,0x00,0xa8,0xa8,0x0a,0x8a,0x00,0x86,0xd4,0x10,0x50,0x10,0xff,0x00,0x8a,0x9b,0x80,0x54,0x52,0xc0,0x45,0xfd,0x24,0x12,0x14,0x00,0xc0,0x80,0x0b,0x42,0x00,0x14,0x02,0xa7,0x6a,0x80,0xa8,0xa8,0x00,0xa0,0x20,0xa9,0xcf,0xd0,0x02,0x80,0x00,0x02,0xd3,0x0b,0x80,0x00,0xc2,0x01,0x24,0x96,0x00,0x8a,0x56,0x80,0x45,0x40,0x0d,0x1f,0xd0,0x04,0x54,0x03,0x80,0x01,0x24,0x00,0x41,0x40,0x40,0xa0,0x10,0x54,0x01,0x15,0x00,0xc0,0x00,0x82,0xa0,0x18,0x45,0x01,0x00,0x04,0x00,0x10,0x16,0x41,0x11,0x40,0x4c,0x00,0x09,0xa0,0x50,0x44,0x50,0x10,0x54,0xb0,0x51,0x14,0x00,0x50,0x45,0x00,0x01,0x60,0x00,0x20,0x14,0x00,0x21,0x40,0x00,0x50,0x02,0x00,0x14,0x30,0x00,0xa0,0x00,0xa0,0x10,0x00,0xa0,0x00,0x16,0x02,0x98,0x3a,0x00,0x17,0x20,0x00,0x01,0xd8,0x2f,0xf4,0x12,0x14,0x3c,0x03,0x00,0x02,0xa0,0xa0,0x00,0x00,0x00,0x15,0xb0,0x00,0x0a,0x00,0x25,0x40,0x00,0x11,0x68,0x49,0x00,0x54,0x00,0x50,0x0f,0x50,0x00,0x54,0x50,0x41,0x50,0x15,0x15,0x00,0x00,0x01,0x40,0x41,0x50,0x09,0x37,0x4a,0x00,0x00,0x1e,0x82,0x00,0xa2,0x00,0x2a,0x50,0x2a,0x00,0x2a,0x00,0x28,0x94,0x68,0x09,0x54,0xa0,0x16,0x0a,0x0f,0x01,0x17,0x60,0x00,0x50,0x09,0xfe,0x87,0x00,0x00,0xa0,0x82,0x80,0x50,0x8a,0x02,0x5a,0xfd,0x01,0x0c,0x2a,0x02,0xe1,0x05,0x04,0x05,0x04,0x17,0x28,0x07,0x2a,0x94,0xb4,0x08,0xa2,0x01,0x40,0x58,0x0a,0x20,0x2a,0x2d,0xa0,0x29,0x22,0x00,0x2a,0x01,0x40,0x01,0x27,0x00,0x02,0x28,0x02,0x42,0xa0,0x18,0x2c,0x01,0x05,0x90,0x10,0x00,0x11,0x40,0x43,0x44,0xc0,0x08,0x00,0x12,0x92,0xb8,0x01,0x11,0x4f,0xd0,0x4a,0x15,0x36,0x02,0x4a,0x80,0x92,0x8b,0x25,0x02,0x16,0x00,0x82,0xa0,0x08,0xa0,0x20,0x00,0x80,0x00,0x8a,0x80,0x00,0x08,0x00,0x08,0xa0,0x00,0x50,0x0a,0x00,0x50,0x28,0x01,0x06,0x00,0x5d,0x80,0x01,0x0a,0x00,0x00,0x2c,0x10,0x00,0xa8,0xa0,0x18,0x14,0x08,0x00,0x05,0x00,0x16,0x79,0x45,0x00,0x3d,0x01,0x40,0x02,0x15,0x17,0x90,0x20,0xff,0x00,0x00,0x08,0x51,0x20,0x14,0x3e,0x00,0x2a,0x28,0x08,0xbf,0x00,0x00,0x00,0xe7,0x21,0x60,0x10,0xa8,0x04,0x72,0xa8,0xa0,0x80,0x00,0xb4,0x8a,0x08,0xa8,0xa0,0x27,0x8a,0x02,0x2a,0x00,0x52,0x88,0x00,0xa8,0x0a,0x9b,0x14,0x11,0x7d,0x48,0x01,0x70,0x22,0x82,0x02,0x80,0x08,0x00,0x69,0x41,0x00,0x01,0x4c,0x80,0x08,0x00,0xa8,0xa0,0x22,0xd9,0x40,0x8a,0x8a,0x08,0xa8,0x02,0xc6,0x84,0x00,0x15,0x28,0x15,0x05,0x01,0x28,0x50,0x3d,0x45,0xed,0x38,0x05,0x00,0x04,0x50,0x0a,0x45,0x40,0x50,0x01,0x05,0x40,0x14,0x40,0x36,0xa8,0x00,0x2f,0xd4,0x05,0xe3,0x28,0x76,0x00,0x00,0x1e,0xe9,0x53,0x0a,0x07,0xa0,0x02,0x2a,0x28,0x20,0x28,0x09,0xfe,0x86,0xa4,0x14,0x45,0x04,0x39,0x54,0xa0,0x00,0x00,0x00,0x45,0x13,0x98,0x02,0x8c,0x00,0x00,0x00,0x92,0xa0,0x20,0xb6,0x80,0x22,0xa0,0x05,0x00,0x24,0x80,0x08,0x2a,0x00,0x8b,0xa0,0x13,0x68,0xa0,0x20,0xba,0x4a,0x01,0x14,0x04,0x45,0x01,0x31,0xc8,0xa8,0x08,0x2a,0x00,0x8a,0x48,0x20,0xa8,0x08,0x2a,0x00,0x8a,0x02,0x00,0x00,0x00,0xb0,0x00,0x0a,0x48,0x00,0x42,0x80,0x00,0x1a,0x50,0x01,0x68,0x00,0x80,0x01,0x40,0x01,0x74,0x40,0x00,0xa0,0x00,0xb0,0x00,0x00,0xa0,0x74,0x02,0xe9,0x14,0x00,0xcf,0x00,0x0a,0x8a,0x04,0x00,0x00,0x69,0x41,0x05,0x20,0x00,0xd8,0x00,0x00,0x0a,0x64,0x11,0x50,0xd0,0x28,0x8a,0x00,0x00,0x21,0x40,0x2a,0x2c,0xa6,0xc0,0x25,0x50,0x14,0x10,0x17,0x02,0x00,0x72,0xa9,0x85,0x00,0x45,0x01,0x05,0x01,0x00,0x05,0xd2,0x1a,0x05,0x00,0x04,0x50,0x10,0x14,0x00,0x38,0x04,0x00,0x05,0x10,0x17,0x16,0x00,0x22,0x89,0x60,0x76,0x7d,0x58,0x3e,0x82,0x2a,0x7f,0x14,0x10,0xe9,0x69,0x01,0x7e,0xa0,0xb4,0x08,0xa0,0x08,0x72,0x28,0x21,0xe0,0x48,0x2a,0x52,0x80,0x08,0xa0,0x86,0xc5,0x04,0x51,0x00,0x51,0x00,0x5c,0x21,0xa0,0x05,0x01,0x15,0x14,0x10,0xd2,0x80,0x00,0x08,0xa0,0x08,0x29,0x00,0x20,0xb6,0x00,0x80,0x00,0x01,0x4a,0x10,0x08,0x60,0x50,0x4f,0x00,0xf0,0x0c,0x80,0x02,0x2a,0x00,0x00,0x08,0xa0,0x21,0x22,0x82,0x48,0x00,0x92,0x18,0x50,0x44,0x5f,0xa0,0x20,0x00,0x82,0xa0,0x08,0xa7,0xc0,0x44,0x50,0x13,0x00,0x00,0x90,0xa8,0x08,0x28,0x0c,0xa8,0x02,0x1e,0x9e,0x20,0x12,0x2a,0x00,0x9f,0x55,0x00,0x00,0x10,0x54,0x01,0x40,0x00,0x01,0x40,0x01,0x40,0x05,0x45,0x00,0x14,0x00,0x80,0x14,0x00,0x15,0x17,0xf8,0x00,0x2c,0x00,0x7a,0x58,0x02,0x90,0x01,0x6a,0x10,0x00,0x40,0x0a,0x00,0x00,0xa0,0x40,0x68,0x01,0x51,0x41,0x15,0x30,0xb4,0x04,0x01,0x00,0x00,0x02,0x88,0x02,0xe9,0x0a,0x05,0x40,0x05,0xf5,0x3c,0x00,0x05,0x01,0x16,0x11,0x41,0x05,0xf5,0x00,0x5d,0xa2,0x80,0x08,0x02,0xa0,0x0a,0x58,0x01,0x41,0xa0,0x00,0x40,0x5e,0x49,0x4f,0x54,0x10,0x50,0x04,0x14,0x12,0x3b,0x29,0x40,0x28,0x40,0x00,0x80,0x05,0x36,0x9f,0xc0,0x15,0x32,0x02,0xa5,0x68,0x5e,0x81,0x05,0x00,0x11,0x40,0x11,0x7a,0x04,0x5f,0x11,0x76,0x08,0x00,0x0a,0x80,0x00,0xa0,0x82,0xa0,0x29,0x1c,0x12,0x00,0x22,0x82,0x2d,0x20,0x00,0x28,0x00,0x80,0xa9,0xfa,0x28,0x21,0x0a,0x48,0x20,0xa9,0x60,0x1a,0x50,0x0a,0x45,0x84,0x05,0x11,0x40,0x45,0x00,0x40,0x05,0xa0,0x00,0x32,0x80,0x28,0x00,0x82,0x80,0x21,0x95,0x04,0x00,0x02,0xc0,0x00,0xd8,0x02,0x00,0x04,0x80,0x22,0x88,0x00,0x65,0x3f,0xc0,0x30,0x00,0x08,0xa8,0x00,0x1b,0x04,0x00,0x13,0x02,0x80,0x80,0x02,0x22,0x80,0x92,0x00,0x20,0xa8,0x08,0x2e,0x13,0x60,0x78,0x8a,0x02,0x00,0x08,0x06,0x80,0x03,0x00,0x00,0x02,0x80,0x07,0x02,0x80,0x00,0x0b,0x20,0x02,0xa4,0x28,0x0b,0x69,0x6a,0x02,0xa5,0xa8,0x22,0x8b,0xb0,0x45,0x00,0x01,0x40,0x0a,0x23,0x40,0xb8,0x3e,0x80,0x10,0xa8,0xa0,0x46,0x80,0xb0,0x50,0x00,0xb3,0x72,0x00,0x29,0x47,0xfd,0x00,0xb0,0x03,0xb0,0x00,0xe9,0x50,0x05,0x45,0x4d,0x80,0xbf,0xe8,0x80,0x1e,0x00,0x02,0xc8,0x08,0xa9,0x00,0x28,0x00,0x08,0xb4,0x08,0x28,0x02,0x28,0x04,0x09,0xfd,0x5a,0x04,0x54,0x50,0x45,0x00,0x45,0x40,0x05,0x40,0x14,0x49,0x50,0x04,0x00,0x14,0x01,0x00,0x15,0x15,0x01,0x44,0x5a,0x04,0x15,0x01,0x51,0x4b,0x04,0x05,0x04,0x50,0x00,0x2d,0x00,0x38,0x0b,0x01,0x51,0x41,0x25,0x51,0x41,0x16,0x50,0x05,0x41,0x40,0x00,0x11,0x69,0x00,0x54,0x54,0xb0,0x16,0x0a,0x49,0x05,0x4e,0xc0,0x17,0x94,0x50,0x04,0x81,0x41,0x01,0x60,0x10,0xc0,0x00,0xa8,0xa0,0x22,0xa0,0x2a,0x00,0x29,0x28,0x00,0x58,0x00,0xa2,0x00,0xb6,0x80,0x0a,0x8b,0xb0,0x41,0x50,0x15,0x00,0x00,0x00,0x00,0x10,0x52,0x40,0xc7,0x29,0x41,0x80,0x11,0x4d,0x02,0x00,0x04,0xa2,0x80,0x80,0x02,0x00,0x02,0x2a,0x01,0xca,0x2f,0xc0,0x12,0x76,0x48,0x02,0x0a,0x80,0x22,0x92,0x08,0x8a,0x02,0x48,0x00,0x98,0x00,0x04,0x54,0x01,0x15,0x28,0x00,0x00,0x00,0x14,0xfe,0x80,0x0a,0x00,0x2a,0x28,0x0a,0x8a,0x01,0x00,0x02,0x80,0x0a,0x8a,0x00,0x28,0x0b,0x68,0xa0,0x06,0x80,0x15,0x14,0x03,0xfe,0x8a,0x00,0x40,0x01,0xb5,0x00,0x00,0x02,0xc0,0x14,0x00,0x2c,0x00,0x01,0x41,0x14,0x00,0xfa,0x96,0x00,0xba,0x10,0x05,0x45,0xc0,0x02,0x28,0x08,0x2c,0xed,0x01,0x53,0x6a,0x00,0x13,0x29,0xf4,0x16,0x84,0x01,0x44,0x50,0x11,0x40,0x43,0xc0,0x00,0x00,0x16,0x84,0x05,0x40,0x05,0x11,0x40,0x4e,0x95,0x00,0xa5,0x10,0x15,0x05,0xb0,0x4f,0xaa,0x8a,0x08,0x58,0x4f,0xe0,0x1a,0x0c,0xa8,0x16,0x27,0x20,0x0a,0x27,0x20,0x0a,0x80,0xa8,0xa8,0x0a,0x05,0x80,0x8a,0x80,0x2a,0x40,0x02,0xa0,0x00,0x16,0x00,0xa8,0x01,0xa0,0x05,0x2c,0x4f,0x01,0x52,0x80,0x01,0x4c,0x01,0xa4,0x3d,0x00,0x54,0x58,0x04,0x08,0x01,0x7d,0x10,0x05,0xf8,0x82,0x82,0x00,0x02,0xa2,0x82,0x28,0x02,0x02,0xfa,0x02,0x52,0x9e,0x02,0x28,0x80,0xa8,0x28,0x22,0xa2,0x80,0x25,0x99,0xe8,0x0a,0x03,0xb0,0x02,0x80,0x02,0xc0,0x45,0x91,0x00,0x24,0x36,0x04,0xfa,0x8a,0x80,0x4f,0x20,0x02,0x7d,0x16,0x53,0x88,0x00,0x00,0x4b,0x36,0x00,0x82,0xa0,0x20,0xbf,0x0b,0x04,0x45,0x01,0x00,0x90,0x40,0x28,0x10,0x54,0x01,0x15,0x00,0x02,0xc1,0x00,0x01,0x15,0x00,0x54,0xe9,0x40,0x54,0x50,0x0e,0x80,0x05,0x00,0x14,0xa2,0xc0,0x54,0x50,0x15,0x14,0x02,0x05,0x04,0x5b,0x00,0x15,0x14,0x05,0x4b,0x50,0x15,0x00,0x50,0xec,0x00,0x35,0x20,0x0a,0x00,0x6d,0x51,0x41,0x2c,0x50,0x00,0xc8,0x00,0x14,0x0b,0xb0,0x4c,0x01,0xda,0xa0,0x0b,0x68,0x28,0x13,0xd2,0x17,0xb0,0x17,0x84,0xa5,0x01,0x0b,0x54,0x01,0x44,0x8d,0x00,0x28,0x08,0xa2,0x00,0x29,0xe8,0x00,0x02,0x00,0x0b,0xb1,0x28,0xa0,0x54,0xd2,0xa7,0xc0,0x15,0x00,0x5e,0x00,0x00,0x0f,0x80,0x8a,0x94,0xa0,0x5a,0x2a,0x00,0xa8,0xa0,0x25,0xa8,0x08,0x1b,0xd8,0x02,0x80,0x22,0x80,0x25,0x2a,0x28,0x20,0xa8,0x0a,0x69,0x00,0x24,0x54,0x05,0xa2,0x90,0x00,0x54,0x00,0x5c,0x20,0x1f,0x15,0x0f,0x00,0x14,0x01,0x05,0x00,0x2d,0x00,0x27,0x4a,0x58,0x22,0xa2,0x80,0x26,0x40,0x0a,0x5a,0x4d,0x00,0xb4,0x90,0x58,0x2a,0x00,0x0a,0x20,0x05,0x2c,0x80,0x52,0x0a,0x00,0x20,0x2a,0x59,0x6a,0x00,0x8a,0x08,0x68,0x00,0x50,0x00,0x4b,0x50,0x45,0x34,0x80,0x2c,0x25,0x80,0x0b,0x68,0x00,0x1f,0x40,0x9d,0x22,0x80,0x65,0x15,0x00,0x3f,0xf4,0x3c,0xe4,0x04,0x16,0x74,0x08,0x00,0x20,0x00,0x22,0xa0,0x08,0xa8,0x02,0x2f,0xe0,0x08,0x2a,0x02,0x0a,0x80,0x6d,0x17,0x48,0x05,0xa2,0xf4,0x80,0x01,0x20,0x92,0x70,0x12,0x08,0x2a,0x00,0x8a,0x80,0x28,0x00,0xa8,0xa0,0x02,0x80,0x14,0x63,0x90,0x52,0x00,0x14,0x00,0x5a,0x11,0x40,0x54,0x50,0x0c,0x0a,0x04,0x02,0x82,0x2e,0x12,0xd6,0xc0,0x5c,0x22,0x81,0x00,0x02,0xa0,0xb0,0x00,0x4a,0x82,0x1f,0x15,0x01,0x42,0xc0,0x36,0x10,0x02,0xc0,0x00,0x72,0x99,0x0f,0xc0,0x05,0x40,0x05,0x00,0x10,0x05,0x10,0x03,0x02,0xa0,0x10,0x78,0x16,0x0a,0x80,0x02,0x88,0x00,0x42,0x80,0x9f,0xd1,0x40,0x04,0x05,0x0a,0x01,0x15,0x21,0x41,0x14,0x40,0x53,0x28,0xa0,0x8a,0x94,0xa0,0x50,0x80,0x2a,0x7a,0xa0,0x24,0x0a,0x80,0xa9,0x0b,0xe0,0x08,0x28,0x02,0x2d,0x24,0x81,0xa5,0x29,0x2c,0x14,0x49,0x59,0x04,0x85,0xf8,0x8a,0x09,0x60,0xb9,0x01,0x29,0x50,0x16,0x43,0x00,0x00,0x80,0xa8,0x28,0x22,0x80,0x00,0x00,0x82,0x80,0x25,0x00,0xa8,0xa8,0x0a,0x90,0x52,0xf1,0x90,0x4f,0xab,0xf0,0x2c,0x01,0x00,0x36,0xbe,0x08,0x06,0x15,0x00,0x50,0x00,0xb4,0x50,0x0f,0x12,0xd4,0x00,0x45,0x02,0x21,0x16,0x80,0x41,0x50,0x14,0xf4,0x01,0x03,0xb5,0x04,0x51,0x28,0x14,0x45,0x00,0x4a,0x00,0x36,0x00,0x00,0x00,0x7f,0x40,0x00,0x04,0xc0,0x48,0x02,0x2a,0x00,0x2a,0x00,0x9e,0xaa,0x00,0x00,0x20,0xbe,0x20,0x20,0xa8,0x02,0x2a,0x00,0x8a,0x80,0x5a,0x5a,0x80,0x85,0x2c,0xf2,0x80,0x96,0x2a,0x02,0x12,0xb6,0x80,0x61,0x15,0x00,0x45,0x90,0x08,0x00,0x14,0x00,0x5d,0x80,0x02,0x80,0x00,0xa0,0x02,0x80,0x00,0x1b,0x52,0x00,0x14,0x00,0x54,0x01,0x48,0x00,0x16,0x91,0x40,0xf4,0x34,0xa0,0x40,0x00,0x2a,0x52,0x82,0x46,0x94,0x00,0x00,0x00,0x50,0x32,0x81,0x20,0xa2,0x16,0x0a,0x08,0x00,0xa8,0x0b,0x94,0x0f,0xa0,0xa2,0x28,0x08,0xb8,0x4c,0x82,0xa2,0xe8,0x01,0x17,0xf4,0x00,0x00,0x28,0x00,0x45,0x3d,0x3c,0x04,0xc2,0xfd,0x00,0x11,0x40,0x21,0x00,0x05,0x10,0x02,0xc8,0x3c,0x01,0x44,0x05,0x40,0x00,0x5b,0x40,0x14,0x01,0x05,0x40,0x5f,0x11,0x65,0x00,0x59,0x45,0x01,0x15,0x3c,0x05,0x45,0x4b,0x05,0xa4,0x3d,0x00,0xa0,0x50,0x45,0x0f,0xf0,0x04,0x14,0x0a,0x3f,0xa7,0xd4,0x03,0xc5,0x45,0x04,0x14,0x04,0x3f,0x8a,0x80,0xa8,0x5a,0xec,0x13,0x20,0xa0,0x6d,0x16,0x50,0x14,0x21,0x00,0x51,0x01,0x43,0x5b,0x39,0xb0,0x04,0xd0,0x0a,0x8a,0x02,0x51,0x62,0x80,0x25,0xa8,0x09,0x60,0x0b,0x68,0xa0,0x25,0x19,0x14,0x00,0x00,0x45,0x40,0x2c,0x50,0x11,0x44,0x01,0x7d,0x34,0x02,0x02,0x80,0x8a,0x7f,0x41,0x00,0xec,0x00,0x00,0x3a,0x09,0x04,0x2c,0x00,0x00,0x10,0x50,0x11,0x15,0x00,0xe4,0x00,0x11,0x50,0x09,0x04,0x00,0x00,0x42,0x40,0x10,0x5d,0xa0,0x08,0xa9,0x20,0x85,0xaa,0x01,0x28,0xa8,0x00,0x00,0x87,0xf0,0x24,0x05,0x48,0x50,0x16,0x90,0x05,0x00,0x05,0x00,0x15,0x3f,0x17,0x90,0x15,0x23,0x85,0x01,0x51,0x7b,0xb0,0x00,0x05,0xb2,0xc0,0x14,0xf0,0xb0,0x00,0xd2,0xe0,0x00,0x20,0x05,0xd1,0x20,0x05,0x8a,0x08,0x6c,0x50,0x02,0xcf,0x80,0x14,0x00,0xa7,0x88,0xb2,0x09,0x6a,0x9b,0x50,0x01,0x01,0x52,0x09,0x00,0x0c,0x00,0x2a,0x28,0x02,0x12,0x0b,0x09,0x47,0xc5,0xd8,0x1c,0xa0,0x00,0x28,0x07,0xd0,0xa0,0x04,0x00,0x14,0x20,0x10,0x54,0x01,0x74,0x00,0x08,0x02,0xd8,0x26,0x01,0x50,0x80,0x05,0x45,0x04,0xd0,0x28,0x09,0x0a,0x00,0x7a,0x78,0x50,0x1f,0xfa,0x8a,0x00,0x8a,0x80,0xa6,0xc0,0x01,0x17,0x90,0x40,0x00,0x54,0x5e,0xc1,0x34,0xb6,0x8a,0x00,0x00,0x8a,0x20,0x19,0x15,0x01,0x40,0x90,0x45,0x08,0x02,0x51,0x50,0x15,0x17,0x48,0x0b,0x3b,0x23,0x42,0x00,0x00,0x02,0xc0,0x09,0xe2,0x90,0x58,0x00,0x00,0x09,0x00,0xbf,0xc4,0x50,0x0d,0x22,0x80,0x22,0xd0,0x02,0x28,0x02,0x0a,0x02,0x58,0x00,0xa8,0x00,0xa0,0x00,0x63,0x84,0x05,0x45,0x00,0xec,0x43,0x20,0x2c,0x09,0xa0,0x51,0x28,0x01,0x50,0x00,0xe4,0x00,0x03,0x00,0x8b,0x62,0x00,0x16,0x76,0x02,0x2a,0x00,0x2d,0x20,0x20,0x14,0x00,0x19,0x04,0x00,0x04,0x54,0x04,0x91,0x52,0x80,0x45,0x01,0x11,0x64,0x04,0x00,0x10,0x00,0x40,0x00,0xc2,0x2e,0x50,0x05,0x82,0x00,0x15,0x00,0x50,0x30,0x0a,0x0a,0x01,0x60,0x02,0xa2,0x82,0x85,0x80,0x72,0xa8,0xa0,0x1d,0x9f,0x0e,0x00,0x50,0xa0,0x52,0x00,0x00,0x50,0x20,0x0a,0x01,0x70,0x90,0xa0,0x04,0x6c,0x00,0xd0,0x00,0x10,0xa0,0x42,0x0a,0x07,0x84,0xa0,0x0a,0x22,0x82,0x2a,0x40,0x0a,0x9f,0xd0,0x05,0x41,0x41,0x05,0x40,0x15,0x00,0x05,0x00,0x45,0x01,0x05,0xf8,0x80,0x0a,0x00,0x8a,0x80,0xa6,0xd1,0x40,0x11,0x40,0x10,0x02,0x56,0x76,0x20,0x00,0x00,0x0a,0x08,0x00,0x28,0x67,0x20,0x25,0x02,0x80,0x8a,0x02,0x0b,0x20,0x27,0x00,0x48,0x28,0x20,0x29,0x48,0x68,0x16,0x84,0x2c,0x15,0x3c,0x00,0x05,0x00,0x45,0x00,0x45,0x01,0x14,0x01,0x0b,0x14,0x04,0xed,0x50,0x0b,0x15,0x01,0x44,0x5a,0x03,0x7b,0x40,0x05,0x45,0x00,0xb4,0x08,0x05,0x10,0x05,0xc2,0x2c,0xa0,0x0a,0x80,0x2f,0xa2,0x00,0x28,0x96,0x05,0x8a,0x80,0xa0,0x94,0x0a,0x5a,0x00,0x2c,0x08,0x02,0xf4,0x9b,0x50,0x4f,0xaa,0x00,0x20,0x74,0x02,0xc2,0x28,0x08,0xa0,0x10,0x09,0xe0,0x2f,0xfe,0x01,0x40,0x81,0x04,0x80,0x05,0x80,0x1a,0x49,0x03,0x62,0xa4,0x80,0x04,0x82,0x67,0x93,0xc3,0xf4,0x01,0x2d,0x70,0x80,0x06,0x38,0x01,0x05,0x40,0x41,0x68,0x04,0x90,0x40,0x03,0x08,0x00,0x00,0x92,0x2a,0x7d,0x04,0x15,0x01,0x05,0x4f,0x80,0x24,0xe9,0x40,0x00,0x01,0x51,0x40,0x54,0x50,0x23,0x85,0x45,0x03,0x85,0x45,0x00,0x00,0x50,0x01,0x48,0x45,0x03,0x4a,0x8b,0x00,0x2a,0x28,0x22,0x80,0x11,0xd0,0xa4,0x00,0x48,0x00,0x00,0x28,0x4e,0x80,0x0e,0xcf,0xc2,0x39,0x05,0x48,0x50,0x13,0x0a,0x8a,0x02,0x0a,0x02,0x2a,0x00,0xba,0x10,0x05,0x10,0x16,0x42,0x3a,0x01,0x00,0x01,0x64,0x90,0x10,0x00,0x51,0x0d,0x02,0xe0,0x21,0x01,0x44,0x3e,0x02,0x94,0x00,0x02,0x02,0xf4,0x00,0x19,0x04,0x05,0x8e,0x6d,0x3c,0x5b,0x3f,0xd0,0x08,0xe6,0x51,0x40,0x10,0xa0,0x54,0xb5,0xa4,0x05,0x41,0x40,0x45,0x00,0xb2,0x4d,0x4a,0x00,0x0a,0x09,0x40,0xa0,0x8b,0x28,0xb0,0x00,0x8a,0x08,0xa8,0x02,0x96,0x20,0x2a,0x12,0x00,0x28,0x02,0x52,0x80,0x8a,0x00,0x20,0xa0,0x9c,0x0a,0x9f,0x80,0x2c,0x00,0x22,0x80,0x20,0x00,0x00,0x0a,0x82,0xd0,0x22,0xed,0x36,0x00,0x2e,0x7b,0x01,0x2c,0x50,0x01,0x00,0x50,0x40,0x51,0x31,0x95,0xf0,0x04,0x00,0x5a,0xc0,0x9c,0x2e,0xc0,0x00,0x10,0x14,0x00,0x32,0x08,0x28,0x08,0xba,0x4a,0x50,0x45,0x10,0x15,0x14,0x04,0x14,0x01,0x25,0x40,0x40,0x9d,0x80,0x76,0x51,0xf4,0x8e,0xc1,0x15,0x00,0x03,0x00,0x13,0x94,0x5d,0x20,0x08,0xa0,0x09,0xfa,0x00,0x20,0x48,0x08,0xa8,0x01,0x20,0x09,0x20,0x00,0x96,0xa8,0x08,0x2a,0x00,0x8a,0x80,0x22,0xa0,0x00,0x7c,0x00,0x2c,0x05,0x0c,0x80,0x42,0x85,0x80,0xb0,0x98,0x50,0x0d,0x90,0xa0,0x2a,0x1e,0x82,0x81,0x00,0xa0,0x40,0x28,0x00,0x58,0x28,0x00,0x02,0xd0,0x10,0x01,0x02,0xe4,0x00,0xc8,0x08,0xa0,0x04,0x96,0x28,0x22,0x88,0x0a,0x72,0x96,0x02,0xa0,0xa0,0x8a,0x00,0x92,0xa1,0x40,0x02,0x02,0x82,0x50,0x2d,0x00,0x08,0xa6,0x80,0x41,0x61,0x00,0x14,0x04,0xc2,0x80,0x22,0x88,0x0a,0x8a,0x02,0x07,0xa6,0xc0,0x54,0x00,0x54,0x01,0x53,0x0a,0x96,0x02,0x88,0x04,0xaa,0x2d,0x82,0x2e,0x31,0x02,0x02,0xa0,0xa0,0x20,0x64,0x09,0x5d,0x22,0x82,0x70,0x2a,0x4f,0x00,0xa8,0xa0,0x22,0xda,0x00,0x28,0x00,0x92,0xa4,0x01,0x05,0x00,0x08,0xa8,0x0a,0x09,0x00,0x28,0x80,0xb6,0x80,0x0a,0x00,0x20,0x1f,0x40,0x54,0x00,0x54,0x50,0x11,0x4b,0x04,0x53,0x09,0x90,0x01,0x6c,0x11,0x7b,0x45,0x01,0x00,0x15,0x15,0x01,0x50,0x5a,0x04,0x14,0x01,0x16,0x10,0x15,0x14,0x01,0x00,0x16,0x34,0x08,0x0a,0x00,0x22,0x80,0x22,0xc2,0x28,0x02,0x28,0x06,0x50,0xff,0x00,0xc0,0x54,0x50,0x08,0x00,0x04,0x0c,0x80,0x07,0x80,0x00,0x08,0xa2,0x01,0x20,0x00,0x8a,0x80,0x04,0x93,0xa0,0x10,0x90,0x00,0x40,0x13,0x0a,0x02,0x78,0x2a,0x02,0x0a,0x80,0x22,0xa0,0x00,0x02,0x22,0x80,0x88,0xb4,0x02,0x00,0x01,0x00,0x0a,0x15,0xc8,0x0a,0x00,0x28,0x00,0xa1,0x00,0x0b,0x08,0xa0,0x2a,0x42,0x80,0x41,0xfd,0x01,0x60,0x00,0x51,0x29,0x40,0x05,0x00,0x45,0xd8,0x0a,0x8a,0x08,0xa0,0x00,0x00,0x68,0x36,0xa0,0x8a,0x85,0x02,0x88,0x00,0x28,0x02,0x18,0x50,0x10,0x50,0x10,0x01,0x44,0x01,0x44,0x50,0x09,0x10,0x15,0x38,0x54,0x05,0x41,0x67,0x90,0x10,0x50,0x04,0x50,0x41,0x70,0x02,0x1c,0x28,0x00,0x80,0x14,0x50,0xb9,0x01,0x00,0x14,0x4d,0x48,0x0a,0x8a,0x02,0x29,0x48,0x0b,0x80,0xa4,0x01,0x4e,0x50,0x00,0x5b,0x01,0x15,0x01,0x40,0x80,0x45,0x45,0x04,0x5a,0x4f,0x17,0x20,0x08,0x40,0x2d,0x96,0x9f,0x4a,0x05,0x45,0xe5,0x2c,0x05,0x4f,0x00,0x53,0x84,0x00,0x05,0x04,0x5a,0x40,0x01,0x50,0x01,0x40,0x41,0x50,0x14,0x32,0x40,0x20,0xa0,0x20,0xa0,0x08,0x14,0x01,0x65,0xae,0x41,0x38,0x54,0x24,0x0a,0x14,0xa0,0x45,0x3e,0x00,0x27,0x8a,0x80,0xa9,0x42,0x82,0x02,0x80,0x9a,0x50,0x04,0x50,0x04,0x54,0x05,0xd0,0x80,0x02,0xa0,0x1e,0xa8,0x01,0x62,0x12,0x0a,0x08,0x0a,0x9a,0x14,0x04,0xc0,0x00,0x00,0x1e,0x00,0x08,0x00,0x12,0x04,0x82,0x0a,0x80,0x02,0x01,0x60,0x02,0x50,0x78,0x02,0x0a,0x90,0x02,0x4a,0x80,0x88,0xa8,0x00,0x00,0x80,0x02,0x05,0x94,0x08,0x2a,0x00,0x0b,0xa0,0x01,0x41,0x21,0x42,0xc1,0x68,0xb4,0x50,0x14,0x30,0x0a,0x00,0x0a,0x8b,0x80,0x01,0x40,0x20,0x01,0x60,0x45,0x02,0x16,0x11,0x40,0x03,0xb0,0x15,0x0b,0x05,0x83,0x3c,0x70,0x00,0x68,0x0c,0x81,0x42,0xf8,0x02,0x16,0xa9,0x60,0xa2,0x28,0x20,0xba,0x00,0x04,0xb0,0x50,0x00,0x34,0x86,0x40,0x00,0x15,0x16,0x50,0x15,0x14,0x04,0x53,0x90,0x04,0x80,0xb0,0x50,0x00,0x10,0x80,0x05,0x00,0x00,0x10,0xfa,0xb6,0x80,0x0a,0x00,0x8b,0x09,0xb0,0x54,0xc2,0x80,0x82,0xa0,0x2a,0x00,0x2f,0xa9,0x42,0x82,0x14,0xa0,0x00,0x94,0x0a,0x08,0x00,0xbd,0x80,0x16,0x20,0x0a,0x8b,0x00,0x8a,0x20,0x28,0x80,0x28,0x8a,0x09,0x0a,0x00,0x82,0xa0,0x0a,0x00,0x8a,0x99,0x00,0x0f,0x80,0x0a,0x00,0x42,0x50,0xa0,0x9e,0x0a,0x7d,0x04,0x85,0xe5,0x14,0x11,0x50,0x05,0x2c,0x40,0x51,0x16,0x80,0x11,0x6c,0x04,0x50,0x10,0x50,0x10,0x36,0x74,0x0b,0x40,0x94,0x02,0xe9,0x14,0x12,0x95,0x00,0x54,0x14,0x04,0x50,0x11,0x40,0x00,0x00,0x45,0x40,0x51,0x00,0x5f,0xc1,0x14,0x04,0x50,0x10,0x54,0x00,0x00,0x0a,0x30,0x02,0x28,0x02,0x01,0x5c,0x82,0x01,0x20,0x51,0x61,0x60,0x98,0x09,0x01,0x20,0x54,0x90,0x30,0x96,0xa8,0x02,0x2f,0x08,0x00,0x24,0x80,0x8a,0x02,0x00,0x08,0x00,0x08,0xba,0x40,0x21,0x51,0x40,0x00,0x16,0xc0,0x05,0x20,0x01,0x4b,0x34,0x02,0x80,0x02,0xa2,0x82,0x88,0xa0,0x00,0x0b,0x61,0x00,0x0a,0x8b,0x00,0x60,0x34,0x02,0xa5,0x0b,0x60,0x00,0x00,0x00,0x1b,0x00,0x50,0xd0,0x00,0x90,0xa0,0x8a,0x20,0x29,0x08,0x00,0xbf,0x40,0x10,0xbc,0x42,0x80,0x80,0x6c,0x0d,0xc0,0xa0,0x22,0xa0,0x0a,0x8a,0x00,0x9d,0xaa,0x70,0x0a,0x80,0x0b,0xb3,0xc4,0x50,0x04,0x00,0x50,0x04,0x14,0x00,0x00,0x40,0x3c,0x05,0xf4,0x40,0x15,0x16,0x12,0x40,0x53,0xd0,0x04,0xc8,0xa0,0x22,0xda,0x70,0x0a,0x8a,0x00,0x22,0xe0,0x04,0xd4,0x8a,0x02,0x1d,0xa8,0x25,0x28,0x80,0x72,0x0a,0x00,0x94,0x02,0xa2,0xa5,0x80,0x00,0x28,0x8a,0x08,0xa1,0x40,0x80,0x02,0xa2,0xc9,0xa0,0x41,0x40,0x4a,0x59,0x4e,0x80,0x03,0x07,0xe0,0x0b,0x42,0x00,0xa6,0x90,0x05,0x40,0x05,0x13,0x3c,0x02,0xde,0xcf,0x51,0x7c,0x04,0x54,0x00,0x05,0x01,0x02,0xc0,0x52,0x90,0x15,0x36,0x51,0x89,0xc8,0x0a,0x99,0x50,0x08,0xe6,0x10,0x01,0x51,0x41,0x20,0x14,0x12,0x48,0x5b,0x4b,0x01,0x40,0x04,0xe1,0x4b,0x01,0x05,0x00,0x40,0x15,0x14,0x04,0x3e,0x00,0x05,0x00,0x21,0x4a,0x02,0x01,0xe8,0x22,0xa1,0xf4,0x00,0xb0,0x12,0x45,0x4e,0xc1,0x14,0xe1,0x24,0x09,0x45,0x40,0x11,0x76,0x02,0x04,0x92,0x09,0x92,0x76,0x00,0x9f,0xe8,0xa8,0x02,0x2a,0x00,0x8a,0x80,0x2a,0x42,0x80,0xa8,0x02,0x82,0xe0,0x02,0x00,0x14,0x80,0x02,0x14,0x2c,0x0a,0x5a,0x45,0x01,0x6d,0x16,0x00,0xa0,0x5a,0x00,0x00,0x51,0x14,0x00,0x00,0x32,0x10,0x0a,0x00,0x04,0x29,0x40,0x16,0x8a,0x08,0x00,0x28,0x92,0x4e,0xc0,0x16,0xcd,0x02,0x42,0xa0,0x0a,0x8a,0x80,0xb6,0x08,0x02,0xd1,0xd1,0xe8,0x08,0x00,0xa1,0x48,0x0a,0x8a,0x9f,0xe0,0x28,0x65,0x01,0x41,0x01,0x41,0x01,0x7e,0xa2,0x80,0x05,0xf0,0x02,0x0a,0x80,0xa8,0x00,0x2a,0x00,0xa9,0x91,0x41,0x15,0x16,0x36,0x00,0x00,0x8a,0x26,0xc0,0x16,0xd2,0x40,0x54,0xf8,0xa0,0x85,0xe0,0x83,0x20,0xa0,0x00,0x8a,0x00,0x9a,0x50,0x10,0x59,0x40,0x05,0xa0,0x00,0x30,0x08,0xa0,0x05,0xa2,0x80,0x85,0x2a,0x02,0xa0,0xa0,0x82,0x90,0x08,0x2a,0x78,0x02,0xc2,0x00,0x2f,0x00,0x08,0x58,0x00,0xbd,0x4a,0x00,0xa8,0xa0,0x20,0xa4,0x80,0x08,0x00,0xa8,0x02,0xc2,0x28,0x08,0x00,0xbf,0x88,0x28,0x20,0xa8,0x0a,0x25,0x94,0x0a,0x22,0x82,0x00,0x0a,0x81,0x40,0xa2,0x19,0x05,0x40,0xec,0x15,0x29,0x60,0x00,0x45,0x04,0xee,0x17,0x09,0x7c,0x28,0x02,0x00,0x00,0x04,0x00,0x02,0x2a,0x00,0x00,0x22,0xa7,0x80,0x00,0x00,0x8a,0x80,0x22,0xfd,0x40,0x00,0x04,0x00,0x10,0x00,0x40,0x01,0x03,0x00,0x08,0x00,0x64,0xfa,0x20,0x0a,0x90,0xa0,0x02,0x80,0x0a,0x00,0x41,0x40,0xa5,0x00,0x2f,0xa0,0x00,0xa5,0x00,0x2a,0x2e,0x40,0x05,0x00,0x00,0x50,0x20,0x0d,0x82,0xc0,0x00,0x00,0x7e,0x80,0x00,0xa0,0x8a,0x80,0x01,0x95,0xb0,0x4a,0x58,0x10,0x05,0xc2,0x6c,0x05,0x11,0x40,0x40,0x01,0x50,0x05,0x04,0x05,0x9c,0x20,0xbf,0xa0,0x8a,0x8a,0x02,0x50,0xbd,0x80,0x9a,0x00,0x53,0xa1,0x3e,0x82,0xfd,0x04,0x02,0xd5,0x17,0xc0,0x04,0x50,0x04,0x01,0x44,0x50,0x45,0x4e,0xd4,0x13,0xb1,0x40,0x04,0x80,0x15,0x15,0x01,0x7f,0x42,0x8f,0xf0,0x03,0xff,0x00,0x4c,0x20,0x29,0xb4,0x01,0x44,0x50,0x10,0x00,0x15,0x00,0xb5,0x40,0x14,0x00,0x11,0x40,0x0b,0x45,0xf0,0x12,0x05,0x40,0x50,0x01,0x14,0x01,0x01,0x41,0x15,0x00,0x51,0x14,0x11,0x50,0x03,0x02,0xa0,0x2f,0x80,0x02,0x29,0x66,0xc1,0x15,0x14,0x11,0x51,0x40,0x80,0x40,0x30,0x2c,0x20,0x28,0x20,0x2f,0x40,0x00,0x8a,0x00,0x8a,0x7a,0x00,0x8b,0xfe,0x82,0x2a,0x28,0x20,0xa8,0x0a,0x09,0xe8,0x2f,0xa5,0x22,0xf8,0x08,0xa2,0x02,0xa5,0x80,0x2c,0xa6,0x05,0x80,0x11,0x50,0x05,0x00,0x13,0xfa,0x00,0x40,0x59,0x60,0x5a,0x66,0x55,0x00,0x0f,0xe8,0x01,0x42,0x00,0x50,0x50,0x1e,0xa2,0xce,0xf6,0x80,0x25,0x28,0x08,0x8a,0x58,0x21,0xb0,0x04,0x09,0x00,0x40,0x01,0x15,0x00,0x45,0x40,0x01,0x00,0x54,0x58,0x01,0x51,0x40,0xf5,0x50,0x05,0x05,0x00,0x14,0x00,0x32,0x0a,0x22,0x82,0x88,0xa0,0x06,0x94,0x00,0x01,0x40,0x00,0x89,0x00,0x52,0x21,0x14,0x0a,0x28,0x00,0x20,0x00,0x51,0x01,0x51,0x50,0x17,0xb0,0x40,0x17,0x62,0x02,0xa0,0x50,0x02,0xc0,0x08,0x28,0x01,0xa2,0x80,0x09,0x13,0x20,0xa5,0xa0,0x04,0xe5,0x42,0x81,0x05,0x4f,0xa0,0xa2,0x28,0x16,0x98,0x00,0x50,0x40,0x54,0xd2,0xa0,0x28,0x8a,0x06,0x50,0x59,0xe4,0x0f,0xea,0x00,0x28,0x80,0x28,0x97,0x90,0x05,0x40,0x00,0x58,0x04,0x54,0x01,0x40,0x04,0xb0,0x30,0x0a,0x5a,0x28,0x26,0x49,0x00,0x54,0x5d,0x20,0x0a,0x80,0x0a,0x80,0x2a,0x28,0x00,0x1b,0x04,0x52,0x50,0x03,0xb5,0x38,0x03,0x40,0x00,0x1f,0x50,0x05,0xe5,0x14,0x0b,0x04,0x05,0x40,0x05,0x45,0x4e,0xc1,0x49,0xe5,0x00,0x15,0x16,0x81,0x28,0x54,0x90,0x15,0x00,0x52,0x44,0x05,0x10,0x00,0x54,0x05,0x45,0x49,0x01,0x44,0x05,0x91,0x00,0x15,0x14,0x00,0x27,0x60,0x80,0x00,0xa8,0x00,0xa0,0x09,0x06,0x94,0x04,0x54,0xc1,0x90,0x54,0x14,0x11,0x51,0x40,0xa4,0x3f,0x4d,0x00,0x00,0x12,0x00,0x08,0xa8,0x02,0x28,0x09,0x3b,0x03,0x90,0x42,0x55,0x00,0x45,0x01,0x29,0x17,0xfe,0x00,0x80,0x02,0x1b,0x00,0x11,0x50,0x04,0x54,0x01,0x15,0x00,0x94,0x95,0x49,0x03,0xd5,0x45,0x01,0x50,0x05,0x54,0xfc,0x01,0x55,0x16,0x00,0x02,0x81,0x42,0x00,0x52,0xc0,0x05,0x80,0x00,0x20,0x05,0x02,0x00,0x54,0x50,0x15,0x00,0x15,0x14,0x0b,0x02,0x80,0x54,0x01,0x40,0x03,0x1c,0x02,0x01,0x6a,0x00,0x98,0x5d,0xa0,0x0a,0x60,0xfa,0x80,0xa2,0x4e,0xc0,0x15,0x14,0x10,0x14,0x00,0x40,0x52,0x80,0x04,0xd2,0x80,0x04,0x80,0x20,0xa0,0x22,0x80,0x80,0x01,0x81,0x50,0x15,0x0d,0x28,0x1e,0x21,0x78,0x01,0x72,0x8a,0x80,0xa8,0x28,0x08,0xa9,0xe0,0x2a,0x70,0xa0,0x22,0xe9,0x14,0x12,0xc5,0x00,0x45,0x94,0x05,0x11,0x40,0xa4,0x5e,0xd0,0x00,0x90,0x00,0x01,0x44,0xa5,0xa0,0x40,0x50,0x12,0x97,0x69,0x40,0xa7,0x28,0x01,0xa2,0x54,0x01,0x00,0x14,0x2d,0x01,0x51,0x52,0xc0,0x54,0x00,0x09,0x28,0x14,0x40,0x01,0x50,0x05,0x45,0x9e,0x41,0x01,0x74,0x08,0xa8,0x02,0x88,0x02,0xa2,0xa0,0x2a,0x2a,0x01,0x02,0xd0,0x02,0x59,0x4b,0xfa,0x08,0x2c,0x80,0x9d,0x96,0x28,0x08,0xa0,0x20,0xbb,0x40,0x51,0x30,0xa0,0x26,0x14,0x04,0xd2,0xa0,0x0a,0x8a,0x80,0xbd,0x89,0x80,0x05,0x00,0x45,0x00,0x11,0x50,0x00,0x00,0x00,0x10,0x95,0x40,0x01,0x00,0x92,0x00,0x04,0x00,0x34,0x7c,0x10,0x04,0x54,0xb0,0x0f,0x00,0x09,0x40,0x04,0x15,0x00,0x45,0x4f,0x80,0x22,0xa0,0x19,0x45,0x4c,0x00,0xa9,0x0a,0x00,0x28,0x0a,0x8a,0x00,0x2f,0xf0,0x00,0x01,0x48,0x45,0x05,0x30,0x12,0x07,0xe2,0xa7,0xfe,0xac,0x68,0x00,0xe7,0x4a,0x00,0x00,0x28,0x00,0x70,0x00,0xa2,0x2f,0x00,0x00,0x02,0xa0,0x0a,0x81,0x40,0x0a,0x02,0x0a,0x02,0x2a,0x70,0x00,0x00,0x2a,0x2a,0x02,0xf6,0x12,0x76,0x08,0xa8,0xa0,0x09,0x6a,0x08,0x0a,0x07,0x09,0x90,0x03,0x25,0x0b,0x20,0x22,0xa0,0x28,0x00,0x80,0xa0,0x8a,0x8b,0xd0,0x08,0xa8,0x0a,0x80,0x0b,0x02,0x00,0xa9,0xd0,0xba,0x04,0x5c,0xa1,0x40,0x28,0x92,0x02,0x98,0x90,0x11,0x4d,0xa0,0x28,0x11,0xc0,0x07,0xc4,0x01,0x7e,0x22,0xe4,0x04,0x53,0x84,0x05,0x42,0x80,0x17,0x60,0x08,0xa8,0x02,0xd2,0x5a,0xa0,0x00,0xa0,0x22,0xda,0x02,0x90,0x20,0x28,0x84,0x02,0xa4,0x6c,0x58,0x01,0x15,0x01,0x50,0xe0,0x01,0x60,0x4c,0x00,0xa8,0x02,0x9d,0x80,0x09,0x22,0x80,0x00,0x20,0xa8,0x0a,0x80,0x00,0xb9,0x00,0x04,0xb0,0x0a,0x5b,0x4e,0x70,0x0b,0x68,0x28,0x22,0x88,0x0a,0x85,0x2f,0x00,0x4a,0x52,0xa7,0xf4,0x15,0x00,0x0d,0x2a,0x28,0x22,0x88,0x02,0xa0,0x0a,0x8a,0x80,0xa0,0x80,0xa8,0xa8,0x0b,0xe2,0x14,0x78,0x07,0xe0,0x51,0xe8,0x13,0xc2,0x61,0x4c,0x02,0x01,0x00,0x00,0x08,0x04,0x82,0x0a,0x80,0x07,0x88,0x00,0x20,0x12,0x00,0x20,0x00,0x81,0x90,0x04,0x54,0x01,0x29,0x52,0x40,0x45,0x40,0x21,0x50,0x05,0x85,0x4d,0x00,0xb4,0x00,0x29,0x42,0xc0,0x11,0x00,0x40,0x28,0x40,0x0a,0x22,0x80,0xa8,0xa0,0x2a,0x00,0xa4,0x00,0x0a,0x8b,0x00,0x07,0x6a,0x08,0x40,0xa0,0x14,0x68,0x01,0x50,0x01,0x50,0x01,0x50,0x05,0xf5,0x16,0xd0,0x16,0x11,0x50,0x16,0x11,0x40,0x04,0x50,0x42,0x85,0xc8,0x22,0x98,0x40,0x17,0x00,0x04,0x08,0xa0,0x8a,0x96,0x01,0x4a,0x8a,0x08,0xa0,0x02,0x12,0xa0,0x00,0x08,0x2a,0x7d,0x01,0x40,0x01,0x36,0xa0,0x8b,0x28,0xa0,0x8a,0x18,0x01,0x14,0x01,0x0f,0x8b,0xff,0x00,0x01,0x29,0x51,0x7c,0x00,0x40,0x05,0x3c,0x01,0x01,0x40,0x41,0x41,0x0a,0x50,0x13,0xea,0xa2,0x80,0x80,0x0b,0x1b,0x04,0x00,0x54,0xb0,0x50,0x40,0x50,0x01,0x20,0x27,0x60,0x2a,0x0a,0x09,0x2b,0x08,0x00,0x16,0xa0,0x8a,0x80,0x0b,0xca,0x00,0xa5,0x26,0xca,0x00,0x5d,0x20,0x2a,0x0a,0x08,0xa8,0xb6,0x00,0x8b,0xc8,0x08,0x6c,0x05,0x40,0x05,0xf1,0x03,0xb0,0x0e,0x14,0x01,0x00,0x15,0x21,0x40,0x41,0x6c,0x01,0x00,0x01,0x50,0x05,0x24,0x04,0x3e,0xaa,0x02,0x82,0x71,0x90,0x50,0x4d,0x00,0x0b,0xb0,0x40,0x28,0x00,0x00,0x3e,0x00,0x08,0x4a,0x82,0x48,0x7a,0x50,0x12,0x08,0x00,0x70,0x01,0xf5,0x15,0x00,0x45,0x40,0x12,0xd5,0x2c,0x00,0x01,0x00,0x04,0x00,0x10,0x0f,0xd0,0x11,0x65,0x00,0x49,0xf1,0x52,0x40,0x54,0x95,0x01,0x51,0x40,0x00,0x17,0xd0,0x50,0x00,0x05,0xc0,0x8a,0x05,0x2a,0x28,0x10,0xa8,0xa0,0x02,0x80,0x10,0x02,0x90,0x8b,0xd8,0x1c,0x10,0x00,0xa0,0x80,0xa7,0xa0,0x04,0xf3,0xb2,0xc0,0x14,0x49,0x50,0x00,0x02,0x04,0x50,0x45,0x43,0xc0,0x05,0x40,0x51,0x00,0x5c,0x82,0x6c,0x05,0xf0,0x40,0x14,0x90,0x13,0x40,0xa0,0x52,0x28,0x08,0xa9,0xb0,0x14,0x00,0x40,0x00,0x51,0x00,0x25,0x50,0x15,0x00,0x15,0x05,0x00,0x98,0xe1,0x00,0x3f,0x05,0x00,0xe4,0x45,0x00,0x29,0x00,0x16,0x50,0x14,0x42,0x80,0x3e,0x0a,0x08,0xa8,0x02,0x80,0x02,0x2a,0x01,0x22,0x80,0x8a,0x52,0x58,0x28,0x00,0x90,0x2a,0x02,0x82,0x01,0xd2,0xa2,0x80,0x5a,0x00,0xa1,0x28,0x00,0x00,0xa0,0x40,0x09,0x95,0x01,0x01,0x74,0x00,0x00,0x20,0x02,0x88,0xa0,0x9f,0xa0,0x00,0xa8,0xa0,0x20,0xba,0x04,0x16,0x00,0x3d,0x41,0x40,0x45,0xca,0x00,0x0a,0x08,0xa0,0x08,0x04,0x82,0xfa,0x82,0x80,0x22,0xc8,0x27,0x22,0xd0,0x08,0xa8,0x00,0xa1,0x40,0x26,0x16,0x40,0x40,0x00,0x50,0x04,0x24,0x28,0x00,0x00,0x93,0x42,0x01,0x21,0x38,0x36,0x02,0x2a,0x00,0x13,0xa0,0x10,0x00,0x11,0x50,0x04,0x50,0x11,0x14,0xfc,0x04,0x92,0x4f,0xe8,0x02,0x00,0x20,0x00,0x80,0x00,0x8a,0x92,0x02,0xa2,0x80,0x00,0x28,0x16,0x0a,0x00,0x0a,0x8a,0x0a,0x22,0x80,0xa6,0x20,0x00,0x08,0x05,0xc0,0x1a,0x05,0x0b,0xd8,0x01,0xfc,0x14,0x00,0x01,0x53,0x4b,0x00,0x14,0x10,0x01,0x45,0x00,0x2d,0x88,0x02,0xf8,0x8b,0x68,0x06,0x05,0x40,0x0b,0x54,0x03,0xc3,0x81,0x41,0x05,0x4f,0x00,0x59,0x00,0x38,0x04,0x00,0x54,0x01,0x72,0x80,0x0a,0x20,0x29,0x48,0xa0,0x22,0xa0,0x00,0xa0,0x85,0x0b,0x90,0x13,0xfe,0x00,0x07,0xc5,0x49,0xe4,0x17,0xe2,0x6d,0x73,0xc8,0x02,0x0a,0x08,0xbf,0x00,0x08,0xf1,0x17,0xa4,0x05,0x11,0x40,0x4a,0x00,0x14,0x00,0x00,0x04,0x20,0x00,0x58,0x01,0x02,0x00,0x50,0xfd,0x00,0x10,0x90,0x14,0x01,0x0c,0x9f,0xc5,0x04,0x3b,0x00,0x54,0x3e,0xaf,0xc0,0x43,0x5e,0x2a,0x00,0x29,0xa0,0x32,0x20,0x02,0x80,0x00,0x00,0x9f,0x80,0x02,0xd0,0x02,0x50,0xa8,0x0a,0x5f,0x28,0x00,0x28,0x08,0xa8,0xb6,0x08,0x0a,0x00,0x00,0x9f,0x57,0xb4,0x01,0x51,0x40,0x11,0x60,0x01,0x14,0x90,0x11,0x40,0x48,0x15,0x36,0x00,0xbc,0x65,0x3c,0x03,0xd1,0x50,0x0d,0x2a,0x28,0x24,0x05,0x00,0xa4,0x20,0x02,0xa6,0x80,0x15,0x14,0x10,0x00,0x0e,0x80,0x03,0xfd,0x45,0x04,0x3a,0x00,0x3a,0x45,0x40,0x30,0x49,0x48,0x0a,0x8a,0x80,0x80,0x00,0x8a,0x80,0x01,0x40,0x80,0x02,0x05,0x80,0x80,0x02,0x16,0x00,0x93,0xc8,0x00,0x2a,0x00,0xb0,0x00,0x2c,0x01,0x00,0xa0,0x02,0x88,0xa0,0x61,0x69,0x14,0x05,0x45,0x02,0x81,0x40,0x00,0x16,0x84,0x50,0x15,0x17,0x40,0x00,0x0a,0x20,0x0a,0x00,0x00,0x7a,0x00,0x28,0x20,0xa5,0x00,0x84,0x28,0x24,0xf0,0xa4,0x27,0xd0,0x5b,0x49,0x50,0x11,0x53,0xe1,0x90,0x16,0x10,0x05,0x45,0x40,0x51,0x14,0x0f,0x10,0x50,0x01,0x01,0x50,0x50,0x49,0x14,0x04,0x14,0x00,0x45,0x04,0x95,0x4f,0xc5,0x04,0x0e,0x00,0x54,0x14,0x11,0x40,0x09,0x45,0x4b,0x05,0xb4,0x54,0x05,0x12,0x40,0x54,0xfe,0x8a,0x02,0x2a,0x40,0x28,0x52,0x00,0xa9,0x3b,0x00,0xb0,0x28,0x15,0x05,0x04,0x52,0x50,0x15,0x14,0x04,0x54,0x50,0x00,0x04,0x50,0xd0,0x14,0x8b,0x68,0x07,0x67,0x0b,0xd2,0x02,0x81,0xd8,0x00,0x80,0xa2,0x00,0x2a,0x2f,0x80,0x82,0xa0,0x2a,0x2a,0x02,0x85,0x20,0x2e,0xc4,0xbf,0xc0,0x15,0x0a,0x50,0x40,0xfc,0x00,0x14,0x04,0x05,0xd8,0x01,0xb4,0x05,0x11,0x40,0xfa,0x8a,0x80,0x50,0xa8,0x02,0xc2,0x69,0x40,0x4d,0x8a,0x08,0xa0,0x06,0x11,0x50,0x14,0xca,0x28,0x20,0x4e,0xc0,0x05,0x01,0x05,0x40,0x00,0x00,0x2e,0xc0,0x09,0x00,0x48,0x15,0x00,0x28,0x00,0x45,0x40,0x37,0x08,0xa0,0x24,0x80,0x04,0xa2,0xa0,0x08,0x00,0x25,0x2a,0x00,0x06,0x70,0x09,0x68,0xa0,0x20,0x00,0x81,0x60,0x20,0x00,0x8a,0x40,0x0b,0x00,0x02,0x88,0xa0,0x2a,0x28,0x2f,0x44,0x22,0x80,0xa8,0xa0,0x2a,0x28,0x00,0x00,0xa9,0x6a,0x02,0xda,0x28,0x00,0x02,0x81,0x00,0x10,0x65,0x40,0x21,0x32,0xb0,0x00,0x00,0x2a,0x00,0xa0,0x92,0x0b,0xf1,0x15,0x00,0x14,0xbe,0x41,0x00,0x05,0x21,0x3e,0x00,0xa8,0x52,0x82,0x50,0x4a,0x82,0x28,0x02,0x00,0x0a,0x08,0x02,0xda,0x28,0x27,0xaa,0x19,0x03,0x08,0xa9,0xc0,0x28,0x20,0x01,0x2a,0x08,0xa9,0xe0,0x0a,0x82,0x82,0x0a,0x02,0x2d,0x92,0x80,0x28,0x00,0x9e,0x2a,0x6c,0x05,0xb1,0x2c,0x01,0x40,0x3b,0x49,0x14,0x02,0x84,0xf4,0x01,0x76,0x02,0x2a,0x28,0x1d,0xa2,0x80,0x8a,0x9c,0x4a,0x82,0x28,0x9d,0x02,0x88,0xa0,0x22,0x80,0x22,0xa0,0x2a,0x29,0xf0,0x11,0x44,0x01,0x4a,0x01,0x30,0xa8,0x02,0xa6,0x8d,0x80,0xb4,0x8b,0x69,0x60,0xa8,0x28,0x20,0xa8,0x02,0xa1,0x40,0x2a,0x16,0x00,0xa0,0x22,0xd7,0x48,0x02,0x92,0x00,0x82,0x80,0x05,0xa0,0x01,0x2a,0x06,0x92,0xc9,0x50,0x41,0x40,0x48,0x25,0x4a,0x01,0x14,0x02,0x40,0x04,0x15,0x24,0x00,0x00,0xb0,0x50,0x45,0x45,0xad,0x00,0x96,0x00,0x16,0x7a,0x48,0x1e,0x27,0x6a,0x00,0x81,0x20,0x26,0xd5,0x28,0x00,0xc8,0x00,0x20,0x00,0x02,0x04,0xf2,0x70,0x02,0x00,0x12,0x84,0x80,0x4a,0x65,0x49,0x04,0x0d,0x20,0x00,0x02,0x01,0x20,0x80,0x01,0xe8,0x00,0xa2,0x28,0x0a,0x8a,0x02,0xa6,0x94,0x08,0x00,0x15,0x50,0x80,0x50,0x80,0x14,0x00,0x14,0x00,0x58,0x4f,0x4b,0x05,0x20,0x00,0x8d,0x2d,0x00,0x04,0x0a,0x08,0xb6,0x80,0x2c,0x01,0x00,0x00,0x0a,0x8a,0x80,0xa2,0x19,0x05,0x4c,0xa8,0x02,0x05,0x02,0x88,0x02,0xd2,0x2a,0x00,0x00,0x2a,0x2a,0x02,0xec,0x84,0x50,0x04,0x50,0x41,0x40,0x45,0x4c,0x70,0xa0,0x05,0x80,0x02,0x40,0x2d,0x70,0x25,0xaf,0xa0,0x9d,0xaa,0x00,0x29,0x68,0x04,0x81,0x60,0xa6,0x91,0x60,0x12,0x74,0xb4,0x76,0x80,0x10,0xa6,0xc1,0x00,0x03,0x42,0xa0,0x0a,0x00,0x8a,0x20,0x29,0xe8,0x00,0x8a,0x92,0x0a,0x15,0x80,0x04,0x5d,0xa7,0x80,0xb4,0x07,0x00,0x80,0x50,0x02,0x80,0x22,0xa0,0x28,0x00,0x22,0xf7,0x20,0x25,0x2f,0x88,0x02,0xa2,0xc8,0x00,0x00,0x08,0xa0,0x8a,0x00,0x20,0x7f,0x80,0xa5,0xa2,0x82,0x02,0x82,0x1e,0x0a,0x00,0x00,0x6d,0x15,0x01,0x4b,0x29,0x01,0x53,0xc0,0x05,0x94,0x58,0x40,0x5e,0x10,0x50,0x40,0x00,0x05,0x01,0x14,0x04,0x15,0x3c,0x01,0x51,0x7d,0x04,0xfa,0x49,0xe1,0x40,0x69,0x7c,0x10,0x03,0xb1,0x41,0x00,0xf4,0x08,0x00,0x10,0x50,0x10,0x00,0x13,0x0a,0x94,0x01,0x41,0x20,0x20,0x00,0x8b,0x94,0x00,0x28,0x04,0x00,0x10,0x2c,0x01,0x00,0x09,0x45,0x40,0x3e,0xa4,0xaa,0x00,0x48,0x48,0x20,0x00,0x00,0x02,0xa2,0x80,0xa8,0x02,0x80,0x0a,0x07,0x00,0xa0,0x02,0xa0,0xa0,0x2a,0x2e,0x80,0x54,0xb5,0xa0,0x00,0xd8,0x2c,0x14,0x68,0x02,0x02,0xc0,0x52,0xc0,0x15,0x39,0x21,0x40,0xcf,0x40,0x00,0x00,0x0a,0x80,0x0a,0x8a,0x08,0xa8,0xa0,0x8a,0x8a,0x00,0x00,0x8a,0x8a,0x08,0xa6,0x00,0x0a,0x40,0x17,0xd0,0x40,0x51,0x3d,0x00,0x51,0x00,0x54,0x36,0x0a,0x00,0x08,0xa8,0x00,0xa8,0x0a,0x20,0x0a,0x98,0x54,0xa0,0x50,0x4e,0x01,0x42,0x8d,0xc0,0x02,0x2d,0x00,0x8a,0x02,0x28,0x80,0xa0,0x80,0x14,0x18,0x05,0x10,0x05,0xf1,0x15,0x00,0x54,0x00,0x14,0x04,0x59,0x12,0x01,0x50,0x50,0x24,0xf5,0x14,0x04,0x00,0x16,0xc3,0x90,0x48,0x05,0x04,0x00,0x05,0x45,0xec,0x00,0x2c,0x04,0xb0,0xa0,0x15,0x36,0x02,0x81,0xe0,0x08,0x28,0x1a,0x93,0xea,0x00,0x28,0x00,0x69,0x0f,0x40,0x5a,0x00,0x10,0xb0,0x01,0x40,0x4a,0x50,0x00,0x45,0x04,0x05,0x00,0xa0,0xb0,0x32,0x8a,0x64,0x0b,0x12,0x96,0x40,0x11,0x41,0x00,0x05,0x45,0x90,0x02,0xd0,0x05,0xf1,0x00,0x00,0xd8,0x01,0x22,0x02,0xa2,0xa0,0x01,0x00,0x09,0x90,0x00,0x10,0x00,0x01,0x24,0x95,0x40,0x04,0x24,0x00,0x01,0x24,0x99,0x00,0x4a,0x17,0xf8,0x80,0x20,0x02,0x00,0x05,0xa4,0xad,0xa0,0x08,0xa0,0x22,0x80,0x10,0xa8,0x02,0x80,0x0a,0x22,0x82,0x88,0xa0,0x2a,0x2c,0x00,0xa8,0x02,0xaa,0x00,0xaa,0x80,0x29,0xa0,0x01,0x51,0x40,0x02,0x01,0x44,0x50,0x15,0x00,0x51,0x17,0x52,0x00,0x76,0x00,0x00,0x28,0x00,0x8a,0x8b,0x60,0x85,0xa9,0x20,0x05,0x00,0x82,0x80,0x8a,0x8a,0x00,0x14,0x05,0x22,0x80,0x8a,0x80,0x0b,0x22,0x01,0xda,0xa2,0xfe,0x02,0x06,0xc0,0x0b,0x50,0x11,0x44,0xb0,0x03,0x2b,0x3e,0x80,0x82,0x82,0x2a,0x28,0x27,0x80,0xb1,0xc8,0x22,0xa0,0x0a,0x60,0x40,0x14,0x40,0x51,0x14,0x10,0x85,0x00,0x45,0x4d,0x82,0xc9,0x22,0x02,0xa2,0xa0,0x12,0xa7,0x40,0x22,0xa0,0x0a,0x22,0xf8,0x08,0x00,0x00,0xbe,0x01,0xb3,0x80,0x03,0x40,0x78,0x05,0xed,0x17,0x69,0xe0,0x2a,0x2a,0x02,0x88,0xb4,0x09,0x85,0x10,0x14,0x48,0x50,0x04,0x59,0x02,0x91,0x50,0x00,0x50,0x41,0x50,0x15,0x05,0x01,0x16,0x34,0x94,0x0b,0xf1,0x05,0xc8,0x22,0x88,0x0a,0x8a,0x80,0x6c,0x16,0x01,0x15,0x14,0x04,0x00,0x50,0x2c,0x0c,0x08,0x01,0x4a,0x20,0x05,0x8a,0x08,0xa2,0x7f,0xd0,0x15,0x14,0x04,0xc8,0x00,0x40,0x01,0xc2,0x28,0x04,0x20,0x67,0x90,0x11,0x50,0x15,0x2f,0x20,0x02,0x2c,0xa0,0x01,0xd8,0x08,0x00,0x20,0xa8,0x02,0x48,0x00,0x8a,0x80,0x07,0xa9,0xad,0x80,0x08,0x00,0x00,0x4a,0x00,0x20,0xa8,0x02,0xa0,0x0a,0x00,0x28,0x8a,0x0a,0x42,0x52,0xc0,0x28,0x80,0x2a,0xa2,0x80,0x7d,0x08,0xe8,0x14,0x00,0x50,0x00,0xa5,0x40,0x16,0xc0,0x05,0x0d,0x00,0xa8,0x00,0xa4,0x00,0x2a,0x4e,0xd4,0x02,0x0f,0x13,0x2b,0x80,0x00,0x00,0x16,0x00,0x41,0x41,0x15,0x16,0x00,0x11,0x40,0xa3,0xe0,0x80,0xa2,0x00,0xa8,0xa0,0x22,0xc8,0x80,0x7f,0x03,0x20,0x28,0x8a,0x08,0x2a,0x02,0x86,0x53,0x60,0xa2,0x00,0xb2,0x80,0x00,0xb4,0x80,0xbc,0x22,0xa0,0x00,0xa0,0x94,0xa8,0xa0,0x82,0x80,0x22,0xa0,0x0a,0x7d,0x01,0x14,0x40,0x5b,0x13,0x04,0x82,0x96,0x20,0x2a,0x76,0x28,0x09,0x9e,0x05,0x01,0x3e,0x2a,0x02,0x82,0x02,0xa5,0xae,0x93,0xf4,0x00,0x5b,0x00,0x45,0xb0,0x4b,0x14,0x02,0x44,0x01,0x68,0x10,0x05,0x45,0x01,0x05,0x03,0x93,0x40,0x08,0x67,0x93,0xe9,0xf4,0x15,0x17,0xea,0x00,0xa0,0x09,0xa0,0x00,0x54,0x50,0x13,0x90,0x05,0xd2,0x16,0x56,0xc1,0x40,0x01,0x34,0xa5,0x80,0x08,0x0a,0x8a,0x80,0x2f,0x28,0xa0,0x80,0x72,0x0a,0x6a,0x11,0x40,0x45,0x00,0x30,0x8a,0x08,0x7f,0xc0,0x02,0x41,0x41,0x15,0x00,0x0e,0x00,0x08,0x00,0x10,0x0d,0x40,0x00,0x02,0x29,0x48,0x00,0x52,0x02,0xe5,0x36,0x00,0x26,0xb6,0xa8,0x00,0x00,0x9b,0x03,0x40,0x20,0x4e,0x81,0x00,0x04,0x90,0xd8,0x00,0x24,0x81,0x21,0x28,0x00,0x00,0x99,0x00,0x00,0x00,0x85,0x34,0x00,0xa8,0xa0,0x2a,0x2c,0x01,0x64,0x48,0x02,0xfa,0x22,0xe4,0x14,0x00,0x14,0x82,0xc0,0x85,0x45,0x05,0x10,0x05,0x11,0x60,0x0a,0x54,0x50,0x03,0x40,0x10,0xb4,0x8a,0x05,0xad,0xa0,0x0a,0x22,0x81,0x65,0x93,0xa2,0x00,0x0b,0x01,0x48,0xca,0x48,0x0a,0x8b,0x60,0x22,0xa0,0x02,0x88,0x04,0x16,0xa0,0x20,0xa8,0x0a,0x8a,0x00,0x8b,0x40,0x08,0x00,0x61,0x60,0xc8,0x01,0x28,0x00,0x16,0x48,0x0a,0x20,0x2a,0x00,0x1d,0xc8,0x5a,0xd0,0x20,0x2f,0x00,0x65,0x2d,0x50,0x00,0x50,0x10,0x5e,0x80,0x45,0xc0,0x02,0x7f,0x00,0x15,0x14,0x01,0x14,0x00,0x48,0x5c,0x80,0x8a,0x02,0x0a,0x00,0x9e,0x10,0x00,0xa7,0x08,0x02,0x89,0x60,0xa2,0x14,0x02,0xa0,0x02,0x80,0x22,0xc2,0x00,0x28,0x00,0x94,0xa8,0x0a,0x8a,0x00,0x73,0x94,0x50,0x01,0x01,0x44,0x50,0x01,0x3b,0x00,0xd2,0xa0,0x29,0x94,0x5e,0x00,0x45,0x40,0x50,0x28,0x01,0x14,0x10,0x00,0x5a,0x41,0x41,0x2d,0x6c,0x40,0x54,0x54,0x01,0x52,0x54,0x01,0x00,0x54,0x00,0x3e,0x28,0x40,0x20,0xa0,0x20,0x00,0x47,0xe8,0x00,0x20,0xa0,0x80,0x00,0x64,0x40,0x0d,0x80,0x01,0x68,0x00,0x00,0x80,0x00,0x8a,0x80,0x09,0x20,0x08,0xa0,0x20,0x00,0x21,0x20,0x08,0x00,0x22,0xa0,0x00,0x80,0x00,0x00,0x8b,0xc8,0x0a,0x99,0x50,0x21,0x50,0x05,0x20,0xff,0x00,0x00,0x51,0x08,0x90,0x68,0x40,0x16,0x15,0x34,0xb9,0x00,0x0d,0x82,0x84,0x00,0xa2,0x28,0x28,0x8b,0xa0,0x15,0x08,0x05,0xdc,0x80,0x05,0xac,0x22,0xc8,0x10,0x00,0x19,0x54,0xb5,0x00,0x00,0x02,0x00,0x15,0x00,0x05,0x00,0xa1,0x00,0x59,0x42,0x94,0x11,0x51,0x41,0x0c,0xaa,0x00,0xa0,0x09,0x6a,0x00,0x80,0xa0,0x8b,0xe8,0x80,0x2a,0x00,0xa8,0x28,0x26,0x40,0x05,0x9e,0x50,0x50,0x00,0x04,0x5f,0x00,0x11,0x6c,0x01,0x3e,0x8a,0x02,0x2f,0x49,0xa0,0x05,0x00,0x11,0x50,0x09,0x38,0x00,0x53,0x26,0x00,0x43,0x19,0x00,0x54,0x50,0x10,0x54,0x05,0x13,0x72,0xa0,0x84,0x80,0x29,0x1d,0x00,0x08,0x00,0x29,0x28,0x0b,0xa1,0x24,0x05,0xca,0x2a,0x78,0x00,0xa9,0xae,0x40,0xc0,0x2f,0x40,0x85,0x28,0x08,0xa5,0xa0,0x0b,0xb1,0x2c,0x0b,0x2d,0x40,0x04,0x50,0x10,0xa0,0x05,0xa0,0x03,0x40,0x01,0x05,0x00,0x08,0xa8,0x02,0x88,0x02,0xc0,0x40,0x01,0xde,0xd3,0x40,0x7a,0xa8,0xa0,0x08,0xa0,0x22,0xa6,0xa0,0x14,0x10,0x05,0x00,0x40,0x00,0x35,0x20,0x01,0xa2,0x93,0x8c,0x82,0x82,0x74,0x06,0x40,0x01,0x17,0x28,0x07,0x80,0x9e,0x80,0x12,0x00,0x8a,0x80,0x00,0x08,0x00,0x08,0x16,0x02,0x2a,0x00,0x8a,0x80,0x7a,0x8a,0x64,0x10,0x00,0x40,0x00,0x10,0x00,0x00,0x45,0x45,0x02,0x02,0x00,0x50,0x20,0x05,0x45,0x01,0x50,0x05,0x54,0x01,0x42,0x24,0x05,0x00,0x05,0xa4,0x8d,0xa8,0x0b,0x08,0xa0,0x00,0x0b,0x0a,0x88,0x0d,0x08,0xb0,0x02,0xa4,0x00,0x28,0x40,0x0a,0x87,0x20,0x2c,0x22,0x81,0x00,0x00,0x1e,0x00,0x2a,0x28,0x1f,0xa0,0x94,0x0a,0x22,0x82,0x0b,0xb0,0x0d,0x4a,0x2a,0x02,0x88,0x00,0x00,0x28,0x8a,0x01,0x68,0xa0,0x84,0x0a,0x02,0x7f,0x15,0x33,0x80,0x54,0xa1,0x41,0x15,0x00,0x54,0x16,0xc1,0x05,0x40,0x5b,0x4c,0x70,0x28,0x02,0x00,0xa9,0xb5,0x00,0x4f,0xe1,0x9e,0x14,0x10,0x5a,0x40,0x14,0xec,0xd0,0x20,0x28,0x22,0xa2,0xc0,0x20,0x00,0x50,0xa8,0x0a,0x9e,0x6d,0x40,0x37,0x02,0x4a,0xc0,0x26,0x57,0xfa,0x00,0x81,0xf8,0x02,0xca,0x41,0xd0,0x00,0xa8,0x0a,0x6b,0x68,0x00,0xb6,0x68,0x04,0xe3,0x20,0xa0,0x20,0xa0,0x22,0xa0,0x16,0xb6,0x58,0x02,0x0a,0x08,0xa8,0xa0,0x84,0x2e,0xa5,0x00,0x05,0x01,0x15,0x00,0x00,0x14,0xf8,0x8a,0x02,0x2a,0x58,0x2e,0x0f,0xa2,0x02,0xe6,0x11,0x50,0x05,0xa4,0x01,0x44,0x50,0x40,0x5f,0x00,0xf8,0x8a,0x58,0x22,0xd0,0x80,0x58,0x00,0x1f,0xe1,0xf4,0x04,0x00,0x09,0x00,0x01,0x25,0x41,0x34,0x00,0x08,0xa9,0x20,0x12,0x20,0x2a,0x00,0x09,0x45,0x80,0x02,0x01,0xd0,0x20,0x00,0x00,0x8a,0x80,0x22,0xa0,0x09,0x0a,0x9c,0x00,0x48,0x48,0x25,0x80,0x02,0x2a,0x00,0xa8,0x02,0x80,0x0b,0x62,0x28,0x00,0x02,0x81,0x00,0xa0,0x01,0x4b,0x08,0xa0,0x2a,0x28,0x0a,0x80,0x28,0x00,0xa5,0x22,0x82,0xd9,0x68,0x02,0xaa,0x00,0xa2,0x65,0x74,0x05,0x2a,0x00,0xbd,0x64,0x94,0x50,0x01,0x41,0x3b,0x5c,0xa2,0x80,0x1a,0x00,0x08,0x00,0xd8,0x28,0x00,0x80,0xa5,0x00,0x01,0xf5,0x01,0x60,0xf8,0x80,0x05,0x28,0x02,0x00,0x05,0xaa,0x00,0xa8,0x00,0x2a,0x00,0xa1,0x90,0x11,0x40,0x04,0xa2,0x80,0x51,0x01,0x44,0x90,0x15,0x38,0x50,0x04,0xf1,0x40,0x13,0x6a,0x02,0x16,0x52,0x82,0x7a,0x29,0x40,0x8a,0x25,0x02,0xa4,0x92,0x68,0x14,0x00,0x49,0x51,0x00,0x54,0x33,0x99,0x00,0x14,0x04,0x90,0xa0,0x3f,0xaa,0x80,0x2a,0x2a,0x00,0x40,0xa0,0x14,0x8b,0xd8,0x20,0xa0,0x22,0xf2,0x00,0x22,0x80,0x20,0xa0,0x9b,0x51,0x01,0x50,0xd8,0x02,0x80,0x05,0x24,0x00,0xa2,0x00,0x5a,0xa0,0x0a,0x20,0x0a,0x60,0x3e,0x00,0x6c,0x00,0xfa,0x8a,0x80,0xb0,0x00,0x22,0xa1,0x80,0x36,0xa8,0xa0,0x7e,0x02,0x02,0xa2,0xa0,0x12,0x00,0x00,0x01,0xa0,0x40,0x54,0x00,0x3b,0x04,0x00,0x54,0x80,0x11,0x48,0xfd,0x04,0x90,0x00,0x40,0x00,0x2c,0x04,0x02,0xc1,0x03,0x20,0x08,0x00,0x48,0x80,0x08,0xa8,0x01,0x42,0x02,0xca,0x00,0x25,0x01,0xc8,0x00,0x80,0x14,0x19,0x00,0x00,0x16,0x11,0x40,0x00,0x05,0x00,0x25,0x51,0x40,0x54,0x20,0x15,0x50,0x05,0x81,0x14,0x14,0x40,0x1a,0x11,0x40,0xca,0xa1,0x40,0xa5,0x80,0x1d,0x2a,0x28,0x0a,0x8a,0x00,0x00,0x2a,0x40,0x0a,0x58,0x02,0xdf,0x48,0x28,0x1e,0x08,0xa0,0x00,0x02,0xa0,0x02,0xa4,0x6c,0x01,0x40,0x04,0x52,0x80,0x45,0x40,0x5e,0x89,0x40,0x01,0x50,0x16,0xd1,0x40,0x10,0x2c,0x0f,0x40,0x05,0x0d,0x72,0x00,0x22,0xec,0x11,0x50,0x05,0xc7,0x66,0xd2,0x94,0x01,0x14,0x01,0x0f,0x40,0x50,0x01,0x14,0x00,0x4f,0xfa,0x01,0x1a,0x50,0x01,0x16,0xc0,0x40,0x50,0x40,0x58,0x04,0x81,0x40,0x43,0x92,0x94,0x10,0x00,0x54,0x50,0x02,0x90,0x9d,0x00,0xa1,0xb0,0x41,0x61,0x00,0xfe,0x80,0x0a,0x8a,0x00,0x9a,0x00,0x05,0x40,0x59,0x39,0xf8,0x8a,0x05,0x20,0xa0,0x40,0x1c,0xd8,0x08,0xa8,0x05,0xaa,0x70,0xa0,0x22,0x9a,0x04,0x00,0x14,0x40,0x15,0x03,0xd0,0x08,0x00,0x5b,0x45,0x40,0x03,0x80,0x02,0x94,0x02,0x4f,0xc4,0x01,0x6a,0x10,0x01,0x50,0x00,0x02,0xc0,0xa4,0x59,0x9a,0x40,0x16,0x90,0x00,0x00,0x04,0x00,0x00,0x04,0x90,0x00,0x10,0x00,0x24,0x12,0x82,0x8f,0x40,0x40,0x02,0x41,0x00,0x00,0x10,0x00,0x36,0x8a,0x80,0x24,0xaa,0x00,0x00,0x20,0x00,0x20,0x00,0x19,0x01,0x15,0x00,0x50,0x01,0x44,0x50,0x00,0x05,0x00,0x14,0x00,0x51,0x14,0x05,0x40,0x15,0x50,0x05,0x54,0x01,0x44,0x01,0x78,0x00,0x14,0x00,0x52,0xc0,0x05,0x4b,0x24,0x16,0x0a,0x00,0x51,0x00,0x53,0x40,0x0a,0x9b,0x32,0xb4,0x06,0x84,0x50,0x00,0x00,0x00,0x5a,0x10,0x01,0x51,0x7b,0x04,0x5c,0xa2,0x82,0x28,0x02,0x2a,0x28,0x24,0x8b,0x20,0x20,0x00,0x7d,0x54,0x01,0x51,0x50,0x17,0xc4,0x50,0x04,0x31,0xc2,0x80,0x7a,0x92,0xa0,0x8a,0x20,0x16,0x69,0x4a,0x00,0x00,0x04,0x85,0x04,0x05,0x04,0x15,0x00,0x50,0x04,0x2d,0x40,0x01,0x01,0x44,0x5f,0xf4,0x11,0x44,0x05,0xf4,0x10,0x05,0x32,0x80,0x28,0x02,0x00,0x07,0x0a,0x9a,0x50,0x10,0x59,0x04,0x14,0x01,0x14,0x80,0x45,0x00,0x04,0x95,0x04,0x5e,0x74,0x8a,0x08,0xa8,0xa0,0x8a,0x8a,0x00,0x80,0x0a,0x8b,0xa0,0x00,0x04,0x5f,0x04,0xa0,0x15,0x14,0x00,0x00,0x09,0x36,0x02,0x0a,0x08,0xa9,0xd2,0x80,0x80,0x00,0x00,0x01,0x60,0x00,0x00,0x20,0x10,0x04,0xec,0x00,0xca,0x00,0x1b,0x80,0x04,0xf1,0x50,0x0d,0x9a,0x0b,0x04,0x33,0xd9,0x60,0x00,0x80,0x6c,0x10,0x00,0xf4,0x90,0x10,0x24,0x01,0x32,0x01,0xb0,0x40,0x2c,0x00,0x10,0x00,0x45,0x40,0x01,0x00,0x3d,0x00,0x41,0x50,0x00,0x01,0x7b,0x11,0x40,0x00,0x14,0x00,0x51,0x14,0x05,0xca,0x00,0xa0,0x02,0x80,0x0a,0x22,0xd8,0x2d,0x08,0x02,0xaa,0x00,0xa1,0x90,0x05,0x81,0x28,0x15,0x50,0x05,0x80,0x00,0x54,0x01,0x48,0x00,0x15,0x21,0x40,0x00,0x17,0x42,0x28,0x00,0x91,0xa0,0x50,0x00,0xc8,0x72,0x00,0xbf,0x11,0x7f,0xd0,0x45,0x4b,0x3d,0x00,0x00,0x01,0x40,0x04,0x80,0x00,0x05,0x48,0x54,0x05,0x13,0x95,0x00,0x00,0x4a,0x3f,0xf0,0xdc,0xa8,0x08,0x64,0x00,0x00,0x51,0x00,0x5c,0xa0,0xb0,0x08,0x0a,0x02,0x00,0x29,0x68,0x78,0x0a,0x7a,0x20,0x00,0x01,0xd8,0xa8,0x0a,0x82,0x80,0x00,0x05,0x00,0x20,0x28,0x22,0xa4,0x2c,0x02,0x28,0x00,0x82,0x80,0x20,0x02,0x94,0x80,0xa6,0x02,0xc0,0x40,0xa0,0x54,0x54,0x05,0x40,0x05,0x11,0x68,0x10,0x54,0x01,0x44,0x01,0x78,0x13,0xd0,0x0c,0x80,0x28,0x80,0x02,0xd0,0x08,0x29,0xaa,0x01,0x3f,0xe8,0xa0,0x05,0x96,0x00,0x26,0x40,0xcf,0xe0,0x00,0x00,0x00,0x5a,0x58,0x28,0x80,0x00,0x00,0x08,0x00,0x00,0x02,0x00,0x00,0x14,0x20,0x02,0x52,0xa0,0x06,0x78,0x00,0x10,0xb2,0x80,0x10,0x00,0x10,0x02,0x44,0x00,0x00,0x11,0x50,0x00,0x40,0x00,0x03,0x48,0x50,0x02,0x2a,0x00,0x00,0x00,0x01,0xf5,0x50,0x05,0xf8,0x00,0x28,0x8a,0x00,0x40,0x0a,0x00,0x0a,0x8a,0x0a,0x20,0x0a,0xa8,0x58,0x2d,0x06,0xc0,0x15,0x39,0x01,0x55,0x14,0x08,0x54,0xa0,0x14,0x45,0x01,0x50,0xf0,0x14,0x00,0x5c,0x80,0x04,0x10,0x19,0x05,0x10,0x05,0x08,0x01,0x77,0x28,0x00,0xa0,0x80,0xa4,0x80,0x1f,0x81,0x60,0x2a,0x6f,0x40,0x07,0xd5,0x21,0x2c,0x14,0x00,0x40,0x50,0x48,0x0c,0x2e,0x41,0x14,0xf0,0xb0,0x11,0x50,0x05,0xd2,0x28,0x21,0x2a,0x9a,0x01,0x7f,0xc0,0x80,0x4f,0xd0,0x01,0x68,0x00,0x45,0xa4,0x01,0x41,0x01,0x60,0x3c,0x4a,0x05,0xc8,0x20,0x2a,0x2a,0x58,0x2a,0x07,0x60,0xa8,0x00,0xa8,0x28,0x20,0x28,0x08,0x28,0x08,0x7f,0x14,0x03,0x69,0xca,0x81,0xda,0x29,0xc0,0x22,0x88,0x02,0xa7,0x0a,0x00,0x80,0x10,0xa9,0xc0,0x0a,0x00,0x20,0xa8,0x05,0x8a,0x92,0x02,0x80,0x20,0xa8,0x00,0x28,0x22,0xa5,0x80,0xa2,0x00,0xa8,0xa8,0x0a,0x00,0x08,0xa0,0x22,0x9f,0xa9,0x60,0x2a,0x00,0x6c,0x00,0x00,0xc8,0x1d,0x12,0x20,0x05,0x80,0x2a,0x00,0x07,0xa8,0x00,0x50,0x46,0x80,0x40,0x03,0x20,0x50,0x08,0xb4,0x80,0x06,0x40,0x4f,0xfa,0x00,0x20,0x00,0x22,0xa0,0x2a,0x00,0x09,0x20,0x02,0x00,0x08,0xa8,0x05,0x19,0x00,0x40,0x2c,0x04,0x54,0x00,0x45,0x01,0x00,0x00,0x01,0x25,0x50,0x05,0x00,0x05,0x40,0x15,0x50,0x05,0x00,0x05,0x48,0x2c,0x15,0x50,0x05,0x81,0x14,0x0f,0xc5,0xff,0x00,0x51,0x40,0x54,0x01,0x55,0x95,0x05,0x00,0x0a,0x5c,0xa2,0x80,0xa9,0x90,0x14,0x84,0x50,0x15,0x14,0x0c,0x89,0x95,0x02,0x14,0x80,0x08,0x28,0x01,0x68,0x45,0x00,0xa3,0xd0,0x0c,0xf0,0x0a,0x04,0x02,0x02,0x80,0x01,0x80,0x00,0x82,0xc0,0x5b,0x03,0x80,0x3a,0x41,0x76,0x08,0xa8,0xa0,0x8a,0x8a,0x09,0xb5,0x43,0x60,0xbe,0x84,0x20,0x0a,0x94,0xa0,0x8b,0x60,0x08,0xa8,0xa0,0x80,0x00,0x00,0x28,0x14,0x02,0x7d,0x54,0x05,0x04,0x00,0x38,0x30,0x0a,0x85,0x80,0xa8,0x7c,0x01,0x50,0x2b,0x30,0x05,0x28,0x80,0xa8,0x52,0x82,0x29,0x8e,0x10,0x17,0xc4,0x5b,0x24,0x00,0x01,0x14,0x01,0x15,0x00,0x51,0x0c,0x80,0xb4,0x80,0x28,0x8a,0x02,0x2e,0x09,0x04,0x51,0x01,0x52,0x94,0x04,0x0f,0x40,0x36,0x2a,0x02,0x88,0xa0,0x8a,0x48,0x02,0x28,0x02,0x28,0x01,0x60,0x09,0x21,0x64,0x68,0x00,0x00,0x00,0x04,0x90,0x05,0x40,0xec,0x00,0x24,0x0f,0x88,0xa8,0x01,0x80,0x01,0x15,0x00,0x02,0x40,0x43,0xf8,0x00,0x50,0x02,0x4e,0x80,0x90,0x11,0x50,0x09,0x24,0x40,0x00,0x01,0x16,0x7a,0x40,0x10,0x00,0x00,0x04,0x0f,0xd0,0x04,0xc8,0x00,0x20,0x2e,0x50,0x00,0xa4,0x50,0x10,0x00,0x11,0x50,0x00,0x01,0x48,0x48,0x50,0x00,0x01,0x51,0x40,0xb0,0x01,0x40,0x05,0x20,0x00,0x00,0x14,0x00,0x51,0x14,0x05,0x40,0x15,0x50,0x05,0x11,0x40,0x54,0x01,0x55,0x00,0x5f,0x40,0x01,0x79,0x4f,0xe1,0x60,0xa7,0xa0,0x0a,0x22,0x80,0xa8,0x02,0xa0,0xa0,0x00,0x02,0xa0,0x0a,0x21,0x90,0x50,0x00,0x02,0x00,0x0c,0xf0,0x02,0xc1,0xe2,0x00,0x00,0x00,0xa8,0x00,0x4a,0xf8,0x02,0x0a,0x02,0x28,0x06,0x52,0x15,0x30,0x00,0xa8,0x02,0x90,0x02,0x0a,0x80,0xa2,0x00,0xa2,0x28,0x00,0x80,0x4f,0xe2,0x90,0x00,0x16,0x02,0x2f,0x28,0x6c,0x05,0x10,0x14,0x4d,0xad,0x00,0x8a,0x00,0x26,0x00,0x20,0x21,0x41,0x15,0x14,0x13,0x01,0x20,0x0a,0x20,0x0a,0x80,0x12,0xb9,0x4c,0x00,0xa8,0x2f,0xa0,0x92,0xbc,0x96,0x96,0x04,0xa8,0x01,0x28,0x00,0x51,0xb5,0x28,0x10,0x00,0x50,0x01,0x14,0x01,0x01,0x41,0x20,0x00,0x00,0x00,0xc4,0x48,0x00,0x06,0xc0,0x45,0x3f,0x00,0x40,0xc8,0x01,0x20,0x20,0xa8,0x00,0x00,0x09,0x20,0x2a,0x00,0x08,0x1b,0x05,0x96,0x54,0x04,0x2c,0x30,0x01,0xa4,0x00,0x04,0x00,0x92,0x40,0x10,0x90,0x00,0x01,0x24,0x00,0x10,0x00,0x45,0x4c,0x80,0x68,0x90,0x10,0x54,0x00,0x10,0x00,0x36,0x02,0x00,0x16,0x50,0x00,0x41,0x00,0x00,0x68,0x14,0x00,0x51,0x00,0x5c,0x80,0x02,0xe5,0x00,0x50,0x01,0x44,0x50,0x17,0x28,0x03,0x48,0x00,0xbb,0x21,0x14,0x16,0x0d,0x20,0x0a,0xa8,0x02,0x88,0xa0,0xa2,0x28,0x00,0x40,0x28,0x00,0x2a,0x00,0xa6,0x80,0x14,0x45,0x00,0x82,0x0c,0x80,0xbf,0xd4,0x50,0x20,0x00,0x09,0x00,0x00,0x05,0x00,0x00,0x36,0x00,0x00,0x05,0x80,0xa2,0x10,0x02,0x88,0x02,0xa2,0x82,0x00,0x0b,0x3b,0x00,0x0f,0xa1,0xca,0x02,0x80,0x01,0x94,0x01,0x48,0x45,0x04,0x53,0xd0,0x10,0x14,0x00,0x01,0x29,0x40,0x10,0x50,0x02,0x50,0x05,0x4f,0x56,0x50,0x17,0xb4,0xa0,0x05,0xb4,0x54,0x05,0x10,0x01,0x43,0x40,0x22,0xa0,0x2e,0xa5,0x14,0x00,0x00,0x45,0x10,0x14,0x45,0x02,0xd0,0x00,0x59,0x4e,0x16,0x41,0x15,0x14,0x04,0x50,0x04,0x27,0x6a,0x01,0x65,0x27,0xa0,0xa8,0x00,0x14,0x00,0x12,0x00,0x00,0x00,0x20,0x0a,0x80,0x2a,0x00,0x18,0x28,0x00,0x32,0x80,0x01,0x40,0x02,0x72,0x01,0x93,0x93,0x40,0x25,0x2a,0x78,0x00,0x12,0x80,0xa8,0x19,0x01,0x15,0x00,0x90,0x40,0x54,0x90,0x01,0x00,0x03,0x22,0x00,0x00,0x09,0x95,0x40,0x11,0x50,0x00,0x26,0x00,0x40,0x00,0x0a,0x01,0x15,0x24,0x00,0x00,0x40,0x00,0x0c,0x82,0x6d,0x50,0x05,0x00,0x08,0x54,0x01,0x40,0x01,0x50,0x05,0x03,0xd0,0x15,0x00,0x55,0x48,0x01,0x40,0x05,0x11,0x72,0x02,0xa0,0x0a,0x41,0x00,0x28,0x80,0x2a,0xa0,0x0a,0x40,0x00,0xa8,0x02,0xaa,0x00,0xa2,0x28,0x00,0x64,0x17,0x60,0x02,0xda,0x0b,0xb0,0x04,0x50,0x51,0x00,0x58,0x10,0xbe,0x81,0x72,0x00,0x19,0x54,0xd9,0x00,0x4a,0xe4,0x40,0x51,0x14,0x00,0x32,0x00,0x00,0x44,0x80,0x05,0x2a,0x7f,0xa6,0x40,0x85,0x40,0x05,0x09,0x04,0x50,0x03,0x27,0x28,0x01,0x2a,0x80,0x28,0x80,0x28,0x00,0x00,0x09,0x0a,0x50,0x02,0x0a,0x08,0x2e,0x10,0x05,0x00,0x41,0x50,0x05,0x10,0x14,0x12,0x80,0x54,0x80,0x01,0x7f,0xa8,0x0a,0x00,0x20,0xba,0x40,0x2c,0x50,0x13,0xd0,0x01,0x65,0x0a,0x50,0x45,0xe4,0x84,0x00,0x14,0x11,0x50,0x00,0x28,0x05,0x10,0xc8,0x00,0x00,0x05,0x00,0x1b,0x00,0x04,0x01,0x40,0x11,0x75,0xea,0x18,0x00,0x00,0x2c,0x4c,0xa8,0x09,0x26,0x40,0x00,0x04,0x00,0x04,0x54,0x05,0x40,0x00,0x10,0x15,0x0d,0x80,0x08,0x00,0x07,0x40,0x80,0x00,0x20,0x00,0x00,0x84,0x80,0x19,0x04,0x00,0x10,0x15,0x02,0xc0,0x2c,0x40,0x00,0x01,0x00,0x0b,0x00,0x04,0x00,0x00,0x00,0x40,0x05,0x40,0x14,0x40,0x14,0x0c,0x00,0x00,0x2c,0x08,0xa0,0xa2,0x28,0x0a,0x80,0x28,0x90,0xa0,0x2a,0x00,0xa2,0x42,0x80,0xa8,0x02,0xed,0x6d,0x00,0x52,0x11,0x40,0x54,0xd1,0x90,0x55,0x40,0x17,0x30,0x26,0x54,0x15,0x20,0x01,0x40,0x05,0x32,0x86,0x41,0x55,0x00,0x51,0x17,0xd0,0x54,0x00,0x58,0x29,0x00,0x53,0x20,0x02,0xa0,0x0a,0x09,0x9e,0x01,0x40,0x00,0x00,0x20,0x54,0x05,0x11,0x68,0x00,0xa0,0x00,0x32,0x00,0x00,0x67,0xf0,0xd8,0x00,0x00,0x2a,0x0b,0xd8,0x22,0xa0,0x02,0xa0,0x0a,0x24,0xac,0x02,0x2a,0x28,0x14,0x22,0xc8,0x10,0x22,0x82,0x00,0x00,0xa8,0x0a,0x8a,0x80,0xa4,0x08,0x02,0xec,0x4c,0x02,0xa2,0xa0,0x2d,0xa0,0xa0,0x22,0x80,0x20,0x01,0x6b,0x8f,0xfa,0x7f,0x00,0x45,0x40,0x16,0xc1,0x00,0xb5,0x40,0x02,0x80,0x00,0xa0,0x00,0x00,0x03,0x40,0x00,0x06,0x09,0x45,0x01,0x00,0x15,0x32,0x11,0xd8,0x00,0x58,0x1d,0x82,0x01,0xb0,0x00,0x93,0xa1,0x01,0x42,0x90,0x00,0x00,0x28,0xb4,0x00,0x00,0x09,0x40,0x02,0xc0,0x04,0x00,0x02,0x53,0x20,0x12,0x00,0x22,0xa0,0x02,0x00,0xa8,0x00,0x65,0x32,0xa8,0x00,0x20,0x2a,0x1e,0x80,0x48,0x20,0x12,0x00,0x09,0xe0,0x00,0x00,0x08,0xb2,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0xa0,0x00,0x00,0x02,0x80,0x05,0x82,0x88,0x02,0x80,0x0b,0x00,0x64,0x05,0x40,0x14,0x45,0x01,0x69,0x00,0x58,0x58,0x40,0x14,0xec,0xc8,0x0a,0x21,0x90,0x50,0xf4,0x01,0x69,0x14,0x00,0x01,0x42,0x8c,0x82,0x88,0x03,0x48,0x1b,0xd0,0x28,0x86,0x81,0x40,0x05,0x40,0x05,0x13,0x2a,0x00,0x00,0xa6,0x90,0xb0,0x51,0x00,0x50,0x00,0x54,0x3a,0x05,0xa1,0x0f,0xe0,0x2e,0x42,0x00,0x0c,0x87,0xa0,0x06,0x49,0x00,0xf0,0x34,0x00,0x00,0x14,0x00,0x10,0x00,0x0b,0xce,0x50,0x00,0x50,0x45,0x45,0x01,0x2c,0xa5,0x04,0x51,0x01,0x50,0x5f,0x80,0x8a,0x16,0x09,0xff,0x00,0x8a,0x68,0x01,0x05,0x01,0x15,0x00,0x54,0x50,0x4d,0xa8,0x80,0x2a,0x00,0x2a,0x00,0x00,0x01,0x90,0x02,0xcc,0x7e,0x80,0x00,0x00,0x04,0x76,0x00,0x27,0x80,0xbc,0x02,0x02,0xfa,0x21,0x60,0xa2,0x6a,0x40,0x24,0x00,0x00,0x00,0x13,0x20,0xa8,0x00,0x02,0x02,0xa0,0x00,0x00,0x08,0x00,0x00,0x02,0x00,0x1f,0x40,0x01,0x00,0x03,0x9c,0x22,0x80,0x80,0x02,0x2a,0x48,0x00,0x80,0x00,0x00,0x84,0x81,0x90,0x40,0x28,0x90,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x11,0x50,0x09,0x00,0x00,0xff,0x00,0x88,0x00,0x00,0x00,0x00,0x20,0x28,0x00,0x00,0x0a,0x00,0x01,0x90,0x14,0x45,0x00,0x00,0x15,0x00,0x50,0x01,0x60,0x4b,0x50,0x15,0x00,0x58,0x13,0xa5,0x80,0x51,0x20,0x05,0x11,0x41,0x44,0x50,0x33,0xc2,0xa0,0x0a,0x1b,0x01,0x44,0xce,0x14,0x01,0x14,0x14,0x40,0x15,0x61,0x3d,0x01,0x44,0xed,0x40,0x0b,0x01,0x73,0x38,0x10,0x05,0x00,0x05,0xca,0x64,0x05,0x00,0x0a,0x00,0x00,0x50,0x20,0x13,0x90,0x53,0xc0,0xec,0x00,0x39,0x05,0x40,0x01,0x51,0x40,0x00,0x00,0x32,0x01,0xe1,0x60,0x00,0x00,0x59,0x40,0x14,0x00,0x00,0x40,0x00,0x00,0x64,0x2c,0x00,0x28,0x00,0x00,0x03,0xc0,0x03,0x00,0x0a,0x87,0x40,0x00,0x00,0x00,0x58,0x1b,0x02,0x80,0x00,0x09,0x00,0x28,0x00,0x32,0x93,0x20,0xa7,0x89,0x40,0x2e,0x13,0xd0,0x01,0x50,0x00,0x00,0x0c,0x00,0x02,0x19,0x05,0xca,0x00,0x00,0x00,0x00,0x02,0x50,0x00,0x00,0x40,0x26,0x40,0x00,0x00,0x40,0x54,0x00,0x04,0x32,0x01,0x26,0xc0,0x11,0x50,0x00,0x40,0x54,0x00,0x03,0x29,0x20,0x58,0x00,0x20,0x00,0x06,0x40,0x40,0x03,0x20,0x02,0x00,0x02,0x00,0x00,0x48,0x08,0xa8,0x00,0x00,0x01,0x60,0x80,0x00,0x00,0x00,0x00,0x20,0x0a,0x22,0x81,0x40,0x00,0x00,0x28,0x8a,0x00,0x00,0xa2,0x00,0xa0,0x02,0x88,0xa0,0x7e,0x80,0x0a,0x22,0x80,0xb0,0x99,0xe4,0xf4,0x14,0x40,0x15,0x50,0x05,0x00,0x14,0x40,0x15,0x61,0x00,0x58,0x32,0x9a,0x50,0x51,0x00,0x51,0x16,0xc0,0x54,0x50,0x04,0x50,0x17,0x3c,0x20,0x0a,0x24,0x28,0x1f,0x16,0x50,0x80,0x5c,0x88,0xa0,0x08,0xb4,0x04,0xf0,0xa8,0x02,0xc0,0x00,0x05,0x00,0x01,0xe0,0x28,0x80,0x28,0x72,0x01,0x47,0x81,0x1c,0x81,0x93,0x20,0x00,0x16,0x00,0x00,0x2e,0x71,0x20,0x00,0x20,0x28,0x00,0x00,0x00,0x14,0x07,0x20,0x00,0x58,0x80,0xb4,0x00,0x00,0x64,0x04,0x5c,0x80,0x00,0x00,0x4e,0xce,0x40,0x30,0x20,0x29,0x93,0x04,0x00,0x22,0x82,0x28,0x80,0xa8,0x00,0xa2,0x00,0xb3,0xa4,0x00,0x00,0x00,0x00,0x04,0xa0,0x17,0x68,0x00,0x64,0x3d,0x00,0x3f,0x82,0x7a,0x0b,0x29,0x60,0x0a,0x80,0x00,0x80,0x2e,0xd0,0x00,0x10,0xa0,0x15,0x00,0x02,0x89,0x90,0x40,0x00,0x92,0x49,0x40,0x54,0x93,0x20,0x06,0x50,0x00,0x00,0x12,0x64,0x00,0x00,0x01,0x00,0x01,0x01,0x50,0x00,0x10,0x00,0x00,0x04,0x50,0x13,0x20,0x00,0x20,0x00,0x01,0xd8,0x20,0x2a,0x00,0x00,0x00,0x00,0x20,0xa8,0x00,0x00,0xa8,0xa8,0x0a,0x40,0x00,0x1a,0x80,0x05,0x40,0x14,0x00,0x02,0x00,0x15,0x14,0x00,0x00,0x54,0x01,0x40,0xff,0x00,0x01,0x44,0x01,0x40,0x05,0x11,0x40,0x00,0x14,0x45,0x01,0x50,0xe4,0x14,0x4d,0xa8,0x0a,0x80,0x28,0x90,0xa0,0xa2,0x28,0x04,0x00,0x0a,0x80,0x29,0x92,0xc0,0x15,0x00,0x53,0x21,0x90,0x15,0x00,0x58,0x10,0x05,0x08,0x3b,0x05,0x40,0x05,0x00,0x03,0xfa,0x14,0x02,0xa6,0x40,0x16,0x90,0x90,0x51,0x14,0x00,0x40,0x51,0x14,0x02,0x09,0x00,0x33,0xc9,0x20,0x0a,0x80,0x10,0x7f,0xc0,0x05,0x4e,0x72,0x00,0xa2,0x00,0xa8,0x00,0xb2,0x25,0x99,0x05,0x49,0x0c,0x80,0xa8,0x02,0xfc,0x40,0x05,0x10,0x01,0x50,0x00,0x00,0x15,0x00,0x32,0x6c,0x00,0xc8,0x00,0x08,0x02,0x88,0x02,0xa2,0xe5,0x00,0x03,0x40,0x07,0xe9,0x40,0x22,0xa0,0x01,0x47,0xd0,0x32,0x00,0x00,0x80,0xa2,0x00,0x02,0x02,0x89,0x3d,0x80,0x01,0xd0,0x19,0x32,0x84,0x80,0x00,0x08,0x00,0x02,0x48,0x28,0x80,0x00,0x02,0x01,0xa0,0x00,0x01,0x00,0x0f,0x01,0x00,0x00,0x02,0x84,0x00,0x0a,0x00,0xda,0x00,0x7d,0x00,0x04,0x54,0x00,0x00,0x03,0x26,0xc1,0x00,0x00,0x00,0x12,0xd4,0x01,0x2d,0x50,0x00,0x00,0x00,0x0b,0x00,0x14,0x00,0x10,0x01,0x67,0x8c,0x80,0x0a,0x80,0x0a,0x64,0x00,0x24,0x00,0xb5,0xfc,0x00,0x09,0x00,0x52,0x00,0x08,0x3b,0x00,0x25,0x70,0x00,0x6a,0x08,0x00,0x52,0x34,0x00,0x00,0x0a,0xa0,0x08,0x00,0x19,0x50,0x00,0xfd,0x00,0x52,0x40,0x08,0x28,0x01,0x68,0xd8,0x01,0xff,0x00,0xd5,0x00,0x00,0x00,0x00,0x16,0xc0,0x02,0x2b,0xb0,0x01,0x40,0x11,0x40,0x00,0x00,0x20,0x01,0x70,0x00,0x24,0x4f,0x00,0x02,0xe4,0x9e,0x00,0x05,0x00,0x40,0x01,0x76,0x00,0x25,0xac,0x80,0x06,0xa0,0x00,0xfd,0x00,0x02,0x80,0x02,0xc0,0x0a,0x3f,0xfa,0x00,0x7f,0xf0,0xfc,0x00,0x26,0xca,0xc8,0x01,0x3c,0x00,0x05,0x95,0x20,0x01,0xfa,0x00,0x8a,0x00,0x61,0x32,0x00,0x2d,0x00,0x22,0x80,0x21,0x3c,0x00,0x2a,0x58,0x01,0xf8,0x00,0x04,0xf1,0x9e,0x80,0x0b,0x4a,0x00,0x54,0x00,0x2b,0xe8,0x00,0x00,0x09,0x32,0x4e,0x80,0x08,0xd8,0x00,0x20,0x01,0x00,0x02,0x7e,0xa8,0x02,0x6e,0x0c,0x80,0x00,0x02,0x59,0xb0,0x02,0xc9,0x00,0x4a,0xca,0xde,0x00,0x12,0xd2,0x40,0x15,0x2c,0x00,0xb0,0x00,0xa4,0xff,0x00,0xf2,0x00,0x64,0x00,0x4f,0xc0,0x00,0x28,0x01,0x10,0x01,0x64,0x00,0x40,0x00,0x9e,0x00,0x02,0xf0,0x9f,0xa0,0x01,0x00,0x02,0x00,0x05,0x80,0x09,0x40,0x0a,0x48,0x02,0x42,0xc0,0x02,0x16,0x00,0xff,0xd9,};
+const unsigned vignette_jpg_size = sizeof(vignette_jpg);
+
+}
\ No newline at end of file
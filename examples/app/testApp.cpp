@@ -5,8 +5,11 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "MLAppController.h"
+#include "MLOfflineRender.h"
+#include "MLRealtimeCheck.h"
 #include "mldsp.h"
 #include "mlvg.h"
 
@@ -47,6 +50,7 @@ struct TestAppProcessor : public SignalProcessor, public Actor
 
 void processTestApp(AudioContext* ctx, void *untypedState)
 {
+  ML_REALTIME_SCOPE;
   auto state = static_cast< TestAppProcessor* >(untypedState);
   
   // get params from the SignalProcessor.
@@ -193,7 +197,7 @@ public:
         int targetFPS{ 60 };
         ParentWindowInfo windowInfo = ml::getParentWindowInfo(window);
         platformView = std::make_unique< PlatformView >("testapp", windowInfo.windowPtr, appView.get(), nullptr, windowInfo.flags, targetFPS);
-        appView->initializeResources(platformView->getNativeDrawContext());
+        appView->createResources(platformView->getNativeDrawContext());
     }
 
     return r;
@@ -208,14 +212,69 @@ public:
   }
 };
 
+// render the test app's DSP offline with a scripted parameter sweep, without opening
+// a window or audio device. Prints timing stats and optionally writes a WAV file.
+int renderTestAppOffline(const ParameterDescriptionList& pdl, double seconds, const char* outputPath)
+{
+    TestAppProcessor appProcessor;
+    AudioContext ctx(kInputChannels, kOutputChannels, kSampleRate);
+    appProcessor.buildParams(pdl);
+    appProcessor.setDefaultParams();
+
+    OfflineRenderSettings settings;
+    settings.frames = static_cast< size_t >(seconds*kSampleRate);
+    settings.outputChannels = kOutputChannels;
+    settings.sampleRate = kSampleRate;
+
+    // sweep the first oscillator up and the second down, fading out from a quarter of
+    // the way through.
+    ParameterTimeline timeline;
+    constexpr int kSteps{ 64 };
+    for(int i = 0; i <= kSteps; ++i)
+    {
+        float x = i/float(kSteps);
+        size_t t = static_cast< size_t >(x*settings.frames*0.75);
+        timeline.push_back({ t, "freq1", x });
+        timeline.push_back({ t, "freq2", 1.f - x });
+        timeline.push_back({ t + settings.frames/4, "gain", 0.2f*(1.f - x) });
+    }
+
+    auto setParam = [&](const ParameterEvent& e)
+    {
+        appProcessor.onMessage({Path("set_param", e.name), e.normalizedValue});
+    };
+
+    OfflineRenderOutput output;
+    auto stats = renderOffline(ctx, processTestApp, &appProcessor, settings, timeline, setParam, outputPath ? &output : nullptr);
+    std::cout << "offline render: " << stats;
+
+    if(outputPath)
+    {
+        if(!writeWAVFile(outputPath, output))
+        {
+            std::cout << "couldn't write " << outputPath << "\n";
+            return 1;
+        }
+        std::cout << "wrote " << outputPath << "\n";
+    }
+    return 0;
+}
+
 int main(int argc, char* argv[])
 {
     bool doneFlag{ false };
-    PlatformView::initPlatform();
 
     ParameterDescriptionList pdl;
     readParameterDescriptions(pdl);
 
+    // testApp --render <seconds> [output.wav]
+    if((argc > 2) && !strcmp(argv[1], "--render"))
+    {
+        return renderTestAppOffline(pdl, atof(argv[2]), (argc > 3) ? argv[3] : nullptr);
+    }
+
+    PlatformView::initPlatform();
+
     // get window size in system coords
     Vec2 defaultSize = kDefaultGridUnits * kDefaultGridUnitSize;
     Rect systemBoundsRect(0, 0, defaultSize.x(), defaultSize.y());
@@ -262,6 +321,10 @@ int main(int argc, char* argv[])
     appController.appView->stop();
     SDL_DestroyWindow(appController.window);
     SDL_Quit();
+
+#if ML_RT_SAFETY_CHECK
+    ml::rtcheck::printViolationSummary(std::cout);
+#endif
     return 0;
 }
 
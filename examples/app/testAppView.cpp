@@ -80,32 +80,55 @@ void TestAppView::initializeResources(NativeDrawContext* nvg)
   if (!nvg) return;
 
   // initialize drawing properties before controls are made
-  _drawingProperties.setProperty("mark", colorToMatrix({ 0.01, 0.01, 0.01, 1.0 }));
-  _drawingProperties.setProperty("mark_bright", colorToMatrix({ 0.9, 0.9, 0.9, 1.0 }));
-  _drawingProperties.setProperty("background", colorToMatrix({ 0.8, 0.8, 0.8, 1.0 }));
-  _drawingProperties.setProperty("draw_background_grid", true);
-  _drawingProperties.setProperty("common_stroke_width", 1 / 32.f);
+  setDrawingProperty("mark", colorToMatrix({ 0.01, 0.01, 0.01, 1.0 }));
+  setDrawingProperty("mark_bright", colorToMatrix({ 0.9, 0.9, 0.9, 1.0 }));
+  setDrawingProperty("background", colorToMatrix({ 0.8, 0.8, 0.8, 1.0 }));
+  setDrawingProperty("draw_background_grid", true);
+  setDrawingProperty("common_stroke_width", 1 / 32.f);
   
   // helpful options to have for debugging
-  // _drawingProperties.setProperty("draw_widget_bounds", true);
-  // _drawingProperties.setProperty("draw_dirty_widgets", true);
+  // setDrawingProperty("draw_widget_bounds", true);
+  // setDrawingProperty("draw_dirty_widgets", true);
   
+  // fonts, images and SVGs are shared with any other instances through the resource cache.
+  
+  // draw text from distance field glyphs where the renderer supports them, so that
+  // live resizing doesn't rasterize the glyphs again at each new size.
+  nvgTextSDF(nvg, true);
+
   // fonts
-  _resources.fonts["d_din"] = std::make_unique< FontResource >(nvg, "MLVG_sans", resources::D_DIN_otf, resources::D_DIN_otf_size);
-  _resources.fonts["d_din_italic"] = std::make_unique< FontResource >(nvg, "MLVG_italic", resources::D_DIN_Italic_otf, resources::D_DIN_Italic_otf_size);
+  _resources.fonts["d_din"] = _resourceCache->getFont(nvg, "MLVG_sans", resources::D_DIN_otf, resources::D_DIN_otf_size);
+  _resources.fonts["d_din_italic"] = _resourceCache->getFont(nvg, "MLVG_italic", resources::D_DIN_Italic_otf, resources::D_DIN_Italic_otf_size);
   
   // raster images
-  _resources.rasterImages["vignette"] = std::make_unique< RasterImage >(nvg, resources::vignette_jpg, resources::vignette_jpg_size);
+  _resources.rasterImages["vignette"] = _resourceCache->getRasterImage(nvg, resources::vignette_jpg, resources::vignette_jpg_size);
   
   // SVG images
-  _resources.vectorImages["tesseract"] = std::make_unique< VectorImage >(nvg, resources::Tesseract_Mark_svg, resources::Tesseract_Mark_svg_size);
+  _resources.vectorImages["tesseract"] = _resourceCache->getVectorImage(nvg, resources::Tesseract_Mark_svg, resources::Tesseract_Mark_svg_size);
   
   // drawable images
   _resources.drawableImages["screen1"] = std::make_unique< DrawableImage >(nvg, 320, 240);
+
+  // rasters of SVG images at their drawn sizes
+  _resources.iconCache = std::make_unique< IconCache >(nvg);
+
+  // images of shadow falloffs
+  _resources.shadowCache = std::make_unique< ShadowCache >(nvg);
+
+  // glyphs of the widgets' text, made on a worker and kept between runs
+  File glyphDir(Path(FileUtils::getUserDataPath(), "Madrona Labs", "mlvg"));
+  glyphDir.createDirectory();
+  _resources.glyphCache = std::make_unique< GlyphCache >(nvg, glyphDir.getFullPathAsText().getText());
 }
 
 void TestAppView::clearResources()
 {
+  _resources.iconCache.reset();
+  _resources.glyphCache.reset();
+  _resources.shadowCache.reset();
+  _resources.textLayouts.clear();
+  _resources.sharedLayers.clear();
+  _resources.widgetImages.clear();
   _resources.fonts.clear();
   _resources.rasterImages.clear();
   _resources.vectorImages.clear();
@@ -115,7 +138,7 @@ void TestAppView::clearResources()
 void TestAppView::stop()
 {
   stopTimersAndActor();
-  clearResources();
+  releaseResources();
 }
 
 
@@ -5,8 +5,13 @@
 #pragma once
 
 
+#include <memory>
+
 #include "mldsp.h"
 #include "madronalib.h"
+#include "MLParameterSchema.h"
+#include "pluginParameters.h"
+#include "version.h"
 
 using namespace ml;
 
@@ -20,7 +25,7 @@ namespace llllpluginnamellll {
 
 // TODO load from plugin description file
 
-inline void createPluginParameters(std::vector< std::unique_ptr< ParameterDescription > >& params)
+inline void createPluginParameters(ParameterDescriptionList& params)
 {
   params.push_back( ml::make_unique< ParameterDescription >(WithValues{
     { "name", "gain" },
@@ -84,7 +89,14 @@ inline void createPluginParameters(std::vector< std::unique_ptr< ParameterDescri
 
 }
 
-  
+// The descriptions and projections are the same for every instance, so all the
+// processors and controllers in the process share one schema while any are alive.
+inline std::shared_ptr< const ParameterSchema > getPluginParameterSchema()
+{
+  ParameterDescriptionList pdl;
+  createPluginParameters(pdl);
+  return ParameterSchema::getShared(stringPluginName, pdl);
+}
 
 }}} // namespaces
 
@@ -109,16 +109,12 @@ tresult PLUGIN_API PluginController::initialize(FUnknown* context)
     return result;
   }
   
-  // read parameter descriptions from parameters.h
-  createPluginParameters(_parameterDescriptions);
-  
-  // make normalized <-> real projections
-  createProjections(_parameterDescriptions);
+  _stateLayout = parameterState::Layout(_schema->getNames());
 
   // set initial param values, allocating any needed memory
-  for(auto & paramPtr : _parameterDescriptions)
+  for(int i=0; i < _schema->size(); ++i)
   {
-    ParameterDescription& param = *paramPtr;
+    const ParameterDescription& param = _schema->getDescription(i);
     
     auto paramName = param.getProperty("name").getTextValue();
     auto paramDefault = param.getProperty("default").getFloatValue();
@@ -131,9 +127,9 @@ tresult PLUGIN_API PluginController::initialize(FUnknown* context)
   }
   
   // store param ids by name
-  for(int i=0; i < _parameterDescriptions.size(); ++i)
+  for(int i=0; i < _schema->size(); ++i)
   {
-    ParameterDescription& param = *_parameterDescriptions[i];
+    const ParameterDescription& param = _schema->getDescription(i);
     Path paramName = param.getProperty("name").getTextValue();
     _paramIDsByName[paramName] = i;
   }
@@ -141,9 +137,9 @@ tresult PLUGIN_API PluginController::initialize(FUnknown* context)
   // generate Steinberg parameters for each parameter
   // the info is needed in this form by some Steinberg API elsewhere (auwrapper is one place)
   // it might not be necessary to save these: if we override getParameterInfo() we could generate them on the fly.
-  for(int i=0; i < _parameterDescriptions.size(); ++i)
+  for(int i=0; i < _schema->size(); ++i)
   {
-    ParameterDescription& param = *_parameterDescriptions[i];
+    const ParameterDescription& param = _schema->getDescription(i);
     bool isAutomatable = param.getProperty("automatable").getBoolValueWithDefault(true);
     bool isReadOnly = param.getProperty("read_only").getBoolValueWithDefault(false);
     const char *name = param.getProperty("name").getTextValue().getText();
@@ -172,18 +168,23 @@ tresult PLUGIN_API PluginController::setComponentState(IBStream* state)
   // receive the current state of the processor
   if(!state) return kResultFalse;
   
-  IBStreamer streamer(state, kLittleEndian);
+  // start from the current plain values, so that any not in the state are unchanged.
+  size_t nParams = _schema->size();
+  std::vector< float > plainValues(nParams);
+  for(size_t id = 0; id < nParams; ++id)
+  {
+    plainValues[id] = normalizedParamToPlain(id, getParamNormalized(id));
+  }
   
-  for(auto& p : _parameterDescriptions)
+  if(parameterState::read(state, plainValues.data(), _stateLayout) == parameterState::kReadError)
   {
-    Path paramName = p->getTextProperty("name");
-    float fTemp;
-    streamer.readFloat(fTemp);
-    int id = getParamIDByName(paramName);
-    float fNorm = plainParamToNormalized(id, fTemp);
-    setParamNormalized(id, fNorm);
+    return kResultFalse;
   }
   
+  for(size_t id = 0; id < nParams; ++id)
+  {
+    setParamNormalized(id, plainParamToNormalized(id, plainValues[id]));
+  }
   return kResultOk;
 }
 
@@ -232,7 +233,7 @@ tresult PLUGIN_API PluginController::getParamStringByValue (ParamID id, ParamVal
 {
   const int precision = 2;
   TextFragment number = textUtils::floatNumberToText(normalizedParamToPlain(id, valueNormalized), precision);
-  TextFragment suffix = _parameterDescriptions[id]->getProperty("units").getTextValue();
+  TextFragment suffix = _schema->getDescription(id).getProperty("units").getTextValue();
   TextFragment numberWithSuffix = suffix ? (TextFragment (number, " ", suffix)) : (number);
   Steinberg::UString(string, 128).fromAscii(numberWithSuffix.getText());
   return kResultTrue;
@@ -257,7 +258,7 @@ tresult PLUGIN_API PluginController::getParamValueByString (ParamID id, TChar* s
 
 ParamValue PLUGIN_API PluginController::normalizedParamToPlain (ParamID id, ParamValue valueNormalized)
 {
-  ParameterDescription& param = *_parameterDescriptions[id];
+  const ParameterProjection& projection = _schema->getProjection(id);
     
   // MLTEST
     if(isnan(valueNormalized))
@@ -265,15 +266,14 @@ ParamValue PLUGIN_API PluginController::normalizedParamToPlain (ParamID id, Para
       std::cout << "huh?\n";
     }
   
-  // std::cout << "normalizedParamToPlain: " << valueNormalized << " -> " << param.normalizedToReal(clamp(valueNormalized, 0., 1.)) << "\n";
+  // std::cout << "normalizedParamToPlain: " << valueNormalized << " -> " << projection.normalizedToReal(clamp(valueNormalized, 0., 1.)) << "\n";
   
-  return param.normalizedToReal(valueNormalized);
+  return projection.normalizedToReal(valueNormalized);
 }
 
 ParamValue PLUGIN_API PluginController::plainParamToNormalized (ParamID id, ParamValue plainValue)
 {
-  ParameterDescription& param = *_parameterDescriptions[id];
-  return param.realToNormalized(plainValue);
+  return _schema->getProjection(id).realToNormalized(plainValue);
 }
 
 ParamValue PLUGIN_API PluginController::getParamNormalized (ParamID id)
@@ -294,8 +294,7 @@ tresult PLUGIN_API PluginController::setParamNormalized (ParamID id, ParamValue
 
 Path PluginController::getParamNameByID(int id)
 {
-  ParameterDescription& param = *_parameterDescriptions[id];
-  return Path(param.getProperty("name").getTextValue());
+  return _schema->getName(id);
 }
 
 int PluginController::getParamIDByName(Path paramPath)
@@ -313,7 +312,7 @@ int PluginController::getParamIDByName(Path paramPath)
 
 void PluginController::reportAllParameterValues()
 {
-  for(int i=0; i<_parameterDescriptions.size(); ++i)
+  for(int i=0; i<_schema->size(); ++i)
   {
     _changesToReport.push(ValueChange{concat("param", getParamNameByID(i)), getParamNormalized(i)});
   }
@@ -339,23 +338,17 @@ IPlugView* PLUGIN_API PluginController::createView (const char* name)
   return nullptr;
 }
 
-ParameterDescription* PluginController::getParamDescriptionByPath(Path paramName)
+const ParameterDescription* PluginController::getParamDescriptionByPath(Path paramName)
 {
-  ParameterDescription* returnVal {nullptr};
-  if (_paramIDsByName.getConstNode(paramName))
-  {
-    int idx = _paramIDsByName[paramName];
-    returnVal = _parameterDescriptions[idx].get();
-  }
-  return returnVal;
+  return _schema->findDescription(paramName);
 }
 
-ParameterDescription* PluginController::getParamDescriptionByIndex(int i)
+const ParameterDescription* PluginController::getParamDescriptionByIndex(int i)
 {
-  ParameterDescription* returnVal {nullptr};
-  if (within(i, 0, static_cast<int>(_parameterDescriptions.size())))
+  const ParameterDescription* returnVal {nullptr};
+  if (within(i, 0, static_cast<int>(_schema->size())))
   {
-    returnVal = _parameterDescriptions[i].get();
+    returnVal = &_schema->getDescription(i);
   }
   return returnVal;
 }
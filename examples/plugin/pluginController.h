@@ -74,8 +74,8 @@ public:
   void reportAllParameterValues();
   Path getParamNameByID(int tag);
   int getParamIDByName(Path p);
-  ParameterDescription* getParamDescriptionByPath(Path paramName);
-  ParameterDescription* getParamDescriptionByIndex(int i);
+  const ParameterDescription* getParamDescriptionByPath(Path paramName);
+  const ParameterDescription* getParamDescriptionByIndex(int i);
   
   DSPBuffer* getSignalFromProcessor(Symbol signalName) { return _signalsFromProcessor[signalName].get(); }
 
@@ -87,9 +87,10 @@ public:
   
 private:
 
-  // this vector contains a description of each parameter in order of ID.
-  // it is filled in by the createPluginParameters() defined for this plugin in parameters.h.
-  std::vector< std::unique_ptr< ParameterDescription > > _parameterDescriptions;
+  // the description and projection of each parameter in order of ID.
+  // it is made from the createPluginParameters() defined for this plugin in parameters.h,
+  // and shared by all instances.
+  std::shared_ptr< const ParameterSchema > _schema{ getPluginParameterSchema() };
   
   // this vector of values is the plugin's current state.
   std::vector< ml::Value > _paramValues;
@@ -100,6 +101,9 @@ private:
   
   Tree< int > _paramIDsByName;
   
+  // parameter names and hash for reading the processor's state.
+  parameterState::Layout _stateLayout;
+  
   // signals received from processor for signal viewers, transmitters, etc
   Tree< std::unique_ptr < DSPBuffer > > _signalsFromProcessor;
 
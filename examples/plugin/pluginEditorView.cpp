@@ -701,7 +701,7 @@ void PluginEditorView::processValueChange(ValueChange v)
               {
                 Path fullParamName = concat(senderParam, partialParamName);
                 
-                ParameterDescription* targetParamDescPtr = _controller.getParamDescriptionByPath(fullParamName);
+                const ParameterDescription* targetParamDescPtr = _controller.getParamDescriptionByPath(fullParamName);
                if(targetParamDescPtr)
                {
                 // store a copy of the parameter description we are targeting
@@ -6,6 +6,7 @@
 #include "pluginController.h"
 #include "pluginParameters.h"
 #include "parameters.h"
+#include "MLRealtimeCheck.h"
 
 #include "public.sdk/source/vst/vstaudioprocessoralgo.h"
 #include "pluginterfaces/vst/ivstparameterchanges.h"
@@ -15,6 +16,7 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <math.h>
 #include <iostream>
 
@@ -42,11 +44,22 @@ PluginProcessor::PluginProcessor()
   // register its editor class(the same than used in againentry.cpp)
 	setControllerClass(PluginController::uid);
   
-  // read parameter descriptions from parameters.h
-  createPluginParameters(_parameterDescriptions);
+  _stateLayout = parameterState::Layout(_schema->getNames());
+  _plainParamValues.resize(_schema->size());
   
-  // make normalized <-> real projections
-  createProjections(_parameterDescriptions);
+  _paramIDs.gain = getParamIDByName("gain");
+  _paramIDs.freqL = getParamIDByName("freq_l");
+  _paramIDs.freqR = getParamIDByName("freq_r");
+  _paramIDs.bypass = getParamIDByName("bypass");
+  _paramIDs.lfoRate = getParamIDByName("freq_l/lfo/rate");
+  _paramIDs.lfoAmount = getParamIDByName("freq_l/lfo/amount");
+  
+  // if any parameter processVectors() needs is missing, it makes silence.
+  _paramIDs.valid = true;
+  for(int id : {_paramIDs.gain, _paramIDs.freqL, _paramIDs.freqR, _paramIDs.bypass, _paramIDs.lfoRate, _paramIDs.lfoAmount})
+  {
+    if(id == kInvalidParamID) _paramIDs.valid = false;
+  }
   
   setParameterDefaults();
 }
@@ -95,6 +108,12 @@ tresult PLUGIN_API PluginProcessor::setActive(TBool state)
 
 tresult PLUGIN_API PluginProcessor::process(ProcessData& data)
 {
+  ML_REALTIME_SCOPE;
+  while(_stateValues.elementsAvailable())
+  {
+    StateValue v = _stateValues.pop();
+    _plainParamValues[v.id] = v.value;
+  }
   processParameterChanges(data.inputParameterChanges);
   
   // TODO for instruments
@@ -108,39 +127,35 @@ tresult PLUGIN_API PluginProcessor::process(ProcessData& data)
 tresult PLUGIN_API PluginProcessor::setState(IBStream* state)
 {
   // called when we load a preset, the model has to be reloaded
+  if(!state) return kResultFalse;
   
-  // let's use the Steinberg streaming class
-  IBStreamer streamer(state, kLittleEndian);
-
-  for(auto& p : _parameterDescriptions)
+  // read into a copy so that a failed read leaves the current values alone. Values not
+  // in the state stay NaN and are not sent, so those parameters keep their values.
+  std::vector< float > newValues(_schema->size(), std::numeric_limits< float >::quiet_NaN());
+  if(parameterState::read(state, newValues.data(), _stateLayout) == parameterState::kReadError)
   {
-    Path paramName = p->getTextProperty("name");
-    float fTemp;
-    streamer.readFloat(fTemp);
-    setProperty(paramName, fTemp);
+    return kResultFalse;
   }
   
-std::cout << "PluginProcessor SET STATE: \n";
-dump();
-
+  // the audio thread owns _plainParamValues, so hand the values to it.
+  for(int id = 0; id < int(newValues.size()); ++id)
+  {
+    if(!std::isnan(newValues[id]))
+    {
+      _stateValues.push(StateValue{id, newValues[id]});
+    }
+  }
   return kResultOk;
 }
 
 tresult PLUGIN_API PluginProcessor::getState(IBStream* state)
 {
   // here we need to save the model
-  IBStreamer streamer(state, kLittleEndian);
- 
-  for(auto& p : _parameterDescriptions)
-  {
-    Path paramName = p->getTextProperty("name");
-    streamer.writeFloat(getFloatProperty(paramName));
-  }
-  
-  std::cout << "PluginProcessor GET STATE: \n";
-  dump();
+  if(!state) return kResultFalse;
   
-  return kResultOk;
+  // write the name table too, so the state can be loaded if parameters change.
+  bool OK = parameterState::write(state, _plainParamValues.data(), _stateLayout, true);
+  return OK ? kResultOk : kResultFalse;
 }
 
 tresult PLUGIN_API PluginProcessor::setupProcessing(ProcessSetup& newSetup)
@@ -209,21 +224,18 @@ bool PluginProcessor::processParameterChanges(IParameterChanges* changes)
         
         // TODO sample-accurate, smoothing
         
-//        if (ml::within(id, 0, (int)_parameterDescriptions.size()))
-        if ((id >= 0) && (id < _parameterDescriptions.size()))
+//        if (ml::within(id, 0, (int)_schema->size()))
+        if ((id >= 0) && (id < _schema->size()))
           {
-          ParameterDescription* pDesc = _parameterDescriptions[id].get();
+          const ParameterProjection& projection = _schema->getProjection(id);
           
-          Path paramName = pDesc->getTextProperty("name");
+          Path paramName = _schema->getName(id);
           if(paramName)
           {
             if(paramQueue->getPoint(numPoints - 1, sampleOffset, value) == kResultTrue)
             {
               // convert the normalized value to the real value and set the property.
-              // DEBUG
-              std::cout << "PluginProcessor: setting " << paramName << " to " << pDesc->normalizedToReal(value) << "\n";
-              
-              setProperty(paramName, pDesc->normalizedToReal(value));
+              _plainParamValues[id] = projection.normalizedToReal(value);
             }
           }
         }
@@ -235,19 +247,20 @@ bool PluginProcessor::processParameterChanges(IParameterChanges* changes)
 
 void PluginProcessor::setParameterDefaults()
 {
-  int nParams = _parameterDescriptions.size();
+  int nParams = _schema->size();
   for(int id=0; id < nParams; ++id)
   {
-    ParameterDescription* pDesc = _parameterDescriptions[id].get();
-    Path paramName = pDesc->getTextProperty("name");
-    if(paramName)
-    {
-      float defaultVal = pDesc->getFloatProperty("default");
-      setProperty(paramName, pDesc->normalizedToReal(defaultVal));
-    }
+    float defaultVal = _schema->getNormalizedDefault(id).getFloatValue();
+    _plainParamValues[id] = _schema->getProjection(id).normalizedToReal(defaultVal);
   }
 }
 
+int PluginProcessor::getParamIDByName(Path paramName) const
+{
+  int id = _schema->getID(paramName);
+  return (id >= 0) ? id : kInvalidParamID;
+}
+
 void PluginProcessor::publishSignal(Symbol signalName, int channels, int octavesDown)
 {
   _publishedSignals[signalName] = ml::make_unique< PublishedSignal >(channels, octavesDown);
@@ -321,7 +334,8 @@ void PluginProcessor::processSignals(ProcessData& data)
   float** outputs = reinterpret_cast<float**>(out);
 
   // run buffered processing
-  processBuffer.process(inputs, outputs, data.numSamples, processFn);
+  processBuffer.process(inputs, outputs, data.numSamples,
+                        [this](const DSPVectorArray<kInputChannels>& inputVectors) { return processVectors(inputVectors); });
 
   // test
   // static periodicAction()
@@ -341,13 +355,18 @@ void PluginProcessor::processSignals(ProcessData& data)
 // It is called every time a new buffer of audio is needed.
 DSPVectorArray<kOutputChannels> PluginProcessor::processVectors(const DSPVectorArray<kInputChannels>& inputVectors)
 {
-  float fGain = getFloatProperty("gain");
-  float fFreqL = getFloatProperty("freq_l");
-  float fFreqR = getFloatProperty("freq_r");
-  int bBypass = getFloatProperty("bypass");
+  if(!_paramIDs.valid)
+  {
+    return DSPVectorArray<kOutputChannels>();
+  }
+  
+  float fGain = _plainParamValues[_paramIDs.gain];
+  float fFreqL = _plainParamValues[_paramIDs.freqL];
+  float fFreqR = _plainParamValues[_paramIDs.freqR];
+  int bBypass = _plainParamValues[_paramIDs.bypass];
 
-  float fFreqLLfoRate = getFloatProperty("freq_l/lfo/rate");
-  float fFreqLLfoAmount = getFloatProperty("freq_l/lfo/amount");
+  float fFreqLLfoRate = _plainParamValues[_paramIDs.lfoRate];
+  float fFreqLLfoAmount = _plainParamValues[_paramIDs.lfoAmount];
 
   // testing LFO just sampled once per vector here
   auto lfoOscL = lfoL1(fFreqLLfoRate/_sampleRate);
@@ -11,7 +11,10 @@
 #include "mldsp.h"
 #include "madronalib.h"
 #include "MLPlatform.h"
+#include "MLParameterState.h"
+#include "MLVectorProcessBuffer.h"
 #include "pluginParameters.h"
+#include "parameters.h"
 
 #include "MLDebug.h"
 
@@ -26,7 +29,6 @@ namespace Steinberg {
 namespace Vst {
 namespace llllpluginnamellll {
 
-constexpr int kMaxProcessBlockFrames = 4096;
 constexpr int kInputChannels = 2;
 constexpr int kOutputChannels = 2;
 
@@ -57,20 +59,44 @@ private:
   bool processParameterChanges(IParameterChanges* changes);
   void processSignals(ProcessData& data);
   
-  // this vector contains a description of each parameter in order of ID.
-  // it is filled in by the createPluginParameters() defined for this plugin in parameters.h.
-  std::vector< std::unique_ptr< ParameterDescription > > _parameterDescriptions;
+  // the description and projection of each parameter in order of ID.
+  // it is made from the createPluginParameters() defined for this plugin in parameters.h,
+  // and shared by all instances.
+  std::shared_ptr< const ParameterSchema > _schema{ getPluginParameterSchema() };
   
-  // buffer object to call processVectors from process() calls of arbitrary frame sizes
-  VectorProcessBuffer<kInputChannels, kOutputChannels, kMaxProcessBlockFrames> processBuffer;
+  // current plain (not normalized) parameter values in order of ID.
+  // getState() and setState() copy this in one piece.
+  std::vector< float > _plainParamValues;
+  parameterState::Layout _stateLayout;
+  
+  // values read by setState() on the host's thread, applied by the audio thread at the
+  // start of the next process() call. Room for each parameter to be set twice.
+  struct StateValue
+  {
+    int id;
+    float value;
+  };
+  Queue< StateValue > _stateValues{ _schema->size()*2 };
+  
+  // IDs of the parameters used in processVectors(), looked up once by name.
+  // valid is false if any of them was not found.
+  struct
+  {
+    int gain, freqL, freqR, bypass, lfoRate, lfoAmount;
+    bool valid;
+  } _paramIDs;
+  
+  // returns kInvalidParamID if there is no parameter with the name.
+  static constexpr int kInvalidParamID{-1};
+  int getParamIDByName(Path paramName) const;
+  
+  // buffer object to call processVectors from process() calls of arbitrary frame sizes.
+  // processSignals() passes it a lambda, so the per-vector call is inlined.
+  StaticVectorProcessBuffer<kInputChannels, kOutputChannels> processBuffer;
 
   // declare the processVectors function that will run our DSP in vectors of size kFloatsPerDSPVector
   DSPVectorArray<kOutputChannels> processVectors(const DSPVectorArray<kInputChannels>& inputVectors);
   
-  // set up the function parameter for processBuffer.process()
-  using processFnType = std::function<DSPVectorArray<kOutputChannels>(const DSPVectorArray<kInputChannels>&)>;
-  processFnType processFn{ [&](const DSPVectorArray<kInputChannels> inputVectors) { return processVectors(inputVectors); } };
-  
   float _sampleRate{0.f};
   
   // sine generators.
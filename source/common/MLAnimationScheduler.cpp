@@ -0,0 +1,78 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLAnimationScheduler.h"
+
+#include <algorithm>
+
+#include "MLWidget.h"
+
+namespace ml {
+
+void AnimationScheduler::add(Widget* w)
+{
+  if(w->_scheduled) return;
+  w->_scheduled = true;
+  _active.push_back(w);
+  if(_owner && (_active.size() == 1))
+  {
+    _owner->startAnimating();
+  }
+}
+
+void AnimationScheduler::remove(Widget* w)
+{
+  if(!w->_scheduled) return;
+  w->_scheduled = false;
+  auto it = std::find(_active.begin(), _active.end(), w);
+  if(it == _active.end()) return;
+  if(_iterating)
+  {
+    *it = nullptr;
+  }
+  else
+  {
+    _active.erase(it);
+  }
+}
+
+void AnimationScheduler::animate(int elapsedTimeInMs, DrawContext dc, MessageList& messages)
+{
+  // Widgets may be added or removed while we iterate, so index instead of using
+  // iterators, and skip the slots of removed Widgets.
+  _iterating = true;
+  for(size_t i = 0; i < _active.size(); ++i)
+  {
+    if(Widget* w = _active[i])
+    {
+      w->animateInto(elapsedTimeInMs, dc, messages);
+    }
+  }
+  _iterating = false;
+  removeStopped();
+}
+
+void AnimationScheduler::removeStopped()
+{
+  auto stopped = [](Widget* w) {
+    if(!w) return true;
+    if(w->isAnimating()) return false;
+    w->_scheduled = false;
+    return true;
+  };
+  _active.erase(std::remove_if(_active.begin(), _active.end(), stopped), _active.end());
+}
+
+void AnimationScheduler::clear()
+{
+  for(Widget* w : _active)
+  {
+    if(w) w->_scheduled = false;
+  }
+  _active.clear();
+}
+
+} // namespace ml
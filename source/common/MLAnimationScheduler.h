@@ -0,0 +1,69 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "MLMessage.h"
+
+namespace ml {
+
+class Widget;
+
+// AnimationScheduler: the set of Widgets in a View that are currently animating.
+// A Widget joins the set by calling startAnimating(), and leaves it after the first
+// animate() call in which it has called stopAnimating(), or when it is deleted. Only
+// the Widgets in the set are animated each frame, so a View where nothing is moving
+// costs nothing to animate.
+//
+// If the scheduler has an owner, the owner is asked to start animating whenever the
+// set becomes non-empty, so a View inside another View keeps getting animate() calls
+// while any of its Widgets need them.
+//
+// All calls must be made on the thread that animates and draws the View.
+
+class AnimationScheduler
+{
+ public:
+  explicit AnimationScheduler(Widget* owner = nullptr) : _owner(owner) {}
+
+  ~AnimationScheduler() { clear(); }
+
+  AnimationScheduler(const AnimationScheduler&) = delete;
+  AnimationScheduler& operator=(const AnimationScheduler&) = delete;
+
+  // add the Widget to the set, if it is not already there.
+  void add(Widget* w);
+
+  // remove the Widget from the set, as when it is deleted. This can be called from
+  // inside animate().
+  void remove(Widget* w);
+
+  // call animateInto() on each Widget in the set, appending their messages to
+  // messages, then remove the Widgets that have stopped animating.
+  void animate(int elapsedTimeInMs, DrawContext dc, MessageList& messages);
+
+  // remove the Widgets that have stopped animating without animating anything.
+  void removeStopped();
+
+  // remove all Widgets, as when the Widgets are about to be deleted.
+  void clear();
+
+  // the number of Widgets currently animating.
+  size_t size() const { return _active.size(); }
+
+ private:
+  Widget* _owner;
+  std::vector< Widget* > _active;
+
+  // true inside animate(), where removed Widgets leave empty slots until the end.
+  bool _iterating{false};
+};
+
+} // namespace ml
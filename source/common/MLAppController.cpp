@@ -36,17 +36,13 @@ AppController::AppController(TextFragment appName, const ParameterDescriptionLis
 #endif
 #endif
   
-  // make parameter descriptions and projections
-  buildParameterTree(pdl, params);
-  setDefaults(params);
-  
-  // store IDs by name and param names by ID
-  for(size_t i=0; i < pdl.size(); ++i)
+  // get parameter descriptions shared by all instances, then make projections and set defaults.
+  _schema = ParameterSchema::getShared(appName, pdl);
+  for(size_t i=0; i < _schema->size(); ++i)
   {
-    ParameterDescription& pd = *pdl[i];
-    Path paramName = pd.getProperty("name").getTextValue();
-    _paramIDsByName[paramName] = i;
-    _paramNamesByID.push_back(paramName);
+    const Path& paramName = _schema->getName(i);
+    params.projections[paramName] = _schema->getProjection(i);
+    params.setFromNormalizedValue(paramName, _schema->getNormalizedDefault(i));
   }
   
   // register and start Actor
@@ -78,7 +74,7 @@ void AppController::broadcastParam(Path pname, uint32_t flags)
 
 void AppController::broadcastParams()
 {
-  for(auto& pname : _paramNamesByID)
+  for(auto& pname : _schema->getNames())
   {
     broadcastParam(pname, kMsgSequenceStart | kMsgSequenceEnd);
   }
@@ -10,6 +10,7 @@
 #include "MLPropertyTree.h"
 #include "MLActor.h"
 #include "MLParameters.h"
+#include "MLParameterSchema.h"
 
 using namespace ml;
 
@@ -40,7 +41,9 @@ public:
 
 protected:
 
-  // parameters of our plugin or application.
+  // parameters of our plugin or application. Descriptions are in the shared
+  // schema; params holds this instance's values and projections.
+  std::shared_ptr< const ParameterSchema > _schema;
   ParameterTree params;
 
   size_t _instanceNum;
@@ -49,9 +52,6 @@ protected:
   Path _processorName;
   
 private:
-  std::vector< ml::Path > _paramNamesByID;
-  Tree< size_t > _paramIDsByName;
-  
   // timers for everyone.
   SharedResourcePointer< ml::Timers > _timers ;
   
@@ -58,14 +58,18 @@ void AppView::viewResized(NativeDrawContext* nvg, Vec2 newSize, float displaySca
   Vec2 origin (0, 0);
   _GUICoordinates = {gridSizeInPixels, newSize, displayScale, origin};
   
+  // text is measured in pixels, so measurements at the old size won't be used again.
+  _resources.textLayouts.clear();
+  
   // set bounds for top-level View in grid coordinates
   Vec4 newGridSize = _GUICoordinates.pixelToGrid(_GUICoordinates.viewSizeInPixels);
   _view->setBounds({0, 0, newGridSize.x(), newGridSize.y()});
   
   layoutFixedSizeWidgets_();
   
-  DrawContext dc{nvg, &_resources, &_drawingProperties, _GUICoordinates};
+  DrawContext dc{nvg, &_resources, &_drawingProperties, _GUICoordinates, updateTheme_()};
   layoutView(dc);
+  prewarmGlyphs_();
   
   _view->setDirty(true);
 }
@@ -74,24 +78,68 @@ void AppView::layoutFixedSizeWidgets_()
 {
   // fixed size widgets are measured in pixels, so they need their grid-based sizes recalculated
   // when the view dims change.
+  std::vector< Widget* > fixedWidgets;
+  std::vector< ml::Rect > fixedBounds;
+  Vec2 systemViewSize = _GUICoordinates.pixelToSystem(_GUICoordinates.viewSizeInPixels);
   forEach< Widget >
   (_view->_widgets, [&](Widget& w)
    {
     if(w.getProperty("fixed_size"))
     {
       // get anchor point for widget in system coords from anchor param on (0, 1)
-      Vec2 systemViewSize = _GUICoordinates.pixelToSystem(_GUICoordinates.viewSizeInPixels);
       Vec2 systemAnchor = matrixToVec2(w.getProperty("anchor").getMatrixValue());
       systemAnchor = systemAnchor * systemViewSize;
       
       // fixed widget bounds are in system coords (for same apparent size)
-      Vec4 systemWidgetBounds = w.getRectProperty("fixed_bounds");
-      systemWidgetBounds = translate(systemWidgetBounds, systemAnchor);
-      ml::Rect gridWidgetBounds = _GUICoordinates.systemToGrid(systemWidgetBounds);
-      w.setBounds(gridWidgetBounds);
+      ml::Rect systemWidgetBounds = w.getRectProperty("fixed_bounds");
+      fixedWidgets.push_back(&w);
+      fixedBounds.push_back(translate(systemWidgetBounds, systemAnchor));
     }
   }
    );
+  
+  // convert all the bounds to grid coords in one batch.
+  _GUICoordinates.systemToGrid(fixedBounds.data(), fixedBounds.data(), fixedBounds.size());
+  for(size_t i = 0; i < fixedWidgets.size(); ++i)
+  {
+    fixedWidgets[i]->setBounds(fixedBounds[i]);
+  }
+}
+
+const Theme* AppView::updateTheme_()
+{
+  if(_theme.version != _drawingPropertiesVersion)
+  {
+    _theme = makeTheme(_drawingProperties, _drawingPropertiesVersion);
+  }
+  return &_theme;
+}
+
+void AppView::prewarmGlyphs_()
+{
+  // start making the glyphs of the widgets' text once the first layout sets the grid size.
+  // Exact sizes only matter for bitmap glyphs; with SDF text any size will do.
+  auto& glyphs = _resources.glyphCache;
+  if(!glyphs || glyphs->isStarted()) return;
+  
+  float gridSizeInPixels = _GUICoordinates.gridSizeInPixels;
+  auto addWidgetText = [&](Widget& w)
+  {
+    auto font = _resources.fonts[Path(w.getTextPropertyWithDefault("font", "d_din"))];
+    if(!font) return;
+    float textSize = gridSizeInPixels*w.getFloatPropertyWithDefault("text_size", 0.25f);
+    if(w.hasProperty("text"))
+    {
+      glyphs->addText(font->handle, textSize, w.getTextProperty("text").getText());
+    }
+    if(w.hasProperty("param"))
+    {
+      glyphs->addText(font->handle, textSize, "0123456789.-+%");
+    }
+  };
+  forEach< Widget >(_view->_widgets, addWidgetText);
+  forEach< Widget >(_view->_backgroundWidgets, addWidgetText);
+  glyphs->start();
 }
 
 void AppView::_updateParameterDescription(const ParameterDescriptionList& pdl, Path pname)
@@ -121,20 +169,21 @@ void AppView::_setupWidgets(const ParameterDescriptionList& pdl)
   _widgetsByCollection.clear();
   _widgetsBySignal.clear();
 
+  // get the parameter schema shared by all instances of this app.
+  _schema = ParameterSchema::getShared(appName_, pdl);
+
   // build index of widgets by parameter.
   // for each parameter, collect Widgets responding to it
-  // and add the parameter to the Widget's param tree.
-  for(auto& paramDesc : pdl)
+  // and point the Widget at the parameter's shared description.
+  for(auto& paramName : _schema->getNames())
   {
-    Path paramName = paramDesc->getTextProperty("name");
-    
     forEach< Widget >
     (_view->_widgets, [&](Widget& w)
      {
       if(w.knowsParam(paramName))
       {
         _widgetsByParameter[paramName].push_back(&w);
-        w.setParameterDescription(paramName, *paramDesc);
+        w.setParameterSchema(paramName, _schema.get());
       }
     }
      );
@@ -182,12 +231,17 @@ void AppView::_setupWidgets(const ParameterDescriptionList& pdl)
   // parameter description(s) and before it is animated or drawn.
   for(auto& w : _view->_widgets)
   {
+    w->_timers = &_timerWheel;
+    w->_tweens = &_tweens;
     w->setupParams();
   }
 }
 
 void AppView::clearWidgets()
 {
+  // the View must not animate the Widgets after they are deleted.
+  _view->resetAnimation();
+  _tweens.clear();
   _rootWidgets.clear();
 }
 
@@ -209,7 +263,9 @@ void AppView::_handleGUIEvents()
     
     // The top-level processGUIEvent call.
     // Send input events to all Widgets in our View and handle any resulting messages.
-    enqueueMessageList(_view->processGUIEvent(_GUICoordinates, gridEvent));
+    _eventMessages.clear();
+    _view->processGUIEventInto(_GUICoordinates, gridEvent, _eventMessages);
+    enqueueMessageList(_eventMessages);
     handleMessagesInQueue();
   }
 }
@@ -270,21 +326,21 @@ GUIEvent AppView::_detectDoubleClicks(GUIEvent e)
   
   if(e.type == "up")
   {
-    if(_doubleClickTimer.isActive())
+    if(_doubleClickDeadline.isActive())
     {
       if(magnitude(Vec2(systemPosition - _doubleClickStartPosition)) < kDoubleClickRadius)
       {
         // fake command modifier?
         r.keyFlags |= commandModifier;
-        _doubleClickTimer.stop();
+        _doubleClickDeadline.cancel();
       }
     }
     else
     {
       _doubleClickStartPosition = systemPosition;
       
-      // timer doesn't need to execute anything, just expire.
-      _doubleClickTimer.callOnce( [](){}, milliseconds(kDoubleClickMs) );
+      // the deadline doesn't need to do anything, just expire.
+      _timerWheel.schedule(_doubleClickDeadline, kDoubleClickMs);
     }
   }
   return r;
@@ -301,6 +357,18 @@ Vec2 AppView::constrainSize(Vec2 size) const
     return newSize;
 }
 
+void AppView::createResources(NativeDrawContext* nvg)
+{
+  initializeResources(nvg);
+  _resources.newGeneration();
+}
+
+void AppView::releaseResources()
+{
+  clearResources();
+  _resources.newGeneration();
+}
+
 size_t AppView::_getElapsedTime()
 {
   // return time elapsed since last render
@@ -314,16 +382,30 @@ void AppView::animate(NativeDrawContext* nvg)
 {
     // Allow Widgets to draw any needed animations outside of main nvgBeginFrame().
     // Do animations and handle any resulting messages immediately.
-    DrawContext dc{nvg, &_resources, &_drawingProperties, _GUICoordinates };
-    MessageList ml = _view->animate((int)_getElapsedTime(), dc);
-    enqueueMessageList(ml);
+    DrawContext dc{nvg, &_resources, &_drawingProperties, _GUICoordinates, updateTheme_() };
+    size_t elapsedTime = _getElapsedTime();
+    
+    // call any deadlines that have come due, so Widgets they start animating are
+    // animated in this frame, and set any tweened properties before the Widgets see them.
+    _timerWheel.advance(elapsedTime);
+    _tweens.advance((int)elapsedTime);
+    
+    _animationMessages.clear();
+    _view->animateInto((int)elapsedTime, dc, _animationMessages);
+    enqueueMessageList(_animationMessages);
     handleMessagesInQueue();
 }
 
 void AppView::render(NativeDrawContext* nvg)
 {
   // TODO move resource types into Renderer, DrawContext points to Renderer
-  DrawContext dc{nvg, &_resources, &_drawingProperties, _GUICoordinates};
+  DrawContext dc{nvg, &_resources, &_drawingProperties, _GUICoordinates, updateTheme_()};
+  
+  // install any glyphs made ahead of time before text is drawn.
+  if(_resources.glyphCache) _resources.glyphCache->update();
+
+  // shadow images removed in the last frame are no longer in use.
+  if(_resources.shadowCache) _resources.shadowCache->beginFrame();
 
   auto layerSize = _GUICoordinates.viewSizeInPixels;
   if((layerSize.x() == 0) || (layerSize.y() == 0))
@@ -10,6 +10,10 @@
 #include "MLActor.h"
 #include "MLDrawContext.h"
 #include "MLGUIEvent.h"
+#include "MLParameterSchema.h"
+#include "MLResourceCache.h"
+#include "MLTimerWheel.h"
+#include "MLTweenEngine.h"
 #include "MLView.h"
 #include "MLWidget.h"
 
@@ -19,6 +23,12 @@ class AppView : public Actor
 {
 public:
   
+  // initialize or clear the resources with initializeResources() or clearResources(),
+  // then start a new generation of resources, so that Widgets holding ResourceHandles
+  // find the new ones. Callers use these rather than calling the hooks directly.
+  void createResources(NativeDrawContext* nvg);
+  void releaseResources();
+  
   // pure virtual methods that subclasses must implement:
   //
   // initialize resources such as images, needed to draw the View.
@@ -82,9 +92,35 @@ protected:
   
   // main view and top-level things.
   // order is important for default destructor!
+  
+  // parameter descriptions shared with other instances and pointed to by our Widgets.
+  std::shared_ptr< const ParameterSchema > _schema;
   std::unique_ptr< ml::View > _view;
   DrawingResources _resources;
+  SharedResourcePointer< ResourceCache > _resourceCache;
+  
+  // set a drawing property. Widgets see the new value from the next DrawContext.
+  void setDrawingProperty(Path p, Value v)
+  {
+    _drawingProperties.setProperty(p, v);
+    _drawingPropertiesVersion++;
+  }
+  const PropertyTree& getDrawingProperties() const { return _drawingProperties; }
+  
+private:
+  
+  // the drawing properties, changed only by setDrawingProperty() so that the version
+  // changes with them, and the Theme Widgets read, made again when the version changes.
   PropertyTree _drawingProperties;
+  uint32_t _drawingPropertiesVersion{1};
+  Theme _theme;
+  
+protected:
+  
+  // Messages from Widgets, kept between frames so that their storage is reused.
+  MessageList _eventMessages;
+  MessageList _animationMessages;
+  
   ParameterTree _params;
   
   // Actors
@@ -114,9 +150,18 @@ protected:
   // timing
   time_point< system_clock > _previousFrameTime;
   Timer _ioTimer;
-  Timer _doubleClickTimer;
   Timer _animationTimer;
   Timer _debugTimer;
+  
+  // deadlines for Widgets and for ourself, advanced once per frame in animate().
+  // The Widgets' Deadlines cancel themselves when the Widgets are deleted, so this
+  // must be declared before _rootWidgets.
+  TimerWheel _timerWheel;
+  TimerWheel::Deadline _doubleClickDeadline{ [](){} };
+  
+  // property tweens for Widgets, also advanced once per frame. The Widgets release
+  // their slots when they are deleted, so this must also be declared before _rootWidgets.
+  TweenEngine _tweens;
   int guiToResizeCounter{0};
   
   // GUI Events
@@ -138,6 +183,8 @@ protected:
   
   size_t _getElapsedTime();
   void layoutFixedSizeWidgets_();
+  const Theme* updateTheme_();
+  void prewarmGlyphs_();
   
   // here is where all the Widgets are stored. Other instances of Collection < Widget >
   // may reference this.
@@ -304,6 +304,177 @@ void nvgDrawSVG(NVGcontext *vg, NSVGimage *svg)
   //DEBUG_ONLY(printf("\n");)
 }
 
+void drawVectorImage(const DrawContext& dc, const VectorImage* image, Rect bounds)
+{
+  if(!image || !image->_prepared) return;
+  NativeDrawContext* nvg = getNativeContext(dc);
+
+  // get max rectangle for SVG image
+  float imageAspect = image->width/image->height;
+  float boundsAspect = bounds.width()/bounds.height();
+  float imgScale;
+  Vec2 imageSize{image->width, image->height};
+
+  if(imageAspect >= boundsAspect)
+  {
+    imgScale = bounds.width()/imageSize.x();
+  }
+  else
+  {
+    imgScale = bounds.height()/imageSize.y();
+  }
+
+  Vec2 drawSize = imageSize*imgScale;
+  Vec2 topLeft = getCenter(bounds) - drawSize/2;
+
+  // drawing coordinates are in pixels, so this is the exact size of the raster needed.
+  int iconWidth = (int)std::round(drawSize.x());
+  int iconHeight = (int)std::round(drawSize.y());
+  IconCache* icons = dc.pResources->iconCache.get();
+  int icon = icons ? icons->getIcon(image->_prepared.get(), iconWidth, iconHeight) : 0;
+
+  if(icon)
+  {
+    // draw on whole pixels so the raster is not resampled.
+    float x = std::round(topLeft.x());
+    float y = std::round(topLeft.y());
+    NVGpaint paint = nvgImagePattern(nvg, x, y, iconWidth, iconHeight, 0, icon, 1.0f);
+    nvgBeginPath(nvg);
+    nvgRect(nvg, x, y, iconWidth, iconHeight);
+    nvgFillPaint(nvg, paint);
+    nvgFill(nvg);
+  }
+  else
+  {
+    nvgSave(nvg);
+    nvgTranslate(nvg, topLeft);
+    nvgScale(nvg, imgScale, imgScale);
+    nvgDrawSVG(nvg, image->_prepared.get());
+    nvgRestore(nvg);
+  }
+}
+
+void drawShadowArc(NativeDrawContext* nvg, float a0, float a1, float r0, float r1, NVGcolor shadowColor, float alpha)
+{
+  auto r2Alpha = projections::intervalMap({ r0, r1 }, { alpha, 0.f }, projections::easeOutCubic);
+  nvgStrokeWidth(nvg, 1.0f);
+  if (r1 > r0)
+  {
+    for (float r = r0; r < r1; r += 1.0f)
+    {
+      auto c = multiplyAlpha(shadowColor, r2Alpha(r));
+      if (c.a < kMinVisibleAlpha) break;
+      nvgStrokeColor(nvg, c);
+      nvgBeginPath(nvg);
+      nvgArc(nvg, 0, 0, r, a0, a1, NVG_CW);
+      nvgStroke(nvg);
+    }
+  }
+  else
+  {
+    for (float r = r0; r > r1; r -= 1.0f)
+    {
+      auto c = multiplyAlpha(shadowColor, r2Alpha(r));
+      if (c.a < kMinVisibleAlpha) break;
+      nvgStrokeColor(nvg, c);
+      nvgBeginPath(nvg);
+      nvgArc(nvg, 0, 0, r, a0, a1, NVG_CW);
+      nvgStroke(nvg);
+    }
+  }
+}
+
+void drawShadowLine(NativeDrawContext* nvg, Vec2 p1, Vec2 p2, float r1, NVGcolor shadowColor, float alpha)
+{
+  float dx = p2.x() - p1.x();
+  float dy = p2.y() - p1.y();
+  Vec2 p3(dy, -dx);
+  Vec2 p3u = p3 / magnitude(p3);
+  
+  if (r1 < 0.f)
+  {
+    r1 = -r1;
+    p3u = -p3u;
+  }
+  
+  auto r2Alpha = projections::intervalMap({ 0.f, r1 }, { alpha, 0.f }, projections::easeOutCubic);
+  nvgStrokeWidth(nvg, 1.0f);
+  
+  for (float r = 0.f; r < r1; r += 1.0f)
+  {
+    auto c = multiplyAlpha(shadowColor, r2Alpha(r));
+    if (c.a < kMinVisibleAlpha) break;
+    nvgStrokeColor(nvg, c);
+    nvgBeginPath(nvg);
+    
+    Vec2 p1r = p1 + p3u * r;
+    Vec2 p2r = p2 + p3u * r;
+    
+    nvgMoveTo(nvg, p1r.x(), p1r.y());
+    nvgLineTo(nvg, p2r.x(), p2r.y());
+    nvgStroke(nvg);
+  }
+}
+
+void drawCircleShadow(NativeDrawContext* nvg, Vec2 center, float r0, float r1, NVGcolor shadowColor, float alpha)
+{
+  auto r2Alpha = projections::intervalMap({ r0, r1 }, { alpha, 0.f }, projections::easeOutCubic);
+  nvgStrokeWidth(nvg, 1.0f);
+  for (float r = r0; r < r1; r += 1.0f)
+  {
+    auto c = multiplyAlpha(shadowColor, r2Alpha(r));
+    if (c.a < kMinVisibleAlpha) break;
+    nvgStrokeColor(nvg, c);
+    nvgBeginPath(nvg);
+    nvgCircle(nvg, center.x(), center.y(), r);
+    nvgStroke(nvg);
+  }
+}
+
+void drawRoundRectShadow(NativeDrawContext* nvg, ml::Rect r, int width, int radius, NVGcolor shadowColor, float alpha)
+{
+  auto r2Alpha = projections::intervalMap({ 0, width + 0.f }, { alpha, 0.f }, projections::easeOutCubic);
+  nvgStrokeWidth(nvg, 1);
+  for (int i = 0; i < width; ++i)
+  {
+    auto c = multiplyAlpha(shadowColor, r2Alpha(i));
+    if (c.a < kMinVisibleAlpha) break;
+    auto br = grow(r, i);
+    nvgBeginPath(nvg);
+    nvgRoundedRect(nvg, br, radius + i);
+    nvgStrokeColor(nvg, c);
+    nvgStroke(nvg);
+  }
+}
+
+void drawShadowArc(const DrawContext& dc, float a0, float a1, float r0, float r1, NVGcolor shadowColor, float alpha)
+{
+  ShadowCache* shadows = dc.pResources ? dc.pResources->shadowCache.get() : nullptr;
+  if(shadows && shadows->drawArc(0, 0, a0, a1, r0, r1, multiplyAlpha(shadowColor, alpha))) return;
+  drawShadowArc(getNativeContext(dc), a0, a1, r0, r1, shadowColor, alpha);
+}
+
+void drawShadowLine(const DrawContext& dc, Vec2 p1, Vec2 p2, float r1, NVGcolor shadowColor, float alpha)
+{
+  ShadowCache* shadows = dc.pResources ? dc.pResources->shadowCache.get() : nullptr;
+  if(shadows && shadows->drawLine(p1.x(), p1.y(), p2.x(), p2.y(), r1, multiplyAlpha(shadowColor, alpha))) return;
+  drawShadowLine(getNativeContext(dc), p1, p2, r1, shadowColor, alpha);
+}
+
+void drawCircleShadow(const DrawContext& dc, Vec2 center, float r0, float r1, NVGcolor shadowColor, float alpha)
+{
+  ShadowCache* shadows = dc.pResources ? dc.pResources->shadowCache.get() : nullptr;
+  if(shadows && shadows->drawCircle(center.x(), center.y(), r0, r1, multiplyAlpha(shadowColor, alpha))) return;
+  drawCircleShadow(getNativeContext(dc), center, r0, r1, shadowColor, alpha);
+}
+
+void drawRoundRectShadow(const DrawContext& dc, ml::Rect r, int width, int radius, NVGcolor shadowColor, float alpha)
+{
+  ShadowCache* shadows = dc.pResources ? dc.pResources->shadowCache.get() : nullptr;
+  if(shadows && shadows->drawRoundRect(r.left(), r.top(), r.width(), r.height(), radius, width, multiplyAlpha(shadowColor, alpha))) return;
+  drawRoundRectShadow(getNativeContext(dc), r, width, radius, shadowColor, alpha);
+}
+
 
 Rect floatToSide(Rect fixedRect, Rect floatingRect, float margin, float windowWidth, float windowHeight, Symbol side)
 {
@@ -445,5 +616,56 @@ void drawTextBox(NativeDrawContext* nvg, Vec2 location, float rowWidth, ml::Text
   nvgTextBox(nvg, tx - (rowWidth*0.5f), ty - vOffset, rowWidth, chars, nullptr);
 }
 
+void drawTextToFit(NativeDrawContext* nvg, TextLayoutCache& cache, int fontID, const ml::Text& t, Vec2 location, float desiredSize, float spacing, float width, int align)
+{
+  nvgFontFaceId(nvg, fontID);
+  float fittedSize = cache.getFittedSize(nvg, t.getText(), fontID, desiredSize, spacing, width);
+  
+  nvgFontSize(nvg, fittedSize);
+  nvgTextLetterSpacing(nvg, fittedSize*spacing);
+  drawText(nvg, location, t, align);
+}
+
+void drawTextBox(NativeDrawContext* nvg, TextLayoutCache& cache, int fontID, float fontSize, float letterSpacing, Vec2 location, float rowWidth, const ml::Text& t, int align)
+{
+  constexpr float kLineHeight{1.25f};
+  nvgFontFaceId(nvg, fontID);
+  nvgFontSize(nvg, fontSize);
+  nvgTextLetterSpacing(nvg, letterSpacing);
+  
+  const char* chars = t.getText();
+  const auto& layout = cache.getLines(nvg, chars, fontID, fontSize, letterSpacing, rowWidth, kLineHeight, align);
+  
+  float tx = roundf(location.x());
+  float ty = roundf(location.y());
+  
+  // offset vertically to center text
+  int totalRows = (int)layout.rows.size();
+  float vOffset = layout.lineHeight*((totalRows - 1)/2.f);
+  
+  // draw the rows as nvgTextBox() does, without breaking the lines again.
+  int hAlign = align & (NVG_ALIGN_LEFT | NVG_ALIGN_CENTER | NVG_ALIGN_RIGHT);
+  int vAlign = align & (NVG_ALIGN_TOP | NVG_ALIGN_MIDDLE | NVG_ALIGN_BOTTOM | NVG_ALIGN_BASELINE);
+  float left = tx - (rowWidth*0.5f);
+  float y = ty - vOffset;
+  
+  nvgTextAlign(nvg, NVG_ALIGN_LEFT | vAlign);
+  for(const auto& row : layout.rows)
+  {
+    float x = left;
+    if(hAlign & NVG_ALIGN_CENTER)
+    {
+      x += rowWidth*0.5f - row.width*0.5f;
+    }
+    else if(hAlign & NVG_ALIGN_RIGHT)
+    {
+      x += rowWidth - row.width;
+    }
+    nvgText(nvg, x, y, chars + row.start, chars + row.end);
+    y += layout.lineHeight;
+  }
+  nvgTextAlign(nvg, align);
+}
+
 
 }
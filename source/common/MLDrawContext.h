@@ -60,6 +60,12 @@ using NativeDrawContext = NVGcontext;
 
 #endif
 
+#include "MLGlyphCache.h"
+#include "MLIconCache.h"
+#include "MLPreparedSVG.h"
+#include "MLShadowCache.h"
+#include "MLTextLayoutCache.h"
+
 namespace ml {
 
 constexpr int kTargetFPS{60};
@@ -70,14 +76,27 @@ using ResourceBlob = std::vector< uint8_t >;
 
 struct VectorImage
 {
-  NSVGimage* _pImage{ nullptr };
-  NativeDrawContext* nvg_{ nullptr };
+  // made once at load time from the parsed SVG or the compiled data. The parsed SVG
+  // is only needed to make this, so it is not kept.
+  std::unique_ptr< PreparedSVG > _prepared;
+
   float width{ 0 };
   float height{ 0 };
   
-  VectorImage(NativeDrawContext* nvg, const unsigned char* dataStart, size_t dataBytes) :
-  nvg_(nvg)
+  // the data can be SVG text, or compiled SVG data made by the svgcompiler tool.
+  // Compiled data is used in place with no parsing, so it must outlive the image,
+  // as embedded resources do. The image doesn't depend on the context, so it can be
+  // drawn in any context, and the ResourceCache shares one between contexts.
+  VectorImage(NativeDrawContext*, const unsigned char* dataStart, size_t dataBytes)
   {
+    if(PreparedSVG::isCompiled(dataStart, dataBytes))
+    {
+      _prepared = std::make_unique< PreparedSVG >(dataStart, dataBytes);
+      width = _prepared->width;
+      height = _prepared->height;
+      return;
+    }
+    
     // horribly, nsvgParse will clobber the data it reads! So let's copy that data before parsing.
     // TODO replace nanosvg
     char* pTempData{nullptr};
@@ -85,23 +104,19 @@ struct VectorImage
     if((pTempData = (char*)malloc(dataBytes*2)))
     {
       std::copy_n(dataStart, dataBytes, pTempData);
-      _pImage = nsvgParse(pTempData, "px", 96);
-      if (_pImage)
+      if (NSVGimage* pImage = nsvgParse(pTempData, "px", 96))
       {
-        width = _pImage->width;
-        height = _pImage->height;
+        width = pImage->width;
+        height = pImage->height;
+        _prepared = std::make_unique< PreparedSVG >(pImage);
+        nsvgDelete(pImage);
       }
     }
     
     free(pTempData);
   }
   
-  ~VectorImage()
-  {
-    if (_pImage) { nsvgDelete(_pImage); }
-  }
-  
-  explicit operator bool() const { return (_pImage != nullptr); }
+  explicit operator bool() const { return (_prepared != nullptr); }
 };
 
 
@@ -177,6 +192,22 @@ public:
       nvgImageSize(nvg_, handle, &width, &height);
     }
   }
+
+  // an image of w x h RGBA pixels, for Widgets that update its contents themselves.
+  RasterImage(NativeDrawContext* nvg, int w, int h, int flags, const unsigned char* pixels) :
+  nvg_(nvg)
+  {
+    handle = nvgCreateImageRGBA(nvg_, w, h, flags, pixels);
+    if (handle)
+    {
+      width = w;
+      height = h;
+    }
+    else
+    {
+      handle = -1;
+    }
+  }
   ~RasterImage()
   {
     if ((handle != -1) && (nvg_))
@@ -212,16 +243,64 @@ struct FontResource
 
 
 
-// DrawingResources holds all the resources owned by a View. Any resource is available
-// to a View and its subviews.
+// DrawingResources holds all the resources used by a View. Any resource is available
+// to a View and its subviews. Vector images, raster images and fonts may be shared
+// with other Views through the ResourceCache. If there is an iconCache, small vector
+// images are drawn from rasters made at their exact pixel sizes. If there is a glyphCache,
+// the glyphs of the view's text are made before its first paint. If there is a
+// shadowCache, shadows are drawn from images of their falloff. textLayouts holds
+// measured text for the cached text drawing functions.
 
 struct DrawingResources
 {
   Tree< std::unique_ptr< ResourceBlob > > blobs;
-  Tree< std::unique_ptr< VectorImage > > vectorImages;
+  Tree< std::shared_ptr< VectorImage > > vectorImages;
   Tree< std::unique_ptr< DrawableImage > > drawableImages;
-  Tree< std::unique_ptr< RasterImage > > rasterImages;
-  Tree< std::unique_ptr< FontResource > > fonts;
+  Tree< std::shared_ptr< RasterImage > > rasterImages;
+  Tree< std::shared_ptr< FontResource > > fonts;
+  std::unique_ptr< IconCache > iconCache;
+  std::unique_ptr< GlyphCache > glyphCache;
+  std::unique_ptr< ShadowCache > shadowCache;
+  TextLayoutCache textLayouts;
+
+  // offscreen layers that Widgets draw the unchanging parts of themselves into, keyed by
+  // a hash of what is drawn, so that Widgets drawing the same parts share one layer.
+  // users counts the Widgets drawing from each layer, and the last one to let go of a
+  // layer removes it.
+  struct SharedLayer
+  {
+    std::unique_ptr< DrawableImage > image;
+    int users{0};
+  };
+  std::map< uint64_t, SharedLayer > sharedLayers;
+
+  // images that Widgets upload pixels to, keyed by Widget.
+  std::map< const void*, std::unique_ptr< RasterImage > > widgetImages;
+
+  // changed whenever resources are added or removed, so that any ResourceHandles
+  // look their resources up again. AppView::createResources() and
+  // AppView::releaseResources() call newGeneration().
+  uint32_t generation{0};
+  void newGeneration() { generation++; }
+};
+
+// Theme: the drawing properties that Widgets read on every draw, converted once from
+// the drawing property tree. The AppView makes a new Theme only when its drawing
+// properties have changed, and the version tells which change it was made from.
+// Properties not set have the same values the getters below would return.
+
+struct Theme
+{
+  NVGcolor mark{};
+  NVGcolor markBright{};
+  NVGcolor background{};
+  NVGcolor panelBackground{};
+  NVGcolor track{};
+  float commonStrokeWidth{0};
+  bool drawBackgroundGrid{false};
+  bool drawWidgetBounds{false};
+  bool drawDirtyWidgets{false};
+  uint32_t version{0};
 };
 
 // To draw a frame, animate a frame, or layout the view, views create a DrawContext that is passed to
@@ -232,6 +311,11 @@ struct DrawContext
   DrawingResources* pResources;
   PropertyTree* pProperties;
   GUICoordinates coords;
+  const Theme* pTheme{nullptr};
+
+  // when a View redraws only part of a Widget, that part in the Widget's local pixel
+  // coordinates. Empty when the whole Widget is drawn.
+  Rect redrawRect{};
 };
 
 inline NativeDrawContext* getNativeContext(const DrawContext& dc) { return static_cast<NativeDrawContext*>(dc.pNativeContext); }
@@ -303,6 +387,45 @@ inline DrawableImage* getDrawableImage(const DrawContext& dc, Path name)
   }
 }
 
+// ResourceHandle: a resource a Widget has found by name, kept so that drawing doesn't
+// parse and look up the name each time. The name is made and looked up on the first
+// get() and again only after the resources change generation. A resource that is not
+// found stays null until then.
+//
+// Typical use in a Widget's draw():
+//   auto font = _font.get(dc, [&]() { return Path(getTextPropertyWithDefault("font", "d_din")); });
+
+template< typename T, T* (*lookup)(const DrawContext&, Path) >
+class ResourceHandle
+{
+ public:
+  template< typename MakeName >
+  T* get(const DrawContext& dc, MakeName makeName)
+  {
+    if(!_valid || (_generation != dc.pResources->generation))
+    {
+      _resource = lookup(dc, makeName());
+      _generation = dc.pResources->generation;
+      _valid = true;
+    }
+    return _resource;
+  }
+
+  // look the resource up again on the next get(), for instance after the property
+  // naming it has changed.
+  void reset() { _valid = false; }
+
+ private:
+  T* _resource{nullptr};
+  uint32_t _generation{0};
+  bool _valid{false};
+};
+
+using VectorImageHandle = ResourceHandle< VectorImage, getVectorImage >;
+using FontHandle = ResourceHandle< FontResource, getFontResource >;
+using RasterImageHandle = ResourceHandle< RasterImage, getRasterImage >;
+using DrawableImageHandle = ResourceHandle< DrawableImage, getDrawableImage >;
+
 
 // nanovg + mlvg helpers
 
@@ -530,6 +653,11 @@ void drawTextToFit(NativeDrawContext* nvg, const ml::Text& t, Vec2 location, flo
 // draw a multi-line text, using whatever algorithm nanovg uses for line breaking
 void drawTextBox(NativeDrawContext* nvg, Vec2 location, float rowWidth, ml::Text t, int align = NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
 
+// versions of the above that get their measurements from a TextLayoutCache instead of
+// measuring the text on each draw. They set the font face, size and spacing.
+void drawTextToFit(NativeDrawContext* nvg, TextLayoutCache& cache, int fontID, const ml::Text& t, Vec2 location, float desiredSize, float spacing, float width, int align);
+void drawTextBox(NativeDrawContext* nvg, TextLayoutCache& cache, int fontID, float fontSize, float letterSpacing, Vec2 location, float rowWidth, const ml::Text& t, int align = NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+
 inline float getNvgLabelKerning(float textSize)
 {
   static auto p(projections::linear({ 0, 128 }, { 0.05f, -0.1f }));
@@ -605,105 +733,23 @@ inline NVGcolor colorWithAlpha(NVGcolor c, float alpha)
 
 
 
-// shadow helpers
+// shadow helpers. These stroke the shadow one pixel at a time. The versions taking a
+// DrawContext draw from images in its shadowCache instead, if it has one.
 
 // draw shadow arc centered at (0, 0)
-inline void drawShadowArc(NativeDrawContext* nvg, float a0, float a1, float r0, float r1, NVGcolor shadowColor, float alpha)
-{
-  auto r2Alpha = projections::intervalMap({ r0, r1 }, { alpha, 0.f }, projections::easeOutCubic);
-  nvgStrokeWidth(nvg, 1.0f);
-  if (r1 > r0)
-  {
-    for (float r = r0; r < r1; r += 1.0f)
-    {
-      auto c = multiplyAlpha(shadowColor, r2Alpha(r));
-      if (c.a < kMinVisibleAlpha) break;
-      nvgStrokeColor(nvg, c);
-      nvgBeginPath(nvg);
-      nvgArc(nvg, 0, 0, r, a0, a1, NVG_CW);
-      nvgStroke(nvg);
-    }
-  }
-  else
-  {
-    for (float r = r0; r > r1; r -= 1.0f)
-    {
-      auto c = multiplyAlpha(shadowColor, r2Alpha(r));
-      if (c.a < kMinVisibleAlpha) break;
-      nvgStrokeColor(nvg, c);
-      nvgBeginPath(nvg);
-      nvgArc(nvg, 0, 0, r, a0, a1, NVG_CW);
-      nvgStroke(nvg);
-    }
-  }
-}
+void drawShadowArc(NativeDrawContext* nvg, float a0, float a1, float r0, float r1, NVGcolor shadowColor, float alpha);
+void drawShadowArc(const DrawContext& dc, float a0, float a1, float r0, float r1, NVGcolor shadowColor, float alpha);
 
 // draw shadow line from p1 -> p2 with thickness r1.
 // use clockwise rule in the 2d plane to place shadow
-inline void drawShadowLine(NativeDrawContext* nvg, Vec2 p1, Vec2 p2, float r1, NVGcolor shadowColor, float alpha)
-{
-  float dx = p2.x() - p1.x();
-  float dy = p2.y() - p1.y();
-  Vec2 p3(dy, -dx);
-  Vec2 p3u = p3 / magnitude(p3);
-  
-  if (r1 < 0.f)
-  {
-    r1 = -r1;
-    p3u = -p3u;
-  }
-  
-  auto r2Alpha = projections::intervalMap({ 0.f, r1 }, { alpha, 0.f }, projections::easeOutCubic);
-  nvgStrokeWidth(nvg, 1.0f);
-  
-  for (float r = 0.f; r < r1; r += 1.0f)
-  {
-    auto c = multiplyAlpha(shadowColor, r2Alpha(r));
-    if (c.a < kMinVisibleAlpha) break;
-    nvgStrokeColor(nvg, c);
-    nvgBeginPath(nvg);
-    
-    Vec2 p1r = p1 + p3u * r;
-    Vec2 p2r = p2 + p3u * r;
-    
-    nvgMoveTo(nvg, p1r.x(), p1r.y());
-    nvgLineTo(nvg, p2r.x(), p2r.y());
-    nvgStroke(nvg);
-    
-    std::cout << "o: " << c.a << "\n";
-  }
-}
+void drawShadowLine(NativeDrawContext* nvg, Vec2 p1, Vec2 p2, float r1, NVGcolor shadowColor, float alpha);
+void drawShadowLine(const DrawContext& dc, Vec2 p1, Vec2 p2, float r1, NVGcolor shadowColor, float alpha);
 
-inline void drawCircleShadow(NativeDrawContext* nvg, Vec2 center, float r0, float r1, NVGcolor shadowColor, float alpha)
-{
-  auto r2Alpha = projections::intervalMap({ r0, r1 }, { alpha, 0.f }, projections::easeOutCubic);
-  nvgStrokeWidth(nvg, 1.0f);
-  for (float r = r0; r < r1; r += 1.0f)
-  {
-    auto c = multiplyAlpha(shadowColor, r2Alpha(r));
-    if (c.a < kMinVisibleAlpha) break;
-    nvgStrokeColor(nvg, c);
-    nvgBeginPath(nvg);
-    nvgCircle(nvg, center.x(), center.y(), r);
-    nvgStroke(nvg);
-  }
-}
+void drawCircleShadow(NativeDrawContext* nvg, Vec2 center, float r0, float r1, NVGcolor shadowColor, float alpha);
+void drawCircleShadow(const DrawContext& dc, Vec2 center, float r0, float r1, NVGcolor shadowColor, float alpha);
 
-inline void drawRoundRectShadow(NativeDrawContext* nvg, ml::Rect r, int width, int radius, NVGcolor shadowColor, float alpha)
-{
-  auto r2Alpha = projections::intervalMap({ 0, width + 0.f }, { alpha, 0.f }, projections::easeOutCubic);
-  nvgStrokeWidth(nvg, 1);
-  for (int i = 0; i < width; ++i)
-  {
-    auto c = multiplyAlpha(shadowColor, r2Alpha(i));
-    if (c.a < kMinVisibleAlpha) break;
-    auto br = grow(r, i);
-    nvgBeginPath(nvg);
-    nvgRoundedRect(nvg, br, radius + i);
-    nvgStrokeColor(nvg, c);
-    nvgStroke(nvg);
-  }
-}
+void drawRoundRectShadow(NativeDrawContext* nvg, ml::Rect r, int width, int radius, NVGcolor shadowColor, float alpha);
+void drawRoundRectShadow(const DrawContext& dc, ml::Rect r, int width, int radius, NVGcolor shadowColor, float alpha);
 
 // draw a centered grid over the given Rect, with the current stroke width and color.
 
@@ -735,6 +781,10 @@ inline void drawGrid(NativeDrawContext* nvg, float gridSizeInPixels, Rect bounds
 
 void nvgDrawSVG(NVGcontext* vg, NSVGimage* svg);
 
+// draw the image centered in bounds, as large as it will fit. A raster from the
+// IconCache is drawn if the context has one and it's ready, otherwise vectors.
+void drawVectorImage(const DrawContext& dc, const VectorImage* image, Rect bounds);
+
 Rect floatToSide(Rect fixedRect, Rect floatingRect, float margin, float windowWidth, float windowHeight, Symbol side);
 
 // float rect floatingRect near a side of fixedRect with a margin between them, constrained in the windowRect if possible.
@@ -751,6 +801,32 @@ inline NVGcolor getColorWithDefault(DrawContext t, Path p, NVGcolor r) { return
 
 inline NVGcolor lerp(NVGcolor a, NVGcolor b, float mix) { return nvgLerpRGBA(a, b, mix); }
 
+inline Theme makeTheme(const PropertyTree& p, uint32_t version)
+{
+  Theme t;
+  t.mark = matrixToColor(p.getMatrixProperty("mark"));
+  t.markBright = matrixToColor(p.getMatrixProperty("mark_bright"));
+  t.background = matrixToColor(p.getMatrixProperty("background"));
+  t.panelBackground = matrixToColor(p.getMatrixProperty("panel_bg"));
+  t.track = matrixToColor(p.getMatrixProperty("track"));
+  t.commonStrokeWidth = p.getFloatProperty("common_stroke_width");
+  t.drawBackgroundGrid = p.getBoolPropertyWithDefault("draw_background_grid", false);
+  t.drawWidgetBounds = p.getBoolPropertyWithDefault("draw_widget_bounds", false);
+  t.drawDirtyWidgets = p.getBoolPropertyWithDefault("draw_dirty_widgets", false);
+  t.version = version;
+  return t;
+}
+
+// the context's Theme, or one made from its properties if it has none. The one made is
+// kept per thread, and replaced by the next call for a context without a Theme.
+inline const Theme& getTheme(const DrawContext& dc)
+{
+  if(dc.pTheme) return *dc.pTheme;
+  thread_local Theme madeTheme;
+  madeTheme = makeTheme(*dc.pProperties, 0);
+  return madeTheme;
+}
+
 // void setColorProperty(Path p, NVGcolor r) { setProperty(p, colorToMatrix(r)); }
 
 
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 #include "MLDrawContext.h"
 
 namespace ml
@@ -61,6 +64,49 @@ struct GUICoordinates
   {
     return pixelToSystem(gridToPixel(gc));
   }
+
+  // batch versions, for transforming the bounds of many Widgets at once. Each takes
+  // n Rects, Vec2s or Vec4s from src and writes them to dest, which may be the same
+  // as src. The scale and origin are loaded once, and the divisions by the grid size
+  // are multiplications by its reciprocal, so results may differ from the single
+  // versions in the last bit.
+
+  template< class T >
+  void gridToPixel(const T* src, T* dest, size_t n) const
+  {
+    static_assert(std::is_base_of< MLVec, T >::value && sizeof(T) == sizeof(MLVec), "T must be an MLVec");
+    math2D::Reg scale = math2D::splat(gridSizeInPixels);
+    math2D::Reg o = origin.getReg();
+    for(size_t i = 0; i < n; ++i)
+    {
+      dest[i].setReg(math2D::add(math2D::mul(src[i].getReg(), scale), o));
+    }
+  }
+
+  template< class T >
+  void pixelToGrid(const T* src, T* dest, size_t n) const
+  {
+    static_assert(std::is_base_of< MLVec, T >::value && sizeof(T) == sizeof(MLVec), "T must be an MLVec");
+    math2D::Reg scale = math2D::splat(1.f/gridSizeInPixels);
+    math2D::Reg o = origin.getReg();
+    for(size_t i = 0; i < n; ++i)
+    {
+      dest[i].setReg(math2D::mul(math2D::sub(src[i].getReg(), o), scale));
+    }
+  }
+
+  template< class T >
+  void systemToGrid(const T* src, T* dest, size_t n) const
+  {
+    static_assert(std::is_base_of< MLVec, T >::value && sizeof(T) == sizeof(MLVec), "T must be an MLVec");
+    math2D::Reg toPixel = math2D::splat(displayScale);
+    math2D::Reg toGrid = math2D::splat(1.f/gridSizeInPixels);
+    math2D::Reg o = origin.getReg();
+    for(size_t i = 0; i < n; ++i)
+    {
+      dest[i].setReg(math2D::mul(math2D::sub(math2D::mul(src[i].getReg(), toPixel), o), toGrid));
+    }
+  }
 };
 
 }; // namespace ml
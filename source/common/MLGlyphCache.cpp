@@ -0,0 +1,222 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLGlyphCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <process.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+extern "C" {
+#include "fontstash.h"
+}
+
+namespace ml {
+
+namespace
+{
+// 64-bit FNV-1a.
+struct Hash
+{
+  uint64_t h{14695981039346656037ull};
+
+  void add(const void* p, size_t n)
+  {
+    auto bytes = static_cast< const unsigned char* >(p);
+    for(size_t i = 0; i < n; ++i)
+    {
+      h = (h ^ bytes[i]) * 1099511628211ull;
+    }
+  }
+};
+
+// a temporary file next to path that no other process or thread writes.
+std::string makeTempPath(const std::string& path)
+{
+#if defined(_WIN32)
+  long long pid = _getpid();
+#else
+  long long pid = getpid();
+#endif
+  char suffix[64];
+  snprintf(suffix, sizeof(suffix), ".%lld-%zx.tmp", pid, std::hash< std::thread::id >()(std::this_thread::get_id()));
+  return path + suffix;
+}
+
+// move the file at from to to, replacing any file there. std::rename() won't replace
+// a file on Windows.
+bool replaceFile(const std::string& from, const std::string& to)
+{
+#if defined(_WIN32)
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+}
+
+GlyphCache::GlyphCache(NVGcontext* nvg, std::string cacheDirectory) :
+  _nvg(nvg), _cacheDirectory(std::move(cacheDirectory))
+{
+}
+
+GlyphCache::~GlyphCache()
+{
+  waitForPending();
+  if(_stash)
+  {
+    fonsDeleteInternal(_stash);
+  }
+}
+
+void GlyphCache::addText(int font, float size, const std::string& text)
+{
+  if(_started || text.empty()) return;
+  _texts.push_back(Text{font, size, text});
+}
+
+bool GlyphCache::start()
+{
+  if(_started || !_nvg) return false;
+  _stash = fonsCreateShared(nvgInternalFontStash(_nvg));
+  if(!_stash) return false;
+
+  if(!_cacheDirectory.empty())
+  {
+    _textsKey = makeTextsKey();
+  }
+
+  _started = true;
+  _worker = std::thread([this]() { runWorker(_stash); });
+  return true;
+}
+
+bool GlyphCache::update()
+{
+  if(_installed) return true;
+  if(!_started || !_done) return false;
+
+  waitForPending();
+  if(_stash)
+  {
+    _installed = fonsCopyAtlas(nvgInternalFontStash(_nvg), _stash);
+    fonsDeleteInternal(_stash);
+    _stash = nullptr;
+  }
+  return _installed;
+}
+
+void GlyphCache::waitForPending()
+{
+  if(_worker.joinable())
+  {
+    _worker.join();
+  }
+}
+
+uint64_t GlyphCache::makeFontsKey(FONScontext* stash) const
+{
+  Hash hash;
+  unsigned int fontsHash = fonsHashFonts(stash);
+  int atlasSize[2];
+  fonsGetAtlasSize(stash, &atlasSize[0], &atlasSize[1]);
+  hash.add(&fontsHash, sizeof(fontsHash));
+  hash.add(atlasSize, sizeof(atlasSize));
+  return hash.h;
+}
+
+uint64_t GlyphCache::makeTextsKey() const
+{
+  Hash hash;
+  for(const auto& t : _texts)
+  {
+    hash.add(&t.font, sizeof(t.font));
+    hash.add(&t.size, sizeof(t.size));
+    hash.add(t.text.data(), t.text.size() + 1);
+  }
+  return hash.h;
+}
+
+void GlyphCache::runWorker(FONScontext* stash)
+{
+  // the file holds the texts key, then the atlas.
+  if(!_cacheDirectory.empty())
+  {
+    char name[40];
+    snprintf(name, sizeof(name), "glyphs-%016llx.atlas", static_cast< unsigned long long >(makeFontsKey(stash)));
+    _cacheFile = _cacheDirectory + "/" + name;
+  }
+  const std::string& path = _cacheFile;
+  if(!path.empty())
+  {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::vector< unsigned char > data;
+    uint64_t textsKey{0};
+    if(in && (static_cast< size_t >(in.tellg()) > sizeof(textsKey)))
+    {
+      data.resize(static_cast< size_t >(in.tellg()) - sizeof(textsKey));
+      in.seekg(0);
+      in.read(reinterpret_cast< char* >(&textsKey), sizeof(textsKey));
+      in.read(reinterpret_cast< char* >(data.data()), static_cast< std::streamsize >(data.size()));
+    }
+    if((textsKey == _textsKey) && fonsLoadAtlas(stash, data.data(), static_cast< int >(data.size())))
+    {
+      _loadedFromDisk = true;
+      _done = true;
+      return;
+    }
+  }
+
+  // iterating over the text with bitmaps required makes each glyph. If the atlas fills
+  // up, the remaining glyphs are left to be made when they are drawn.
+  for(const auto& t : _texts)
+  {
+    FONStextIter iter;
+    FONSquad quad;
+    fonsSetFont(stash, t.font);
+    fonsSetSize(stash, t.size);
+    if(fonsTextIterInit(stash, &iter, 0, 0, t.text.c_str(), nullptr, FONS_GLYPH_BITMAP_REQUIRED))
+    {
+      while(fonsTextIterNext(stash, &iter, &quad))
+      {
+      }
+    }
+  }
+
+  // write to a temporary file of our own first, so that another instance never reads a
+  // partial atlas or one mixed with its own writes.
+  if(!path.empty())
+  {
+    std::vector< unsigned char > atlas(fonsSaveAtlas(stash, nullptr, 0));
+    fonsSaveAtlas(stash, atlas.data(), static_cast< int >(atlas.size()));
+    std::string tempPath = makeTempPath(path);
+    bool written;
+    {
+      std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+      out.write(reinterpret_cast< const char* >(&_textsKey), sizeof(_textsKey));
+      out.write(reinterpret_cast< const char* >(atlas.data()), static_cast< std::streamsize >(atlas.size()));
+      out.close();
+      written = !out.fail();
+    }
+    if(!written || !replaceFile(tempPath, path))
+    {
+      std::remove(tempPath.c_str());
+    }
+  }
+  _done = true;
+}
+
+} // namespace ml
@@ -0,0 +1,99 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nanovg.h"
+
+struct FONScontext;
+
+namespace ml {
+
+// GlyphCache: makes the glyphs of texts a view will draw before its first paint, so
+// that opening the view doesn't stall while stb_truetype rasterizes every glyph.
+//
+// The glyphs are made on a worker thread, in a font stash that shares the fonts of the
+// context. When they are finished, update() copies the whole atlas into the context, so
+// it must be called on the drawing thread before any text is drawn in a frame. If the
+// context's atlas has grown in the meantime, the glyphs are left to be made as usual.
+//
+// With a cache directory, the finished atlas is saved there in a file named by a hash
+// of the font data and atlas size, with a hash of the texts and sizes at its start.
+// Later runs with the same fonts and texts load the file instead of rasterizing
+// anything. A run with other texts or sizes, as after a resize or a change of display
+// scale, replaces the file, so each set of fonts has only one file. The font data is
+// hashed on the worker.
+//
+// With SDF text, all sizes share one set of glyphs, so the sizes given don't matter.
+// Otherwise only glyphs at exactly the sizes given are reused.
+
+class GlyphCache
+{
+ public:
+  explicit GlyphCache(NVGcontext* nvg, std::string cacheDirectory = std::string());
+  ~GlyphCache();
+
+  GlyphCache(const GlyphCache&) = delete;
+  GlyphCache& operator=(const GlyphCache&) = delete;
+
+  // add text that will be drawn with the font at the size in pixels.
+  void addText(int font, float size, const std::string& text);
+
+  // start making the glyphs of all the texts added. Returns false if already started,
+  // or if the fonts can't be shared with a worker.
+  bool start();
+  bool isStarted() const { return _started; }
+
+  // if the glyphs are finished, copy them into the context. Returns true once they are
+  // installed.
+  bool update();
+
+  // wait until the worker is finished. For testing.
+  void waitForPending();
+
+  // true if the glyphs were loaded from the cache directory instead of being made.
+  bool wasLoadedFromDisk() const { return _loadedFromDisk; }
+
+  // the path of the file in the cache directory, once the glyphs are finished.
+  const std::string& getCacheFile() const { return _cacheFile; }
+
+ private:
+  struct Text
+  {
+    int font;
+    float size;
+    std::string text;
+  };
+
+  uint64_t makeFontsKey(FONScontext* stash) const;
+  uint64_t makeTextsKey() const;
+  void runWorker(FONScontext* stash);
+
+  NVGcontext* _nvg;
+  std::string _cacheDirectory;
+  uint64_t _textsKey{0};
+  std::vector< Text > _texts;
+
+  // the worker's stash, deleted once its glyphs are copied into the context.
+  FONScontext* _stash{nullptr};
+
+  // written by the worker before it sets _done.
+  std::string _cacheFile;
+  bool _loadedFromDisk{false};
+
+  std::thread _worker;
+  std::atomic< bool > _done{false};
+  bool _started{false};
+  bool _installed{false};
+};
+
+} // namespace ml
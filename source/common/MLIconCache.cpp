@@ -0,0 +1,186 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLIconCache.h"
+
+#include <algorithm>
+#include <limits>
+
+#define NANOSVGRAST_IMPLEMENTATION
+#include "nanosvgrast.h"
+
+namespace ml {
+
+IconCache::IconCache(NVGcontext* nvg, size_t numThreads) : _nvg(nvg)
+{
+  for(size_t i = 0; i < std::max(numThreads, size_t(1)); ++i)
+  {
+    _workers.emplace_back([this]() { runWorker(); });
+  }
+}
+
+IconCache::~IconCache()
+{
+  {
+    std::unique_lock< std::mutex > lock(_mutex);
+    _quit = true;
+  }
+  _jobAvailable.notify_all();
+  for(auto& t : _workers)
+  {
+    t.join();
+  }
+
+  for(auto& job : _jobs)
+  {
+    nsvgDelete(job.image);
+  }
+  clear();
+}
+
+int IconCache::getIcon(const PreparedSVG* svg, int width, int height)
+{
+  if(!svg || !*svg) return 0;
+  if((width <= 0) || (height <= 0) || (width > kMaxIconSize) || (height > kMaxIconSize)) return 0;
+
+  uploadResults();
+
+  Key key{svg->contentHash, width, height};
+  auto it = _entries.find(key);
+  if(it != _entries.end())
+  {
+    it->second.lastUsed = ++_useCounter;
+    return it->second.handle;
+  }
+
+  // new size: make room, then queue the raster. The job gets its own copy of the
+  // image in nanosvg form, so it doesn't depend on svg staying alive.
+  removeOldestSize(svg->contentHash);
+  NSVGimage* image = createNSVGImage(*svg);
+  if(!image) return 0;
+  _entries[key] = Entry{0, ++_useCounter};
+  {
+    std::unique_lock< std::mutex > lock(_mutex);
+    _jobs.push_back(Job{key, _generation, image});
+  }
+  _jobAvailable.notify_one();
+  return 0;
+}
+
+void IconCache::clear()
+{
+  for(auto& e : _entries)
+  {
+    if(e.second.handle && _nvg)
+    {
+      nvgDeleteImage(_nvg, e.second.handle);
+    }
+  }
+  _entries.clear();
+
+  // results for anything already queued are now stale.
+  std::unique_lock< std::mutex > lock(_mutex);
+  _generation++;
+  _results.clear();
+}
+
+void IconCache::waitForPending()
+{
+  std::unique_lock< std::mutex > lock(_mutex);
+  _jobDone.wait(lock, [this]() { return _jobs.empty() && (_numActiveJobs == 0); });
+}
+
+void IconCache::uploadResults()
+{
+  std::vector< Result > results;
+  {
+    std::unique_lock< std::mutex > lock(_mutex);
+    if(_results.empty()) return;
+    std::swap(results, _results);
+  }
+
+  for(auto& r : results)
+  {
+    if(r.generation != _generation) continue;
+    if(r.pixels.empty()) continue;
+
+    // the entry may have been removed while the raster was being made.
+    auto it = _entries.find(r.key);
+    if(it == _entries.end()) continue;
+
+    it->second.handle = nvgCreateImageRGBA(_nvg, r.key.width, r.key.height, 0, r.pixels.data());
+  }
+}
+
+void IconCache::removeOldestSize(uint64_t contentHash)
+{
+  // entries are ordered by image first, so all sizes of an image are together.
+  const int minSize = std::numeric_limits< int >::min();
+  auto first = _entries.lower_bound(Key{contentHash, minSize, minSize});
+
+  size_t nSizes{0};
+  auto oldest = _entries.end();
+  for(auto it = first; (it != _entries.end()) && (it->first.contentHash == contentHash); ++it)
+  {
+    nSizes++;
+    if((oldest == _entries.end()) || (it->second.lastUsed < oldest->second.lastUsed))
+    {
+      oldest = it;
+    }
+  }
+
+  if(nSizes >= kMaxSizesPerImage)
+  {
+    if(oldest->second.handle)
+    {
+      nvgDeleteImage(_nvg, oldest->second.handle);
+    }
+    _entries.erase(oldest);
+  }
+}
+
+void IconCache::runWorker()
+{
+  NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+
+  while(true)
+  {
+    Job job;
+    {
+      std::unique_lock< std::mutex > lock(_mutex);
+      _jobAvailable.wait(lock, [this]() { return _quit || !_jobs.empty(); });
+      if(_quit) break;
+      job = _jobs.front();
+      _jobs.pop_front();
+      _numActiveJobs++;
+    }
+
+    Result r{job.key, job.generation, {}};
+    const NSVGimage* image = job.image;
+    if(rasterizer && (image->width > 0) && (image->height > 0))
+    {
+      const int w = job.key.width;
+      const int h = job.key.height;
+      float scale = std::min(w / image->width, h / image->height);
+      float tx = (w - image->width * scale) * 0.5f;
+      float ty = (h - image->height * scale) * 0.5f;
+      r.pixels.resize(size_t(w) * size_t(h) * 4);
+      nsvgRasterize(rasterizer, job.image, tx, ty, scale, r.pixels.data(), w, h, w * 4);
+    }
+    nsvgDelete(job.image);
+
+    {
+      std::unique_lock< std::mutex > lock(_mutex);
+      _results.push_back(std::move(r));
+      _numActiveJobs--;
+    }
+    _jobDone.notify_all();
+  }
+
+  nsvgDeleteRasterizer(rasterizer);
+}
+
+} // namespace ml
@@ -0,0 +1,120 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "MLPreparedSVG.h"
+
+namespace ml {
+
+// IconCache: rasterized copies of vector images at the exact pixel sizes they are
+// drawn at. Drawing a small image as a bitmap costs much less than tessellating all
+// of its paths on every redraw.
+//
+// Rasters are made on worker threads with nanosvgrast. Until the raster for a size is
+// ready, getIcon() returns 0 and the caller should draw the image as vectors. Finished
+// rasters are uploaded as nanovg images inside getIcon(), so it must be called on the
+// thread that draws with the context.
+//
+// Entries are keyed by the image's content hash and pixel size, so an image made at
+// the address of one that is gone never gets the old raster, and images with the
+// same contents share rasters. Pixel sizes include the display scale, so moving to a
+// display with a different scale makes new entries. Only the most recently used
+// kMaxSizesPerImage sizes of each image are kept.
+
+class IconCache
+{
+ public:
+  static constexpr size_t kMaxSizesPerImage{2};
+
+  // images larger than this in either dimension are not rasterized.
+  static constexpr int kMaxIconSize{512};
+
+  explicit IconCache(NVGcontext* nvg, size_t numThreads = 2);
+  ~IconCache();
+
+  IconCache(const IconCache&) = delete;
+  IconCache& operator=(const IconCache&) = delete;
+
+  // return the nanovg image handle of svg rasterized at width x height pixels,
+  // scaled to fit and centered, or 0 if it is not ready yet.
+  int getIcon(const PreparedSVG* svg, int width, int height);
+
+  // delete all rasters. Call this before any of the images go away.
+  void clear();
+
+  // wait until all requested rasters are finished. For testing.
+  void waitForPending();
+
+  size_t getNumIcons() const { return _entries.size(); }
+
+ private:
+  struct Key
+  {
+    uint64_t contentHash;
+    int width;
+    int height;
+
+    bool operator<(const Key& b) const
+    {
+      if(contentHash != b.contentHash) return contentHash < b.contentHash;
+      if(width != b.width) return width < b.width;
+      return height < b.height;
+    }
+  };
+
+  struct Entry
+  {
+    // nanovg image, or 0 while the raster is pending.
+    int handle{0};
+    uint64_t lastUsed{0};
+  };
+
+  struct Job
+  {
+    Key key;
+    uint32_t generation;
+    NSVGimage* image;
+  };
+
+  struct Result
+  {
+    Key key;
+    uint32_t generation;
+    std::vector< unsigned char > pixels;
+  };
+
+  void uploadResults();
+  void removeOldestSize(uint64_t contentHash);
+  void runWorker();
+
+  // used only by the drawing thread.
+  NVGcontext* _nvg;
+  std::map< Key, Entry > _entries;
+  uint64_t _useCounter{0};
+
+  // shared with the workers.
+  std::mutex _mutex;
+  std::condition_variable _jobAvailable;
+  std::condition_variable _jobDone;
+  std::deque< Job > _jobs;
+  std::vector< Result > _results;
+  size_t _numActiveJobs{0};
+  uint32_t _generation{0};
+  bool _quit{false};
+
+  std::vector< std::thread > _workers;
+};
+
+} // namespace ml
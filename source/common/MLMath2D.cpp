@@ -18,11 +18,6 @@ const V4 MLVec::kZeroValue = { {0, 0, 0, 0} };
 // MLTESTconst V4 MLVec::kNullValue = { {kMLMinSample, kMLMinSample, kMLMinSample, kMLMinSample} };
 
 
-MLVec MLVec::getIntPart() const
-{
-	return MLVec((int)val[0],(int)val[1],(int)val[2],(int)val[3]);
-}
-
 MLVec MLVec::getFracPart() const
 {
 	return *this - getIntPart();
@@ -35,16 +30,6 @@ void MLVec::getIntAndFracParts(MLVec& intPart, MLVec& fracPart) const
 	fracPart = *this - ip;
 }
 
-bool MLVec::operator==(const MLVec& b) const
-{	
-	return (val[0] == b.val[0]) && (val[1] == b.val[1]) && (val[2] == b.val[2]) && (val[3] == b.val[3]);
-}
-
-bool MLVec::operator!=(const MLVec& b) const
-{	
-	return !operator==(b);  
-}
-
 void MLVec::quantize(int q)
 {
 	int i0, i1, i2, i3;
@@ -126,20 +111,7 @@ Rect::Rect(const Vec2& corner1, const Vec2& corner2)
 
 Rect Rect::intersect(const Rect& b) const
 {
-	Rect ret;
-	float l, r, t, bot;
-	l = ml::max(left(), b.left());
-	r = ml::min(right(), b.right());
-	if (r > l)
-	{
-		t = ml::max(top(), b.top());
-		bot = ml::min(bottom(), b.bottom());
-		if (bot > t)
-		{
-			ret = Rect(l, t, r - l, bot - t);
-		}
-	}
-	return ret;
+	return intersectRects(*this, b);
 }
 
 bool Rect::intersects(const Rect& b) const
@@ -150,22 +122,7 @@ bool Rect::intersects(const Rect& b) const
 
 Rect Rect::unionWith(const Rect& b) const
 {
-	Rect ret;
-	if (area() > 0.)
-	{
-		float l, r, t, bot;
-		l = ml::min(left(), b.left());
-		r = ml::max(right(), b.right());
-		
-		t = ml::min(top(), b.top());
-		bot = ml::max(bottom(), b.bottom());
-		ret = Rect(l, t, r - l, bot - t);
-	}
-	else
-	{
-		ret = b;
-	}
-	return ret;
+	return rectEnclosing(*this, b);
 }
 
 void Rect::setToIntersectionWith(const Rect& b)
@@ -267,42 +224,6 @@ Vec2 Rect::bottomCenter() const
 }
 
 
-Rect intersectRects(const Rect& a, const Rect& b)
-{
-  Rect ret{};
-  float l, r, t, bot;
-  l = ml::max(a.left(), b.left());
-  r = ml::min(a.right(), b.right());
-  if (r > l)
-  {
-    t = ml::max(a.top(), b.top());
-    bot = ml::min(a.bottom(), b.bottom());
-    if (bot > t)
-    {
-      ret = Rect(l, t, r - l, bot - t);
-    }
-  }
-  return ret;
-}
-
-
-Rect unionRects(const Rect& a, const Rect& b)
-{
-  if (a.area() > 0.)
-  {
-    float l, r, t, bot;
-    l = ml::min(a.left(), b.left());
-    r = ml::max(a.right(), b.right());
-    t = ml::min(a.top(), b.top());
-    bot = ml::max(a.bottom(), b.bottom());
-    return Rect(l, t, r - l, bot - t);
-  }
-  else
-  {
-    return b;
-  }
-}
-
 Rect grow(const Rect& a, float m)
 {
   return a + Rect(-m, -m, 2*m, 2*m);
@@ -344,26 +265,6 @@ Rect constrainInside(Rect a, Rect b)
   return r;
 }
 
-Rect rectEnclosing(const Rect& a, const Rect& b)
-{
-  Rect ret;
-  if (a.area() > 0.)
-  {
-    float l, r, t, bot;
-    l = ml::min(a.left(), b.left());
-    r = ml::max(a.right(), b.right());
-    
-    t = ml::min(a.top(), b.top());
-    bot = ml::max(a.bottom(), b.bottom());
-    ret = Rect(l, t, r - l, bot - t);
-  }
-  else
-  {
-    ret = b;
-  }
-  return ret;
-}
-
 Rect alignRect(const Rect& a, const Rect& b, alignFlags flags)
 {
   float x, y;
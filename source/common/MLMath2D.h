@@ -11,6 +11,14 @@
 #include <cmath>
 #include <algorithm>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ML_MATH2D_SSE 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ML_MATH2D_NEON 1
+#include <arm_neon.h>
+#endif
+
 #include "mldsp.h"
 #include "MLMatrix.h"
 
@@ -20,40 +28,159 @@ using V4 = std::array<float, 4>;
 
 //inline bool operator==(const V4& a, const V4& b) { return (a == b); }
 
-class MLVec
+// the elementwise operations of MLVec, as single instructions where SSE or NEON is
+// available and on four floats otherwise. The register type and its operations
+// are used to implement the math types below, and by a few loops elsewhere in mlvg
+// that work on arrays of floats.
+
+namespace math2D
+{
+#if defined(ML_MATH2D_SSE)
+
+using Reg = __m128;
+
+inline Reg load(const float* p) { return _mm_load_ps(p); }
+inline void store(float* p, Reg a) { _mm_store_ps(p, a); }
+inline Reg zero() { return _mm_setzero_ps(); }
+inline Reg splat(float f) { return _mm_set1_ps(f); }
+inline Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+inline Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+inline Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+inline Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+inline Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+inline Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+
+// round toward zero to whole numbers, within the range of int.
+inline Reg truncate(Reg a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+
+// [a0, a1, b0, b1] and [a2, a3, b2, b3]
+inline Reg lowHalves(Reg a, Reg b) { return _mm_movelh_ps(a, b); }
+inline Reg highHalves(Reg a, Reg b) { return _mm_movehl_ps(b, a); }
+
+// [a0, a2, b0, b2] and [a1, a3, b1, b3]
+inline Reg evens(Reg a, Reg b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)); }
+inline Reg odds(Reg a, Reg b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)); }
+
+// bit i is set if the comparison is true for element i.
+inline int greaterMask(Reg a, Reg b) { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+inline int greaterEqualMask(Reg a, Reg b) { return _mm_movemask_ps(_mm_cmpge_ps(a, b)); }
+inline int equalMask(Reg a, Reg b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+
+#elif defined(ML_MATH2D_NEON)
+
+using Reg = float32x4_t;
+
+inline Reg load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, Reg a) { vst1q_f32(p, a); }
+inline Reg zero() { return vdupq_n_f32(0.f); }
+inline Reg splat(float f) { return vdupq_n_f32(f); }
+inline Reg add(Reg a, Reg b) { return vaddq_f32(a, b); }
+inline Reg sub(Reg a, Reg b) { return vsubq_f32(a, b); }
+inline Reg mul(Reg a, Reg b) { return vmulq_f32(a, b); }
+inline Reg min(Reg a, Reg b) { return vminq_f32(a, b); }
+inline Reg max(Reg a, Reg b) { return vmaxq_f32(a, b); }
+inline Reg truncate(Reg a) { return vcvtq_f32_s32(vcvtq_s32_f32(a)); }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+inline Reg div(Reg a, Reg b) { return vdivq_f32(a, b); }
+#else
+// 32-bit NEON has only a reciprocal estimate, so divide exactly one element at a time.
+inline Reg div(Reg a, Reg b)
+{
+  alignas(16) float fa[4], fb[4];
+  store(fa, a);
+  store(fb, b);
+  for(int i = 0; i < 4; ++i) fa[i] /= fb[i];
+  return load(fa);
+}
+#endif
+
+inline Reg lowHalves(Reg a, Reg b) { return vcombine_f32(vget_low_f32(a), vget_low_f32(b)); }
+inline Reg highHalves(Reg a, Reg b) { return vcombine_f32(vget_high_f32(a), vget_high_f32(b)); }
+inline Reg evens(Reg a, Reg b) { return vuzpq_f32(a, b).val[0]; }
+inline Reg odds(Reg a, Reg b) { return vuzpq_f32(a, b).val[1]; }
+
+inline int toMask(uint32x4_t c)
+{
+  const uint32_t kBits[4]{1, 2, 4, 8};
+  uint32x4_t bits = vandq_u32(c, vld1q_u32(kBits));
+  uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+  return vget_lane_u32(vpadd_u32(sum, sum), 0);
+}
+
+inline int greaterMask(Reg a, Reg b) { return toMask(vcgtq_f32(a, b)); }
+inline int greaterEqualMask(Reg a, Reg b) { return toMask(vcgeq_f32(a, b)); }
+inline int equalMask(Reg a, Reg b) { return toMask(vceqq_f32(a, b)); }
+
+#else
+
+using Reg = V4;
+
+inline Reg load(const float* p) { return Reg{{p[0], p[1], p[2], p[3]}}; }
+inline void store(float* p, Reg a) { std::copy(a.begin(), a.end(), p); }
+inline Reg zero() { return Reg{}; }
+inline Reg splat(float f) { return Reg{{f, f, f, f}}; }
+
+template< class Op >
+inline Reg map(Reg a, Reg b, Op op) { return Reg{{op(a[0], b[0]), op(a[1], b[1]), op(a[2], b[2]), op(a[3], b[3])}}; }
+
+inline Reg add(Reg a, Reg b) { return map(a, b, [](float x, float y) { return x + y; }); }
+inline Reg sub(Reg a, Reg b) { return map(a, b, [](float x, float y) { return x - y; }); }
+inline Reg mul(Reg a, Reg b) { return map(a, b, [](float x, float y) { return x * y; }); }
+inline Reg div(Reg a, Reg b) { return map(a, b, [](float x, float y) { return x / y; }); }
+inline Reg min(Reg a, Reg b) { return map(a, b, [](float x, float y) { return x < y ? x : y; }); }
+inline Reg max(Reg a, Reg b) { return map(a, b, [](float x, float y) { return x > y ? x : y; }); }
+inline Reg truncate(Reg a) { return Reg{{float(int(a[0])), float(int(a[1])), float(int(a[2])), float(int(a[3]))}}; }
+
+inline Reg lowHalves(Reg a, Reg b) { return Reg{{a[0], a[1], b[0], b[1]}}; }
+inline Reg highHalves(Reg a, Reg b) { return Reg{{a[2], a[3], b[2], b[3]}}; }
+inline Reg evens(Reg a, Reg b) { return Reg{{a[0], a[2], b[0], b[2]}}; }
+inline Reg odds(Reg a, Reg b) { return Reg{{a[1], a[3], b[1], b[3]}}; }
+
+template< class Op >
+inline int mask(Reg a, Reg b, Op op) { return op(a[0], b[0]) | op(a[1], b[1]) << 1 | op(a[2], b[2]) << 2 | op(a[3], b[3]) << 3; }
+
+inline int greaterMask(Reg a, Reg b) { return mask(a, b, [](float x, float y) { return int(x > y); }); }
+inline int greaterEqualMask(Reg a, Reg b) { return mask(a, b, [](float x, float y) { return int(x >= y); }); }
+inline int equalMask(Reg a, Reg b) { return mask(a, b, [](float x, float y) { return int(x == y); }); }
+
+#endif
+
+// a rect as [left, top, width, height] to [left, top, right, bottom], and back.
+inline Reg rectToCorners(Reg r) { return add(r, lowHalves(zero(), r)); }
+inline Reg cornersToRect(Reg c) { return sub(c, lowHalves(zero(), c)); }
+} // namespace math2D
+
+// MLVec: four floats, aligned so that they can be loaded as one SIMD register. MLVec and
+// the types derived from it have no virtual functions and are trivially copyable, so
+// arrays of them can be copied with memcpy and passed in registers.
+
+class alignas(16) MLVec
 {
 public:
   V4 val;
   
   static const V4 kZeroValue;
   
-  MLVec() : val(kZeroValue) {}
+  MLVec() : val{} {}
   MLVec(V4 v) : val(v) {}
-  MLVec(const float f) { val = {f, f, f, f}; }
-  MLVec(const MLVec& b) : val(b.val) {}
-  MLVec(const float a, const float b, const float c, const float d) { val = {a, b, c, d}; }
-  MLVec(const float* p) { val = {p[0], p[1], p[2], p[3]}; }
-  
-  virtual ~MLVec() = default;
+  MLVec(const float f) : val{{f, f, f, f}} {}
+  MLVec(const float a, const float b, const float c, const float d) : val{{a, b, c, d}} {}
+  MLVec(const float* p) : val{{p[0], p[1], p[2], p[3]}} {}
   
   //static MLVec null() { return MLVec(kNullValue); }
-  explicit operator bool() const { return !(val == kZeroValue); }
+  explicit operator bool() const { return !(*this == MLVec()); }
   
   inline void clear() { val = {0}; }
   inline void set(float f) { val = {f, f, f, f}; }
+
+  inline math2D::Reg getReg() const { return math2D::load(val.data()); }
+  inline void setReg(math2D::Reg r) { math2D::store(val.data(), r); }
   
-  inline MLVec & operator+=(const MLVec& b)
-  { val[0]+=b.val[0]; val[1]+=b.val[1]; val[2]+=b.val[2]; val[3]+=b.val[3];
-    return *this; }
-  inline MLVec & operator-=(const MLVec& b)
-  { val[0]-=b.val[0]; val[1]-=b.val[1]; val[2]-=b.val[2]; val[3]-=b.val[3];
-    return *this; }
-  inline MLVec & operator*=(const MLVec& b)
-  { val[0]*=b.val[0]; val[1]*=b.val[1]; val[2]*=b.val[2]; val[3]*=b.val[3];
-    return *this; }
-  inline MLVec & operator/=(const MLVec& b)
-  { val[0]/=b.val[0]; val[1]/=b.val[1]; val[2]/=b.val[2]; val[3]/=b.val[3];
-    return *this; }
+  inline MLVec & operator+=(const MLVec& b) { setReg(math2D::add(getReg(), b.getReg())); return *this; }
+  inline MLVec & operator-=(const MLVec& b) { setReg(math2D::sub(getReg(), b.getReg())); return *this; }
+  inline MLVec & operator*=(const MLVec& b) { setReg(math2D::mul(getReg(), b.getReg())); return *this; }
+  inline MLVec & operator/=(const MLVec& b) { setReg(math2D::div(getReg(), b.getReg())); return *this; }
   inline const MLVec operator-() const { return MLVec{-val[0], -val[1], -val[2], -val[3]}; }
   
   // inspector, return by value
@@ -61,8 +188,8 @@ public:
   // mutator, return by reference
   inline float& operator[] (int i) { return val[i]; }
   
-  bool operator==(const MLVec& b) const;
-  bool operator!=(const MLVec& b) const;
+  inline bool operator==(const MLVec& b) const { return math2D::equalMask(getReg(), b.getReg()) == 0xF; }
+  inline bool operator!=(const MLVec& b) const { return !operator==(b); }
   
   inline const MLVec operator+ (const MLVec& b) const { return MLVec(*this) += b; }
   inline const MLVec operator- (const MLVec& b) const { return MLVec(*this) -= b; }
@@ -74,17 +201,13 @@ public:
   inline const MLVec operator/ (const float f) const { return MLVec(*this) /= MLVec(f, f, f, f); }
   void quantize(int q);
   
-  MLVec getIntPart() const;
+  inline MLVec getIntPart() const { MLVec r; r.setReg(math2D::truncate(getReg())); return r; }
   MLVec getFracPart() const;
   void getIntAndFracParts(MLVec& intPart, MLVec& fracPart) const;
 };
 
-inline const MLVec vmin(const MLVec&a, const MLVec&b)
-{ return MLVec(std::min(a.val[0],b.val[0]),std::min(a.val[1],b.val[1]),
-               std::min(a.val[2],b.val[2]),std::min(a.val[3],b.val[3])); }
-inline const MLVec vmax(const MLVec&a, const MLVec&b)
-{ return MLVec(std::max(a.val[0],b.val[0]),std::max(a.val[1],b.val[1]),
-               std::max(a.val[2],b.val[2]),std::max(a.val[3],b.val[3])); }
+inline const MLVec vmin(const MLVec&a, const MLVec&b) { MLVec r; r.setReg(math2D::min(a.getReg(), b.getReg())); return r; }
+inline const MLVec vmax(const MLVec&a, const MLVec&b) { MLVec r; r.setReg(math2D::max(a.getReg(), b.getReg())); return r; }
 inline const MLVec vclamp(const MLVec&a, const MLVec&b, const MLVec&c) { return vmin(c, vmax(a, b)); }
 
 inline const MLVec vsqrt(const MLVec& a)
@@ -390,14 +513,44 @@ inline Rect translate(Rect r, Vec2 p)
   return Rect(p[0] + r[0], p[1] + r[1], r[2], r[3]);
 }
 
+// true if left <= x < right and top <= y < bottom.
 inline bool within(const Vec2& p, const Rect& r)
 {
-  return (ml::within(p.x(), r.left(), r.right()) && ml::within(p.y(), r.top(), r.bottom()));
+  math2D::Reg xyxy = math2D::lowHalves(p.getReg(), p.getReg());
+  math2D::Reg corners = math2D::rectToCorners(r.getReg());
+  int inside = (math2D::greaterEqualMask(xyxy, corners) & 0x3) | (math2D::greaterMask(corners, xyxy) & 0xC);
+  return inside == 0xF;
+}
+
+// the intersection of a and b, or an empty Rect if they don't overlap.
+inline Rect intersectRects(const Rect& a, const Rect& b)
+{
+  math2D::Reg ca = math2D::rectToCorners(a.getReg());
+  math2D::Reg cb = math2D::rectToCorners(b.getReg());
+  math2D::Reg rightBottom = math2D::min(ca, cb);
+  math2D::Reg c = math2D::lowHalves(math2D::max(ca, cb), math2D::highHalves(rightBottom, rightBottom));
+
+  Rect ret{};
+  if((math2D::greaterMask(math2D::highHalves(c, c), c) & 0x3) == 0x3)
+  {
+    ret.setReg(math2D::cornersToRect(c));
+  }
+  return ret;
+}
+
+// the smallest Rect enclosing a and b, or b if a is empty.
+inline Rect rectEnclosing(const Rect& a, const Rect& b)
+{
+  if(!(a.area() > 0.f)) return b;
+  math2D::Reg ca = math2D::rectToCorners(a.getReg());
+  math2D::Reg cb = math2D::rectToCorners(b.getReg());
+  math2D::Reg rightBottom = math2D::max(ca, cb);
+  Rect ret;
+  ret.setReg(math2D::cornersToRect(math2D::lowHalves(math2D::min(ca, cb), math2D::highHalves(rightBottom, rightBottom))));
+  return ret;
 }
 
-Rect intersectRects(const Rect& a, const Rect& b);
-Rect unionRects(const Rect& a, const Rect& b);
-Rect rectEnclosing(const Rect& a, const Rect& b);
+inline Rect unionRects(const Rect& a, const Rect& b) { return rectEnclosing(a, b); }
 Rect grow(const Rect& a, float amount);
 Rect growWidth(const Rect& a, float amount);
 Rect growHeight(const Rect& a, float amount);
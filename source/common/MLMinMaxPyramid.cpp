@@ -0,0 +1,184 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLMinMaxPyramid.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "MLMath2D.h"
+
+namespace ml {
+
+namespace
+{
+constexpr size_t kMinCapacity{16};
+constexpr size_t kFloatsPerReg{4};
+}
+
+void MinMaxPyramid::resize(size_t capacity)
+{
+  _levels.clear();
+  _capacity = 0;
+  _written = 0;
+  if(!capacity) return;
+
+  _capacity = kMinCapacity;
+  while(_capacity < capacity) _capacity <<= 1;
+
+  // halve the level sizes down to a single register.
+  for(size_t size = _capacity; size >= kFloatsPerReg; size >>= 1)
+  {
+    _levels.emplace_back();
+    Level& l = _levels.back();
+    l.size = size;
+    l.minStorage.resize(size/kFloatsPerReg, Quad{});
+    if(_levels.size() > 1)
+    {
+      l.maxStorage.resize(size/kFloatsPerReg, Quad{});
+    }
+  }
+}
+
+void MinMaxPyramid::clear()
+{
+  for(auto& l : _levels)
+  {
+    std::fill(l.minStorage.begin(), l.minStorage.end(), Quad{});
+    std::fill(l.maxStorage.begin(), l.maxStorage.end(), Quad{});
+  }
+  _written = 0;
+}
+
+void MinMaxPyramid::write(const float* samples, size_t n)
+{
+  if(_levels.empty() || !n) return;
+
+  // only the newest samples that fit are kept.
+  if(n > _capacity)
+  {
+    samples += n - _capacity;
+    _written += n - _capacity;
+    n = _capacity;
+  }
+
+  // copy to level 0, wrapping around.
+  const uint64_t previousWritten = _written;
+  size_t pos = size_t(_written & (_capacity - 1));
+  size_t first = std::min(n, _capacity - pos);
+  std::memcpy(_levels[0].min() + pos, samples, first*sizeof(float));
+  std::memcpy(_levels[0].min(), samples + first, (n - first)*sizeof(float));
+  _written += n;
+
+  // at each level, reduce the pairs completed by the new samples. Only the newest
+  // size - 1 pairs of a level are ever read, and those never span a sample that has
+  // been overwritten.
+  for(int k = 1; k < int(_levels.size()); ++k)
+  {
+    const size_t size = _levels[k].size;
+    uint64_t e0 = previousWritten >> k;
+    uint64_t e1 = _written >> k;
+    if(e1 - e0 > size - 1) e0 = e1 - (size - 1);
+    if(e1 == e0) break;
+
+    size_t start = size_t(e0 & (size - 1));
+    size_t count = size_t(e1 - e0);
+    size_t firstCount = std::min(count, size - start);
+    reduce_(k, start, start + firstCount);
+    reduce_(k, 0, count - firstCount);
+  }
+}
+
+int MinMaxPyramid::getLevelForSamplesPerColumn(float samplesPerColumn) const
+{
+  int k{0};
+  while((k + 1 < int(_levels.size())) && (float(uint64_t(1) << (k + 1)) <= samplesPerColumn)) ++k;
+  return k;
+}
+
+void MinMaxPyramid::getColumns(size_t windowSamples, size_t nColumns, float* mins, float* maxes) const
+{
+  if(!nColumns) return;
+  if(_levels.empty() || !windowSamples)
+  {
+    std::fill(mins, mins + nColumns, 0.f);
+    std::fill(maxes, maxes + nColumns, 0.f);
+    return;
+  }
+
+  // the level to read, and the window ending at its newest complete pair.
+  int k = getLevelForSamplesPerColumn(float(windowSamples)/nColumns);
+  windowSamples = std::min(windowSamples, _capacity - (size_t(1) << k));
+  const double samplesPerColumn = double(windowSamples)/nColumns;
+  const Level& l = _levels[k];
+  const float* lmin = l.min();
+  const float* lmax = l.max();
+  const uint64_t mask = l.size - 1;
+  const int64_t end = int64_t((_written >> k) << k);
+  const int64_t start = end - int64_t(windowSamples);
+
+  for(size_t c = 0; c < nColumns; ++c)
+  {
+    int64_t a0 = start + int64_t(c*samplesPerColumn);
+    int64_t a1 = start + int64_t((c + 1)*samplesPerColumn);
+    a1 = std::max(a1, a0 + 1);
+
+    // silence before the first sample.
+    if(a1 <= 0)
+    {
+      mins[c] = maxes[c] = 0.f;
+      continue;
+    }
+    bool beforeStart = (a0 < 0);
+    a0 = std::max(a0, int64_t(0));
+
+    // a column covers at most three pairs of the level.
+    uint64_t j0 = uint64_t(a0) >> k;
+    uint64_t j1 = uint64_t(a1 - 1) >> k;
+    float lo = lmin[j0 & mask];
+    float hi = lmax[j0 & mask];
+    for(uint64_t j = j0 + 1; j <= j1; ++j)
+    {
+      lo = std::min(lo, lmin[j & mask]);
+      hi = std::max(hi, lmax[j & mask]);
+    }
+    if(beforeStart)
+    {
+      lo = std::min(lo, 0.f);
+      hi = std::max(hi, 0.f);
+    }
+    mins[c] = lo;
+    maxes[c] = hi;
+  }
+}
+
+void MinMaxPyramid::reduce_(int level, size_t start, size_t end)
+{
+  // each pair at this level is the min and max of two pairs below. Four at a time,
+  // a pair of registers below is split into its even and odd elements.
+  const float* srcMin = _levels[level - 1].min();
+  const float* srcMax = _levels[level - 1].max();
+  float* dstMin = _levels[level].min();
+  float* dstMax = _levels[level].max();
+  size_t j = start;
+  auto reduceOne = [&](size_t i) {
+    dstMin[i] = std::min(srcMin[2*i], srcMin[2*i + 1]);
+    dstMax[i] = std::max(srcMax[2*i], srcMax[2*i + 1]);
+  };
+
+  for(; (j < end) && (j % kFloatsPerReg); ++j) reduceOne(j);
+  for(; j + kFloatsPerReg <= end; j += kFloatsPerReg)
+  {
+    namespace m = math2D;
+    m::Reg minA = m::load(srcMin + 2*j), minB = m::load(srcMin + 2*j + kFloatsPerReg);
+    m::Reg maxA = m::load(srcMax + 2*j), maxB = m::load(srcMax + 2*j + kFloatsPerReg);
+    m::store(dstMin + j, m::min(m::evens(minA, minB), m::odds(minA, minB)));
+    m::store(dstMax + j, m::max(m::evens(maxA, maxB), m::odds(maxA, maxB)));
+  }
+  for(; j < end; ++j) reduceOne(j);
+}
+
+} // namespace ml
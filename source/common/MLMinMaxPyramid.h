@@ -0,0 +1,91 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ml {
+
+// MinMaxPyramid: the recent history of a signal, with its minimum and maximum values
+// over every aligned span of 2, 4, 8... samples, for drawing waveforms.
+//
+// Drawing a signal one vertex per sample costs time in proportion to the number of
+// samples shown, most of which land in the same pixel columns. The pyramid keeps
+// level 0, the samples themselves, in a ring buffer of a power of two size, and
+// above it levels of half as many (min, max) pairs each. As samples are written,
+// the pairs they complete are reduced from the level below, four at a time with
+// SIMD, for an average of about two pairs per sample. Any window of the history can
+// then be summarized into one (min, max) span per pixel column from the level whose
+// spans are just shorter than a column, reading a few pairs per column whatever the
+// size of the window.
+//
+// Written samples are counted from 0. Before the buffer has been filled, the history
+// before sample 0 reads as silence.
+
+class MinMaxPyramid
+{
+ public:
+  // make a pyramid holding at least the given number of samples.
+  explicit MinMaxPyramid(size_t capacity = 0) { resize(capacity); }
+
+  // set the capacity, rounded up to a power of two, and clear the history.
+  void resize(size_t capacity);
+
+  // clear the history, keeping the capacity.
+  void clear();
+
+  // append samples to the history, discarding the oldest.
+  void write(const float* samples, size_t n);
+
+  size_t capacity() const { return _capacity; }
+  int getNumLevels() const { return int(_levels.size()); }
+
+  // the number of samples written since the last clear.
+  uint64_t getSamplesWritten() const { return _written; }
+
+  // the level whose spans of 2^level samples best fit the given number of samples
+  // per column: the highest level with spans no longer than a column.
+  int getLevelForSamplesPerColumn(float samplesPerColumn) const;
+
+  // summarize the most recent windowSamples samples into nColumns (min, max) spans,
+  // oldest first. The window ends at the newest sample completing a span of the
+  // level used, so at most one column's worth of the newest samples is left out.
+  void getColumns(size_t windowSamples, size_t nColumns, float* mins, float* maxes) const;
+
+ private:
+  // four floats, aligned for loading into a SIMD register.
+  struct alignas(16) Quad
+  {
+    float f[4];
+  };
+
+  // the pairs of one level. Level 0 has only the samples, which are both its mins
+  // and its maxes.
+  struct Level
+  {
+    std::vector< Quad > minStorage, maxStorage;
+    size_t size{0};
+
+    float* min() { return reinterpret_cast< float* >(minStorage.data()); }
+    float* max() { return maxStorage.empty() ? min() : reinterpret_cast< float* >(maxStorage.data()); }
+    const float* min() const { return reinterpret_cast< const float* >(minStorage.data()); }
+    const float* max() const
+    {
+      return maxStorage.empty() ? min() : reinterpret_cast< const float* >(maxStorage.data());
+    }
+  };
+
+  void reduce_(int level, size_t start, size_t end);
+
+  std::vector< Level > _levels;
+  size_t _capacity{0};
+  uint64_t _written{0};
+};
+
+} // namespace ml
@@ -0,0 +1,93 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLOfflineRender.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace ml {
+
+std::ostream& operator<<(std::ostream& out, const OfflineRenderStats& s)
+{
+  out << s.samples << " samples in " << s.vectors << " vectors, " << s.totalSeconds << " s\n";
+  out << "  per vector (ns): min " << s.minVectorNanos << ", mean " << s.meanVectorNanos << ", max "
+      << s.maxVectorNanos << "\n";
+  out << "  " << s.samplesPerSecond << " samples/s, " << s.realtimeRatio << "x real time\n";
+  return out;
+}
+
+namespace {
+
+void appendBytes(CharVector& v, const void* p, size_t n)
+{
+  auto pBytes = static_cast< const unsigned char* >(p);
+  v.insert(v.end(), pBytes, pBytes + n);
+}
+
+void appendTag(CharVector& v, const char* tag) { appendBytes(v, tag, 4); }
+
+// WAV is little-endian. Write bytes explicitly so this works on any host.
+void appendU32(CharVector& v, uint32_t x)
+{
+  unsigned char b[4] = {(unsigned char)(x), (unsigned char)(x >> 8), (unsigned char)(x >> 16),
+                        (unsigned char)(x >> 24)};
+  appendBytes(v, b, 4);
+}
+
+void appendU16(CharVector& v, uint16_t x)
+{
+  unsigned char b[2] = {(unsigned char)(x), (unsigned char)(x >> 8)};
+  appendBytes(v, b, 2);
+}
+
+} // namespace
+
+CharVector makeWAVData(const OfflineRenderOutput& output)
+{
+  constexpr uint16_t kFormatIEEEFloat{3};
+  constexpr uint16_t kBitsPerSample{32};
+  const uint16_t nChans = static_cast< uint16_t >(output.channels);
+  const uint32_t dataBytes = static_cast< uint32_t >(output.samples.size() * sizeof(float));
+  const uint16_t blockAlign = nChans * kBitsPerSample / 8;
+
+  CharVector v;
+  v.reserve(44 + dataBytes);
+
+  appendTag(v, "RIFF");
+  appendU32(v, 36 + dataBytes);
+  appendTag(v, "WAVE");
+
+  appendTag(v, "fmt ");
+  appendU32(v, 16);
+  appendU16(v, kFormatIEEEFloat);
+  appendU16(v, nChans);
+  appendU32(v, output.sampleRate);
+  appendU32(v, output.sampleRate * blockAlign);
+  appendU16(v, blockAlign);
+  appendU16(v, kBitsPerSample);
+
+  appendTag(v, "data");
+  appendU32(v, dataBytes);
+  for(float f : output.samples)
+  {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(float));
+    appendU32(v, u);
+  }
+  return v;
+}
+
+bool writeWAVFile(const char* filePath, const OfflineRenderOutput& output)
+{
+  CharVector data = makeWAVData(output);
+  std::ofstream ofs(filePath, std::ios::trunc | std::ios::binary);
+  if(!ofs) return false;
+  ofs.write(reinterpret_cast< const char* >(data.data()), data.size());
+  return ofs.good();
+}
+
+} // namespace ml
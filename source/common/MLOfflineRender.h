@@ -0,0 +1,157 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+// Offline render driver. Runs the same process function an AudioTask would run,
+// as fast as possible and without an audio device, applying a scripted timeline of
+// parameter changes. Useful as a DSP throughput benchmark and for deterministic
+// regression tests.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+#include "madronalib.h"
+#include "mldsp.h"
+#include "MLFiles.h"
+
+namespace ml {
+
+// a parameter change at a time in samples. Changes take effect at the start of
+// the vector containing their time, as they would when processing in real time.
+struct ParameterEvent
+{
+  size_t time{0};
+  Path name;
+  float normalizedValue{0};
+};
+
+using ParameterTimeline = std::vector< ParameterEvent >;
+
+struct OfflineRenderSettings
+{
+  size_t frames{0};
+  size_t outputChannels{2};
+  int sampleRate{48000};
+};
+
+// interleaved output samples.
+struct OfflineRenderOutput
+{
+  size_t channels{0};
+  int sampleRate{0};
+  std::vector< float > samples;
+};
+
+struct OfflineRenderStats
+{
+  size_t vectors{0};
+  size_t samples{0};
+  double totalSeconds{0};
+
+  // cost of each call to the process function.
+  double minVectorNanos{0};
+  double meanVectorNanos{0};
+  double maxVectorNanos{0};
+
+  double samplesPerSecond{0};
+
+  // audio time rendered per second of wall-clock time.
+  double realtimeRatio{0};
+};
+
+std::ostream& operator<<(std::ostream& out, const OfflineRenderStats& s);
+
+// make the contents of a 32-bit float WAV file.
+CharVector makeWAVData(const OfflineRenderOutput& output);
+
+bool writeWAVFile(const char* filePath, const OfflineRenderOutput& output);
+
+using OfflineProcessFn = void (*)(AudioContext*, void*);
+
+// render settings.frames samples by calling processFn(ctx, state) once per DSPVector.
+// setParam(const ParameterEvent&) is called for each timeline event before the vector
+// containing its time. If pOutput is not null, output is copied into it.
+template< typename SetParamFn >
+OfflineRenderStats renderOffline(AudioContext& ctx, OfflineProcessFn processFn, void* state,
+                                 const OfflineRenderSettings& settings, const ParameterTimeline& timeline,
+                                 SetParamFn&& setParam, OfflineRenderOutput* pOutput = nullptr)
+{
+  using Clock = std::chrono::high_resolution_clock;
+
+  ParameterTimeline events(timeline);
+  std::stable_sort(events.begin(), events.end(),
+                   [](const ParameterEvent& a, const ParameterEvent& b) { return a.time < b.time; });
+
+  const size_t nVectors = (settings.frames + kFloatsPerDSPVector - 1) / kFloatsPerDSPVector;
+  const size_t nChans = settings.outputChannels;
+  if(pOutput)
+  {
+    pOutput->channels = nChans;
+    pOutput->sampleRate = settings.sampleRate;
+    pOutput->samples.resize(settings.frames * nChans);
+  }
+
+  OfflineRenderStats stats;
+  double minNanos = std::numeric_limits< double >::max();
+  double maxNanos = 0;
+  double sumNanos = 0;
+  size_t nextEvent = 0;
+
+  for(size_t v = 0; v < nVectors; ++v)
+  {
+    const size_t startFrame = v * kFloatsPerDSPVector;
+    const size_t endFrame = startFrame + kFloatsPerDSPVector;
+    while((nextEvent < events.size()) && (events[nextEvent].time < endFrame))
+    {
+      setParam(events[nextEvent++]);
+    }
+
+    auto t0 = Clock::now();
+    processFn(&ctx, state);
+    auto t1 = Clock::now();
+
+    double nanos = std::chrono::duration< double, std::nano >(t1 - t0).count();
+    minNanos = std::min(minNanos, nanos);
+    maxNanos = std::max(maxNanos, nanos);
+    sumNanos += nanos;
+
+    if(pOutput)
+    {
+      const size_t framesThisVector = std::min(endFrame, settings.frames) - startFrame;
+      float* pDest = pOutput->samples.data() + startFrame * nChans;
+      for(size_t c = 0; c < nChans; ++c)
+      {
+        const float* pSrc = ctx.outputs[c].getConstBuffer();
+        for(size_t i = 0; i < framesThisVector; ++i)
+        {
+          pDest[i * nChans + c] = pSrc[i];
+        }
+      }
+    }
+  }
+
+  stats.vectors = nVectors;
+  stats.samples = settings.frames;
+  stats.totalSeconds = sumNanos * 1e-9;
+  if(nVectors > 0)
+  {
+    stats.minVectorNanos = minNanos;
+    stats.meanVectorNanos = sumNanos / nVectors;
+    stats.maxVectorNanos = maxNanos;
+  }
+  if(stats.totalSeconds > 0)
+  {
+    stats.samplesPerSecond = settings.frames / stats.totalSeconds;
+    stats.realtimeRatio = stats.samplesPerSecond / settings.sampleRate;
+  }
+  return stats;
+}
+
+} // namespace ml
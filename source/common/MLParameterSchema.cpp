@@ -0,0 +1,125 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLParameterSchema.h"
+
+#include <algorithm>
+
+namespace ml {
+
+namespace {
+
+// true if the descriptions have the same properties with the same values.
+bool sameDescription(const ParameterDescription& a, const ParameterDescription& b)
+{
+  size_t countA{0}, countB{0};
+  for(auto it = a.properties.begin(); it != a.properties.end(); ++it)
+  {
+    Path p = it.getCurrentPath();
+    if(!b.hasProperty(p) || !(b.getProperty(p) == *it)) return false;
+    countA++;
+  }
+  for(auto it = b.properties.begin(); it != b.properties.end(); ++it)
+  {
+    countB++;
+  }
+  return countA == countB;
+}
+
+bool sameDescriptions(const ParameterSchema& schema, const ParameterDescriptionList& pdl)
+{
+  if(schema.size() != pdl.size()) return false;
+  for(size_t i = 0; i < pdl.size(); ++i)
+  {
+    if(!sameDescription(schema.getDescription(i), *pdl[i])) return false;
+  }
+  return true;
+}
+
+// process-wide table of schemas in use, by key. Each key can have more than one
+// schema, as when two versions of a plugin with different parameters are loaded.
+class ParameterSchemaRegistry
+{
+  std::mutex _mutex;
+  Tree< std::vector< std::weak_ptr< const ParameterSchema > > > _schemas;
+
+ public:
+  std::shared_ptr< const ParameterSchema > get(Path key, const ParameterDescriptionList& pdl)
+  {
+    std::unique_lock< std::mutex > lock(_mutex);
+    auto& entries = _schemas[key];
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const auto& e) { return e.expired(); }),
+                  entries.end());
+    for(auto& weakSchema : entries)
+    {
+      auto schema = weakSchema.lock();
+      if(schema && sameDescriptions(*schema, pdl)) return schema;
+    }
+    auto schema = std::make_shared< const ParameterSchema >(pdl);
+    entries.push_back(schema);
+    return schema;
+  }
+};
+
+} // namespace
+
+ParameterSchema::ParameterSchema(const ParameterDescriptionList& pdl)
+{
+  const size_t n = pdl.size();
+  _names.reserve(n);
+  _descriptions.reserve(n);
+  _projections.reserve(n);
+  _normalizedDefaults.reserve(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    const ParameterDescription& desc = *pdl[i];
+    Path paramName = desc.getTextProperty("name");
+    ParameterProjection projection = createParameterProjection(desc);
+
+    // same rules as getNormalizedDefaultValue(), worked out once here.
+    Value normDefault;
+    if(desc.hasProperty("default"))
+    {
+      normDefault = desc.getProperty("default");
+    }
+    else if(desc.hasProperty("plaindefault"))
+    {
+      normDefault = projection.realToNormalized(desc.getFloatProperty("plaindefault"));
+    }
+    else
+    {
+      normDefault = 0.5f;
+    }
+
+    _names.push_back(paramName);
+    _descriptions.push_back(std::make_unique< const ParameterDescription >(desc));
+    _projections.push_back(projection);
+    _normalizedDefaults.push_back(normDefault);
+    _IDsByName[paramName] = i + 1;
+  }
+}
+
+std::shared_ptr< const ParameterSchema > ParameterSchema::getShared(Path key, const ParameterDescriptionList& pdl)
+{
+  // the registry lives as long as the process, so a schema is found by every caller
+  // while any of them holds it.
+  static ParameterSchemaRegistry registry;
+  return registry.get(key, pdl);
+}
+
+int ParameterSchema::getID(Path paramName) const
+{
+  return static_cast< int >(_IDsByName[paramName]) - 1;
+}
+
+const ParameterDescription* ParameterSchema::findDescription(Path paramName) const
+{
+  int id = getID(paramName);
+  return (id >= 0) ? _descriptions[id].get() : nullptr;
+}
+
+} // namespace ml
@@ -0,0 +1,66 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "madronalib.h"
+#include "MLParameters.h"
+#include "MLTree.h"
+
+namespace ml {
+
+// ParameterSchema: the descriptions, projections, names and IDs of all the
+// parameters of an app or plugin. A schema is immutable once made, so one copy
+// can be shared by every instance in the process and every Widget in those
+// instances, instead of each holding its own copies of the descriptions.
+//
+// Get a shared schema with ParameterSchema::getShared(). It is kept alive as long
+// as any instance holds a pointer to it.
+
+class ParameterSchema
+{
+ public:
+  explicit ParameterSchema(const ParameterDescriptionList& pdl);
+  ~ParameterSchema() = default;
+
+  ParameterSchema(const ParameterSchema&) = delete;
+  ParameterSchema& operator=(const ParameterSchema&) = delete;
+
+  // return a schema registered under key with the same descriptions as pdl, making
+  // it from pdl if no instance is currently using one. Typically the key is the app
+  // or plugin name.
+  static std::shared_ptr< const ParameterSchema > getShared(Path key, const ParameterDescriptionList& pdl);
+
+  size_t size() const { return _names.size(); }
+
+  // return the ID of the named parameter, or -1 if there is none.
+  int getID(Path paramName) const;
+
+  const Path& getName(size_t id) const { return _names[id]; }
+  const std::vector< Path >& getNames() const { return _names; }
+
+  const ParameterDescription& getDescription(size_t id) const { return *_descriptions[id]; }
+  const ParameterProjection& getProjection(size_t id) const { return _projections[id]; }
+  const Value& getNormalizedDefault(size_t id) const { return _normalizedDefaults[id]; }
+
+  // return the description of the named parameter, or nullptr if there is none.
+  const ParameterDescription* findDescription(Path paramName) const;
+
+ private:
+  std::vector< Path > _names;
+  std::vector< std::unique_ptr< const ParameterDescription > > _descriptions;
+  std::vector< ParameterProjection > _projections;
+  std::vector< Value > _normalizedDefaults;
+
+  // ID + 1 of each parameter, so that 0 means not found.
+  Tree< size_t > _IDsByName;
+};
+
+} // namespace ml
@@ -0,0 +1,212 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+// Compact binary format for saving and restoring parameter values.
+//
+// layout, all little-endian:
+//   header (16 bytes): magic "MLPS", uint16 version, uint16 flags,
+//                      uint32 parameter count, uint32 hash of parameter names
+//   float values[count], in parameter ID order
+//   optional name table (if flags & kHasNameTable):
+//     for each parameter: uint16 length, UTF-8 name bytes
+//
+// When the count and names hash match the current parameters, loading is a
+// single bulk read into the destination array. Otherwise the name table, if
+// present, is used to move each stored value to the parameter with the same name.
+//
+// The Stream type is anything with IBStream's read and write methods:
+//   read(void* buffer, int32 numBytes, int32* numBytesRead)
+//   write(void* buffer, int32 numBytes, int32* numBytesWritten)
+//
+// Values are copied in host byte order, so this assumes a little-endian host,
+// like the platforms we build for.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "madronalib.h"
+
+namespace ml {
+
+namespace parameterState {
+
+constexpr uint32_t kMagic{0x53504C4D}; // "MLPS"
+constexpr uint16_t kVersion{1};
+constexpr uint16_t kHasNameTable{1 << 0};
+
+struct Header
+{
+  uint32_t magic{kMagic};
+  uint16_t version{kVersion};
+  uint16_t flags{0};
+  uint32_t count{0};
+  uint32_t namesHash{0};
+};
+static_assert(sizeof(Header) == 16, "parameterState::Header must be packed");
+
+enum ReadResult
+{
+  kReadError = 0,
+
+  // count and names hash matched: values were read in one bulk copy.
+  kReadExact,
+
+  // values were matched to current parameters by name.
+  kReadMigrated,
+
+  // state had no header: it was read as a raw float list in ID order,
+  // the format written by earlier versions.
+  kReadLegacy
+};
+
+// the names of the current parameters in ID order, and their hash. Make one of
+// these when the parameters are created so saving and loading don't touch text.
+class Layout
+{
+  std::vector< TextFragment > _names;
+  uint32_t _hash{0};
+
+ public:
+  Layout() = default;
+
+  template< typename NameList >
+  explicit Layout(const NameList& names)
+  {
+    // FNV-1a hash of the names in ID order.
+    uint32_t h{2166136261u};
+    for(const auto& name : names)
+    {
+      TextFragment t = pathToText(Path(name));
+      const char* p = t.getText();
+      for(size_t i = 0; i < t.lengthInBytes(); ++i)
+      {
+        h = (h ^ static_cast< uint8_t >(p[i])) * 16777619u;
+      }
+      // separator so that ("ab", "c") and ("a", "bc") differ.
+      h = (h ^ 0xFF) * 16777619u;
+      _names.push_back(t);
+    }
+    _hash = h;
+  }
+
+  size_t size() const { return _names.size(); }
+  uint32_t hash() const { return _hash; }
+  const std::vector< TextFragment >& names() const { return _names; }
+};
+
+namespace detail {
+
+template< typename Stream >
+bool writeBytes(Stream* s, const void* p, size_t n)
+{
+  int32_t written{0};
+  s->write(const_cast< void* >(p), static_cast< int32_t >(n), &written);
+  return written == static_cast< int32_t >(n);
+}
+
+template< typename Stream >
+bool readBytes(Stream* s, void* p, size_t n)
+{
+  int32_t read{0};
+  s->read(p, static_cast< int32_t >(n), &read);
+  return read == static_cast< int32_t >(n);
+}
+
+} // namespace detail
+
+// write one value for each parameter in the layout, and the name table if
+// withNameTable is true.
+template< typename Stream >
+bool write(Stream* s, const float* values, const Layout& layout, bool withNameTable)
+{
+  const size_t count = layout.size();
+
+  Header h;
+  h.flags = withNameTable ? kHasNameTable : 0;
+  h.count = static_cast< uint32_t >(count);
+  h.namesHash = layout.hash();
+
+  if(!detail::writeBytes(s, &h, sizeof(Header))) return false;
+  if(!detail::writeBytes(s, values, count * sizeof(float))) return false;
+
+  if(withNameTable)
+  {
+    for(const auto& t : layout.names())
+    {
+      uint16_t len = static_cast< uint16_t >(t.lengthInBytes());
+      if(!detail::writeBytes(s, &len, sizeof(len))) return false;
+      if(!detail::writeBytes(s, t.getText(), len)) return false;
+    }
+  }
+  return true;
+}
+
+// read into values, which must hold one value for each parameter in the layout.
+// values without a match in the stored state are left unchanged.
+template< typename Stream >
+ReadResult read(Stream* s, float* values, const Layout& layout)
+{
+  const size_t count = layout.size();
+
+  Header h;
+  if(!detail::readBytes(s, &h, sizeof(uint32_t))) return kReadError;
+
+  if(h.magic != kMagic)
+  {
+    // legacy state: the four bytes we read were the first value.
+    if(count == 0) return kReadLegacy;
+    std::memcpy(values, &h.magic, sizeof(float));
+    if(!detail::readBytes(s, values + 1, (count - 1) * sizeof(float))) return kReadError;
+    return kReadLegacy;
+  }
+
+  if(!detail::readBytes(s, reinterpret_cast< uint8_t* >(&h) + sizeof(uint32_t), sizeof(Header) - sizeof(uint32_t)))
+    return kReadError;
+  if(h.version > kVersion) return kReadError;
+
+  if((h.count == count) && (h.namesHash == layout.hash()))
+  {
+    return detail::readBytes(s, values, count * sizeof(float)) ? kReadExact : kReadError;
+  }
+
+  // parameters have changed since the state was written. Without a name table
+  // we can't tell which value is which, so don't guess.
+  if(!(h.flags & kHasNameTable)) return kReadError;
+
+  std::vector< float > storedValues(h.count);
+  if(!detail::readBytes(s, storedValues.data(), h.count * sizeof(float))) return kReadError;
+
+  Tree< size_t > currentIDs;
+  size_t id{0};
+  for(const auto& name : layout.names())
+  {
+    currentIDs[Path(name)] = ++id; // 0 means no match
+  }
+
+  std::vector< char > nameBuf;
+  for(size_t i = 0; i < h.count; ++i)
+  {
+    uint16_t len{0};
+    if(!detail::readBytes(s, &len, sizeof(len))) return kReadError;
+    nameBuf.resize(len);
+    if(!detail::readBytes(s, nameBuf.data(), len)) return kReadError;
+
+    Path storedName(TextFragment(nameBuf.data(), len));
+    size_t matchID = currentIDs[storedName];
+    if(matchID)
+    {
+      values[matchID - 1] = storedValues[i];
+    }
+  }
+  return kReadMigrated;
+}
+
+} // namespace parameterState
+
+} // namespace ml
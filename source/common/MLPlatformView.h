@@ -18,7 +18,7 @@
 
 namespace ml
 {
-// forward declaration of a class that can animate(), render(), and initializeResources().
+// forward declaration of a class that can animate(), render(), and createResources().
 class AppView;
 
 // declare PlatformView, which draws our application into an AppView.
@@ -0,0 +1,475 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLPreparedSVG.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace ml {
+
+namespace {
+
+NVGcolor colorFromSVG(uint32_t color)
+{
+  return nvgRGBA((color >> 0) & 0xff, (color >> 8) & 0xff, (color >> 16) & 0xff, (color >> 24) & 0xff);
+}
+
+// same as getPaint() in MLDrawContext.cpp. nvgLinearGradient() and nvgRadialGradient()
+// don't use their context, so the paint can be made ahead of time.
+NVGpaint gradientFromSVG(const NSVGpaint& p)
+{
+  const NSVGgradient* g = p.gradient;
+  NVGcolor icol = colorFromSVG(g->stops[0].color);
+  NVGcolor ocol = colorFromSVG(g->stops[g->nstops - 1].color);
+
+  float inverse[6];
+  nvgTransformInverse(inverse, g->xform);
+  float sx, sy, ex, ey;
+  nvgTransformPoint(&sx, &sy, inverse, 0, 0);
+  nvgTransformPoint(&ex, &ey, inverse, 0, 1);
+
+  if(p.type == NSVG_PAINT_LINEAR_GRADIENT)
+    return nvgLinearGradient(nullptr, sx, sy, ex, ey, icol, ocol);
+  else
+    return nvgRadialGradient(nullptr, sx, sy, 0.0, 160, icol, ocol);
+}
+
+// returns the parameterized value of the line p2--p3 where it intersects with p0--p1.
+float getLineCrossing(float p0x, float p0y, float p1x, float p1y, float p2x, float p2y, float p3x, float p3y)
+{
+  float bx = p2x - p0x, by = p2y - p0y;
+  float dx = p1x - p0x, dy = p1y - p0y;
+  float ex = p3x - p2x, ey = p3y - p2y;
+  float m = dx * ey - dy * ex;
+
+  // check if lines are parallel, or if either pair of points are equal
+  if(std::abs(m) < 1e-6f) return NAN;
+  return -(dx * by - dy * bx) / m;
+}
+
+// Compute whether path is a hole or a solid, as nvgDrawSVG(NSVGimage*) does.
+// Assume that no paths are crossing, and that the topology is the same if we use
+// straight lines rather than Beziers. Using the even-odd fill rule, count the
+// crossings of a line from a point on the path to a point outside its bounds
+// with the other paths in the shape. An odd count means a hole.
+int getWinding(const NSVGshape* shape, const NSVGpath* path)
+{
+  int crossings = 0;
+  float p0x = path->pts[0], p0y = path->pts[1];
+  float p1x = path->bounds[0] - 1.0f, p1y = path->bounds[1] - 1.0f;
+
+  for(const NSVGpath* path2 = shape->paths; path2; path2 = path2->next)
+  {
+    if(path2 == path) continue;
+    if(path2->npts < 4) continue;
+
+    for(int i = 1; i < path2->npts + 3; i += 3)
+    {
+      const float* p = &path2->pts[2 * i];
+      float p2x = p[-2], p2y = p[-1];
+      float p3x = (i < path2->npts) ? p[4] : path2->pts[0];
+      float p3y = (i < path2->npts) ? p[5] : path2->pts[1];
+      float crossing = getLineCrossing(p0x, p0y, p1x, p1y, p2x, p2y, p3x, p3y);
+      float crossing2 = getLineCrossing(p2x, p2y, p3x, p3y, p0x, p0y, p1x, p1y);
+      if(0.0f <= crossing && crossing < 1.0f && 0.0f <= crossing2)
+      {
+        crossings++;
+      }
+    }
+  }
+  return (crossings % 2 == 0) ? NVG_SOLID : NVG_HOLE;
+}
+
+} // namespace
+
+PreparedSVG::PreparedSVG(const NSVGimage* svg)
+{
+  if(!svg) return;
+  width = svg->width;
+  height = svg->height;
+
+  for(const NSVGshape* shape = svg->shapes; shape; shape = shape->next)
+  {
+    if(!(shape->flags & NSVG_FLAGS_VISIBLE)) continue;
+
+    Shape s{};
+    s.firstPath = static_cast< uint32_t >(_pathStorage.size());
+    s.opacity = shape->opacity;
+    for(int i = 0; i < 4; ++i) s.bounds[i] = shape->bounds[i];
+
+    for(const NSVGpath* path = shape->paths; path; path = path->next)
+    {
+      Path p{};
+      p.firstPoint = static_cast< uint32_t >(_pointStorage.size() / 2);
+      p.nPoints = static_cast< uint32_t >(path->npts);
+      p.closed = path->closed;
+      p.winding = getWinding(shape, path);
+      _pointStorage.insert(_pointStorage.end(), path->pts, path->pts + 2 * path->npts);
+      _pathStorage.push_back(p);
+    }
+    s.nPaths = static_cast< uint32_t >(_pathStorage.size()) - s.firstPath;
+
+    s.fillType = shape->fill.type;
+    switch(shape->fill.type)
+    {
+      case NSVG_PAINT_COLOR:
+        s.fillPaint.innerColor = s.fillPaint.outerColor = colorFromSVG(shape->fill.color);
+        break;
+      case NSVG_PAINT_LINEAR_GRADIENT:
+      case NSVG_PAINT_RADIAL_GRADIENT:
+        s.fillPaint = gradientFromSVG(shape->fill);
+        break;
+      default:
+        break;
+    }
+
+    // only color strokes are supported. As in nvgDrawSVG(NSVGimage*), other strokes
+    // use the caller's stroke paint.
+    s.strokeType = shape->stroke.type;
+    if(shape->stroke.type == NSVG_PAINT_COLOR)
+    {
+      s.strokeColor = colorFromSVG(shape->stroke.color);
+    }
+    s.strokeWidth = shape->strokeWidth;
+    s.strokeLineCap = shape->strokeLineCap;
+    s.strokeLineJoin = shape->strokeLineJoin;
+
+    s.fillRule = shape->fillRule;
+    s.miterLimit = shape->miterLimit;
+    if(s.fillType > NSVG_PAINT_COLOR)
+    {
+      for(int i = 0; i < 6; ++i) s.gradientXform[i] = shape->fill.gradient->xform[i];
+      s.gradientSpread = shape->fill.gradient->spread;
+    }
+
+    _shapeStorage.push_back(s);
+  }
+  useStorage();
+  computeContentHash();
+}
+
+namespace {
+
+// compiled data is little-endian. After the header's 16-bit fields, everything in it
+// is a 32-bit word, so on a big-endian host the data is swapped word by word.
+static_assert(sizeof(PreparedSVG::Shape) % sizeof(uint32_t) == 0, "PreparedSVG::Shape must be made of words");
+static_assert(sizeof(PreparedSVG::Path) % sizeof(uint32_t) == 0, "PreparedSVG::Path must be made of words");
+
+bool hostIsLittleEndian()
+{
+  const uint32_t one{1};
+  uint8_t firstByte;
+  std::memcpy(&firstByte, &one, 1);
+  return firstByte == 1;
+}
+
+void swapWords(void* data, size_t bytes)
+{
+  auto p = static_cast< uint8_t* >(data);
+  for(size_t i = 0; i + 4 <= bytes; i += 4)
+  {
+    std::swap(p[i], p[i + 3]);
+    std::swap(p[i + 1], p[i + 2]);
+  }
+}
+
+void swapHeader(PreparedSVG::CompiledHeader& h)
+{
+  auto swap16 = [](uint16_t& v) { v = static_cast< uint16_t >((v >> 8) | (v << 8)); };
+  swapWords(&h.magic, sizeof(h.magic));
+  swap16(h.version);
+  swap16(h.shapeBytes);
+  swap16(h.pathBytes);
+  swap16(h.reserved);
+  for(void* word : {(void*)&h.width, (void*)&h.height, (void*)&h.nShapes, (void*)&h.nPaths, (void*)&h.nPoints})
+  {
+    swapWords(word, sizeof(uint32_t));
+  }
+}
+
+PreparedSVG::CompiledHeader readHeader(const uint8_t* data)
+{
+  PreparedSVG::CompiledHeader h;
+  std::memcpy(&h, data, sizeof(h));
+  if(!hostIsLittleEndian()) swapHeader(h);
+  return h;
+}
+
+} // namespace
+
+PreparedSVG::PreparedSVG(const uint8_t* data, size_t dataBytes)
+{
+  if(!isCompiled(data, dataBytes)) return;
+
+  CompiledHeader h = readHeader(data);
+  width = h.width;
+  height = h.height;
+
+  const uint8_t* pShapes = data + sizeof(CompiledHeader);
+  const uint8_t* pPaths = pShapes + h.nShapes * sizeof(Shape);
+  const uint8_t* pPoints = pPaths + h.nPaths * sizeof(Path);
+
+  if(hostIsLittleEndian() && (reinterpret_cast< uintptr_t >(data) % alignof(Shape) == 0))
+  {
+    // use the data in place.
+    shapes = reinterpret_cast< const Shape* >(pShapes);
+    paths = reinterpret_cast< const Path* >(pPaths);
+    points = reinterpret_cast< const float* >(pPoints);
+    nShapes = h.nShapes;
+    nPaths = h.nPaths;
+    nPoints = h.nPoints;
+  }
+  else
+  {
+    _shapeStorage.resize(h.nShapes);
+    _pathStorage.resize(h.nPaths);
+    _pointStorage.resize(h.nPoints * 2);
+    std::memcpy(_shapeStorage.data(), pShapes, h.nShapes * sizeof(Shape));
+    std::memcpy(_pathStorage.data(), pPaths, h.nPaths * sizeof(Path));
+    std::memcpy(_pointStorage.data(), pPoints, h.nPoints * 2 * sizeof(float));
+    if(!hostIsLittleEndian())
+    {
+      swapWords(_shapeStorage.data(), h.nShapes * sizeof(Shape));
+      swapWords(_pathStorage.data(), h.nPaths * sizeof(Path));
+      swapWords(_pointStorage.data(), h.nPoints * 2 * sizeof(float));
+    }
+    useStorage();
+  }
+  computeContentHash();
+}
+
+void PreparedSVG::useStorage()
+{
+  points = _pointStorage.data();
+  paths = _pathStorage.data();
+  shapes = _shapeStorage.data();
+  nPoints = static_cast< uint32_t >(_pointStorage.size() / 2);
+  nPaths = static_cast< uint32_t >(_pathStorage.size());
+  nShapes = static_cast< uint32_t >(_shapeStorage.size());
+}
+
+void PreparedSVG::computeContentHash()
+{
+  // 64-bit FNV-1a over the size and the arrays as they are written out.
+  uint64_t h{14695981039346656037ULL};
+  auto add = [&](const void* data, size_t bytes) {
+    auto p = static_cast< const uint8_t* >(data);
+    for(size_t i = 0; i < bytes; ++i)
+    {
+      h = (h ^ p[i]) * 1099511628211ULL;
+    }
+  };
+  add(&width, sizeof(width));
+  add(&height, sizeof(height));
+  if(nShapes) add(shapes, nShapes * sizeof(Shape));
+  if(nPaths) add(paths, nPaths * sizeof(Path));
+  if(nPoints) add(points, nPoints * 2 * sizeof(float));
+  contentHash = h;
+}
+
+bool PreparedSVG::isCompiled(const uint8_t* data, size_t dataBytes)
+{
+  if(!data || dataBytes < sizeof(CompiledHeader)) return false;
+
+  CompiledHeader h = readHeader(data);
+  if(h.magic != kCompiledMagic) return false;
+  if(h.version != kCompiledVersion) return false;
+
+  // data made by a build with a different struct layout can't be used.
+  if((h.shapeBytes != sizeof(Shape)) || (h.pathBytes != sizeof(Path))) return false;
+
+  size_t expectedBytes = sizeof(CompiledHeader) + size_t(h.nShapes) * sizeof(Shape) + size_t(h.nPaths) * sizeof(Path) +
+                         size_t(h.nPoints) * 2 * sizeof(float);
+  return dataBytes >= expectedBytes;
+}
+
+std::vector< uint8_t > writeCompiledSVG(const PreparedSVG& svg)
+{
+  using CompiledHeader = PreparedSVG::CompiledHeader;
+  CompiledHeader h{};
+  h.magic = PreparedSVG::kCompiledMagic;
+  h.version = PreparedSVG::kCompiledVersion;
+  h.shapeBytes = sizeof(PreparedSVG::Shape);
+  h.pathBytes = sizeof(PreparedSVG::Path);
+  h.width = svg.width;
+  h.height = svg.height;
+  h.nShapes = svg.nShapes;
+  h.nPaths = svg.nPaths;
+  h.nPoints = svg.nPoints;
+
+  const size_t shapeBytes = svg.nShapes * sizeof(PreparedSVG::Shape);
+  const size_t pathBytes = svg.nPaths * sizeof(PreparedSVG::Path);
+  const size_t pointBytes = svg.nPoints * 2 * sizeof(float);
+
+  const bool swap = !hostIsLittleEndian();
+  if(swap) swapHeader(h);
+
+  std::vector< uint8_t > data(sizeof(CompiledHeader) + shapeBytes + pathBytes + pointBytes);
+  uint8_t* p = data.data();
+  std::memcpy(p, &h, sizeof(CompiledHeader));
+  p += sizeof(CompiledHeader);
+  if(shapeBytes) std::memcpy(p, svg.shapes, shapeBytes);
+  p += shapeBytes;
+  if(pathBytes) std::memcpy(p, svg.paths, pathBytes);
+  p += pathBytes;
+  if(pointBytes) std::memcpy(p, svg.points, pointBytes);
+  if(swap) swapWords(data.data() + sizeof(CompiledHeader), shapeBytes + pathBytes + pointBytes);
+  return data;
+}
+
+namespace {
+
+unsigned int colorToSVG(NVGcolor c)
+{
+  auto byte = [](float f) { return static_cast< unsigned int >(std::min(std::max(f, 0.f), 1.f) * 255.f + 0.5f); };
+  return byte(c.r) | (byte(c.g) << 8) | (byte(c.b) << 16) | (byte(c.a) << 24);
+}
+
+} // namespace
+
+NSVGimage* createNSVGImage(const PreparedSVG& svg)
+{
+  auto image = static_cast< NSVGimage* >(std::calloc(1, sizeof(NSVGimage)));
+  if(!image) return nullptr;
+  image->width = svg.width;
+  image->height = svg.height;
+
+  NSVGshape** pNextShape = &image->shapes;
+  for(uint32_t k = 0; k < svg.nShapes; ++k)
+  {
+    const PreparedSVG::Shape& s = svg.shapes[k];
+    auto shape = static_cast< NSVGshape* >(std::calloc(1, sizeof(NSVGshape)));
+    if(!shape) break;
+    *pNextShape = shape;
+    pNextShape = &shape->next;
+
+    shape->opacity = s.opacity;
+    shape->strokeWidth = s.strokeWidth;
+    shape->strokeLineJoin = static_cast< char >(s.strokeLineJoin);
+    shape->strokeLineCap = static_cast< char >(s.strokeLineCap);
+    shape->miterLimit = s.miterLimit;
+    shape->fillRule = static_cast< char >(s.fillRule);
+    shape->flags = NSVG_FLAGS_VISIBLE;
+    for(int i = 0; i < 4; ++i) shape->bounds[i] = s.bounds[i];
+
+    shape->fill.type = static_cast< signed char >(s.fillType);
+    if(s.fillType == NSVG_PAINT_COLOR)
+    {
+      shape->fill.color = colorToSVG(s.fillPaint.innerColor);
+    }
+    else if(s.fillType > NSVG_PAINT_COLOR)
+    {
+      // NSVGgradient has room for one stop, so allocate one more.
+      auto g = static_cast< NSVGgradient* >(std::calloc(1, sizeof(NSVGgradient) + sizeof(NSVGgradientStop)));
+      if(g)
+      {
+        for(int i = 0; i < 6; ++i) g->xform[i] = s.gradientXform[i];
+        g->spread = static_cast< char >(s.gradientSpread);
+        g->nstops = 2;
+        g->stops[0] = {colorToSVG(s.fillPaint.innerColor), 0.f};
+        g->stops[1] = {colorToSVG(s.fillPaint.outerColor), 1.f};
+      }
+      else
+      {
+        shape->fill.type = NSVG_PAINT_NONE;
+      }
+      shape->fill.gradient = g;
+    }
+
+    // nvgDrawSVG() draws strokes other than colors with the caller's stroke paint,
+    // which isn't known here, so they are rasterized in black.
+    shape->stroke.type = s.strokeType ? NSVG_PAINT_COLOR : NSVG_PAINT_NONE;
+    shape->stroke.color = (s.strokeType == NSVG_PAINT_COLOR) ? colorToSVG(s.strokeColor) : 0xFF000000;
+
+    NSVGpath** pNextPath = &shape->paths;
+    for(uint32_t j = s.firstPath; j < s.firstPath + s.nPaths; ++j)
+    {
+      const PreparedSVG::Path& p = svg.paths[j];
+      auto path = static_cast< NSVGpath* >(std::calloc(1, sizeof(NSVGpath)));
+      if(!path) break;
+      path->pts = static_cast< float* >(std::malloc(p.nPoints * 2 * sizeof(float)));
+      if(!path->pts)
+      {
+        std::free(path);
+        break;
+      }
+      *pNextPath = path;
+      pNextPath = &path->next;
+
+      const float* pts = svg.points + 2 * p.firstPoint;
+      std::memcpy(path->pts, pts, p.nPoints * 2 * sizeof(float));
+      path->npts = static_cast< int >(p.nPoints);
+      path->closed = static_cast< char >(p.closed);
+      for(int i = 0; i < 4; ++i) path->bounds[i] = s.bounds[i];
+    }
+  }
+  return image;
+}
+
+void nvgDrawSVG(NVGcontext* vg, const PreparedSVG* svg)
+{
+  if(!svg) return;
+  const float* pts = svg->points;
+  const PreparedSVG::Path* paths = svg->paths;
+
+  for(uint32_t k = 0; k < svg->nShapes; ++k)
+  {
+    // each shape starts from the caller's state, so no fill or stroke settings leak
+    // from one shape to the next or back to the caller.
+    const PreparedSVG::Shape& shape = svg->shapes[k];
+    nvgSave(vg);
+    if(shape.opacity < 1.0f)
+    {
+      nvgGlobalAlpha(vg, shape.opacity);
+    }
+
+    nvgBeginPath(vg);
+    for(uint32_t j = shape.firstPath; j < shape.firstPath + shape.nPaths; ++j)
+    {
+      const PreparedSVG::Path& path = paths[j];
+      const float* p = pts + 2 * path.firstPoint;
+      nvgMoveTo(vg, p[0], p[1]);
+      for(uint32_t i = 1; i < path.nPoints; i += 3)
+      {
+        const float* q = p + 2 * i;
+        nvgBezierTo(vg, q[0], q[1], q[2], q[3], q[4], q[5]);
+      }
+      if(path.closed) nvgClosePath(vg);
+      nvgPathWinding(vg, path.winding);
+    }
+
+    if(shape.fillType)
+    {
+      if(shape.fillType == NSVG_PAINT_COLOR)
+      {
+        nvgFillColor(vg, shape.fillPaint.innerColor);
+      }
+      else if(shape.fillType > NSVG_PAINT_COLOR)
+      {
+        nvgFillPaint(vg, shape.fillPaint);
+      }
+      nvgFill(vg);
+    }
+
+    if(shape.strokeType)
+    {
+      nvgStrokeWidth(vg, shape.strokeWidth);
+      nvgLineCap(vg, shape.strokeLineCap);
+      nvgLineJoin(vg, shape.strokeLineJoin);
+      if(shape.strokeType == NSVG_PAINT_COLOR)
+      {
+        nvgStrokeColor(vg, shape.strokeColor);
+      }
+      nvgStroke(vg);
+    }
+    nvgRestore(vg);
+  }
+}
+
+} // namespace ml
@@ -0,0 +1,148 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+// PreparedSVG: an SVG image in a form that is quick to draw with nanovg.
+//
+// Made once from a parsed NSVGimage. All the work that nvgDrawSVG(NSVGimage*)
+// would do each frame is done here instead: invisible shapes are dropped, the
+// hole / solid winding of each path is computed, and gradient paints are resolved.
+// Drawing just walks flat arrays and issues nanovg calls.
+//
+// A PreparedSVG can also be written out in a compiled binary form, and read back
+// without any XML parsing. The svgcompiler tool uses this to turn .svg resources
+// into compiled data at build time. Compiled layout, little-endian on every host:
+//   CompiledHeader (32 bytes)
+//   Shape shapes[nShapes]
+//   Path paths[nPaths]
+//   float points[nPoints * 2]
+//
+// This depends only on nanovg.h and nanosvg.h, so that it can also be used by tools.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "nanovg.h"
+#include "nanosvg.h"
+
+namespace ml {
+
+struct PreparedSVG
+{
+  struct Path
+  {
+    // index of the first point in points, and number of points.
+    // The first point is a moveTo, followed by groups of three bezier points.
+    uint32_t firstPoint;
+    uint32_t nPoints;
+
+    // NVG_SOLID or NVG_HOLE
+    int32_t winding;
+    int32_t closed;
+  };
+
+  struct Shape
+  {
+    uint32_t firstPath;
+    uint32_t nPaths;
+
+    float opacity;
+    float bounds[4];
+
+    // NSVGpaintType values.
+    int32_t fillType;
+    int32_t strokeType;
+
+    // color for NSVG_PAINT_COLOR, or resolved gradient.
+    NVGpaint fillPaint;
+    NVGcolor strokeColor;
+
+    float strokeWidth;
+    int32_t strokeLineCap;
+    int32_t strokeLineJoin;
+
+    // only needed to rasterize the shape with nanosvgrast.
+    int32_t fillRule;
+    float miterLimit;
+    float gradientXform[6];
+    int32_t gradientSpread;
+  };
+
+  struct CompiledHeader
+  {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t shapeBytes;
+    uint16_t pathBytes;
+    uint16_t reserved;
+    float width;
+    float height;
+    uint32_t nShapes;
+    uint32_t nPaths;
+    uint32_t nPoints;
+  };
+
+  static constexpr uint32_t kCompiledMagic{0x56534C4D}; // "MLSV"
+  static constexpr uint16_t kCompiledVersion{2};
+
+  float width{0};
+  float height{0};
+
+  // the arrays to draw. These point either into our own storage, or into
+  // compiled data that the image was made from.
+  const float* points{nullptr}; // x, y pairs for all paths
+  const Path* paths{nullptr};
+  const Shape* shapes{nullptr};
+  uint32_t nPoints{0};
+  uint32_t nPaths{0};
+  uint32_t nShapes{0};
+
+  // a hash of the size and all the arrays, the same for any two images with the
+  // same contents.
+  uint64_t contentHash{0};
+
+  PreparedSVG() = default;
+  explicit PreparedSVG(const NSVGimage* svg);
+
+  // make a PreparedSVG from compiled data. If the data is suitably aligned, the
+  // arrays point into it and nothing is copied, so the data must outlive the
+  // PreparedSVG, as embedded resources do. If the data is not valid compiled
+  // data, the result is empty.
+  PreparedSVG(const uint8_t* compiledData, size_t dataBytes);
+
+  PreparedSVG(const PreparedSVG&) = delete;
+  PreparedSVG& operator=(const PreparedSVG&) = delete;
+
+  explicit operator bool() const { return nShapes > 0; }
+
+  // true if the data looks like compiled SVG data made by writeCompiledSVG().
+  static bool isCompiled(const uint8_t* data, size_t dataBytes);
+
+ private:
+  std::vector< float > _pointStorage;
+  std::vector< Path > _pathStorage;
+  std::vector< Shape > _shapeStorage;
+
+  void useStorage();
+  void computeContentHash();
+};
+
+// return the compiled binary form of the image.
+std::vector< uint8_t > writeCompiledSVG(const PreparedSVG& svg);
+
+// make an NSVGimage with the same shapes, for rasterizing with nanosvgrast.
+// Gradients have only their first and last stops, as when drawn with nanovg.
+// The caller owns the result and frees it with nsvgDelete().
+NSVGimage* createNSVGImage(const PreparedSVG& svg);
+
+// draw the prepared image with the current nanovg transform and state.
+void nvgDrawSVG(NVGcontext* vg, const PreparedSVG* svg);
+
+static_assert(sizeof(PreparedSVG::CompiledHeader) == 32, "PreparedSVG::CompiledHeader must be packed");
+
+} // namespace ml
@@ -0,0 +1,411 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLRealtimeCheck.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <unistd.h>
+#define ML_RT_CHECK_POSIX 1
+#endif
+
+#if defined(__GLIBC__)
+#define ML_RT_CHECK_GLIBC 1
+#endif
+
+namespace ml {
+namespace rtcheck {
+
+namespace {
+
+std::atomic< size_t > violationCounts[kNumViolationTypes]{};
+std::atomic< bool > printStackTraces{false};
+
+// Per-thread state. These are trivially constructed so they are safe to touch
+// from inside the allocation hooks. realtimeDepth counts nested RealtimeScopes.
+// suspendDepth is nonzero while unsafe operations are allowed, including while
+// we are reporting a violation ourselves.
+thread_local int realtimeDepth{0};
+thread_local int suspendDepth{0};
+
+void writeToStderr(const char* str)
+{
+#if ML_RT_CHECK_POSIX
+  ssize_t unused = ::write(2, str, strlen(str));
+  (void)unused;
+#else
+  fputs(str, stderr);
+#endif
+}
+
+void printStackTrace(Violation v)
+{
+  writeToStderr("*** real-time violation: ");
+  writeToStderr(violationName(v));
+  writeToStderr("\n");
+#if ML_RT_CHECK_POSIX
+  constexpr int kMaxFrames{64};
+  void* frames[kMaxFrames];
+  int nFrames = backtrace(frames, kMaxFrames);
+
+  // skip this function and reportViolation().
+  constexpr int kFramesToSkip{2};
+  if(nFrames > kFramesToSkip)
+  {
+    backtrace_symbols_fd(frames + kFramesToSkip, nFrames - kFramesToSkip, 2);
+  }
+#endif
+}
+
+} // namespace
+
+const char* violationName(Violation v)
+{
+  switch(v)
+  {
+    case kAllocation: return "allocation";
+    case kDeallocation: return "deallocation";
+    case kLock: return "lock";
+    case kIO: return "io";
+    default: return "unknown";
+  }
+}
+
+void enterRealtimeContext() { realtimeDepth++; }
+void exitRealtimeContext() { realtimeDepth--; }
+bool inRealtimeContext() { return (realtimeDepth > 0) && (suspendDepth == 0); }
+
+void reportViolation(Violation v)
+{
+  if(!inRealtimeContext()) return;
+
+  violationCounts[v].fetch_add(1, std::memory_order_relaxed);
+  if(printStackTraces.load(std::memory_order_relaxed))
+  {
+    // anything we do while printing is not a violation.
+    suspendDepth++;
+    printStackTrace(v);
+    suspendDepth--;
+  }
+}
+
+size_t getViolationCount(Violation v)
+{
+  return violationCounts[v].load();
+}
+
+size_t getTotalViolationCount()
+{
+  size_t sum{0};
+  for(int i = 0; i < kNumViolationTypes; ++i)
+  {
+    sum += violationCounts[i].load();
+  }
+  return sum;
+}
+
+void resetViolationCounts()
+{
+  for(int i = 0; i < kNumViolationTypes; ++i)
+  {
+    violationCounts[i].store(0);
+  }
+}
+
+void setPrintStackTraces(bool b)
+{
+  printStackTraces.store(b);
+}
+
+void printViolationSummary(std::ostream& out)
+{
+  out << "real-time violations:";
+  for(int i = 0; i < kNumViolationTypes; ++i)
+  {
+    Violation v = static_cast< Violation >(i);
+    out << " " << violationName(v) << " " << getViolationCount(v);
+  }
+  out << "\n";
+}
+
+AllowUnsafeScope::AllowUnsafeScope() { suspendDepth++; }
+AllowUnsafeScope::~AllowUnsafeScope() { suspendDepth--; }
+
+} // namespace rtcheck
+} // namespace ml
+
+
+#if ML_RT_SAFETY_CHECK
+
+using namespace ml::rtcheck;
+
+// raw allocation functions that are not themselves intercepted.
+
+#if ML_RT_CHECK_GLIBC
+extern "C"
+{
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void* __libc_valloc(size_t);
+void* __libc_pvalloc(size_t);
+void __libc_free(void*);
+}
+static void* rawMalloc(size_t n) { return __libc_malloc(n); }
+static void rawFree(void* p) { __libc_free(p); }
+#else
+static void* rawMalloc(size_t n) { return std::malloc(n); }
+static void rawFree(void* p) { std::free(p); }
+#endif
+
+// global operator new / delete. The array forms and nothrow forms in the
+// standard library forward to these.
+
+void* operator new(std::size_t n)
+{
+  reportViolation(kAllocation);
+  if(void* p = rawMalloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t n)
+{
+  reportViolation(kAllocation);
+  if(void* p = rawMalloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+  if(!p) return;
+  reportViolation(kDeallocation);
+  rawFree(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  if(!p) return;
+  reportViolation(kDeallocation);
+  rawFree(p);
+}
+
+// the sized forms, which compilers call when the size is known.
+
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { operator delete[](p); }
+
+#if ML_RT_CHECK_GLIBC
+
+// C allocation functions.
+
+extern "C" void* malloc(size_t n)
+{
+  reportViolation(kAllocation);
+  return __libc_malloc(n);
+}
+
+extern "C" void* calloc(size_t n, size_t size)
+{
+  reportViolation(kAllocation);
+  return __libc_calloc(n, size);
+}
+
+extern "C" void* realloc(void* p, size_t n)
+{
+  reportViolation(kAllocation);
+  return __libc_realloc(p, n);
+}
+
+extern "C" void free(void* p)
+{
+  if(!p) return;
+  reportViolation(kDeallocation);
+  __libc_free(p);
+}
+
+// aligned allocations, all made with __libc_memalign. libstdc++'s aligned operator new
+// calls aligned_alloc, and its aligned operator delete calls free.
+
+extern "C" int posix_memalign(void** result, size_t alignment, size_t n)
+{
+  reportViolation(kAllocation);
+  if((alignment < sizeof(void*)) || (alignment & (alignment - 1))) return EINVAL;
+  void* p = __libc_memalign(alignment, n);
+  if(!p) return ENOMEM;
+  *result = p;
+  return 0;
+}
+
+extern "C" void* aligned_alloc(size_t alignment, size_t n)
+{
+  reportViolation(kAllocation);
+  return __libc_memalign(alignment, n);
+}
+
+extern "C" void* memalign(size_t alignment, size_t n)
+{
+  reportViolation(kAllocation);
+  return __libc_memalign(alignment, n);
+}
+
+extern "C" void* valloc(size_t n)
+{
+  reportViolation(kAllocation);
+  return __libc_valloc(n);
+}
+
+extern "C" void* pvalloc(size_t n)
+{
+  reportViolation(kAllocation);
+  return __libc_pvalloc(n);
+}
+
+// locks and stdio are forwarded to the next definition found by the dynamic linker.
+
+namespace {
+
+using MutexFn = int (*)(pthread_mutex_t*);
+using WriteFn = ssize_t (*)(int, const void*, size_t);
+using FwriteFn = size_t (*)(const void*, size_t, size_t, FILE*);
+using FputsFn = int (*)(const char*, FILE*);
+using PutsFn = int (*)(const char*);
+using FputcFn = int (*)(int, FILE*);
+using VfprintfFn = int (*)(FILE*, const char*, va_list);
+
+struct NextFunctions
+{
+  MutexFn mutexLock{nullptr};
+  MutexFn mutexTryLock{nullptr};
+  WriteFn write{nullptr};
+  FwriteFn fwrite{nullptr};
+  FputsFn fputs{nullptr};
+  PutsFn puts{nullptr};
+  FputcFn fputc{nullptr};
+  FputcFn putc{nullptr};
+  VfprintfFn vfprintf{nullptr};
+
+  template< class Fn > void resolve(Fn& fn, const char* name)
+  {
+    if(!fn) fn = reinterpret_cast< Fn >(dlsym(RTLD_NEXT, name));
+  }
+
+  void resolveAll()
+  {
+    resolve(mutexLock, "pthread_mutex_lock");
+    resolve(mutexTryLock, "pthread_mutex_trylock");
+    resolve(write, "write");
+    resolve(fwrite, "fwrite");
+    resolve(fputs, "fputs");
+    resolve(puts, "puts");
+    resolve(fputc, "fputc");
+    resolve(putc, "putc");
+    resolve(vfprintf, "vfprintf");
+  }
+
+  // resolve as early as possible so the audio thread never has to call dlsym().
+  NextFunctions() { resolveAll(); }
+};
+
+NextFunctions& next()
+{
+  static NextFunctions fns;
+  return fns;
+}
+
+// make sure the lookups happen during static initialization.
+NextFunctions& nextAtStartup = next();
+
+} // namespace
+
+extern "C" int pthread_mutex_lock(pthread_mutex_t* m)
+{
+  reportViolation(kLock);
+  return next().mutexLock(m);
+}
+
+extern "C" int pthread_mutex_trylock(pthread_mutex_t* m)
+{
+  reportViolation(kLock);
+  return next().mutexTryLock(m);
+}
+
+extern "C" ssize_t write(int fd, const void* buf, size_t n)
+{
+  reportViolation(kIO);
+  return next().write(fd, buf, n);
+}
+
+extern "C" size_t fwrite(const void* p, size_t size, size_t n, FILE* f)
+{
+  reportViolation(kIO);
+  return next().fwrite(p, size, n, f);
+}
+
+extern "C" int fputs(const char* s, FILE* f)
+{
+  reportViolation(kIO);
+  return next().fputs(s, f);
+}
+
+extern "C" int puts(const char* s)
+{
+  reportViolation(kIO);
+  return next().puts(s);
+}
+
+extern "C" int fputc(int c, FILE* f)
+{
+  reportViolation(kIO);
+  return next().fputc(c, f);
+}
+
+extern "C" int putc(int c, FILE* f)
+{
+  reportViolation(kIO);
+  return next().putc(c, f);
+}
+
+extern "C" int vfprintf(FILE* f, const char* fmt, va_list args)
+{
+  reportViolation(kIO);
+  return next().vfprintf(f, fmt, args);
+}
+
+extern "C" int fprintf(FILE* f, const char* fmt, ...)
+{
+  reportViolation(kIO);
+  va_list args;
+  va_start(args, fmt);
+  int r = next().vfprintf(f, fmt, args);
+  va_end(args);
+  return r;
+}
+
+extern "C" int printf(const char* fmt, ...)
+{
+  reportViolation(kIO);
+  va_list args;
+  va_start(args, fmt);
+  int r = next().vfprintf(stdout, fmt, args);
+  va_end(args);
+  return r;
+}
+
+#endif // ML_RT_CHECK_GLIBC
+
+#endif // ML_RT_SAFETY_CHECK
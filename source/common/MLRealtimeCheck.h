@@ -0,0 +1,86 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+// Debug-mode checker for real-time safety of audio callbacks.
+//
+// When compiled with ML_RT_SAFETY_CHECK=1 (cmake -DMLVG_RT_SAFETY_CHECK=ON), code run
+// inside an ML_REALTIME_SCOPE is watched for operations that can block the audio thread:
+// heap allocation and deallocation, mutex locks and stdio. Each violation is counted and
+// can optionally print a stack trace to stderr.
+//
+// What is intercepted depends on the platform:
+// - all platforms: the plain, array and sized forms of global operator new / delete.
+// - glibc (Linux) only: malloc, calloc, realloc, free, posix_memalign, aligned_alloc,
+//   memalign, valloc and pvalloc, which also covers the aligned forms of operator new;
+//   pthread_mutex_lock and pthread_mutex_trylock; and write(), fwrite, fputs, puts,
+//   fputc, putc, printf, fprintf and vfprintf.
+// On macOS and Windows, allocations made directly with the C functions, locks and I/O
+// are not seen. Code can also report its own violations with reportViolation().
+//
+// When ML_RT_SAFETY_CHECK is not defined, ML_REALTIME_SCOPE expands to nothing and
+// there is no overhead at all.
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+namespace ml {
+namespace rtcheck {
+
+enum Violation
+{
+  kAllocation = 0,
+  kDeallocation,
+  kLock,
+  kIO,
+  kNumViolationTypes
+};
+
+const char* violationName(Violation v);
+
+// mark the current thread as running real-time code. Scopes may nest.
+void enterRealtimeContext();
+void exitRealtimeContext();
+bool inRealtimeContext();
+
+// count a violation if the current thread is in a real-time context.
+void reportViolation(Violation v);
+
+// counts are summed over all threads since the last reset.
+size_t getViolationCount(Violation v);
+size_t getTotalViolationCount();
+void resetViolationCounts();
+
+// print a stack trace to stderr for each violation. Off by default.
+void setPrintStackTraces(bool b);
+
+// print a one-line summary of the counts, for soak test logs.
+void printViolationSummary(std::ostream& out);
+
+// temporarily allow unsafe operations inside a real-time scope,
+// for example to log a violation report.
+struct AllowUnsafeScope
+{
+  AllowUnsafeScope();
+  ~AllowUnsafeScope();
+};
+
+// RAII helper that marks the current thread as real-time while in scope.
+struct RealtimeScope
+{
+  RealtimeScope() { enterRealtimeContext(); }
+  ~RealtimeScope() { exitRealtimeContext(); }
+};
+
+} // namespace rtcheck
+} // namespace ml
+
+#if ML_RT_SAFETY_CHECK
+#define ML_REALTIME_SCOPE ml::rtcheck::RealtimeScope mlRealtimeScope_
+#else
+#define ML_REALTIME_SCOPE
+#endif
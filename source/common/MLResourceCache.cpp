@@ -0,0 +1,84 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLResourceCache.h"
+
+namespace ml {
+
+uint64_t ResourceCache::hashData(const unsigned char* data, size_t bytes, uint64_t seed)
+{
+  uint64_t h = seed;
+  for(size_t i = 0; i < bytes; ++i)
+  {
+    h = (h ^ data[i]) * 1099511628211ull;
+  }
+  return h;
+}
+
+template< typename T, typename MakeFn >
+std::shared_ptr< T > ResourceCache::findOrMake(Entries< T >& entries, const Key& key, MakeFn&& makeFn)
+{
+  std::unique_lock< std::mutex > lock(_mutex);
+
+  auto it = entries.find(key);
+  if(it != entries.end())
+  {
+    if(auto existing = it->second.lock())
+    {
+      return existing;
+    }
+  }
+
+  // forget any entries whose resources have been freed.
+  for(auto e = entries.begin(); e != entries.end();)
+  {
+    e = e->second.expired() ? entries.erase(e) : std::next(e);
+  }
+
+  std::shared_ptr< T > newResource = makeFn();
+  if(newResource && *newResource)
+  {
+    entries[key] = newResource;
+  }
+  return newResource;
+}
+
+std::shared_ptr< VectorImage > ResourceCache::getVectorImage(NativeDrawContext* nvg, const unsigned char* data,
+                                                             size_t bytes)
+{
+  // a parsed SVG doesn't depend on the context, so all contexts share one group.
+  Key key{hashData(data, bytes), bytes, nullptr};
+  return findOrMake(_vectorImages, key, [&]() { return std::make_shared< VectorImage >(nvg, data, bytes); });
+}
+
+std::shared_ptr< RasterImage > ResourceCache::getRasterImage(NativeDrawContext* nvg, const unsigned char* data,
+                                                             size_t bytes)
+{
+  Key key{hashData(data, bytes), bytes, nvg};
+  return findOrMake(_rasterImages, key, [&]() { return std::make_shared< RasterImage >(nvg, data, bytes); });
+}
+
+std::shared_ptr< FontResource > ResourceCache::getFont(NativeDrawContext* nvg, const char* name,
+                                                       const unsigned char* data, size_t bytes)
+{
+  // the same data registered under different names makes different fonts.
+  uint64_t nameHash = hashData(reinterpret_cast< const unsigned char* >(name), strlen(name));
+  Key key{hashData(data, bytes, nameHash), bytes, nvg};
+  return findOrMake(_fonts, key,
+                    [&]() { return std::make_shared< FontResource >(nvg, name, data, static_cast< int >(bytes)); });
+}
+
+size_t ResourceCache::getNumLiveResources()
+{
+  std::unique_lock< std::mutex > lock(_mutex);
+  size_t n{0};
+  for(auto& e : _vectorImages) n += !e.second.expired();
+  for(auto& e : _rasterImages) n += !e.second.expired();
+  for(auto& e : _fonts) n += !e.second.expired();
+  return n;
+}
+
+} // namespace ml
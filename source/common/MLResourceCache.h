@@ -0,0 +1,71 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "MLDrawContext.h"
+
+namespace ml {
+
+// ResourceCache: a process-wide cache of drawing resources, keyed by a hash of
+// their source data and by the draw context group they belong to. When several
+// instances of an app or plugin make resources from the same data, they share one
+// copy through reference counting. A resource is freed when the last instance
+// using it lets go.
+//
+// Parsed SVGs don't depend on a draw context, so one VectorImage is shared by all
+// instances. Raster images and fonts live in a particular nanovg context, so they
+// are shared only by instances drawing with the same context.
+//
+// Typical use in AppView::initializeResources():
+//   _resources.vectorImages["knob"] = _resourceCache->getVectorImage(nvg, data, size);
+
+class ResourceCache
+{
+ public:
+  std::shared_ptr< VectorImage > getVectorImage(NativeDrawContext* nvg, const unsigned char* data, size_t bytes);
+  std::shared_ptr< RasterImage > getRasterImage(NativeDrawContext* nvg, const unsigned char* data, size_t bytes);
+  std::shared_ptr< FontResource > getFont(NativeDrawContext* nvg, const char* name, const unsigned char* data,
+                                          size_t bytes);
+
+  // number of resources currently alive in the cache, for testing and debugging.
+  size_t getNumLiveResources();
+
+  // 64-bit FNV-1a hash.
+  static uint64_t hashData(const unsigned char* data, size_t bytes, uint64_t seed = 14695981039346656037ull);
+
+ private:
+  struct Key
+  {
+    uint64_t hash;
+    size_t bytes;
+    const void* group;
+
+    bool operator<(const Key& b) const
+    {
+      if(hash != b.hash) return hash < b.hash;
+      if(bytes != b.bytes) return bytes < b.bytes;
+      return group < b.group;
+    }
+  };
+
+  template< typename T >
+  using Entries = std::map< Key, std::weak_ptr< T > >;
+
+  template< typename T, typename MakeFn >
+  std::shared_ptr< T > findOrMake(Entries< T >& entries, const Key& key, MakeFn&& makeFn);
+
+  std::mutex _mutex;
+  Entries< VectorImage > _vectorImages;
+  Entries< RasterImage > _rasterImages;
+  Entries< FontResource > _fonts;
+};
+
+} // namespace ml
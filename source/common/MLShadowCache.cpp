@@ -0,0 +1,271 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLShadowCache.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ml {
+
+namespace {
+
+// alpha at distance s outside the edge of a shape, for a shadow width pixels wide.
+// The shadow starts with a one pixel ramp inside the edge, where the first stroke of
+// a stroked shadow would have been, then falls off as easeOutCubic does.
+float shadowProfile(float s, float width)
+{
+  float coverage = std::min(std::max(s + 1.f, 0.f), 1.f);
+  float t = std::min(std::max(s / width, 0.f), 1.f);
+  float u = 1.f - t;
+  return coverage * u * u * u;
+}
+
+} // namespace
+
+ShadowCache::ShadowCache(NVGcontext* nvg) : _nvg(nvg) {}
+
+ShadowCache::~ShadowCache() { clear(); }
+
+bool ShadowCache::drawCircle(float cx, float cy, float r0, float r1, NVGcolor color)
+{
+  int rStart = (int)std::round(r0);
+  int rEnd = (int)std::round(r1);
+  if(rStart == rEnd) return true;
+  const Entry* image = getImage(Key{kRing, rStart, rEnd});
+  if(!image) return false;
+
+  float r = image->width / 2.f;
+  nvgBeginPath(_nvg);
+  nvgRect(_nvg, cx - r, cy - r, image->width, image->height);
+  fillWithImage(*image, cx - r, cy - r, image->width, image->height, 0.f, color);
+  return true;
+}
+
+bool ShadowCache::drawArc(float cx, float cy, float a0, float a1, float r0, float r1, NVGcolor color)
+{
+  int rStart = (int)std::round(r0);
+  int rEnd = (int)std::round(r1);
+  if(rStart == rEnd) return true;
+  const Entry* image = getImage(Key{kRing, rStart, rEnd});
+  if(!image) return false;
+
+  // fill the wedge of the ring's image between the angles.
+  float r = image->width / 2.f;
+  nvgBeginPath(_nvg);
+  nvgMoveTo(_nvg, cx, cy);
+  nvgArc(_nvg, cx, cy, r, a0, a1, NVG_CW);
+  nvgClosePath(_nvg);
+  fillWithImage(*image, cx - r, cy - r, image->width, image->height, 0.f, color);
+  return true;
+}
+
+bool ShadowCache::drawLine(float x1, float y1, float x2, float y2, float width, NVGcolor color)
+{
+  float dx = x2 - x1;
+  float dy = y2 - y1;
+  float length = std::sqrt(dx * dx + dy * dy);
+  int w = (int)std::round(std::fabs(width));
+  if((length <= 0.f) || (w == 0)) return true;
+  const Entry* image = getImage(Key{kLine, w, 0});
+  if(!image) return false;
+
+  // unit normal on the shadow side. The image's x axis runs across the line along the
+  // normal, starting one pixel on the other side, and its single row is stretched
+  // along the line.
+  float nx = dy / length;
+  float ny = -dx / length;
+  if(width < 0.f)
+  {
+    nx = -nx;
+    ny = -ny;
+  }
+  float ox = x1 - nx;
+  float oy = y1 - ny;
+  float across = image->width;
+
+  nvgBeginPath(_nvg);
+  nvgMoveTo(_nvg, ox, oy);
+  nvgLineTo(_nvg, x2 - nx, y2 - ny);
+  nvgLineTo(_nvg, ox + dx + nx * across, oy + dy + ny * across);
+  nvgLineTo(_nvg, ox + nx * across, oy + ny * across);
+  nvgClosePath(_nvg);
+  fillWithImage(*image, ox, oy, across, length, std::atan2(ny, nx), color);
+  return true;
+}
+
+bool ShadowCache::drawRoundRect(float x, float y, float w, float h, float radius, float width, NVGcolor color)
+{
+  int rw = (int)std::round(width);
+  int rr = std::max((int)std::round(std::min(radius, std::min(w, h) / 2.f)), 0);
+  if((rw <= 0) || (w <= 0.f) || (h <= 0.f)) return true;
+  const Entry* image = getImage(Key{kRoundRect, rr, rw});
+  if(!image) return false;
+
+  // the image is a rounded rect with straight sides two pixels long. Its corners are
+  // drawn as they are and the middle of each side is stretched along the rect.
+  float c = rr + rw;
+  float n = image->width;
+  float xs[4]{x - rw, x + rr, x + w - rr, x + w + rw};
+  float ys[4]{y - rw, y + rr, y + h - rr, y + h + rw};
+  float src[4]{0.f, c, c + 2.f, n};
+  float srcMiddle[4]{0.f, c + 0.5f, c + 1.5f, n};
+  for(int j = 0; j < 3; ++j)
+  {
+    for(int i = 0; i < 3; ++i)
+    {
+      if((i == 1) && (j == 1)) continue;
+      if((xs[i + 1] <= xs[i]) || (ys[j + 1] <= ys[j])) continue;
+      const float* sx = (i == 1) ? srcMiddle : src;
+      const float* sy = (j == 1) ? srcMiddle : src;
+      drawSlice(*image, sx[i], sx[i + 1], sy[j], sy[j + 1], xs[i], xs[i + 1], ys[j], ys[j + 1], color);
+    }
+  }
+  return true;
+}
+
+void ShadowCache::beginFrame()
+{
+  for(int handle : _removedHandles)
+  {
+    nvgDeleteImage(_nvg, handle);
+  }
+  _removedHandles.clear();
+}
+
+void ShadowCache::clear()
+{
+  for(auto& e : _entries)
+  {
+    if(e.second.handle && _nvg)
+    {
+      nvgDeleteImage(_nvg, e.second.handle);
+    }
+  }
+  _entries.clear();
+  beginFrame();
+}
+
+const ShadowCache::Entry* ShadowCache::getImage(Key key)
+{
+  auto it = _entries.find(key);
+  if(it != _entries.end())
+  {
+    it->second.lastUsed = ++_useCounter;
+    return &it->second;
+  }
+
+  // size of the image, and the distance from the shape's edge at each pixel center.
+  int width{0}, height{0};
+  switch(key.shape)
+  {
+    case kRing:
+    {
+      int r = std::max(key.a, key.b) + 1;
+      width = height = 2 * r;
+      break;
+    }
+    case kLine:
+    {
+      width = key.a + 2;
+      height = 1;
+      break;
+    }
+    case kRoundRect:
+    {
+      width = height = 2 * (key.a + key.b) + 2;
+      break;
+    }
+  }
+  if((width > kMaxShadowSize) || (height > kMaxShadowSize)) return nullptr;
+
+  _pixels.resize(size_t(width) * size_t(height) * 4);
+  for(int j = 0; j < height; ++j)
+  {
+    for(int i = 0; i < width; ++i)
+    {
+      float px = i + 0.5f;
+      float py = j + 0.5f;
+      float alpha{0.f};
+      switch(key.shape)
+      {
+        case kRing:
+        {
+          // rings fade out from a toward b, which may be on either side.
+          float c = width / 2.f;
+          float d = std::sqrt((px - c) * (px - c) + (py - c) * (py - c));
+          float s = (key.b > key.a) ? (d - key.a) : (key.a - d);
+          alpha = shadowProfile(s, std::abs(key.b - key.a));
+          break;
+        }
+        case kLine:
+        {
+          alpha = shadowProfile(px - 1.f, key.a);
+          break;
+        }
+        case kRoundRect:
+        {
+          // signed distance from a rounded rect of radius a, inset by b from the edges.
+          float c = width / 2.f;
+          float half = key.a + 1.f;
+          float qx = std::fabs(px - c) - half + key.a;
+          float qy = std::fabs(py - c) - half + key.a;
+          float ox = std::max(qx, 0.f);
+          float oy = std::max(qy, 0.f);
+          float s = std::sqrt(ox * ox + oy * oy) + std::min(std::max(qx, qy), 0.f) - key.a;
+          alpha = shadowProfile(s, key.b);
+          break;
+        }
+      }
+
+      // white, so that the paint color gives the shadow its color.
+      unsigned char* p = &_pixels[(size_t(j) * width + i) * 4];
+      p[0] = p[1] = p[2] = 255;
+      p[3] = (unsigned char)std::round(alpha * 255.f);
+    }
+  }
+
+  // evict only once the new image exists, so a failed create doesn't cost a shadow.
+  int handle = nvgCreateImageRGBA(_nvg, width, height, 0, _pixels.data());
+  if(!handle) return nullptr;
+  removeOldest();
+  Entry& e = _entries[key];
+  e = Entry{handle, width, height, ++_useCounter};
+  return &e;
+}
+
+void ShadowCache::removeOldest()
+{
+  if(_entries.size() < kMaxShadows) return;
+  auto oldest = std::min_element(_entries.begin(), _entries.end(), [](const auto& a, const auto& b) {
+    return a.second.lastUsed < b.second.lastUsed;
+  });
+  _removedHandles.push_back(oldest->second.handle);
+  _entries.erase(oldest);
+}
+
+void ShadowCache::fillWithImage(const Entry& image, float ox, float oy, float ex, float ey, float angle,
+                                NVGcolor color)
+{
+  NVGpaint paint = nvgImagePattern(_nvg, ox, oy, ex, ey, angle, image.handle, 1.0f);
+  paint.innerColor = paint.outerColor = color;
+  nvgFillPaint(_nvg, paint);
+  nvgFill(_nvg);
+}
+
+void ShadowCache::drawSlice(const Entry& image, float sx0, float sx1, float sy0, float sy1, float dx0, float dx1,
+                            float dy0, float dy1, NVGcolor color)
+{
+  // map the source rect of the image in pixels onto the destination rect.
+  float scaleX = (dx1 - dx0) / (sx1 - sx0);
+  float scaleY = (dy1 - dy0) / (sy1 - sy0);
+  nvgBeginPath(_nvg);
+  nvgRect(_nvg, dx0, dy0, dx1 - dx0, dy1 - dy0);
+  fillWithImage(image, dx0 - sx0 * scaleX, dy0 - sy0 * scaleY, image.width * scaleX, image.height * scaleY, 0.f,
+                color);
+}
+
+} // namespace ml
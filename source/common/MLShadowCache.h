@@ -0,0 +1,114 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "nanovg.h"
+
+namespace ml {
+
+// ShadowCache: shadows drawn from images of their falloff, made once for each shape
+// and size. Stroking the shadow one pixel at a time costs a tessellated path for each
+// pixel of width on every redraw; an image costs one textured fill, or eight for a
+// rounded rect, which is drawn as a 9-slice so that one image serves every rect size.
+//
+// Each image holds the alpha of the shadow as a function of distance from the edge of
+// the shape, with the easeOutCubic falloff the stroked shadows had. The color and
+// alpha of a shadow are applied as the paint color, so they don't make new images.
+// Radii and widths are rounded to whole pixels.
+//
+// Images are made and uploaded on demand, so the draw functions must be called on the
+// thread that draws with the context. They return false if the shadow is too large to
+// cache, in which case nothing is drawn. Only the most recently used kMaxShadows
+// images are kept. Fills already queued in a frame may still use an image that is
+// removed, so removed images are deleted in the next beginFrame().
+
+class ShadowCache
+{
+ public:
+  static constexpr size_t kMaxShadows{64};
+
+  // images larger than this in either dimension are not made.
+  static constexpr int kMaxShadowSize{512};
+
+  explicit ShadowCache(NVGcontext* nvg);
+  ~ShadowCache();
+
+  ShadowCache(const ShadowCache&) = delete;
+  ShadowCache& operator=(const ShadowCache&) = delete;
+
+  // shadow of a circle, from radius r0 fading out at r1. r1 may be less than r0 for
+  // a shadow inside the circle.
+  bool drawCircle(float cx, float cy, float r0, float r1, NVGcolor color);
+
+  // the part of a circle's shadow between angles a0 and a1, clockwise.
+  bool drawArc(float cx, float cy, float a0, float a1, float r0, float r1, NVGcolor color);
+
+  // shadow of the line p1 -> p2 with the given width, to the left of the line in
+  // screen coordinates, or to the right if width is negative.
+  bool drawLine(float x1, float y1, float x2, float y2, float width, NVGcolor color);
+
+  // shadow around the rounded rect, fading out over width pixels.
+  bool drawRoundRect(float x, float y, float w, float h, float radius, float width, NVGcolor color);
+
+  // delete the images removed since the last call. Call this at the start of each
+  // frame, before anything is drawn.
+  void beginFrame();
+
+  // delete all images.
+  void clear();
+
+  size_t getNumShadows() const { return _entries.size(); }
+
+ private:
+  enum Shape
+  {
+    kRing,
+    kLine,
+    kRoundRect
+  };
+
+  struct Key
+  {
+    int shape;
+    int a;
+    int b;
+
+    bool operator<(const Key& k) const
+    {
+      if(shape != k.shape) return shape < k.shape;
+      if(a != k.a) return a < k.a;
+      return b < k.b;
+    }
+  };
+
+  struct Entry
+  {
+    int handle{0};
+    int width{0};
+    int height{0};
+    uint64_t lastUsed{0};
+  };
+
+  const Entry* getImage(Key key);
+  void removeOldest();
+  void fillWithImage(const Entry& image, float ox, float oy, float ex, float ey, float angle, NVGcolor color);
+  void drawSlice(const Entry& image, float sx0, float sx1, float sy0, float sy1, float dx0, float dx1, float dy0,
+                 float dy1, NVGcolor color);
+
+  NVGcontext* _nvg;
+  std::map< Key, Entry > _entries;
+  std::vector< int > _removedHandles;
+  std::vector< unsigned char > _pixels;
+  uint64_t _useCounter{0};
+};
+
+} // namespace ml
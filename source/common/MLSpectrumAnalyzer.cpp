@@ -0,0 +1,177 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLSpectrumAnalyzer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ml {
+
+namespace
+{
+constexpr size_t kMinFFTSize{16};
+constexpr double kPi{3.14159265358979323846};
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer(size_t fftSize, size_t hop, float floorDb) : _floorDb(std::min(floorDb, -1.f))
+{
+  _fftSize = kMinFFTSize;
+  while(_fftSize < fftSize) _fftSize <<= 1;
+  _hop = std::max(std::min(hop, _fftSize), size_t(1));
+
+  // Hann window, scaled so that a sine of amplitude 1 centered on a bin measures 0 dB.
+  _window.resize(_fftSize);
+  double windowSum{0};
+  for(size_t i = 0; i < _fftSize; ++i)
+  {
+    _window[i] = float(0.5 - 0.5*std::cos(2.0*kPi*i/_fftSize));
+    windowSum += _window[i];
+  }
+  _scale = float(2.0/windowSum);
+
+  _twiddles.resize(_fftSize/2);
+  for(size_t i = 0; i < _fftSize/2; ++i)
+  {
+    _twiddles[i] = std::polar(1.f, float(-2.0*kPi*i/_fftSize));
+  }
+
+  int bits{0};
+  while((size_t(1) << bits) < _fftSize) bits++;
+  _bitReverse.resize(_fftSize);
+  for(size_t i = 0; i < _fftSize; ++i)
+  {
+    size_t r{0};
+    for(int b = 0; b < bits; ++b)
+    {
+      r |= ((i >> b) & 1) << (bits - 1 - b);
+    }
+    _bitReverse[i] = r;
+  }
+  _bins.resize(_fftSize);
+
+  _worker = std::thread([this]() { runWorker(); });
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+  {
+    std::unique_lock< std::mutex > lock(_mutex);
+    _quit = true;
+  }
+  _inputAvailable.notify_all();
+  _worker.join();
+}
+
+void SpectrumAnalyzer::write(const float* samples, size_t n)
+{
+  if(!n) return;
+  {
+    std::unique_lock< std::mutex > lock(_mutex);
+    _input.insert(_input.end(), samples, samples + n);
+
+    // if the worker has fallen far behind, skip to the samples it can still use.
+    const size_t maxInput = kMaxColumns*_hop + _fftSize;
+    if(_input.size() > maxInput)
+    {
+      _input.erase(_input.begin(), _input.end() - maxInput);
+    }
+  }
+  _inputAvailable.notify_one();
+}
+
+size_t SpectrumAnalyzer::takeColumns(std::vector< float >& columns)
+{
+  columns.clear();
+  std::unique_lock< std::mutex > lock(_mutex);
+  std::swap(columns, _columns);
+  return columns.size()/getNumBins();
+}
+
+bool SpectrumAnalyzer::isBusy()
+{
+  std::unique_lock< std::mutex > lock(_mutex);
+  return _busy || !_input.empty();
+}
+
+void SpectrumAnalyzer::waitForPending()
+{
+  std::unique_lock< std::mutex > lock(_mutex);
+  _inputDone.wait(lock, [this]() { return !_busy && _input.empty(); });
+}
+
+void SpectrumAnalyzer::runWorker()
+{
+  const size_t nBins = getNumBins();
+  while(true)
+  {
+    {
+      std::unique_lock< std::mutex > lock(_mutex);
+      _inputAvailable.wait(lock, [this]() { return _quit || !_input.empty(); });
+      if(_quit) break;
+      std::swap(_incoming, _input);
+      _busy = true;
+    }
+
+    // analyze every complete frame, keeping the samples the next frame starts with.
+    _frame.insert(_frame.end(), _incoming.begin(), _incoming.end());
+    _incoming.clear();
+    size_t pos{0};
+    while(_frame.size() - pos >= _fftSize)
+    {
+      _finished.resize(_finished.size() + nBins);
+      analyze_(_frame.data() + pos, _finished.data() + _finished.size() - nBins);
+      pos += _hop;
+    }
+    _frame.erase(_frame.begin(), _frame.begin() + pos);
+
+    {
+      std::unique_lock< std::mutex > lock(_mutex);
+      _columns.insert(_columns.end(), _finished.begin(), _finished.end());
+      if(_columns.size() > kMaxColumns*nBins)
+      {
+        _columns.erase(_columns.begin(), _columns.end() - kMaxColumns*nBins);
+      }
+      _busy = false;
+    }
+    _finished.clear();
+    _inputDone.notify_all();
+  }
+}
+
+void SpectrumAnalyzer::analyze_(const float* frame, float* levels)
+{
+  // radix 2 FFT, in place after the bit reversed copy.
+  for(size_t i = 0; i < _fftSize; ++i)
+  {
+    _bins[_bitReverse[i]] = std::complex< float >(frame[i]*_window[i], 0.f);
+  }
+  for(size_t len = 2; len <= _fftSize; len <<= 1)
+  {
+    const size_t half = len/2;
+    const size_t step = _fftSize/len;
+    for(size_t i = 0; i < _fftSize; i += len)
+    {
+      for(size_t j = 0; j < half; ++j)
+      {
+        std::complex< float > u = _bins[i + j];
+        std::complex< float > t = _twiddles[j*step]*_bins[i + j + half];
+        _bins[i + j] = u + t;
+        _bins[i + j + half] = u - t;
+      }
+    }
+  }
+
+  // magnitudes in dB, from the floor to 0 as 0 to 1.
+  for(size_t k = 0; k < getNumBins(); ++k)
+  {
+    float magnitude = std::abs(_bins[k])*_scale;
+    float db = 20.f*std::log10(std::max(magnitude, 1e-12f));
+    levels[k] = std::min(std::max(1.f - db/_floorDb, 0.f), 1.f);
+  }
+}
+
+} // namespace ml
@@ -0,0 +1,94 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <complex>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ml {
+
+// SpectrumAnalyzer: short-time spectra of a signal, made on a worker thread, for
+// spectrogram displays.
+//
+// Samples written on the drawing thread are queued for the worker, which takes a
+// Hann windowed FFT of every fftSize samples, stepping by hop samples. Each result
+// is a column of fftSize / 2 levels from 0 to 1, mapping magnitudes from floorDb to
+// 0 dB. The drawing thread collects finished columns with takeColumns() each frame,
+// so the FFTs never add to the time a frame takes.
+//
+// If the drawing thread stops collecting, only the newest kMaxColumns columns are
+// kept.
+
+class SpectrumAnalyzer
+{
+ public:
+  static constexpr size_t kMaxColumns{1024};
+
+  // fftSize is rounded up to a power of two, at least 16. hop is limited to fftSize.
+  SpectrumAnalyzer(size_t fftSize = 1024, size_t hop = 256, float floorDb = -96.f);
+  ~SpectrumAnalyzer();
+
+  SpectrumAnalyzer(const SpectrumAnalyzer&) = delete;
+  SpectrumAnalyzer& operator=(const SpectrumAnalyzer&) = delete;
+
+  size_t getFFTSize() const { return _fftSize; }
+  size_t getHop() const { return _hop; }
+
+  // the number of levels in each column.
+  size_t getNumBins() const { return _fftSize/2; }
+
+  // queue samples for analysis.
+  void write(const float* samples, size_t n);
+
+  // replace the contents of columns with all the columns finished since the last
+  // call, oldest first and each getNumBins() long, and return how many there are.
+  // The vector's storage is traded with the worker's, so after the first few calls
+  // this doesn't allocate.
+  size_t takeColumns(std::vector< float >& columns);
+
+  // true if samples are queued or being analyzed.
+  bool isBusy();
+
+  // wait until all the samples written have been analyzed. For testing.
+  void waitForPending();
+
+ private:
+  void runWorker();
+  void analyze_(const float* frame, float* levels);
+
+  // set at construction and read-only after.
+  size_t _fftSize;
+  size_t _hop;
+  float _floorDb;
+  float _scale;
+  std::vector< float > _window;
+  std::vector< std::complex< float > > _twiddles;
+  std::vector< size_t > _bitReverse;
+
+  // used only by the worker.
+  std::vector< float > _incoming;
+  std::vector< float > _frame;
+  std::vector< float > _finished;
+  std::vector< std::complex< float > > _bins;
+
+  // shared with the worker.
+  std::mutex _mutex;
+  std::condition_variable _inputAvailable;
+  std::condition_variable _inputDone;
+  std::vector< float > _input;
+  std::vector< float > _columns;
+  bool _busy{false};
+  bool _quit{false};
+
+  std::thread _worker;
+};
+
+} // namespace ml
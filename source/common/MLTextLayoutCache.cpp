@@ -0,0 +1,114 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLTextLayoutCache.h"
+
+#include <cstring>
+
+namespace ml {
+
+bool TextLayoutCache::Key::operator<(const Key& b) const
+{
+  if(textHash != b.textHash) return textHash < b.textHash;
+  if(textBytes != b.textBytes) return textBytes < b.textBytes;
+  if(font != b.font) return font < b.font;
+  if(size != b.size) return size < b.size;
+  if(spacing != b.spacing) return spacing < b.spacing;
+  if(width != b.width) return width < b.width;
+  if(lineHeight != b.lineHeight) return lineHeight < b.lineHeight;
+  return align < b.align;
+}
+
+TextLayoutCache::Key TextLayoutCache::makeKey(const char* text, int font, float size, float spacing, float width,
+                                              float lineHeight, int align)
+{
+  // 64-bit FNV-1a hash of the text.
+  uint64_t h{14695981039346656037ull};
+  const char* p = text;
+  for(; *p; ++p)
+  {
+    h = (h ^ static_cast< uint8_t >(*p)) * 1099511628211ull;
+  }
+  return Key{h, static_cast< uint32_t >(p - text), font, size, spacing, width, lineHeight, align};
+}
+
+TextLayoutCache::Layout* TextLayoutCache::find(const Key& key)
+{
+  auto it = _entries.find(key);
+  if(it != _entries.end())
+  {
+    _hits++;
+    return &it->second;
+  }
+  _misses++;
+  return nullptr;
+}
+
+TextLayoutCache::Layout& TextLayoutCache::insert(const Key& key)
+{
+  if(_entries.size() >= kMaxEntries)
+  {
+    _entries.clear();
+  }
+  return _entries[key];
+}
+
+const TextLayoutCache::Layout& TextLayoutCache::getLines(NVGcontext* nvg, const char* text, int font, float size,
+                                                         float spacing, float width, float lineHeight, int align)
+{
+  Key key = makeKey(text, font, size, spacing, width, lineHeight, align);
+  if(Layout* cached = find(key)) return *cached;
+
+  // break with left alignment, as nvgTextBox() does.
+  Layout& layout = insert(key);
+  nvgTextAlign(nvg, NVG_ALIGN_LEFT | (align & (NVG_ALIGN_TOP | NVG_ALIGN_MIDDLE | NVG_ALIGN_BOTTOM | NVG_ALIGN_BASELINE)));
+  nvgTextLineHeight(nvg, lineHeight);
+  nvgTextMetrics(nvg, nullptr, nullptr, &layout.lineHeight);
+  layout.lineHeight *= lineHeight;
+
+  // row widths depend on where each batch of rows starts, so this uses the same
+  // batch size as nvgTextBox().
+  constexpr int kMaxRows{2};
+  NVGtextRow rows[kMaxRows];
+  const char* pText{text};
+  const char* pEnd{text + key.textBytes};
+  while(int nRows = nvgTextBreakLines(nvg, pText, pEnd, width, rows, kMaxRows))
+  {
+    for(int i = 0; i < nRows; ++i)
+    {
+      layout.rows.push_back(Row{static_cast< uint32_t >(rows[i].start - text),
+                                static_cast< uint32_t >(rows[i].end - text), rows[i].width});
+    }
+    pText = rows[nRows - 1].next;
+  }
+  return layout;
+}
+
+float TextLayoutCache::getFittedSize(NVGcontext* nvg, const char* text, int font, float desiredSize, float spacing,
+                                     float width)
+{
+  constexpr float kNoLineHeight{0.f};
+  Key key = makeKey(text, font, desiredSize, spacing, width, kNoLineHeight, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
+  if(Layout* cached = find(key)) return cached->fittedSize;
+
+  Layout& layout = insert(key);
+  nvgFontSize(nvg, desiredSize);
+  nvgTextLetterSpacing(nvg, desiredSize * spacing);
+  nvgTextAlign(nvg, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
+  layout.advance = nvgTextBounds(nvg, 0, 0, text, nullptr, layout.bounds);
+
+  // if width is larger than display area, scale text to fit. As in drawTextToFit(),
+  // the size is truncated to a whole number.
+  int fittedSize = desiredSize;
+  if(layout.advance > width)
+  {
+    fittedSize = desiredSize * (width / layout.advance);
+  }
+  layout.fittedSize = fittedSize;
+  return layout.fittedSize;
+}
+
+} // namespace ml
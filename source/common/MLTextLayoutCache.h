@@ -0,0 +1,99 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "nanovg.h"
+
+namespace ml {
+
+// TextLayoutCache: line breaks, measured bounds and fitted sizes of texts, so that
+// labels drawn every frame don't lay out the same text again each time.
+//
+// Entries are keyed by the text contents, font, size, letter spacing, width and
+// alignment. Any change to one of these makes a new entry, so the cache only needs to
+// be cleared when fonts are reloaded or the view is resized, which would otherwise
+// leave many entries that won't be used again. It is also cleared if it grows past
+// kMaxEntries.
+//
+// getLines() measures with the current nanovg text state, so the caller must set the
+// font, size and letter spacing it is given before calling it.
+
+class TextLayoutCache
+{
+ public:
+  static constexpr size_t kMaxEntries{4096};
+
+  struct Row
+  {
+    // byte offsets of the start and end of the row in the text.
+    uint32_t start;
+    uint32_t end;
+    float width;
+  };
+
+  struct Layout
+  {
+    std::vector< Row > rows;
+
+    // height of each row in pixels.
+    float lineHeight{0};
+
+    // for getFittedSize(): advance and bounds of the whole text on one line at the
+    // desired size, and the size that fits it in the width.
+    float advance{0};
+    float bounds[4]{0, 0, 0, 0};
+    float fittedSize{0};
+  };
+
+  struct Key
+  {
+    uint64_t textHash;
+    uint32_t textBytes;
+    int font;
+    float size;
+    float spacing;
+    float width;
+    float lineHeight;
+    int align;
+
+    bool operator<(const Key& b) const;
+  };
+
+  static Key makeKey(const char* text, int font, float size, float spacing, float width, float lineHeight, int align);
+
+  // return the layout of text broken into rows no wider than width, as nvgTextBox() would.
+  // lineHeight is the proportional line height as for nvgTextLineHeight().
+  const Layout& getLines(NVGcontext* nvg, const char* text, int font, float size, float spacing, float width,
+                         float lineHeight, int align);
+
+  // return the largest size up to desiredSize at which text fits in width, as
+  // drawTextToFit() does. spacing is letter spacing as a fraction of the size. The
+  // caller must set the font; on a miss, the size and spacing are set to measure.
+  float getFittedSize(NVGcontext* nvg, const char* text, int font, float desiredSize, float spacing, float width);
+
+  void clear() { _entries.clear(); }
+  size_t size() const { return _entries.size(); }
+
+  uint64_t getHits() const { return _hits; }
+  uint64_t getMisses() const { return _misses; }
+  void resetCounters() { _hits = _misses = 0; }
+
+ private:
+  Layout* find(const Key& key);
+  Layout& insert(const Key& key);
+
+  std::map< Key, Layout > _entries;
+  uint64_t _hits{0};
+  uint64_t _misses{0};
+};
+
+} // namespace ml
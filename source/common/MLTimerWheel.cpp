@@ -0,0 +1,145 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLTimerWheel.h"
+
+namespace ml {
+
+void TimerWheel::Deadline::cancel()
+{
+  if(_wheel && isActive())
+  {
+    _wheel->unlink_(this);
+  }
+}
+
+TimerWheel::~TimerWheel()
+{
+  // leave any remaining Deadlines unscheduled, so they don't point at the wheel.
+  for(auto& level : _slots)
+  {
+    for(auto& slot : level)
+    {
+      while(slot) unlink_(slot);
+    }
+  }
+  while(_overflow) unlink_(_overflow);
+}
+
+void TimerWheel::schedule(Deadline& d, int ms)
+{
+  if(d.isActive())
+  {
+    d._wheel->unlink_(&d);
+  }
+  d._wheel = this;
+  d._when = _now + (ms > 1 ? ms : 1);
+  insert_(&d);
+}
+
+void TimerWheel::advance(size_t ms)
+{
+  for(size_t i = 0; i < ms; ++i)
+  {
+    // with nothing scheduled, the time can jump ahead.
+    if(!_size)
+    {
+      _now += ms - i;
+      return;
+    }
+
+    _now++;
+
+    // when the low bits of the time roll over, move the Deadlines in the next slot of
+    // each higher level down to the levels below.
+    if(!(_now & (kSlots - 1)))
+    {
+      int level = 1;
+      for(; level < kLevels; ++level)
+      {
+        cascade_(level);
+        if((_now >> (kSlotBits*level)) & (kSlots - 1)) break;
+      }
+      if(level == kLevels)
+      {
+        Deadline* d = _overflow;
+        _overflow = nullptr;
+        while(d)
+        {
+          Deadline* next = d->_next;
+          _size--;
+          insert_(d);
+          d = next;
+        }
+      }
+    }
+
+    // call everything in the current slot. A Deadline that schedules itself again
+    // always goes to a later slot, so this ends.
+    Deadline*& slot = _slots[0][_now & (kSlots - 1)];
+    while(slot)
+    {
+      Deadline* d = slot;
+      unlink_(d);
+      d->_fn();
+    }
+  }
+}
+
+void TimerWheel::insert_(Deadline* d)
+{
+  // a Deadline goes in the lowest level where its time and now differ only in that
+  // level's bits. It will reach the level below exactly when those bits match.
+  uint64_t diff = d->_when ^ _now;
+  Deadline** list = &_overflow;
+  for(int level = 0; level < kLevels; ++level)
+  {
+    if(diff < (uint64_t(1) << (kSlotBits*(level + 1))))
+    {
+      list = &_slots[level][(d->_when >> (kSlotBits*level)) & (kSlots - 1)];
+      break;
+    }
+  }
+
+  d->_list = list;
+  d->_prev = nullptr;
+  d->_next = *list;
+  if(*list) (*list)->_prev = d;
+  *list = d;
+  _size++;
+}
+
+void TimerWheel::unlink_(Deadline* d)
+{
+  if(d->_prev)
+  {
+    d->_prev->_next = d->_next;
+  }
+  else
+  {
+    *d->_list = d->_next;
+  }
+  if(d->_next) d->_next->_prev = d->_prev;
+  d->_list = nullptr;
+  d->_prev = d->_next = nullptr;
+  _size--;
+}
+
+void TimerWheel::cascade_(int level)
+{
+  Deadline*& slot = _slots[level][(_now >> (kSlotBits*level)) & (kSlots - 1)];
+  Deadline* d = slot;
+  slot = nullptr;
+  while(d)
+  {
+    Deadline* next = d->_next;
+    _size--;
+    insert_(d);
+    d = next;
+  }
+}
+
+} // namespace ml
@@ -0,0 +1,92 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ml {
+
+// TimerWheel: deadlines for Widgets, advanced by the AppView's frame loop.
+//
+// A ml::Timer registers with the shared Timers thread and is checked there every tick,
+// which adds up in a View with hundreds of Widgets that each keep one. A Deadline
+// instead sits in one slot of a hierarchical wheel: four levels of 64 slots of
+// 1, 64, 4096 and 262144 ms. Scheduling, postponing and cancelling a Deadline are
+// constant time and never allocate, and advancing the wheel touches only the slots
+// that come due.
+//
+// Deadlines are called from advance(), so they are only as accurate as the frame
+// rate, and all calls must be made on the thread that animates and draws the View.
+
+class TimerWheel
+{
+ public:
+  // a function to call at some time. The function is set once, when the Deadline is
+  // made, so that scheduling it again costs nothing. A Deadline is cancelled when it
+  // is destroyed, so it can be a member of the Widget that schedules it.
+  class Deadline
+  {
+   public:
+    explicit Deadline(std::function< void() > f) : _fn(std::move(f)) {}
+    ~Deadline() { cancel(); }
+
+    Deadline(const Deadline&) = delete;
+    Deadline& operator=(const Deadline&) = delete;
+
+    void cancel();
+    bool isActive() const { return _list != nullptr; }
+
+   private:
+    friend class TimerWheel;
+    std::function< void() > _fn;
+    TimerWheel* _wheel{nullptr};
+    Deadline** _list{nullptr};
+    Deadline* _prev{nullptr};
+    Deadline* _next{nullptr};
+    uint64_t _when{0};
+  };
+
+  TimerWheel() = default;
+  ~TimerWheel();
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // call the Deadline's function once, the given time in ms from now. If the Deadline
+  // is already scheduled, it is moved to the new time.
+  void schedule(Deadline& d, int ms);
+
+  // advance the time by the given number of ms, calling any Deadlines that come due.
+  // Deadlines may schedule or cancel any Deadline, including themselves.
+  void advance(size_t ms);
+
+  // the time in ms since the wheel was made.
+  uint64_t now() const { return _now; }
+
+  // the number of Deadlines scheduled.
+  size_t size() const { return _size; }
+
+ private:
+  static constexpr int kSlotBits{6};
+  static constexpr int kSlots{1 << kSlotBits};
+  static constexpr int kLevels{4};
+
+  void insert_(Deadline* d);
+  void unlink_(Deadline* d);
+  void cascade_(int level);
+
+  uint64_t _now{0};
+  size_t _size{0};
+  Deadline* _slots[kLevels][kSlots]{};
+
+  // Deadlines further away than the top level can reach.
+  Deadline* _overflow{nullptr};
+};
+
+} // namespace ml
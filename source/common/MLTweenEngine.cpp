@@ -0,0 +1,180 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLTweenEngine.h"
+
+#include <algorithm>
+
+#include "MLWidget.h"
+
+namespace ml {
+
+namespace
+{
+// the projection that gives each easing its curve.
+const Projection& easing(TweenEngine::Easing e)
+{
+  switch(e)
+  {
+    case TweenEngine::kEaseIn: return projections::easeIn;
+    case TweenEngine::kEaseOut: return projections::easeOut;
+    case TweenEngine::kEaseInOut: return projections::easeInOut;
+    case TweenEngine::kEaseInCubic: return projections::easeInCubic;
+    case TweenEngine::kEaseOutCubic: return projections::easeOutCubic;
+    case TweenEngine::kEaseInOutCubic: return projections::easeInOutCubic;
+    case TweenEngine::kLinear:
+    default: return projections::unity;
+  }
+}
+}
+
+TweenEngine::Slot TweenEngine::addTarget(Widget* w, Path property)
+{
+  Target t{w, property, w->getFloatProperty(property)};
+  if(!_freeSlots.empty())
+  {
+    Slot s = _freeSlots.back();
+    _freeSlots.pop_back();
+    _targets[s] = t;
+    _slotsByWidget[w].push_back(s);
+    return s;
+  }
+  _targets.push_back(t);
+  Slot s = Slot(_targets.size() - 1);
+  _slotsByWidget[w].push_back(s);
+  return s;
+}
+
+void TweenEngine::removeTargets(Widget* w)
+{
+  auto it = _slotsByWidget.find(w);
+  if(it == _slotsByWidget.end()) return;
+  for(Slot s : it->second)
+  {
+    Target& t = _targets[s];
+    if(isActive(s)) remove_(s);
+    t.widget = nullptr;
+    t.property = Path();
+    _freeSlots.push_back(s);
+  }
+  _slotsByWidget.erase(it);
+}
+
+void TweenEngine::start(Slot s, float start, float end, int durationMs, Easing e)
+{
+  if(isActive(s)) remove_(s);
+
+  Group& g = _groups[e];
+  uint32_t i = uint32_t(g.slots.size());
+  size_t v = i / kFloatsPerDSPVector;
+  size_t j = i % kFloatsPerDSPVector;
+  if(v == g.start.size())
+  {
+    g.start.emplace_back();
+    g.end.emplace_back();
+    g.time.emplace_back();
+    g.duration.emplace_back();
+    g.values.emplace_back();
+  }
+  g.start[v].getBuffer()[j] = start;
+  g.end[v].getBuffer()[j] = end;
+  g.time[v].getBuffer()[j] = 0.f;
+  g.duration[v].getBuffer()[j] = float(std::max(durationMs, 1));
+  g.slots.push_back(s);
+
+  _targets[s].group = e;
+  _targets[s].index = i;
+}
+
+void TweenEngine::retarget(Slot s, float end, int durationMs, Easing e)
+{
+  start(s, _targets[s].value, end, durationMs, e);
+}
+
+void TweenEngine::stop(Slot s)
+{
+  if(isActive(s)) remove_(s);
+}
+
+void TweenEngine::advance(int elapsedTimeInMs)
+{
+  for(int e = 0; e < kNumEasings; ++e)
+  {
+    Group& g = _groups[e];
+    if(g.slots.empty()) continue;
+    evaluate_(g, Easing(e), float(elapsedTimeInMs));
+
+    // write the values to the Widgets. Going backwards, removing a finished tween only
+    // moves one that has already been written.
+    for(size_t i = g.slots.size(); i-- > 0;)
+    {
+      size_t v = i / kFloatsPerDSPVector;
+      size_t j = i % kFloatsPerDSPVector;
+      bool done = g.time[v].getConstBuffer()[j] >= g.duration[v].getConstBuffer()[j];
+      float value = done ? g.end[v].getConstBuffer()[j] : g.values[v].getConstBuffer()[j];
+
+      Slot s = g.slots[i];
+      Target& t = _targets[s];
+      t.value = value;
+      t.widget->setProperty(t.property, value);
+      t.widget->setDirty(true);
+      if(done) remove_(s);
+    }
+  }
+}
+
+size_t TweenEngine::size() const
+{
+  size_t n{0};
+  for(auto& g : _groups) n += g.slots.size();
+  return n;
+}
+
+void TweenEngine::clear()
+{
+  _targets.clear();
+  _freeSlots.clear();
+  _slotsByWidget.clear();
+  for(auto& g : _groups) g = Group{};
+}
+
+void TweenEngine::evaluate_(Group& g, Easing e, float elapsedTimeInMs)
+{
+  const DSPVector dt(elapsedTimeInMs), one(1.f);
+  const Projection& ease = easing(e);
+  size_t nVectors = (g.slots.size() + kFloatsPerDSPVector - 1)/kFloatsPerDSPVector;
+  for(size_t v = 0; v < nVectors; ++v)
+  {
+    g.time[v] = g.time[v] + dt;
+    DSPVector x = min(g.time[v]/g.duration[v], one);
+    if(e != kLinear) x = map(ease, x);
+    g.values[v] = g.start[v] + (g.end[v] - g.start[v])*x;
+  }
+}
+
+void TweenEngine::remove_(Slot s)
+{
+  // move the group's last tween into the removed one's place.
+  Target& t = _targets[s];
+  Group& g = _groups[t.group];
+  uint32_t last = uint32_t(g.slots.size() - 1);
+  if(t.index != last)
+  {
+    size_t v0 = t.index / kFloatsPerDSPVector, j0 = t.index % kFloatsPerDSPVector;
+    size_t v1 = last / kFloatsPerDSPVector, j1 = last % kFloatsPerDSPVector;
+    for(auto p : {&g.start, &g.end, &g.time, &g.duration, &g.values})
+    {
+      (*p)[v0].getBuffer()[j0] = (*p)[v1].getConstBuffer()[j1];
+    }
+    Slot moved = g.slots[last];
+    g.slots[t.index] = moved;
+    _targets[moved].index = t.index;
+  }
+  g.slots.pop_back();
+  t.group = -1;
+}
+
+} // namespace ml
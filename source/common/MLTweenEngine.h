@@ -0,0 +1,118 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "MLDSPOps.h"
+#include "MLDSPProjections.h"
+#include "MLPath.h"
+
+namespace ml {
+
+class Widget;
+
+// TweenEngine: float property animations for many Widgets, evaluated together once
+// per frame.
+//
+// A Widget registers each property it wants to animate once, getting a slot, and can
+// then start a tween of that property cheaply whenever its target changes. The tweens
+// are stored as structures of arrays in DSPVectors, grouped by easing, so each frame
+// advances and interpolates every tween with a few vector operations per 64 tweens,
+// mapping each group through its projections:: easing. The results are written to the
+// Widgets' properties in one pass, and only those Widgets are marked dirty. This scales to the thousands of simultaneous tweens of a meter bridge or LED
+// wall, where a Widget interpolating in its own animate() would cost a virtual call
+// and a std::function call per tween per frame.
+//
+// All calls must be made on the thread that animates and draws the View.
+
+class TweenEngine
+{
+ public:
+  // the easings, each evaluated with the function of the same name in projections::.
+  enum Easing : uint8_t
+  {
+    kLinear = 0,
+    kEaseIn,
+    kEaseOut,
+    kEaseInOut,
+    kEaseInCubic,
+    kEaseOutCubic,
+    kEaseInOutCubic,
+    kNumEasings
+  };
+
+  using Slot = uint32_t;
+
+  // get a slot for animating the named float property of the Widget.
+  Slot addTarget(Widget* w, Path property);
+
+  // stop the Widget's tweens and release its slots for reuse. Widgets call this when
+  // they are deleted.
+  void removeTargets(Widget* w);
+
+  // animate the slot's property from start to end over durationMs, replacing any
+  // tween of that slot in progress. The property is first set on the next advance().
+  void start(Slot s, float start, float end, int durationMs, Easing e = kLinear);
+
+  // animate the slot's property from the value last set to end, as a meter does when
+  // its level changes.
+  void retarget(Slot s, float end, int durationMs, Easing e = kLinear);
+
+  // stop animating the slot's property, leaving it as it is.
+  void stop(Slot s);
+
+  bool isActive(Slot s) const { return _targets[s].group >= 0; }
+
+  // advance the time of every tween, set the properties and mark their Widgets dirty.
+  // Tweens that reach their end values are removed.
+  void advance(int elapsedTimeInMs);
+
+  // the number of tweens in progress.
+  size_t size() const;
+
+  // remove all tweens and slots, as when the Widgets are about to be deleted.
+  void clear();
+
+ private:
+  struct Target
+  {
+    Widget* widget;
+    Path property;
+    float value{0};
+
+    // the easing group holding the slot's tween and its index there, if any.
+    int group{-1};
+    uint32_t index{0};
+  };
+
+  // the tweens with one easing. Tween i is element i % kFloatsPerDSPVector of
+  // vector i / kFloatsPerDSPVector.
+  struct Group
+  {
+    std::vector< DSPVector > start;
+    std::vector< DSPVector > end;
+    std::vector< DSPVector > time;
+    std::vector< DSPVector > duration;
+    std::vector< DSPVector > values;
+    std::vector< Slot > slots;
+  };
+
+  void evaluate_(Group& g, Easing e, float elapsedTimeInMs);
+  void remove_(Slot s);
+
+  std::vector< Target > _targets;
+  std::vector< Slot > _freeSlots;
+  std::unordered_map< Widget*, std::vector< Slot > > _slotsByWidget;
+  std::array< Group, kNumEasings > _groups;
+};
+
+} // namespace ml
@@ -0,0 +1,77 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include "mldsp.h"
+
+namespace ml {
+
+// StaticVectorProcessBuffer: calls a DSP function on DSPVectorArrays from
+// process() calls of arbitrary frame sizes, like madronalib's VectorProcessBuffer.
+//
+// process() is templated on the type of the callable, so the call for each vector is
+// resolved at compile time and can be inlined. No std::function is needed and
+// nothing is allocated. The processFn signature is:
+//   DSPVectorArray< OUT_CHANS > processFn(const DSPVectorArray< IN_CHANS >& inputs);
+//
+// Latency is one DSPVector: kFloatsPerDSPVector frames.
+
+template< size_t IN_CHANS, size_t OUT_CHANS >
+class StaticVectorProcessBuffer
+{
+  DSPVectorArray< IN_CHANS > _inputVectors;
+  DSPVectorArray< OUT_CHANS > _outputVectors;
+
+  // position of the next frame within the current vectors.
+  size_t _pos{0};
+
+ public:
+  static constexpr size_t kLatencyInFrames{kFloatsPerDSPVector};
+
+  void clear()
+  {
+    _inputVectors = DSPVectorArray< IN_CHANS >();
+    _outputVectors = DSPVectorArray< OUT_CHANS >();
+    _pos = 0;
+  }
+
+  template< typename ProcessFn >
+  void process(const float** inputs, float** outputs, size_t frames, ProcessFn&& processFn)
+  {
+    size_t framesDone{0};
+    while(framesDone < frames)
+    {
+      const size_t n = std::min(frames - framesDone, kFloatsPerDSPVector - _pos);
+
+      float* pIn = _inputVectors.getBuffer() + _pos;
+      for(size_t c = 0; c < IN_CHANS; ++c)
+      {
+        std::memcpy(pIn + c * kFloatsPerDSPVector, inputs[c] + framesDone, n * sizeof(float));
+      }
+
+      const float* pOut = _outputVectors.getConstBuffer() + _pos;
+      for(size_t c = 0; c < OUT_CHANS; ++c)
+      {
+        std::memcpy(outputs[c] + framesDone, pOut + c * kFloatsPerDSPVector, n * sizeof(float));
+      }
+
+      _pos += n;
+      framesDone += n;
+
+      if(_pos == kFloatsPerDSPVector)
+      {
+        _outputVectors = processFn(_inputVectors);
+        _pos = 0;
+      }
+    }
+  }
+};
+
+} // namespace ml
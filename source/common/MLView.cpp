@@ -25,6 +25,13 @@ void View::setDirty(bool d)
   }
    );
   _dirty = d;
+  
+  // a dirty View may have been resized or restyled, so give every Widget a chance to update.
+  if(d)
+  {
+    _animateAll = true;
+    startAnimating();
+  }
 }
 
 // slow reverse lookup of Widget name, for debugging only!
@@ -40,30 +47,29 @@ Path View::_widgetPointerToName(Widget* wPtr)
   return q;
 }
 
+MessageList View::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
+{
+  MessageList r;
+  processGUIEventInto(gc, e, r);
+  return r;
+}
+
 // Process GUI events in this View and keep track of the stillDown widget.
 // TODO allow scale and offset of view
-MessageList View::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
+void View::processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out)
 {
   constexpr bool kDebug{false};
   constexpr float kDragRepositionDistance{1.0f};
-  MessageList r;
-  
-  auto wvec = findWidgetsForEvent(e);
-  if(wvec.size() > 0)
-  {
-    std::sort(wvec.begin(), wvec.end(), [&](Widget* a, Widget* b){
-      return (a->getFloatProperty("z") < b->getFloatProperty("z"));
-    } );
-  }
+  size_t startSize = out.size();
   
   if(_stillDownWidget)
   {
-    auto messagesFromWidget = (_stillDownWidget->processGUIEvent(gc, e));
+    _stillDownWidget->processGUIEventInto(gc, e, out);
     
     // DEBUG
     if(kDebug)
     {
-      if (messagesFromWidget.size() > 0)
+      if (out.size() > startSize)
       {
         auto widgetName = _widgetPointerToName(_stillDownWidget);
         std::cout << e.type << " from (stilldown) " << widgetName << "\n";
@@ -74,17 +80,25 @@ MessageList View::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
     {
       _stillDownWidget = nullptr;
     }
-    r = messagesFromWidget;
   }
   else
   {
+    // the widget under the event, if any, is needed only when no widget is still down.
+    auto& wvec = findWidgetsForEvent(e);
+    if(wvec.size() > 0)
+    {
+      std::sort(wvec.begin(), wvec.end(), [&](Widget* a, Widget* b){
+        return (a->getFloatProperty("z") < b->getFloatProperty("z"));
+      } );
+    }
+    
     // iterate until some widget replies with one or more messages.
     
     for(Widget* w : wvec)
     {
-      auto messagesFromWidget = w->processGUIEvent(gc, e);
+      w->processGUIEventInto(gc, e, out);
       
-      if (messagesFromWidget.size() > 0)
+      if (out.size() > startSize)
       {
         if(kDebug)
         {
@@ -101,18 +115,27 @@ MessageList View::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
         
         // because we break here, widgets block events from widgets behind
         // them, which is intentional.
-        r = messagesFromWidget;
         break;
       }
     }
   }
+}
 
-  return r;
+void View::resetAnimation()
+{
+  _animators.clear();
+  _animateAll = true;
 }
 
 MessageList View::animate(int elapsedTimeInMs, ml::DrawContext dc)
 {
   MessageList v;
+  animateInto(elapsedTimeInMs, dc, v);
+  return v;
+}
+
+void View::animateInto(int elapsedTimeInMs, ml::DrawContext dc, MessageList& v)
+{
   
   // TEST
   testCounter += elapsedTimeInMs;
@@ -123,27 +146,34 @@ MessageList View::animate(int elapsedTimeInMs, ml::DrawContext dc)
     framesSinceTick = 0;
   }
   
-  forEachChild< Widget >
-  (_widgets,
-   [&](Widget& w) {
-    auto wAddr = &w;
-    if(!wAddr)
-    {
-      std::cout << "YIKES!\n";
-      return;
+  if(_animateAll)
+  {
+    // animate every Widget once, and keep the ones that want to go on animating.
+    forEachChild< Widget >
+    (_widgets,
+     [&](Widget& w) {
+      w._scheduler = &_animators;
+      w.animateInto(elapsedTimeInMs, dc, v);
+      if(w.isAnimating()) _animators.add(&w);
     }
-    // std::cout << "anim" << wAddr << "\n";
-    auto retList = w.animate(elapsedTimeInMs, dc);
-    v.append(retList); }
-   );
+     );
+    _animators.removeStopped();
+    _animateAll = false;
+  }
+  else
+  {
+    _animators.animate(elapsedTimeInMs, dc, v);
+  }
   
-  /*
-  forEachChild< Widget >
-  (_widgets,
-   [&](Widget& w) { v.append(w.animate(elapsedTimeInMs, dc)); }
-   );
-  */
-  return v;
+  // keep getting animate() calls from any View containing this one while our Widgets need them.
+  if(_animators.size() > 0)
+  {
+    startAnimating();
+  }
+  else
+  {
+    stopAnimating();
+  }
 }
 
 void View::draw(ml::DrawContext dc)
@@ -156,6 +186,9 @@ void View::draw(ml::DrawContext dc)
   Rect nativeBounds = getLocalBounds(dc, *this);
   Vec2 nativeCenter = getCenter(nativeBounds);
   
+  // any redraw rect is for this View. Its Widgets get their own from the View.
+  dc.redrawRect = Rect();
+  
   // TODO before scaling, is this widget or any children dirty?
   
 
@@ -193,9 +226,10 @@ void View::draw(ml::DrawContext dc)
   setDirty(false);
 }
 
-std::vector< Widget* > View::findWidgetsForEvent(const GUIEvent& e)
+std::vector< Widget* >& View::findWidgetsForEvent(const GUIEvent& e)
 {
-  std::vector< Widget* > widgetsForEvent;
+  std::vector< Widget* >& widgetsForEvent = _eventWidgets;
+  widgetsForEvent.clear();
   
   forEachChild< Widget >
   (_widgets, [&](Widget& w)
@@ -223,9 +257,14 @@ std::vector< Widget* > View::findWidgetsForEvent(const GUIEvent& e)
 // each widget is drawn in View coordinates, with the origin at its top left.
 // if widget is a view, it may draw sub-widgets.
 void View::drawWidget(const ml::DrawContext& dc, Widget* w)
+{
+  drawWidget(dc, w, getPixelBounds(dc, *w));
+}
+
+// draw widget with its bounds already transformed to pixels, as getPixelBounds() returns them.
+void View::drawWidget(const ml::DrawContext& dc, Widget* w, Rect widgetBounds)
 {
   NativeDrawContext* nvg = getNativeContext(dc);
-  Rect widgetBounds = getPixelBounds(dc, *w);
   
   nvgSave(nvg);
   nvgIntersectScissor(nvg, widgetBounds);
@@ -234,7 +273,7 @@ void View::drawWidget(const ml::DrawContext& dc, Widget* w)
   w->setDirty(false);
   nvgRestore(nvg);
   
-  bool kShowWidgetBounds = dc.pProperties->getBoolPropertyWithDefault("draw_widget_bounds", false);
+  bool kShowWidgetBounds = getTheme(dc).drawWidgetBounds;
   if(kShowWidgetBounds)
   {
     nvgBeginPath(nvg);
@@ -244,7 +283,7 @@ void View::drawWidget(const ml::DrawContext& dc, Widget* w)
     nvgStroke(nvg);
   }
   
-  bool kShowDirtyWidgets = dc.pProperties->getBoolPropertyWithDefault("draw_dirty_widgets", false);
+  bool kShowDirtyWidgets = getTheme(dc).drawDirtyWidgets;
   if(kShowDirtyWidgets)
   {
     // make a pulsing color
@@ -279,7 +318,8 @@ void View::drawBackgroundWidget(const ml::DrawContext& dc, Widget* w)
 
 void View::drawAllWidgets(ml::DrawContext dc)
 {
-  std::vector< Widget* > visibleWidgets;
+  std::vector< Widget* >& visibleWidgets = _drawWidgets;
+  visibleWidgets.clear();
   
   forEachChild< Widget >
   (_widgets, [&](Widget& w)
@@ -296,9 +336,17 @@ void View::drawAllWidgets(ml::DrawContext dc)
   // draw all widgets in z order.
   std::sort(visibleWidgets.begin(), visibleWidgets.end(), [&](Widget* a, Widget* b){ return (a->getProperty("z").getFloatValue() > b->getProperty("z").getFloatValue());} );
   
+  // get all the pixel bounds in one batch.
+  _drawBounds.clear();
   for(auto w : visibleWidgets)
   {
-    drawWidget(dc, w);
+    _drawBounds.push_back(w->getBounds());
+  }
+  dc.coords.gridToPixel(_drawBounds.data(), _drawBounds.data(), _drawBounds.size());
+  
+  for(size_t i = 0; i < visibleWidgets.size(); ++i)
+  {
+    drawWidget(dc, visibleWidgets[i], roundToInt(_drawBounds[i]));
   }
 }
 
@@ -309,7 +357,9 @@ struct WidgetGroup
 
   WidgetGroup(Widget& w)
   {
-    bounds = getCurrentAndPreviousBounds(w);
+    // a Widget that has moved must be redrawn wherever it was. Otherwise only the part
+    // that needs it is.
+    bounds = w.getProperty("previous_bounds") ? getCurrentAndPreviousBounds(w) : w.getDirtyBounds();
     widgets.push_back(&w);
   }
   ~WidgetGroup() = default;
@@ -320,11 +370,11 @@ struct WidgetGroup
       widgets.push_back(w);
   }
   
-  void addAndExpand(Widget* w)
+  void addAndExpand(Widget* w, const Rect& widgetBounds)
   {
     if(std::find(widgets.begin(), widgets.end(), w) == widgets.end())
       widgets.push_back(w);
-    bounds = rectEnclosing(bounds, w->getBounds());
+    bounds = rectEnclosing(bounds, widgetBounds);
   }
   
   void mergeWithGroup(const WidgetGroup& wg2)
@@ -343,7 +393,7 @@ void View::drawDirtyWidgets(ml::DrawContext dc)
   NativeDrawContext* nvg = getNativeContext(dc);
   
   // erase periodically when debugging dirty widgets visually
-  bool kShowDirtyWidgets = dc.pProperties->getBoolPropertyWithDefault("draw_dirty_widgets", false);
+  bool kShowDirtyWidgets = getTheme(dc).drawDirtyWidgets;
   if(kShowDirtyWidgets)
   {
     if ((_frameCounter&0x1F) == 0)
@@ -360,86 +410,97 @@ void View::drawDirtyWidgets(ml::DrawContext dc)
   
   std::vector< WidgetGroup > widgetGroups;
   
-  // clear needsDraw flags
+  // clear needsDraw flags, and get the bounds of each visible Widget once for all the
+  // sweeps below. Hidden Widgets get empty bounds, which intersect nothing.
+  _drawWidgets.clear();
+  _drawBounds.clear();
   forEachChild< Widget >
   (_widgets, [&](Widget& w)
-   { w._needsDraw = false; }
+   {
+    w._needsDraw = false;
+    _drawWidgets.push_back(&w);
+    // safety in case widget has not received bounds property yet
+    _drawBounds.push_back(w.getBoolProperty("visible") ? w.getRectProperty("bounds") : Rect());
+  }
    );
   
   size_t sweepIters{0};
-  forEachChild< Widget >
-  (_widgets, [&](Widget& w)
-   {
-      if(w.getBoolProperty("visible") && w.isDirty())
+  for(Widget* pw : _drawWidgets)
+  {
+    Widget& w = *pw;
+    if(w.getBoolProperty("visible") && w.isDirty())
+    {
+      WidgetGroup newGroup(w);
+      w._needsDraw = true;
+      
+      while(1)
       {
-        WidgetGroup newGroup(w);
-        w._needsDraw = true;
-        
-        while(1)
+        sweepIters++;
+        bool changed{false};
+        // if new group overlaps any Widgets w2 that are not marked as
+        // needing drawing, add w2 to the group.
+        for(size_t i = 0; i < _drawWidgets.size(); ++i)
         {
-          sweepIters++;
-          bool changed{false};
-          // if new group overlaps any Widgets w2 that are not marked as
-          // needing drawing, add w2 to the group.
-          forEachChild< Widget >
-          (_widgets, [&](Widget& w2)
-           {
-            // if newGroup intersects visible w2, add to group
-            
-            // safety in case widget has not received bounds property yet
-            Rect w2Bounds = w2.getRectProperty("bounds");
-            
-            if((!w2._needsDraw) && w2.getBoolProperty("visible") && intersectRects(newGroup.bounds, w2Bounds))
-            {
-              w2._needsDraw = true;
-              newGroup.addAndExpand(&w2);
-              changed = true;
-            }
-          }
-           );
-            
-          // if new group overlaps any other group wg2, merge wg2 into new group
-          // and delete wg2 from list
-          for(auto it = widgetGroups.begin(); it != widgetGroups.end(); )
+          // if newGroup intersects visible w2, add to group
+          Widget& w2 = *_drawWidgets[i];
+          if((!w2._needsDraw) && intersectRects(newGroup.bounds, _drawBounds[i]))
           {
-            WidgetGroup& wg2 = *it;
-            if(intersectRects(newGroup.bounds, wg2.bounds))
-            {
-              newGroup.mergeWithGroup(wg2);
-              it = widgetGroups.erase(it);
-              changed = true;
-            }
-            else
-            {
-              it++;
-            }
+            w2._needsDraw = true;
+            newGroup.addAndExpand(&w2, _drawBounds[i]);
+            changed = true;
           }
+        }
           
-          // if no groups can grow any more, we are done collecting.
-          if(!changed) break;
+        // if new group overlaps any other group wg2, merge wg2 into new group
+        // and delete wg2 from list
+        for(auto it = widgetGroups.begin(); it != widgetGroups.end(); )
+        {
+          WidgetGroup& wg2 = *it;
+          if(intersectRects(newGroup.bounds, wg2.bounds))
+          {
+            newGroup.mergeWithGroup(wg2);
+            it = widgetGroups.erase(it);
+            changed = true;
+          }
+          else
+          {
+            it++;
+          }
         }
         
-        // add new group to the group list
-        widgetGroups.push_back(newGroup);
+        // if no groups can grow any more, we are done collecting.
+        if(!changed) break;
       }
-   }
-   );
+      
+      // add new group to the group list
+      widgetGroups.push_back(newGroup);
+    }
+  }
   
   // for each widget group,
   
 //  int g{0};
 //  std::cout << "drawing groups: -------------\n";
   
+  // get the pixel bounds of all the groups in one batch.
+  _groupBounds.clear();
   for(auto& wg : widgetGroups)
   {
+    _groupBounds.push_back(wg.bounds);
+  }
+  dc.coords.gridToPixel(_groupBounds.data(), _groupBounds.data(), _groupBounds.size());
+  
+  for(size_t g = 0; g < widgetGroups.size(); ++g)
+  {
+    auto& wg = widgetGroups[g];
+    
     // sort the widgets by z
     std::sort(wg.widgets.begin(), wg.widgets.end(), [&](Widget* a, Widget* b) {
       return (a->getProperty("z").getFloatValue() > b->getProperty("z").getFloatValue());
     } );
     
     // draw background under this group's rect
-    auto groupBounds = dc.coords.gridToPixel(wg.bounds);
-    groupBounds = grow(groupBounds, 1);
+    auto groupBounds = grow(_groupBounds[g], 1);
 
     nvgSave(nvg);
     nvgIntersectScissor(nvg, groupBounds);
@@ -452,8 +513,12 @@ void View::drawDirtyWidgets(ml::DrawContext dc)
     {
 //      std::cout << "              widget: " << (unsigned long)w << "\n";
 
-      drawWidget(dc, w);
-
+      // only the group's rect has been erased, so tell the Widget which part of it
+      // that is. Widgets outside the rect are redrawn only where they overlap it.
+      Rect widgetBounds = getPixelBounds(dc, *w);
+      DrawContext widgetContext = dc;
+      widgetContext.redrawRect = translate(groupBounds, -getTopLeft(widgetBounds));
+      drawWidget(widgetContext, w, widgetBounds);
     }
     
     nvgRestore(nvg);
@@ -505,14 +570,14 @@ void View::drawBackground(DrawContext dc, ml::Rect nativeRect)
   
   // get image
   NVGpaint paintPattern;
-  auto pr = getRasterImage(dc, "background");
+  auto pr = _background.get(dc, []() { return Path("background"); });
   if(pr)
   {
     paintPattern = nvgImagePattern(nvg, -u, -u, dc.coords.viewSizeInPixels.x() + u, dc.coords.viewSizeInPixels.y() + u, 0, pr->handle, 1.0f);
   }
   else
   {
-    auto bgColor = getColor(dc, "background");
+    auto bgColor = getTheme(dc).background;
     paintPattern = nvgLinearGradient(nvg, 0, -u, 0, dc.coords.viewSizeInPixels.y() + u, bgColor, bgColor);
   }
   
@@ -528,19 +593,27 @@ void View::drawBackground(DrawContext dc, ml::Rect nativeRect)
     nvgFill(nvg);
     
     // draw background Widgets intersecting rect
+    _backgroundBounds.clear();
+    for(const auto& w : _backgroundWidgets)
+    {
+      _backgroundBounds.push_back(w->getBounds());
+    }
+    dc.coords.gridToPixel(_backgroundBounds.data(), _backgroundBounds.data(), _backgroundBounds.size());
+    
+    size_t i{0};
     for(const auto& w : _backgroundWidgets)
     {
-      if(intersectRects(dc.coords.gridToPixel(w->getBounds()), nativeRect))
+      if(intersectRects(_backgroundBounds[i++], nativeRect))
       {
         drawBackgroundWidget(dc, w.get());
       }
     };
     
-    bool drawGrid = dc.pProperties->getBoolPropertyWithDefault("draw_background_grid", false);
+    bool drawGrid = getTheme(dc).drawBackgroundGrid;
     
     if(drawGrid)
     {
-      auto markColor = getColor(dc, "mark");
+      auto markColor = getTheme(dc).mark;
 
       nvgStrokeColor(nvg, markColor);
       nvgStrokeWidth(nvg, 1.0f*dc.coords.displayScale);
@@ -34,19 +34,44 @@ namespace ml
 		void setDirty(bool d) override;
 		MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override;
 		MessageList animate(int elapsedTimeInMs, DrawContext dc) override;
+		void processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out) override;
+		void animateInto(int elapsedTimeInMs, DrawContext dc, MessageList& out) override;
 		void draw(DrawContext d) override;
 
 		// View interface
 		void drawWidget(const DrawContext& dc, Widget* w);
+		void drawWidget(const DrawContext& dc, Widget* w, Rect widgetBounds);
 		void drawAllWidgets(DrawContext dc);
 		void drawDirtyWidgets(DrawContext dc);
 
+		// the number of Widgets in this View that are animating.
+		size_t getNumAnimatingWidgets() const { return _animators.size(); }
+
+		// stop animating all Widgets, and animate every Widget on the next frame. Call
+		// before deleting any of the Widgets.
+		void resetAnimation();
+
 	private:
 		void drawBackgroundWidget(const DrawContext& dc, Widget* w);
 
 		Path _widgetPointerToName(Widget* w);
-		std::vector< Widget* > findWidgetsForEvent(const GUIEvent& e);
+		std::vector< Widget* >& findWidgetsForEvent(const GUIEvent& e);
 		virtual void drawBackground(DrawContext dc, Rect nativeRect);
+		RasterImageHandle _background;
+
+		// only the Widgets in _animators are animated, except on frames where
+		// _animateAll is set.
+		AnimationScheduler _animators{ this };
+		bool _animateAll{ true };
+
+		// scratch space for the Widget bounds transformed in batches while drawing
+		// and for the Widgets under an event, kept to avoid allocating each frame.
+		std::vector< Widget* > _drawWidgets;
+		std::vector< Rect > _drawBounds;
+		std::vector< Rect > _groupBounds;
+		std::vector< Rect > _backgroundBounds;
+		std::vector< Widget* > _eventWidgets;
+
 		size_t _frameCounter{ 0 };
 		int framesSinceTick{ 0 };
 		int testCounter{ 0 };
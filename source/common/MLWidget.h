@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "MLAnimationScheduler.h"
 #include "MLDrawContext.h"
 #include "MLGUICoordinates.h"
 #include "MLGUIEvent.h"
@@ -17,6 +18,9 @@
 #include "MLPropertyTree.h"
 #include "MLMessage.h"
 #include "MLParameters.h"
+#include "MLParameterSchema.h"
+#include "MLTimerWheel.h"
+#include "MLTweenEngine.h"
 
 namespace ml {
 
@@ -36,7 +40,13 @@ namespace ml {
 
         Widget(WithValues p) : PropertyTree(p) {}
         Widget() = default;
-        virtual ~Widget() = default;
+        virtual ~Widget()
+        {
+            // release the slots of any tweened properties, and leave the set of
+            // animating Widgets.
+            if(_tweens) _tweens->removeTargets(this);
+            if(_scheduled && _scheduler) _scheduler->remove(this);
+        }
 
         // engaged should be true when the Widget is currently responding to an ongoing gesture,
         // as a dial does when dragging. Single clicks will not set this flag.
@@ -45,15 +55,36 @@ namespace ml {
         // true if the Widget needs to be redrawn.
         bool _dirty{ true };
 
-        // internal flag for View
+        // internal flags for View
         bool _needsDraw{ false };
+        bool _scheduled{ false };
+
+        // the scheduler of the View containing this Widget, set by the View.
+        AnimationScheduler* _scheduler{ nullptr };
+
+        // the timer wheel of the AppView containing this Widget, set by the AppView.
+        TimerWheel* _timers{ nullptr };
+
+        // the tween engine of the AppView containing this Widget, set by the AppView.
+        // Widgets with many float properties to animate can get slots for them from it
+        // in setupParams(), instead of interpolating in animate().
+        TweenEngine* _tweens{ nullptr };
 
     protected:
 
-        // This is where the values, projections and descriptions of any
-        // program parameters we control are stored.
+        // Widgets animate every frame until they call stopAnimating(), as they did
+        // before there was a scheduler.
+        bool _animating{ true };
+
+        // This is where the values and projections of any program parameters
+        // we control are stored. Descriptions are stored here only for
+        // parameters that were not set up from a ParameterSchema.
         ParameterTree _params;
 
+        // the shared schema our parameters came from, if any. The AppView
+        // that owns this Widget keeps the schema alive.
+        const ParameterSchema* _schema{ nullptr };
+
         // set the value of the named parameter and mark the Widget dirty.
         // this is not virtual. To override its behavior, instead intercept the
         // set_param message in handleMessage in your Widget and do something
@@ -77,6 +108,28 @@ namespace ml {
         virtual void setDirty(bool d) { _dirty = d; }
         bool isDirty() { return _dirty; }
 
+        // Widgets that change over time, or have work to do outside of drawing,
+        // call startAnimating() to get animate() calls every frame and stopAnimating()
+        // once they have settled. Either can be called from any method that runs
+        // on the drawing thread, including animate(). A Widget that overrides animate()
+        // and never calls either is animated every frame.
+        void startAnimating()
+        {
+            _animating = true;
+            if (_scheduler) _scheduler->add(this);
+        }
+        void stopAnimating() { _animating = false; }
+        bool isAnimating() const { return _animating; }
+
+        // call the Deadline's function once, ms from now, from the AppView's frame loop.
+        // Calling again before then postpones it. Deadlines are cheap to schedule and
+        // cancel, so a Widget can do so on every event. Outside of an AppView there is
+        // no timer wheel and nothing is called.
+        void callAfter(TimerWheel::Deadline& d, int ms)
+        {
+            if (_timers) _timers->schedule(d, ms);
+        }
+
         // default implementation of Widget::handleMessage:
         // set a param value or an internal property and mark self as dirty.
         void handleMessage(Message msg, MessageList* /* replyPtr */) override
@@ -139,9 +192,9 @@ namespace ml {
                 // Widgets with multiple parameters must override setupParams().
                 Path paramName(getTextProperty("param"));
 
-                // check that the description from the parameter tree exists.
+                // check that the description from the schema or the parameter tree exists.
                 // if not, make a generic description.
-                if (!_params.descriptions[paramName])
+                if (!hasParameterDescription(paramName))
                 {
                     ParameterDescription defaultDesc;
                     // defaultDesc.setProperty("name", pathToText(paramName));
@@ -158,9 +211,48 @@ namespace ml {
             setParameterInfo(_params, paramName, paramDesc);
         }
 
+        // use the shared description of the parameter from schema instead
+        // of a copy. Only the projection is stored in the Widget.
+        inline void setParameterSchema(Path paramName, const ParameterSchema* schema)
+        {
+            _schema = schema;
+            int id = schema->getID(paramName);
+            if (id >= 0)
+            {
+                _params.projections[paramName] = schema->getProjection(id);
+            }
+        }
+
+        inline const ParameterDescription* getParameterDescription(Path paramName)
+        {
+            if (_schema)
+            {
+                if (auto pDesc = _schema->findDescription(paramName)) return pDesc;
+            }
+            return _params.descriptions[paramName].get();
+        }
+
+        inline bool hasParameterDescription(Path paramName)
+        {
+            return getParameterDescription(paramName) != nullptr;
+        }
+
+        inline Value getNormalizedDefaultParamValue(Path paramName)
+        {
+            if (_schema)
+            {
+                int id = _schema->getID(paramName);
+                if (id >= 0) return _schema->getNormalizedDefault(id);
+            }
+            return getNormalizedDefaultValue(_params, paramName);
+        }
+
         inline void makeProjectionForParameter(Path paramName)
         {
-            _params.projections[paramName] = createParameterProjection(*_params.descriptions[paramName]);
+            if (auto pDesc = getParameterDescription(paramName))
+            {
+                _params.projections[paramName] = createParameterProjection(*pDesc);
+            }
         }
 
         inline Value getParamValue(Path paramName)
@@ -185,9 +277,33 @@ namespace ml {
         // This is separate from draw() because each Widget needs to calculate its new
         // bounds rect before the new frame is drawn.
         //
+        // animate() is called on every Widget in a View on the first frame and
+        // after the View is made dirty, as when it is resized. After that it is
+        // called only while the Widget is animating: see startAnimating(). This
+        // default has nothing to animate, so it stops animating.
+        //
         // Note that invisible Widgets will also be animated. This allows a Widget
         // to show or hide itself in its animate() method. 
-        virtual MessageList animate(int elapsedTimeInMs, DrawContext d) { return MessageList{}; }
+        virtual MessageList animate(int elapsedTimeInMs, DrawContext d)
+        {
+            stopAnimating();
+            return MessageList{};
+        }
+
+        // processGUIEvent() and animate() with an output sink: instead of returning a
+        // new list, append any Messages to out. View calls these with lists it reuses,
+        // so Widgets that send Messages on every frame or drag event can override these
+        // to send them without allocating. The defaults call the versions above, so a
+        // Widget that overrides only these should also override the versions above to
+        // call them, as View does.
+        virtual void processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out)
+        {
+            out.append(processGUIEvent(gc, e));
+        }
+        virtual void animateInto(int elapsedTimeInMs, DrawContext d, MessageList& out)
+        {
+            out.append(animate(elapsedTimeInMs, d));
+        }
 
         // give Widgets a chance to do things like make internal buffers on resize.
         virtual void resize(DrawContext d) {}
@@ -202,6 +318,11 @@ namespace ml {
         inline void setRectProperty(Path p, ml::Rect r) { setProperty(p, rectToMatrix(r)); }
 
         inline ml::Rect getBounds() const { return getRectProperty("bounds"); }
+
+        // the part of the Widget that needs to be redrawn when it is dirty, in the
+        // same coordinates as its bounds. Widgets that can redraw just part of
+        // themselves override this, and draw only the part of dc.redrawRect they need.
+        virtual ml::Rect getDirtyBounds() const { return getBounds(); }
         inline void setBounds(ml::Rect r) { setProperty("bounds", rectToMatrix(r)); }
 
         inline ml::Vec2 getPointProperty(Path p) const { return matrixToVec2(getMatrixProperty(p)); }
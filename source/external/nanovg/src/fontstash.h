@@ -100,6 +100,25 @@ void fonsGetAtlasSize(FONScontext* s, int* width, int* height);
 int fonsExpandAtlas(FONScontext* s, int width, int height);
 // Resets the whole stash.
 int fonsResetAtlas(FONScontext* stash, int width, int height);
+// Rasterizes glyphs once as signed distance fields at the given pixel size, and scales
+// them to the requested sizes, or rasterizes coverage bitmaps at each size if size is 0.
+// Resets the atlas. Returns 0 if distance fields are not supported.
+int fonsSetSDF(FONScontext* stash, int size);
+
+// Creates a stash with the fonts, atlas size and SDF size of src, sharing its font data, so
+// that glyphs can be rasterized on another thread and moved to src with fonsCopyAtlas().
+// src must not be deleted before the new stash. Returns NULL with FreeType.
+FONScontext* fonsCreateShared(FONScontext* src);
+// Replaces the atlas and glyphs of dst with those of src, a stash made from dst by
+// fonsCreateShared(). Returns 0 if their fonts, atlas size or SDF size no longer match.
+int fonsCopyAtlas(FONScontext* dst, FONScontext* src);
+// Returns a hash of the data of all fonts. Each font is hashed once per stash.
+unsigned int fonsHashFonts(FONScontext* s);
+// Writes the atlas and its glyphs to data if size is large enough. Returns the size needed.
+int fonsSaveAtlas(FONScontext* s, unsigned char* data, int size);
+// Replaces the atlas and its glyphs with ones written by fonsSaveAtlas() from a stash with the
+// same fonts, atlas size and SDF size. Returns 0 if they don't match.
+int fonsLoadAtlas(FONScontext* s, const unsigned char* data, int size);
 
 // Add fonts
 int fonsAddFont(FONScontext* s, const char* name, const char* path, int fontIndex);
@@ -198,6 +217,9 @@ typedef struct FONSttFontImpl FONSttFontImpl;
 #ifndef FONS_MAX_FALLBACKS
 #	define FONS_MAX_FALLBACKS 20
 #endif
+#ifndef FONS_SDF_PADDING
+#	define FONS_SDF_PADDING 4
+#endif
 
 static unsigned int fons__hashint(unsigned int a)
 {
@@ -295,6 +317,9 @@ struct FONScontext
 	int nstates;
 	void (*handleError)(void* uptr, int error, int val);
 	void* errorUptr;
+	int sdfSize;
+	unsigned int fontsHash;
+	int nhashedFonts;
 #ifdef FONS_USE_FREETYPE
 	FT_Library ftLibrary;
 #endif
@@ -387,6 +412,20 @@ void fons__tt_renderGlyphBitmap(FONSttFontImpl *font, unsigned char *output, int
 	}
 }
 
+void fons__tt_renderGlyphSDF(FONSttFontImpl *font, unsigned char *output, int outWidth, int outHeight, int outStride,
+							 float scale, int padding, int glyph)
+{
+	// not supported: fonsSetSDF() fails with FreeType.
+	FONS_NOTUSED(font);
+	FONS_NOTUSED(output);
+	FONS_NOTUSED(outWidth);
+	FONS_NOTUSED(outHeight);
+	FONS_NOTUSED(outStride);
+	FONS_NOTUSED(scale);
+	FONS_NOTUSED(padding);
+	FONS_NOTUSED(glyph);
+}
+
 int fons__tt_getGlyphKernAdvance(FONSttFontImpl *font, int glyph1, int glyph2)
 {
 	FT_Vector ftKerning;
@@ -453,6 +492,20 @@ void fons__tt_renderGlyphBitmap(FONSttFontImpl *font, unsigned char *output, int
 	stbtt_MakeGlyphBitmap(&font->font, output, outWidth, outHeight, outStride, scaleX, scaleY, glyph);
 }
 
+void fons__tt_renderGlyphSDF(FONSttFontImpl *font, unsigned char *output, int outWidth, int outHeight, int outStride,
+							 float scale, int padding, int glyph)
+{
+	// the distance is 0.5 at the edge and falls to 0 at padding pixels outside.
+	int x, y, w = 0, h = 0, xoff, yoff;
+	unsigned char* sdf = stbtt_GetGlyphSDF(&font->font, scale, glyph, padding, 128, 128.0f/padding, &w, &h, &xoff, &yoff);
+	for (y = 0; y < outHeight; y++) {
+		for (x = 0; x < outWidth; x++) {
+			output[y*outStride + x] = (sdf != NULL && x < w && y < h) ? sdf[y*w + x] : 0;
+		}
+	}
+	stbtt_FreeSDF(sdf, font->font.userdata);
+}
+
 int fons__tt_getGlyphKernAdvance(FONSttFontImpl *font, int glyph1, int glyph2)
 {
 	return stbtt_GetGlyphKernAdvance(&font->font, glyph1, glyph2);
@@ -1080,7 +1133,7 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	float scale;
 	FONSglyph* glyph = NULL;
 	unsigned int h;
-	float size = isize/10.0f;
+	float size;
 	int pad, added;
 	unsigned char* bdst;
 	unsigned char* dst;
@@ -1090,6 +1143,15 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	if (iblur > 20) iblur = 20;
 	pad = iblur+2;
 
+	// Distance field glyphs are made once at the SDF size and scaled to the requested
+	// size in fons__getQuad().
+	if (stash->sdfSize > 0) {
+		isize = (short)(stash->sdfSize*10);
+		iblur = 0;
+		pad = FONS_SDF_PADDING;
+	}
+	size = isize/10.0f;
+
 	// Reset allocator.
 	stash->nscratch = 0;
 
@@ -1171,8 +1233,13 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	}
 
 	// Rasterize
-	dst = &stash->texData[(glyph->x0+pad) + (glyph->y0+pad) * stash->params.width];
-	fons__tt_renderGlyphBitmap(&renderFont->font, dst, gw-pad*2,gh-pad*2, stash->params.width, scale, scale, g);
+	if (stash->sdfSize > 0) {
+		dst = &stash->texData[glyph->x0 + glyph->y0 * stash->params.width];
+		fons__tt_renderGlyphSDF(&renderFont->font, dst, gw, gh, stash->params.width, scale, pad, g);
+	} else {
+		dst = &stash->texData[(glyph->x0+pad) + (glyph->y0+pad) * stash->params.width];
+		fons__tt_renderGlyphBitmap(&renderFont->font, dst, gw-pad*2,gh-pad*2, stash->params.width, scale, scale, g);
+	}
 
 	// Make sure there is one pixel empty border.
 	dst = &stash->texData[glyph->x0 + glyph->y0 * stash->params.width];
@@ -1210,12 +1277,53 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	return glyph;
 }
 
+static void fons__getSDFQuad(FONScontext* stash, FONSfont* font,
+							  int prevGlyphIndex, FONSglyph* glyph, short isize,
+							  float scale, float spacing, float* x, float* y, FONSquad* q)
+{
+	// The glyph was made at the SDF size, so its offsets and advance are scaled to the
+	// requested size. Positions are not rounded to whole pixels.
+	float r = isize / (stash->sdfSize*10.0f);
+	float xoff = (glyph->xoff+1)*r;
+	float yoff = (glyph->yoff+1)*r;
+	float x0 = (float)(glyph->x0+1);
+	float y0 = (float)(glyph->y0+1);
+	float x1 = (float)(glyph->x1-1);
+	float y1 = (float)(glyph->y1-1);
+
+	if (prevGlyphIndex != -1) {
+		float adv = fons__tt_getGlyphKernAdvance(&font->font, prevGlyphIndex, glyph->index) * scale;
+		*x += adv + spacing;
+	}
+
+	q->x0 = *x + xoff;
+	q->x1 = q->x0 + (x1 - x0)*r;
+	if (stash->params.flags & FONS_ZERO_TOPLEFT) {
+		q->y0 = *y + yoff;
+		q->y1 = q->y0 + (y1 - y0)*r;
+	} else {
+		q->y0 = *y - yoff;
+		q->y1 = q->y0 - (y1 - y0)*r;
+	}
+	q->s0 = x0 * stash->itw;
+	q->t0 = y0 * stash->ith;
+	q->s1 = x1 * stash->itw;
+	q->t1 = y1 * stash->ith;
+
+	*x += glyph->xadv / 10.0f * r;
+}
+
 static void fons__getQuad(FONScontext* stash, FONSfont* font,
-						   int prevGlyphIndex, FONSglyph* glyph,
+						   int prevGlyphIndex, FONSglyph* glyph, short isize,
 						   float scale, float spacing, float* x, float* y, FONSquad* q)
 {
 	float rx,ry,xoff,yoff,x0,y0,x1,y1;
 
+	if (stash->sdfSize > 0) {
+		fons__getSDFQuad(stash, font, prevGlyphIndex, glyph, isize, scale, spacing, x, y, q);
+		return;
+	}
+
 	if (prevGlyphIndex != -1) {
 		float adv = fons__tt_getGlyphKernAdvance(&font->font, prevGlyphIndex, glyph->index) * scale;
 		*x += (int)(adv + spacing + 0.5f);
@@ -1363,7 +1471,7 @@ float fonsDrawText(FONScontext* stash,
 			continue;
 		glyph = fons__getGlyph(stash, font, codepoint, isize, iblur, FONS_GLYPH_BITMAP_REQUIRED);
 		if (glyph != NULL) {
-			fons__getQuad(stash, font, prevGlyphIndex, glyph, scale, state->spacing, &x, &y, &q);
+			fons__getQuad(stash, font, prevGlyphIndex, glyph, isize, scale, state->spacing, &x, &y, &q);
 
 			if (stash->nverts+6 > FONS_VERTEX_COUNT)
 				fons__flush(stash);
@@ -1448,7 +1556,7 @@ int fonsTextIterNext(FONScontext* stash, FONStextIter* iter, FONSquad* quad)
 		glyph = fons__getGlyph(stash, iter->font, iter->codepoint, iter->isize, iter->iblur, iter->bitmapOption);
 		// If the iterator was initialized with FONS_GLYPH_BITMAP_OPTIONAL, then the UV coordinates of the quad will be invalid.
 		if (glyph != NULL)
-			fons__getQuad(stash, iter->font, iter->prevGlyphIndex, glyph, iter->scale, iter->spacing, &iter->nextx, &iter->nexty, quad);
+			fons__getQuad(stash, iter->font, iter->prevGlyphIndex, glyph, iter->isize, iter->scale, iter->spacing, &iter->nextx, &iter->nexty, quad);
 		iter->prevGlyphIndex = glyph != NULL ? glyph->index : -1;
 		break;
 	}
@@ -1545,7 +1653,7 @@ float fonsTextBounds(FONScontext* stash,
 			continue;
 		glyph = fons__getGlyph(stash, font, codepoint, isize, iblur, FONS_GLYPH_BITMAP_OPTIONAL);
 		if (glyph != NULL) {
-			fons__getQuad(stash, font, prevGlyphIndex, glyph, scale, state->spacing, &x, &y, &q);
+			fons__getQuad(stash, font, prevGlyphIndex, glyph, isize, scale, state->spacing, &x, &y, &q);
 			if (q.x0 < minx) minx = q.x0;
 			if (q.x1 > maxx) maxx = q.x1;
 			if (stash->params.flags & FONS_ZERO_TOPLEFT) {
@@ -1788,5 +1896,244 @@ int fonsResetAtlas(FONScontext* stash, int width, int height)
 	return 1;
 }
 
+int fonsSetSDF(FONScontext* stash, int size)
+{
+	if (stash == NULL) return 0;
+#ifdef FONS_USE_FREETYPE
+	if (size > 0) return 0;
+#endif
+	if (size < 0) size = 0;
+	if (size == stash->sdfSize) return 1;
+
+	// Glyphs in the atlas are in the old form.
+	stash->sdfSize = size;
+	return fonsResetAtlas(stash, stash->params.width, stash->params.height);
+}
+
+FONScontext* fonsCreateShared(FONScontext* src)
+{
+#ifdef FONS_USE_FREETYPE
+	FONS_NOTUSED(src);
+	return NULL;
+#else
+	FONSparams params;
+	FONScontext* stash;
+	int i, j;
+
+	if (src == NULL) return NULL;
+	memset(&params, 0, sizeof(params));
+	params.width = src->params.width;
+	params.height = src->params.height;
+	params.flags = src->params.flags;
+	stash = fonsCreateInternal(&params);
+	if (stash == NULL) return NULL;
+	stash->sdfSize = src->sdfSize;
+
+	for (i = 0; i < src->nfonts; i++) {
+		FONSfont* from = src->fonts[i];
+		FONSfont* font;
+		int idx = fons__allocFont(stash);
+		if (idx == FONS_INVALID) {
+			fonsDeleteInternal(stash);
+			return NULL;
+		}
+		font = stash->fonts[idx];
+		memcpy(font->name, from->name, sizeof(font->name));
+		for (j = 0; j < FONS_HASH_LUT_SIZE; ++j)
+			font->lut[j] = -1;
+		font->data = from->data;
+		font->dataSize = from->dataSize;
+		font->freeData = 0;
+		font->font = from->font;
+		font->font.font.userdata = stash;
+		font->ascender = from->ascender;
+		font->descender = from->descender;
+		font->lineh = from->lineh;
+		memcpy(font->fallbacks, from->fallbacks, sizeof(font->fallbacks));
+		font->nfallbacks = from->nfallbacks;
+	}
+	return stash;
+#endif
+}
+
+int fonsCopyAtlas(FONScontext* dst, FONScontext* src)
+{
+	int i;
+	if (dst == NULL || src == NULL) return 0;
+	if (dst->nfonts != src->nfonts || dst->sdfSize != src->sdfSize ||
+		dst->params.width != src->params.width || dst->params.height != src->params.height ||
+		dst->params.flags != src->params.flags)
+		return 0;
+	for (i = 0; i < src->nfonts; i++) {
+		if (dst->fonts[i]->data != src->fonts[i]->data) return 0;
+	}
+
+	// Atlas
+	if (src->atlas->nnodes > dst->atlas->cnodes) {
+		FONSatlasNode* nodes = (FONSatlasNode*)realloc(dst->atlas->nodes, sizeof(FONSatlasNode) * src->atlas->nnodes);
+		if (nodes == NULL) return 0;
+		dst->atlas->nodes = nodes;
+		dst->atlas->cnodes = src->atlas->nnodes;
+	}
+	memcpy(dst->atlas->nodes, src->atlas->nodes, src->atlas->nnodes*sizeof(FONSatlasNode));
+	dst->atlas->nnodes = src->atlas->nnodes;
+
+	// Glyphs, with the same lookup since they are in the same order.
+	for (i = 0; i < src->nfonts; i++) {
+		FONSfont* from = src->fonts[i];
+		FONSfont* font = dst->fonts[i];
+		if (from->nglyphs > font->cglyphs) {
+			FONSglyph* glyphs = (FONSglyph*)realloc(font->glyphs, sizeof(FONSglyph) * from->nglyphs);
+			if (glyphs == NULL) return 0;
+			font->glyphs = glyphs;
+			font->cglyphs = from->nglyphs;
+		}
+		memcpy(font->glyphs, from->glyphs, from->nglyphs*sizeof(FONSglyph));
+		memcpy(font->lut, from->lut, sizeof(font->lut));
+		font->nglyphs = from->nglyphs;
+	}
+
+	// The fonts are the same, so a hash made of them on the other thread can be kept.
+	if (src->nhashedFonts > dst->nhashedFonts) {
+		dst->fontsHash = src->fontsHash;
+		dst->nhashedFonts = src->nhashedFonts;
+	}
+
+	// Texture, all of which needs to be updated.
+	memcpy(dst->texData, src->texData, dst->params.width*dst->params.height);
+	dst->dirtyRect[0] = 0;
+	dst->dirtyRect[1] = 0;
+	dst->dirtyRect[2] = dst->params.width;
+	dst->dirtyRect[3] = dst->params.height;
+	return 1;
+}
+
+unsigned int fonsHashFonts(FONScontext* stash)
+{
+	// FNV-1a, continued over fonts added since the last call.
+	int i, j;
+	if (stash->nhashedFonts == 0)
+		stash->fontsHash = 2166136261u;
+	for (i = stash->nhashedFonts; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		for (j = 0; j < font->dataSize; j++)
+			stash->fontsHash = (stash->fontsHash ^ font->data[j]) * 16777619u;
+	}
+	stash->nhashedFonts = stash->nfonts;
+	return stash->fontsHash;
+}
+
+#define FONS_ATLAS_MAGIC 0x54415346 // "FSAT"
+#define FONS_ATLAS_HEADER_INTS 10
+
+int fonsSaveAtlas(FONScontext* stash, unsigned char* data, int size)
+{
+	int i, needed;
+	int header[FONS_ATLAS_HEADER_INTS];
+	unsigned char* p = data;
+
+	if (stash == NULL) return 0;
+	needed = (int)sizeof(header) + stash->atlas->nnodes*(int)sizeof(FONSatlasNode);
+	for (i = 0; i < stash->nfonts; i++)
+		needed += (int)sizeof(int) + stash->fonts[i]->nglyphs*(int)sizeof(FONSglyph);
+	needed += stash->params.width*stash->params.height;
+	if (data == NULL || size < needed) return needed;
+
+	// The sizes of glyphs and nodes are in the header, so data from a build with
+	// different structs is not loaded.
+	header[0] = FONS_ATLAS_MAGIC;
+	header[1] = (int)sizeof(FONSglyph);
+	header[2] = (int)sizeof(FONSatlasNode);
+	header[3] = stash->sdfSize;
+	header[4] = stash->params.width;
+	header[5] = stash->params.height;
+	header[6] = stash->params.flags;
+	header[7] = stash->nfonts;
+	header[8] = (int)fonsHashFonts(stash);
+	header[9] = stash->atlas->nnodes;
+	memcpy(p, header, sizeof(header)); p += sizeof(header);
+	memcpy(p, stash->atlas->nodes, stash->atlas->nnodes*sizeof(FONSatlasNode));
+	p += stash->atlas->nnodes*sizeof(FONSatlasNode);
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		memcpy(p, &font->nglyphs, sizeof(int)); p += sizeof(int);
+		memcpy(p, font->glyphs, font->nglyphs*sizeof(FONSglyph));
+		p += font->nglyphs*sizeof(FONSglyph);
+	}
+	memcpy(p, stash->texData, stash->params.width*stash->params.height);
+	return needed;
+}
+
+int fonsLoadAtlas(FONScontext* stash, const unsigned char* data, int size)
+{
+	int i, j, n, nnodes;
+	int header[FONS_ATLAS_HEADER_INTS];
+	const unsigned char* p = data;
+	const unsigned char* end = data + size;
+
+	if (stash == NULL || data == NULL || size < (int)sizeof(header)) return 0;
+	memcpy(header, p, sizeof(header)); p += sizeof(header);
+	if (header[0] != FONS_ATLAS_MAGIC || header[1] != (int)sizeof(FONSglyph) ||
+		header[2] != (int)sizeof(FONSatlasNode) || header[3] != stash->sdfSize ||
+		header[4] != stash->params.width || header[5] != stash->params.height ||
+		header[6] != stash->params.flags || header[7] != stash->nfonts ||
+		header[8] != (int)fonsHashFonts(stash))
+		return 0;
+
+	// Check the sizes of everything before changing anything.
+	nnodes = header[9];
+	if (nnodes < 0 || end - p < (long)(nnodes*sizeof(FONSatlasNode))) return 0;
+	p += nnodes*sizeof(FONSatlasNode);
+	for (i = 0; i < stash->nfonts; i++) {
+		if (end - p < (long)sizeof(int)) return 0;
+		memcpy(&n, p, sizeof(int)); p += sizeof(int);
+		if (n < 0 || end - p < (long)(n*sizeof(FONSglyph))) return 0;
+		p += n*sizeof(FONSglyph);
+	}
+	if (end - p != (long)stash->params.width*stash->params.height) return 0;
+
+	// Atlas
+	p = data + sizeof(header);
+	if (nnodes > stash->atlas->cnodes) {
+		FONSatlasNode* nodes = (FONSatlasNode*)realloc(stash->atlas->nodes, sizeof(FONSatlasNode) * nnodes);
+		if (nodes == NULL) return 0;
+		stash->atlas->nodes = nodes;
+		stash->atlas->cnodes = nnodes;
+	}
+	memcpy(stash->atlas->nodes, p, nnodes*sizeof(FONSatlasNode));
+	stash->atlas->nnodes = nnodes;
+	p += nnodes*sizeof(FONSatlasNode);
+
+	// Glyphs, with their lookup rebuilt in the order they were added.
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		memcpy(&n, p, sizeof(int)); p += sizeof(int);
+		if (n > font->cglyphs) {
+			FONSglyph* glyphs = (FONSglyph*)realloc(font->glyphs, sizeof(FONSglyph) * n);
+			if (glyphs == NULL) return 0;
+			font->glyphs = glyphs;
+			font->cglyphs = n;
+		}
+		memcpy(font->glyphs, p, n*sizeof(FONSglyph));
+		p += n*sizeof(FONSglyph);
+		font->nglyphs = n;
+		for (j = 0; j < FONS_HASH_LUT_SIZE; ++j)
+			font->lut[j] = -1;
+		for (j = 0; j < n; ++j) {
+			unsigned int h = fons__hashint(font->glyphs[j].codepoint) & (FONS_HASH_LUT_SIZE-1);
+			font->glyphs[j].next = font->lut[h];
+			font->lut[h] = j;
+		}
+	}
+
+	// Texture, all of which needs to be updated.
+	memcpy(stash->texData, p, stash->params.width*stash->params.height);
+	stash->dirtyRect[0] = 0;
+	stash->dirtyRect[1] = 0;
+	stash->dirtyRect[2] = stash->params.width;
+	stash->dirtyRect[3] = stash->params.height;
+	return 1;
+}
+
 
 #endif
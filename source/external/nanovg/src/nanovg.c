@@ -40,6 +40,7 @@
 #define NVG_INIT_FONTIMAGE_SIZE  512
 #define NVG_MAX_FONTIMAGE_SIZE   2048
 #define NVG_MAX_FONTIMAGES       4
+#define NVG_SDF_FONT_SIZE        48
 
 #define NVG_INIT_COMMANDS_SIZE 256
 #define NVG_INIT_POINTS_SIZE 128
@@ -128,6 +129,7 @@ struct NVGcontext {
 	struct FONScontext* fs;
 	int fontImages[NVG_MAX_FONTIMAGES];
 	int fontImageIdx;
+	int fontImageFlags;
 	int drawCallCount;
 	int fillTriCount;
 	int strokeTriCount;
@@ -343,6 +345,11 @@ NVGparams* nvgInternalParams(NVGcontext* ctx)
     return &ctx->params;
 }
 
+struct FONScontext* nvgInternalFontStash(NVGcontext* ctx)
+{
+	return ctx->fs;
+}
+
 void nvgDeleteInternal(NVGcontext* ctx)
 {
 	int i;
@@ -834,6 +841,18 @@ void nvgUpdateImage(NVGcontext* ctx, int image, const unsigned char* data)
 	ctx->params.renderUpdateTexture(ctx->params.userPtr, image, 0,0, w,h, data);
 }
 
+void nvgUpdateImageRegion(NVGcontext* ctx, int image, int x, int y, int w, int h, const unsigned char* data)
+{
+	int iw, ih;
+	if (!ctx->params.renderGetTextureSize(ctx->params.userPtr, image, &iw, &ih)) return;
+	if (x < 0) { w += x; x = 0; }
+	if (y < 0) { h += y; y = 0; }
+	if (x + w > iw) w = iw - x;
+	if (y + h > ih) h = ih - y;
+	if (w <= 0 || h <= 0) return;
+	ctx->params.renderUpdateTexture(ctx->params.userPtr, image, x,y, w,h, data);
+}
+
 void nvgImageSize(NVGcontext* ctx, int image, int* w, int* h)
 {
 	ctx->params.renderGetTextureSize(ctx->params.userPtr, image, w, h);
@@ -2340,6 +2359,27 @@ void nvgResetFallbackFonts(NVGcontext* ctx, const char* baseFont)
 	nvgResetFallbackFontsId(ctx, nvgFindFont(ctx, baseFont));
 }
 
+int nvgTextSDF(NVGcontext* ctx, int enabled)
+{
+	int i, iw = NVG_INIT_FONTIMAGE_SIZE, ih = NVG_INIT_FONTIMAGE_SIZE;
+	int flags = (enabled && ctx->params.sdfText) ? NVG_IMAGE_SDF : 0;
+	if (flags == ctx->fontImageFlags) return flags != 0;
+	if (fonsSetSDF(ctx->fs, flags ? NVG_SDF_FONT_SIZE : 0) == 0) return 0;
+
+	// The atlas was reset, so replace the font textures with one of the new kind.
+	for (i = 0; i < NVG_MAX_FONTIMAGES; i++) {
+		if (ctx->fontImages[i] != 0) {
+			nvgDeleteImage(ctx, ctx->fontImages[i]);
+			ctx->fontImages[i] = 0;
+		}
+	}
+	fonsGetAtlasSize(ctx->fs, &iw, &ih);
+	ctx->fontImageFlags = flags;
+	ctx->fontImages[0] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, iw, ih, flags, NULL);
+	ctx->fontImageIdx = 0;
+	return flags != 0;
+}
+
 // State setting
 void nvgFontSize(NVGcontext* ctx, float size)
 {
@@ -2429,7 +2469,7 @@ static int nvg__allocTextAtlas(NVGcontext* ctx)
 			iw *= 2;
 		if (iw > NVG_MAX_FONTIMAGE_SIZE || ih > NVG_MAX_FONTIMAGE_SIZE)
 			iw = ih = NVG_MAX_FONTIMAGE_SIZE;
-		ctx->fontImages[ctx->fontImageIdx+1] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, iw, ih, 0, NULL);
+		ctx->fontImages[ctx->fontImageIdx+1] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, iw, ih, ctx->fontImageFlags, NULL);
 	}
 	++ctx->fontImageIdx;
 	fonsResetAtlas(ctx->fs, iw, ih);
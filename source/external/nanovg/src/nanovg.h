@@ -142,6 +142,7 @@ enum NVGimageFlags {
 	NVG_IMAGE_FLIPY				= 1<<3,		// Flips (inverses) image in Y direction when rendered.
 	NVG_IMAGE_PREMULTIPLIED		= 1<<4,		// Image data has premultiplied alpha.
 	NVG_IMAGE_NEAREST			= 1<<5,		// Image interpolation is Nearest instead Linear
+	NVG_IMAGE_SDF				= 1<<6,		// Alpha image is a signed distance field with the edge at 0.5, used for text.
 };
 
 // Begin drawing a new frame
@@ -382,6 +383,10 @@ int nvgCreateImageRGBA(NVGcontext* ctx, int w, int h, int imageFlags, const unsi
 // Updates image data specified by image handle.
 void nvgUpdateImage(NVGcontext* ctx, int image, const unsigned char* data);
 
+// Updates the region x, y, w, h of the image specified by image handle. data holds the
+// whole image, as for nvgUpdateImage(), but only the region is read and uploaded.
+void nvgUpdateImageRegion(NVGcontext* ctx, int image, int x, int y, int w, int h, const unsigned char* data);
+
 // Returns the dimensions of a created image.
 void nvgImageSize(NVGcontext* ctx, int image, int* w, int* h);
 
@@ -571,6 +576,14 @@ void nvgResetFallbackFontsId(NVGcontext* ctx, int baseFont);
 // Resets fallback fonts by name.
 void nvgResetFallbackFonts(NVGcontext* ctx, const char* baseFont);
 
+// Sets whether text is drawn from signed distance field glyphs. Each glyph is then rasterized
+// once, at NVG_SDF_FONT_SIZE, and drawn at any size, so changing font sizes does not fill
+// the atlas with new glyphs. Glyph positions are not rounded to whole pixels, and font blur
+// is ignored. Resets the font atlas, so call outside of nvgBeginFrame()/nvgEndFrame().
+// Returns 1 if text is now drawn with distance fields, or 0 if not, including when the
+// render back-end does not support them.
+int nvgTextSDF(NVGcontext* ctx, int enabled);
+
 // Sets the font size of current text style.
 void nvgFontSize(NVGcontext* ctx, float size);
 
@@ -660,6 +673,7 @@ typedef struct NVGpath NVGpath;
 struct NVGparams {
 	void* userPtr;
 	int edgeAntiAlias;
+	int sdfText;	// nonzero if the back-end draws NVG_IMAGE_SDF textures.
 	int (*renderCreate)(void* uptr);
 	int (*renderCreateTexture)(void* uptr, int type, int w, int h, int imageFlags, const unsigned char* data);
 	int (*renderDeleteTexture)(void* uptr, int image);
@@ -681,6 +695,10 @@ void nvgDeleteInternal(NVGcontext* ctx);
 
 NVGparams* nvgInternalParams(NVGcontext* ctx);
 
+// Returns the font stash of the context, for working on its glyph atlas directly.
+// Call outside of nvgBeginFrame()/nvgEndFrame(), or before any text in a frame.
+struct FONScontext* nvgInternalFontStash(NVGcontext* ctx);
+
 // Debug function to dump cached path data.
 void nvgDebugDumpPathCache(NVGcontext* ctx);
 
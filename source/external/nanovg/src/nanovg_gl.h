@@ -244,6 +244,7 @@ struct GLNVGcontext {
 #endif
 	int fragSize;
 	int flags;
+	int sdfText;
 
 	// Per frame buffers
 	GLNVGcall* calls;
@@ -504,10 +505,22 @@ static void glnvg__getUniforms(GLNVGshader* shader)
 
 static int glnvg__renderCreateTexture(void* uptr, int type, int w, int h, int imageFlags, const unsigned char* data);
 
+// Distance field text needs fwidth(), which GLES2 only has with GL_OES_standard_derivatives.
+static int glnvg__sdfTextSupported(void)
+{
+#if defined NANOVG_GLES2
+	const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+	return extensions != NULL && strstr(extensions, "GL_OES_standard_derivatives") != NULL;
+#else
+	return 1;
+#endif
+}
+
 static int glnvg__renderCreate(void* uptr)
 {
 	GLNVGcontext* gl = (GLNVGcontext*)uptr;
 	int align = 4;
+	const char* opts = NULL;
 
 	// TODO: mediump float may not be enough for GLES2 in iOS.
 	// see the following discussion: https://github.com/memononen/nanovg/issues/46
@@ -553,6 +566,9 @@ static int glnvg__renderCreate(void* uptr)
 		"}\n";
 
 	static const char* fillFragShader =
+		"#if defined(SDF_TEXT) && defined(GL_ES) && __VERSION__ < 300\n"
+		"#extension GL_OES_standard_derivatives : enable\n"
+		"#endif\n"
 		"#ifdef GL_ES\n"
 		"#if defined(GL_FRAGMENT_PRECISION_HIGH) || defined(NANOVG_GL3)\n"
 		" precision highp float;\n"
@@ -666,7 +682,13 @@ static int glnvg__renderCreate(void* uptr)
 		"		vec4 color = texture2D(tex, ftcoord);\n"
 		"#endif\n"
 		"		if (texType == 1) color = vec4(color.xyz*color.w,color.w);"
-		"		if (texType == 2) color = vec4(color.x);"
+		"		if (texType == 2) color = vec4(color.x);\n"
+		"#ifdef SDF_TEXT\n"
+		"		if (texType == 3) {		// Distance field text\n"
+		"			float w = fwidth(color.x)*0.7;\n"
+		"			color = vec4(smoothstep(0.5-w, 0.5+w, color.x));\n"
+		"		}\n"
+		"#endif\n"
 		"		color *= scissor;\n"
 		"		result = color * innerCol;\n"
 		"	}\n"
@@ -679,13 +701,12 @@ static int glnvg__renderCreate(void* uptr)
 
 	glnvg__checkError(gl, "init");
 
-	if (gl->flags & NVG_ANTIALIAS) {
-		if (glnvg__createShader(&gl->shader, "shader", shaderHeader, "#define EDGE_AA 1\n", fillVertShader, fillFragShader) == 0)
-			return 0;
-	} else {
-		if (glnvg__createShader(&gl->shader, "shader", shaderHeader, NULL, fillVertShader, fillFragShader) == 0)
-			return 0;
-	}
+	if (gl->flags & NVG_ANTIALIAS)
+		opts = gl->sdfText ? "#define EDGE_AA 1\n#define SDF_TEXT 1\n" : "#define EDGE_AA 1\n";
+	else
+		opts = gl->sdfText ? "#define SDF_TEXT 1\n" : NULL;
+	if (glnvg__createShader(&gl->shader, "shader", shaderHeader, opts, fillVertShader, fillFragShader) == 0)
+		return 0;
 
 	glnvg__checkError(gl, "uniform locations");
 	glnvg__getUniforms(&gl->shader);
@@ -957,12 +978,12 @@ static int glnvg__convertPaint(GLNVGcontext* gl, GLNVGfragUniforms* frag, NVGpai
 		if (tex->type == NVG_TEXTURE_RGBA)
 			frag->texType = (tex->flags & NVG_IMAGE_PREMULTIPLIED) ? 0 : 1;
 		else
-			frag->texType = 2;
+			frag->texType = (tex->flags & NVG_IMAGE_SDF) ? 3 : 2;
 		#else
 		if (tex->type == NVG_TEXTURE_RGBA)
 			frag->texType = (tex->flags & NVG_IMAGE_PREMULTIPLIED) ? 0.0f : 1.0f;
 		else
-			frag->texType = 2.0f;
+			frag->texType = (tex->flags & NVG_IMAGE_SDF) ? 3.0f : 2.0f;
 		#endif
 //		printf("frag->texType = %d\n", frag->texType);
 	} else {
@@ -1591,8 +1612,10 @@ NVGcontext* nvgCreateGLES3(int flags)
 	params.renderDelete = glnvg__renderDelete;
 	params.userPtr = gl;
 	params.edgeAntiAlias = flags & NVG_ANTIALIAS ? 1 : 0;
+	params.sdfText = glnvg__sdfTextSupported();
 
 	gl->flags = flags;
+	gl->sdfText = params.sdfText;
 
 	ctx = nvgCreateInternal(&params);
 	if (ctx == NULL) goto error;
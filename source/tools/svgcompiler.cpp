@@ -0,0 +1,97 @@
+
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+// svgcompiler: parse an .svg file and write it as compiled PreparedSVG data,
+// so that apps can load their vector images with no XML parsing.
+//
+// usage: svgcompiler <input.svg> <output> [symbol]
+//
+// With a symbol name, the output is a C source file defining that symbol in the
+// resources namespace, in the same form that create_resources in CMakeLists.txt
+// makes for other resources. Without one, the raw compiled data is written.
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#define NANOSVG_IMPLEMENTATION
+#include "MLPreparedSVG.h"
+
+namespace {
+
+bool writeSource(const std::string& path, const std::string& symbol, const std::vector< uint8_t >& data)
+{
+  std::ofstream out(path, std::ios::out | std::ios::trunc);
+  if(!out) return false;
+
+  // compiled data is used in place, so it must be aligned for the float arrays it holds.
+  out << "namespace resources \n{\n";
+  out << "alignas(16) const unsigned char " << symbol << "[] = {";
+  char buf[8];
+  for(size_t i = 0; i < data.size(); ++i)
+  {
+    std::snprintf(buf, sizeof(buf), "0x%02x,", data[i]);
+    out << ((i % 32 == 0) ? "\n" : "") << buf;
+  }
+  out << "};\nconst unsigned " << symbol << "_size = sizeof(" << symbol << ");\n";
+  out << "\n}";
+  return out.good();
+}
+
+bool writeBinary(const std::string& path, const std::vector< uint8_t >& data)
+{
+  std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!out) return false;
+  out.write(reinterpret_cast< const char* >(data.data()), data.size());
+  return out.good();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  if(argc < 3)
+  {
+    std::cout << "usage: svgcompiler <input.svg> <output> [symbol]\n";
+    return 1;
+  }
+
+  std::ifstream in(argv[1], std::ios::in | std::ios::binary);
+  if(!in)
+  {
+    std::cout << "svgcompiler: couldn't read " << argv[1] << "\n";
+    return 1;
+  }
+
+  // nsvgParse() needs a writable, null-terminated copy of the text.
+  std::vector< char > text((std::istreambuf_iterator< char >(in)), std::istreambuf_iterator< char >());
+  text.push_back(0);
+
+  NSVGimage* image = nsvgParse(text.data(), "px", 96);
+  if(!image)
+  {
+    std::cout << "svgcompiler: couldn't parse " << argv[1] << "\n";
+    return 1;
+  }
+
+  std::vector< uint8_t > data;
+  {
+    ml::PreparedSVG prepared(image);
+    data = ml::writeCompiledSVG(prepared);
+  }
+  nsvgDelete(image);
+
+  bool ok = (argc > 3) ? writeSource(argv[2], argv[3], data) : writeBinary(argv[2], data);
+  if(!ok)
+  {
+    std::cout << "svgcompiler: couldn't write " << argv[2] << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -6,6 +6,8 @@
 #include "MLDialBasic.h"
 #include "MLDSPProjections.h"
 
+#include <cstring>
+
 using namespace ml;
 
 // internals
@@ -64,6 +66,175 @@ float DialBasic::_quantizeNormalizedValue(float v)
   }
 }
 
+uint64_t DialBasic::StaticParts::layerKey(const std::vector< float >& normDetents) const
+{
+  // FNV-1a over the values that are drawn.
+  uint64_t h = 14695981039346656037ULL;
+  auto add = [&](float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    for(int i = 0; i < 4; ++i)
+    {
+      h = (h ^ ((bits >> (i*8)) & 0xff))*1099511628211ULL;
+    }
+  };
+  for(float f : {r1, r4, r5, strokeWidth, tickWidth, a0, a1, float(nTicks), color.r, color.g, color.b, color.a})
+  {
+    add(f);
+  }
+  for(float d : normDetents)
+  {
+    add(d);
+  }
+  return h;
+}
+
+int DialBasic::StaticParts::layerRadius() const
+{
+  // room for the outline and ticks plus antialiasing, and at least the smallest
+  // DrawableImage.
+  float r = std::max(r1 + strokeWidth, r5 + tickWidth);
+  return std::max((int)ceilf(r) + 2, 8);
+}
+
+DialBasic::StaticParts DialBasic::_getStaticParts(const ml::DrawContext& dc, bool enabled, float dialSize)
+{
+  int gridSizeInPixels = dc.coords.gridSizeInPixels;
+  float opacity = enabled ? 1.0f : 0.25f;
+  const Theme& theme = getTheme(dc);
+  float strokeWidthMul = getFloatPropertyWithDefault("stroke_width", theme.commonStrokeWidth);
+
+  StaticParts p;
+  float r0 = gridSizeInPixels*dialSize; // master size / radius
+  p.r1 = r0*0.85f;
+  p.r4 = r0*1.00f;
+  p.r5 = r0*1.06f;
+  p.strokeWidth = gridSizeInPixels*strokeWidthMul;
+  p.tickWidth = gridSizeInPixels/128.f;
+  p.a0 = getFloatPropertyWithDefault("a0", kTwoPi*0.375f);
+  p.a1 = getFloatPropertyWithDefault("a1", kTwoPi);
+  p.nTicks = getIntPropertyWithDefault("ticks", 0);
+  p.color = multiplyAlpha(theme.mark, opacity);
+  return p;
+}
+
+void DialBasic::drawStaticParts(NativeDrawContext* nvg, const StaticParts& p, const std::vector< float >& normDetents)
+{
+  for(int pass = 0; pass < kStaticPasses; ++pass)
+  {
+    drawStaticPass(nvg, p, normDetents, pass);
+  }
+}
+
+void DialBasic::drawStaticPass(NativeDrawContext* nvg, const StaticParts& p, const std::vector< float >& normDetents,
+                               int pass)
+{
+  // outline arc
+  if(pass == kOutlinePass)
+  {
+    nvgStrokeColor(nvg, p.color);
+    nvgStrokeWidth(nvg, p.strokeWidth);
+    nvgBeginPath(nvg);
+    nvgArc(nvg, 0, 0, p.r1 + p.strokeWidth*0.5f, p.a0, p.a1, NVG_CW);
+    nvgStroke(nvg);
+  }
+  
+  // ticks
+  if((pass == kTicksPass) && p.nTicks)
+  {
+    auto tick2Angle = projections::linear( {0, p.nTicks - 1.f}, {p.a0, p.a1} );
+    nvgStrokeColor(nvg, p.color);
+    nvgStrokeWidth(nvg, p.tickWidth);
+    nvgBeginPath(nvg);
+    for(int t=0; t<p.nTicks; ++t)
+    {
+      auto a = tick2Angle(t);
+      nvgMoveTo(nvg, nvgAngle2Vec(a)*p.r4);
+      nvgLineTo(nvg, nvgAngle2Vec(a)*p.r5);
+    }
+    nvgStroke(nvg);
+  }
+  
+  // detents
+  if(pass == kDetentsPass)
+  {
+    for(float detentValueNorm : normDetents)
+    {
+      auto a = lerp(p.a0, p.a1, detentValueNorm);
+      nvgStrokeColor(nvg, p.color);
+      nvgStrokeWidth(nvg, p.tickWidth);
+      nvgBeginPath(nvg);
+      nvgMoveTo(nvg, nvgAngle2Vec(a)*p.r4);
+      nvgLineTo(nvg, nvgAngle2Vec(a)*p.r5);
+      nvgStroke(nvg);
+    }
+  }
+}
+
+bool DialBasic::_hasLayer(const ml::DrawContext& dc, uint64_t key) const
+{
+  return _layer && (_layerKey == key) && (_layerResources == dc.pResources) &&
+    (_layerGeneration == dc.pResources->generation);
+}
+
+void DialBasic::_findLayer(const ml::DrawContext& dc, const StaticParts& parts, uint64_t key)
+{
+  auto& shared = dc.pResources->sharedLayers[key];
+  if(!shared.image)
+  {
+    // draw each pass into its own square of a new layer. This happens outside of the
+    // frame, as drawing to any image must.
+    NativeDrawContext* nvg = getNativeContext(dc);
+    int passSize = parts.layerRadius()*2;
+    int layerWidth = passSize*kStaticPasses;
+    shared.image = std::make_unique< DrawableImage >(nvg, layerWidth, passSize);
+    drawToImage(shared.image.get());
+    nvgBeginFrame(nvg, layerWidth, passSize, 1.0f);
+    
+    // clear to transparent
+    nvgGlobalCompositeOperation(nvg, NVG_COPY);
+    nvgBeginPath(nvg);
+    nvgRect(nvg, 0, 0, layerWidth, passSize);
+    nvgFillColor(nvg, rgba(0, 0, 0, 0));
+    nvgFill(nvg);
+    nvgGlobalCompositeOperation(nvg, NVG_SOURCE_OVER);
+    
+    for(int pass = 0; pass < kStaticPasses; ++pass)
+    {
+      nvgSave(nvg);
+      nvgTranslate(nvg, passSize*pass + passSize/2, passSize/2);
+      drawStaticPass(nvg, parts, _normDetents, pass);
+      nvgRestore(nvg);
+    }
+    nvgEndFrame(nvg);
+    drawToImage(nullptr);
+  }
+  shared.users++;
+  _layer = shared.image.get();
+  _layerKey = key;
+  _layerResources = dc.pResources;
+  _layerGeneration = dc.pResources->generation;
+}
+
+void DialBasic::_releaseLayer()
+{
+  // layers from an earlier generation were already removed with the other resources.
+  if(_layer && (_layerGeneration == _layerResources->generation))
+  {
+    auto it = _layerResources->sharedLayers.find(_layerKey);
+    if((it != _layerResources->sharedLayers.end()) && (--it->second.users <= 0))
+    {
+      _layerResources->sharedLayers.erase(it);
+    }
+  }
+  _layer = nullptr;
+}
+
+DialBasic::~DialBasic()
+{
+  _releaseLayer();
+}
+
 // Widget implementation
 
 void DialBasic::setupParams()
@@ -89,7 +260,24 @@ void DialBasic::setupParams()
   Widget::setupParams();
 }
 
+void DialBasic::handleMessage(Message msg, MessageList* replyPtr)
+{
+  Widget::handleMessage(msg, replyPtr);
+  if((hash(head(msg.address)) == hash("set_prop")) && (tail(msg.address) == Path("font")))
+  {
+    // find the font by its new name on the next draw.
+    _font.reset();
+  }
+}
+
 MessageList DialBasic::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
+{
+  MessageList r;
+  processGUIEventInto(gc, e, r);
+  return r;
+}
+
+void DialBasic::processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& r)
 {
   constexpr float kComponentDragScale{-0.005f};
   constexpr float kScrollScale{-0.04f};
@@ -98,9 +286,7 @@ MessageList DialBasic::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
   Path pname{getTextProperty("param")};
   Path paramRequestPath = Path("editor/set_param", pname);
 
-  MessageList r{};
-
-  if(!getBoolPropertyWithDefault("enabled", true)) return r;
+  if(!getBoolPropertyWithDefault("enabled", true)) return;
   bool hasDetents = hasProperty("detents");
   
   auto type = e.type;
@@ -132,7 +318,7 @@ MessageList DialBasic::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
     }
     
     // cancel any engage timer from scrolling
-    _scrollTimer.stop();
+    _scrollDeadline.cancel();
     
     // end any gesture in progress
     if(engaged)
@@ -176,7 +362,7 @@ MessageList DialBasic::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
     Value valueToSend;
     if(e.keyFlags & commandModifier)
     {
-      auto defaultVal = getNormalizedDefaultValue(_params, pname);
+      auto defaultVal = getNormalizedDefaultParamValue(pname);
       setParamValue(pname, defaultVal);
       valueToSend = defaultVal;
     }
@@ -209,33 +395,33 @@ MessageList DialBasic::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
         setParamValue(pname, cookedNormValue);
         if(engaged)
         {
-          _scrollTimer.postpone(milliseconds(kScrollEngageMs));
           r.push_back(Message{paramRequestPath, cookedNormValue});
         }
         else
         {
-          // start timer to turn off the engage flag.
-          // TODO find a good way to send kMsgSequenceEnd back to the editor when the timer expires-
-          // even if we are not drawing.
-          _scrollTimer.callOnce([&]()
-                                { _doEndScroll = true; },
-                                milliseconds(kScrollEngageMs)
-                                );
-
           r.push_back(Message{paramRequestPath, cookedNormValue, kMsgSequenceStart});
           engaged = true;
         }
+        
+        // start or postpone the deadline to turn off the engage flag. When it comes,
+        // the dial animates once to send the sequence end.
+        // TODO find a good way to send kMsgSequenceEnd back to the editor when the deadline
+        // passes even if we are not drawing.
+        callAfter(_scrollDeadline, kScrollEngageMs);
       }
     }
   }
-
-  return r;
 }
 
 MessageList DialBasic::animate(int elapsedTimeInMs, ml::DrawContext dc)
 {
   MessageList r;
-  
+  animateInto(elapsedTimeInMs, dc, r);
+  return r;
+}
+
+void DialBasic::animateInto(int elapsedTimeInMs, ml::DrawContext dc, MessageList& r)
+{
   if(_doEndScroll)
   {
     _doEndScroll = false;
@@ -248,7 +434,20 @@ MessageList DialBasic::animate(int elapsedTimeInMs, ml::DrawContext dc)
       engaged = false;
     }
   }
-  return r;
+  
+  // find the layer holding the static parts if they have changed since it was found.
+  bool enabled = getBoolPropertyWithDefault("enabled", true);
+  float dialSize = getFloatPropertyWithDefault("size", 1.0f);
+  StaticParts parts = _getStaticParts(dc, enabled, dialSize);
+  uint64_t key = parts.layerKey(_normDetents);
+  if(!_hasLayer(dc, key))
+  {
+    _releaseLayer();
+    _findLayer(dc, parts, key);
+  }
+  
+  // nothing more to do until the scroll deadline or a change to the static parts.
+  stopAnimating();
 }
 
 void DialBasic::draw(ml::DrawContext dc)
@@ -264,25 +463,23 @@ void DialBasic::draw(ml::DrawContext dc)
   Rect bounds = getLocalBounds(dc, *this);
 
   // properties
-  bool opaqueBg = getBoolPropertyWithDefault("opaque_bg", false);  
   bool bipolar = getBoolPropertyWithDefault("bipolar", false);
   bool enabled = getBoolPropertyWithDefault("enabled", true);
   float dialSize = getFloatPropertyWithDefault("size", 1.0f);
   float textScale = getFloatPropertyWithDefault("text_size",0.625);
   float normalizedValue = enabled ? currentNormalizedValue : 0.f;
-  float opacity = enabled ? 1.0f : 0.25f;
-  float strokeWidthMul = getFloatPropertyWithDefault("stroke_width", getFloat(dc, "common_stroke_width"));
+  StaticParts staticParts = _getStaticParts(dc, enabled, dialSize);
 
   // colors
-  auto markColor = multiplyAlpha(getColor(dc, "mark"), opacity);
+  auto markColor = staticParts.color;
 
   // angles
   const float kMinAngle = 0.01f;
-  float a0, a1, a2, a3, a4; // angles for track start, track end, fill start, fill end, indicator
+  float a0 = staticParts.a0; // track start
+  float a1 = staticParts.a1; // track end
+  float a2, a3, a4; // fill start, fill end, indicator
   if(bipolar)
   {
-    a0 = getFloatPropertyWithDefault("a0", kTwoPi*0.375f);
-    a1 = getFloatPropertyWithDefault("a1", kTwoPi);
     if(normalizedValue > 0.5f)
     {
       a2 = lerp(a0, a1, 0.5f);
@@ -298,22 +495,16 @@ void DialBasic::draw(ml::DrawContext dc)
   }
   else
   {
-    a0 = getFloatPropertyWithDefault("a0", kTwoPi*0.375f);
-    a1 = getFloatPropertyWithDefault("a1", kTwoPi);
     a2 = a0;
     a3 = lerp(a0, a1, normalizedValue);
     a4 = a3;
   }
 
   // radii
-  float r0 = gridSizeInPixels*dialSize; // master size / radius
-  float r1 = r0*0.85f; // outline radius
-  float r4 = r0*1.00f; // ticks start
-  float r5 = r0*1.06f; // ticks end
+  float r1 = staticParts.r1; // outline radius
 
   // other sizes
-  float strokeWidth = gridSizeInPixels*strokeWidthMul;
-  float tickWidth = gridSizeInPixels/128.f;
+  float strokeWidth = staticParts.strokeWidth;
   float textSize = gridSizeInPixels*dialSize*textScale;
   
   // indicator does not scale with dial size, just grid.
@@ -379,48 +570,29 @@ void DialBasic::draw(ml::DrawContext dc)
       nvgRestore(nvg);
     }
  
-    // outline arc
+    // outline, ticks and detents, from the layer if it's current
+    if(_hasLayer(dc, staticParts.layerKey(_normDetents)))
     {
-      nvgStrokeColor(nvg, markColor);
-      nvgStrokeWidth(nvg, strokeWidth);
-      nvgBeginPath(nvg);
-      nvgArc(nvg, 0, 0, r1 + strokeWidth*0.5f, a0, a1, NVG_CW);
-      nvgStroke(nvg);
-    }
-    
-    // ticks
-    if(int nTicks = getIntPropertyWithDefault("ticks", 0))
-    {
-      auto tick2Angle = projections::linear( {0, nTicks - 1.f}, {a0, a1} );
-      nvgStrokeColor(nvg, markColor);
-      nvgStrokeWidth(nvg, tickWidth);
-      nvgBeginPath(nvg);
-      for(int t=0; t<nTicks; ++t)
+      // each pass is drawn in order, centered on whole pixels so it's drawn without
+      // resampling.
+      int lr = staticParts.layerRadius();
+      bool hasPass[kStaticPasses]{true, staticParts.nTicks > 0, !_normDetents.empty()};
+      for(int pass = 0; pass < kStaticPasses; ++pass)
       {
-        auto a = tick2Angle(t);
-        nvgMoveTo(nvg, nvgAngle2Vec(a)*r4);
-        nvgLineTo(nvg, nvgAngle2Vec(a)*r5);
+        if(!hasPass[pass]) continue;
+        NVGpaint img = nvgImagePattern(nvg, -lr - pass*lr*2, -lr, kStaticPasses*lr*2, lr*2, 0,
+                                       _layer->_buf->image, 1.0f);
+        nvgBeginPath(nvg);
+        nvgRect(nvg, -lr, -lr, lr*2, lr*2);
+        nvgFillPaint(nvg, img);
+        nvgFill(nvg);
       }
-      nvgStroke(nvg);
     }
-    
-    // detents
-    if(hasProperty("detents"))
+    else
     {
-      Matrix detents = getMatrixProperty("detents");
-      size_t nDetents = detents.getSize();
-      for(int i=0; i<nDetents; ++i)
-      {
-        float detentValuePlain = detents[i];
-        float detentValueNorm = _params.projections[paramName].realToNormalized(detentValuePlain);
-        auto a = lerp(a0, a1, detentValueNorm);
-        nvgStrokeColor(nvg, markColor);
-        nvgStrokeWidth(nvg, tickWidth);
-        nvgBeginPath(nvg);
-        nvgMoveTo(nvg, nvgAngle2Vec(a)*r4);
-        nvgLineTo(nvg, nvgAngle2Vec(a)*r5);
-        nvgStroke(nvg);
-      }
+      // draw them directly this time, and find a layer in the next animateInto().
+      drawStaticParts(nvg, staticParts, _normDetents);
+      startAnimating();
     }
     
     // number
@@ -431,11 +603,13 @@ void DialBasic::draw(ml::DrawContext dc)
       int digits(2);
       int precision(2);
       bool doSign{false};
-      TextFragment numText;
-      numText = textUtils::formatNumber(currentPlainValue, digits, precision, doSign);
+      if(currentPlainValue != _numberTextValue)
+      {
+        _numberText = textUtils::formatNumber(currentPlainValue, digits, precision, doSign);
+        _numberTextValue = currentPlainValue;
+      }
       
-      auto fontFace = getTextPropertyWithDefault("font", "d_din");
-      auto font = getFontResource(dc, Path(fontFace));
+      auto font = _font.get(dc, [&]() { return Path(getTextPropertyWithDefault("font", "d_din")); });
       if(font)
       {
         nvgFontFaceId(nvg, font->handle);
@@ -443,7 +617,7 @@ void DialBasic::draw(ml::DrawContext dc)
         nvgTextLetterSpacing(nvg, 1.0f);
         nvgTextAlign(nvg, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
         nvgFillColor(nvg, markColor);
-        nvgText(nvg, -numWidth/4.f, r1*0.125f, numText.getText(), nullptr);
+        nvgText(nvg, -numWidth/4.f, r1*0.125f, _numberText.getText(), nullptr);
       }
     }
     
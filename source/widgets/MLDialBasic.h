@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "MLWidget.h"
 #include "MLValue.h"
 #include "MLTree.h"
@@ -14,23 +16,84 @@ constexpr size_t kWaveformPoints{64};
 
 class DialBasic : public Widget
 {
+public:
+  // the parts of the dial that don't change with its value: the outline, ticks and
+  // detents. They are drawn into a layer in animateInto() whenever they change, and the
+  // layer is drawn under the number on each redraw. Dials with the same parts share a
+  // layer.
+  struct StaticParts
+  {
+    float r1{0}; // outline radius
+    float r4{0}; // ticks start
+    float r5{0}; // ticks end
+    float strokeWidth{0};
+    float tickWidth{0};
+    float a0{0};
+    float a1{0};
+    int nTicks{0};
+    NVGcolor color{};
+
+    // a hash of the parts and the detents, which names the layer holding them.
+    uint64_t layerKey(const std::vector< float >& normDetents) const;
+
+    // half the size of each square pass in the layer, in whole pixels.
+    int layerRadius() const;
+  };
+
+  // the outline, ticks and detents are each drawn with one blend, as they are when drawn
+  // directly, so the layer holds each in a pass of its own, side by side.
+  enum StaticPass
+  {
+    kOutlinePass = 0,
+    kTicksPass,
+    kDetentsPass,
+    kStaticPasses
+  };
+
+  // draw the static parts, or one pass of them, centered at (0, 0).
+  static void drawStaticParts(NativeDrawContext* nvg, const StaticParts& p, const std::vector< float >& normDetents);
+  static void drawStaticPass(NativeDrawContext* nvg, const StaticParts& p, const std::vector< float >& normDetents,
+                             int pass);
+
+private:
   float _dragY1{0.f};
   float _indicatorNormalizedValue{0.f};
   float _trackPositionToNormalValue(Vec2 p);
   float _quantizeNormalizedValue(float v);
   
-  ml::Timer _scrollTimer;
+  // ends a scroll gesture when no scroll events have come for a while.
+  TimerWheel::Deadline _scrollDeadline{[this]() { _doEndScroll = true; startAnimating(); }};
   bool _doEndScroll{false};
   std::vector< float > _normDetents;
   Vec2 _clickAndHoldStartPosition;
 
+  // the formatted number and the value it was made from, so the text is
+  // only made again when the value changes.
+  float _numberTextValue{std::numeric_limits< float >::quiet_NaN()};
+  TextFragment _numberText;
+  FontHandle _font;
+
+  // the shared layer this dial draws its static parts from, if any, with its key, and
+  // the resources and generation it was found in, so it can be let go of later.
+  DrawableImage* _layer{nullptr};
+  uint64_t _layerKey{0};
+  DrawingResources* _layerResources{nullptr};
+  uint32_t _layerGeneration{0};
+  bool _hasLayer(const ml::DrawContext& dc, uint64_t key) const;
+  void _findLayer(const ml::DrawContext& dc, const StaticParts& parts, uint64_t key);
+  void _releaseLayer();
+  StaticParts _getStaticParts(const ml::DrawContext& dc, bool enabled, float dialSize);
+
 public:
   DialBasic(WithValues p) : Widget(p) {}
-  ~DialBasic() {}
+  ~DialBasic();
 
   // Widget implementation
   void setupParams() override;
+  void handleMessage(Message msg, MessageList* replyPtr) override;
   MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override;
+  void processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out) override;
   MessageList animate(int elapsedTimeInMs, ml::DrawContext dc) override;
+  void animateInto(int elapsedTimeInMs, ml::DrawContext dc, MessageList& out) override;
   void draw(ml::DrawContext d) override;
 };
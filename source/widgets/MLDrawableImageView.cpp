@@ -18,7 +18,7 @@ MessageList DrawableImageView::animate(int elapsedTimeInMs, ml::DrawContext dc)
     {
         NativeDrawContext* nvg = getNativeContext(dc);
         Rect bounds = getLocalBounds(dc, *this);
-        auto pImage = getDrawableImage(dc, Path(getTextProperty("image_name")));
+        auto pImage = _image.get(dc, [&]() { return Path(getTextProperty("image_name")); });
 
 
         if (pImage)
@@ -85,7 +85,7 @@ void DrawableImageView::draw(ml::DrawContext dc)
 {
     NativeDrawContext* nvg = getNativeContext(dc);
     Rect bounds = getLocalBounds(dc, *this);
-    auto pImage = getDrawableImage(dc, Path(getTextProperty("image_name")));
+    auto pImage = _image.get(dc, [&]() { return Path(getTextProperty("image_name")); });
 
     if (pImage)
     {
@@ -18,6 +18,7 @@ using namespace ml;
 class DrawableImageView : public Widget
 {
 	bool _initialized{ false };
+	DrawableImageHandle _image;
 
 public:
 	DrawableImageView(WithValues p) : Widget(p)
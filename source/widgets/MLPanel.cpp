@@ -16,7 +16,7 @@ void Panel::draw(ml::DrawContext dc)
   if(enabled)
   {
     // draw panel
-    auto color = getColorPropertyWithDefault("color", getColor(dc, "panel_bg"));
+    auto color = getColorPropertyWithDefault("color", getTheme(dc).panelBackground);
 
     nvgFillColor(nvg, color);
     nvgBeginPath(nvg);
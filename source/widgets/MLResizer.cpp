@@ -82,7 +82,7 @@ void Resizer::draw(ml::DrawContext dc)
   Rect bounds = getLocalBounds(dc, *this);
 
   // TODO color property
-  auto fillColor = engaged ? getColor(dc, "mark_bright") : getColor(dc, "mark");
+  auto fillColor = engaged ? getTheme(dc).markBright : getTheme(dc).mark;
 
   //  paint triangle
   nvgBeginPath(nvg);
@@ -7,6 +7,16 @@
 
 using namespace ml;
 
+void SVGButtonBasic::handleMessage(Message msg, MessageList* replyPtr)
+{
+  Widget::handleMessage(msg, replyPtr);
+  if((hash(head(msg.address)) == hash("set_prop")) && (tail(msg.address) == Path("image")))
+  {
+    // find the image by its new name on the next draw.
+    _vectorImage.reset();
+  }
+}
+
 MessageList SVGButtonBasic::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
 {
   MessageList r{};
@@ -73,38 +83,20 @@ void SVGButtonBasic::draw(ml::DrawContext dc)
   nvgSave(nvg);
   if(opacity < 1.0f) { nvgGlobalAlpha(nvg, opacity); }
   
-  auto image = getVectorImage(dc, getTextProperty("image"));
+  auto image = _vectorImage.get(dc, [&]() { return Path(getTextProperty("image")); });
   
   if(image)
   {
-    // get max rectangle for SVG image
-    float imageAspect = image->width/image->height;
-    float boundsAspect = bounds.width()/bounds.height();
-    
-    float imgScale;
-    Vec2 imageSize{image->width, image->height};
-    
-    if(imageAspect >= boundsAspect)
-    {
-      imgScale = bounds.width()/imageSize.x();
-    }
-    else
-    {
-      imgScale = bounds.height()/imageSize.y();
-    }
-
-    nvgTranslate(nvg, getCenter(bounds) - imageSize*imgScale/2);
-    nvgScale(nvg, imgScale, imgScale);
-    nvgDrawSVG(nvg, image->_pImage);
+    drawVectorImage(dc, image, bounds);
   }
   else
   {
-    auto font = getFontResource(dc, "d_din");
+    auto font = _font.get(dc, []() { return Path("d_din"); });
     if(!font) return;
     float textSize = gridSizeInPixels*0.5f;
     nvgFontFaceId(nvg, font->handle);
     nvgFontSize(nvg, textSize);
-    nvgFillColor(nvg, getColor(dc, "mark"));
+    nvgFillColor(nvg, getTheme(dc).mark);
     drawText(nvg, getCenter(bounds), "?", NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
   }
    nvgRestore(nvg);
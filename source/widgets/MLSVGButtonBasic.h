@@ -14,11 +14,14 @@ class SVGButtonBasic : public Widget
   bool _down{false};
   bool _initialized{false};
   NSVGimage* _image{nullptr};
+  VectorImageHandle _vectorImage;
+  FontHandle _font;
   
 public:
   SVGButtonBasic(WithValues p) : Widget(p) {}
 
   // Widget implementation
+  void handleMessage(Message msg, MessageList* replyPtr) override;
   MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override;
   void draw(ml::DrawContext d) override;
 
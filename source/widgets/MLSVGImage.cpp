@@ -10,35 +10,19 @@
 
 using namespace ml;
 
-void SVGImage::draw(ml::DrawContext dc)
+void SVGImage::handleMessage(Message msg, MessageList* replyPtr)
 {
-  NativeDrawContext* nvg = getNativeContext(dc);
-  Rect bounds = getLocalBounds(dc, *this);
-  auto image = getVectorImage(dc, Path(getTextProperty("image_name")));
-     
-  if(image)
+  Widget::handleMessage(msg, replyPtr);
+  if((hash(head(msg.address)) == hash("set_prop")) && (tail(msg.address) == Path("image_name")))
   {
-    // get max rectangle for SVG image
-    float imageAspect = image->width/image->height;
-    float boundsAspect = bounds.width()/bounds.height();
-    float imgScale;
-    Vec2 imageSize{image->width, image->height};
-
-    if(imageAspect >= boundsAspect)
-    {
-      imgScale = bounds.width()/imageSize.x();
-    }
-    else
-    {
-      imgScale = bounds.height()/imageSize.y();
-    }
-
-    nvgSave(nvg);
-    {
-      nvgTranslate(nvg, getCenter(bounds) - imageSize*imgScale/2);
-      nvgScale(nvg, imgScale, imgScale);
-      nvgDrawSVG(nvg, image->_pImage);
-    }
-    nvgRestore(nvg);
+    // find the image by its new name on the next draw.
+    _image.reset();
   }
 }
+
+void SVGImage::draw(ml::DrawContext dc)
+{
+  Rect bounds = getLocalBounds(dc, *this);
+  auto image = _image.get(dc, [&]() { return Path(getTextProperty("image_name")); });
+  drawVectorImage(dc, image, bounds);
+}
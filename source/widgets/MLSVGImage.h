@@ -19,11 +19,13 @@ class SVGImage : public Widget
 {
   bool _initialized{false};
   //NSVGimage* _image{nullptr};
+  VectorImageHandle _image;
 
 public:
   SVGImage(WithValues p) : Widget(p) {}
 
   // Widget implementation
+  void handleMessage(Message msg, MessageList* replyPtr) override;
   void draw(ml::DrawContext d) override;
   virtual MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override {return MessageList();}
 };
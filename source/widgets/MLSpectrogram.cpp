@@ -0,0 +1,187 @@
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLSpectrogram.h"
+
+#include <algorithm>
+
+using namespace ml;
+
+constexpr int kDefaultHistorySize{512};
+
+Spectrogram::Spectrogram(WithValues p) : Widget(p)
+{
+  size_t fftSize = size_t(std::max(getFloatPropertyWithDefault("fft_size", 1024), 16.f));
+  size_t hop = size_t(std::max(getFloatPropertyWithDefault("hop", 256), 1.f));
+  float floorDb = getFloatPropertyWithDefault("floor_db", -96.f);
+  _analyzer = std::make_unique< SpectrumAnalyzer >(fftSize, hop, floorDb);
+  setupHistory_();
+}
+
+Spectrogram::~Spectrogram()
+{
+  if(_imageResources)
+  {
+    _imageResources->widgetImages.erase(this);
+  }
+}
+
+void Spectrogram::setupHistory_()
+{
+  int historySize = std::max(int(getFloatPropertyWithDefault("history", kDefaultHistorySize)), 1);
+  int rows = int(_analyzer->getNumBins());
+  if((historySize != _historySize) || (rows != _rows))
+  {
+    _historySize = historySize;
+    _rows = rows;
+    _pixels.assign(size_t(_historySize)*_rows*4, 0);
+    _writeColumn = 0;
+    _pendingColumns = 0;
+    if(_imageResources)
+    {
+      // make a texture of the new size on the next draw.
+      _imageResources->widgetImages.erase(this);
+    }
+    _dirty = true;
+  }
+}
+
+void Spectrogram::makePalette_(const ml::DrawContext& dc)
+{
+  NVGcolor background = getTheme(dc).background;
+  NVGcolor color = getColorPropertyWithDefault("color", getTheme(dc).mark);
+  for(int i = 0; i < 256; ++i)
+  {
+    NVGcolor c = nvgLerpRGBA(background, color, i/255.f);
+    _palette[i] = {(unsigned char)(c.r*255.f), (unsigned char)(c.g*255.f), (unsigned char)(c.b*255.f), 255};
+  }
+}
+
+void Spectrogram::writeColumn_(const float* levels)
+{
+  // bin 0 in the bottom row.
+  unsigned char* p = _pixels.data() + (size_t(_rows - 1)*_historySize + _writeColumn)*4;
+  const size_t rowBytes = size_t(_historySize)*4;
+  for(int bin = 0; bin < _rows; ++bin)
+  {
+    const auto& color = _palette[int(ml::clamp(levels[bin], 0.f, 1.f)*255.f)];
+    std::copy(color.begin(), color.end(), p);
+    p -= rowBytes;
+  }
+  _writeColumn = (_writeColumn + 1) % _historySize;
+  _pendingColumns = std::min(_pendingColumns + 1, _historySize);
+}
+
+void Spectrogram::uploadPendingColumns_(NativeDrawContext* nvg, int image)
+{
+  // the new columns end at the write position, and may wrap around the end of the image.
+  int start = (_writeColumn - _pendingColumns + _historySize) % _historySize;
+  int firstCount = std::min(_pendingColumns, _historySize - start);
+  nvgUpdateImageRegion(nvg, image, start, 0, firstCount, _rows, _pixels.data());
+  if(firstCount < _pendingColumns)
+  {
+    nvgUpdateImageRegion(nvg, image, 0, 0, _pendingColumns - firstCount, _rows, _pixels.data());
+  }
+  _pendingColumns = 0;
+}
+
+void Spectrogram::write(const float* samples, size_t n)
+{
+  _analyzer->write(samples, n);
+  startAnimating();
+}
+
+void Spectrogram::handleMessage(Message msg, MessageList* replyPtr)
+{
+  Widget::handleMessage(msg, replyPtr);
+  if(hash(head(msg.address)) == hash("set_prop"))
+  {
+    // the history size may have changed.
+    setupHistory_();
+  }
+}
+
+void Spectrogram::processPublishedSignal(Value sigVal, Symbol sigType)
+{
+  Matrix m = sigVal.getMatrixValue();
+  write(m.getConstBuffer(), m.getSize());
+}
+
+MessageList Spectrogram::animate(int elapsedTimeInMs, ml::DrawContext dc)
+{
+  MessageList r;
+  animateInto(elapsedTimeInMs, dc, r);
+  return r;
+}
+
+void Spectrogram::animateInto(int elapsedTimeInMs, ml::DrawContext dc, MessageList& out)
+{
+  // if the analyzer is idle before the columns are taken, there will be no more until
+  // the next write.
+  bool busy = _analyzer->isBusy();
+  size_t n = _analyzer->takeColumns(_newColumns);
+  if(n)
+  {
+    // if more columns have come than the history holds, only the newest are kept.
+    makePalette_(dc);
+    const size_t bins = _analyzer->getNumBins();
+    for(size_t c = (n > size_t(_historySize)) ? n - _historySize : 0; c < n; ++c)
+    {
+      writeColumn_(_newColumns.data() + c*bins);
+    }
+    _dirty = true;
+  }
+  if(!busy)
+  {
+    stopAnimating();
+  }
+}
+
+void Spectrogram::draw(ml::DrawContext dc)
+{
+  NativeDrawContext* nvg = getNativeContext(dc);
+
+  // the texture is freed with the other resources, after which a new one is made with
+  // the whole history.
+  _imageResources = dc.pResources;
+  auto& texture = dc.pResources->widgetImages[this];
+  if(!texture)
+  {
+    texture = std::make_unique< RasterImage >(nvg, _historySize, _rows, NVG_IMAGE_NEAREST, _pixels.data());
+    _pendingColumns = 0;
+  }
+  else if(_pendingColumns)
+  {
+    uploadPendingColumns_(nvg, texture->handle);
+  }
+  if(!*texture)
+  {
+    texture.reset();
+    return;
+  }
+  int image = texture->handle;
+
+  Rect bounds = getLocalBounds(dc, *this);
+  float opacity = getFloatPropertyWithDefault("opacity", 1.0f);
+  float columnWidth = bounds.width()/_historySize;
+  float split = (_historySize - _writeColumn)*columnWidth;
+
+  // the older columns, from the write position to the end of the image,
+  nvgBeginPath(nvg);
+  nvgRect(nvg, bounds.left(), bounds.top(), split, bounds.height());
+  nvgFillPaint(nvg, nvgImagePattern(nvg, bounds.left() - _writeColumn*columnWidth, bounds.top(), bounds.width(),
+                                    bounds.height(), 0, image, opacity));
+  nvgFill(nvg);
+
+  // then the newer ones from the start of the image.
+  if(_writeColumn > 0)
+  {
+    nvgBeginPath(nvg);
+    nvgRect(nvg, bounds.left() + split, bounds.top(), bounds.width() - split, bounds.height());
+    nvgFillPaint(nvg, nvgImagePattern(nvg, bounds.left() + split, bounds.top(), bounds.width(), bounds.height(), 0,
+                                      image, opacity));
+    nvgFill(nvg);
+  }
+}
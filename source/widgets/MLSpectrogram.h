@@ -0,0 +1,81 @@
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "MLSpectrumAnalyzer.h"
+#include "MLWidget.h"
+
+using namespace ml;
+
+// Spectrogram: a scrolling display of the spectrum of a signal over time, with time
+// from left to right and low frequencies at the bottom.
+//
+// The spectra are made by a SpectrumAnalyzer on its worker thread. Each frame, the
+// columns it has finished are colored into an image of the whole history, used as a
+// ring: the newest column replaces the oldest, and only the columns that are new are
+// uploaded to the texture, with nvgUpdateImageRegion(). The image is drawn as two
+// quads, the older part from the write position to the end of the texture and then
+// the newer part from its start. The work of a frame depends on the number of new
+// columns and not on the length of the history.
+//
+// properties:
+//   signal_name: the published signal to show. Its new samples are passed to
+//     processPublishedSignal() as a Matrix of one channel.
+//   fft_size: the number of samples in each spectrum. Default 1024.
+//   hop: the number of samples between spectra. Default 256.
+//   floor_db: the level drawn as the background color. Default -96.
+//   history: the number of spectra shown. Default 512.
+//   color: the color of the loudest level. Default the theme's mark color.
+//   opacity: default 1.
+
+class Spectrogram : public Widget
+{
+  std::unique_ptr< SpectrumAnalyzer > _analyzer;
+
+  // the columns taken from the analyzer in the last frame.
+  std::vector< float > _newColumns;
+
+  // the image of the history as RGBA pixels, _historySize columns wide with one row per
+  // bin, and the colors of levels from 0 to 255.
+  std::vector< unsigned char > _pixels;
+  std::array< std::array< unsigned char, 4 >, 256 > _palette{};
+  int _historySize{0};
+  int _rows{0};
+
+  // the next column to write, which holds the oldest spectrum, and the number of
+  // columns written since the last upload.
+  int _writeColumn{0};
+  int _pendingColumns{0};
+
+  // the resources holding the texture, which is made on the first draw.
+  DrawingResources* _imageResources{nullptr};
+
+  void setupHistory_();
+  void makePalette_(const ml::DrawContext& dc);
+  void writeColumn_(const float* levels);
+  void uploadPendingColumns_(NativeDrawContext* nvg, int image);
+
+public:
+  Spectrogram(WithValues p);
+  ~Spectrogram();
+
+  // queue samples for analysis.
+  void write(const float* samples, size_t n);
+
+  SpectrumAnalyzer& getAnalyzer() { return *_analyzer; }
+  int getWriteColumn() const { return _writeColumn; }
+
+  // Widget implementation
+  void handleMessage(Message msg, MessageList* replyPtr) override;
+  void processPublishedSignal(Value sigVal, Symbol sigType) override;
+  MessageList animate(int elapsedTimeInMs, ml::DrawContext dc) override;
+  void animateInto(int elapsedTimeInMs, ml::DrawContext dc, MessageList& out) override;
+  void draw(ml::DrawContext d) override;
+};
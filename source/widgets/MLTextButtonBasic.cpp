@@ -61,12 +61,12 @@ void TextButtonBasic::draw(ml::DrawContext dc)
   Rect bounds = getLocalBounds(dc, *this);
   int gridSizeInPixels = dc.coords.gridSizeInPixels;
 
-  auto font = getFontResource(dc, "d_din");
+  auto font = _font.get(dc, []() { return Path("d_din"); });
   if(!font) return;
 
   float opacity = getFloatPropertyWithDefault("opacity", 1.0f);
-  auto markColor = multiplyAlpha(getColor(dc, "mark"), opacity);
-  auto backgroundColor = multiplyAlpha(getColor(dc, "background"), opacity);
+  auto markColor = multiplyAlpha(getTheme(dc).mark, opacity);
+  auto backgroundColor = multiplyAlpha(getTheme(dc).background, opacity);
   
   constexpr float kDisabledAlpha{0.33f};
   if(!getBoolPropertyWithDefault("enabled", true))
@@ -75,7 +75,7 @@ void TextButtonBasic::draw(ml::DrawContext dc)
     backgroundColor = multiplyAlpha(backgroundColor, kDisabledAlpha);
   }
   
-  float strokeWidthMul = getFloatPropertyWithDefault("stroke_width", getFloat(dc, "common_stroke_width"));
+  float strokeWidthMul = getFloatPropertyWithDefault("stroke_width", getTheme(dc).commonStrokeWidth);
   float strokeWidth = gridSizeInPixels*strokeWidthMul;
   float margin = gridSizeInPixels/8.f;
   float textSizeGrid = getFloatPropertyWithDefault("text_size", 0.6f);
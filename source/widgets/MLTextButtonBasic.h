@@ -12,6 +12,7 @@ using namespace ml;
 class TextButtonBasic : public Widget
 {
   bool _down{false};
+  FontHandle _font;
   
 public:
   TextButtonBasic(WithValues p) : Widget(p) {}
@@ -8,24 +8,34 @@
 
 using namespace ml;
 
+void TextLabelBasic::handleMessage(Message msg, MessageList* replyPtr)
+{
+  Widget::handleMessage(msg, replyPtr);
+  if((hash(head(msg.address)) == hash("set_prop")) && (tail(msg.address) == Path("font")))
+  {
+    // find the font by its new name on the next draw.
+    _font.reset();
+  }
+}
+
 void TextLabelBasic::draw(ml::DrawContext dc)
 {
   NativeDrawContext* nvg = getNativeContext(dc);
   Rect bounds = getLocalBounds(dc, *this);
   int gridSizeInPixels = dc.coords.gridSizeInPixels;
   
-  auto fontFace = getTextPropertyWithDefault("font", "d_din");
   auto text = getTextProperty("text");
   
-  auto font = getFontResource(dc, Path(fontFace));
+  auto font = _font.get(dc, [&]() { return Path(getTextPropertyWithDefault("font", "d_din")); });
   if(!font) return;
   
   float textSize = gridSizeInPixels*getFloatPropertyWithDefault("text_size", 0.25f);
   float spacing = getFloatPropertyWithDefault("text_spacing", 0.f);
   bool multiLine = getBoolProperty("multi_line");
+  bool fit = getBoolPropertyWithDefault("fit", false);
 
   float opacity = getFloatPropertyWithDefault("opacity", 1.f);
-  auto tc = getColorPropertyWithDefault("text_color", getColor(dc, "mark"));
+  auto tc = getColorPropertyWithDefault("text_color", getTheme(dc).mark);
   auto textColor = multiplyAlpha(tc, opacity);
 
   auto hAlign = NVG_ALIGN_LEFT;
@@ -64,7 +74,12 @@ void TextLabelBasic::draw(ml::DrawContext dc)
   
   if(multiLine)
   {
-    drawTextBox(nvg, {textX, textY}, bounds.width(), text, hAlign | vAlign);
+    drawTextBox(nvg, dc.pResources->textLayouts, font->handle, textSize, textSize*spacing, {textX, textY}, bounds.width(), text, hAlign | vAlign);
+  }
+  else if(fit)
+  {
+    // shrink the text if it is wider than the bounds.
+    drawTextToFit(nvg, dc.pResources->textLayouts, font->handle, text, {textX, textY}, textSize, spacing, bounds.width(), hAlign | vAlign);
   }
   else
   {
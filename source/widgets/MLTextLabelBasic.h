@@ -11,10 +11,13 @@ using namespace ml;
 
 class TextLabelBasic : public Widget
 {
+  FontHandle _font;
+
 public:
   TextLabelBasic(WithValues p) : Widget(p) {}
 
   // Widget implementation
+  void handleMessage(Message msg, MessageList* replyPtr) override;
   MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override { return MessageList(); }
   void draw(ml::DrawContext d) override;
 };
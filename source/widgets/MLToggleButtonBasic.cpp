@@ -82,7 +82,7 @@ void ToggleButtonBasic::draw(ml::DrawContext dc)
   float buttonSize = getFloatPropertyWithDefault("size", 0.125f);
 
   // colors
-  auto markColor = multiplyAlpha(getColor(dc, "mark"), opacity);
+  auto markColor = multiplyAlpha(getTheme(dc).mark, opacity);
   auto fillColor = multiplyAlpha(getColorProperty("color"), 0.75f*opacity);
   auto indicatorColor = multiplyAlpha(getColorProperty("indicator"), opacity);
   auto fillColor2 = multiplyAlpha(getColorPropertyWithDefault("color2", nvgLerpRGBA(fillColor, indicatorColor, 0.75f)), opacity);
@@ -102,7 +102,7 @@ void ToggleButtonBasic::draw(ml::DrawContext dc)
     nvgRect(nvg, buttonRect);
     if(!currentValue)
     {
-      auto trackColor = getColor(dc, "track");
+      auto trackColor = getTheme(dc).track;
       nvgFillColor(nvg, trackColor);
       nvgFill(nvg);
     }
@@ -0,0 +1,84 @@
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLWaveform.h"
+
+#include <algorithm>
+
+using namespace ml;
+
+constexpr int kDefaultBufferSize{65536};
+
+Waveform::Waveform(WithValues p) : Widget(p)
+{
+  setupPyramid_();
+}
+
+void Waveform::setupPyramid_()
+{
+  size_t bufferSize = size_t(std::max(getFloatPropertyWithDefault("buffer_size", kDefaultBufferSize), 1.f));
+  if(_pyramid.capacity() < bufferSize)
+  {
+    _pyramid.resize(bufferSize);
+  }
+}
+
+void Waveform::write(const float* samples, size_t n)
+{
+  _pyramid.write(samples, n);
+  _dirty = true;
+}
+
+void Waveform::handleMessage(Message msg, MessageList* replyPtr)
+{
+  Widget::handleMessage(msg, replyPtr);
+  if(hash(head(msg.address)) == hash("set_prop"))
+  {
+    // the buffer size may have changed.
+    setupPyramid_();
+  }
+}
+
+void Waveform::processPublishedSignal(Value sigVal, Symbol sigType)
+{
+  Matrix m = sigVal.getMatrixValue();
+  write(m.getConstBuffer(), m.getSize());
+}
+
+void Waveform::draw(ml::DrawContext dc)
+{
+  NativeDrawContext* nvg = getNativeContext(dc);
+  Rect bounds = getLocalBounds(dc, *this);
+  size_t columns = size_t(std::max(bounds.width(), 0.f));
+  if(!columns) return;
+
+  // one span per pixel column, from the pyramid level that fits.
+  _columnMins.resize(columns);
+  _columnMaxes.resize(columns);
+  size_t window = size_t(std::max(getFloatPropertyWithDefault("window", float(_pyramid.capacity())), 1.f));
+  _pyramid.getColumns(window, columns, _columnMins.data(), _columnMaxes.data());
+
+  float opacity = getFloatPropertyWithDefault("opacity", 1.0f);
+  auto color = multiplyAlpha(getColorPropertyWithDefault("color", getTheme(dc).mark), opacity);
+  float range = getFloatPropertyWithDefault("range", 1.0f);
+  float center = bounds.top() + bounds.height()*0.5f;
+  float scale = bounds.height()*0.5f/range;
+
+  // each span is at least a pixel high, so quiet parts of the signal still show.
+  nvgBeginPath(nvg);
+  for(size_t c = 0; c < columns; ++c)
+  {
+    float x = bounds.left() + c + 0.5f;
+    float y0 = ml::clamp(center - _columnMaxes[c]*scale, bounds.top(), bounds.bottom());
+    float y1 = ml::clamp(center - _columnMins[c]*scale, bounds.top(), bounds.bottom());
+    float grow = std::max(0.5f - (y1 - y0)*0.5f, 0.f);
+    nvgMoveTo(nvg, x, y0 - grow);
+    nvgLineTo(nvg, x, y1 + grow);
+  }
+  nvgLineCap(nvg, NVG_BUTT);
+  nvgStrokeWidth(nvg, 1.0f);
+  nvgStrokeColor(nvg, color);
+  nvgStroke(nvg);
+}
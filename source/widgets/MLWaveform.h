@@ -0,0 +1,54 @@
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <vector>
+
+#include "MLMinMaxPyramid.h"
+#include "MLWidget.h"
+
+using namespace ml;
+
+// Waveform: a scope view of the recent history of a signal.
+//
+// The samples are kept in a MinMaxPyramid as they arrive, and each frame the window
+// shown is drawn as one vertical span from min to max per pixel column, all in one
+// stroke. The number of vertices is set by the width of the Widget, not by the
+// number of samples in the window, so a window of seconds costs no more to draw than
+// a window of a few milliseconds.
+//
+// properties:
+//   signal_name: the published signal to show. Its new samples are passed to
+//     processPublishedSignal() as a Matrix of one channel.
+//   buffer_size: the number of samples of history kept. Default 65536.
+//   window: the number of the most recent samples shown. Default buffer_size.
+//   range: the signal value at the top edge. -range is at the bottom. Default 1.
+//   color: default the theme's mark color.
+//   opacity: default 1.
+
+class Waveform : public Widget
+{
+  MinMaxPyramid _pyramid;
+
+  // the spans of the last frame, kept to avoid allocating.
+  std::vector< float > _columnMins;
+  std::vector< float > _columnMaxes;
+
+  void setupPyramid_();
+
+public:
+  Waveform(WithValues p);
+
+  // append samples to the history and mark the Widget to be redrawn.
+  void write(const float* samples, size_t n);
+
+  const MinMaxPyramid& getPyramid() const { return _pyramid; }
+
+  // Widget implementation
+  void handleMessage(Message msg, MessageList* replyPtr) override;
+  void processPublishedSignal(Value sigVal, Symbol sigType) override;
+  void draw(ml::DrawContext d) override;
+};
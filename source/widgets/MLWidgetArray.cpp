@@ -0,0 +1,311 @@
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#include "MLWidgetArray.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace ml;
+
+WidgetArray::WidgetArray(WithValues p) : Widget(p)
+{
+  setupCells_();
+}
+
+void WidgetArray::setupCells_()
+{
+  int rows = std::max(0, int(getFloatPropertyWithDefault("rows", 1)));
+  int columns = std::max(0, int(getFloatPropertyWithDefault("columns", 1)));
+  Path paramBase{getTextProperty("param")};
+
+  if((rows != _rows) || (columns != _columns))
+  {
+    _rows = rows;
+    _columns = columns;
+    _values.resize(rows*columns);
+    _cellDirty.resize(rows*columns);
+    _cellParams.clear();
+  }
+
+  if(_cellParams.empty() || !(paramBase == _paramBase))
+  {
+    _paramBase = paramBase;
+    _cellParams.clear();
+    for(size_t i = 0; i < _values.size(); ++i)
+    {
+      _cellParams.push_back(Path(_paramBase, Path(textUtils::naturalNumberToText(int(i)))));
+    }
+  }
+  markAllCellsDirty_();
+}
+
+int WidgetArray::getCellIndex_(Path paramName) const
+{
+  if(paramName.getSize() != _paramBase.getSize() + 1) return -1;
+  if(!paramName.beginsWith(_paramBase)) return -1;
+
+  int i = std::atoi(pathToText(lastN(paramName, 1)).getText());
+  if((i < 0) || (i >= int(_cellParams.size()))) return -1;
+  return (_cellParams[i] == paramName) ? i : -1;
+}
+
+void WidgetArray::markCellDirty_(int i)
+{
+  if(_cellDirty[i]) return;
+  _cellDirty[i] = true;
+
+  int row = i / _columns;
+  int column = i % _columns;
+  if(_dirtyRow1 > _dirtyRow0)
+  {
+    _dirtyRow0 = std::min(_dirtyRow0, row);
+    _dirtyRow1 = std::max(_dirtyRow1, row + 1);
+    _dirtyColumn0 = std::min(_dirtyColumn0, column);
+    _dirtyColumn1 = std::max(_dirtyColumn1, column + 1);
+  }
+  else
+  {
+    _dirtyRow0 = row;
+    _dirtyRow1 = row + 1;
+    _dirtyColumn0 = column;
+    _dirtyColumn1 = column + 1;
+  }
+  _dirty = true;
+}
+
+void WidgetArray::markAllCellsDirty_()
+{
+  std::fill(_cellDirty.begin(), _cellDirty.end(), true);
+  _dirtyRow0 = _dirtyColumn0 = 0;
+  _dirtyRow1 = _rows;
+  _dirtyColumn1 = _columns;
+  _dirty = true;
+}
+
+void WidgetArray::clearDirtyCells_()
+{
+  // clear only the flags that can be set.
+  for(int row = _dirtyRow0; row < _dirtyRow1; ++row)
+  {
+    auto rowStart = _cellDirty.begin() + row*_columns;
+    std::fill(rowStart + _dirtyColumn0, rowStart + _dirtyColumn1, false);
+  }
+  _dirtyRow0 = _dirtyRow1 = _dirtyColumn0 = _dirtyColumn1 = 0;
+}
+
+int WidgetArray::getCellAt(Vec2 p) const
+{
+  Rect bounds = getBounds();
+  if(!within(p, bounds) || _values.empty()) return -1;
+
+  int column = int((p.x() - bounds.left())*_columns/bounds.width());
+  int row = int((p.y() - bounds.top())*_rows/bounds.height());
+  column = std::min(column, _columns - 1);
+  row = std::min(row, _rows - 1);
+  return row*_columns + column;
+}
+
+Rect WidgetArray::getCellBounds(int i) const
+{
+  Rect bounds = getBounds();
+  float cellWidth = bounds.width()/_columns;
+  float cellHeight = bounds.height()/_rows;
+  return Rect(bounds.left() + (i % _columns)*cellWidth, bounds.top() + (i / _columns)*cellHeight, cellWidth, cellHeight);
+}
+
+void WidgetArray::setCellValue(int i, float v)
+{
+  if(_values[i] != v)
+  {
+    _values[i] = v;
+    markCellDirty_(i);
+  }
+}
+
+bool WidgetArray::knowsParam(Path paramName)
+{
+  return getCellIndex_(paramName) >= 0;
+}
+
+void WidgetArray::setupParams()
+{
+  // the cells keep their own normalized values, so no parameter descriptions are needed.
+  setupCells_();
+}
+
+void WidgetArray::handleMessage(Message msg, MessageList* replyPtr)
+{
+  switch(hash(head(msg.address)))
+  {
+    case(hash("set_param")):
+    {
+      int i = getCellIndex_(tail(msg.address));
+      if(i >= 0)
+      {
+        setCellValue(i, msg.value.getFloatValue());
+        return;
+      }
+      break;
+    }
+    case(hash("set_prop")):
+    {
+      // the grid or its look may have changed.
+      Widget::handleMessage(msg, replyPtr);
+      setupCells_();
+      return;
+    }
+    default:
+    {
+      break;
+    }
+  }
+  Widget::handleMessage(msg, replyPtr);
+}
+
+MessageList WidgetArray::processGUIEvent(const GUICoordinates& gc, GUIEvent e)
+{
+  MessageList r;
+  processGUIEventInto(gc, e, r);
+  return r;
+}
+
+void WidgetArray::processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out)
+{
+  if(!getBoolPropertyWithDefault("enabled", true))
+  {
+    // push ack to eat the event if not enabled
+    out.push_back(Message{"ack"});
+    return;
+  }
+
+  auto type = e.type;
+  int i = getCellAt(e.position);
+
+  if(type == "down")
+  {
+    if(i >= 0)
+    {
+      // toggle the cell, and paint its new value over any cells dragged across.
+      _paintValue = getCellValue(i) ? 0.f : 1.f;
+      setCellValue(i, _paintValue);
+      out.push_back(Message{Path("editor/set_param", _cellParams[i]), _paintValue});
+    }
+  }
+  else if(type == "drag")
+  {
+    if((i >= 0) && (_paintValue >= 0.f) && (_values[i] != _paintValue))
+    {
+      setCellValue(i, _paintValue);
+      out.push_back(Message{Path("editor/set_param", _cellParams[i]), _paintValue});
+    }
+  }
+  else if(type == "up")
+  {
+    _paintValue = -1.f;
+  }
+}
+
+void WidgetArray::setDirty(bool d)
+{
+  if(d)
+  {
+    markAllCellsDirty_();
+  }
+  else
+  {
+    clearDirtyCells_();
+    _dirty = false;
+  }
+}
+
+Rect WidgetArray::getDirtyBounds() const
+{
+  if(_dirtyRow1 <= _dirtyRow0) return getBounds();
+
+  Rect bounds = getBounds();
+  float cellWidth = bounds.width()/_columns;
+  float cellHeight = bounds.height()/_rows;
+  return Rect(bounds.left() + _dirtyColumn0*cellWidth, bounds.top() + _dirtyRow0*cellHeight,
+              (_dirtyColumn1 - _dirtyColumn0)*cellWidth, (_dirtyRow1 - _dirtyRow0)*cellHeight);
+}
+
+void WidgetArray::draw(ml::DrawContext dc)
+{
+  if(_values.empty()) return;
+
+  NativeDrawContext* nvg = getNativeContext(dc);
+  const int gridSizeInPixels = dc.coords.gridSizeInPixels;
+  Rect bounds = getLocalBounds(dc, *this);
+  float cellWidth = bounds.width()/_columns;
+  float cellHeight = bounds.height()/_rows;
+
+  // the cells to draw: those the View is redrawing, or all of them.
+  int column0{0}, column1{_columns}, row0{0}, row1{_rows};
+  const Rect& redraw = dc.redrawRect;
+  if(redraw.area() > 0.f)
+  {
+    column0 = ml::clamp(int(std::floor(redraw.left()/cellWidth)), 0, _columns);
+    column1 = ml::clamp(int(std::ceil(redraw.right()/cellWidth)), 0, _columns);
+    row0 = ml::clamp(int(std::floor(redraw.top()/cellHeight)), 0, _rows);
+    row1 = ml::clamp(int(std::ceil(redraw.bottom()/cellHeight)), 0, _rows);
+  }
+
+  // colors, once for all the cells.
+  bool enabled = getBoolPropertyWithDefault("enabled", true);
+  float opacity = getFloatPropertyWithDefault("opacity", 1.0f);
+  opacity *= enabled ? 1.f : 0.25f;
+  const Theme& theme = getTheme(dc);
+  auto markColor = multiplyAlpha(theme.mark, opacity);
+  auto trackColor = theme.track;
+  auto fillColor = multiplyAlpha(getColorProperty("color"), 0.75f*opacity);
+  auto indicatorColor = multiplyAlpha(getColorProperty("indicator"), opacity);
+  fillColor = nvgLerpRGBA(fillColor, indicatorColor, 0.5f);
+
+  // dimensions
+  float strokeWidth = gridSizeInPixels/64.f;
+  float gap = gridSizeInPixels/32.f;
+
+  // the cells that are off, the cells that are on, and all the outlines are each
+  // drawn as one path, so the number of nanovg calls doesn't grow with the grid.
+  auto addCells = [&](bool on) {
+    nvgBeginPath(nvg);
+    for(int row = row0; row < row1; ++row)
+    {
+      for(int column = column0; column < column1; ++column)
+      {
+        int i = row*_columns + column;
+        if(getCellValue(i) == on)
+        {
+          nvgRect(nvg, shrink(Rect(column*cellWidth, row*cellHeight, cellWidth, cellHeight), gap));
+        }
+      }
+    }
+  };
+
+  addCells(false);
+  nvgFillColor(nvg, trackColor);
+  nvgFill(nvg);
+
+  addCells(true);
+  nvgFillColor(nvg, fillColor);
+  nvgFill(nvg);
+
+  if(enabled)
+  {
+    nvgBeginPath(nvg);
+    for(int row = row0; row < row1; ++row)
+    {
+      for(int column = column0; column < column1; ++column)
+      {
+        nvgRect(nvg, shrink(Rect(column*cellWidth, row*cellHeight, cellWidth, cellHeight), gap));
+      }
+    }
+    nvgStrokeColor(nvg, markColor);
+    nvgStrokeWidth(nvg, strokeWidth);
+    nvgStroke(nvg);
+  }
+}
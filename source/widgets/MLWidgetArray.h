@@ -0,0 +1,85 @@
+// mlvg: GUI library for madronalib apps and plugins
+// Copyright (C) 2019-2022 Madrona Labs LLC
+// This software is provided 'as-is', without any express or implied warranty.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MLWidget.h"
+
+using namespace ml;
+
+// WidgetArray: a grid of toggle cells handled and drawn by one Widget, for step
+// sequencers and LED or toggle grids.
+//
+// Made of one ToggleButtonBasic per cell, a grid costs a Widget with its own property
+// and parameter trees for each cell, and the View hit tests each one for every event
+// and checks each one for redrawing every frame. WidgetArray keeps the cells' values
+// in a flat array instead, finds the cell under an event with grid math, and redraws
+// only the rows and columns holding cells that have changed.
+//
+// properties:
+//   rows, columns: the size of the grid. Cell i is at row i / columns, column i % columns.
+//   param: the parameter name prefix. Cell i controls the parameter param/i, which is
+//     on when its normalized value is over 0.5.
+//   color, indicator, enabled, opacity: as for ToggleButtonBasic.
+//
+// Clicking a cell toggles it, and dragging from there paints the same value across
+// the cells passed over.
+
+class WidgetArray : public Widget
+{
+  int _rows{0};
+  int _columns{0};
+  Path _paramBase;
+  std::vector< Path > _cellParams;
+  std::vector< float > _values;
+
+  // one flag per cell, set when the cell has changed since it was drawn, and the range
+  // of rows and columns holding all the flagged cells.
+  std::vector< uint8_t > _cellDirty;
+  int _dirtyRow0{0}, _dirtyRow1{0};
+  int _dirtyColumn0{0}, _dirtyColumn1{0};
+
+  // the value being painted by the current drag, or -1.
+  float _paintValue{-1.f};
+
+  void setupCells_();
+  int getCellIndex_(Path paramName) const;
+  void markCellDirty_(int i);
+  void markAllCellsDirty_();
+  void clearDirtyCells_();
+
+public:
+  WidgetArray(WithValues p);
+
+  int getRows() const { return _rows; }
+  int getColumns() const { return _columns; }
+  size_t getNumCells() const { return _values.size(); }
+
+  // the index of the cell under the point p in the parent View's grid coordinates,
+  // or -1 if there is none.
+  int getCellAt(Vec2 p) const;
+
+  // the bounds of cell i in the parent View's grid coordinates.
+  Rect getCellBounds(int i) const;
+
+  bool getCellValue(int i) const { return _values[i] > 0.5f; }
+  bool isCellDirty(int i) const { return _cellDirty[i] != 0; }
+
+  // set the normalized value of cell i, marking the cell to be redrawn if it changes.
+  void setCellValue(int i, float v);
+
+  // Widget implementation
+  bool knowsParam(Path paramName) override;
+  void setupParams() override;
+  void handleMessage(Message msg, MessageList* replyPtr) override;
+  MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override;
+  void processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out) override;
+  void setDirty(bool d) override;
+  Rect getDirtyBounds() const override;
+  void draw(ml::DrawContext d) override;
+};
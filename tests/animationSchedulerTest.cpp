@@ -0,0 +1,202 @@
+
+
+
+#include <memory>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "MLView.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+// a Widget that counts its animate() calls and animates for a given number of frames.
+class CountingWidget : public Widget
+{
+ public:
+  CountingWidget(WithValues p) : Widget(p) {}
+
+  int frames{0};
+  int framesToGo{0};
+
+  void animateFor(int n)
+  {
+    framesToGo = n;
+    startAnimating();
+  }
+
+  MessageList animate(int elapsedTimeInMs, DrawContext dc) override
+  {
+    frames++;
+    if((framesToGo == 0) || (--framesToGo == 0))
+    {
+      stopAnimating();
+    }
+    return MessageList{};
+  }
+};
+
+// a Widget that animates in animate() without ever calling startAnimating() or
+// stopAnimating(), as Widgets written before the scheduler do.
+class ContinuousWidget : public Widget
+{
+ public:
+  ContinuousWidget(WithValues p) : Widget(p) {}
+
+  int frames{0};
+
+  MessageList animate(int elapsedTimeInMs, DrawContext dc) override
+  {
+    frames++;
+    return MessageList{};
+  }
+};
+
+// a Widget that deletes another while animating.
+class DeletingWidget : public Widget
+{
+ public:
+  DeletingWidget(WithValues p) : Widget(p) {}
+
+  std::unique_ptr< Widget > other;
+
+  MessageList animate(int elapsedTimeInMs, DrawContext dc) override
+  {
+    other.reset();
+    stopAnimating();
+    return MessageList{};
+  }
+};
+
+std::vector< CountingWidget* > addWidgets(View& view, int n)
+{
+  for(int i = 0; i < n; ++i)
+  {
+    view._widgets.add_unique< CountingWidget >(Path(TextFragment("w", textUtils::naturalNumberToText(i))),
+                                               WithValues{});
+  }
+  std::vector< CountingWidget* > widgets;
+  forEachChild< Widget >(view._widgets, [&](Widget& w) { widgets.push_back(static_cast< CountingWidget* >(&w)); });
+  return widgets;
+}
+
+int totalFrames(const std::vector< CountingWidget* >& widgets)
+{
+  int sum{0};
+  for(auto w : widgets) sum += w->frames;
+  return sum;
+}
+}
+
+TEST_CASE("mlvg/animationScheduler/activeSet", "[animationScheduler]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  CollectionRoot< Widget > root;
+  View view(root, WithValues{});
+  auto widgets = addWidgets(view, 100);
+
+  // every Widget is animated on the first frame.
+  widgets[3]->animateFor(5);
+  view.animate(16, dc);
+  REQUIRE(totalFrames(widgets) == 100);
+  REQUIRE(view.getNumAnimatingWidgets() == 1);
+
+  // then only the animating ones, until they stop.
+  widgets[7]->animateFor(2);
+  REQUIRE(view.getNumAnimatingWidgets() == 2);
+  for(int i = 0; i < 10; ++i)
+  {
+    view.animate(16, dc);
+  }
+  REQUIRE(widgets[3]->frames == 5);
+  REQUIRE(widgets[7]->frames == 3);
+  REQUIRE(totalFrames(widgets) == 100 + 4 + 2);
+  REQUIRE(view.getNumAnimatingWidgets() == 0);
+  REQUIRE(!view.isAnimating());
+
+  // a dirty View animates every Widget once again.
+  view.setDirty(true);
+  view.animate(16, dc);
+  REQUIRE(totalFrames(widgets) == 200 + 4 + 2);
+
+  // a View inside another keeps animating while its Widgets do.
+  CollectionRoot< Widget > innerRoot;
+  View inner(innerRoot, WithValues{});
+  auto innerWidgets = addWidgets(inner, 10);
+  AnimationScheduler outer(nullptr);
+  inner._scheduler = &outer;
+  inner.animate(16, dc);
+  REQUIRE(outer.size() == 0);
+  innerWidgets[0]->animateFor(3);
+  REQUIRE(outer.size() == 1);
+  MessageList messages;
+  for(int i = 0; i < 5; ++i)
+  {
+    outer.animate(16, dc, messages);
+  }
+  REQUIRE(innerWidgets[0]->frames == 4);
+  REQUIRE(outer.size() == 0);
+}
+
+TEST_CASE("mlvg/animationScheduler/idle", "[animationScheduler]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  CollectionRoot< Widget > root;
+  View view(root, WithValues{});
+  auto widgets = addWidgets(view, 2000);
+  view._widgets.add_unique< Widget >("still", WithValues{});
+  view._widgets.add_unique< ContinuousWidget >("continuous", WithValues{});
+
+  // idle Widgets, and those that don't override animate(), are animated only on the
+  // first frame. Widgets that never stop animating are animated every frame.
+  constexpr int kFrames{1000};
+  for(int i = 0; i < kFrames; ++i)
+  {
+    view.animate(16, dc);
+  }
+  REQUIRE(totalFrames(widgets) == 2000);
+  REQUIRE(view.getNumAnimatingWidgets() == 1);
+  int continuousFrames{0};
+  forEachChild< Widget >(view._widgets, [&](Widget& w) {
+    if(auto c = dynamic_cast< ContinuousWidget* >(&w)) continuousFrames = c->frames;
+  });
+  REQUIRE(continuousFrames == kFrames);
+}
+
+TEST_CASE("mlvg/animationScheduler/delete", "[animationScheduler]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  AnimationScheduler scheduler;
+  MessageList messages;
+
+  // a deleted Widget leaves the set.
+  auto w = std::make_unique< CountingWidget >(WithValues{});
+  w->_scheduler = &scheduler;
+  w->animateFor(3);
+  REQUIRE(scheduler.size() == 1);
+  w.reset();
+  REQUIRE(scheduler.size() == 0);
+  scheduler.animate(16, dc, messages);
+
+  // also when it is deleted by another Widget while the set is animating.
+  auto deleter = std::make_unique< DeletingWidget >(WithValues{});
+  auto deleted = std::make_unique< CountingWidget >(WithValues{});
+  CountingWidget* deletedPtr = deleted.get();
+  deleter->_scheduler = &scheduler;
+  deletedPtr->_scheduler = &scheduler;
+  deleter->startAnimating();
+  deletedPtr->animateFor(3);
+  deleter->other = std::move(deleted);
+  REQUIRE(scheduler.size() == 2);
+  scheduler.animate(16, dc, messages);
+  REQUIRE(scheduler.size() == 0);
+}
@@ -0,0 +1,123 @@
+
+
+
+#include <cmath>
+#include <vector>
+
+#include "MLDialBasic.h"
+#include "MLDrawContext.h"
+#include "catch.hpp"
+#include "madronalib.h"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// the fill and indicator of a dial, which change with its value.
+void drawValue(NVGcontext* vg, const DialBasic::StaticParts& p, float value)
+{
+  float a3 = lerp(p.a0, p.a1, value);
+  nvgBeginPath(vg);
+  nvgMoveTo(vg, 0, 0);
+  nvgLineTo(vg, nvgAngle2Vec(p.a0)*p.r1);
+  nvgArc(vg, 0, 0, p.r1, p.a0, a3, NVG_CW);
+  nvgClosePath(vg);
+  nvgFillColor(vg, multiplyAlpha(p.color, 0.33f));
+  nvgFill(vg);
+
+  float ixy = p.strokeWidth/2.f;
+  nvgSave(vg);
+  nvgRotate(vg, a3);
+  nvgBeginPath(vg);
+  nvgMoveTo(vg, 0, 0);
+  nvgLineTo(vg, ixy, -ixy);
+  nvgLineTo(vg, p.r1, -ixy);
+  nvgLineTo(vg, p.r1, ixy);
+  nvgLineTo(vg, ixy, ixy);
+  nvgClosePath(vg);
+  nvgFillColor(vg, p.color);
+  nvgFill(vg);
+  nvgRestore(vg);
+}
+}
+
+TEST_CASE("mlvg/dialLayer/automation", "[dialLayer]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+
+  // a large dial with ticks and detents, as the test app draws them at a grid size of 60.
+  DialBasic::StaticParts parts;
+  parts.r1 = 33.f*0.85f;
+  parts.r4 = 33.f;
+  parts.r5 = 33.f*1.06f;
+  parts.strokeWidth = 60.f/32.f;
+  parts.tickWidth = 60.f/128.f;
+  parts.a0 = kTwoPi*0.375f;
+  parts.a1 = kTwoPi;
+  parts.nTicks = 11;
+  parts.color = rgba(0.01f, 0.01f, 0.01f, 1.f);
+  std::vector< float > detents{0.f, 0.25f, 0.5f, 0.75f, 1.f};
+
+  // framebuffers need a GPU context, so an image of the same size stands in for the
+  // layer. Drawing either costs nanovg the same.
+  int passSize = parts.layerRadius()*2;
+  REQUIRE(passSize >= 2*(parts.r5 + parts.tickWidth));
+  int layerWidth = passSize*DialBasic::kStaticPasses;
+  int layer = nvgCreateImageRGBA(vg, layerWidth, passSize, NVG_IMAGE_PREMULTIPLIED, nullptr);
+
+  // 200 dials, all automated, so every one is redrawn every frame.
+  constexpr int kFrames{60};
+  constexpr int kDials{200};
+  auto drawFrame = [&](int frame, bool useLayer) {
+    nvgBeginFrame(vg, 1600, 1000, 1.0f);
+    for(int i = 0; i < kDials; ++i)
+    {
+      nvgSave(vg);
+      nvgTranslate(vg, (i % 20) * 80.f + 40.f, (i / 20) * 80.f + 40.f);
+      drawValue(vg, parts, 0.5f + 0.5f*sinf(frame*0.1f + i));
+      if(useLayer)
+      {
+        float lr = passSize/2;
+        for(int pass = 0; pass < DialBasic::kStaticPasses; ++pass)
+        {
+          nvgBeginPath(vg);
+          nvgRect(vg, -lr, -lr, passSize, passSize);
+          nvgFillPaint(vg, nvgImagePattern(vg, -lr - pass*passSize, -lr, layerWidth, passSize, 0, layer, 1.0f));
+          nvgFill(vg);
+        }
+      }
+      else
+      {
+        DialBasic::drawStaticParts(vg, parts, detents);
+      }
+      nvgRestore(vg);
+    }
+    nvgCancelFrame(vg);
+  };
+
+  int strokesBefore = counts.strokes;
+  for(int i = 0; i < kFrames; ++i) drawFrame(i, false);
+  int strokesDirect = counts.strokes - strokesBefore;
+  for(int i = 0; i < kFrames; ++i) drawFrame(i, true);
+
+  // outline, ticks and each detent are strokes; the layer is none.
+  REQUIRE(strokesDirect == kFrames*kDials*(2 + int(detents.size())));
+  REQUIRE(counts.strokes == strokesBefore + strokesDirect);
+
+  // dials with the same parts and detents share a layer, and any change makes a new one.
+  DialBasic::StaticParts same = parts;
+  uint64_t key = parts.layerKey(detents);
+  REQUIRE(same.layerKey(detents) == key);
+  same.color = rgba(0.01f, 0.01f, 0.01f, 0.25f);
+  REQUIRE(same.layerKey(detents) != key);
+  same = parts;
+  same.nTicks++;
+  REQUIRE(same.layerKey(detents) != key);
+  std::vector< float > otherDetents{0.f, 0.5f, 1.f};
+  REQUIRE(parts.layerKey(otherDetents) != key);
+
+  nvgDeleteImage(vg, layer);
+  nvgDeleteInternal(vg);
+}
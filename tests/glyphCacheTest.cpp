@@ -0,0 +1,195 @@
+
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "MLGlyphCache.h"
+#include "catch.hpp"
+#include "nullNanoVG.h"
+
+extern "C" {
+#include "fontstash.h"
+}
+
+using namespace ml;
+
+namespace
+{
+// the test app's font, found relative to this file.
+int loadTestFont(NVGcontext* vg)
+{
+  std::string path(__FILE__);
+  path = path.substr(0, path.find_last_of("/\\") + 1) + "../examples/app/resources/D-DIN.otf";
+  return nvgCreateFont(vg, "d_din", path.c_str());
+}
+
+// labels and numbers of a small editor, at a few sizes.
+struct EditorText
+{
+  float size;
+  const char* text;
+};
+const std::vector< EditorText > kEditorText{
+    {15.f, "attack decay sustain release"}, {15.f, "cutoff resonance drive"}, {15.f, "OPEN SAVE"},
+    {37.5f, "Tesseract"},                   {20.f, "0123456789.-+%"},        {12.f, "0123456789.-+%"}};
+
+void drawFirstFrame(NVGcontext* vg, int font)
+{
+  nvgBeginFrame(vg, 800, 600, 1.0f);
+  nvgFontFaceId(vg, font);
+  for(const auto& t : kEditorText)
+  {
+    nvgFontSize(vg, t.size);
+    nvgText(vg, 10, 10, t.text, nullptr);
+  }
+  nvgEndFrame(vg);
+}
+
+void addEditorText(GlyphCache& glyphs, int font)
+{
+  for(const auto& t : kEditorText)
+  {
+    glyphs.addText(font, t.size, t.text);
+  }
+}
+}
+
+TEST_CASE("mlvg/glyphCache/prewarm", "[glyphCache]")
+{
+  // first frame after the glyphs are made on the worker.
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int font = loadTestFont(vg);
+  GlyphCache glyphs(vg);
+  addEditorText(glyphs, font);
+  REQUIRE(!glyphs.update());
+  REQUIRE(glyphs.start());
+  REQUIRE(!glyphs.start());
+  glyphs.waitForPending();
+  REQUIRE(glyphs.update());
+  drawFirstFrame(vg, font);
+
+  // the atlas is uploaded once, and no glyphs are added while drawing.
+  int w, h;
+  fonsGetAtlasSize(nvgInternalFontStash(vg), &w, &h);
+  REQUIRE(counts.uploadedPixels == long(w) * h);
+  nvgDeleteInternal(vg);
+}
+
+TEST_CASE("mlvg/glyphCache/disk", "[glyphCache]")
+{
+  std::string dir(".");
+  std::vector< unsigned char > atlas[2];
+  std::vector< std::string > cacheFiles;
+
+  for(int run = 0; run < 2; ++run)
+  {
+    NullRenderCounts counts;
+    NVGcontext* vg = createNullContext(&counts);
+    int font = loadTestFont(vg);
+    {
+      GlyphCache glyphs(vg, dir);
+      addEditorText(glyphs, font);
+      glyphs.start();
+      glyphs.waitForPending();
+      REQUIRE(glyphs.update());
+      cacheFiles.push_back(glyphs.getCacheFile());
+
+      // made the first time, and loaded the second.
+      REQUIRE(glyphs.wasLoadedFromDisk() == (run == 1));
+    }
+
+    FONScontext* fs = nvgInternalFontStash(vg);
+    atlas[run].resize(fonsSaveAtlas(fs, nullptr, 0));
+    fonsSaveAtlas(fs, atlas[run].data(), int(atlas[run].size()));
+    nvgDeleteInternal(vg);
+  }
+  REQUIRE(atlas[0] == atlas[1]);
+
+  // different text or sizes, as after a resize, replace the atlas in the same file.
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int font = loadTestFont(vg);
+  for(float size : {15.f, 30.f})
+  {
+    GlyphCache glyphs(vg, dir);
+    glyphs.addText(font, size, "something else");
+    glyphs.start();
+    glyphs.waitForPending();
+    REQUIRE(glyphs.update());
+    REQUIRE(!glyphs.wasLoadedFromDisk());
+    REQUIRE(glyphs.getCacheFile() == cacheFiles[0]);
+  }
+  {
+    GlyphCache glyphs(vg, dir);
+    glyphs.addText(font, 30.f, "something else");
+    glyphs.start();
+    glyphs.waitForPending();
+    REQUIRE(glyphs.wasLoadedFromDisk());
+  }
+  nvgDeleteInternal(vg);
+
+  // an atlas that doesn't match the fonts is not loaded.
+  atlas[0][32] ^= 0xff;
+  NVGcontext* vg2 = createNullContext(&counts);
+  loadTestFont(vg2);
+  REQUIRE(!fonsLoadAtlas(nvgInternalFontStash(vg2), atlas[0].data(), int(atlas[0].size())));
+  REQUIRE(!fonsLoadAtlas(nvgInternalFontStash(vg2), atlas[1].data(), int(atlas[1].size()) - 1));
+  REQUIRE(fonsLoadAtlas(nvgInternalFontStash(vg2), atlas[1].data(), int(atlas[1].size())));
+  nvgDeleteInternal(vg2);
+
+  for(const auto& f : cacheFiles)
+  {
+    std::remove(f.c_str());
+  }
+}
+
+TEST_CASE("mlvg/glyphCache/writers", "[glyphCache]")
+{
+  // two views with the same fonts and different texts write the same file at once.
+  std::string dir(".");
+  NullRenderCounts counts[2];
+  NVGcontext* vg[2];
+  int font[2];
+  std::string cacheFile;
+  for(int i = 0; i < 2; ++i)
+  {
+    vg[i] = createNullContext(&counts[i]);
+    font[i] = loadTestFont(vg[i]);
+  }
+  for(int pass = 0; pass < 8; ++pass)
+  {
+    GlyphCache a(vg[0], dir);
+    GlyphCache b(vg[1], dir);
+    addEditorText(a, font[0]);
+    b.addText(font[1], 24.f + pass, "something else");
+    a.start();
+    b.start();
+    a.waitForPending();
+    b.waitForPending();
+    REQUIRE(a.update());
+    REQUIRE(b.update());
+    cacheFile = a.getCacheFile();
+  }
+
+  // the file left is one of the two whole atlases.
+  std::ifstream in(cacheFile, std::ios::binary | std::ios::ate);
+  REQUIRE(in);
+  std::vector< unsigned char > data(static_cast< size_t >(in.tellg()));
+  in.seekg(0);
+  in.read(reinterpret_cast< char* >(data.data()), static_cast< std::streamsize >(data.size()));
+  REQUIRE(data.size() > sizeof(uint64_t));
+  NullRenderCounts counts2;
+  NVGcontext* vg2 = createNullContext(&counts2);
+  loadTestFont(vg2);
+  REQUIRE(fonsLoadAtlas(nvgInternalFontStash(vg2), data.data() + sizeof(uint64_t), int(data.size() - sizeof(uint64_t))));
+  nvgDeleteInternal(vg2);
+
+  for(int i = 0; i < 2; ++i)
+  {
+    nvgDeleteInternal(vg[i]);
+  }
+  std::remove(cacheFile.c_str());
+}
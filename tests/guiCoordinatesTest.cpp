@@ -0,0 +1,127 @@
+
+
+
+#include <cmath>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+bool nearlyEqual(const MLVec& a, const MLVec& b)
+{
+  for(int i = 0; i < 4; ++i)
+  {
+    if(fabsf(a[i] - b[i]) > 1e-4f*std::max(1.f, fabsf(a[i]))) return false;
+  }
+  return true;
+}
+
+GUICoordinates makeCoords()
+{
+  GUICoordinates c;
+  c.gridSizeInPixels = 53.f;
+  c.viewSizeInPixels = Vec2(2400.f, 1600.f);
+  c.displayScale = 2.f;
+  c.origin = Vec2(7.f, 11.f);
+  return c;
+}
+}
+
+TEST_CASE("mlvg/guiCoordinates/batch", "[guiCoordinates]")
+{
+  GUICoordinates c = makeCoords();
+  std::vector< Rect > rects;
+  for(int i = 0; i < 37; ++i)
+  {
+    rects.push_back(Rect(i*0.75f, i*0.5f - 3.f, 1.f + (i % 4), 0.5f + (i % 3)));
+  }
+
+  // the same results as the single transforms, to within a bit of rounding.
+  std::vector< Rect > pixels(rects.size());
+  c.gridToPixel(rects.data(), pixels.data(), rects.size());
+  for(size_t i = 0; i < rects.size(); ++i)
+  {
+    REQUIRE(nearlyEqual(pixels[i], c.gridToPixel(rects[i])));
+  }
+
+  std::vector< Rect > grid(pixels);
+  c.pixelToGrid(grid.data(), grid.data(), grid.size());
+  for(size_t i = 0; i < rects.size(); ++i)
+  {
+    REQUIRE(nearlyEqual(grid[i], c.pixelToGrid(pixels[i])));
+    REQUIRE(nearlyEqual(grid[i], rects[i]));
+  }
+
+  std::vector< Rect > fromSystem(rects);
+  c.systemToGrid(fromSystem.data(), fromSystem.data(), fromSystem.size());
+  for(size_t i = 0; i < rects.size(); ++i)
+  {
+    REQUIRE(nearlyEqual(fromSystem[i], c.systemToGrid(rects[i])));
+  }
+
+  // points keep zero z and w.
+  std::vector< Vec2 > points{Vec2(1, 2), Vec2(-3, 4.5f)};
+  c.gridToPixel(points.data(), points.data(), points.size());
+  REQUIRE(points[1] == Vec2(-3*53.f + 7.f, 4.5f*53.f + 11.f));
+}
+
+TEST_CASE("mlvg/guiCoordinates/frames", "[guiCoordinates]")
+{
+  GUICoordinates c = makeCoords();
+
+  // the bounds of a large view's widgets in grid units, transformed to pixels and
+  // tested against a dirty rect each frame as View does when drawing.
+  constexpr int kWidgets{2000};
+  constexpr int kFrames{200};
+  std::vector< Rect > bounds;
+  for(int i = 0; i < kWidgets; ++i)
+  {
+    bounds.push_back(Rect((i % 50)*0.8f, (i / 50)*0.75f, 0.5f, 0.5f));
+  }
+  Rect dirtyRect(400.f, 300.f, 600.f, 400.f);
+  std::vector< Rect > pixels(bounds.size());
+
+  int singleDrawn{0}, batchDrawn{0};
+  for(int f = 0; f < kFrames; ++f)
+  {
+    for(auto& b : bounds)
+    {
+      singleDrawn += bool(intersectRects(roundToInt(c.gridToPixel(b)), dirtyRect));
+    }
+  }
+  for(int f = 0; f < kFrames; ++f)
+  {
+    c.gridToPixel(bounds.data(), pixels.data(), bounds.size());
+    for(auto& p : pixels)
+    {
+      batchDrawn += bool(intersectRects(roundToInt(p), dirtyRect));
+    }
+  }
+
+  // and back to grid units, as a layout pass does.
+  std::vector< Rect > grid(bounds.size());
+  float singleSum{0}, batchSum{0};
+  for(int f = 0; f < kFrames; ++f)
+  {
+    for(size_t i = 0; i < pixels.size(); ++i)
+    {
+      grid[i] = c.pixelToGrid(pixels[i]);
+    }
+    singleSum += grid[f].left();
+  }
+  for(int f = 0; f < kFrames; ++f)
+  {
+    c.pixelToGrid(pixels.data(), grid.data(), pixels.size());
+    batchSum += grid[f].left();
+  }
+
+  // the batched transforms give the same results as one at a time.
+  REQUIRE(batchDrawn == singleDrawn);
+  REQUIRE(batchDrawn > 0);
+  REQUIRE(fabsf(batchSum - singleSum) < 1e-2f);
+}
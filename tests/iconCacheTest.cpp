@@ -0,0 +1,105 @@
+
+
+#include <string>
+
+#include "MLDrawContext.h"
+#include "MLIconCache.h"
+#include "catch.hpp"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// a small icon: a ring with a gradient, and a few stroked marks.
+std::string makeIconSVG()
+{
+  std::string svg =
+      "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"64\" height=\"64\">\n"
+      "<defs><linearGradient id=\"g\" x1=\"0\" y1=\"0\" x2=\"0\" y2=\"1\">"
+      "<stop offset=\"0\" stop-color=\"#204060\"/><stop offset=\"1\" stop-color=\"#a0c0e0\"/>"
+      "</linearGradient></defs>\n"
+      "<path fill=\"url(#g)\" d=\"M32 4 a28 28 0 1 0 0.01 0 z M32 14 a18 18 0 1 0 0.01 0 z\"/>\n";
+  for(int i = 0; i < 8; ++i)
+  {
+    svg += "<path fill=\"none\" stroke=\"#000000\" stroke-width=\"2\" d=\"M32 32 l" + std::to_string(i * 2) + " 12\"/>\n";
+  }
+  svg += "</svg>\n";
+  return svg;
+}
+}
+
+TEST_CASE("mlvg/iconCache/pending", "[iconCache]")
+{
+  std::string svg = makeIconSVG();
+  VectorImage image(nullptr, reinterpret_cast< const unsigned char* >(svg.data()), svg.size());
+  REQUIRE(image);
+  const PreparedSVG* prepared = image._prepared.get();
+
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int texturesBefore = counts.textures;
+  {
+    IconCache icons(vg);
+
+    // nothing is ready at first, so the caller draws vectors.
+    REQUIRE(icons.getIcon(prepared, 32, 32) == 0);
+    icons.waitForPending();
+
+    int icon = icons.getIcon(prepared, 32, 32);
+    REQUIRE(icon != 0);
+    REQUIRE(icons.getIcon(prepared, 32, 32) == icon);
+    REQUIRE(counts.textures == texturesBefore + 1);
+
+    // the ring covers much of the icon, but not all.
+    REQUIRE(counts.lastTextureCoverage > 32 * 32 / 4);
+    REQUIRE(counts.lastTextureCoverage < 32 * 32);
+
+    // only the most recent sizes of each image are kept.
+    icons.getIcon(prepared, 48, 48);
+    icons.getIcon(prepared, 64, 64);
+    icons.waitForPending();
+    icons.getIcon(prepared, 64, 64);
+    REQUIRE(icons.getNumIcons() == IconCache::kMaxSizesPerImage);
+
+    // large images are left to vectors.
+    REQUIRE(icons.getIcon(prepared, IconCache::kMaxIconSize + 1, 32) == 0);
+    REQUIRE(icons.getNumIcons() == IconCache::kMaxSizesPerImage);
+  }
+
+  // all rasters are freed with the cache.
+  REQUIRE(counts.textures == texturesBefore);
+  nvgDeleteInternal(vg);
+}
+
+TEST_CASE("mlvg/iconCache/keys", "[iconCache]")
+{
+  std::string svg = makeIconSVG();
+  std::string otherSVG = svg;
+  otherSVG.replace(otherSVG.find("#000000"), 7, "#ff0000");
+
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  IconCache icons(vg);
+  int icon{0};
+  {
+    VectorImage image(nullptr, reinterpret_cast< const unsigned char* >(svg.data()), svg.size());
+    icons.getIcon(image._prepared.get(), 32, 32);
+    icons.waitForPending();
+    icon = icons.getIcon(image._prepared.get(), 32, 32);
+    REQUIRE(icon != 0);
+  }
+
+  // an image with the same contents shares the raster, wherever it is.
+  VectorImage same(nullptr, reinterpret_cast< const unsigned char* >(svg.data()), svg.size());
+  REQUIRE(icons.getIcon(same._prepared.get(), 32, 32) == icon);
+
+  // a different image never gets it, even if it is made at the same address.
+  VectorImage other(nullptr, reinterpret_cast< const unsigned char* >(otherSVG.data()), otherSVG.size());
+  REQUIRE(other._prepared->contentHash != same._prepared->contentHash);
+  REQUIRE(icons.getIcon(other._prepared.get(), 32, 32) == 0);
+  REQUIRE(icons.getNumIcons() == 2);
+
+  icons.clear();
+  nvgDeleteInternal(vg);
+}
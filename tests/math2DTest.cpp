@@ -0,0 +1,148 @@
+
+
+
+#include <type_traits>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+// the scalar versions of the Rect functions, as they were before MLVec used SIMD.
+Rect scalarIntersect(const Rect& a, const Rect& b)
+{
+  Rect ret{};
+  float l = ml::max(a.left(), b.left());
+  float r = ml::min(a.right(), b.right());
+  if(r > l)
+  {
+    float t = ml::max(a.top(), b.top());
+    float bot = ml::min(a.bottom(), b.bottom());
+    if(bot > t)
+    {
+      ret = Rect(l, t, r - l, bot - t);
+    }
+  }
+  return ret;
+}
+
+Rect scalarEnclosing(const Rect& a, const Rect& b)
+{
+  if(!(a.area() > 0.f)) return b;
+  float l = ml::min(a.left(), b.left());
+  float r = ml::max(a.right(), b.right());
+  float t = ml::min(a.top(), b.top());
+  float bot = ml::max(a.bottom(), b.bottom());
+  return Rect(l, t, r - l, bot - t);
+}
+
+bool scalarWithin(const Vec2& p, const Rect& r)
+{
+  return (ml::within(p.x(), r.left(), r.right()) && ml::within(p.y(), r.top(), r.bottom()));
+}
+
+Rect scalarGridToPixel(const GUICoordinates& c, const Rect& r)
+{
+  return Rect(r.left()*c.gridSizeInPixels + c.origin.x(), r.top()*c.gridSizeInPixels + c.origin.y(),
+              r.width()*c.gridSizeInPixels, r.height()*c.gridSizeInPixels);
+}
+
+// widget bounds in grid units, as a large view lays them out.
+std::vector< Rect > makeWidgetBounds(int n)
+{
+  std::vector< Rect > bounds;
+  for(int i = 0; i < n; ++i)
+  {
+    bounds.push_back(Rect((i % 40)*0.75f, (i / 40)*1.25f, 0.5f + (i % 3)*0.25f, 1.f + (i % 2)*0.5f));
+  }
+  return bounds;
+}
+}
+
+TEST_CASE("mlvg/math2D/types", "[math2D]")
+{
+  static_assert(std::is_trivially_copyable< Vec2 >::value, "Vec2 should be trivially copyable");
+  static_assert(std::is_trivially_copyable< Vec4 >::value, "Vec4 should be trivially copyable");
+  static_assert(std::is_trivially_copyable< Rect >::value, "Rect should be trivially copyable");
+  static_assert(!std::is_polymorphic< MLVec >::value, "MLVec should have no vtable");
+  static_assert(sizeof(Rect) == 16 && alignof(Rect) == 16, "Rect should be one aligned register");
+  static_assert(sizeof(Vec2) == 16 && alignof(Vec2) == 16, "Vec2 should be one aligned register");
+
+  // arithmetic and comparison.
+  Vec4 a(1, 2, 3, 4), b(8, 6, 4, 2);
+  REQUIRE(a + b == Vec4(9, 8, 7, 6));
+  REQUIRE(b - a == Vec4(7, 4, 1, -2));
+  REQUIRE(a*b == Vec4(8, 12, 12, 8));
+  REQUIRE(b/a == Vec4(8, 3, 4.f/3.f, 0.5f));
+  REQUIRE(a*2.f == Vec4(2, 4, 6, 8));
+  REQUIRE(vmin(a, b) == Vec4(1, 2, 3, 2));
+  REQUIRE(vmax(a, b) == Vec4(8, 6, 4, 4));
+  REQUIRE(roundToInt(Rect(1.7f, -1.7f, 2.5f, 0.2f)) == Rect(1, -1, 2, 0));
+  REQUIRE(a != b);
+  REQUIRE(!Vec2());
+  REQUIRE(Vec2(0, 1));
+
+  // the same results as the scalar versions, including touching and empty rects.
+  std::vector< Rect > rects{Rect(0, 0, 10, 10), Rect(10, 0, 5, 5),    Rect(5, 5, 10, 10), Rect(2, 3, 0, 4),
+                            Rect(-4, -4, 3, 3), Rect(0.5f, 9.5f, 2, 1), Rect(),             Rect(1, 1, 8, 8)};
+  std::vector< Vec2 > points{Vec2(0, 0), Vec2(10, 10), Vec2(9.99f, 0), Vec2(5, 5), Vec2(-1, 3), Vec2(10, 5)};
+  for(auto& r1 : rects)
+  {
+    for(auto& r2 : rects)
+    {
+      REQUIRE(intersectRects(r1, r2) == scalarIntersect(r1, r2));
+      REQUIRE(rectEnclosing(r1, r2) == scalarEnclosing(r1, r2));
+      REQUIRE(unionRects(r1, r2) == scalarEnclosing(r1, r2));
+    }
+    for(auto& p : points)
+    {
+      REQUIRE(within(p, r1) == scalarWithin(p, r1));
+    }
+  }
+}
+
+TEST_CASE("mlvg/math2D/frames", "[math2D]")
+{
+  constexpr int kWidgets{1000};
+  constexpr int kFrames{200};
+  std::vector< Rect > bounds = makeWidgetBounds(kWidgets);
+  GUICoordinates coords;
+  coords.gridSizeInPixels = 60.f;
+  coords.origin = Vec2(12.f, 7.f);
+  Rect dirtyRect(300.f, 200.f, 400.f, 300.f);
+
+  // the geometry of one frame in View: hit testing an event, finding the widgets to
+  // redraw in the dirty rect, and the bounds enclosing them all.
+  auto frame = [&](int f, bool scalar, int& hits, int& drawn, Rect& enclosing) {
+    Vec2 eventPos((f % 30)*1.f + 0.3f, (f % 20)*1.f + 0.6f);
+    for(auto& b : bounds)
+    {
+      hits += scalar ? scalarWithin(eventPos, b) : within(eventPos, b);
+      if(scalar)
+      {
+        drawn += bool(scalarIntersect(scalarGridToPixel(coords, b), dirtyRect));
+        enclosing = scalarEnclosing(enclosing, b);
+      }
+      else
+      {
+        drawn += bool(intersectRects(coords.gridToPixel(b), dirtyRect));
+        enclosing = rectEnclosing(enclosing, b);
+      }
+    }
+  };
+
+  int scalarHits{0}, scalarDrawn{0}, hits{0}, drawn{0};
+  Rect scalarBounds, simdBounds;
+  for(int i = 0; i < kFrames; ++i) frame(i, true, scalarHits, scalarDrawn, scalarBounds);
+  for(int i = 0; i < kFrames; ++i) frame(i, false, hits, drawn, simdBounds);
+
+  // the SIMD geometry gives the same frames as the scalar one.
+  REQUIRE(hits == scalarHits);
+  REQUIRE(drawn == scalarDrawn);
+  REQUIRE(simdBounds == scalarBounds);
+  REQUIRE(drawn > 0);
+}
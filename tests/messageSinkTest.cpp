@@ -0,0 +1,155 @@
+
+
+
+#include <utility>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "MLRealtimeCheck.h"
+#include "MLView.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+#if ML_RT_SAFETY_CHECK
+// call f in a realtime scope and return the number of allocations and deallocations
+// it made, as counted by the realtime checks' operator new and delete.
+template< typename F >
+std::pair< int, int > countAllocations(F f)
+{
+  rtcheck::resetViolationCounts();
+  {
+    ML_REALTIME_SCOPE;
+    f();
+  }
+  return {int(rtcheck::getViolationCount(rtcheck::kAllocation)),
+          int(rtcheck::getViolationCount(rtcheck::kDeallocation))};
+}
+#endif
+
+// a Widget that sends a message on every frame and every event, through the sink.
+class SendingWidget : public Widget
+{
+ public:
+  SendingWidget(WithValues p) : Widget(p) { startAnimating(); }
+
+  Path address{"editor/set_param/gain"};
+  float value{0};
+
+  void processGUIEventInto(const GUICoordinates& gc, GUIEvent e, MessageList& out) override
+  {
+    out.push_back(Message{address, e.position.x()});
+  }
+
+  void animateInto(int elapsedTimeInMs, DrawContext dc, MessageList& out) override
+  {
+    value += 0.01f;
+    out.push_back(Message{address, value});
+  }
+};
+
+// a Widget that still returns its messages by value.
+class ReturningWidget : public Widget
+{
+ public:
+  ReturningWidget(WithValues p) : Widget(p) {}
+
+  MessageList processGUIEvent(const GUICoordinates& gc, GUIEvent e) override
+  {
+    MessageList r;
+    r.push_back(Message{"editor/set_param/freq", 1.f});
+    return r;
+  }
+};
+
+void addWidgets(View& view, int sending, int idle)
+{
+  for(int i = 0; i < sending; ++i)
+  {
+    view._widgets.add_unique< SendingWidget >(Path(TextFragment("send", textUtils::naturalNumberToText(i))),
+                                              WithValues{{"bounds", rectToMatrix({0, 0, 1, 1})}, {"z", float(i)}});
+  }
+  for(int i = 0; i < idle; ++i)
+  {
+    view._widgets.add_unique< Widget >(Path(TextFragment("idle", textUtils::naturalNumberToText(i))),
+                                       WithValues{{"bounds", rectToMatrix({2, 0, 1, 1})}});
+  }
+}
+}
+
+TEST_CASE("mlvg/messageSink/collect", "[messageSink]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  CollectionRoot< Widget > root;
+  View view(root, WithValues{});
+  addWidgets(view, 10, 40);
+  view._widgets.add_unique< ReturningWidget >("returning", WithValues{{"bounds", rectToMatrix({4, 0, 1, 1})}});
+
+  // messages from every animating Widget are appended to the list.
+  MessageList out;
+  view.animateInto(16, dc, out);
+  REQUIRE(out.size() == 10);
+  view.animateInto(16, dc, out);
+  REQUIRE(out.size() == 20);
+
+  // the first Widget under an event with something to say gets it.
+  out.clear();
+  view.processGUIEventInto(GUICoordinates{}, GUIEvent("move", Vec2(0.5f, 0.5f)), out);
+  REQUIRE(out.size() == 1);
+
+  // Widgets that return lists are heard through the sink, and the other way around.
+  out.clear();
+  view.processGUIEventInto(GUICoordinates{}, GUIEvent("move", Vec2(4.5f, 0.5f)), out);
+  REQUIRE(out.size() == 1);
+  REQUIRE(view.processGUIEvent(GUICoordinates{}, GUIEvent("move", Vec2(0.5f, 0.5f))).size() == 1);
+  REQUIRE(view.animate(16, dc).size() == 10);
+
+}
+
+#if ML_RT_SAFETY_CHECK
+
+TEST_CASE("mlvg/messageSink/noAllocation", "[messageSink]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  CollectionRoot< Widget > root;
+  View view(root, WithValues{});
+  addWidgets(view, 10, 200);
+  GUIEvent drag("drag", Vec2(0.5f, 0.5f));
+
+  // a gesture on one Widget, which gets all the drag events after the down.
+  MessageList out;
+  view.processGUIEventInto(GUICoordinates{}, GUIEvent("down", Vec2(0.5f, 0.5f)), out);
+  REQUIRE(out.size() == 1);
+
+  // the first frames and events size the lists.
+  for(int i = 0; i < 4; ++i)
+  {
+    out.clear();
+    view.animateInto(16, dc, out);
+    out.clear();
+    view.processGUIEventInto(GUICoordinates{}, drag, out);
+  }
+
+  // after that, frames and drag events make no allocations.
+  auto counts = countAllocations([&]() {
+    for(int i = 0; i < 100; ++i)
+    {
+      out.clear();
+      view.animateInto(16, dc, out);
+      out.clear();
+      view.processGUIEventInto(GUICoordinates{}, drag, out);
+    }
+  });
+  REQUIRE(counts.first == 0);
+  REQUIRE(counts.second == 0);
+  REQUIRE(out.size() == 1);
+}
+
+#endif // ML_RT_SAFETY_CHECK
@@ -0,0 +1,114 @@
+
+
+// a nanovg renderer that draws nothing, for tests. It counts what it is given,
+// which lets us compare the cost of nanovg calls without any GPU work.
+
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "nanovg.h"
+
+struct NullRenderCounts
+{
+  int fills{0};
+  int strokes{0};
+  int paths{0};
+  int fillVerts{0};
+  int strokeVerts{0};
+
+  // textures created and not deleted, and the number of pixels with nonzero
+  // alpha in the last RGBA texture created.
+  int textures{0};
+  int lastTextureCoverage{0};
+
+  // all textures ever created, and the pixels sent by texture updates.
+  int texturesCreated{0};
+  long uploadedPixels{0};
+  std::map< int, std::pair< int, int > > textureSizes;
+
+  // if set, creating a texture fails, as when the GPU is out of memory.
+  bool failTextures{false};
+};
+
+inline int nullCreate(void*) { return 1; }
+inline int nullCreateTexture(void* p, int type, int w, int h, int, const unsigned char* data)
+{
+  auto counts = static_cast< NullRenderCounts* >(p);
+  if(counts->failTextures) return 0;
+  if(data && (type == NVG_TEXTURE_RGBA))
+  {
+    counts->lastTextureCoverage = 0;
+    for(int i = 0; i < w * h; ++i)
+    {
+      if(data[i * 4 + 3]) counts->lastTextureCoverage++;
+    }
+  }
+  counts->textures++;
+  int handle = ++counts->texturesCreated;
+  counts->textureSizes[handle] = {w, h};
+  return handle;
+}
+inline int nullDeleteTexture(void* p, int image)
+{
+  auto counts = static_cast< NullRenderCounts* >(p);
+  counts->textures--;
+  counts->textureSizes.erase(image);
+  return 1;
+}
+inline int nullUpdateTexture(void* p, int, int, int, int w, int h, const unsigned char*)
+{
+  static_cast< NullRenderCounts* >(p)->uploadedPixels += long(w) * h;
+  return 1;
+}
+inline int nullGetTextureSize(void* p, int image, int* w, int* h)
+{
+  auto counts = static_cast< NullRenderCounts* >(p);
+  auto it = counts->textureSizes.find(image);
+  if(it == counts->textureSizes.end()) return 0;
+  *w = it->second.first;
+  *h = it->second.second;
+  return 1;
+}
+inline void nullViewport(void*, float, float, float) {}
+inline void nullCancel(void*) {}
+inline void nullFlush(void*) {}
+inline void nullFill(void* p, NVGpaint*, NVGcompositeOperationState, NVGscissor*, float, const float*,
+                     const NVGpath* paths, int npaths)
+{
+  auto counts = static_cast< NullRenderCounts* >(p);
+  counts->fills++;
+  counts->paths += npaths;
+  for(int i = 0; i < npaths; ++i) counts->fillVerts += paths[i].nfill;
+}
+inline void nullStroke(void* p, NVGpaint*, NVGcompositeOperationState, NVGscissor*, float, float,
+                       const NVGpath* paths, int npaths)
+{
+  auto counts = static_cast< NullRenderCounts* >(p);
+  counts->strokes++;
+  counts->paths += npaths;
+  for(int i = 0; i < npaths; ++i) counts->strokeVerts += paths[i].nstroke;
+}
+inline void nullTriangles(void*, NVGpaint*, NVGcompositeOperationState, NVGscissor*, const NVGvertex*, int, float) {}
+inline void nullDelete(void*) {}
+
+inline NVGcontext* createNullContext(NullRenderCounts* counts)
+{
+  NVGparams params{};
+  params.userPtr = counts;
+  params.edgeAntiAlias = 1;
+  params.renderCreate = nullCreate;
+  params.renderCreateTexture = nullCreateTexture;
+  params.renderDeleteTexture = nullDeleteTexture;
+  params.renderUpdateTexture = nullUpdateTexture;
+  params.renderGetTextureSize = nullGetTextureSize;
+  params.renderViewport = nullViewport;
+  params.renderCancel = nullCancel;
+  params.renderFlush = nullFlush;
+  params.renderFill = nullFill;
+  params.renderStroke = nullStroke;
+  params.renderTriangles = nullTriangles;
+  params.renderDelete = nullDelete;
+  return nvgCreateInternal(&params);
+}
@@ -0,0 +1,72 @@
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "MLOfflineRender.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+struct TestRenderState
+{
+  SineGen sine;
+  float gain{1.f};
+};
+
+void processTestRender(AudioContext* ctx, void* untypedState)
+{
+  auto state = static_cast< TestRenderState* >(untypedState);
+  ctx->outputs[0] = state->sine(440.f/48000.f)*state->gain;
+}
+}
+
+TEST_CASE("mlvg/offlineRender", "[offlineRender]")
+{
+  OfflineRenderSettings settings;
+  settings.frames = 48000;
+  settings.outputChannels = 1;
+  settings.sampleRate = 48000;
+
+  // turn the sine off halfway through.
+  ParameterTimeline timeline{{settings.frames/2, "gain", 0.f}};
+
+  auto renderOnce = [&](OfflineRenderOutput& output)
+  {
+    TestRenderState state;
+    AudioContext ctx(0, 1, settings.sampleRate);
+    auto setParam = [&](const ParameterEvent& e) { state.gain = e.normalizedValue; };
+    return renderOffline(ctx, processTestRender, &state, settings, timeline, setParam, &output);
+  };
+
+  OfflineRenderOutput out1, out2;
+  auto stats = renderOnce(out1);
+  renderOnce(out2);
+
+  // output is deterministic
+  REQUIRE(out1.samples.size() == settings.frames);
+  REQUIRE(out1.samples == out2.samples);
+
+  // the event took effect at the start of the vector containing it
+  size_t eventFrame = (settings.frames/2) / kFloatsPerDSPVector * kFloatsPerDSPVector;
+  float maxBefore{0}, maxAfter{0};
+  for(size_t i = 0; i < settings.frames; ++i)
+  {
+    float a = fabs(out1.samples[i]);
+    if(i < eventFrame) maxBefore = std::max(maxBefore, a);
+    else maxAfter = std::max(maxAfter, a);
+  }
+  REQUIRE(maxBefore > 0.5f);
+  REQUIRE(maxAfter == 0.f);
+
+  REQUIRE(stats.vectors == (settings.frames + kFloatsPerDSPVector - 1) / kFloatsPerDSPVector);
+  REQUIRE(stats.minVectorNanos <= stats.meanVectorNanos);
+  REQUIRE(stats.meanVectorNanos <= stats.maxVectorNanos);
+
+  auto wav = makeWAVData(out1);
+  REQUIRE(wav.size() == 44 + settings.frames*sizeof(float));
+}
@@ -0,0 +1,75 @@
+
+
+#include <memory>
+#include <vector>
+
+#include "MLParameterSchema.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+void makeTestParameters(ParameterDescriptionList& params)
+{
+  params.push_back(std::make_unique< ParameterDescription >(WithValues{
+    { "name", "freq" },
+    { "range", { 40, 4000 } },
+    { "log", true },
+    { "default", 0.75 }
+  }));
+
+  params.push_back(std::make_unique< ParameterDescription >(WithValues{
+    { "name", "gain" },
+    { "range", { 0, 0.5 } },
+    { "plaindefault", 0.25 }
+  }));
+
+  params.push_back(std::make_unique< ParameterDescription >(WithValues{
+    { "name", "mix" }
+  }));
+}
+}
+
+TEST_CASE("mlvg/parameterSchema", "[parameterSchema]")
+{
+  ParameterDescriptionList pdl;
+  makeTestParameters(pdl);
+
+  auto schema1 = ParameterSchema::getShared("schema_test", pdl);
+  auto schema2 = ParameterSchema::getShared("schema_test", pdl);
+
+  // instances share one schema.
+  REQUIRE(schema1 == schema2);
+  REQUIRE(schema1.use_count() == 2);
+
+  REQUIRE(schema1->size() == 3);
+  REQUIRE(schema1->getID("gain") == 1);
+  REQUIRE(schema1->getID("nonexistent") == -1);
+  REQUIRE(schema1->getName(2) == Path("mix"));
+  REQUIRE(schema1->findDescription("freq") == &schema1->getDescription(0));
+
+  // normalized defaults follow the same rules as getNormalizedDefaultValue().
+  REQUIRE(schema1->getNormalizedDefault(0).getFloatValue() == Approx(0.75f));
+  REQUIRE(schema1->getNormalizedDefault(1).getFloatValue() == Approx(0.5f));
+  REQUIRE(schema1->getNormalizedDefault(2).getFloatValue() == Approx(0.5f));
+
+  // when no one is using the schema, it is freed and a new one is made on request.
+  std::weak_ptr< const ParameterSchema > weakSchema = schema1;
+  schema1.reset();
+  schema2.reset();
+  REQUIRE(weakSchema.expired());
+
+  auto schema3 = ParameterSchema::getShared("schema_test", pdl);
+  REQUIRE(schema3->size() == 3);
+
+  // different descriptions under the same key get their own schema.
+  ParameterDescriptionList changed;
+  makeTestParameters(changed);
+  changed[1]->setProperty("range", Value{0.f, 1.f});
+  auto schema4 = ParameterSchema::getShared("schema_test", changed);
+  REQUIRE(schema4 != schema3);
+  REQUIRE(schema4->getProjection(1).normalizedToReal(1.f) == Approx(1.f));
+  REQUIRE(ParameterSchema::getShared("schema_test", pdl) == schema3);
+}
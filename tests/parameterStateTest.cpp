@@ -0,0 +1,112 @@
+
+
+#include <cstring>
+#include <vector>
+
+#include "MLParameterState.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+// stand-in for IBStream: a growable memory buffer with a read position.
+struct MemoryStream
+{
+  std::vector< uint8_t > data;
+  size_t readPos{0};
+
+  int write(void* buffer, int numBytes, int* numBytesWritten)
+  {
+    auto p = static_cast< uint8_t* >(buffer);
+    data.insert(data.end(), p, p + numBytes);
+    if(numBytesWritten) *numBytesWritten = numBytes;
+    return 0;
+  }
+
+  int read(void* buffer, int numBytes, int* numBytesRead)
+  {
+    int n = std::min(numBytes, static_cast< int >(data.size() - readPos));
+    std::memcpy(buffer, data.data() + readPos, n);
+    readPos += n;
+    if(numBytesRead) *numBytesRead = n;
+    return 0;
+  }
+
+  void rewind() { readPos = 0; }
+  void clear() { data.clear(); readPos = 0; }
+};
+
+std::vector< Path > makeParamNames(size_t n)
+{
+  std::vector< Path > names;
+  for(size_t i = 0; i < n; ++i)
+  {
+    names.push_back(Path("group", TextFragment("param", textUtils::naturalNumberToText(i))));
+  }
+  return names;
+}
+}
+
+TEST_CASE("mlvg/parameterState/roundTrip", "[parameterState]")
+{
+  auto names = makeParamNames(16);
+  parameterState::Layout layout(names);
+
+  std::vector< float > values(names.size());
+  for(size_t i = 0; i < values.size(); ++i) values[i] = i * 0.25f;
+
+  MemoryStream stream;
+  REQUIRE(parameterState::write(&stream, values.data(), layout, false));
+  REQUIRE(stream.data.size() == sizeof(parameterState::Header) + values.size() * sizeof(float));
+
+  std::vector< float > loaded(names.size());
+  REQUIRE(parameterState::read(&stream, loaded.data(), layout) == parameterState::kReadExact);
+  REQUIRE(loaded == values);
+
+  // legacy state is a raw float list.
+  stream.clear();
+  stream.write(values.data(), values.size() * sizeof(float), nullptr);
+  std::fill(loaded.begin(), loaded.end(), 0.f);
+  REQUIRE(parameterState::read(&stream, loaded.data(), layout) == parameterState::kReadLegacy);
+  REQUIRE(loaded == values);
+}
+
+TEST_CASE("mlvg/parameterState/migration", "[parameterState]")
+{
+  std::vector< Path > oldNames{"gain", "freq_l", "freq_r"};
+  std::vector< float > oldValues{0.5f, 220.f, 330.f};
+
+  // new version adds a parameter and reorders the others.
+  std::vector< Path > newNames{"freq_r", "bypass", "gain", "freq_l"};
+  std::vector< float > newValues{0.f, 1.f, 0.f, 0.f};
+
+  MemoryStream stream;
+
+  // without a name table the state can't be matched.
+  parameterState::write(&stream, oldValues.data(), parameterState::Layout(oldNames), false);
+  REQUIRE(parameterState::read(&stream, newValues.data(), parameterState::Layout(newNames)) == parameterState::kReadError);
+
+  stream.clear();
+  parameterState::write(&stream, oldValues.data(), parameterState::Layout(oldNames), true);
+  REQUIRE(parameterState::read(&stream, newValues.data(), parameterState::Layout(newNames)) == parameterState::kReadMigrated);
+  REQUIRE(newValues == std::vector< float >{330.f, 1.f, 0.5f, 220.f});
+}
+
+TEST_CASE("mlvg/parameterState/manyParameters", "[parameterState]")
+{
+  // a large state with unchanged parameters is read in one piece.
+  constexpr size_t kParams{1000};
+  auto names = makeParamNames(kParams);
+  parameterState::Layout layout(names);
+
+  std::vector< float > values(kParams);
+  for(size_t i = 0; i < kParams; ++i) values[i] = i;
+  std::vector< float > loaded(kParams);
+
+  MemoryStream stream;
+  REQUIRE(parameterState::write(&stream, values.data(), layout, true));
+  REQUIRE(parameterState::read(&stream, loaded.data(), layout) == parameterState::kReadExact);
+  REQUIRE(loaded == values);
+}
@@ -0,0 +1,144 @@
+
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "MLPreparedSVG.h"
+#include "catch.hpp"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// an SVG with many shapes that have holes, gradients and strokes, like a
+// detailed background. Each shape is a plate with a grid of round holes, so it
+// has many subpaths.
+std::string makeComplexSVG(int nShapes)
+{
+  constexpr int kHoles{4};
+  std::string svg =
+      "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"512\" height=\"512\">\n"
+      "<defs><linearGradient id=\"g\" x1=\"0\" y1=\"0\" x2=\"0\" y2=\"1\">"
+      "<stop offset=\"0\" stop-color=\"#204060\"/><stop offset=\"1\" stop-color=\"#a0c0e0\"/>"
+      "</linearGradient></defs>\n";
+  for(int i = 0; i < nShapes; ++i)
+  {
+    int x = (i * 37) % 440, y = (i * 91) % 440;
+    std::string fill = (i % 3 == 0) ? "url(#g)" : "#" + std::to_string(100000 + i % 800000);
+    std::string opacity = (i % 5 == 0) ? " opacity=\"0.5\"" : "";
+
+    svg += "<path fill=\"" + fill + "\" stroke=\"#000000\" stroke-width=\"1.5\"" + opacity + " d=\"M" +
+           std::to_string(x) + " " + std::to_string(y) + " h" + std::to_string(kHoles * 16) + " v" +
+           std::to_string(kHoles * 16) + " h-" + std::to_string(kHoles * 16) + " z";
+    for(int j = 0; j < kHoles * kHoles; ++j)
+    {
+      int hx = x + 8 + (j % kHoles) * 16, hy = y + 4 + (j / kHoles) * 16;
+      svg += " M" + std::to_string(hx) + " " + std::to_string(hy) + " a4 4 0 1 0 0.01 0 z";
+    }
+    svg += "\"/>\n";
+  }
+  svg += "</svg>\n";
+  return svg;
+}
+
+// parse SVG text as VectorImage does, into an image to be freed with nsvgDelete().
+NSVGimage* parseSVG(const std::string& svg)
+{
+  std::vector< char > text(svg.size()*2, 0);
+  std::copy(svg.begin(), svg.end(), text.begin());
+  return nsvgParse(text.data(), "px", 96);
+}
+
+void drawFrame(NVGcontext* vg, NSVGimage* img)
+{
+  nvgBeginFrame(vg, 512, 512, 1.0f);
+  nvgDrawSVG(vg, img);
+  nvgCancelFrame(vg);
+}
+
+void drawFrame(NVGcontext* vg, const PreparedSVG* img)
+{
+  nvgBeginFrame(vg, 512, 512, 1.0f);
+  nvgDrawSVG(vg, img);
+  nvgCancelFrame(vg);
+}
+}
+
+TEST_CASE("mlvg/preparedSVG/equivalence", "[preparedSVG]")
+{
+  std::string svg = makeComplexSVG(200);
+  VectorImage image(nullptr, reinterpret_cast< const unsigned char* >(svg.data()), svg.size());
+  REQUIRE(image);
+  REQUIRE(image._prepared);
+  REQUIRE(image._prepared->nShapes == 200);
+
+  NullRenderCounts before, after;
+  NVGcontext* vgBefore = createNullContext(&before);
+  NVGcontext* vgAfter = createNullContext(&after);
+
+  NSVGimage* parsed = parseSVG(svg);
+  REQUIRE(parsed);
+  drawFrame(vgBefore, parsed);
+  drawFrame(vgAfter, image._prepared.get());
+  nsvgDelete(parsed);
+
+  // the same geometry is sent to the renderer.
+  REQUIRE(before.fills == after.fills);
+  REQUIRE(before.strokes == after.strokes);
+  REQUIRE(before.paths == after.paths);
+  REQUIRE(before.fillVerts == after.fillVerts);
+
+  nvgDeleteInternal(vgBefore);
+  nvgDeleteInternal(vgAfter);
+}
+
+TEST_CASE("mlvg/preparedSVG/compiled", "[preparedSVG]")
+{
+  std::string svg = makeComplexSVG(200);
+  VectorImage parsed(nullptr, reinterpret_cast< const unsigned char* >(svg.data()), svg.size());
+  REQUIRE(parsed);
+
+  std::vector< uint8_t > compiled = writeCompiledSVG(*parsed._prepared);
+  REQUIRE(PreparedSVG::isCompiled(compiled.data(), compiled.size()));
+  REQUIRE(!PreparedSVG::isCompiled(reinterpret_cast< const uint8_t* >(svg.data()), svg.size()));
+  REQUIRE(!PreparedSVG::isCompiled(compiled.data(), compiled.size() - 1));
+
+  // the data is little-endian whatever the host, starting with the magic "MLSV".
+  REQUIRE(std::memcmp(compiled.data(), "MLSV", 4) == 0);
+
+  // compiled data is used in place, with no parsing.
+  VectorImage loaded(nullptr, compiled.data(), compiled.size());
+  REQUIRE(loaded);
+  REQUIRE(reinterpret_cast< const uint8_t* >(loaded._prepared->shapes) ==
+          compiled.data() + sizeof(PreparedSVG::CompiledHeader));
+  REQUIRE(loaded.width == parsed.width);
+  REQUIRE(loaded.height == parsed.height);
+  REQUIRE(loaded._prepared->contentHash == parsed._prepared->contentHash);
+
+  // unaligned data is copied.
+  std::vector< uint8_t > offsetData(compiled.size() + 1);
+  std::copy(compiled.begin(), compiled.end(), offsetData.begin() + 1);
+  PreparedSVG copied(offsetData.data() + 1, compiled.size());
+  REQUIRE(copied.nShapes == parsed._prepared->nShapes);
+  REQUIRE(reinterpret_cast< const uint8_t* >(copied.shapes) != offsetData.data() + 1 + sizeof(PreparedSVG::CompiledHeader));
+  REQUIRE(copied.contentHash == parsed._prepared->contentHash);
+
+  // all forms draw the same geometry.
+  NullRenderCounts fromParsed, fromLoaded, fromCopied;
+  NVGcontext* vg1 = createNullContext(&fromParsed);
+  NVGcontext* vg2 = createNullContext(&fromLoaded);
+  NVGcontext* vg3 = createNullContext(&fromCopied);
+  drawFrame(vg1, parsed._prepared.get());
+  drawFrame(vg2, loaded._prepared.get());
+  drawFrame(vg3, &copied);
+  REQUIRE(fromParsed.fillVerts == fromLoaded.fillVerts);
+  REQUIRE(fromParsed.fillVerts == fromCopied.fillVerts);
+  REQUIRE(fromParsed.strokes == fromLoaded.strokes);
+  nvgDeleteInternal(vg1);
+  nvgDeleteInternal(vg2);
+  nvgDeleteInternal(vg3);
+}
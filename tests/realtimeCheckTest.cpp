@@ -0,0 +1,95 @@
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "MLRealtimeCheck.h"
+#include "catch.hpp"
+
+using namespace ml;
+
+#if ML_RT_SAFETY_CHECK
+
+TEST_CASE("mlvg/realtimeCheck", "[realtime]")
+{
+  rtcheck::resetViolationCounts();
+
+  // nothing is counted outside of a real-time scope.
+  {
+    auto p = std::make_unique< std::vector< float > >(100);
+  }
+  REQUIRE(rtcheck::getTotalViolationCount() == 0);
+
+  // safe code in a real-time scope.
+  {
+    ML_REALTIME_SCOPE;
+    float sum{0};
+    for(int i = 0; i < 100; ++i)
+    {
+      sum += i;
+    }
+    REQUIRE(sum > 0.f);
+  }
+  REQUIRE(rtcheck::getTotalViolationCount() == 0);
+
+  // allocation and deallocation.
+  {
+    ML_REALTIME_SCOPE;
+    auto p = std::make_unique< float[] >(100);
+  }
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kAllocation) == 1);
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kDeallocation) == 1);
+
+  // unsafe operations can be allowed explicitly.
+  {
+    ML_REALTIME_SCOPE;
+    rtcheck::AllowUnsafeScope allow;
+    auto p = std::make_unique< float[] >(100);
+  }
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kAllocation) == 1);
+
+#if defined(__GLIBC__)
+  // aligned C allocations.
+  int memalignResult{-1};
+  {
+    ML_REALTIME_SCOPE;
+    void* p{nullptr};
+    memalignResult = posix_memalign(&p, 64, 256);
+    free(p);
+    p = aligned_alloc(64, 256);
+    free(p);
+  }
+  REQUIRE(memalignResult == 0);
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kAllocation) == 3);
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kDeallocation) == 3);
+
+  std::mutex m;
+  {
+    ML_REALTIME_SCOPE;
+    std::lock_guard< std::mutex > lock(m);
+  }
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kLock) == 1);
+
+  // stdio, here to a file opened outside the scope.
+  std::FILE* f = std::fopen("/dev/null", "w");
+  REQUIRE(f);
+  {
+    ML_REALTIME_SCOPE;
+    std::fputs("level", f);
+    std::fputc('\n', f);
+  }
+  std::fclose(f);
+  REQUIRE(rtcheck::getViolationCount(rtcheck::kIO) == 2);
+#endif
+
+  std::ostringstream summary;
+  rtcheck::printViolationSummary(summary);
+  REQUIRE(summary.str().find("allocation") != std::string::npos);
+  rtcheck::resetViolationCounts();
+}
+
+#endif // ML_RT_SAFETY_CHECK
@@ -0,0 +1,99 @@
+
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "MLResourceCache.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+// make an SVG document with enough shapes to take a noticeable time to parse.
+std::string makeTestSVG(int nShapes)
+{
+  std::string svg = "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"512\" height=\"512\">\n";
+  for(int i = 0; i < nShapes; ++i)
+  {
+    int x = (i * 37) % 480, y = (i * 91) % 480;
+    svg += "<path fill=\"#" + std::to_string(100000 + i % 800000) + "\" d=\"M" + std::to_string(x) + " " +
+           std::to_string(y) + " c10 0 20 10 20 20 s-10 20 -20 20 s-20 -10 -20 -20 z\"/>\n";
+  }
+  svg += "</svg>\n";
+  return svg;
+}
+
+// approximate heap memory used by the distinct images in a list.
+size_t imageBytes(const std::vector< std::shared_ptr< VectorImage > >& images)
+{
+  std::set< const VectorImage* > distinct;
+  for(auto& img : images) distinct.insert(img.get());
+
+  size_t bytes{0};
+  for(auto img : distinct)
+  {
+    const PreparedSVG& p = *img->_prepared;
+    bytes += sizeof(VectorImage) + sizeof(PreparedSVG) + p.nPoints * 2 * sizeof(float) +
+             p.nPaths * sizeof(PreparedSVG::Path) + p.nShapes * sizeof(PreparedSVG::Shape);
+  }
+  return bytes;
+}
+}
+
+TEST_CASE("mlvg/resourceCache/sharing", "[resourceCache]")
+{
+  std::string svg = makeTestSVG(16);
+  auto data = reinterpret_cast< const unsigned char* >(svg.data());
+
+  SharedResourcePointer< ResourceCache > cache;
+  size_t liveBefore = cache->getNumLiveResources();
+  {
+    auto a = cache->getVectorImage(nullptr, data, svg.size());
+    auto b = cache->getVectorImage(nullptr, data, svg.size());
+    REQUIRE(a);
+    REQUIRE(a == b);
+
+    // same content at a different address is found by its hash.
+    std::string svgCopy = svg;
+    auto c = cache->getVectorImage(nullptr, reinterpret_cast< const unsigned char* >(svgCopy.data()), svgCopy.size());
+    REQUIRE(a == c);
+
+    REQUIRE(cache->getNumLiveResources() == liveBefore + 1);
+  }
+
+  // freed when the last user lets go.
+  REQUIRE(cache->getNumLiveResources() == liveBefore);
+}
+
+TEST_CASE("mlvg/resourceCache/instances", "[resourceCache]")
+{
+  std::string svg = makeTestSVG(2000);
+  auto data = reinterpret_cast< const unsigned char* >(svg.data());
+  SharedResourcePointer< ResourceCache > cache;
+  size_t liveBefore = cache->getNumLiveResources();
+
+  for(int nInstances : {1, 8, 32})
+  {
+    // each instance parsing its own copy, as before,
+    std::vector< std::shared_ptr< VectorImage > > separate;
+    for(int i = 0; i < nInstances; ++i)
+    {
+      separate.push_back(std::make_shared< VectorImage >(nullptr, data, svg.size()));
+    }
+
+    // and instances sharing through the cache, which parses the SVG once and keeps
+    // one copy however many instances there are.
+    std::vector< std::shared_ptr< VectorImage > > shared;
+    for(int i = 0; i < nInstances; ++i)
+    {
+      shared.push_back(cache->getVectorImage(nullptr, data, svg.size()));
+    }
+    REQUIRE(cache->getNumLiveResources() == liveBefore + 1);
+    REQUIRE(imageBytes(separate) == nInstances * imageBytes(shared));
+  }
+  REQUIRE(cache->getNumLiveResources() == liveBefore);
+}
@@ -0,0 +1,90 @@
+
+
+
+#include <memory>
+#include <string>
+
+#include "MLDrawContext.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+std::shared_ptr< VectorImage > makeImage(int size)
+{
+  std::string svg = "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" + std::to_string(size) + "\" height=\"" +
+                    std::to_string(size) + "\"><rect width=\"8\" height=\"8\"/></svg>";
+  return std::make_shared< VectorImage >(nullptr, reinterpret_cast< const unsigned char* >(svg.data()), svg.size());
+}
+}
+
+TEST_CASE("mlvg/resourceHandle/generation", "[resourceHandle]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  resources.vectorImages["icons/knob"] = makeImage(16);
+  resources.newGeneration();
+
+  VectorImageHandle handle;
+  int lookups{0};
+  auto makeName = [&]() {
+    lookups++;
+    return Path("icons/knob");
+  };
+
+  // looked up once, then kept.
+  VectorImage* image = handle.get(dc, makeName);
+  REQUIRE(image == resources.vectorImages["icons/knob"].get());
+  for(int i = 0; i < 10; ++i)
+  {
+    REQUIRE(handle.get(dc, makeName) == image);
+  }
+  REQUIRE(lookups == 1);
+
+  // cleared and initialized again: found again.
+  resources.vectorImages.clear();
+  resources.newGeneration();
+  REQUIRE(handle.get(dc, makeName) == nullptr);
+  resources.vectorImages["icons/knob"] = makeImage(32);
+  resources.newGeneration();
+  REQUIRE(handle.get(dc, makeName) == resources.vectorImages["icons/knob"].get());
+  REQUIRE(lookups == 3);
+
+  // reset looks up on the next get.
+  handle.reset();
+  handle.get(dc, makeName);
+  REQUIRE(lookups == 4);
+}
+
+TEST_CASE("mlvg/resourceHandle/draws", "[resourceHandle]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  for(int i = 0; i < 32; ++i)
+  {
+    resources.vectorImages[Path(TextFragment("images/", textUtils::naturalNumberToText(i)))] = makeImage(16);
+  }
+  resources.newGeneration();
+
+  // a widget property naming one of the images, as widgets read it in draw().
+  PropertyTree widget;
+  widget.setProperty("image_name", "images/17");
+
+  // the handle finds what a lookup by name finds, and reads the property only once.
+  VectorImage* byName = getVectorImage(dc, Path(widget.getTextProperty("image_name")));
+  VectorImageHandle handle;
+  int reads{0};
+  for(int i = 0; i < 100; ++i)
+  {
+    REQUIRE(handle.get(dc, [&]() {
+      reads++;
+      return Path(widget.getTextProperty("image_name"));
+    }) == byName);
+  }
+  REQUIRE(byName == resources.vectorImages["images/17"].get());
+  REQUIRE(reads == 1);
+}
@@ -0,0 +1,104 @@
+
+
+#include <cmath>
+#include <string>
+
+#include "catch.hpp"
+#include "nanovg.h"
+#include "nullNanoVG.h"
+
+namespace
+{
+// the test app's font, found relative to this file.
+int loadTestFont(NVGcontext* vg)
+{
+  std::string path(__FILE__);
+  path = path.substr(0, path.find_last_of("/\\") + 1) + "../examples/app/resources/D-DIN.otf";
+  return nvgCreateFont(vg, "d_din", path.c_str());
+}
+
+float measure(NVGcontext* vg, const char* text, float size)
+{
+  nvgFontSize(vg, size);
+  return nvgTextBounds(vg, 0, 0, text, nullptr, nullptr);
+}
+
+struct ResizeStats
+{
+  long pixelsPerFrame;
+  int texturesCreated;
+};
+
+// draw the labels of a view through a live resize, where the font sizes follow the
+// grid size in pixels as they do in TextLabelBasic and DialBasic.
+ResizeStats drawResize(bool sdf)
+{
+  const char* labels[] = {"attack", "decay", "sustain", "release", "cutoff", "resonance",
+                          "0.25",   "1.00",  "-12.5 dB", "440 Hz", "OPEN",   "Tesseract"};
+  constexpr int kFrames{120};
+  constexpr int kLabels{48};
+
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int font = loadTestFont(vg);
+  if(sdf)
+  {
+    nvgInternalParams(vg)->sdfText = 1;
+    nvgTextSDF(vg, 1);
+  }
+  nvgFontFaceId(vg, font);
+
+  for(int frame = 0; frame < kFrames; ++frame)
+  {
+    float gridSize = 24.f + frame * 0.5f;
+    nvgBeginFrame(vg, 1024, 768, 1.0f);
+    for(int i = 0; i < kLabels; ++i)
+    {
+      nvgFontSize(vg, gridSize * (0.3f + 0.05f * (i % 6)));
+      nvgText(vg, (i % 8) * 120.f, (i / 8) * 100.f, labels[i % 12], nullptr);
+    }
+    nvgEndFrame(vg);
+  }
+
+  ResizeStats stats{counts.uploadedPixels / kFrames, counts.texturesCreated};
+  nvgDeleteInternal(vg);
+  return stats;
+}
+}
+
+TEST_CASE("mlvg/sdfText/metrics", "[sdfText]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int font = loadTestFont(vg);
+  REQUIRE(font >= 0);
+  nvgFontFaceId(vg, font);
+  const char* text = "Tesseract 0.25";
+  float bitmapWidth = measure(vg, text, 16);
+
+  // not available unless the back-end supports it.
+  REQUIRE(nvgTextSDF(vg, 1) == 0);
+  nvgInternalParams(vg)->sdfText = 1;
+  int texturesBefore = counts.textures;
+  REQUIRE(nvgTextSDF(vg, 1) == 1);
+  REQUIRE(counts.textures == texturesBefore);
+
+  // SDF text scales with size, and is close to the bitmap text in width.
+  float sdfWidth = measure(vg, text, 16);
+  REQUIRE(std::fabs(measure(vg, text, 32) - 2 * sdfWidth) < 1.f);
+  REQUIRE(std::fabs(sdfWidth - bitmapWidth) < bitmapWidth * 0.05f);
+
+  REQUIRE(nvgTextSDF(vg, 0) == 0);
+  REQUIRE(measure(vg, text, 16) == bitmapWidth);
+  nvgDeleteInternal(vg);
+}
+
+TEST_CASE("mlvg/sdfText/resize", "[sdfText]")
+{
+  ResizeStats bitmap = drawResize(false);
+  ResizeStats sdf = drawResize(true);
+
+  // with distance fields, the atlas is made once and not replaced as sizes change.
+  REQUIRE(sdf.pixelsPerFrame < bitmap.pixelsPerFrame / 10);
+  REQUIRE(sdf.texturesCreated <= 2);
+}
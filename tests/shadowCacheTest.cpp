@@ -0,0 +1,93 @@
+
+
+
+#include "MLShadowCache.h"
+#include "catch.hpp"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+TEST_CASE("mlvg/shadowCache/images", "[shadowCache]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int texturesBefore = counts.textures;
+  {
+    ShadowCache shadows(vg);
+    nvgBeginFrame(vg, 512, 512, 1.0f);
+
+    // one image for each shape and size, whatever the position or color.
+    REQUIRE(shadows.drawRoundRect(10, 10, 100, 40, 4, 20, nvgRGBAf(0, 0, 0, 0.5f)));
+    REQUIRE(shadows.drawRoundRect(200, 100, 30, 300, 4, 20, nvgRGBAf(0.2f, 0, 0, 1.f)));
+    REQUIRE(shadows.getNumShadows() == 1);
+    REQUIRE(counts.textures == texturesBefore + 1);
+    REQUIRE(counts.lastTextureCoverage > 0);
+
+    // a 9-slice without its middle is eight fills, and nothing is stroked.
+    int fillsBefore = counts.fills;
+    shadows.drawRoundRect(10, 10, 100, 40, 4, 20, nvgRGBAf(0, 0, 0, 0.5f));
+    REQUIRE(counts.fills == fillsBefore + 8);
+    REQUIRE(counts.strokes == 0);
+
+    // circles, arcs and lines are one fill each. Arcs share the image of their ring.
+    fillsBefore = counts.fills;
+    REQUIRE(shadows.drawCircle(100, 100, 30, 40, nvgRGBAf(0, 0, 0, 1)));
+    REQUIRE(shadows.drawArc(100, 100, 0.5f, 2.5f, 30, 40, nvgRGBAf(0, 0, 0, 1)));
+    REQUIRE(shadows.drawArc(100, 100, 0.5f, 2.5f, 40, 30, nvgRGBAf(0, 0, 0, 1)));
+    REQUIRE(shadows.drawLine(0, 0, 100, 50, 8, nvgRGBAf(0, 0, 0, 1)));
+    REQUIRE(shadows.drawLine(0, 0, 100, 50, -8, nvgRGBAf(0, 0, 0, 1)));
+    REQUIRE(counts.fills == fillsBefore + 5);
+    REQUIRE(shadows.getNumShadows() == 4);
+
+    // large shadows are left to the caller.
+    REQUIRE(!shadows.drawCircle(0, 0, 10, ShadowCache::kMaxShadowSize, nvgRGBAf(0, 0, 0, 1)));
+
+    // only the most recently used images are kept. The images removed are still in
+    // use by the frame's fills, so they are deleted at the start of the next frame.
+    for(int i = 0; i < int(ShadowCache::kMaxShadows) * 2; ++i)
+    {
+      shadows.drawCircle(0, 0, 10, 11 + i, nvgRGBAf(0, 0, 0, 1));
+    }
+    REQUIRE(shadows.getNumShadows() == ShadowCache::kMaxShadows);
+    REQUIRE(counts.textures == texturesBefore + 4 + int(ShadowCache::kMaxShadows) * 2);
+    nvgEndFrame(vg);
+    shadows.beginFrame();
+    REQUIRE(counts.textures == texturesBefore + int(ShadowCache::kMaxShadows));
+  }
+
+  // all images are freed with the cache.
+  REQUIRE(counts.textures == texturesBefore);
+  nvgDeleteInternal(vg);
+}
+
+TEST_CASE("mlvg/shadowCache/failedImage", "[shadowCache]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  {
+    ShadowCache shadows(vg);
+    nvgBeginFrame(vg, 512, 512, 1.0f);
+    for(int i = 0; i < int(ShadowCache::kMaxShadows); ++i)
+    {
+      REQUIRE(shadows.drawCircle(0, 0, 10, 11 + i, nvgRGBAf(0, 0, 0, 1)));
+    }
+    int texturesBefore = counts.textures;
+
+    // if an image can't be made, the shadow is left to the caller and the full cache
+    // keeps all of its images.
+    counts.failTextures = true;
+    REQUIRE(!shadows.drawRoundRect(10, 10, 100, 40, 4, 20, nvgRGBAf(0, 0, 0, 0.5f)));
+    REQUIRE(shadows.getNumShadows() == ShadowCache::kMaxShadows);
+    REQUIRE(shadows.drawCircle(0, 0, 10, 11, nvgRGBAf(0, 0, 0, 1)));
+    nvgEndFrame(vg);
+    shadows.beginFrame();
+    REQUIRE(counts.textures == texturesBefore);
+
+    counts.failTextures = false;
+    nvgBeginFrame(vg, 512, 512, 1.0f);
+    REQUIRE(shadows.drawRoundRect(10, 10, 100, 40, 4, 20, nvgRGBAf(0, 0, 0, 0.5f)));
+    REQUIRE(shadows.getNumShadows() == ShadowCache::kMaxShadows);
+    nvgEndFrame(vg);
+  }
+  nvgDeleteInternal(vg);
+}
@@ -0,0 +1,114 @@
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "MLSpectrogram.h"
+#include "MLSpectrumAnalyzer.h"
+#include "catch.hpp"
+#include "madronalib.h"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// a sine centered on a bin of the FFT size.
+std::vector< float > makeSine(size_t n, size_t bin, size_t fftSize, float amplitude, size_t offset = 0)
+{
+  std::vector< float > s(n);
+  for(size_t i = 0; i < n; ++i)
+  {
+    s[i] = amplitude*std::sin(2.0*3.14159265358979323846*bin*(i + offset)/fftSize);
+  }
+  return s;
+}
+}
+
+TEST_CASE("mlvg/spectrogram/analyzer", "[spectrogram]")
+{
+  SpectrumAnalyzer analyzer(256, 64, -96.f);
+  REQUIRE(analyzer.getNumBins() == 128);
+
+  // a column for every hop once the first frame is complete, however the samples arrive.
+  auto sine = makeSine(256 + 64*19, 16, 256, 0.5f);
+  for(size_t i = 0; i < sine.size(); i += 100)
+  {
+    analyzer.write(sine.data() + i, std::min(size_t(100), sine.size() - i));
+  }
+  analyzer.waitForPending();
+  REQUIRE(!analyzer.isBusy());
+
+  std::vector< float > columns;
+  REQUIRE(analyzer.takeColumns(columns) == 20);
+  REQUIRE(columns.size() == 20*128);
+  std::vector< float > more;
+  REQUIRE(analyzer.takeColumns(more) == 0);
+
+  // each column peaks at the sine's bin, at its level in dB over the floor.
+  for(size_t c = 0; c < 20; ++c)
+  {
+    const float* levels = columns.data() + c*128;
+    REQUIRE(std::max_element(levels, levels + 128) - levels == 16);
+    REQUIRE(levels[16] == Approx(1.f - 20.f*std::log10(0.5f)/-96.f).margin(0.01));
+    REQUIRE(levels[100] < 0.1f);
+  }
+}
+
+TEST_CASE("mlvg/spectrogram/uploads", "[spectrogram]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  DrawingResources resources;
+  PropertyTree properties;
+  Theme theme = makeTheme(properties, 0);
+  GUICoordinates coords{20.f, Vec2(400, 200), 1.f, Vec2(0, 0)};
+  DrawContext dc{vg, &resources, &properties, coords, &theme};
+  constexpr int kRows{128};
+  constexpr int kFrames{300};
+  constexpr int kMeasureFrom{10};
+
+  // each frame brings two hops of new samples, for histories short and long.
+  for(int history : {128, 4096})
+  {
+    Spectrogram spectrogram(WithValues{
+        {"bounds", rectToMatrix({1, 1, 16, 8})}, {"fft_size", 256.f}, {"hop", 64.f}, {"history", float(history)}});
+    MessageList out;
+    long uploadedPixels{0};
+    int fills{0};
+    int texturesCreated{0};
+    for(int f = 0; f < kFrames; ++f)
+    {
+      auto sine = makeSine(128, 1 + f % 100, 256, 0.5f, f*128);
+      spectrogram.write(sine.data(), sine.size());
+      spectrogram.getAnalyzer().waitForPending();
+
+      NullRenderCounts before = counts;
+      spectrogram.animateInto(16, dc, out);
+      nvgBeginFrame(vg, 400, 200, 1.0f);
+      spectrogram.draw(dc);
+      nvgEndFrame(vg);
+      if(f >= kMeasureFrom)
+      {
+        uploadedPixels += counts.uploadedPixels - before.uploadedPixels;
+        fills += counts.fills - before.fills;
+        texturesCreated += counts.texturesCreated - before.texturesCreated;
+      }
+    }
+    const int measured = kFrames - kMeasureFrom;
+
+    // only the two new columns are uploaded, and the ring is drawn as at most two quads.
+    REQUIRE(uploadedPixels == long(measured)*2*kRows);
+    REQUIRE(fills <= measured*2);
+    REQUIRE(texturesCreated == 0);
+    REQUIRE(resources.widgetImages.count(&spectrogram) == 1);
+  }
+
+  // each Spectrogram's texture is freed with it.
+  REQUIRE(resources.widgetImages.empty());
+
+  nvgDeleteInternal(vg);
+}
@@ -0,0 +1,106 @@
+
+
+#include <string>
+
+#include "MLDrawContext.h"
+#include "MLTextLayoutCache.h"
+#include "catch.hpp"
+#include "madronalib.h"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// the test app's font, found relative to this file.
+int loadTestFont(NVGcontext* vg)
+{
+  std::string path(__FILE__);
+  path = path.substr(0, path.find_last_of("/\\") + 1) + "../examples/app/resources/D-DIN.otf";
+  return nvgCreateFont(vg, "d_din", path.c_str());
+}
+
+const char* kLongText = "The quick brown fox jumps over the lazy dog, then naps in the warm afternoon sun.";
+}
+
+TEST_CASE("mlvg/textLayoutCache/lines", "[textLayoutCache]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int font = loadTestFont(vg);
+  REQUIRE(font >= 0);
+
+  nvgFontFaceId(vg, font);
+  nvgFontSize(vg, 16);
+  nvgTextLetterSpacing(vg, 0);
+
+  TextLayoutCache cache;
+  const auto& layout = cache.getLines(vg, kLongText, font, 16, 0, 120, 1.25f, NVG_ALIGN_CENTER);
+  REQUIRE(layout.rows.size() > 1);
+  REQUIRE(layout.lineHeight > 0);
+
+  // same rows as nanovg's line breaking.
+  NVGtextRow rows[16];
+  int nRows = nvgTextBreakLines(vg, kLongText, nullptr, 120, rows, 16);
+  REQUIRE(nRows == (int)layout.rows.size());
+  for(int i = 0; i < nRows; ++i)
+  {
+    REQUIRE(kLongText + layout.rows[i].start == rows[i].start);
+    REQUIRE(kLongText + layout.rows[i].end == rows[i].end);
+  }
+  REQUIRE(cache.getMisses() == 1);
+
+  // hit with the same key, miss if any part changes.
+  cache.getLines(vg, kLongText, font, 16, 0, 120, 1.25f, NVG_ALIGN_CENTER);
+  REQUIRE(cache.getHits() == 1);
+  cache.getLines(vg, kLongText, font, 16, 0, 121, 1.25f, NVG_ALIGN_CENTER);
+  REQUIRE(cache.getMisses() == 2);
+
+  // fitted size is reduced to fit.
+  float fitted = cache.getFittedSize(vg, kLongText, font, 16, 0, 100);
+  REQUIRE(fitted < 16);
+  REQUIRE(cache.getFittedSize(vg, "1.00", font, 16, 0, 100) == 16);
+
+  nvgDeleteInternal(vg);
+}
+
+TEST_CASE("mlvg/textLayoutCache/frames", "[textLayoutCache]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  int font = loadTestFont(vg);
+  REQUIRE(font >= 0);
+
+  // a view with labels that don't change and numbers that change now and then.
+  // after the first frame nearly every layout should come from the cache.
+  constexpr int kFrames{240};
+  constexpr int kLabels{24};
+  constexpr int kNumbers{8};
+  std::vector< TextFragment > labels;
+  for(int i = 0; i < kLabels; ++i)
+  {
+    labels.push_back(TextFragment("label number ", TextFragment(std::to_string(i).c_str()), " with wrapping"));
+  }
+  auto numberText = [](int frame, int i) { return TextFragment(std::to_string((frame / 30 + i) % 100).c_str()); };
+
+  TextLayoutCache cache;
+  for(int frame = 0; frame < kFrames; ++frame)
+  {
+    nvgBeginFrame(vg, 512, 512, 1.0f);
+    for(int i = 0; i < kLabels; ++i)
+    {
+      Vec2 p(100.f + (i % 4) * 100.f, 20.f + (i / 4) * 60.f);
+      drawTextBox(vg, cache, font, 14, 0, p, 90, labels[i], NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
+    }
+    for(int i = 0; i < kNumbers; ++i)
+    {
+      Vec2 p(50.f + i * 50.f, 400.f);
+      drawTextToFit(vg, cache, font, numberText(frame, i), p, 16, 0.1f, 40, NVG_ALIGN_CENTER);
+    }
+    nvgCancelFrame(vg);
+  }
+
+  double hitRate = double(cache.getHits()) / double(cache.getHits() + cache.getMisses());
+  REQUIRE(hitRate > 0.9);
+  nvgDeleteInternal(vg);
+}
@@ -0,0 +1,64 @@
+
+
+#include "MLDrawContext.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+namespace
+{
+bool sameColor(NVGcolor a, NVGcolor b) { return (a.r == b.r) && (a.g == b.g) && (a.b == b.b) && (a.a == b.a); }
+}
+
+TEST_CASE("mlvg/theme/snapshot", "[theme]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  properties.setProperty("mark", colorToMatrix({0.01, 0.01, 0.01, 1.0}));
+  properties.setProperty("background", colorToMatrix({0.8, 0.8, 0.8, 1.0}));
+  properties.setProperty("common_stroke_width", 1 / 32.f);
+  properties.setProperty("draw_background_grid", true);
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+
+  // the same values the property getters return, set or not.
+  Theme theme = makeTheme(properties, 1);
+  REQUIRE(sameColor(theme.mark, getColor(dc, "mark")));
+  REQUIRE(sameColor(theme.background, getColor(dc, "background")));
+  REQUIRE(sameColor(theme.panelBackground, getColor(dc, "panel_bg")));
+  REQUIRE(theme.commonStrokeWidth == getFloat(dc, "common_stroke_width"));
+  REQUIRE(theme.drawBackgroundGrid);
+  REQUIRE(!theme.drawWidgetBounds);
+
+  // read from the context's Theme when it has one, so changes to the properties are
+  // not seen until a new Theme is made.
+  dc.pTheme = &theme;
+  properties.setProperty("mark", colorToMatrix({1, 0, 0, 1}));
+  REQUIRE(sameColor(getTheme(dc).mark, theme.mark));
+  REQUIRE(getTheme(dc).version == 1);
+  dc.pTheme = nullptr;
+  REQUIRE(sameColor(getTheme(dc).mark, getColor(dc, "mark")));
+}
+
+TEST_CASE("mlvg/theme/draws", "[theme]")
+{
+  DrawingResources resources;
+  PropertyTree properties;
+  properties.setProperty("mark", colorToMatrix({0.01, 0.01, 0.01, 1.0}));
+  properties.setProperty("background", colorToMatrix({0.8, 0.8, 0.8, 1.0}));
+  properties.setProperty("draw_widget_bounds", false);
+  DrawContext dc{nullptr, &resources, &properties, GUICoordinates{}};
+  Theme theme = makeTheme(properties, 1);
+
+  // the style reads of widget draws refer to the context's Theme without copying it,
+  // and find what the property reads find.
+  dc.pTheme = &theme;
+  for(int i = 0; i < 100; ++i)
+  {
+    const Theme& t = getTheme(dc);
+    REQUIRE(&t == &theme);
+    REQUIRE(sameColor(t.mark, getColor(dc, "mark")));
+    REQUIRE(sameColor(t.background, getColor(dc, "background")));
+    REQUIRE(t.drawWidgetBounds == dc.pProperties->getBoolPropertyWithDefault("draw_widget_bounds", false));
+  }
+}
@@ -0,0 +1,114 @@
+
+
+
+#include <memory>
+#include <vector>
+
+#include "MLTimerWheel.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+TEST_CASE("mlvg/timerWheel/deadlines", "[timerWheel]")
+{
+  TimerWheel wheel;
+  std::vector< uint64_t > calledAt;
+  auto record = [&]() { calledAt.push_back(wheel.now()); };
+
+  // deadlines at every level and beyond, each called once at its time.
+  std::vector< int > delays{1, 2, 63, 64, 65, 250, 4095, 4096, 5000, 262143, 262144, 300000, 17000000};
+  std::vector< std::unique_ptr< TimerWheel::Deadline > > deadlines;
+  for(int ms : delays)
+  {
+    deadlines.push_back(std::make_unique< TimerWheel::Deadline >(record));
+    wheel.schedule(*deadlines.back(), ms);
+  }
+  REQUIRE(wheel.size() == delays.size());
+
+  // advance by irregular frame times.
+  while(wheel.size() > 0)
+  {
+    wheel.advance(wheel.now() < 300000 ? 17 : 1000);
+  }
+  REQUIRE(calledAt.size() == delays.size());
+  for(size_t i = 0; i < delays.size(); ++i)
+  {
+    // a deadline is called in the frame that reaches its time.
+    uint64_t frame = delays[i] <= 300000 ? 17 : 1000;
+    REQUIRE(calledAt[i] >= uint64_t(delays[i]));
+    REQUIRE(calledAt[i] < delays[i] + frame);
+  }
+
+  // scheduling again postpones, and cancelling removes.
+  int count{0};
+  TimerWheel::Deadline a([&]() { count++; });
+  wheel.schedule(a, 100);
+  wheel.advance(90);
+  wheel.schedule(a, 100);
+  wheel.advance(90);
+  REQUIRE(count == 0);
+  REQUIRE(a.isActive());
+  wheel.advance(10);
+  REQUIRE(count == 1);
+  REQUIRE(!a.isActive());
+  wheel.schedule(a, 100);
+  a.cancel();
+  wheel.advance(200);
+  REQUIRE(count == 1);
+
+  // a deadline can schedule itself again.
+  int repeats{0};
+  TimerWheel::Deadline b([&]() {
+    if(++repeats < 10) wheel.schedule(b, 5);
+  });
+  wheel.schedule(b, 5);
+  wheel.advance(1000);
+  REQUIRE(repeats == 10);
+
+  // a deadline destroyed while scheduled leaves the wheel.
+  {
+    TimerWheel::Deadline c([&]() { count++; });
+    wheel.schedule(c, 10);
+    REQUIRE(wheel.size() == 1);
+  }
+  REQUIRE(wheel.size() == 0);
+  wheel.advance(100);
+  REQUIRE(count == 1);
+}
+
+TEST_CASE("mlvg/timerWheel/scrollBurst", "[timerWheel]")
+{
+  // a scroll burst over a large view: each event postpones the deadline of the dial
+  // under the pointer, starting it if needed, and a click cancels it.
+  constexpr int kWidgets{500};
+  constexpr int kEvents{20000};
+  constexpr int kEngageMs{250};
+
+  int ended{0};
+  std::vector< std::unique_ptr< TimerWheel::Deadline > > deadlines;
+  for(int i = 0; i < kWidgets; ++i)
+  {
+    deadlines.push_back(std::make_unique< TimerWheel::Deadline >([&]() { ended++; }));
+  }
+
+  TimerWheel wheel;
+  for(int i = 0; i < kEvents; ++i)
+  {
+    auto& d = *deadlines[(i/16) % kWidgets];
+    if(i % 64 == 63)
+    {
+      d.cancel();
+    }
+    else
+    {
+      wheel.schedule(d, kEngageMs);
+    }
+    if(i % 8 == 0) wheel.advance(16);
+  }
+
+  // every burst ends once, unless it was cancelled.
+  wheel.advance(1000);
+  REQUIRE(wheel.size() == 0);
+  REQUIRE(ended > 0);
+}
@@ -0,0 +1,169 @@
+
+
+
+#include <memory>
+#include <vector>
+
+#include "MLTweenEngine.h"
+#include "MLWidget.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+TEST_CASE("mlvg/tweenEngine/tweens", "[tweenEngine]")
+{
+  TweenEngine tweens;
+  Widget w(WithValues{});
+  Widget other(WithValues{});
+  w._dirty = other._dirty = false;
+
+  // one property for each easing, following its projection.
+  const Projection easings[TweenEngine::kNumEasings]{
+      projections::unity,       projections::easeIn,      projections::easeOut,       projections::easeInOut,
+      projections::easeInCubic, projections::easeOutCubic, projections::easeInOutCubic};
+  std::vector< TweenEngine::Slot > slots;
+  for(int e = 0; e < TweenEngine::kNumEasings; ++e)
+  {
+    slots.push_back(tweens.addTarget(&w, Path(TextFragment("p", textUtils::naturalNumberToText(e)))));
+    tweens.start(slots.back(), 2.f, 6.f, 100, TweenEngine::Easing(e));
+  }
+  REQUIRE(tweens.size() == TweenEngine::kNumEasings);
+  for(int t = 10; t < 100; t += 10)
+  {
+    tweens.advance(10);
+    for(int e = 0; e < TweenEngine::kNumEasings; ++e)
+    {
+      float expected = 2.f + 4.f*easings[e](t/100.f);
+      REQUIRE(w.getFloatProperty(Path(TextFragment("p", textUtils::naturalNumberToText(e)))) ==
+              Approx(expected).margin(1e-5));
+    }
+  }
+
+  // only the Widget being animated is marked dirty.
+  REQUIRE(w.isDirty());
+  REQUIRE(!other.isDirty());
+
+  // at the end, each property gets exactly its end value and its tween is removed.
+  tweens.advance(10);
+  REQUIRE(tweens.size() == 0);
+  for(int e = 0; e < TweenEngine::kNumEasings; ++e)
+  {
+    REQUIRE(w.getFloatProperty(Path(TextFragment("p", textUtils::naturalNumberToText(e)))) == 6.f);
+    REQUIRE(!tweens.isActive(slots[e]));
+  }
+
+  // retargeting starts from the value last set, and stopping leaves the value.
+  tweens.retarget(slots[0], 10.f, 40);
+  tweens.advance(20);
+  REQUIRE(w.getFloatProperty("p0") == Approx(8.f));
+  tweens.retarget(slots[0], 0.f, 80);
+  tweens.advance(40);
+  REQUIRE(w.getFloatProperty("p0") == Approx(4.f));
+  tweens.stop(slots[0]);
+  tweens.advance(40);
+  REQUIRE(w.getFloatProperty("p0") == Approx(4.f));
+  REQUIRE(tweens.size() == 0);
+}
+
+TEST_CASE("mlvg/tweenEngine/deletedWidgets", "[tweenEngine]")
+{
+  // a Widget that counts the times it is marked dirty.
+  struct DirtyWidget : public Widget
+  {
+    DirtyWidget() : Widget(WithValues{}) {}
+    int dirtyCount{0};
+    void setDirty(bool d) override
+    {
+      if(d) dirtyCount++;
+      Widget::setDirty(d);
+    }
+  };
+
+  TweenEngine tweens;
+  DirtyWidget w;
+  w._tweens = &tweens;
+  auto kept = tweens.addTarget(&w, "a");
+  tweens.start(kept, 0.f, 1.f, 100);
+
+  // tweened Widgets are marked dirty through setDirty().
+  tweens.advance(10);
+  REQUIRE(w.dirtyCount == 1);
+
+  // deleting a Widget stops its tweens and frees its slots for the next Widget.
+  auto doomed = std::make_unique< DirtyWidget >();
+  doomed->_tweens = &tweens;
+  auto s0 = tweens.addTarget(doomed.get(), "a");
+  auto s1 = tweens.addTarget(doomed.get(), "b");
+  tweens.start(s0, 0.f, 1.f, 100);
+  tweens.start(s1, 0.f, 1.f, 100);
+  REQUIRE(tweens.size() == 3);
+  doomed.reset();
+  REQUIRE(tweens.size() == 1);
+  REQUIRE(!tweens.isActive(s0));
+  REQUIRE(!tweens.isActive(s1));
+  tweens.advance(10);
+
+  DirtyWidget next;
+  next._tweens = &tweens;
+  auto reused = tweens.addTarget(&next, "c");
+  REQUIRE((reused == s0 || reused == s1));
+  tweens.start(reused, 2.f, 4.f, 20);
+  tweens.advance(10);
+  REQUIRE(next.getFloatProperty("c") == Approx(3.f));
+  REQUIRE(w.getFloatProperty("a") == Approx(0.3f));
+  REQUIRE(tweens.isActive(kept));
+}
+
+TEST_CASE("mlvg/tweenEngine/ledWall", "[tweenEngine]")
+{
+  // an LED wall: many Widgets each with several levels, all easing to new targets.
+  constexpr int kWidgets{512};
+  constexpr int kLevelsPerWidget{8};
+  constexpr int kTweens{kWidgets*kLevelsPerWidget};
+  constexpr int kFrames{100};
+  std::vector< Path > levelNames;
+  for(int i = 0; i < kLevelsPerWidget; ++i)
+  {
+    levelNames.push_back(Path(TextFragment("level", textUtils::naturalNumberToText(i))));
+  }
+  std::vector< std::unique_ptr< Widget > > widgets;
+  for(int i = 0; i < kWidgets; ++i)
+  {
+    widgets.push_back(std::make_unique< Widget >(WithValues{}));
+    widgets.back()->_dirty = false;
+  }
+
+  TweenEngine tweens;
+  std::vector< TweenEngine::Slot > slots;
+  for(auto& w : widgets)
+  {
+    for(auto& name : levelNames)
+    {
+      slots.push_back(tweens.addTarget(w.get(), name));
+    }
+  }
+  auto target = [](int i, int f) { return ((i*7 + f*13) % 100)*0.01f; };
+
+  // every tween retargeted each 10 frames.
+  for(int f = 0; f < kFrames; ++f)
+  {
+    if(f % 10 == 0)
+    {
+      for(int i = 0; i < kTweens; ++i) tweens.retarget(slots[i], target(i, f), 160, TweenEngine::kEaseOutCubic);
+    }
+    tweens.advance(16);
+  }
+
+  // every property ends on its last target, and marks its Widget dirty.
+  for(int i = 0; i < kTweens; i += 97)
+  {
+    REQUIRE(widgets[i/kLevelsPerWidget]->getFloatProperty(levelNames[i % kLevelsPerWidget]) ==
+            Approx(target(i, 90)));
+  }
+  REQUIRE(tweens.size() == 0);
+  for(auto& w : widgets)
+  {
+    REQUIRE(w->isDirty());
+  }
+}
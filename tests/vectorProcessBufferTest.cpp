@@ -0,0 +1,43 @@
+
+
+#include <algorithm>
+#include <vector>
+
+#include "MLVectorProcessBuffer.h"
+#include "catch.hpp"
+#include "madronalib.h"
+
+using namespace ml;
+
+TEST_CASE("mlvg/vectorProcessBuffer/delay", "[vectorProcessBuffer]")
+{
+  // an identity process should delay the input by exactly one vector,
+  // whatever the block sizes.
+  constexpr size_t kTotalFrames{4096};
+  std::vector< float > in(kTotalFrames), out(kTotalFrames);
+  for(size_t i = 0; i < kTotalFrames; ++i)
+  {
+    in[i] = i + 1.f;
+  }
+
+  StaticVectorProcessBuffer< 1, 1 > buffer;
+  const size_t blockSizes[] = {1, 7, 64, 13, 300, 2, 511};
+  size_t pos{0}, b{0};
+  while(pos < kTotalFrames)
+  {
+    size_t frames = std::min(blockSizes[b++ % 7], kTotalFrames - pos);
+    const float* pIn = in.data() + pos;
+    float* pOut = out.data() + pos;
+    buffer.process(&pIn, &pOut, frames, [](const DSPVectorArray< 1 >& v) { return v; });
+    pos += frames;
+  }
+
+  constexpr size_t kLatency = StaticVectorProcessBuffer< 1, 1 >::kLatencyInFrames;
+  bool OK{true};
+  for(size_t i = 0; i < kTotalFrames; ++i)
+  {
+    float expected = (i < kLatency) ? 0.f : in[i - kLatency];
+    if(out[i] != expected) OK = false;
+  }
+  REQUIRE(OK);
+}
@@ -0,0 +1,137 @@
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "MLDrawContext.h"
+#include "MLMinMaxPyramid.h"
+#include "MLWaveform.h"
+#include "catch.hpp"
+#include "madronalib.h"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// a test signal: a chirp with some noise, different at every sample.
+std::vector< float > makeSignal(size_t n)
+{
+  std::vector< float > s(n);
+  uint32_t seed{1};
+  for(size_t i = 0; i < n; ++i)
+  {
+    seed = seed*1664525u + 1013904223u;
+    float noise = (seed >> 8)*(1.f/16777216.f) - 0.5f;
+    s[i] = 0.8f*std::sin(i*(0.001f + i*1e-7f)) + 0.2f*noise;
+  }
+  return s;
+}
+}
+
+TEST_CASE("mlvg/waveform/pyramid", "[waveform]")
+{
+  MinMaxPyramid pyramid(4096);
+  REQUIRE(pyramid.capacity() == 4096);
+
+  // before anything is written, the history is silence.
+  std::vector< float > mins(64), maxes(64);
+  pyramid.getColumns(4096, 64, mins.data(), maxes.data());
+  REQUIRE(*std::min_element(mins.begin(), mins.end()) == 0.f);
+  REQUIRE(*std::max_element(maxes.begin(), maxes.end()) == 0.f);
+
+  // write in uneven pieces, wrapping the buffer a few times.
+  auto signal = makeSignal(20000);
+  for(size_t i = 0, n = 1; i < signal.size(); i += n, n = (n*7 + 3) % 500)
+  {
+    pyramid.write(signal.data() + i, std::min(n, signal.size() - i));
+  }
+  REQUIRE(pyramid.getSamplesWritten() == signal.size());
+
+  // with a power of two samples per column, each column is one pair of a level, and
+  // its span is exactly the min and max of its samples.
+  const size_t end = signal.size() & ~size_t(63);
+  const size_t start = end - 2048;
+  REQUIRE(pyramid.getLevelForSamplesPerColumn(64.f) == 6);
+  mins.resize(32);
+  maxes.resize(32);
+  pyramid.getColumns(2048, 32, mins.data(), maxes.data());
+  for(size_t c = 0; c < 32; ++c)
+  {
+    auto first = signal.begin() + start + c*64;
+    REQUIRE(mins[c] == *std::min_element(first, first + 64));
+    REQUIRE(maxes[c] == *std::max_element(first, first + 64));
+  }
+
+  // otherwise, each span covers all of its column's samples.
+  for(size_t columns : {7, 100, 333})
+  {
+    mins.resize(columns);
+    maxes.resize(columns);
+    pyramid.getColumns(3000, columns, mins.data(), maxes.data());
+    int k = pyramid.getLevelForSamplesPerColumn(3000.f/columns);
+    size_t windowEnd = (signal.size() >> k) << k;
+    double samplesPerColumn = 3000.0/columns;
+    for(size_t c = 0; c < columns; ++c)
+    {
+      auto first = signal.begin() + windowEnd - 3000 + size_t(c*samplesPerColumn);
+      auto last = signal.begin() + windowEnd - 3000 + std::max(size_t((c + 1)*samplesPerColumn), size_t(c*samplesPerColumn) + 1);
+      REQUIRE(mins[c] <= *std::min_element(first, last));
+      REQUIRE(maxes[c] >= *std::max_element(first, last));
+    }
+  }
+}
+
+TEST_CASE("mlvg/waveform/vertices", "[waveform]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  DrawingResources resources;
+  PropertyTree properties;
+  Theme theme = makeTheme(properties, 0);
+  GUICoordinates coords{20.f, Vec2(400, 200), 1.f, Vec2(0, 0)};
+  DrawContext dc{vg, &resources, &properties, coords, &theme};
+  const Rect bounds{1, 1, 12, 4};
+  const int columns = int(bounds.width()*20.f);
+
+  // a waveform of each size, drawn with the pyramid and as a line through every sample.
+  int firstWaveformVerts{0};
+  for(size_t size : {1024, 16384, 262144})
+  {
+    auto signal = makeSignal(size);
+    Waveform waveform(WithValues{{"bounds", rectToMatrix(bounds)}, {"buffer_size", float(size)}, {"window", float(size)}});
+    waveform.write(signal.data(), signal.size());
+
+    counts = NullRenderCounts{};
+    nvgBeginFrame(vg, 400, 200, 1.0f);
+    waveform.draw(dc);
+    nvgEndFrame(vg);
+    NullRenderCounts waveformCounts = counts;
+
+    counts = NullRenderCounts{};
+    nvgBeginFrame(vg, 400, 200, 1.0f);
+    nvgBeginPath(vg);
+    for(size_t i = 0; i < size; ++i)
+    {
+      float x = i*columns/float(size);
+      float y = 40.f - signal[i]*40.f;
+      if(i == 0) nvgMoveTo(vg, x, y);
+      else nvgLineTo(vg, x, y);
+    }
+    nvgStrokeWidth(vg, 1.0f);
+    nvgStroke(vg);
+    nvgEndFrame(vg);
+    NullRenderCounts lineCounts = counts;
+
+    // one stroke with one span per column, whatever the number of samples.
+    REQUIRE(waveformCounts.strokes == 1);
+    REQUIRE(waveformCounts.paths == columns);
+    if(!firstWaveformVerts) firstWaveformVerts = waveformCounts.strokeVerts;
+    REQUIRE(waveformCounts.strokeVerts == firstWaveformVerts);
+    REQUIRE(waveformCounts.strokeVerts < lineCounts.strokeVerts);
+  }
+
+  nvgDeleteInternal(vg);
+}
@@ -0,0 +1,147 @@
+
+
+
+#include <functional>
+
+#include "MLDrawContext.h"
+#include "MLToggleButtonBasic.h"
+#include "MLView.h"
+#include "MLWidgetArray.h"
+#include "catch.hpp"
+#include "madronalib.h"
+#include "nullNanoVG.h"
+
+using namespace ml;
+
+namespace
+{
+// a 16 x 64 step sequencer grid, with cells half a grid unit square.
+constexpr int kRows{16};
+constexpr int kColumns{64};
+constexpr int kCells{kRows*kColumns};
+const Rect kGridBounds{1, 1, kColumns*0.5f, kRows*0.5f};
+
+Path cellParam(int i) { return Path("seq/step", Path(textUtils::naturalNumberToText(i))); }
+Vec2 cellCenter(int i) { return Vec2(1.25f + (i % kColumns)*0.5f, 1.25f + (i / kColumns)*0.5f); }
+}
+
+TEST_CASE("mlvg/widgetArray/cells", "[widgetArray]")
+{
+  WidgetArray grid(WithValues{
+      {"bounds", rectToMatrix(kGridBounds)}, {"rows", float(kRows)}, {"columns", float(kColumns)}, {"param", "seq/step"}});
+  REQUIRE(grid.getNumCells() == kCells);
+
+  // hit testing by grid math.
+  REQUIRE(grid.getCellAt(Vec2(1.1f, 1.1f)) == 0);
+  REQUIRE(grid.getCellAt(cellCenter(kCells - 1)) == kCells - 1);
+  REQUIRE(grid.getCellAt(cellCenter(3*kColumns + 17)) == 3*kColumns + 17);
+  REQUIRE(grid.getCellAt(Vec2(0.5f, 1.1f)) == -1);
+  REQUIRE(grid.getCellBounds(kColumns + 1) == Rect(1.5f, 1.5f, 0.5f, 0.5f));
+
+  // every cell's parameter, and no others.
+  REQUIRE(grid.knowsParam(cellParam(0)));
+  REQUIRE(grid.knowsParam(cellParam(kCells - 1)));
+  REQUIRE(!grid.knowsParam(cellParam(kCells)));
+  REQUIRE(!grid.knowsParam("seq/step"));
+  REQUIRE(!grid.knowsParam("seq/gate/3"));
+
+  // a parameter change marks just its cell dirty.
+  grid.setDirty(false);
+  grid.handleMessage(Message{Path("set_param", cellParam(70)), 1.f}, nullptr);
+  REQUIRE(grid.getCellValue(70));
+  REQUIRE(grid.isDirty());
+  REQUIRE(grid.isCellDirty(70));
+  REQUIRE(!grid.isCellDirty(71));
+  REQUIRE(grid.getDirtyBounds() == grid.getCellBounds(70));
+  grid.setDirty(false);
+  REQUIRE(!grid.isCellDirty(70));
+  REQUIRE(grid.getDirtyBounds() == kGridBounds);
+
+  // clicking toggles a cell, and dragging paints its new value.
+  MessageList out;
+  grid.processGUIEventInto(GUICoordinates{}, GUIEvent("down", cellCenter(69)), out);
+  grid.processGUIEventInto(GUICoordinates{}, GUIEvent("drag", cellCenter(70)), out);
+  grid.processGUIEventInto(GUICoordinates{}, GUIEvent("drag", cellCenter(71)), out);
+  grid.processGUIEventInto(GUICoordinates{}, GUIEvent("up", cellCenter(71)), out);
+  REQUIRE(out.size() == 2);
+  REQUIRE(out[0].address == Path("editor/set_param", cellParam(69)));
+  REQUIRE(out[1].address == Path("editor/set_param", cellParam(71)));
+  REQUIRE(grid.getCellValue(69));
+  REQUIRE(grid.getCellValue(70));
+  REQUIRE(grid.getCellValue(71));
+  REQUIRE(grid.getDirtyBounds() == rectEnclosing(grid.getCellBounds(69), grid.getCellBounds(71)));
+}
+
+TEST_CASE("mlvg/widgetArray/frames", "[widgetArray]")
+{
+  NullRenderCounts counts;
+  NVGcontext* vg = createNullContext(&counts);
+  DrawingResources resources;
+  PropertyTree properties;
+  Theme theme = makeTheme(properties, 0);
+  GUICoordinates coords{20.f, Vec2(1400, 400), 1.f, Vec2(0, 0)};
+  DrawContext dc{vg, &resources, &properties, coords, &theme};
+  constexpr int kFrames{200};
+
+  // the grid as one ToggleButtonBasic per cell,
+  CollectionRoot< Widget > buttonRoot;
+  View buttonView(buttonRoot, WithValues{{"bounds", rectToMatrix({0, 0, 70, 20})}});
+  for(int i = 0; i < kCells; ++i)
+  {
+    Rect b(kGridBounds.left() + (i % kColumns)*0.5f, kGridBounds.top() + (i / kColumns)*0.5f, 0.5f, 0.5f);
+    buttonView._widgets.add_unique< ToggleButtonBasic >(
+        Path(TextFragment("b", textUtils::naturalNumberToText(i))),
+        WithValues{{"bounds", rectToMatrix(b)}, {"param", pathToText(cellParam(i))}, {"size", 0.4f}});
+  }
+  std::vector< Widget* > buttons;
+  forEachChild< Widget >(buttonView._widgets, [&](Widget& w) {
+    w.setupParams();
+    buttons.push_back(&w);
+  });
+
+  // and as a WidgetArray.
+  CollectionRoot< Widget > arrayRoot;
+  View arrayView(arrayRoot, WithValues{{"bounds", rectToMatrix({0, 0, 70, 20})}});
+  arrayView._widgets.add_unique< WidgetArray >("grid", WithValues{{"bounds", rectToMatrix(kGridBounds)},
+                                                                   {"rows", float(kRows)},
+                                                                   {"columns", float(kColumns)},
+                                                                   {"param", "seq/step"}});
+  Widget* grid{nullptr};
+  forEachChild< Widget >(arrayView._widgets, [&](Widget& w) { grid = &w; });
+
+  // a playhead: each frame, one step in every row turns on and the previous one turns
+  // off, and the pointer moves over the grid.
+  auto runFrames = [&](View& view, std::function< void(int, float) > setCell) {
+    counts = NullRenderCounts{};
+    nvgBeginFrame(vg, 1400, 400, 1.0f);
+    view.draw(dc);
+    nvgEndFrame(vg);
+    for(int f = 0; f < kFrames; ++f)
+    {
+      for(int row = 0; row < kRows; ++row)
+      {
+        setCell(row*kColumns + (f % kColumns), 1.f);
+        setCell(row*kColumns + ((f + kColumns - 1) % kColumns), 0.f);
+      }
+      view.processGUIEvent(coords, GUIEvent("move", cellCenter((f*37) % kCells)));
+      nvgBeginFrame(vg, 1400, 400, 1.0f);
+      view.draw(dc);
+      nvgEndFrame(vg);
+    }
+  };
+
+  runFrames(buttonView, [&](int i, float v) {
+    buttons[i]->handleMessage(Message{Path("set_param", cellParam(i)), v}, nullptr);
+  });
+  NullRenderCounts buttonCounts = counts;
+  runFrames(arrayView, [&](int i, float v) {
+    grid->handleMessage(Message{Path("set_param", cellParam(i)), v}, nullptr);
+  });
+  NullRenderCounts arrayCounts = counts;
+
+  // the array redraws only the playhead columns, in a few nanovg calls.
+  REQUIRE(arrayCounts.fills < buttonCounts.fills);
+  REQUIRE(arrayCounts.fills <= 3*(kFrames + 1));
+
+  nvgDeleteInternal(vg);
+}